@@ -7,6 +7,7 @@ else
 fi
 
 PROG="$SPIN2CPP -I../Lib"
+FLEXSPIN=`dirname $SPIN2CPP`/flexspin
 CC=propeller-elf-gcc
 ok="ok"
 endmsg=$ok
@@ -97,6 +98,72 @@ do
   fi
 done
 
+# static timing reports
+for i in tmtest*.spin2
+do
+  j=`basename $i .spin2`
+  $PROG --p2 --asm --code=hub --fcache=64 --cycle-report --optimize 'all,!remove-unused,!remove-bss' --noheader $i
+  if  diff -ub Expect/$j.cycles.json $j.cycles.json
+  then
+      rm -f $j.cycles.json $j.p2asm
+      echo $j passed
+  else
+      echo $j failed
+      endmsg="TEST FAILURES"
+  fi
+done
+
+# whole program P2 tests (with the startup code, so LUT gets loaded)
+for i in lutest*.spin2
+do
+  j=`basename $i .spin2`
+  $PROG --p2 --asm --code=hub --main --optimize 'all,!remove-unused,!remove-bss' --noheader $i
+  if  diff -ub Expect/$j.p2asm $j.p2asm
+  then
+      rm -f $j.p2asm
+      echo $j passed
+  else
+      echo $j failed
+      endmsg="TEST FAILURES"
+  fi
+done
+
+# profile guided optimization tests; a test with a .prof file
+# is compiled using it, the others are instrumented
+for i in ptest*.spin
+do
+  j=`basename $i .spin`
+  if [ -f $j.prof ]; then
+      PROFOPT="--profile-use=$j.prof"
+  else
+      PROFOPT="--profile-gen"
+  fi
+  $PROG --asm --code=hub --fcache=128 $PROFOPT --optimize 'all,!remove-unused,!remove-bss' --noheader $i
+  if  diff -ub Expect/$j.pasm $j.pasm
+  then
+      rm -f $j.pasm
+      echo $j passed
+  else
+      echo $j failed
+      endmsg="TEST FAILURES"
+  fi
+done
+
+# listings of sources with unusual encodings or line endings
+for i in lst_*.spin2
+do
+  j=`basename $i .spin2`
+  $FLEXSPIN -2 -q -l -c -o $j.binary $i
+  if  diff -ub Expect/$j.lst $j.lst
+  then
+      rm -f $j.lst $j.binary
+      echo $j passed
+  else
+      echo $j failed
+      endmsg="TEST FAILURES"
+  fi
+done
+
 # clean up
 if [ "x$endmsg" = "x$ok" ]
 then
@@ -0,0 +1,145 @@
+#!/bin/sh
+#
+# code generation benchmarks: compile each program with every backend
+# and optimization level, and record the binary size, the compile time
+# and the number of cycles the timed part of the program takes in
+# flexsim
+#
+# usage: ./bench.sh [-o results.csv] [-c baseline.csv]
+#
+# With -c the sizes and cycle counts are compared with an earlier
+# results file, so changes between two commits stand out.
+#
+
+FLEXSPIN=../../build/flexspin
+FLEXSIM=../../build/flexsim
+OUT=bench.csv
+BASE=
+
+while [ $# -gt 0 ]; do
+  case "$1" in
+    -o) OUT=$2; shift ;;
+    -c) BASE=$2; shift ;;
+    *) echo "usage: $0 [-o results.csv] [-c baseline.csv]"; exit 2 ;;
+  esac
+  shift
+done
+
+BENCHES="dhry.c fir.spin fmt.bas flt.bas gcstr.bas"
+OPTLEVELS="0 1 2"
+
+# builds that are known not to compile: the bytecode backend does not
+# handle floating point and some of the BASIC runtime
+NOCOMPILE="fmt/p1-bytecode flt/p1-bytecode gcstr/p1-bytecode"
+
+# a P1 program needs some of the 32K hub RAM for its stack and heap
+P1MAX=31744
+
+# name and flags of each backend; bytecode for the ROM interpreter
+# cannot be simulated, so only its size and compile time are known
+BACKENDS="p1-asm p2-asm p2-nu p1-bytecode"
+backend_flags() {
+  case $1 in
+    p1-asm) echo "" ;;
+    p2-asm) echo "-2" ;;
+    p2-nu) echo "-2nu" ;;
+    p1-bytecode) echo "--interp=rom" ;;
+  esac
+}
+
+# milliseconds since the epoch, or seconds * 1000 if date cannot do better
+now_ms() {
+  t=`date +%s%N`
+  case $t in
+    *N) echo `expr $t : '\([0-9]*\)'`000 ;;
+    *) echo `expr $t / 1000000` ;;
+  esac
+}
+
+# the baseline may be the file about to be overwritten
+if [ -n "$BASE" ]; then
+  cp "$BASE" $OUT.base || exit 2
+fi
+
+endmsg=ok
+echo "bench,backend,opt,size,compile_ms,cycles,status" > $OUT
+printf "%-10s %-12s %3s %8s %8s %12s  %s\n" bench backend opt size ms cycles status
+
+for src in $BENCHES
+do
+  j=`echo $src | sed 's/\.[a-z]*$//'`
+  for be in $BACKENDS
+  do
+    for o in $OPTLEVELS
+    do
+      size=-
+      cycles=-
+      rm -f $j.binary $j.out
+      t0=`now_ms`
+      $FLEXSPIN -q `backend_flags $be` -O$o -o $j.binary $src > $j.log 2>&1
+      rc=$?
+      if [ $rc = 0 ]; then
+        ms=`expr \`now_ms\` - $t0`
+        size=`wc -c < $j.binary | tr -d ' '`
+        if [ $be = p1-bytecode ]; then
+          status=nosim
+        elif [ $be = p1-asm -a $size -gt $P1MAX ]; then
+          status=toobig
+        elif $FLEXSIM -q $j.binary > $j.out 2>> $j.log; then
+          cycles=`sed -n 's/^cycles: *//p' $j.out | tr -d '\r'`
+          if grep -v '^cycles:' $j.out | diff -b Expect/$j.txt - > /dev/null; then
+            status=ok
+          else
+            status=wrong
+            endmsg="BENCHMARK FAILURES"
+          fi
+        else
+          status=simfail
+          endmsg="BENCHMARK FAILURES"
+        fi
+      elif [ $rc -gt 128 ]; then
+        ms=-
+        status=crash
+        endmsg="BENCHMARK FAILURES"
+      else
+        ms=-
+        status=nocompile
+        case " $NOCOMPILE " in
+          *" $j/$be "*) ;;
+          *) endmsg="BENCHMARK FAILURES" ;;
+        esac
+      fi
+      echo "$j,$be,$o,$size,$ms,$cycles,$status" >> $OUT
+      printf "%-10s %-12s %3s %8s %8s %12s  %s\n" $j $be -O$o $size $ms $cycles $status
+    done
+  done
+  rm -f $j.binary $j.out $j.log $j.p2asm $j.pasm
+done
+
+if [ -n "$BASE" ]; then
+  echo
+  echo "changes from $BASE:"
+  awk -F, '
+    function delta(new, old) {
+      if (new == "-" || old == "-" || old == 0 || new == old) return ""
+      return sprintf("%+.1f%%", 100.0 * (new - old) / old)
+    }
+    FNR == 1 { next }
+    NR == FNR { size[$1","$2","$3] = $4; cycles[$1","$2","$3] = $6; status[$1","$2","$3] = $7; next }
+    {
+      k = $1","$2","$3
+      if (!(k in size)) next
+      if ($7 != status[k]) {
+        printf "%-10s %-12s -O%s  %s -> %s\n", $1, $2, $3, status[k], $7
+        next
+      }
+      ds = delta($4, size[k]); dc = delta($6, cycles[k])
+      if (ds != "" || dc != "")
+        printf "%-10s %-12s -O%s  size %8s -> %-8s %8s  cycles %10s -> %-10s %8s\n", $1, $2, $3, size[k], $4, ds, cycles[k], $6, dc
+    }' $OUT.base $OUT
+  rm -f $OUT.base
+fi
+
+echo "results are in $OUT"
+echo $endmsg
+test "$endmsg" = ok
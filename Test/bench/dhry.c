@@ -0,0 +1,177 @@
+/*
+ * Dhrystone-like integer kernel: record copies, string compares,
+ * small procedure calls and array indexing
+ */
+#include <stdio.h>
+#include <string.h>
+#include <propeller.h>
+
+#define LOOPS 300
+
+typedef enum { Ident1, Ident2, Ident3, Ident4, Ident5 } Enumeration;
+
+typedef struct Record {
+    struct Record *PtrComp;
+    Enumeration    Discr;
+    Enumeration    EnumComp;
+    int            IntComp;
+    char           StringComp[31];
+} Record;
+
+static Record rec1, rec2;
+static Record *PtrGlb, *PtrGlbNext;
+static int IntGlob;
+static int BoolGlob;
+static char Char1Glob, Char2Glob;
+static int Array1Glob[50];
+static int Array2Glob[50*50];     /* [50][50], flattened */
+
+/* as in Dhrystone's NOSTRUCTASSIGN; not every backend copies structs */
+#define structassign(d, s) memcpy(&(d), &(s), sizeof(d))
+
+static int Func1(char c1, char c2)
+{
+    return (c1 != c2) ? Ident1 : Ident2;
+}
+
+static int Func2(const char *s1, const char *s2)
+{
+    int i = 1;
+    char c = 0;
+
+    while (i <= 1) {
+        if (Func1(s1[i], s2[i+1]) == Ident1) {
+            c = 'A';
+            i++;
+        }
+    }
+    if (c >= 'W' && c <= 'Z') {
+        i = 7;
+    }
+    if (c == 'X') {
+        return 1;
+    }
+    if (strcmp(s1, s2) > 0) {
+        i += 7;
+        return 1;
+    }
+    return 0;
+}
+
+static int Func3(Enumeration e)
+{
+    return e == Ident3;
+}
+
+static void Proc8(int a1[], int a2[], int i1, int i2)
+{
+    int loc = i1 + 5;
+    int idx;
+
+    a1[loc] = i2;
+    a1[loc+1] = a1[loc];
+    a1[loc+30] = loc;
+    for (idx = loc; idx <= loc+1; idx++) {
+        a2[loc*50 + idx] = loc;
+    }
+    a2[loc*50 + loc-1]++;
+    a2[(loc+20)*50 + loc] = a1[loc];
+    IntGlob = 5;
+}
+
+static void Proc7(int i1, int i2, int *out)
+{
+    *out = i2 + i1 + 2;
+}
+
+static void Proc6(Enumeration e, Enumeration *out)
+{
+    *out = e;
+    if (!Func3(e)) {
+        *out = Ident4;
+    }
+    switch (e) {
+    case Ident1: *out = Ident1; break;
+    case Ident2: *out = (IntGlob > 100) ? Ident1 : Ident4; break;
+    case Ident3: *out = Ident2; break;
+    case Ident5: *out = Ident3; break;
+    default: break;
+    }
+}
+
+static void Proc3(Record **p)
+{
+    if (PtrGlb) {
+        *p = PtrGlb->PtrComp;
+    } else {
+        IntGlob = 100;
+    }
+    Proc7(10, IntGlob, &PtrGlb->IntComp);
+}
+
+static void Proc1(Record *p)
+{
+    Record *next = p->PtrComp;
+
+    structassign(*next, *PtrGlb);
+    p->IntComp = 5;
+    next->IntComp = p->IntComp;
+    next->PtrComp = p->PtrComp;
+    Proc3(&next->PtrComp);
+    if (next->Discr == Ident1) {
+        next->IntComp = 6;
+        Proc6(p->EnumComp, &next->EnumComp);
+        next->PtrComp = PtrGlb->PtrComp;
+        Proc7(next->IntComp, 10, &next->IntComp);
+    } else {
+        structassign(*p, *next);
+    }
+}
+
+int main()
+{
+    int run, i1, i2, i3, sum;
+    char s1[31], s2[31];
+    Enumeration e;
+    unsigned start, elapsed;
+
+    PtrGlbNext = &rec2;
+    PtrGlb = &rec1;
+    PtrGlb->PtrComp = PtrGlbNext;
+    PtrGlb->Discr = Ident1;
+    PtrGlb->EnumComp = Ident3;
+    PtrGlb->IntComp = 40;
+    strcpy(PtrGlb->StringComp, "DHRYSTONE PROGRAM, SOME STRING");
+    strcpy(s1, "DHRYSTONE PROGRAM, 1'ST STRING");
+    Array2Glob[8*50 + 7] = 10;
+
+    start = getcnt();
+    for (run = 1; run <= LOOPS; run++) {
+        Char1Glob = 'A';
+        Char2Glob = 'B';
+        i1 = 2;
+        i2 = 3;
+        strcpy(s2, "DHRYSTONE PROGRAM, 2'ND STRING");
+        e = Ident2;
+        BoolGlob = !Func2(s1, s2);
+        while (i1 < i2) {
+            i3 = 5 * i1 - i2;
+            Proc7(i1, i2, &i3);
+            i1++;
+        }
+        Proc8(Array1Glob, Array2Glob, i1, i3);
+        Proc1(PtrGlb);
+        if (Func1(Char1Glob, 'C') == Ident1) {
+            Proc6(Ident1, &e);
+        }
+        i2 = i2 * i1;
+        i1 = i2 / i3;
+        i2 = 7 * (i2 - i3) - i1;
+    }
+    elapsed = getcnt() - start;
+
+    sum = IntGlob + BoolGlob + i1 + i2 + i3 + e + Array2Glob[8*50 + 7] + rec1.IntComp + rec2.IntComp;
+    printf("dhry: %d\n", sum);
+    printf("cycles: %u\n", elapsed);
+    return 0;
+}
@@ -0,0 +1,59 @@
+'
+' floating point through the sys/float.spin routines: Newton square
+' roots, a polynomial, and a small Mandelbrot iteration
+'
+const MAXITER = 24
+
+function sqrtn(x as single) as single
+  dim r as single
+  dim k as integer
+  r = x
+  for k = 1 to 6
+    r = (r + x / r) * 0.5
+  next k
+  return r
+end function
+
+' 1 + x + x^2/2 + x^3/6 + x^4/24
+function poly(x as single) as single
+  return (((x / 24.0 + (1.0 / 6.0)) * x + 0.5) * x + 1.0) * x + 1.0
+end function
+
+function mandel() as integer
+  dim as single cr, ci, zr, zi, t
+  dim as integer px, py, n, total
+  total = 0
+  for py = 0 to 5
+    ci = py * 0.4 - 1.0
+    for px = 0 to 7
+      cr = px * 0.35 - 2.0
+      zr = 0.0
+      zi = 0.0
+      n = 0
+      while n < MAXITER andalso zr * zr + zi * zi < 4.0
+        t = zr * zr - zi * zi + cr
+        zi = 2.0 * zr * zi + ci
+        zr = t
+        n = n + 1
+      end while
+      total = total + n
+    next px
+  next py
+  return total
+end function
+
+dim as uinteger t0, elapsed
+dim as integer i, m
+dim as single x, sum
+
+t0 = getcnt()
+sum = 0.0
+for i = 1 to 20
+  x = i * 0.75
+  sum = sum + sqrtn(x) + poly(x / 16.0)
+next i
+m = mandel()
+elapsed = getcnt() - t0
+
+print "flt: "; int(sum * 1000.0); " "; m
+print "cycles: "; elapsed
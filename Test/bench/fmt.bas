@@ -0,0 +1,34 @@
+'
+' number and string formatting through the library's printf core
+' (libsys/fmt.c); output goes to a device that just checksums it, so
+' the serial port speed does not matter
+'
+' C's sprintf would need varargs, which the bytecode and nucode
+' backends do not support, so this is written with BASIC's print
+'
+const LOOPS = 40
+
+dim shared as uinteger sum, count
+
+sub sink(c as integer)
+  sum = sum * 31 + c
+  count = count + 1
+end sub
+
+dim as uinteger t0, elapsed
+dim as integer i
+dim names(3) as string
+
+names(0) = "alpha" : names(1) = "beta" : names(2) = "gamma" : names(3) = "delta"
+
+open SendRecvDevice(@sink, nil, nil) as #2
+t0 = getcnt()
+for i = 0 to LOOPS-1
+  print #2, i * 997 - 20000; ":"; names(i and 3); ":"; hex$(i * &h1234567, 8); ":"; bin$(i, 6); " ";
+  print #2, using "###.##|+####|"; i * 3.25; i * 31 - 600
+next i
+elapsed = getcnt() - t0
+close #2
+
+print "fmt: "; sum; " "; count
+print "cycles: "; elapsed
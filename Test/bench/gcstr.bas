@@ -0,0 +1,26 @@
+'
+' garbage collected BASIC strings: concatenation, left$/right$/mid$
+' and number conversion, enough to make the collector run
+'
+const HEAPSIZE = 4096
+const LOOPS = 60
+
+dim as uinteger t0, elapsed
+dim as string s, w
+dim as integer i, sum
+
+t0 = getcnt()
+sum = 0
+for i = 1 to LOOPS
+  s = "item" + str$(i)
+  w = left$(s + "-----", 6) + right$(s, 2) + mid$("abcdefghij", (i mod 7) + 1, 3)
+  if len(w) > 8 then
+    w = w + chr$(65 + (i mod 26))
+  end if
+  sum = sum * 7 + len(w) + asc(right$(w, 1))
+next i
+elapsed = getcnt() - t0
+
+print w
+print "gcstr: "; sum
+print "cycles: "; elapsed
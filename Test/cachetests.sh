@@ -0,0 +1,120 @@
+#!/bin/sh
+#
+# check the parse cache (--cache-dir): a cached compile must give the
+# same binary as an ordinary one, and changes to the source, to an
+# included file, to the defines, to the options or to the compiler
+# itself must make the cache miss
+#
+
+if [ "$1" != "" ]; then
+    PROG=$1
+else
+    PROG=../build/flexspin
+fi
+case $PROG in
+    /*) ;;
+    *) PROG=`pwd`/$PROG ;;
+esac
+
+ok="ok"
+endmsg=$ok
+
+# everything happens in a scratch directory, since we edit the sources
+WORK=cachetest.tmp
+rm -rf $WORK
+mkdir $WORK
+cp cache01.spin cache01.inc $WORK
+cd $WORK
+
+# check name expected-stats [options]
+# compiles cache01.spin with and without the cache and compares them;
+# expected-stats is the "Parse cache:" line the cached compile prints
+FLEX=$PROG
+check() {
+  j=$1
+  expect=$2
+  shift 2
+  rm -f ref.binary $j.binary
+  $FLEX -q "$@" -o ref.binary cache01.spin
+  $FLEX --verbose --cache-dir=cache "$@" -o $j.binary cache01.spin > $j.log 2>&1
+  stats=`grep "Parse cache:" $j.log`
+  if [ "$stats" != "Parse cache: $expect" ]; then
+      echo "$j failed: expected Parse cache: $expect, got $stats"
+      endmsg="TEST FAILURES"
+  elif cmp -s ref.binary $j.binary; then
+      echo $j passed
+  else
+      echo "$j failed: cached binary differs"
+      endmsg="TEST FAILURES"
+  fi
+}
+
+# syscheck name used|saved
+# checks whether the compile logged in name.log took the system module
+# from the cache or parsed and saved it
+syscheck() {
+  if grep -q "$2.* parse of _system_" $1.log; then
+      echo $1_system passed
+  else
+      echo "$1_system failed: system module was not $2"
+      endmsg="TEST FAILURES"
+  fi
+}
+
+check cache_first "0 hits, 2 misses" -2
+check cache_again "2 hits, 0 misses" -2
+check cache_define "1 hit, 1 miss" -2 -DBIG
+check cache_define2 "2 hits, 0 misses" -2 -DBIG
+sed -e 's/SCALE = 3/SCALE = 5/' cache01.inc > tmp.inc && mv tmp.inc cache01.inc
+check cache_include "1 hit, 1 miss" -2
+check cache_include2 "2 hits, 0 misses" -2
+if cmp -s cache_first.binary cache_include.binary; then
+    echo "cache_include failed: binary did not change"
+    endmsg="TEST FAILURES"
+fi
+
+# the system module is cached separately for P1 and P2 and for
+# options that change the parse
+syscheck cache_first saved
+syscheck cache_again using
+check cache_p1 "0 hits, 2 misses"
+syscheck cache_p1 saved
+check cache_p1again "2 hits, 0 misses"
+syscheck cache_p1again using
+check cache_fixed "0 hits, 2 misses" -2 --fixedreal
+syscheck cache_fixed saved
+check cache_fixed2 "2 hits, 0 misses" -2 --fixedreal
+check cache_again2 "2 hits, 0 misses" -2
+
+# a different compiler invalidates everything
+mkdir bin
+cp $PROG bin/flexspin
+touch -t 200101010000 bin/flexspin
+FLEX=`pwd`/bin/flexspin
+check cache_stamp "0 hits, 2 misses" -2
+check cache_stamp2 "2 hits, 0 misses" -2
+
+# so does a change to the built in system code, even if the compiler
+# looks the same from the outside
+LC_ALL=C sed -e 's/P2 specific system calls/P2 specific system CALLS/' $PROG > bin/flexspin
+touch -t 200101010000 bin/flexspin
+check cache_syscode "1 hit, 1 miss" -2
+syscheck cache_syscode saved
+FLEX=$PROG
+
+# the cache directory is kept below FLEXSPIN_CACHE_SIZE kilobytes
+FLEXSPIN_CACHE_SIZE=50 $PROG -q --cache-dir=cache -2 -DBIG -DPRUNE -o prune.binary cache01.spin
+size=`cat cache/*.flexcache 2>/dev/null | wc -c`
+if [ $size -le 51200 ]; then
+    echo cache_prune passed
+else
+    echo "cache_prune failed: cache holds $size bytes"
+    endmsg="TEST FAILURES"
+fi
+
+cd ..
+if [ "$endmsg" = "$ok" ]; then
+    rm -rf $WORK
+fi
+echo $endmsg
+test "$endmsg" = "$ok"
@@ -0,0 +1,14 @@
+#define __SPIN2CPP__
+#include <propeller.h>
+#include "error01.h"
+
+int32_t error01::main(void)
+{
+  return (foo(), 0);
+}
+
+void error01::foo(void)
+{
+   = 1;
+}
+
@@ -0,0 +1,13 @@
+#ifndef error01_Class_Defined__
+#define error01_Class_Defined__
+
+#include <stdint.h>
+
+class error01 {
+public:
+  int32_t 	main(void);
+private:
+  void 	foo(void);
+};
+
+#endif
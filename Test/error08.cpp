@@ -0,0 +1,13 @@
+#define __SPIN2CPP__
+#include <propeller.h>
+#include "error08.h"
+
+void error08::count(int32_t n)
+{
+  int32_t 	i, _limit__0000, _step__0001;
+  for(( ( ( (i = 0), (_limit__0000 = n - 1) ), (_step__0001 = ((_limit__0000 >= 0) ? 1 : -1)) ), (_limit__0000 = _limit__0000 + _step__0001) ); i != _limit__0000; i = i + _step__0001) {
+     = a + 1;
+    a ^= _INA;
+  }
+}
+
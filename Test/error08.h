@@ -0,0 +1,12 @@
+#ifndef error08_Class_Defined__
+#define error08_Class_Defined__
+
+#include <stdint.h>
+
+class error08 {
+public:
+  void 	count(int32_t n);
+private:
+};
+
+#endif
@@ -0,0 +1,10 @@
+//
+// check for instructions that should set flags not doing so
+//
+#define __SPIN2CPP__
+#include <propeller.h>
+#include "error11.h"
+
+char error11::dat[] = {
+  0x00, 0xe0, 0x7f, 0x84, 0x00, 0x00, 0x68, 0x5c, 0x01, 0xe2, 0x7f, 0x86, 0x00, 0x00, 0x68, 0x5c, 
+};
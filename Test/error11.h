@@ -0,0 +1,12 @@
+#ifndef error11_Class_Defined__
+#define error11_Class_Defined__
+
+#include <stdint.h>
+
+class error11 {
+public:
+  static char dat[];
+private:
+};
+
+#endif
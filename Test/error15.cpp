@@ -0,0 +1,13 @@
+#define __SPIN2CPP__
+#include <propeller.h>
+#include "error15.h"
+
+char error15::dat[] = {
+  0x0a, 0x16, 0xfc, 0x5c, 0x0a, 0x16, 0xfc, 0x5c, 0x09, 0x00, 0x3c, 0x5c, 0x01, 0x12, 0x7c, 0x60, 
+  0x09, 0x14, 0xfc, 0x5c, 0x0a, 0x00, 0x3c, 0x5c, 0x0a, 0x00, 0x7c, 0x5c, 0x0b, 0x00, 0x3c, 0x5c, 
+  0x0a, 0x00, 0xbc, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x68, 0x00, 0x00, 0x7c, 0x5c, 
+};
+void error15::dummy(void)
+{
+}
+
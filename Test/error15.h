@@ -0,0 +1,13 @@
+#ifndef error15_Class_Defined__
+#define error15_Class_Defined__
+
+#include <stdint.h>
+
+class error15 {
+public:
+  static char dat[];
+  static void 	dummy(void);
+private:
+};
+
+#endif
@@ -0,0 +1,22 @@
+#define __SPIN2CPP__
+#include <propeller.h>
+#include "error18.h"
+
+char error18::dat[] = {
+  0x00, 0x00, 0x00, 0x00, 
+};
+void error18::main(void)
+{
+  _OUTA = (int32_t)(((void *)&dat[4]));
+}
+
+void error18::demo1(void)
+{
+  ((void *)&dat[4])[0] = _INA;
+}
+
+void error18::demo2(void)
+{
+  _OUTA = ((void *)&dat[4])[0];
+}
+
@@ -0,0 +1,15 @@
+#ifndef error18_Class_Defined__
+#define error18_Class_Defined__
+
+#include <stdint.h>
+
+class error18 {
+public:
+  static char dat[];
+  static void 	main(void);
+  static void 	demo1(void);
+  static void 	demo2(void);
+private:
+};
+
+#endif
@@ -0,0 +1,2 @@
+int buf[100];
+int after[4];
@@ -0,0 +1,21 @@
+//
+// link test: objects defining only uninitialized globals must
+// not be left out of the link
+//
+#include <stdio.h>
+
+extern int buf[];
+extern int table[];
+int sumtable(int n);
+
+int main()
+{
+    int i;
+
+    for (i = 0; i < 100; i++) {
+        buf[i] = i;
+    }
+    printf("%d %d %d\n", buf[0], buf[50], buf[99]);
+    printf("%d %d\n", table[2], sumtable(4));
+    return 0;
+}
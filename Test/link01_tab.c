@@ -0,0 +1,10 @@
+int table[4] = { 1, 2, 3, 4 };
+
+int sumtable(int n)
+{
+    int i, sum = 0;
+    for (i = 0; i < n; i++) {
+        sum += table[i];
+    }
+    return sum;
+}
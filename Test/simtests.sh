@@ -0,0 +1,95 @@
+#!/bin/sh
+#
+# run the execution tests in the flexsim simulator, so they can be
+# checked without a Propeller attached
+#
+
+if [ "$1" != "" ]; then
+    FLEXSPIN=$1
+else
+    FLEXSPIN=../build/flexspin
+fi
+FLEXCC=../build/flexcc
+FLEXSIM="../build/flexsim -q"
+
+ok="ok"
+endmsg=$ok
+
+# these take too long to simulate for routine testing
+SLOW="basexec05 exec13"
+
+runtest() {
+  j=$1
+  src=$2
+  shift 2
+  case " $SLOW " in
+    *" $j "*) return ;;
+  esac
+  rm -f $j.txt
+  if $FLEXSPIN "$@" -I../Lib -o $j.binary $src; then
+    $FLEXSIM $j.binary > $j.txt
+  fi
+  if diff -ub Expect/$j.txt $j.txt
+  then
+    echo $j passed for $PROC
+    rm -f $j.txt $j.binary $j.p2asm $j.pasm
+  else
+    echo $j failed for $PROC
+    endmsg="TEST FAILURES"
+  fi
+}
+
+for PROC in P2 P1
+do
+  if [ $PROC = P2 ]; then
+    OPTS="-2 -O2 -g -q"
+  else
+    OPTS="-g -q"
+  fi
+  for i in basexec*.bas
+  do
+    runtest `basename $i .bas` $i $OPTS
+  done
+  for i in cexec*.c
+  do
+    runtest `basename $i .c` $i $OPTS
+  done
+  for i in exec*.spin
+  do
+    runtest `basename $i .spin` $i $OPTS
+  done
+
+  # separately compiled objects, linked with flexcc
+  if [ $PROC = P2 ]; then
+    CCOPTS="-2 -O1"
+  else
+    CCOPTS="-O1"
+  fi
+  for i in link*_main.c
+  do
+    j=`basename $i _main.c`
+    objs=
+    for c in ${j}_*.c
+    do
+      $FLEXCC $CCOPTS -c -o `basename $c .c`.o $c
+      objs="$objs `basename $c .c`.o"
+    done
+    rm -f $j.txt
+    if $FLEXCC $CCOPTS -o $j.binary $objs; then
+      $FLEXSIM $j.binary > $j.txt
+    fi
+    if diff -ub Expect/$j.txt $j.txt
+    then
+      echo $j passed for $PROC
+      rm -f $j.txt $j.binary $j.p2asm $j.pasm $objs
+    else
+      echo $j failed for $PROC
+      endmsg="TEST FAILURES"
+    fi
+  done
+done
+
+# clean up
+rm -f FullDuplexSerial.cpp FullDuplexSerial.h
+echo $endmsg
+test "$endmsg" = "$ok"
@@ -0,0 +1,14 @@
+#ifndef subtest113_Class_Defined__
+#define subtest113_Class_Defined__
+
+#include <stdint.h>
+
+class subtest113 {
+public:
+  static const int A = 25;
+  static const int B = (A / 5);
+  static int32_t 	Get(void);
+private:
+};
+
+#endif
@@ -0,0 +1,9 @@
+#define __SPIN2CPP__
+#include <propeller.h>
+#include "test001.h"
+
+int32_t test001::Start(void)
+{
+  return 1;
+}
+
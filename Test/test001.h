@@ -0,0 +1,14 @@
+#ifndef test001_Class_Defined__
+#define test001_Class_Defined__
+
+#include <stdint.h>
+
+class test001 {
+public:
+  static const int X = 1;
+  static const int Y = 2;
+  static int32_t 	Start(void);
+private:
+};
+
+#endif
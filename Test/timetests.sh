@@ -0,0 +1,50 @@
+#!/bin/sh
+#
+# smoke test for --time-report: the compile must still work, the
+# summary must list the main phases, and the trace must be valid JSON
+#
+
+if [ "$1" != "" ]; then
+    PROG=$1
+else
+    PROG=../build/flexspin
+fi
+
+ok="ok"
+endmsg=$ok
+
+rm -f timetest.binary timetest.json timetest.log
+if $PROG -2 -q -I../Lib --time-report=timetest.json -o timetest.binary exec12.spin > timetest.log 2>&1; then
+    echo timereport_exit passed
+else
+    echo "timereport_exit failed: compile failed"
+    endmsg="TEST FAILURES"
+fi
+
+for phase in preprocess parse DeclareFunctions CompileToIR OptimizeIRLocal assemble
+do
+  if grep -q "^  $phase  " timetest.log; then
+      echo timereport_$phase passed
+  else
+      echo "timereport_$phase failed: no $phase in the summary"
+      endmsg="TEST FAILURES"
+  fi
+done
+
+# check the trace with whatever JSON parser we can find
+if python3 -c "import json,sys; json.load(open(sys.argv[1]))" timetest.json 2>/dev/null; then
+    echo timereport_json passed
+elif jq empty timetest.json 2>/dev/null; then
+    echo timereport_json passed
+elif command -v python3 > /dev/null || command -v jq > /dev/null; then
+    echo "timereport_json failed: timetest.json is not valid JSON"
+    endmsg="TEST FAILURES"
+else
+    echo "timereport_json skipped: no JSON parser available"
+fi
+
+if [ "$endmsg" = "$ok" ]; then
+    rm -f timetest.binary timetest.json timetest.log timetest.p2asm
+fi
+echo $endmsg
+test "$endmsg" = "$ok"
@@ -0,0 +1,8 @@
+#define __SPIN2CPP__
+#include <propeller.h>
+#include "userdef.h"
+
+void userdef::Start(void)
+{
+}
+
@@ -9,16 +9,20 @@
 static LexStream *s_reportas_lexdata;
 static int s_reportas_lineidx;
 
+/*
+ * AST nodes and source line text are never freed individually, and
+ * almost all of them are needed until the compiler exits, so they
+ * are carved out of arenas instead of being malloc'd one at a time
+ */
+static Arena astArena;
+static Arena lineArena;
+
 AST *
 NewAST(enum astkind kind, AST *left, AST *right)
 {
     AST *ast;
 
-    ast = (AST *)malloc(sizeof(*ast));
-    if (!ast) {
-        fprintf(stderr, "FATAL ERROR: out of memory\n");
-        abort();
-    }
+    ast = (AST *)arena_alloc(&astArena, sizeof(*ast));
     ast->kind = kind;
     ast->left = left;
     ast->right = right;
@@ -115,6 +119,27 @@ ListInsertBefore(AST *list, AST *member, AST *newelem)
     return orig;
 }
 
+/*
+ * allocate room for len bytes of source text; it lives as long as
+ * the syntax trees which refer to it
+ */
+char *
+NewLineData(size_t len)
+{
+    return (char *)arena_alloc(&lineArena, len);
+}
+
+/*
+ * report how much memory the arenas are using (with --verbose)
+ */
+void
+ReportASTMemory(const char *phase)
+{
+    DEBUG(NULL, "memory after %s: %lu bytes in %lu AST nodes, %lu bytes of source lines, %lu bytes reserved",
+          phase, (unsigned long)astArena.used, (unsigned long)(astArena.used / sizeof(AST)),
+          (unsigned long)lineArena.used, (unsigned long)(astArena.reserved + lineArena.reserved));
+}
+
 /*
  * duplicate an AST
  */
@@ -237,6 +262,9 @@ doAstMatch(AST *a, AST *b, int ignoreStatic)
     case AST_STRING:
         return strcmp(a->d.string, b->d.string) == 0;
     case AST_IDENTIFIER:
+        if (a->d.string == b->d.string) {
+            return 1; /* interned names */
+        }
         if ( (curfunc && LangCaseSensitive(curfunc->language))
              || (current && LangCaseSensitive(current->curLanguage)) )
         {
@@ -359,7 +387,7 @@ AST *
 AstIdentifier(const char *name)
 {
     AST *ast = NewAST(AST_IDENTIFIER, NULL, NULL);
-    ast->d.string = name;
+    ast->d.string = InternString(name);
     return ast;
 }
 /* create a string literal */
@@ -1,6 +1,7 @@
 #ifndef SPIN_AST_H
 #define SPIN_AST_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 typedef struct LineInfo {
@@ -235,13 +236,11 @@ typedef struct lexstream LexStream;
 
 struct AST {
     enum astkind kind;        /* type of this node */
+    int lineidx;        /* debug info: index within the lexer LineInfo struct */
     union ASTdata d; /* data in this node */
     AST *left;
     AST *right;
-
-    // debug info
-    LexStream *lexdata; /* points to the current lexer */
-    int lineidx;        /* index within the lexer LineInfo struct */
+    LexStream *lexdata; /* debug info: points to the current lexer */
 };
 
 typedef struct ASTReportInfo {
@@ -251,6 +250,8 @@ typedef struct ASTReportInfo {
 
 /* function declarations */
 AST *NewAST(enum astkind kind, AST *left, AST *right);
+char *NewLineData(size_t len);
+void ReportASTMemory(const char *phase);
 AST *AddToList(AST *list, AST *newelement);
 AST *AddToLeftList(AST *list, AST *newelement);
 AST *AddToListEx(AST *list, AST *newelement, AST **tail);
@@ -29,6 +29,7 @@
 #include "becommon.h"
 #include "outasm.h"
 #include <ctype.h>
+#include <stdlib.h>
 
 // used for converting Spin relative addresses to absolute addresses
 // (only needed for OUTPUT_COGSPIN)
@@ -102,6 +103,13 @@ static const char *RemappedName(const char *name)
     return buf;
 }
 
+// the name a label is given in the assembly output
+const char *
+AsmLabelName(const char *name)
+{
+    return strdup(RemappedName(name));
+}
+
 // helper function for printing operands
 static void
 doPrintOperand(struct flexbuf *fb, Operand *reg, int useimm, enum OperandEffect effect)
@@ -342,67 +350,64 @@ PrintOperandAsValue(struct flexbuf *fb, Operand *reg)
     }
 }
 
-static void
-PrintCond(struct flexbuf *fb, IRCond cond)
+// name of the condition prefix for "cond" ("" if none is needed)
+static const char *
+CondName(IRCond cond)
 {
     switch (cond) {
     case COND_TRUE:
-      break;
+        return "";
     case COND_EQ:
-      flexbuf_addstr(fb, " if_e");
-      break;
+        return "if_e";
     case COND_NE:
-      flexbuf_addstr(fb, " if_ne");
-      break;
+        return "if_ne";
     case COND_LT:
-      flexbuf_addstr(fb, " if_b");
-      break;
+        return "if_b";
     case COND_GE:
-      flexbuf_addstr(fb, " if_ae");
-      break;
+        return "if_ae";
     case COND_GT:
-      flexbuf_addstr(fb, " if_a");
-      break;
+        return "if_a";
     case COND_LE:
-      flexbuf_addstr(fb, " if_be");
-      break;
+        return "if_be";
     // case COND_C:
-    //   flexbuf_addstr(fb, " if_c");
-    //   break;
+    //   return "if_c";
     // case COND_NC:
-    //   flexbuf_addstr(fb, " if_nc");
-    //   break;
+    //   return "if_nc";
     // case COND_NC_AND_NZ:
-    //   flexbuf_addstr(fb, " if_nc_and_nz");
-    //   break;
+    //   return "if_nc_and_nz";
     case COND_NC_AND_Z:
-      flexbuf_addstr(fb, " if_nc_and_z");
-      break;        
+        return "if_nc_and_z";
     case COND_C_AND_NZ:
-      flexbuf_addstr(fb, " if_c_and_nz");
-      break;
+        return "if_c_and_nz";
     case COND_C_AND_Z:
-      flexbuf_addstr(fb, " if_nc_and_z");
-      break;        
+        return "if_nc_and_z";
     case COND_C_OR_NZ:
-      flexbuf_addstr(fb, " if_c_or_nz");
-      break;        
+        return "if_c_or_nz";
     case COND_NC_OR_NZ:
-      flexbuf_addstr(fb, " if_nc_or_nz");
-      break;        
+        return "if_nc_or_nz";
     case COND_NC_OR_Z:
-      flexbuf_addstr(fb, " if_nc_or_z");
-      break;        
+        return "if_nc_or_z";
     case COND_C_EQ_Z:
-      flexbuf_addstr(fb, " if_c_eq_z");
-      break;
+        return "if_c_eq_z";
     case COND_C_NE_Z:
-      flexbuf_addstr(fb, " if_c_ne_z");
-      break;
+        return "if_c_ne_z";
     default:
-      ERROR(NULL, "Internal error, unexpected condition");
-      flexbuf_addstr(fb, " if_??");
-      break;
+        return NULL;
+    }
+}
+
+static void
+PrintCond(struct flexbuf *fb, IRCond cond)
+{
+    const char *name = CondName(cond);
+
+    if (!name) {
+        ERROR(NULL, "Internal error, unexpected condition");
+        name = "if_??";
+    }
+    if (*name) {
+        flexbuf_addchar(fb, ' ');
+        flexbuf_addstr(fb, name);
     }
     flexbuf_addchar(fb, '\t');
 }
@@ -854,14 +859,16 @@ PrintCompressCondJump(struct flexbuf *fb, int cond, Operand *dst)
 /* convert IR list into assembly language */
 static int didPub = 0;
 
-void
-DoAssembleIR(struct flexbuf *fb, IR *ir, Module *P)
+// print any section change needed before "ir"
+// returns 1 if nothing more needs to be printed for it
+static int
+DoAssembleSection(struct flexbuf *fb, IR *ir, Module *P)
 {
     const char *str;
     if (ir->opc == OPC_COMMENT) {
         if (ir->dst->kind != IMM_STRING) {
             ERROR(NULL, "COMMENT is not a string");
-            return;
+            return 1;
         }
         flexbuf_addstr(fb, "' ");
         str = ir->dst->name;
@@ -870,15 +877,15 @@ DoAssembleIR(struct flexbuf *fb, IR *ir, Module *P)
             str++;
         }
         flexbuf_addchar(fb, '\n');
-        return;
+        return 1;
     }
     if (ir->opc == OPC_DUMMY) {
-        return;
+        return 1;
     }
     if (ir->opc == OPC_REPEAT_END) {
         // not an actual instruction, just a marker for
         // avoiding moving instructions
-        return;
+        return 1;
     }
     if (ir->opc == OPC_CONST) {
         // handle const declaration
@@ -892,7 +899,7 @@ DoAssembleIR(struct flexbuf *fb, IR *ir, Module *P)
         flexbuf_addstr(fb, " = ");
         PrintOperandAsValue(fb, ir->src);
         flexbuf_addstr(fb, "\n");
-        return;
+        return 1;
     }
     if (!inDat && P) {
         if (!didPub && P) {
@@ -924,6 +931,14 @@ DoAssembleIR(struct flexbuf *fb, IR *ir, Module *P)
             didOrg = 1;
         }
     }
+    return 0;
+}
+
+// print the special forms of branches (LMM jumps and such)
+// returns 1 if "ir" was printed
+static int
+DoAssembleBranch(struct flexbuf *fb, IR *ir)
+{
     if (gl_p2) {
         // check for fcache stuff
         if (ir->fcache) {
@@ -948,12 +963,12 @@ DoAssembleIR(struct flexbuf *fb, IR *ir, Module *P)
                 flexbuf_addstr(fb, "call\t");
                 PrintOperandSrc(fb, ir->dst, ir->dsteffect);
                 flexbuf_addstr(fb, "\n");
-                return;
+                return 1;
             }
             if (ir->opc == OPC_RET) {
                 PrintCond(fb, ir->cond);
                 flexbuf_addstr(fb, "ret\n");
-                return;
+                return 1;
             }
         }
         // watch out for djnz going out of range
@@ -971,7 +986,7 @@ DoAssembleIR(struct flexbuf *fb, IR *ir, Module *P)
                     flexbuf_printf(fb, "\tjmp\t");
                     PrintOperandSrc(fb, ir->src, ir->srceffect);
                     flexbuf_printf(fb, "\ntmp_djnz_%03u\n", djzlab);
-                    return;
+                    return 1;
                 }
             }
         }
@@ -1021,7 +1036,7 @@ DoAssembleIR(struct flexbuf *fb, IR *ir, Module *P)
                         flexbuf_addstr(fb, "\n");
                     }
                 }
-                return;
+                return 1;
             } else if (IsLocalOrArg(ir->dst)) {
                 if (lmmMode) {
                     PrintCond(fb, ir->cond);
@@ -1030,7 +1045,7 @@ DoAssembleIR(struct flexbuf *fb, IR *ir, Module *P)
                     flexbuf_addstr(fb, "\n");
                     PrintCond(fb, ir->cond);
                     flexbuf_addstr(fb, "call\t#LMM_CALL_PTR\n");
-                    return;
+                    return 1;
                 } else if (!gl_p2) {
                     WARNING(NULL, "indirect function calls are not supported in COG mode");
                 }
@@ -1046,7 +1061,7 @@ DoAssembleIR(struct flexbuf *fb, IR *ir, Module *P)
                 flexbuf_addstr(fb, " - ");
                 PrintOperand(fb, ir->fcache);
                 flexbuf_addstr(fb, ")\n");
-                return;
+                return 1;
             } else if (IsHubDest(ir->src)) {
                 /* we're going to issue a sub x, #1 and then if_nz jmp
                    if there's already a condition, we need the new
@@ -1070,7 +1085,7 @@ DoAssembleIR(struct flexbuf *fb, IR *ir, Module *P)
                     PrintOperand(fb, ir->dst);
                     flexbuf_addstr(fb,", #1 wz\n");
                     PrintCompressCondJump(fb, jmp_cond, ir->src);
-                    return;
+                    return 1;
                 } else if (gl_lmm_kind != LMM_KIND_ORIG) {
                     PrintCond(fb, ir->cond);
                     flexbuf_addstr(fb, "sub\t");
@@ -1090,7 +1105,7 @@ DoAssembleIR(struct flexbuf *fb, IR *ir, Module *P)
                 }
                 PrintOperandAsValue(fb, ir->src);
                 flexbuf_addstr(fb, "\n");
-                return;
+                return 1;
             }
             break;
         case OPC_JUMP:
@@ -1101,7 +1116,7 @@ DoAssembleIR(struct flexbuf *fb, IR *ir, Module *P)
                 flexbuf_addstr(fb, " - ");
                 PrintOperand(fb, ir->fcache);
                 flexbuf_addstr(fb, ")\n");
-                return;
+                return 1;
             } else if (IsLocalOrArg(ir->dst) && lmmMode) {
                 if (lmmMode) {
                     PrintCond(fb, ir->cond);
@@ -1110,7 +1125,7 @@ DoAssembleIR(struct flexbuf *fb, IR *ir, Module *P)
                     flexbuf_addstr(fb, "\n");
                     PrintCond(fb, ir->cond);
                     flexbuf_addstr(fb, "call\t#LMM_JUMP_PTR\n");
-                    return;
+                    return 1;
                 } else if (!gl_p2) {
                     WARNING(NULL, "indirect function calls are not supported in COG mode");
                 }
@@ -1124,7 +1139,7 @@ DoAssembleIR(struct flexbuf *fb, IR *ir, Module *P)
                 }
                 if (gl_lmm_kind == LMM_KIND_COMPRESS) {
                     PrintCompressCondJump(fb, ir->cond, ir->dst);
-                    return;
+                    return 1;
                 }                    
                 PrintCond(fb, ir->cond);
                 // if we know the destination we may be able to optimize
@@ -1137,13 +1152,13 @@ DoAssembleIR(struct flexbuf *fb, IR *ir, Module *P)
                         flexbuf_printf(fb, "add\tpc, #4*(");
                         PrintOperand(fb, ir->dst);
                         flexbuf_printf(fb, " - ($+1))\n");
-                        return;
+                        return 1;
                     }
                     if ( offset < 0 && offset > -MAX_REL_JUMP_OFFSET) {
                         flexbuf_printf(fb, "sub\tpc, #4*(($+1) - ");
                         PrintOperand(fb, ir->dst);
                         flexbuf_printf(fb, ")\n");
-                        return;
+                        return 1;
                     }
                 }
                 if ((ir->flags & FLAG_JMPTABLE_INSTR)) {
@@ -1159,119 +1174,125 @@ DoAssembleIR(struct flexbuf *fb, IR *ir, Module *P)
                     PrintOperandAsValue(fb, ir->dst);
                 }
                 flexbuf_addstr(fb, "\n");
-                return;
+                return 1;
             }
             break;
         case OPC_RET:
             if (ir->fcache) {
                 ERROR(NULL, "return from fcached code not supported");
-                return;
+                return 1;
             } else if (lmmMode) {
                 if (gl_lmm_kind == LMM_KIND_COMPRESS) {
                     if (ir->cond != COND_TRUE) {
                         ERROR(NULL, "conditional return in compressed code");
                     }
                     PrintCompressLocalCall(fb, "LMM_RET");
-                    return;
+                    return 1;
                 }
                 PrintCond(fb, ir->cond);
                 flexbuf_addstr(fb, "call\t#LMM_RET\n");
-                return;
+                return 1;
             }
         default:
             break;
         }
     }
+    return 0;
+}
 
-    if (ir->instr) {
-        int ccset;
+static void
+DoAssembleInstr(struct flexbuf *fb, IR *ir)
+{
+    int ccset;
 
-        if (ir->cond == COND_FALSE) {
-            flexbuf_addstr(fb, "\tnop\n");
-            return;
-        }
-        if (lmmMode && gl_lmm_kind == LMM_KIND_COMPRESS) {
-            if (ir->cond == COND_TRUE) {
-                flexbuf_addstr(fb, "\t<");
-            } else {
-                flexbuf_addstr(fb, "\tbyte $D0\n");
-                PrintCond(fb, ir->cond);
-            }
+    if (ir->cond == COND_FALSE) {
+        flexbuf_addstr(fb, "\tnop\n");
+        return;
+    }
+    if (lmmMode && gl_lmm_kind == LMM_KIND_COMPRESS) {
+        if (ir->cond == COND_TRUE) {
+            flexbuf_addstr(fb, "\t<");
         } else {
+            flexbuf_addstr(fb, "\tbyte $D0\n");
             PrintCond(fb, ir->cond);
         }
-        flexbuf_addstr(fb, ir->instr->name);
-        switch (ir->instr->ops) {
-        case NO_OPERANDS:
-            break;
-        case JMP_OPERAND:
-        case SRC_OPERAND_ONLY:
-        case DST_OPERAND_ONLY:
-        case CALL_OPERAND:
-        case P2_JUMP:
-        case P2_DST_CONST_OK:
-            flexbuf_addstr(fb, "\t");
-            PrintOperandSrc(fb, ir->dst, ir->dsteffect);
-            break;
-        default:
-            flexbuf_addstr(fb, "\t");
-            if (ir->opc == OPC_REPEAT && ir->dst->kind != IMM_INT) {
-                flexbuf_addstr(fb, "@");
-            }
-            PrintOperand(fb, ir->dst);
+    } else {
+        PrintCond(fb, ir->cond);
+    }
+    flexbuf_addstr(fb, ir->instr->name);
+    switch (ir->instr->ops) {
+    case NO_OPERANDS:
+        break;
+    case JMP_OPERAND:
+    case SRC_OPERAND_ONLY:
+    case DST_OPERAND_ONLY:
+    case CALL_OPERAND:
+    case P2_JUMP:
+    case P2_DST_CONST_OK:
+        flexbuf_addstr(fb, "\t");
+        PrintOperandSrc(fb, ir->dst, ir->dsteffect);
+        break;
+    default:
+        flexbuf_addstr(fb, "\t");
+        if (ir->opc == OPC_REPEAT && ir->dst->kind != IMM_INT) {
+            flexbuf_addstr(fb, "@");
+        }
+        PrintOperand(fb, ir->dst);
+        flexbuf_addstr(fb, ", ");
+        PrintOperandSrc(fb, ir->src, ir->srceffect);
+        if (ir->src2) {
             flexbuf_addstr(fb, ", ");
-            PrintOperandSrc(fb, ir->src, ir->srceffect);
-            if (ir->src2) {
-                flexbuf_addstr(fb, ", ");
-                PrintOperandSrc(fb, ir->src2, OPEFFECT_NONE);
-            }
-            break;
+            PrintOperandSrc(fb, ir->src2, OPEFFECT_NONE);
         }
-        ccset = ir->flags & (FLAG_WC|FLAG_WZ|FLAG_NR|FLAG_WR|FLAG_WCZ|FLAG_ANDC|FLAG_ANDZ|FLAG_ORC|FLAG_ORZ|FLAG_XORC|FLAG_XORZ);
-        if (ccset) {
-            const char *sepstring = " ";
-            if (gl_p2 && ((FLAG_WC|FLAG_WZ) == (ccset & (FLAG_WC|FLAG_WZ)))) {
-                flexbuf_printf(fb, "%swcz", sepstring);
+        break;
+    }
+    ccset = ir->flags & (FLAG_WC|FLAG_WZ|FLAG_NR|FLAG_WR|FLAG_WCZ|FLAG_ANDC|FLAG_ANDZ|FLAG_ORC|FLAG_ORZ|FLAG_XORC|FLAG_XORZ);
+    if (ccset) {
+        const char *sepstring = " ";
+        if (gl_p2 && ((FLAG_WC|FLAG_WZ) == (ccset & (FLAG_WC|FLAG_WZ)))) {
+            flexbuf_printf(fb, "%swcz", sepstring);
+            sepstring = ",";
+        } else { 
+            if (ccset & FLAG_WC) {
+                flexbuf_printf(fb, "%swc", sepstring);
                 sepstring = ",";
-            } else { 
-                if (ccset & FLAG_WC) {
-                    flexbuf_printf(fb, "%swc", sepstring);
-                    sepstring = ",";
-                }
-                if (ccset & FLAG_WZ) {
-                    flexbuf_printf(fb, "%swz", sepstring);
-                    sepstring = ",";
-                }
             }
-            if (ccset & FLAG_NR) {
-                flexbuf_printf(fb, "%snr", sepstring);
-            } else if (ccset & FLAG_WR) {
-                flexbuf_printf(fb, "%swr", sepstring);
-            } else if (ccset & FLAG_WCZ) {
-                flexbuf_printf(fb, "%swcz", sepstring);
-            } else if (ccset & FLAG_ANDC) {
-                flexbuf_printf(fb, "%sandc", sepstring);
-            } else if (ccset & FLAG_ANDZ) {
-                flexbuf_printf(fb, "%sandz", sepstring);
-            } else if (ccset & FLAG_ORC) {
-                flexbuf_printf(fb, "%sorc", sepstring);
-            } else if (ccset & FLAG_ORZ) {
-                flexbuf_printf(fb, "%sorz", sepstring);
-            } else if (ccset & FLAG_XORC) {
-                flexbuf_printf(fb, "%sxorc", sepstring);
-            } else if (ccset & FLAG_XORZ) {
-                flexbuf_printf(fb, "%sxorz", sepstring);
+            if (ccset & FLAG_WZ) {
+                flexbuf_printf(fb, "%swz", sepstring);
+                sepstring = ",";
             }
         }
-#if 0        
-        if (ir->flags & FLAG_KEEP_INSTR) {
-            flexbuf_printf(fb, " '' (volatile)");
+        if (ccset & FLAG_NR) {
+            flexbuf_printf(fb, "%snr", sepstring);
+        } else if (ccset & FLAG_WR) {
+            flexbuf_printf(fb, "%swr", sepstring);
+        } else if (ccset & FLAG_WCZ) {
+            flexbuf_printf(fb, "%swcz", sepstring);
+        } else if (ccset & FLAG_ANDC) {
+            flexbuf_printf(fb, "%sandc", sepstring);
+        } else if (ccset & FLAG_ANDZ) {
+            flexbuf_printf(fb, "%sandz", sepstring);
+        } else if (ccset & FLAG_ORC) {
+            flexbuf_printf(fb, "%sorc", sepstring);
+        } else if (ccset & FLAG_ORZ) {
+            flexbuf_printf(fb, "%sorz", sepstring);
+        } else if (ccset & FLAG_XORC) {
+            flexbuf_printf(fb, "%sxorc", sepstring);
+        } else if (ccset & FLAG_XORZ) {
+            flexbuf_printf(fb, "%sxorz", sepstring);
         }
-#endif
-        flexbuf_addstr(fb, "\n");
-        return;
     }
-    
+#if 0        
+    if (ir->flags & FLAG_KEEP_INSTR) {
+        flexbuf_printf(fb, " '' (volatile)");
+    }
+#endif
+    flexbuf_addstr(fb, "\n");
+}
+
+static void
+DoAssembleData(struct flexbuf *fb, IR *ir)
+{
     switch(ir->opc) {
     case OPC_LIVE:
         /* no code necessary, internal opcode */
@@ -1387,6 +1408,22 @@ DoAssembleIR(struct flexbuf *fb, IR *ir, Module *P)
     }
 }
 
+void
+DoAssembleIR(struct flexbuf *fb, IR *ir, Module *P)
+{
+    if (DoAssembleSection(fb, ir, P)) {
+        return;
+    }
+    if (DoAssembleBranch(fb, ir)) {
+        return;
+    }
+    if (ir->instr) {
+        DoAssembleInstr(fb, ir);
+    } else {
+        DoAssembleData(fb, ir);
+    }
+}
+
 static void
 RenameLabels(IRList *list)
 {
@@ -1469,3 +1506,735 @@ DumpIRL(IRList *irl)
     puts(doIRAssemble(irl, NULL, 1));
     lmmMode = saveLmmMode;
 }
+
+/*
+ * direct assembly: rather than printing the IR and then parsing the
+ * text again, build the DAT block of a module straight from the IR;
+ * the ASTs are the ones the parser would have produced for the text,
+ * so the DAT assembler does the actual encoding as usual
+ * IR which has no direct form (LMM branch sequences, literal PASM,
+ * and such) is printed and the text is parsed a piece at a time
+ */
+static Module *directModule;
+static struct flexbuf directText;
+static size_t directTextStart;
+static const char *directLastLabel;
+
+// parse any pending text into the module
+static void
+FlushDirectText(void)
+{
+    char *text;
+
+    if (flexbuf_curlen(&directText) <= directTextStart) {
+        return;
+    }
+    flexbuf_addchar(&directText, 0);
+    text = flexbuf_get(&directText);
+    directLastLabel = ParseModuleString(directModule, text, directLastLabel);
+    free(text);
+    // later pieces always start in the middle of a DAT section
+    flexbuf_addstr(&directText, "dat\n");
+    directTextStart = flexbuf_curlen(&directText);
+}
+
+static void
+DirectAppend(AST *ast)
+{
+    Module *Q = directModule;
+
+    FlushDirectText();
+    Q->datblock = AddToListEx(Q->datblock, ast, &Q->datblock_tail);
+}
+
+// an integer as the parser would see it after printing with %d
+static AST *
+DirectInteger(int32_t val)
+{
+    if (val < 0) {
+        return AstOperator(K_NEGATE, NULL, AstInteger((int32_t)(0U - (uint32_t)val)));
+    }
+    return AstInteger(val);
+}
+
+// an identifier as printed by RemappedName
+static AST *
+DirectName(const char *name)
+{
+    if (!name) {
+        return NULL;
+    }
+    return DatIdentifierAST(RemappedName(name), directModule->curLanguage, 0);
+}
+
+// an identifier printed without remapping
+static AST *
+DirectRawName(const char *name)
+{
+    if (!name) {
+        return NULL;
+    }
+    return DatIdentifierAST(name, directModule->curLanguage, 0);
+}
+
+static AST *
+DirectKeyword(const char *name, enum astkind kind)
+{
+    AST *ast = DatKeywordAST(name);
+
+    if (ast && ast->kind != kind) {
+        ast = NULL;
+    }
+    return ast;
+}
+
+// build an operand the way doPrintOperand prints it
+// returns NULL if there is no direct form
+static AST *
+DirectOperand(Operand *reg, int useimm, enum OperandEffect effect)
+{
+    AST *expr;
+    const char *regname;
+    int usehubaddr;
+    int useabsaddr;
+    int opoffset;
+    int skipimm;
+
+    opoffset = ((int)effect) >> OPEFFECT_OFFSET_SHIFT;
+    effect &= ~(OPEFFECT_OFFSET_MASK);
+    skipimm = ((int)effect) & OPEFFECT_NOIMM;
+    effect &= ~(OPEFFECT_NOIMM);
+    usehubaddr = effect & OPEFFECT_FORCEHUB;
+    effect &= ~(OPEFFECT_FORCEHUB);
+    if (gl_p2) {
+        useabsaddr = effect & OPEFFECT_FORCEABS;
+        effect &= ~OPEFFECT_FORCEABS;
+    } else {
+        useabsaddr = 0;
+    }
+    if (!reg) {
+        return NULL;
+    }
+    if (effect != OPEFFECT_NONE && (!gl_p2 || reg->kind != REG_HW)) {
+        return NULL;
+    }
+    switch (reg->kind) {
+    case IMM_PCRELATIVE:
+        return NULL;
+    case IMM_INT:
+        if (reg->val >= 0 && reg->val < 512) {
+            if (reg->name && reg->name[0]) {
+                expr = DirectName(reg->name);
+            } else {
+                expr = DirectInteger(reg->val);
+            }
+            return expr ? NewAST(AST_IMMHOLDER, expr, NULL) : NULL;
+        }
+        if (gl_p2) {
+            if (reg->name && reg->name[0]) {
+                expr = DirectName(reg->name);
+            } else {
+                expr = DirectInteger(reg->val);
+            }
+            return expr ? NewAST(AST_BIGIMMHOLDER, expr, NULL) : NULL;
+        }
+        return DirectName(reg->name);
+    case HUBMEM_REF:
+    case COGMEM_REF:
+    {
+        Operand *regptr;
+        if (!gl_p2 || !useimm) {
+            return NULL;
+        }
+        regptr = (Operand *)reg->name;
+        if (!regptr || regptr->kind != REG_HUBPTR) {
+            return NULL;
+        }
+        regptr = (Operand *)regptr->val;
+        expr = DirectRawName(regptr->name);
+        if (!expr) {
+            return NULL;
+        }
+        expr = AstOperator('+', NewAST(AST_ADDROF, expr, NULL), DirectInteger(reg->val));
+        return NewAST(AST_IMMHOLDER, expr, NULL);
+    }
+    case STRING_DEF:
+        if (!gl_p2 || !useimm) {
+            return NULL;
+        }
+        expr = DirectName(reg->name);
+        if (!expr) {
+            return NULL;
+        }
+        expr = NewAST(AST_ADDROF, expr, NULL);
+        if (useabsaddr) {
+            expr = AstCatch(expr);
+        }
+        return NewAST(AST_BIGIMMHOLDER, expr, NULL);
+    case IMM_HUB_LABEL:
+        expr = DirectName(reg->name);
+        if (!expr || !gl_p2 || !useimm) {
+            return expr;
+        }
+        if (useabsaddr) {
+            expr = AstCatch(NewAST(AST_ADDROF, expr, NULL));
+        }
+        return NewAST(AST_IMMHOLDER, expr, NULL);
+    default:
+        if (!useabsaddr) {
+            useimm = 0;
+        }
+        /* fall through */
+    case IMM_COG_LABEL:
+        if (reg->kind == REG_SUBREG) {
+            regname = OffsetName( ((Operand *)reg->name)->name, reg->val );
+        } else {
+            regname = reg->name;
+        }
+        expr = DirectName(regname);
+        if (!expr) {
+            return NULL;
+        }
+        if (useimm && skipimm) {
+            useimm = 0;
+        }
+        if (effect != OPEFFECT_NONE || opoffset) {
+            // only plain hardware register forms like ptra++ or ptra[4]
+            if (useimm || expr->kind != AST_HWREG || reg->val != 0) {
+                return NULL;
+            }
+            switch (effect) {
+            case OPEFFECT_PREINC:
+            case OPEFFECT_PREDEC:
+                if (opoffset) {
+                    return NULL;
+                }
+                return AstOperator(effect == OPEFFECT_PREINC ? K_INCREMENT : K_DECREMENT, NULL, expr);
+            case OPEFFECT_POSTINC:
+                return AstOperator(K_INCREMENT, expr, NULL);
+            case OPEFFECT_POSTDEC:
+                return AstOperator(K_DECREMENT, expr, NULL);
+            default:
+                break;
+            }
+            expr = NewAST(AST_RANGEREF, expr, NewAST(AST_RANGE, DirectInteger(opoffset), NULL));
+            if (opoffset > 31 || opoffset < -32) {
+                expr = NewAST(AST_BIGIMMHOLDER, expr, NULL);
+            }
+            return expr;
+        }
+        if (useimm && usehubaddr) {
+            expr = NewAST(AST_ADDROF, expr, NULL);
+        }
+        if ( (reg->kind == REG_HW || reg->kind == IMM_COG_LABEL) && reg->val != 0) {
+            expr = AstOperator('+', expr, DirectInteger(reg->val));
+        }
+        if (useimm) {
+            if (useabsaddr) {
+                expr = AstCatch(expr);
+            }
+            expr = NewAST(AST_IMMHOLDER, expr, NULL);
+        }
+        return expr;
+    }
+}
+
+// build a value the way PrintOperandAsValue prints it
+static AST *
+DirectValue(Operand *reg)
+{
+    AST *expr;
+
+    switch (reg->kind) {
+    case IMM_INT:
+        return DirectInteger(reg->val);
+    case IMM_HUB_LABEL:
+    case STRING_DEF:
+        expr = DirectName(reg->name);
+        if (!expr) {
+            return NULL;
+        }
+        return NewAST(gl_p2 ? AST_ADDROF : AST_ABSADDROF, expr, NULL);
+    case IMM_COG_LABEL:
+        return DirectName(reg->name);
+    case IMM_STRING:
+        return NULL;
+    case REG_HUBPTR:
+    case REG_COGPTR:
+        return DirectName(((Operand *)reg->val)->name);
+    default:
+        return DirectOperand(reg, 0, OPEFFECT_NONE);
+    }
+}
+
+static AST *
+AddDirectOperand(AST *list, AST *op)
+{
+    return AddToList(list, NewAST(AST_EXPRLIST, op, NULL));
+}
+
+static AST *
+AddDirectModifier(AST *list, const char *name)
+{
+    AST *mod;
+
+    if (!list) {
+        return NULL;
+    }
+    mod = DirectKeyword(name, AST_INSTRMODIFIER);
+    return mod ? AddToList(list, mod) : NULL;
+}
+
+// build an instruction the way DoAssembleInstr prints it
+static AST *
+DirectInstr(IR *ir)
+{
+    AST *list;
+    AST *op;
+    const char *cond;
+    int ccset;
+
+    if (ir->cond == COND_FALSE) {
+        return NULL;
+    }
+    cond = CondName(ir->cond);
+    if (!cond) {
+        return NULL;
+    }
+    list = DirectKeyword(ir->instr->name, AST_INSTR);
+    if (list && *cond) {
+        list = AddDirectModifier(list, cond);
+    }
+    if (!list) {
+        return NULL;
+    }
+    switch (ir->instr->ops) {
+    case NO_OPERANDS:
+        break;
+    case JMP_OPERAND:
+    case SRC_OPERAND_ONLY:
+    case DST_OPERAND_ONLY:
+    case CALL_OPERAND:
+    case P2_JUMP:
+    case P2_DST_CONST_OK:
+        op = DirectOperand(ir->dst, 1, ir->dsteffect);
+        if (!op) {
+            return NULL;
+        }
+        list = AddDirectOperand(list, op);
+        break;
+    default:
+        op = DirectOperand(ir->dst, 0, OPEFFECT_NONE);
+        if (!op) {
+            return NULL;
+        }
+        if (ir->opc == OPC_REPEAT && ir->dst->kind != IMM_INT) {
+            if (op->kind != AST_IDENTIFIER) {
+                return NULL;
+            }
+            op = NewAST(AST_ADDROF, op, NULL);
+        }
+        list = AddDirectOperand(list, op);
+        op = DirectOperand(ir->src, 1, ir->srceffect);
+        if (!op) {
+            return NULL;
+        }
+        list = AddDirectOperand(list, op);
+        if (ir->src2) {
+            op = DirectOperand(ir->src2, 1, OPEFFECT_NONE);
+            if (!op) {
+                return NULL;
+            }
+            list = AddDirectOperand(list, op);
+        }
+        break;
+    }
+    ccset = ir->flags & (FLAG_WC|FLAG_WZ|FLAG_NR|FLAG_WR|FLAG_WCZ|FLAG_ANDC|FLAG_ANDZ|FLAG_ORC|FLAG_ORZ|FLAG_XORC|FLAG_XORZ);
+    if (ccset) {
+        if (gl_p2 && ((FLAG_WC|FLAG_WZ) == (ccset & (FLAG_WC|FLAG_WZ)))) {
+            list = AddDirectModifier(list, "wcz");
+        } else {
+            if (ccset & FLAG_WC) {
+                list = AddDirectModifier(list, "wc");
+            }
+            if (ccset & FLAG_WZ) {
+                list = AddDirectModifier(list, "wz");
+            }
+        }
+        if (ccset & FLAG_NR) {
+            list = AddDirectModifier(list, "nr");
+        } else if (ccset & FLAG_WR) {
+            list = AddDirectModifier(list, "wr");
+        } else if (ccset & FLAG_WCZ) {
+            list = AddDirectModifier(list, "wcz");
+        } else if (ccset & FLAG_ANDC) {
+            list = AddDirectModifier(list, "andc");
+        } else if (ccset & FLAG_ANDZ) {
+            list = AddDirectModifier(list, "andz");
+        } else if (ccset & FLAG_ORC) {
+            list = AddDirectModifier(list, "orc");
+        } else if (ccset & FLAG_ORZ) {
+            list = AddDirectModifier(list, "orz");
+        } else if (ccset & FLAG_XORC) {
+            list = AddDirectModifier(list, "xorc");
+        } else if (ccset & FLAG_XORZ) {
+            list = AddDirectModifier(list, "xorz");
+        }
+        if (!list) {
+            return NULL;
+        }
+    }
+    return NewAST(AST_INSTRHOLDER, list, NULL);
+}
+
+// a one line instruction with an optional immediate operand
+static AST *
+DirectSimpleInstr(const char *name, AST *op)
+{
+    AST *list = DirectKeyword(name, AST_INSTR);
+
+    if (list && op) {
+        list = AddDirectOperand(list, op);
+    }
+    return list ? NewAST(AST_INSTRHOLDER, list, NULL) : NULL;
+}
+
+static AST *
+DirectLabel(const char *text)
+{
+    AST *ident = DatIdentifierAST(text, directModule->curLanguage, 1);
+
+    if (!ident || ident->kind != AST_IDENTIFIER) {
+        return NULL;
+    }
+    return AddToList(NewAST(AST_LINEBREAK, NULL, NULL), ident);
+}
+
+static AST *
+DirectDataList(enum astkind kind, AST *item)
+{
+    return NewAST(kind, NewAST(AST_EXPRLIST, item, NULL), NULL);
+}
+
+// build a binary blob the way OutputDataBlob prints it
+static AST *
+DirectBlob(Operand *label, Operand *op)
+{
+    Flexbuf *databuf;
+    Flexbuf *relocbuf;
+    Reloc *nextreloc;
+    int relocs;
+    int i;
+    int len;
+    int addr;
+    int runlen;
+    uint8_t *data;
+    char *startLabel;
+    AST *list;
+    AST *bytes = NULL;
+    AST *expr;
+    AST *item;
+
+    if (op->kind != IMM_BINARY) {
+        return NULL;
+    }
+    databuf = (Flexbuf *)op->name;
+    relocbuf = (Flexbuf *)op->val;
+    if (relocbuf) {
+        relocs = flexbuf_curlen(relocbuf) / sizeof(Reloc);
+        nextreloc = (Reloc *)flexbuf_peek(relocbuf);
+    } else {
+        relocs = 0;
+        nextreloc = NULL;
+    }
+    len = flexbuf_curlen(databuf);
+    // make sure it is a multiple of 4
+    while ( 0 != (len & 3) ) {
+        flexbuf_addchar(databuf, 0);
+        len = flexbuf_curlen(databuf);
+    }
+    // only 32 bit relocations have a direct form
+    for (i = 0; i < relocs; i++) {
+        switch (nextreloc[i].kind) {
+        case RELOC_KIND_I32:
+            if (nextreloc[i].addr + 4 > len) {
+                return NULL;
+            }
+            break;
+        case RELOC_KIND_NONE:
+        case RELOC_KIND_DEBUG:
+            break;
+        default:
+            return NULL;
+        }
+    }
+    startLabel = strdup(RemappedName(label->name));
+    list = DirectLabel(startLabel);
+    if (!list) {
+        free(startLabel);
+        return NULL;
+    }
+    if (gl_p2 || gl_compress) {
+        list = AddToList(NewAST(AST_ALIGN, AstInteger(4), NULL), list);
+    } else {
+        list = AddToList(NewAST(AST_LONGLIST, NULL, NULL), list);
+    }
+    data = (uint8_t *)flexbuf_peek(databuf);
+    addr = 0;
+    while (addr < len) {
+        int bytesPending = len - addr;
+
+        while (relocs > 0 && nextreloc->addr == addr && nextreloc->kind != RELOC_KIND_I32) {
+            nextreloc++;
+            --relocs;
+        }
+        if (relocs > 0 && nextreloc->addr == addr) {
+            int32_t offset = nextreloc->symoff;
+            const char *symname;
+
+            if (bytes) {
+                list = AddToList(list, NewAST(AST_BYTELIST, bytes, NULL));
+                bytes = NULL;
+            }
+            symname = nextreloc->sym ? BackendNameForSymbol(nextreloc->sym) : startLabel;
+            expr = DirectRawName(symname);
+            if (!expr) {
+                return NULL;
+            }
+            expr = NewAST(AST_ABSADDROF, expr, NULL);
+            if (offset > 0) {
+                expr = AstOperator('+', expr, DirectInteger(offset));
+            } else if (offset < 0) {
+                expr = AstOperator('-', expr, DirectInteger(-offset));
+            }
+            list = AddToList(list, DirectDataList(AST_LONGLIST, expr));
+            data += 4;
+            addr += 4;
+            nextreloc++;
+            --relocs;
+            continue;
+        }
+        if (relocs > 0 && bytesPending > nextreloc->addr - addr) {
+            bytesPending = nextreloc->addr - addr;
+        }
+        // look for runs of data (the same ones OutputDataBlob finds)
+        if (bytesPending > MAX_BYTES_ON_LINE) {
+            runlen = 0;
+            while (runlen < bytesPending && data[runlen] == data[0]) {
+                runlen++;
+            }
+            if (runlen > 4) {
+                item = NewAST(AST_ARRAYDECL, AstInteger(data[0]), AstInteger(runlen));
+                bytes = AddToList(bytes, NewAST(AST_EXPRLIST, item, NULL));
+                addr += runlen;
+                data += runlen;
+                continue;
+            }
+            bytesPending = MAX_BYTES_ON_LINE;
+        }
+        while (bytesPending > 0) {
+            bytes = AddToList(bytes, NewAST(AST_EXPRLIST, AstInteger(data[0]), NULL));
+            data++; addr++; --bytesPending;
+        }
+    }
+    if (bytes) {
+        list = AddToList(list, NewAST(AST_BYTELIST, bytes, NULL));
+    }
+    return list;
+}
+
+// build the data and directives DoAssembleData prints
+// returns 0 if there is no direct form, otherwise sets *result
+// (possibly to NULL, for IR which produces no code)
+static int
+DirectData(IR *ir, AST **result)
+{
+    AST *expr;
+    AST *ast = NULL;
+
+    switch(ir->opc) {
+    case OPC_LIVE:
+        break;
+    case OPC_LABEL:
+        ast = DirectLabel(RemappedName(ir->dst->name));
+        break;
+    case OPC_RET:
+        ast = DirectSimpleInstr("ret", NULL);
+        break;
+    case OPC_BYTE:
+    case OPC_WORD:
+    case OPC_LONG:
+    case OPC_STRING:
+        expr = DirectValue(ir->dst);
+        if (expr && ir->src) {
+            // a repeat count only parses the same way after a number
+            if (ir->dst->kind != IMM_INT || ir->src->kind != IMM_INT) {
+                return 0;
+            }
+            expr = NewAST(AST_ARRAYDECL, AstInteger((int32_t)ir->dst->val), DirectInteger(ir->src->val));
+        }
+        if (expr) {
+            ast = DirectDataList(ir->opc == OPC_LONG ? AST_LONGLIST : ir->opc == OPC_WORD ? AST_WORDLIST : AST_BYTELIST, expr);
+        }
+        break;
+    case OPC_RESERVE:
+        expr = DirectValue(ir->dst);
+        if (expr) {
+            ast = NewAST(AST_RES, expr, NULL);
+        }
+        break;
+    case OPC_RESERVEH:
+        expr = DirectValue(ir->dst);
+        if (expr) {
+            ast = DirectDataList(AST_LONGLIST, NewAST(AST_ARRAYDECL, AstInteger(0), expr));
+        }
+        break;
+    case OPC_ALIGNL:
+        ast = NewAST(AST_LONGLIST, NULL, NULL);
+        break;
+    case OPC_FCACHE:
+    {
+        AST *dst = DirectValue(ir->dst);
+        AST *src = DirectValue(ir->src);
+        AST *load = DirectRawName(gl_p2 ? "FCACHE_LOAD_" : "LMM_FCACHE_LOAD");
+
+        if (!dst || !src || !load) {
+            return 0;
+        }
+        expr = AstOperator('-', dst, src);
+        load = DirectSimpleInstr("call", NewAST(AST_IMMHOLDER, load, NULL));
+        if (gl_p2) {
+            // loc pa, #(dst-src) followed by call #FCACHE_LOAD_
+            ast = DirectKeyword("loc", AST_INSTR);
+            dst = DirectRawName("pa");
+            if (!ast || !dst || !load) {
+                return 0;
+            }
+            ast = AddDirectOperand(ast, dst);
+            ast = AddDirectOperand(ast, NewAST(AST_IMMHOLDER, expr, NULL));
+            ast = AddToList(NewAST(AST_INSTRHOLDER, ast, NULL), load);
+        } else {
+            // call #LMM_FCACHE_LOAD followed by the length
+            if (!load) {
+                return 0;
+            }
+            ast = AddToList(load, DirectDataList(AST_LONGLIST, expr));
+        }
+        break;
+    }
+    case OPC_LABELED_BLOB:
+        ast = DirectBlob(ir->dst, ir->src);
+        break;
+    case OPC_FIT:
+    case OPC_ORGF:
+        // the lexer may take a name here for an instruction
+        if (ir->dst->kind != IMM_INT) {
+            return 0;
+        }
+        ast = NewAST(ir->opc == OPC_FIT ? AST_FIT : AST_ORGF, DirectInteger(ir->dst->val), NULL);
+        break;
+    case OPC_ORG:
+        expr = DirectValue(ir->dst);
+        if (expr) {
+            ast = NewAST(AST_ORG, expr, NULL);
+        }
+        break;
+    case OPC_HUBMODE:
+        if (gl_p2) {
+            ast = NewAST(AST_ORGH, NULL, NULL);
+        }
+        lmmMode = 1;
+        break;
+    default:
+        return 0;
+    }
+    if (!ast && ir->opc != OPC_LIVE && ir->opc != OPC_HUBMODE) {
+        return 0;
+    }
+    *result = ast;
+    return 1;
+}
+
+static void
+DirectAssembleIR(IR *ir, Module *P)
+{
+    Module *save = current;
+    AST *ast = NULL;
+    int ok;
+
+    if (ir->opc == OPC_COMMENT) {
+        return;
+    }
+    if (DoAssembleSection(&directText, ir, P)) {
+        return;
+    }
+    if (lmmMode && gl_lmm_kind == LMM_KIND_COMPRESS) {
+        // compressed code has its own encodings
+        if (!DoAssembleBranch(&directText, ir)) {
+            if (ir->instr) {
+                DoAssembleInstr(&directText, ir);
+            } else {
+                DoAssembleData(&directText, ir);
+            }
+        }
+        return;
+    }
+    if (DoAssembleBranch(&directText, ir)) {
+        return;
+    }
+    // new ASTs get their line information from the module's
+    // lexer stream, so make sure there is one
+    if (!directModule->Lptr) {
+        FlushDirectText();
+    }
+    ok = 0;
+    if (directModule->Lptr) {
+        current = directModule;
+        if (ir->instr) {
+            ast = DirectInstr(ir);
+            ok = (ast != NULL);
+        } else {
+            ok = DirectData(ir, &ast);
+        }
+        current = save;
+    }
+    if (ok) {
+        if (ast) {
+            DirectAppend(ast);
+            if (ir->opc == OPC_LABEL) {
+                directLastLabel = ast->right->d.string;
+            }
+        }
+    } else if (ir->instr) {
+        DoAssembleInstr(&directText, ir);
+    } else {
+        DoAssembleData(&directText, ir);
+    }
+}
+
+/* assemble an IR list directly into the DAT block of module Q */
+void
+IRAssembleToModule(IRList *list, Module *P, Module *Q)
+{
+    IR *ir;
+
+    inDat = 0;
+    inCon = 0;
+    didOrg = 0;
+    didPub = 0;
+    lmmMode = 0;
+    RenameLabels(list);
+    if (gl_p2) {
+        didPub = 1; // we do not want pub declaration in P2 code
+    }
+    directModule = Q;
+    directLastLabel = NULL;
+    flexbuf_init(&directText, 512);
+    directTextStart = 0;
+    for (ir = list->head; ir; ir = ir->next) {
+        DirectAssembleIR(ir, P);
+    }
+    FlushDirectText();
+    flexbuf_delete(&directText);
+    directModule = NULL;
+}
@@ -38,6 +38,9 @@ extern void ValidateObjbase(void);
 extern Operand *objbase;
 extern void ValidateHeapptr(void);
 extern Operand *heapptr;
+extern void ValidateProfileptrs(void);
+extern Operand *profilecountsptr;
+extern Operand *profilenamesptr;
 extern Operand *resultreg[];
 extern Operand *arg1, *arg2;
 
@@ -126,6 +129,16 @@ CompileInlineOperand(IRList *irl, AST *expr, int *effects, int immflag)
                 r = heapptr;
                 r_address = immflag;
             }
+            else if (!strcmp(name, "__profile_counts_ptr")) {
+                ValidateProfileptrs();
+                r = profilecountsptr;
+                r_address = immflag;
+            }
+            else if (!strcmp(name, "__profile_names_ptr")) {
+                ValidateProfileptrs();
+                r = profilenamesptr;
+                r_address = immflag;
+            }
             else if (!strncmp(name, "result", 6) && isargdigit(name[6]) && !name[7]) {
                 r = GetResultReg( parseargnum(name+6));
                 r_address = immflag;
@@ -10,6 +10,7 @@
 #include <string.h>
 #include <stdint.h>
 #include <ctype.h>
+#include <limits.h>
 #include "spinc.h"
 #include "outasm.h"
 
@@ -540,69 +541,215 @@ static inline bool CondIsSubset(IRCond super, IRCond sub) {
     return sub == (super|sub);
 }
 
-// Note: currently only valid for P2
-static int InstrMinCycles(IR *ir) {
-    if (IsDummy(ir)||IsLabel(ir)) return 0;
-    int aug = 0;
-    if (ir->src && ir->src->kind == IMM_INT && ir->src->val > 511) aug += 2;
-    if (ir->dst && ir->dst->kind == IMM_INT && ir->dst->val > 511) aug += 2;
+// immediates which need an AUGS/AUGD prefix on P2
+bool IsAugImmediate(Operand *op) {
+    if (!op) return false;
+    switch (op->kind) {
+    case IMM_INT:
+        return op->val < 0 || op->val > 511;
+    case IMM_HUB_LABEL:
+    case IMM_STRING:
+        return true;
+    default:
+        return false;
+    }
+}
 
+static bool GenericNameIn(IR *ir, const char * const *names) {
+    switch (ir->opc) {
+    case OPC_GENERIC:
+    case OPC_GENERIC_NR:
+    case OPC_GENERIC_DELAY:
+    case OPC_GENERIC_BRANCH:
+    case OPC_GENERIC_BRCOND:
+    case OPC_GENERIC_NR_NOFLAGS:
+    case OPC_GENERIC_NOFLAGS:
+        break;
+    default:
+        return false;
+    }
+    if (!ir->instr) return false;
+    for (; *names; names++) {
+        if (!strcmp(ir->instr->name, *names)) return true;
+    }
+    return false;
+}
+
+// P2 instructions which wait for the hub window; inline assembly
+// may use any of them as generic instructions
+static const char * const hubReadNames[] = { "rdbyte", "rdword", "rdlong", NULL };
+static const char * const hubWriteNames[] = { "wrbyte", "wrword", "wrlong", "wmlong", NULL };
+static const char * const hubOpNames[] = {
+    "cogid", "coginit", "cogstop", "locknew", "lockret", "locktry", "lockrel",
+    "hubset", NULL
+};
+// instructions which may wait for an event or the CORDIC
+static const char * const waitNames[] = {
+    "waitx", "waitint", "waitct1", "waitct2", "waitct3", "waitse1", "waitse2",
+    "waitse3", "waitse4", "waitpat", "waitfbw", "waitxmt", "waitxfi", "waitxro",
+    "waitxrl", "waitatn", "rdfast", "wrfast", NULL
+};
+static const char * const cordicGetNames[] = { "getqx", "getqy", NULL };
+
+// the number of longs moved by a "setq/setq2; rdlong/wrlong" burst,
+// less one; -1 if we cannot tell
+static int BurstCount(IR *ir) {
+    IR *prev;
+    for (prev = ir->prev; prev && IsDummy(prev); prev = prev->prev)
+        ;
+    if (!prev) return 0;
+    if (prev->opc != OPC_SETQ && prev->opc != OPC_SETQ2) {
+        static const char * const setqNames[] = { "setq", "setq2", NULL };
+        if (!GenericNameIn(prev, setqNames)) return 0;
+    }
+    if (prev->dst && prev->dst->kind == IMM_INT && prev->dst->val >= 0) {
+        return prev->dst->val;
+    }
+    return -1;
+}
+
+static bool IsHubRead(IR *ir) {
     switch (ir->opc) {
-    case OPC_WRBYTE:
-    case OPC_WRWORD:
-    case OPC_WRLONG:
-        return aug+3;
     case OPC_RDBYTE:
     case OPC_RDWORD:
     case OPC_RDLONG:
-        return aug+9;
+        return true;
     default:
-        return aug+2;
+        return GenericNameIn(ir, hubReadNames);
     }
 }
-#if 0
-// Note: currently only valid for P2, and not used yet
-static int InstrMaxCycles(IR *ir) {
-    if (IsDummy(ir)||IsLabel(ir)) return 0;
-    if (IsBranch(ir)) return 100000; // No good.
-
-    int aug = 0;
-    if (ir->src && ir->src->kind == IMM_INT && ir->src->val > 511) aug += 2;
-    if (ir->dst && ir->dst->kind == IMM_INT && ir->dst->val > 511) aug += 2;
 
+static bool IsHubWrite(IR *ir) {
     switch (ir->opc) {
     case OPC_WRBYTE:
-        return aug+26; // Can never be unaligned
     case OPC_WRWORD:
     case OPC_WRLONG:
-        return aug+27;
-    case OPC_RDBYTE:
-        return aug+20; // Can never be unaligned
-    case OPC_RDWORD:
-    case OPC_RDLONG:
-        return aug+21;
-    case OPC_GENERIC:
-    case OPC_GENERIC_NR:
-    case OPC_GENERIC_DELAY:
-    case OPC_GENERIC_BRANCH:
-    case OPC_GENERIC_BRCOND:
-    case OPC_GENERIC_NR_NOFLAGS:
-    case OPC_GENERIC_NOFLAGS:
+        return true;
+    default:
+        return GenericNameIn(ir, hubWriteNames);
+    }
+}
+
+static bool IsLongHubAccess(IR *ir) {
+    static const char * const longNames[] = { "rdlong", "wrlong", "wmlong", NULL };
+    return ir->opc == OPC_RDLONG || ir->opc == OPC_WRLONG || GenericNameIn(ir, longNames);
+}
+
+// true for P2 instructions which wait for the hub window
+bool InstrUsesHub(IR *ir) {
+    switch (ir->opc) {
+    case OPC_COGID:
+    case OPC_COGSTOP:
+    case OPC_LOCKNEW:
+    case OPC_LOCKRET:
+    case OPC_LOCKSET:
+    case OPC_LOCKCLR:
+    case OPC_HUBSET:
+        return true;
+    default:
+        return IsHubRead(ir) || IsHubWrite(ir) || GenericNameIn(ir, hubOpNames);
+    }
+}
+
+// Note: currently only valid for P2
+// branches are costed as if they stay in cog memory; an instruction
+// with a condition may not run at all
+int InstrMinCycles(IR *ir) {
+    if (IsDummy(ir)||IsLabel(ir)) return 0;
+    int aug = 0;
+    int burst = IsLongHubAccess(ir) ? BurstCount(ir) : 0;
+    if (!IsBranch(ir) || ir->opc == OPC_REPEAT) {
+        if (IsAugImmediate(ir->src)) aug += 2;
+        if (IsAugImmediate(ir->dst)) aug += 2;
+    }
+    if (burst < 0) burst = 0;
+    if (ir->cond != COND_TRUE) {
+        // may be skipped
+        return aug+2;
+    }
+
+    if (IsHubWrite(ir)) {
+        return aug+3+burst;
+    }
+    if (IsHubRead(ir)) {
+        return aug+9+burst;
+    }
+    switch (ir->opc) {
+    case OPC_JUMP:
+    case OPC_CALL:
+    case OPC_RET:
+        return 4;
     case OPC_WAITX:
+        if (ir->dst && ir->dst->kind == IMM_INT && ir->dst->val >= 0) {
+            return aug+2+ir->dst->val;
+        }
+        return aug+2;
+    default:
+        return aug+2;
+    }
+}
+
+// Note: currently only valid for P2
+// branches are costed as if they stay in cog memory, and hub
+// accesses as if running from cog memory; returns -1 if there is
+// no upper bound we know of
+int InstrMaxCycles(IR *ir) {
+    if (IsDummy(ir)||IsLabel(ir)) return 0;
+    int aug = 0;
+    int burst = IsLongHubAccess(ir) ? BurstCount(ir) : 0;
+    if (!IsBranch(ir) || ir->opc == OPC_REPEAT) {
+        if (IsAugImmediate(ir->src)) aug += 2;
+        if (IsAugImmediate(ir->dst)) aug += 2;
+    }
+    if (burst < 0) return -1;
+
+    // words and longs take one more cycle if they cross a long boundary
+    if (IsHubWrite(ir)) {
+        return aug+10+burst+(ir->opc == OPC_WRBYTE ? 0 : 1);
+    }
+    if (IsHubRead(ir)) {
+        return aug+16+burst+(ir->opc == OPC_RDBYTE ? 0 : 1);
+    }
+    if (GenericNameIn(ir, hubOpNames)) {
+        return aug+16;
+    }
+    if (GenericNameIn(ir, waitNames)) {
+        return -1;
+    }
+    if (GenericNameIn(ir, cordicGetNames)) {
+        return aug+58;
+    }
+    switch (ir->opc) {
+    case OPC_JUMP:
+    case OPC_DJNZ:
+    case OPC_GENERIC_BRCOND:
+    case OPC_CALL:
+    case OPC_RET:
+        return 4;
+    case OPC_GENERIC_BRANCH:
     case OPC_WAITCNT:
-        return 100000; // No good;
-    case OPC_QMUL:
-    case OPC_QDIV:
-    case OPC_QFRAC:
-    case OPC_QSQRT:
-    case OPC_QLOG:
-    case OPC_QEXP:
-        return aug+9;
+        return -1;
+    case OPC_WAITX:
+        if (ir->dst && ir->dst->kind == IMM_INT && ir->dst->val >= 0) {
+            return aug+2+ir->dst->val;
+        }
+        return -1;
+    case OPC_GETQX:
+    case OPC_GETQY:
+        // may wait for the CORDIC pipeline
+        return aug+58;
+    case OPC_COGID:
+    case OPC_COGSTOP:
+    case OPC_LOCKNEW:
+    case OPC_LOCKRET:
+    case OPC_LOCKSET:
+    case OPC_LOCKCLR:
+    case OPC_HUBSET:
+        return aug+16;
     default:
         return aug+2;
     }
 }
-#endif
 
 extern Operand *mulfunc, *unsmulfunc, *divfunc, *unsdivfunc, *muldiva, *muldivb;
 
@@ -618,43 +765,58 @@ static bool FuncUsesArg(Operand *func, Operand *arg)
 /*
  * return TRUE if the operand's value does not need to be preserved
  * after instruction instr
- * follows branches, but gives up after MAX_FOLLOWED_JUMPS to prevent
- * infinite loops
+ *
+ * This follows branches: the code reachable from instr is split into
+ * straight line segments (starting at instr and at each jump target),
+ * which are scanned one at a time from a worklist. Every jump and
+ * jump target is visited at most once per query, so the search is
+ * linear in the size of the function no matter how many branches
+ * there are. Coming back to a place we have already visited means
+ * we have gone around a loop (or joined a path that is already being
+ * checked); registers may be considered dead there, labels not.
  */
-#define MAX_FOLLOWED_JUMPS 8
+typedef enum DeadScan {
+    SCAN_LIVE,
+    SCAN_DEAD,
+} DeadScan;
+
+// the stamp counter is shared by all threads, so that marks left in a
+// function's IR by one thread never look current to another
+static unsigned deadVisitCounter;
+static THREAD_LOCAL unsigned deadVisitStamp;
+static THREAD_LOCAL IR **deadWorklist;
+static THREAD_LOCAL size_t deadWorklistSize;
 
-static bool
-doIsDeadAfter(IR *instr, Operand *op, int level, IR **stack)
+static void
+PushDeadWork(size_t *count, IR *ir)
+{
+    if (*count == deadWorklistSize) {
+        deadWorklistSize = deadWorklistSize ? 2*deadWorklistSize : 64;
+        deadWorklist = (IR **)realloc(deadWorklist, deadWorklistSize * sizeof(IR *));
+        if (!deadWorklist) {
+            fprintf(stderr, "FATAL: out of memory\n");
+            exit(2);
+        }
+    }
+    deadWorklist[(*count)++] = ir;
+}
+
+// scan one straight line segment starting after "start"
+static DeadScan
+ScanDeadSegment(IR *start, Operand *op, size_t *count)
 {
   IR *ir;
-  int i;
 
-  if (op->kind == REG_HW) {
-      // hardware registers are never dead
-      return false;
-  }
-  if (op->kind == REG_SUBREG) {
-      // cannot handle sub registers properly yet
-      return false;
-  }
-  if (level >= MAX_FOLLOWED_JUMPS) {
-      // give up!
-      return false;
-  }
-  for (ir = instr->next; ir; ir = ir->next) {
-    for (i = 0; i < level; i++) {
-        if (ir == stack[i]) {
-            // we've come around a loop
-            // registers may be considered dead, labels not
-            return IsRegister(op->kind);
-        }
+  for (ir = start->next; ir; ir = ir->next) {
+    if (ir->visit == deadVisitStamp) {
+        // we've come around a loop
+        // registers may be considered dead, labels not
+        return IsRegister(op->kind) ? SCAN_DEAD : SCAN_LIVE;
     }
     if (IsDummy(ir)) continue;
     if (ir->opc == OPC_LABEL) {
-        // potential problem: if there is a branch before instr
-        // that goes to LABEL then we might miss a set
-        // so check
-        IR *comefrom = (IR *)ir->aux;
+        // potential problem: we do not know what happened on the
+        // paths that jump here, so we need to know who they are
         if (ir->flags & FLAG_LABEL_NOJUMP) {
             // this label isn't a jump target, so don't worry about it
             continue;
@@ -663,22 +825,10 @@ doIsDeadAfter(IR *instr, Operand *op, int level, IR **stack)
             // last label in the function, again, no need to worry
             continue;
         }
-        if (!comefrom) {
+        if (!ir->aux) {
             // we don't know what branches come here,
             // so for caution give up
-            return false;
-        }
-        if (level == 0 && comefrom->addr < instr->addr) {
-            // go back and see if there are any references before the
-            // jump that brought us here
-            // if so, abort
-            IR *backir = comefrom;
-            while (backir) {
-                if (backir->src == op || backir->dst == op) {
-                    return false;
-                }
-                backir = backir->prev;
-            }
+            return SCAN_LIVE;
         }
         continue;
     }
@@ -687,10 +837,10 @@ doIsDeadAfter(IR *instr, Operand *op, int level, IR **stack)
         // well, unless the value is used only to update itself:
         // check for that here
         if (ir->dst != op) {
-            return false;  // op used to modify something else
+            return SCAN_LIVE;  // op used to modify something else
         }
         if (InstrSetsAnyFlags(ir)) {
-            return false;  // flag setting matters, we are not dead
+            return SCAN_LIVE;  // flag setting matters, we are not dead
         }
         switch(ir->opc) {
             // be very cautious about whether op is dead if
@@ -705,74 +855,96 @@ doIsDeadAfter(IR *instr, Operand *op, int level, IR **stack)
             break;
         default:
             // assume live
-            return false;
+            return SCAN_LIVE;
         }
         if (op->kind == REG_SUBREG) {
-            return false;
+            return SCAN_LIVE;
         }
         if (ir->dst && ir->dst->kind == REG_SUBREG) {
-            return false;
+            return SCAN_LIVE;
         }
         if (ir->src && ir->src->kind == REG_SUBREG) {
-            return false;
+            return SCAN_LIVE;
         }
     } else if (InstrModifies(ir, op)) {
         // if the instruction modifies but does not use the op,
         // then we're setting it from another register and it's dead
         if (op->kind == REG_SUBREG) {
-            return false;
+            return SCAN_LIVE;
         }
         if (ir->dst && ir->dst->kind == REG_SUBREG) {
-            return false;
+            return SCAN_LIVE;
         }
         if (ir->cond == COND_TRUE) {
-            return true;
+            return SCAN_DEAD;
         }
     }
     if (ir->opc == OPC_RET && ir->cond == COND_TRUE) {
-      return IsLocalOrArg(op);
+        return IsLocalOrArg(op) ? SCAN_DEAD : SCAN_LIVE;
     } else if (ir->opc == OPC_CALL) {
         if (!IsLocal(op)) {
             // we know of some special cases where argN is not used
             if (IsArg(op) && !FuncUsesArg(ir->dst, op)) {
                 /* OK to continue */
             } else {
-                return false;
+                return SCAN_LIVE;
             }
         }
     } else if (IsJump(ir)) {
+        IR *target = (IR *)ir->aux;
         // if the jump is to an unknown place give up
-        if (!ir->aux) {
+        if (!target) {
             // jump to return is like running off the end
             if (ir->dst == FuncData(curfunc)->asmreturnlabel && ir->cond == COND_TRUE) {
-                goto done;
+                break;
             }
-            return false;
+            return SCAN_LIVE;
         }
-        stack[level] = ir; // remember where we were
-        if (!doIsDeadAfter((IR *)ir->aux, op, level+1, stack)) {
-            return false;
+        // remember that we've been here, and check the jump target
+        // later (unless some other path is already checking it)
+        ir->visit = deadVisitStamp;
+        if (target->visit != deadVisitStamp) {
+            target->visit = deadVisitStamp;
+            PushDeadWork(count, target);
+        } else if (!IsRegister(op->kind)) {
+            return SCAN_LIVE;
         }
-#if 1
-        // be very careful about potential conditional jumps to
-        // after this point, but we did check for that above
         if (ir->cond == COND_TRUE && ir->opc == OPC_JUMP) {
-            return true;
+            return SCAN_DEAD;
         }
-#endif        
     }
   }
-done:  
   /* if we reach the end without seeing any use */
-  return IsLocalOrArg(op);
+  return IsLocalOrArg(op) ? SCAN_DEAD : SCAN_LIVE;
 }
 
 static bool
 IsDeadAfter(IR *instr, Operand *op)
 {
-    IR *stack[MAX_FOLLOWED_JUMPS];
-    stack[0] = instr;
-    return doIsDeadAfter(instr, op, 1, stack);
+    size_t count = 0;
+
+    if (op->kind == REG_HW) {
+        // hardware registers are never dead
+        return false;
+    }
+    if (op->kind == REG_SUBREG) {
+        // cannot handle sub registers properly yet
+        return false;
+    }
+    deadVisitStamp = __sync_add_and_fetch(&deadVisitCounter, 1);
+    if (deadVisitStamp == 0) {
+        // stamp wrapped around; old marks could now look current
+        deadVisitStamp = __sync_add_and_fetch(&deadVisitCounter, 1);
+    }
+    instr->visit = deadVisitStamp;
+    PushDeadWork(&count, instr);
+    while (count > 0) {
+        IR *start = deadWorklist[--count];
+        if (ScanDeadSegment(start, op, &count) == SCAN_LIVE) {
+            return false;
+        }
+    }
+    return true;
 }
 
 static bool
@@ -2308,44 +2480,6 @@ AssignTemporaryAddresses(IRList *irl)
     }
 }
 
-//
-// find out if a label is referenced (perhaps indirectly)
-// if there is a unique jump to it, return a pointer to it
-//
-static void
-MarkLabelUses(IRList *irl, IR *irlabel)
-{
-    IR *ir;
-    Operand *label = irlabel->dst;
-    Operand *dst;
-
-    if (label->used >= 9999) {
-        // GOSUB labels get flagged with a large used value so they do not get taken away
-        irlabel->flags |= FLAG_LABEL_USED;
-    }
-    for (ir = irl->head; ir; ir = ir->next) {
-        if (IsDummy(ir)) continue;
-        if (IsJump(ir)) {
-            dst = JumpDest(ir);
-            if (dst == label) {
-                ir->aux = irlabel; // record where the jump goes to
-                if (irlabel->flags & FLAG_LABEL_USED) {
-                    // the label has more than one use
-                    irlabel->aux = NULL;
-                } else {
-                    irlabel->flags |= FLAG_LABEL_USED;
-                    irlabel->aux = ir;
-                }
-            }
-        } else if (ir != irlabel) {
-            if (ir->src == label || ir->dst == label) {
-                irlabel->flags |= FLAG_LABEL_USED;
-                irlabel->aux = NULL;
-            }
-        }
-    }
-}
-
 static bool
 IsTemporaryLabel(Operand *op)
 {
@@ -2356,20 +2490,106 @@ IsTemporaryLabel(Operand *op)
     return false;
 }
 
+//
+// table used by CheckLabelUsage to map label operands to their
+// uses; this lets us find all label references in a single walk
+// over the list, rather than one walk per label
+//
+typedef struct LabelUse {
+    Operand *label;     // label operand (NULL for an empty slot)
+    IR *lastdef;        // last OPC_LABEL defining this operand
+    unsigned ndefs;     // number of (non-dummy) OPC_LABEL defining it
+    unsigned njumps;    // number of jumps to it
+    IR *jump;           // most recent jump to it
+    bool otheruse;      // referenced by something other than a jump
+} LabelUse;
+
+static LabelUse *
+FindLabelUse(LabelUse *tab, unsigned mask, Operand *label, bool create)
+{
+    unsigned h = (unsigned)(((uintptr_t)label >> 3) * 2654435761u) & mask;
+
+    while (tab[h].label) {
+        if (tab[h].label == label) {
+            return &tab[h];
+        }
+        h = (h+1) & mask;
+    }
+    if (!create) return NULL;
+    tab[h].label = label;
+    return &tab[h];
+}
+
 //
 // check label usage
+// marks labels as used and records jump destinations in ir->aux
+// (and for labels with a unique jump to them, the jump in label->aux);
+// removes temporary labels that are not used
 //
 static int
 CheckLabelUsage(IRList *irl)
 {
     IR *ir, *ir_next;
-    ir = irl->head;
+    LabelUse *tab, *use;
+    unsigned size, mask;
+    unsigned nlabels = 0;
     int change = 0;
-    
+
+    for (ir = irl->head; ir; ir = ir->next) {
+        if (ir->opc == OPC_LABEL) nlabels++;
+    }
+    if (nlabels == 0) {
+        return 0;
+    }
+    for (size = 16; size < 2*nlabels; size *= 2)
+        ;
+    mask = size - 1;
+    tab = (LabelUse *)calloc(size, sizeof(*tab));
+    if (!tab) {
+        fprintf(stderr, "FATAL: out of memory\n");
+        exit(2);
+    }
+    for (ir = irl->head; ir; ir = ir->next) {
+        if (ir->opc == OPC_LABEL) {
+            use = FindLabelUse(tab, mask, ir->dst, true);
+            use->lastdef = ir;
+            if (!IsDummy(ir)) {
+                use->ndefs++;
+            }
+        }
+    }
+    for (ir = irl->head; ir; ir = ir->next) {
+        if (IsDummy(ir) || ir->opc == OPC_LABEL) continue;
+        if (IsJump(ir)) {
+            use = FindLabelUse(tab, mask, JumpDest(ir), false);
+            if (use) {
+                ir->aux = use->lastdef; // record where the jump goes to
+                use->njumps++;
+                use->jump = ir;
+            }
+        } else {
+            use = ir->src ? FindLabelUse(tab, mask, ir->src, false) : NULL;
+            if (use) use->otheruse = true;
+            use = ir->dst ? FindLabelUse(tab, mask, ir->dst, false) : NULL;
+            if (use) use->otheruse = true;
+        }
+    }
+    ir = irl->head;
     while (ir) {
         ir_next = ir->next;
         if (ir->opc == OPC_LABEL) {
-            MarkLabelUses(irl, ir);
+            bool other;
+            use = FindLabelUse(tab, mask, ir->dst, false);
+            // another definition of the same label counts as a use
+            other = use->otheruse || use->ndefs > (IsDummy(ir) ? 0 : 1);
+            if (ir->dst->used >= 9999) {
+                // GOSUB labels get flagged with a large used value so they do not get taken away
+                other = true;
+            }
+            if (other || use->njumps) {
+                ir->flags |= FLAG_LABEL_USED;
+                ir->aux = (!other && use->njumps == 1) ? use->jump : NULL;
+            }
             if ( IsTemporaryLabel(ir->dst) && !(ir->flags & (FLAG_LABEL_USED|FLAG_KEEP_INSTR))) {
                 DeleteIR(irl, ir);
                 change = 1;
@@ -2377,7 +2597,7 @@ CheckLabelUsage(IRList *irl)
         }
         ir = ir_next;
     }
-
+    free(tab);
     return change;
 }
 
@@ -2584,7 +2804,7 @@ OptimizePeepholes(IRList *irl)
                 if (opc == OPC_AND && ((oldmask & newmask) == oldmask)) {
                     if (InstrSetsFlags(ir, FLAG_WZ)) {
                         ReplaceOpcode(ir, OPC_CMP);
-                        ir->src->val = 0;
+                        ir->src = NewImmediate(0);
                         changed = 1;
                     } else if (!InstrSetsAnyFlags(ir)) {
                         DeleteIR(irl, ir);
@@ -2594,7 +2814,7 @@ OptimizePeepholes(IRList *irl)
                 } else if (opc == OPC_OR && ((oldmask | newmask) == oldmask)) {
                     if (InstrSetsFlags(ir, FLAG_WZ)) {
                         ReplaceOpcode(ir, OPC_CMP);
-                        ir->src->val = 0;
+                        ir->src = NewImmediate(0);
                         changed = 1;
                     } else if (!InstrSetsAnyFlags(ir)) {
                         DeleteIR(irl, ir);
@@ -3910,7 +4130,7 @@ OptimizeCORDIC(IRList *irl) {
 }
 
 //
-static bool
+static int
 CORDICconstPropagate(IRList *irl) {
     bool constantCommand=false,change=false,foundX=false,foundY=false;
     int32_t const_x=0,const_y=0;
@@ -3970,7 +4190,7 @@ CORDICconstPropagate(IRList *irl) {
 // Optimization may have created lone CORDIC commands
 // which will lead to strange results.
 // Thus, we shall remove these.
-static bool
+static int
 FixupLoneCORDIC(IRList *irl) {
     bool seenCommand = true, change = false;
     for(IR *ir=irl->tail;ir;ir=ir->prev) {
@@ -3990,6 +4210,77 @@ FixupLoneCORDIC(IRList *irl) {
 }
 
 
+//
+// pass manager for OptimizeIRLocal
+//
+// Each pass walks the IRList and returns nonzero if it changed
+// anything; every change bumps a generation counter. A pass that ran
+// without making a change cannot find anything new until the list
+// changes again, so it is skipped while the generation is unchanged.
+// The label and address information the passes depend on is
+// recomputed whenever the list has changed since it was last built,
+// so every pass sees up to date information.
+//
+typedef int (*OptPassFunc)(IRList *irl);
+
+typedef struct OptPass {
+    const char *name;
+    OptPassFunc func;
+    unsigned optflags;   // OPT_xxx flags required to run the pass (0 == always)
+    bool p2only;         // only applies to P2
+} OptPass;
+
+typedef struct OptPassStats {
+    unsigned runs;       // number of times the pass actually ran
+    unsigned changes;    // number of runs which changed the IR
+    unsigned skipped;    // number of times the pass was skipped
+    double seconds;      // time spent in the pass (with --time-report)
+} OptPassStats;
+
+static OptPass localPasses[] = {
+    { "OptimizeReadWrite",         OptimizeReadWrite,         OPT_BASIC_REGS,      false },
+    { "EliminateDeadCode",         EliminateDeadCode,         OPT_BASIC_REGS,      false },
+    { "OptimizeCogWrites",         OptimizeCogWrites,         OPT_BASIC_REGS,      false },
+    { "OptimizeSimpleAssignments", OptimizeSimpleAssignments, OPT_BASIC_REGS,      false },
+    { "OptimizeMoves",             OptimizeMoves,             OPT_BASIC_REGS,      false },
+    { "OptimizeImmediates",        OptimizeImmediates,        OPT_CONST_PROPAGATE, false },
+    { "OptimizeCompares",          OptimizeCompares,          OPT_BASIC_REGS,      false },
+    { "OptimizeAddSub",            OptimizeAddSub,            OPT_BASIC_REGS,      false },
+    { "OptimizeShortBranches",     OptimizeShortBranches,     OPT_BRANCHES,        false },
+    { "OptimizePeepholes",         OptimizePeepholes,         OPT_PEEPHOLE,        false },
+    { "OptimizePeephole2",         OptimizePeephole2,         OPT_PEEPHOLE,        false },
+    { "OptimizeIncDec",            OptimizeIncDec,            OPT_BASIC_REGS,      false },
+    { "OptimizeJumps",             OptimizeJumps,             OPT_BASIC_REGS,      false },
+    { "OptimizeP2",                OptimizeP2,                OPT_BASIC_REGS,      true },
+    { "FixupLoneCORDIC",           FixupLoneCORDIC,           0,                   true },
+    { "CORDICconstPropagate",      CORDICconstPropagate,      OPT_CONST_PROPAGATE, true },
+};
+
+#define NUM_LOCAL_PASSES (sizeof(localPasses)/sizeof(localPasses[0]))
+
+static void
+ReportPassStats(Function *f, unsigned sweeps, unsigned analyses, OptPassStats *stats)
+{
+    struct flexbuf fb;
+    char buf[80];
+    unsigned i;
+    unsigned runs = 0, skipped = 0;
+
+    flexbuf_init(&fb, 256);
+    for (i = 0; i < NUM_LOCAL_PASSES; i++) {
+        runs += stats[i].runs;
+        skipped += stats[i].skipped;
+        if (stats[i].changes) {
+            snprintf(buf, sizeof(buf), " %s=%u/%u", localPasses[i].name, stats[i].changes, stats[i].runs);
+            flexbuf_addstr(&fb, buf);
+        }
+    }
+    flexbuf_addchar(&fb, 0);
+    DEBUG(NULL, "optimized %s: %u sweeps, %u label scans, %u passes run, %u skipped;%s",
+          f ? f->name : "<anon>", sweeps, analyses, runs, skipped, flexbuf_peek(&fb));
+    flexbuf_delete(&fb);
+}
+
 // optimize an isolated piece of IRList
 // (typically a function)
 void
@@ -3997,60 +4288,583 @@ OptimizeIRLocal(IRList *irl, Function *f)
 {
     int change;
     int flags = f->optimize_flags;
+    unsigned generation = 1;
+    unsigned analyzed = 0;     // generation at which labels were last checked
+    unsigned lastClean[NUM_LOCAL_PASSES];
+    OptPassStats stats[NUM_LOCAL_PASSES];
+    unsigned sweeps = 0, analyses = 0;
+    unsigned i;
+    bool pending;
+    struct timespan span;
+    double passStart;
+
     if (gl_errors > 0) return;
     if (!irl->head) return;
 
+    timereport_begin(&span, "OptimizeIRLocal", f ? f->name : NULL);
+    memset(lastClean, 0, sizeof(lastClean));
+    memset(stats, 0, sizeof(stats));
+
     // multiply divide optimization need only be performed once,
     // and should be done before other optimizations confuse things
     OptimizeMulDiv(irl);
 again:
     do {
-        change = 0;
-        AssignTemporaryAddresses(irl);
-        if (flags & OPT_BASIC_REGS) {
-            change |= CheckLabelUsage(irl);
-            change |= OptimizeReadWrite(irl);
-            change |= EliminateDeadCode(irl);
-            change |= OptimizeCogWrites(irl);
-            change |= OptimizeSimpleAssignments(irl);
-            change |= OptimizeMoves(irl);
-        }
-        if (flags & OPT_CONST_PROPAGATE) {
-            change |= OptimizeImmediates(irl);
-        }
-        if (flags & OPT_BASIC_REGS) {
-            change |= OptimizeCompares(irl);
-            change |= OptimizeAddSub(irl);
-        }
-        if (flags & OPT_BRANCHES) {
-            change |= OptimizeShortBranches(irl);
-        }
-        if (flags & OPT_PEEPHOLE) {
-            change |= OptimizePeepholes(irl);
-            change |= OptimizePeephole2(irl);
-        }
-        if (flags & OPT_BASIC_REGS) {
-            change |= OptimizeIncDec(irl);
-            change |= OptimizeJumps(irl);
-        }
-        if (gl_p2 && (flags & OPT_BASIC_REGS)) {
-            change |= OptimizeP2(irl);
-        }
-        if (gl_p2) {
-            change |= FixupLoneCORDIC(irl);
-            if (flags & OPT_CONST_PROPAGATE) {
-                change |= CORDICconstPropagate(irl);
+        pending = false;
+        sweeps++;
+        for (i = 0; i < NUM_LOCAL_PASSES; i++) {
+            OptPass *pass = &localPasses[i];
+            if (pass->p2only && !gl_p2) continue;
+            if (pass->optflags && !(flags & pass->optflags)) continue;
+            if (lastClean[i] == generation) {
+                stats[i].skipped++;
+                continue;
+            }
+            while (analyzed != generation) {
+                analyzed = generation;
+                analyses++;
+                AssignTemporaryAddresses(irl);
+                if ((flags & OPT_BASIC_REGS) && CheckLabelUsage(irl)) {
+                    generation++;
+                    pending = true;
+                }
+            }
+            stats[i].runs++;
+            passStart = timereport_enabled ? timereport_now() : 0.0;
+            change = (*pass->func)(irl);
+            if (timereport_enabled) {
+                stats[i].seconds += timereport_now() - passStart;
+            }
+            if (change) {
+                stats[i].changes++;
+                generation++;
+                pending = true;
+            } else {
+                lastClean[i] = generation;
             }
         }
-    } while (change != 0);
+    } while (pending);
+    change = 0;
     if (flags & OPT_TAIL_CALLS) {
         change = OptimizeTailCalls(irl, f);
     }
-    if (change) goto again;
+    if (change) {
+        generation++;
+        goto again;
+    }
     if (gl_p2 && (flags & OPT_CORDIC_REORDER)) {
         change = OptimizeCORDIC(irl);
     }
-    if (change) goto again;
+    if (change) {
+        generation++;
+        goto again;
+    }
+    if (gl_verbosity > 1) {
+        ReportPassStats(f, sweeps, analyses, stats);
+    }
+    if (timereport_enabled) {
+        for (i = 0; i < NUM_LOCAL_PASSES; i++) {
+            if (stats[i].runs) {
+                timereport_add(localPasses[i].name, f ? f->name : NULL, stats[i].seconds, stats[i].runs);
+            }
+        }
+    }
+    timereport_end(&span, sweeps);
+}
+
+//
+// local register allocation
+//
+// Local and temporary registers that are never live at the same time
+// can share a register. We compute liveness of the locals with a
+// standard backwards dataflow over the instructions, build an
+// interference graph from it, and colour the graph greedily (in order
+// of first appearance, preferring the colour of a register we are
+// moved to/from so that the move disappears).
+//
+// Anything we do not understand well enough (indirect register
+// access, local sub-registers, locals referenced by name) makes us
+// give up, in which case the caller falls back to giving each local
+// its own register.
+//
+
+typedef unsigned long LiveWord;
+#define LIVE_BITS (8*sizeof(LiveWord))
+#define LIVE_SET(set, n)  ((set)[(n)/LIVE_BITS] |= (1UL << ((n) % LIVE_BITS)))
+#define LIVE_TEST(set, n) (((set)[(n)/LIVE_BITS] >> ((n) % LIVE_BITS)) & 1)
+// loop over the members of set (which is W words long), setting n to each in turn
+#define LIVE_FOREACH(set, W, n, w, x) \
+    for ((w) = 0; (w) < (W); (w)++) \
+        for ((x) = (set)[w]; (x) && ((n) = (w)*LIVE_BITS + __builtin_ctzl(x), 1); (x) &= (x)-1)
+
+#define SUCC_EXIT    (-1)   // leaves the function; no locals are live
+#define SUCC_UNKNOWN (-2)   // goes somewhere unknown; all locals are live
+
+typedef struct RegAllocState {
+    int ninstr;
+    IR **instr;
+    int nregs;
+    Operand **regs;
+    int words;              // number of LiveWords in a set
+    LiveWord *use, *kill, *def;
+    LiveWord *livein, *liveout;
+    int *succ;              // two successors per instruction
+    LiveWord *adj;          // interference graph: one set per register
+    // pointer map from operands (locals and labels) to indices
+    void **mapkey;
+    int *mapval;
+    unsigned mapmask;
+} RegAllocState;
+
+static void *
+RegAllocAlloc(size_t n, size_t size)
+{
+    void *ptr = calloc(n ? n : 1, size);
+    if (!ptr) {
+        fprintf(stderr, "FATAL: out of memory\n");
+        exit(2);
+    }
+    return ptr;
+}
+
+static int *
+RegAllocMapSlot(RegAllocState *S, void *key, bool create)
+{
+    unsigned h = (unsigned)(((uintptr_t)key >> 3) * 2654435761u) & S->mapmask;
+    while (S->mapkey[h]) {
+        if (S->mapkey[h] == key) {
+            return &S->mapval[h];
+        }
+        h = (h+1) & S->mapmask;
+    }
+    if (!create) return NULL;
+    S->mapkey[h] = key;
+    S->mapval[h] = -1;
+    return &S->mapval[h];
+}
+
+static bool
+IsAllocatableLocal(Operand *op)
+{
+    return op && (op->kind == REG_LOCAL || op->kind == REG_TEMP);
+}
+
+// check an operand which is not itself a local for hidden references
+// to a local; returns false if there is one
+static bool
+RegAllocCheckOperand(RegAllocState *S, Operand *op)
+{
+    int i;
+    if (!op || IsAllocatableLocal(op)) {
+        return true;
+    }
+    switch (op->kind) {
+    case REG_SUBREG:
+    case COGMEM_REF:
+    case HUBMEM_REF:
+        // name holds the base register
+        if (op->name && RegAllocMapSlot(S, (void *)op->name, false)) {
+            return false;
+        }
+        return true;
+    case IMM_COG_LABEL:
+    case REG_HW:
+    case REG_REG:
+    case REG_ARG:
+        if (!op->name) return true;
+        for (i = 0; i < S->nregs; i++) {
+            if (!strcmp(op->name, S->regs[i]->name)) {
+                return false;
+            }
+        }
+        return true;
+    default:
+        return true;
+    }
+}
+
+static void
+RegAllocFree(RegAllocState *S)
+{
+    free(S->instr);
+    free(S->regs);
+    free(S->use);
+    free(S->kill);
+    free(S->def);
+    free(S->livein);
+    free(S->liveout);
+    free(S->succ);
+    free(S->adj);
+    free(S->mapkey);
+    free(S->mapval);
+}
+
+// collect instructions, locals, and labels; returns false if we
+// cannot handle this function
+static bool
+RegAllocCollect(RegAllocState *S, IRList *irl)
+{
+    IR *ir;
+    int n = 0, i, j;
+    unsigned size;
+    Operand *ops[2];
+
+    for (ir = irl->head; ir; ir = ir->next) {
+        n++;
+    }
+    S->ninstr = n;
+    S->instr = (IR **)RegAllocAlloc(n, sizeof(IR *));
+    S->regs = (Operand **)RegAllocAlloc(2*n, sizeof(Operand *));
+    for (size = 16; size < 4*(unsigned)n; size *= 2)
+        ;
+    S->mapmask = size - 1;
+    S->mapkey = (void **)RegAllocAlloc(size, sizeof(void *));
+    S->mapval = (int *)RegAllocAlloc(size, sizeof(int));
+
+    n = 0;
+    for (ir = irl->head; ir; ir = ir->next) {
+        S->instr[n] = ir;
+        switch (ir->opc) {
+        case OPC_ALTD:
+        case OPC_ALTS:
+        case OPC_SETQ:
+        case OPC_SETQ2:
+        case OPC_GENERIC_DELAY:
+            // these may affect registers other than their operands
+            return false;
+        case OPC_LABEL:
+            {
+                int *slot = RegAllocMapSlot(S, ir->dst, true);
+                if (*slot >= 0) {
+                    return false; // duplicate label
+                }
+                *slot = n;
+            }
+            break;
+        default:
+            break;
+        }
+        if (IsAllocatableLocal(ir->src2)) {
+            return false;
+        }
+        ops[0] = ir->dst;
+        ops[1] = ir->src;
+        for (j = 0; j < 2; j++) {
+            if (IsAllocatableLocal(ops[j])) {
+                int *slot = RegAllocMapSlot(S, ops[j], true);
+                if (*slot < 0) {
+                    for (i = 0; i < S->nregs; i++) {
+                        if (!strcmp(S->regs[i]->name, ops[j]->name)) {
+                            return false; // two locals with the same name
+                        }
+                    }
+                    *slot = S->nregs;
+                    S->regs[S->nregs++] = ops[j];
+                }
+            }
+        }
+        n++;
+    }
+    // now that we know all the locals, look for other references to them
+    for (ir = irl->head; ir; ir = ir->next) {
+        if (!RegAllocCheckOperand(S, ir->dst)
+            || !RegAllocCheckOperand(S, ir->src)
+            || !RegAllocCheckOperand(S, ir->src2))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static int
+RegIndex(RegAllocState *S, Operand *op)
+{
+    int *slot;
+    if (!IsAllocatableLocal(op)) return -1;
+    slot = RegAllocMapSlot(S, op, false);
+    return slot ? *slot : -1;
+}
+
+static void
+RegAllocFlow(RegAllocState *S, Function *f)
+{
+    int n = S->ninstr;
+    int W = S->words;
+    int i, k, w;
+    bool change;
+    Operand *retlabel = FuncData(f)->asmreturnlabel;
+    Operand *retname = FuncData(f)->asmretname;
+
+    S->use = (LiveWord *)RegAllocAlloc(n*W, sizeof(LiveWord));
+    S->kill = (LiveWord *)RegAllocAlloc(n*W, sizeof(LiveWord));
+    S->def = (LiveWord *)RegAllocAlloc(n*W, sizeof(LiveWord));
+    S->livein = (LiveWord *)RegAllocAlloc(n*W, sizeof(LiveWord));
+    S->liveout = (LiveWord *)RegAllocAlloc(n*W, sizeof(LiveWord));
+    S->succ = (int *)RegAllocAlloc(2*n, sizeof(int));
+
+    for (i = 0; i < n; i++) {
+        IR *ir = S->instr[i];
+        int d = RegIndex(S, ir->dst);
+        int s = RegIndex(S, ir->src);
+        int *succ = &S->succ[2*i];
+        bool fallthrough = true;
+
+        succ[0] = succ[1] = SUCC_EXIT;
+        if (!IsDummy(ir) && !IsLabel(ir)) {
+            if (s >= 0) {
+                LIVE_SET(&S->use[i*W], s);
+                if (InstrModifies(ir, ir->src)) {
+                    LIVE_SET(&S->def[i*W], s);
+                }
+            }
+            if (d >= 0) {
+                if (InstrUses(ir, ir->dst)) {
+                    LIVE_SET(&S->use[i*W], d);
+                }
+                if (InstrModifies(ir, ir->dst)) {
+                    LIVE_SET(&S->def[i*W], d);
+                    if (ir->cond == COND_TRUE) {
+                        LIVE_SET(&S->kill[i*W], d);
+                    }
+                }
+            }
+            if (ir->cond == COND_TRUE && (ir->opc == OPC_RET || ir->opc == OPC_JUMP)) {
+                fallthrough = false;
+            }
+            if (IsJump(ir)) {
+                Operand *dest = JumpDest(ir);
+                int *slot = dest ? RegAllocMapSlot(S, dest, false) : NULL;
+                if (slot && *slot >= 0 && IsLabel(S->instr[*slot])) {
+                    succ[1] = *slot;
+                } else if (dest && (dest == retlabel || dest == retname)) {
+                    succ[1] = SUCC_EXIT;
+                } else {
+                    succ[1] = SUCC_UNKNOWN;
+                }
+            }
+        }
+        if (fallthrough) {
+            succ[0] = (i+1 < n) ? i+1 : SUCC_EXIT;
+        }
+    }
+
+    do {
+        change = false;
+        for (i = n-1; i >= 0; --i) {
+            LiveWord *out = &S->liveout[i*W];
+            LiveWord *in = &S->livein[i*W];
+            for (k = 0; k < 2; k++) {
+                int t = S->succ[2*i+k];
+                if (t >= 0) {
+                    for (w = 0; w < W; w++) out[w] |= S->livein[t*W+w];
+                } else if (t == SUCC_UNKNOWN) {
+                    for (w = 0; w < W; w++) out[w] = ~(LiveWord)0;
+                }
+            }
+            for (w = 0; w < W; w++) {
+                LiveWord x = S->use[i*W+w] | (out[w] & ~S->kill[i*W+w]);
+                if (x != in[w]) {
+                    in[w] = x;
+                    change = true;
+                }
+            }
+        }
+    } while (change);
+}
+
+static void
+RegAllocInterfere(RegAllocState *S)
+{
+    int n = S->ninstr;
+    int W = S->words;
+    int R = S->nregs;
+    int i, a, b, w, k;
+    LiveWord x, keep;
+    LiveWord *row, *out;
+
+    // each register defined by an instruction interferes with the
+    // ones live after it, except for the source of a copy to it
+    S->adj = (LiveWord *)RegAllocAlloc(R*W, sizeof(LiveWord));
+    for (i = 0; i < n; i++) {
+        IR *ir = S->instr[i];
+        int movsrc = -1;
+        if (ir->opc == OPC_MOV && ir->cond == COND_TRUE && ir->srceffect == OPEFFECT_NONE) {
+            movsrc = RegIndex(S, ir->src);
+        }
+        out = &S->liveout[i*W];
+        LIVE_FOREACH(&S->def[i*W], W, a, w, x) {
+            row = &S->adj[a*W];
+            for (k = 0; k < W; k++) {
+                keep = out[k];
+                if (movsrc >= 0 && k == movsrc / (int)LIVE_BITS) {
+                    keep &= ~(1UL << (movsrc % LIVE_BITS));
+                }
+                row[k] |= keep;
+            }
+        }
+    }
+    // locals which are live on entry (not initialized on some path)
+    // all have unknown values, so keep them apart
+    if (n > 0) {
+        LIVE_FOREACH(&S->livein[0], W, a, w, x) {
+            if (a >= R) break;
+            row = &S->adj[a*W];
+            for (k = 0; k < W; k++) {
+                row[k] |= S->livein[k];
+            }
+        }
+    }
+    // drop the registers which are not locals (a jump to somewhere
+    // unknown makes everything live) and make the graph symmetric
+    for (a = 0; a < R; a++) {
+        row = &S->adj[a*W];
+        row[a / LIVE_BITS] &= ~(1UL << (a % LIVE_BITS));
+        if (R % LIVE_BITS) {
+            row[W-1] &= (1UL << (R % LIVE_BITS)) - 1;
+        }
+        LIVE_FOREACH(row, W, b, w, x) {
+            LIVE_SET(&S->adj[b*W], a);
+        }
+    }
+}
+
+// returns the number of colours used
+static int
+RegAllocColor(RegAllocState *S, int *color)
+{
+    int R = S->nregs;
+    int n = S->ninstr;
+    int W = S->words;
+    int i, a, b, c, w;
+    int ncolors = 0;
+    LiveWord x;
+    unsigned char *forbidden = (unsigned char *)RegAllocAlloc(R+1, 1);
+    int *movestart = (int *)RegAllocAlloc(R+2, sizeof(int));
+    int *movelist, *movefill;
+
+    // find the registers each register is copied to or from, in
+    // instruction order; movelist[movestart[a] .. movestart[a+1]-1]
+    // holds them for register a
+    for (i = 0; i < n; i++) {
+        IR *ir = S->instr[i];
+        int d, s;
+        if (ir->opc != OPC_MOV || IsDummy(ir)) continue;
+        d = RegIndex(S, ir->dst);
+        s = RegIndex(S, ir->src);
+        if (d >= 0 && s >= 0) {
+            movestart[d+2]++;
+            movestart[s+2]++;
+        }
+    }
+    for (a = 0; a < R; a++) {
+        movestart[a+2] += movestart[a+1];
+    }
+    movelist = (int *)RegAllocAlloc(movestart[R+1], sizeof(int));
+    movefill = movestart + 1;
+    for (i = 0; i < n; i++) {
+        IR *ir = S->instr[i];
+        int d, s;
+        if (ir->opc != OPC_MOV || IsDummy(ir)) continue;
+        d = RegIndex(S, ir->dst);
+        s = RegIndex(S, ir->src);
+        if (d >= 0 && s >= 0) {
+            movelist[movefill[d]++] = s;
+            movelist[movefill[s]++] = d;
+        }
+    }
+
+    for (a = 0; a < R; a++) {
+        color[a] = -1;
+    }
+    // S->regs is already in order of first appearance
+    for (a = 0; a < R; a++) {
+        memset(forbidden, 0, R+1);
+        LIVE_FOREACH(&S->adj[a*W], W, b, w, x) {
+            if (color[b] >= 0) {
+                forbidden[color[b]] = 1;
+            }
+        }
+        c = -1;
+        // prefer the colour of a register we are copied to or from
+        for (i = movestart[a]; i < movestart[a+1] && c < 0; i++) {
+            b = movelist[i];
+            if (color[b] >= 0 && !forbidden[color[b]]) {
+                c = color[b];
+            }
+        }
+        if (c < 0) {
+            for (c = 0; forbidden[c]; c++)
+                ;
+        }
+        color[a] = c;
+        if (c >= ncolors) ncolors = c+1;
+    }
+    free(movelist);
+    free(movestart);
+    free(forbidden);
+    return ncolors;
+}
+
+/*
+ * assign registers to the locals of a function; the registers used
+ * are GetLocalReg(firstreg ... ), and the function returns the
+ * first register number not used; returns -1 if the function
+ * could not be handled (nothing is changed in that case)
+ */
+int
+AllocateLocalRegs(IRList *irl, Function *f, int firstreg, int isLeaf)
+{
+    RegAllocState S;
+    int *color;
+    int ncolors;
+    int i;
+    IR *ir;
+
+    memset(&S, 0, sizeof(S));
+    if (!RegAllocCollect(&S, irl)) {
+        RegAllocFree(&S);
+        return -1;
+    }
+    if (S.nregs == 0) {
+        RegAllocFree(&S);
+        return firstreg;
+    }
+    S.words = (S.nregs + LIVE_BITS - 1) / LIVE_BITS;
+    RegAllocFlow(&S, f);
+    RegAllocInterfere(&S);
+    color = (int *)RegAllocAlloc(S.nregs, sizeof(int));
+    ncolors = RegAllocColor(&S, color);
+
+    for (i = 0; i < S.ninstr; i++) {
+        int d, s;
+        ir = S.instr[i];
+        d = RegIndex(&S, ir->dst);
+        s = RegIndex(&S, ir->src);
+        if (d >= 0) {
+            ir->dst = GetLocalReg(firstreg + color[d], isLeaf);
+        }
+        if (s >= 0) {
+            ir->src = GetLocalReg(firstreg + color[s], isLeaf);
+        }
+        // a copy between two locals which now share a colour is a
+        // no-op; "mov x,x" written by the user (e.g. for timing) is kept
+        if (d >= 0 && s >= 0 && d != s && color[d] == color[s] && ir->opc == OPC_MOV
+            && ir->srceffect == OPEFFECT_NONE && ir->dsteffect == OPEFFECT_NONE
+            && !InstrSetsAnyFlags(ir) && !InstrIsVolatile(ir))
+        {
+            DeleteIR(irl, ir);
+        }
+    }
+    for (i = 0; i < S.nregs; i++) {
+        if (S.regs[i]->used) {
+            --S.regs[i]->used;
+        }
+    }
+    DEBUG(NULL, "allocated %d locals of %s into %d registers", S.nregs, f->name, ncolors);
+    free(color);
+    RegAllocFree(&S);
+    return firstreg + ncolors;
 }
 
 //
@@ -4103,6 +4917,7 @@ ShouldBeInlined(Function *f)
     int n = 0;
     int paramfactor;
     int threshold;
+    int heat;
 
     if (gl_p2) {
         threshold = INLINE_THRESHOLD_P2;
@@ -4150,6 +4965,15 @@ ShouldBeInlined(Function *f)
         }
     }
 
+    // with a profile, leave alone functions which were never called,
+    // and allow bigger ones to be inlined if they are called a lot
+    heat = ProfileFuncHeat(f);
+    if (heat < 0) {
+        return false;
+    } else if (heat > 0) {
+        threshold *= 2;
+    }
+
     // otherwise only inline small functions
     // also note that we should consider the cost of moving instructions
     // into argument registers when considering this
@@ -4308,7 +5132,10 @@ OptimizeFcache(IRList *irl)
     
     ir = irl->head;
     while (ir) {
-        if (IsLabel(ir)) {
+        if (IsLabel(ir) && ProfileLoopIsCold(ir->dst)) {
+            // the profile says loading this loop would cost more than
+            // it saves; loops inside it may still be worth it
+        } else if (IsLabel(ir)) {
             endlabel = LoopCanBeFcached(irl, ir, gl_fcache_size);
             if (endlabel) {
                 Operand *src = ir->dst;
@@ -4374,7 +5201,7 @@ typedef struct PeepholePattern {
 
 #define PEEP_OP_CLRMASK(bits, shift) (PEEP_OP_CLRBITS|(bits<<6)|(shift))
 
-static Operand *peep_ops[MAX_OPERANDS_IN_PATTERN];
+static THREAD_LOCAL Operand *peep_ops[MAX_OPERANDS_IN_PATTERN];
 
 static int PeepOperandMatch(int patrn_dst, Operand *dst, IR *ir)
 {
@@ -5378,106 +6205,221 @@ struct Peepholes {
     PeepholePattern *check;
     int arg;
     int (*replace)(int arg, IRList *irl, IR *ir);
+    const char *name;   // for statistics
 } peep2[] = {
-    { pat_maxs, OPC_MAXS, ReplaceMaxMin },
-    { pat_maxu, OPC_MAXU, ReplaceMaxMin },
-    { pat_mins, OPC_MINS, ReplaceMaxMin },
-    { pat_minu, OPC_MINU, ReplaceMaxMin },
-    { pat_maxs_off, OPC_MAXS, ReplaceMaxMin },
-    { pat_maxu_off, OPC_MAXU, ReplaceMaxMin },
-
-    { pat_zeroex, OPC_ZEROX, ReplaceExtend },
-    { pat_signex, OPC_SIGNX, ReplaceExtend },
-
-    { pat_drvc1, OPC_DRVC, ReplaceDrvc },
-    { pat_drvc2, OPC_DRVC, ReplaceDrvc },
-    { pat_drvnc1, OPC_DRVNC, ReplaceDrvc },
-    { pat_drvnc2, OPC_DRVNC, ReplaceDrvc },
-    { pat_bitc1, OPC_BITC, ReplaceDrvc },
-    { pat_bitc2, OPC_BITC, ReplaceDrvc },
-    { pat_bitnc1, OPC_BITNC, ReplaceDrvc },
-    { pat_bitnc2, OPC_BITNC, ReplaceDrvc },
-    { pat_drvz, OPC_DRVZ, ReplaceDrvc },
-    { pat_drvnz1, OPC_DRVNZ, ReplaceDrvc },
-    { pat_drvnz2, OPC_DRVNZ, ReplaceDrvc },
-
-    { pat_negc1, OPC_NEGC, ReplaceDrvc },
-    { pat_negc2, OPC_NEGC, ReplaceDrvc },
-    { pat_negnc1, OPC_NEGNC, ReplaceDrvc },
-    { pat_negnc2, OPC_NEGNC, ReplaceDrvc },
-    { pat_negz1, OPC_NEGZ, ReplaceDrvc },
-    { pat_negz2, OPC_NEGZ, ReplaceDrvc },
-    { pat_negnz1, OPC_NEGNZ, ReplaceDrvc },
-    { pat_negnz2, OPC_NEGNZ, ReplaceDrvc },
-
-    { pat_not, 0, ReplaceNot}, 
-
-    { pat_wrc_cmp, 0, ReplaceWrcCmp },
-    { pat_wrc_and, 1, RemoveNFlagged },
-    { pat_wrc_test, 0, ReplaceWrcTest },
+    { pat_maxs, OPC_MAXS, ReplaceMaxMin, "maxs" },
+    { pat_maxu, OPC_MAXU, ReplaceMaxMin, "maxu" },
+    { pat_mins, OPC_MINS, ReplaceMaxMin, "mins" },
+    { pat_minu, OPC_MINU, ReplaceMaxMin, "minu" },
+    { pat_maxs_off, OPC_MAXS, ReplaceMaxMin, "maxs_off" },
+    { pat_maxu_off, OPC_MAXU, ReplaceMaxMin, "maxu_off" },
+
+    { pat_zeroex, OPC_ZEROX, ReplaceExtend, "zeroex" },
+    { pat_signex, OPC_SIGNX, ReplaceExtend, "signex" },
+
+    { pat_drvc1, OPC_DRVC, ReplaceDrvc, "drvc1" },
+    { pat_drvc2, OPC_DRVC, ReplaceDrvc, "drvc2" },
+    { pat_drvnc1, OPC_DRVNC, ReplaceDrvc, "drvnc1" },
+    { pat_drvnc2, OPC_DRVNC, ReplaceDrvc, "drvnc2" },
+    { pat_bitc1, OPC_BITC, ReplaceDrvc, "bitc1" },
+    { pat_bitc2, OPC_BITC, ReplaceDrvc, "bitc2" },
+    { pat_bitnc1, OPC_BITNC, ReplaceDrvc, "bitnc1" },
+    { pat_bitnc2, OPC_BITNC, ReplaceDrvc, "bitnc2" },
+    { pat_drvz, OPC_DRVZ, ReplaceDrvc, "drvz" },
+    { pat_drvnz1, OPC_DRVNZ, ReplaceDrvc, "drvnz1" },
+    { pat_drvnz2, OPC_DRVNZ, ReplaceDrvc, "drvnz2" },
+
+    { pat_negc1, OPC_NEGC, ReplaceDrvc, "negc1" },
+    { pat_negc2, OPC_NEGC, ReplaceDrvc, "negc2" },
+    { pat_negnc1, OPC_NEGNC, ReplaceDrvc, "negnc1" },
+    { pat_negnc2, OPC_NEGNC, ReplaceDrvc, "negnc2" },
+    { pat_negz1, OPC_NEGZ, ReplaceDrvc, "negz1" },
+    { pat_negz2, OPC_NEGZ, ReplaceDrvc, "negz2" },
+    { pat_negnz1, OPC_NEGNZ, ReplaceDrvc, "negnz1" },
+    { pat_negnz2, OPC_NEGNZ, ReplaceDrvc, "negnz2" },
+
+    { pat_not, 0, ReplaceNot, "not" },
+
+    { pat_wrc_cmp, 0, ReplaceWrcCmp, "wrc_cmp" },
+    { pat_wrc_and, 1, RemoveNFlagged, "wrc_and" },
+    { pat_wrc_test, 0, ReplaceWrcTest, "wrc_test" },
     
-    { pat_rdbyte1, 2, RemoveNFlagged },
-    { pat_rdword1, 2, RemoveNFlagged },
-    { pat_rdbyte2, 1, RemoveNFlagged },
-    { pat_rdword2, 1, RemoveNFlagged },
+    { pat_rdbyte1, 2, RemoveNFlagged, "rdbyte1" },
+    { pat_rdword1, 2, RemoveNFlagged, "rdword1" },
+    { pat_rdbyte2, 1, RemoveNFlagged, "rdbyte2" },
+    { pat_rdword2, 1, RemoveNFlagged, "rdword2" },
 
-    { pat_movadd, 0, FixupMovAdd },
+    { pat_movadd, 0, FixupMovAdd, "movadd" },
 
-    { pat_movneg, 0, FixupMovNeg },
-    { pat_movabs, 0, FixupMovNeg },
-    { pat_movnegc, 0, FixupMovNeg },
-    { pat_movnegnc, 0, FixupMovNeg },
-    { pat_movnegz, 0, FixupMovNeg },
-    { pat_movnegnz, 0, FixupMovNeg },
+    { pat_movneg, 0, FixupMovNeg, "movneg" },
+    { pat_movabs, 0, FixupMovNeg, "movabs" },
+    { pat_movnegc, 0, FixupMovNeg, "movnegc" },
+    { pat_movnegnc, 0, FixupMovNeg, "movnegnc" },
+    { pat_movnegz, 0, FixupMovNeg, "movnegz" },
+    { pat_movnegnz, 0, FixupMovNeg, "movnegnz" },
 
-    { pat_bmask1, 0, FixupBmask },
-    { pat_bmask2, 0, FixupBmask },
+    { pat_bmask1, 0, FixupBmask, "bmask1" },
+    { pat_bmask2, 0, FixupBmask, "bmask2" },
 
-    { pat_waitx, 0, FixupWaitx },
+    { pat_waitx, 0, FixupWaitx, "waitx" },
     
-    { pat_seteq, OPC_WRZ, FixupEq },
-    { pat_setne, OPC_WRNZ, FixupEq },
-
-    { pat_sar24getbyte, OPC_GETBYTE, FixupGetByteWord },
-    { pat_shr24getbyte, OPC_GETBYTE, FixupGetByteWord },
-    { pat_sar16getbyte, OPC_GETBYTE, FixupGetByteWord },
-    { pat_shr16getbyte, OPC_GETBYTE, FixupGetByteWord },
-    { pat_sar8getbyte, OPC_GETBYTE, FixupGetByteWord },
-    { pat_shr8getbyte, OPC_GETBYTE, FixupGetByteWord },
-
-    { pat_sar16getword, OPC_GETWORD, FixupGetByteWord },
-    { pat_shr16getword, OPC_GETWORD, FixupGetByteWord },
-
-    { pat_shl8setbyte, OPC_SETBYTE, FixupSetByteWord },
-    { pat_shl16setbyte, OPC_SETBYTE, FixupSetByteWord },
-    { pat_shl24setbyte, OPC_SETBYTE, FixupSetByteWord },
+    { pat_seteq, OPC_WRZ, FixupEq, "seteq" },
+    { pat_setne, OPC_WRNZ, FixupEq, "setne" },
+
+    { pat_sar24getbyte, OPC_GETBYTE, FixupGetByteWord, "sar24getbyte" },
+    { pat_shr24getbyte, OPC_GETBYTE, FixupGetByteWord, "shr24getbyte" },
+    { pat_sar16getbyte, OPC_GETBYTE, FixupGetByteWord, "sar16getbyte" },
+    { pat_shr16getbyte, OPC_GETBYTE, FixupGetByteWord, "shr16getbyte" },
+    { pat_sar8getbyte, OPC_GETBYTE, FixupGetByteWord, "sar8getbyte" },
+    { pat_shr8getbyte, OPC_GETBYTE, FixupGetByteWord, "shr8getbyte" },
+
+    { pat_sar16getword, OPC_GETWORD, FixupGetByteWord, "sar16getword" },
+    { pat_shr16getword, OPC_GETWORD, FixupGetByteWord, "shr16getword" },
+
+    { pat_shl8setbyte, OPC_SETBYTE, FixupSetByteWord, "shl8setbyte" },
+    { pat_shl16setbyte, OPC_SETBYTE, FixupSetByteWord, "shl16setbyte" },
+    { pat_shl24setbyte, OPC_SETBYTE, FixupSetByteWord, "shl24setbyte" },
     
-    { pat_shl16setword, OPC_SETWORD, FixupSetByteWord },
+    { pat_shl16setword, OPC_SETWORD, FixupSetByteWord, "shl16setword" },
     
-    { pat_clrc, 0, FixupClrC },
-    { pat_setc1, 0, FixupSetC },
-    { pat_setc2, 0, FixupSetC },
-
-    { pat_mov_and_add, 0, FixupAndAdd },
-
-    { pat_qmul_qmul1, 0, FixupQmuls },
-    { pat_qmul_qmul2, 0, FixupQmuls },
-    { pat_qdiv_qdiv1, 0, FixupQmuls },
-    { pat_qdiv_qdiv2, 0, FixupQmuls },
-
-    { pat_qdiv_qdiv_signed1, 0, FixupQdivSigned},
-    { pat_qdiv_qdiv_signed2, 0, FixupQdivSigned},
-    { pat_qdiv_qdiv_signed3, 0, FixupQdivSigned2},
-    { pat_qdiv_qdiv_signed4, 0, FixupQdivSigned2},
-    { pat_qdiv_qdiv_signed5, 0, FixupQdivSigned3},
+    { pat_clrc, 0, FixupClrC, "clrc" },
+    { pat_setc1, 0, FixupSetC, "setc1" },
+    { pat_setc2, 0, FixupSetC, "setc2" },
+
+    { pat_mov_and_add, 0, FixupAndAdd, "mov_and_add" },
+
+    { pat_qmul_qmul1, 0, FixupQmuls, "qmul_qmul1" },
+    { pat_qmul_qmul2, 0, FixupQmuls, "qmul_qmul2" },
+    { pat_qdiv_qdiv1, 0, FixupQmuls, "qdiv_qdiv1" },
+    { pat_qdiv_qdiv2, 0, FixupQmuls, "qdiv_qdiv2" },
+
+    { pat_qdiv_qdiv_signed1, 0, FixupQdivSigned, "qdiv_qdiv_signed1" },
+    { pat_qdiv_qdiv_signed2, 0, FixupQdivSigned, "qdiv_qdiv_signed2" },
+    { pat_qdiv_qdiv_signed3, 0, FixupQdivSigned2, "qdiv_qdiv_signed3" },
+    { pat_qdiv_qdiv_signed4, 0, FixupQdivSigned2, "qdiv_qdiv_signed4" },
+    { pat_qdiv_qdiv_signed5, 0, FixupQdivSigned3, "qdiv_qdiv_signed5" },
 };
 
 
+#define NUM_PEEP2 (sizeof(peep2) / sizeof(peep2[0]))
+
+//
+// index of the peep2 patterns by the opcode of their first instruction,
+// so that only patterns which can possibly match are tried;
+// peep2Index[p2][opc] .. peep2Index[p2][opc+1] is the range of
+// peep2Cand holding (in table order) the patterns to try at an
+// instruction with opcode opc. Patterns starting with OPC_ANY appear
+// in every list, and those needing P2 are left out of the P1 lists.
+// Opcodes from OPC_GENERIC on all share the last list, so patterns
+// starting with one of those are put there.
+//
+#define PEEP2_SLOTS ((unsigned)OPC_GENERIC + 1)
+
+static unsigned short peep2Index[2][PEEP2_SLOTS + 1];
+static unsigned short *peep2Cand;
+
+// statistics, kept only with --verbose
+typedef struct Peep2Stats {
+    unsigned tried;     // number of instructions the pattern was checked at
+    unsigned matched;   // number of matches
+    unsigned applied;   // number of matches where the replacement was made
+} Peep2Stats;
+
+static Peep2Stats peep2Stats[NUM_PEEP2];
+
+static bool
+PatternNeedsP2(PeepholePattern *patrn)
+{
+    for (; patrn->flags != PEEP_FLAGS_DONE; patrn++) {
+        if (patrn->flags & PEEP_FLAGS_P2) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool
+PatternMayStart(PeepholePattern *patrn, unsigned slot)
+{
+    if (patrn->opc == OPC_ANY) {
+        return true;
+    }
+    if (patrn->opc >= (int)OPC_GENERIC) {
+        return slot == (unsigned)OPC_GENERIC;
+    }
+    return patrn->opc == (int)slot;
+}
+
+// build the pattern index; called once before any optimization
+void
+InitPeepholes(void)
+{
+    unsigned p2, slot, i, n;
+
+    if (peep2Cand) return;
+    for (i = 0; i < NUM_PEEP2; i++) {
+        if (peep2[i].check->opc < 0 && peep2[i].check->opc != OPC_ANY) {
+            fprintf(stderr, "Internal error: peephole %s cannot be indexed\n", peep2[i].name);
+            abort();
+        }
+    }
+    n = 0;
+    for (p2 = 0; p2 < 2; p2++) {
+        for (slot = 0; slot < PEEP2_SLOTS; slot++) {
+            for (i = 0; i < NUM_PEEP2; i++) {
+                if (PatternMayStart(peep2[i].check, slot) && (p2 || !PatternNeedsP2(peep2[i].check))) {
+                    n++;
+                }
+            }
+        }
+    }
+    // both the pattern numbers and the index have to fit in 16 bits
+    if (NUM_PEEP2 > USHRT_MAX + 1 || n > USHRT_MAX) {
+        fprintf(stderr, "Internal error: too many peephole patterns\n");
+        abort();
+    }
+    peep2Cand = (unsigned short *)malloc((n ? n : 1) * sizeof(*peep2Cand));
+    if (!peep2Cand) {
+        fprintf(stderr, "FATAL: out of memory\n");
+        exit(2);
+    }
+    n = 0;
+    for (p2 = 0; p2 < 2; p2++) {
+        for (slot = 0; slot < PEEP2_SLOTS; slot++) {
+            peep2Index[p2][slot] = n;
+            for (i = 0; i < NUM_PEEP2; i++) {
+                if (PatternMayStart(peep2[i].check, slot) && (p2 || !PatternNeedsP2(peep2[i].check))) {
+                    peep2Cand[n++] = i;
+                }
+            }
+        }
+        peep2Index[p2][PEEP2_SLOTS] = n;
+    }
+}
+
+// print the peep2 statistics (with --verbose=2)
+void
+ReportPeepholeStats(void)
+{
+    unsigned i;
+
+    if (gl_verbosity <= 1) return;
+    for (i = 0; i < NUM_PEEP2; i++) {
+        Peep2Stats *st = &peep2Stats[i];
+        if (!st->tried) continue;
+        DEBUG(NULL, "peephole %s: tried %u, rejected %u, matched %u, applied %u",
+              peep2[i].name, st->tried, st->tried - st->matched, st->matched, st->applied);
+    }
+}
+
 static int OptimizePeephole2(IRList *irl)
 {
     IR *ir;
     int change = 0;
-    int i, r;
+    int r;
+    unsigned slot, k, kend, i;
+    unsigned p2 = gl_p2 ? 1 : 0;
+    bool stats = gl_verbosity > 1;
 
     ir = irl->head;
     for(;;) {
@@ -5486,10 +6428,25 @@ static int OptimizePeephole2(IRList *irl)
         }
         if (!ir) break;
         if (!InstrIsVolatile(ir)) {
-            for (i = 0; i < sizeof(peep2) / sizeof(peep2[0]); i++) {
+            slot = (unsigned)ir->opc;
+            if (slot >= (unsigned)OPC_GENERIC) {
+                slot = OPC_GENERIC;
+            }
+            kend = peep2Index[p2][slot+1];
+            for (k = peep2Index[p2][slot]; k < kend; k++) {
+                i = peep2Cand[k];
+                if (stats) {
+                    __sync_fetch_and_add(&peep2Stats[i].tried, 1);
+                }
                 r = MatchPattern(peep2[i].check, ir);
                 if (r) {
                     r = (*peep2[i].replace)(peep2[i].arg, irl, ir);
+                    if (stats) {
+                        __sync_fetch_and_add(&peep2Stats[i].matched, 1);
+                        if (r) {
+                            __sync_fetch_and_add(&peep2Stats[i].applied, 1);
+                        }
+                    }
                     if (r) {
                         change++;
                     }
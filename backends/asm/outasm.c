@@ -93,6 +93,9 @@ static Operand *heaplabel;
 static Operand *hubexit;
 static Operand *cogexit;
 
+/* first instruction of the startup code which loads LUT, if any */
+static IR *lutload;
+
 static Operand *kernelptr;
 
 static Operand *CompileExpression(IRList *irl, AST *expr, Operand *dest);
@@ -110,6 +113,7 @@ static void EmitBuiltins(IRList *irl);
 static void CompileConsts(IRList *irl, AST *consts);
 static Operand *EmitAddSub(IRList *irl, Operand *dst, int off);
 static Operand *SizedHubMemRef(int size, Operand *addr, int offset);
+Operand *NewFunctionTempRegister();
 Operand *CogMemRef(Operand *addr, int offset);
 static Operand *ApplyArrayIndex(IRList *irl, Operand *base, Operand *offset, int size);
 
@@ -244,8 +248,6 @@ IdentifierModuleName(Module *P, const char *name)
     return strdup(temp);
 }
 
-Operand *GetLocalReg(int n, int isLeaf); // forward declaration
-
 static bool
 PutVarOnStack(Function *func, Symbol *sym, int size)
 {
@@ -378,12 +380,19 @@ static int IsMemRef(Operand *op)
 static Operand *
 GetSizedVar(struct flexbuf *fb, Operandkind kind, const char *name, intptr_t value, int count)
 {
-  size_t siz = flexbuf_curlen(fb) / sizeof(AsmVariable);
+  size_t siz;
   size_t i;
   AsmVariable tmp;
-  AsmVariable *g = (AsmVariable *)flexbuf_peek(fb);
+  AsmVariable *g;
+
+  // the optimizer may get here (via NewImmediate) from several threads
+  jobs_lock();
+  siz = flexbuf_curlen(fb) / sizeof(AsmVariable);
+  g = (AsmVariable *)flexbuf_peek(fb);
+  // every name in the list was interned, so comparing pointers suffices
+  name = InternString(name);
   for (i = 0; i < siz; i++) {
-    if (strcmp(name, g[i].op->name) == 0) {
+    if (name == g[i].op->name) {
         if (g[i].val != value) {
             if ( (kind == REG_HUBPTR || kind == REG_COGPTR)
                  && kind == g[i].op->kind
@@ -398,13 +407,15 @@ GetSizedVar(struct flexbuf *fb, Operandkind kind, const char *name, intptr_t val
         if (g[i].count < count) {
             g[i].count = count;
         }
-      return g[i].op;
+        jobs_unlock();
+        return g[i].op;
     }
   }
   tmp.op = NewOperand(kind, name, value);
   tmp.val = value;
   tmp.count = count;
   flexbuf_addmem(fb, (const char *)&tmp, sizeof(tmp));
+  jobs_unlock();
   return tmp.op;
 }
 
@@ -422,6 +433,78 @@ Operand *GetOneHub(Operandkind kind, const char *name, intptr_t value)
     return GetSizedVar(&hubGlobalVars, kind, name, value, 1);
 }
 
+//
+// --profile-gen support: the counters live in a hub array, and their
+// names (each followed by a 0 byte, with an extra 0 at the end) in a
+// string; _profile_dump gets at both through these registers
+//
+Operand *profilecountsptr;
+Operand *profilenamesptr;
+static AST *profilenames, *profilenametail;
+static int profilecounters;
+
+void
+ValidateProfileptrs(void)
+{
+    Operand *counts, *names;
+
+    if (profilecountsptr) {
+        return;
+    }
+    profilenames = profilenametail = NewAST(AST_EXPRLIST, NULL, NULL);
+    counts = GetSizedVar(&hubGlobalVars, LONG_DEF, "__profile_counts", 0, LONG_SIZE);
+    names = GetOneHub(STRING_DEF, "__profile_names", (intptr_t)profilenames);
+    profilecountsptr = NewImmediatePtr("__profile_counts_ptr",
+                                       NewOperand(IMM_HUB_LABEL, counts->name, 0));
+    profilenamesptr = NewImmediatePtr("__profile_names_ptr", names);
+}
+
+static void AddProfileName(AST *item)
+{
+    if (!profilenametail->left) {
+        profilenametail->left = item;
+    } else {
+        profilenametail->right = NewAST(AST_EXPRLIST, item, NULL);
+        profilenametail = profilenametail->right;
+    }
+}
+
+// emit code to increment the profile counter called "name"
+static void
+EmitProfileCounter(IRList *irl, const char *name)
+{
+    Operand *counter;
+    Operand *temp;
+
+    ValidateProfileptrs();
+    counter = SizedHubMemRef(LONG_SIZE, profilecountsptr, LONG_SIZE * profilecounters);
+    profilecounters++;
+    GetSizedVar(&hubGlobalVars, LONG_DEF, "__profile_counts", 0, LONG_SIZE * profilecounters);
+    AddProfileName(AstPlainString(name));
+    AddProfileName(AstInteger(0));
+
+    temp = NewFunctionTempRegister();
+    EmitMove(irl, temp, counter);
+    EmitOp2(irl, OPC_ADD, temp, NewImmediate(1));
+    EmitMove(irl, counter, temp);
+}
+
+// give the loop starting at "label" a profile name, and count its trips
+// if we are profiling
+static void
+EmitProfileLoop(IRList *irl, Operand *label)
+{
+    const char *name;
+
+    if (!gl_profile_gen && !gl_profile_use) {
+        return;
+    }
+    name = ProfileLoopName(curfunc, label);
+    if (gl_profile_gen && curfunc->module != systemModule) {
+        EmitProfileCounter(irl, name);
+    }
+}
+
 Operand *GetResultReg(int n)
 {
     static char rvalname[32];
@@ -537,6 +620,7 @@ IR *NewIR(IROpcode kind)
 {
     IR *ir = (IR *)malloc(sizeof(*ir));
     memset(ir, 0, sizeof(*ir));
+    timereport_alloc(sizeof(*ir));
     ir->opc = kind;
     ir->instr = FindInstrForOpc(kind);
     return ir;
@@ -822,10 +906,18 @@ void EmitNamedCogLabel(IRList *irl, const char *name)
     }
 }
 
+// while functions are being optimized in parallel, each one numbers
+// the labels it creates itself, so the names do not depend on timing
+static THREAD_LOCAL const char *labelPrefix;
+static THREAD_LOCAL int labelCounter;
+
 // create a new temporary label name
 char *
 NewTempLabelName()
 {
+    if (labelPrefix) {
+        return NewTemporaryVariable(labelPrefix, &labelCounter);
+    }
     return NewTemporaryVariable("L_", NULL);
 }
 
@@ -1605,11 +1697,12 @@ RenameSubregs(IRList *irl, Operand *base, int numlocals, int isLeaf)
  */
 
 static int
-RenameLocalRegs(IRList *irl, int isLeaf)
+RenameLocalRegs(IRList *irl, Function *func, int isLeaf)
 {
     IR *ir;
     Operand *replace = NULL;
     int numlocals = 0;
+    int n;
 
     /* first, look for any subregisters; if found, rename those
      * in a way that guarantees the arrays stay in order
@@ -1622,6 +1715,15 @@ RenameLocalRegs(IRList *irl, int isLeaf)
             numlocals += RenameSubregs(irl, (Operand *)ir->src->name, numlocals, isLeaf);
         }
     }
+    /* now share registers between locals that are never live at the
+     * same time, if we can
+     */
+    if (func->optimize_flags & OPT_BASIC_REGS) {
+        n = AllocateLocalRegs(irl, func, numlocals, isLeaf);
+        if (n >= 0) {
+            return n;
+        }
+    }
     for (ir = irl->head; ir; ir = ir->next) {
         if (IsDummy(ir)) continue;
         if (ir->dst && IsLocal(ir->dst)) {
@@ -1747,7 +1849,7 @@ static void EmitFunctionHeader(IRList *irl, Function *func)
     needFrame = NeedFramePointer(func);
     if (needFrame == FRAME_YES || needFrame == FRAME_MAYBE) {
         if (NeedToSaveLocals(func)) {
-            n = RenameLocalRegs(FuncIRL(func), IS_LEAF(func));
+            n = RenameLocalRegs(FuncIRL(func), func, IS_LEAF(func));
         } else {
             MarkUsedSubregs(FuncIRL(func));
         }
@@ -1772,7 +1874,7 @@ static void EmitFunctionHeader(IRList *irl, Function *func)
             EmitMove(irl, frameptr, stackptr);
         }
     } else if (IS_LEAF(func)) {
-        RenameLocalRegs(FuncIRL(func), 1);
+        RenameLocalRegs(FuncIRL(func), func, 1);
     }
     if (ANY_VARS_ON_STACK(func)) {
         int localsize;
@@ -4472,6 +4574,7 @@ static void CompileForLoop(IRList *irl, AST *ast, int atleastonce)
         loopcond = AstInteger(1);
     }
     EmitLabel(irl, toplabel);
+    EmitProfileLoop(irl, toplabel);
     if (!atleastonce) {
         CompileBoolBranches(irl, loopcond, NULL, exitlabel);
     }
@@ -4706,6 +4809,7 @@ static void CompileStatement(IRList *irl, AST *ast)
 	botloop = NewCodeLabel();
 	PushQuitNext(botloop, toploop);
 	EmitLabel(irl, toploop);
+        EmitProfileLoop(irl, toploop);
         CompileBoolBranches(irl, ast->left, NULL, botloop);
 	FreeTempRegisters(irl, starttempreg);
         CompileStatementList(irl, ast->right);
@@ -4719,6 +4823,7 @@ static void CompileStatement(IRList *irl, AST *ast)
 	exitloop = NewCodeLabel();
 	PushQuitNext(exitloop, botloop);
 	EmitLabel(irl, toploop);
+        EmitProfileLoop(irl, toploop);
         CompileStatementList(irl, ast->right);
 	EmitLabel(irl, botloop);
         CompileBoolBranches(irl, ast->left, toploop, NULL);
@@ -4885,10 +4990,11 @@ static void CompileStatement(IRList *irl, AST *ast)
 
 /*
  * compile just the body of a function, and put it
- * in an IRL for that function
+ * in an IRL for that function; if "optimize" is false the
+ * caller will run OptimizeIRLocal on it later
  */
 static void
-CompileFunctionBody(Function *f)
+CompileFunctionBody(Function *f, bool optimize)
 {
     IRList *irl = FuncIRL(f);
     IRList *irheader = &FuncData(f)->irheader;
@@ -4902,6 +5008,9 @@ CompileFunctionBody(Function *f)
         return;
     }
     EmitFunctionProlog(irl, f);
+    if (gl_profile_gen && f->module != systemModule) {
+        EmitProfileCounter(irl, FuncData(f)->asmname->name);
+    }
     // emit initializations if any required
     if (f->resultexpr && !IsConstExpr(f->resultexpr))
     {
@@ -4926,7 +5035,9 @@ CompileFunctionBody(Function *f)
     }
     CompileStatementList(irl, f->body);
     EmitFunctionEpilog(irl, f);
-    OptimizeIRLocal(irl, f);
+    if (optimize) {
+        OptimizeIRLocal(irl, f);
+    }
 }
 
 /*
@@ -5118,6 +5229,7 @@ AssignOneFuncName(Function *f)
     }
     curfunc = f;
     {
+        bool autoPlace = (f->code_placement == CODE_PLACE_DEFAULT);
         // at one time we also forced the global module stuff into
         // COG memory, so we still have the capability to put code
         // into COG on a per-function basis; may be useful later
@@ -5142,6 +5254,7 @@ AssignOneFuncName(Function *f)
             sprintf(fentername, "%s_enter", fname);
         }
         f->bedata = calloc(1, sizeof(IRFuncData));
+        FuncData(f)->autoPlace = autoPlace;
 
         // figure out calling convention
         if (0 && f->local_address_taken) {
@@ -5224,23 +5337,86 @@ AssignFuncNames(void *vptr, Module *P)
     return 0;
 }
 
+// a function whose optimization has been put off; compiling later
+// functions may change callSites, so we remember the value the inlining
+// decision would have seen if it had been made right away
+typedef struct DeferredFunc {
+    Function *f;
+    int callSites;
+} DeferredFunc;
+
+// if vptr is not NULL it is a flexbuf to which the functions are
+// added, to be optimized later by OptimizeFunctions
 static int
 CompileFunc_internal(void *vptr, Module *P)
 {
+    struct flexbuf *deferred = (struct flexbuf *)vptr;
     Function *savecurf = curfunc;
     Function *f;
+    struct timespan span;
     
     for(f = P->functions; f; f = f->next) {
       if (ShouldSkipFunction(f))
           continue;
       curfunc = f;
-      CompileFunctionBody(f);
-      FuncData(f)->isInline = ShouldBeInlined(f);
+      timereport_begin(&span, "CompileToIR", f->name);
+      CompileFunctionBody(f, deferred == NULL);
+      timereport_end(&span, 0);
+      if (deferred) {
+          DeferredFunc d;
+          d.f = f;
+          d.callSites = f->callSites;
+          flexbuf_addmem(deferred, (const char *)&d, sizeof(d));
+      } else {
+          FuncData(f)->isInline = ShouldBeInlined(f);
+      }
     }
     curfunc = savecurf;
     return 0;
 }
 
+static void
+OptimizeFunctionJob(void *arg, int i)
+{
+    Function *f = ((DeferredFunc *)arg)[i].f;
+    char *prefix = strdupcat("L__", FuncData(f)->asmname->name);
+
+    curfunc = f;
+    labelPrefix = prefix;
+    labelCounter = 1;
+    OptimizeIRLocal(FuncIRL(f), f);
+    labelPrefix = NULL;
+    curfunc = NULL;
+    free(prefix);
+}
+
+//
+// run the local optimizer over the functions collected by
+// CompileFunc_internal, using gl_jobs threads; the functions are
+// independent at this point, and everything the optimizer shares
+// between them is protected by jobs_lock()
+//
+static void
+OptimizeFunctions(struct flexbuf *funcs)
+{
+    DeferredFunc *list = (DeferredFunc *)flexbuf_peek(funcs);
+    int n = flexbuf_curlen(funcs) / sizeof(DeferredFunc);
+    Function *savecurf = curfunc;
+    Function *f;
+    int callSites;
+    int i;
+
+    jobs_run(gl_jobs, n, OptimizeFunctionJob, (void *)list);
+    for (i = 0; i < n; i++) {
+        f = curfunc = list[i].f;
+        callSites = f->callSites;
+        f->callSites = list[i].callSites;
+        FuncData(f)->isInline = ShouldBeInlined(f);
+        f->callSites = callSites;
+    }
+    curfunc = savecurf;
+}
+
 static int
 ExpandInline_internal(void *vptr, Module *P)
 {
@@ -5282,13 +5458,29 @@ void
 CompileIntermediate(Module *P)
 {
     int change;
+    unsigned long passes = 0;
+    struct timespan span;
+
     InitAsmCode();
     
     VisitRecursive(NULL, P, AssignFuncNames, VISITFLAG_FUNCNAMES);
-    VisitRecursive(NULL, P, CompileFunc_internal, VISITFLAG_COMPILEFUNCS);
+    if (gl_jobs > 1) {
+        struct flexbuf funcs;
+
+        flexbuf_init(&funcs, 1024);
+        VisitRecursive(&funcs, P, CompileFunc_internal, VISITFLAG_COMPILEFUNCS);
+        OptimizeFunctions(&funcs);
+        flexbuf_delete(&funcs);
+    } else {
+        VisitRecursive(NULL, P, CompileFunc_internal, VISITFLAG_COMPILEFUNCS);
+    }
+    timereport_begin(&span, "ExpandInlines", P->fullname);
     do {
         change = VisitRecursive(NULL, P, ExpandInline_internal, VISITFLAG_EXPANDINLINE);
+        passes++;
     } while (change);
+    timereport_end(&span, passes);
+    ReportPeepholeStats();
 }
 
 static int
@@ -5354,6 +5546,338 @@ CompileToIR_hub(IRList *irl, Module *P)
     
     return gl_errors == 0;
 }
+
+/*
+ * automatic placement of hot leaf functions into LUT (P2 only)
+ *
+ * this runs after all the functions have been compiled and optimized,
+ * so we know how big they are; a leaf function compiled for hub
+ * differs from the LUT version only in the kind of its labels, so
+ * moving it is just a matter of relabeling
+ */
+#define AUTO_LUT_LONGS      256  /* loaded from lutentry at startup */
+#define AUTO_LUT_SLACK      16   /* margin for errors in our size estimate */
+#define AUTO_LUT_LOOP_TRIPS 8    /* guess at iterations of a loop */
+#define AUTO_LUT_MAX_DEPTH  4
+#define HUBEXEC_BRANCH_COST 13   /* extra cycles for a branch in hubexec */
+
+typedef struct LutCandidate {
+    Function *f;
+    int size;                 /* in longs */
+    unsigned long calls;      /* profile count, or a static guess */
+    unsigned long savedPerCall;
+    bool profiled;
+    bool chosen;
+} LutCandidate;
+
+//
+// check whether we can move functions into LUT at all; this has to
+// be decided before the main stub (which loads the LUT) is emitted
+//
+static bool
+AutoLutEnabled(int outputMain)
+{
+    Module *Q;
+    Function *pf;
+
+    if (!gl_p2 || COG_CODE || !outputMain || gl_output == OUTPUT_COGSPIN) {
+        return false;
+    }
+    if (!(gl_optimize_flags & OPT_AUTO_LUT)) {
+        return false;
+    }
+    // the user is managing LUT, or wants the counts from an unchanged build
+    if (gl_have_lut || gl_brkdebug || gl_compress || gl_profile_gen) {
+        return false;
+    }
+    // only the main COG loads the LUT
+    for (Q = allparse; Q; Q = Q->next) {
+        for (pf = Q->functions; pf; pf = pf->next) {
+            if (pf->cog_task) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static bool
+IsLocalLabel(IRList *irl, Operand *op)
+{
+    IR *ir;
+    if (op->kind != IMM_HUB_LABEL && op->kind != IMM_COG_LABEL) {
+        return false;
+    }
+    for (ir = irl->head; ir; ir = ir->next) {
+        if (ir->opc == OPC_LABEL && ir->dst == op) {
+            return true;
+        }
+    }
+    return false;
+}
+
+//
+// find the size in longs of a function if it were moved into LUT,
+// and count its branches; returns -1 if it cannot be moved
+//
+static int
+LutCandidateSize(Function *f, int *fwdBranches, int *backBranches)
+{
+    IRList *irl = FuncIRL(f);
+    IR *ir, *lab;
+    Operand *dst;
+    int size = 1; // for the final ret
+
+    *fwdBranches = *backBranches = 0;
+    for (ir = irl->head; ir; ir = ir->next) {
+        switch (ir->opc) {
+        case OPC_CALL:
+        case OPC_JMPRET:
+        case OPC_JMPREL:
+        case OPC_GENERIC_BRANCH:
+        case OPC_GENERIC_BRCOND:
+        case OPC_LITERAL:
+        case OPC_FCACHE:
+            return -1;
+        case OPC_LABEL:
+            continue;
+        default:
+            break;
+        }
+        if (IsDummy(ir) || ir->opc == OPC_LIVE) {
+            continue;
+        }
+        if (ir->opc >= OPC_PUSH_REGS) {
+            // data or assembler directives
+            return -1;
+        }
+        if (ir->opc == OPC_JUMP || ir->opc == OPC_DJNZ) {
+            dst = JumpDest(ir);
+            if (dst == FuncData(f)->asmretname) {
+                (*fwdBranches)++;
+            } else if (!dst || !IsLocalLabel(irl, dst)) {
+                // tail call, or something we do not understand
+                return -1;
+            } else {
+                for (lab = ir->prev; lab; lab = lab->prev) {
+                    if (lab->opc == OPC_LABEL && lab->dst == dst) break;
+                }
+                if (lab) {
+                    (*backBranches)++;
+                } else {
+                    (*fwdBranches)++;
+                }
+            }
+        } else if ( (ir->dst && IsLocalLabel(irl, ir->dst))
+                    || (ir->src && IsLocalLabel(irl, ir->src)) )
+        {
+            // uses a code address as data
+            return -1;
+        }
+        size++;
+        if (IsAugImmediate(ir->src)) size++;
+        if (IsAugImmediate(ir->dst)) size++;
+    }
+    return size;
+}
+
+//
+// add up how often the candidates are called from function f,
+// weighting calls inside loops by how deeply nested they are
+//
+static void
+CountLutCalls(Function *f, LutCandidate *cand, int ncand)
+{
+    IRList *irl = FuncIRL(f);
+    IR *ir, *lab;
+    IR **code;
+    int *depth;
+    int n, i, j, k;
+    unsigned long weight;
+
+    n = 0;
+    for (ir = irl->head; ir; ir = ir->next) n++;
+    if (n == 0) return;
+    code = (IR **)calloc(n, sizeof(*code));
+    depth = (int *)calloc(n, sizeof(*depth));
+    n = 0;
+    for (ir = irl->head; ir; ir = ir->next) {
+        code[n++] = ir;
+    }
+    // every backward jump marks a loop from its label down to itself
+    for (j = 0; j < n; j++) {
+        ir = code[j];
+        if (!(ir->opc == OPC_JUMP || ir->opc == OPC_DJNZ) || !JumpDest(ir)) {
+            continue;
+        }
+        for (i = j-1; i >= 0; --i) {
+            lab = code[i];
+            if (lab->opc == OPC_LABEL && lab->dst == JumpDest(ir)) break;
+        }
+        for (k = i; i >= 0 && k <= j; k++) {
+            depth[k]++;
+        }
+    }
+    for (j = 0; j < n; j++) {
+        ir = code[j];
+        if (ir->opc != OPC_CALL && ir->opc != OPC_JUMP) continue;
+        for (i = 0; i < ncand; i++) {
+            if (ir->dst == FuncData(cand[i].f)->asmname) break;
+        }
+        if (i == ncand) continue;
+        weight = 1;
+        for (k = 0; k < depth[j] && k < AUTO_LUT_MAX_DEPTH; k++) {
+            weight *= AUTO_LUT_LOOP_TRIPS;
+        }
+        cand[i].calls += weight;
+    }
+    free(depth);
+    free(code);
+}
+
+static void
+MoveFunctionToLut(Function *f)
+{
+    IR *ir;
+
+    f->code_placement = CODE_PLACE_LUT;
+    gl_have_lut++;
+    FuncData(f)->asmname->kind = IMM_COG_LABEL;
+    FuncData(f)->asmretname->kind = IMM_COG_LABEL;
+    FuncData(f)->asmreturnlabel->kind = IMM_COG_LABEL;
+    for (ir = FuncIRL(f)->head; ir; ir = ir->next) {
+        if (ir->opc == OPC_LABEL && ir->dst->kind == IMM_HUB_LABEL) {
+            ir->dst->kind = IMM_COG_LABEL;
+        }
+    }
+}
+
+//
+// pick the leaf functions which save the most cycles by running from
+// LUT instead of hub, and move them there
+//
+static void
+PlaceHotFunctions(Module *P)
+{
+    struct flexbuf cb;
+    LutCandidate c, *cand;
+    int ncand;
+    Module *Q;
+    Function *f;
+    int fwd, back;
+    int capacity = AUTO_LUT_LONGS - AUTO_LUT_SLACK;
+    unsigned long long *best;
+    unsigned char *keep;
+    unsigned long long gain;
+    unsigned long long total = 0;
+    int i, w, used;
+
+    flexbuf_init(&cb, 256);
+    for (Q = allparse; Q; Q = Q->next) {
+        if (Q == systemModule) {
+            // library code is never compiled into LUT
+            continue;
+        }
+        for (f = Q->functions; f; f = f->next) {
+            if (ShouldSkipFunction(f) || !FuncData(f) || !FuncData(f)->autoPlace) {
+                continue;
+            }
+            if (FuncData(f)->isInline || f->toplevel || f->used_as_ptr
+                || f->is_recursive || !IS_LEAF(f) || ANY_VARS_ON_STACK(f)
+                || f->sets_send || f->sets_recv || f->closure)
+            {
+                continue;
+            }
+            memset(&c, 0, sizeof(c));
+            c.f = f;
+            c.size = LutCandidateSize(f, &fwd, &back);
+            if (c.size < 0 || c.size > capacity) {
+                continue;
+            }
+            // in hub every taken branch (including the call itself)
+            // has to refill the FIFO; assume half the forward branches
+            // are taken and loops go round a few times
+            c.savedPerCall = HUBEXEC_BRANCH_COST * (1 + (fwd+1)/2 + back * AUTO_LUT_LOOP_TRIPS);
+            c.profiled = ProfileFuncCount(f, &c.calls);
+            flexbuf_addmem(&cb, (const char *)&c, sizeof(c));
+        }
+    }
+    cand = (LutCandidate *)flexbuf_peek(&cb);
+    ncand = flexbuf_curlen(&cb) / sizeof(LutCandidate);
+    if (ncand == 0) {
+        flexbuf_delete(&cb);
+        return;
+    }
+    // static call counts for the ones the profile does not know about
+    for (Q = allparse; Q; Q = Q->next) {
+        for (f = Q->functions; f; f = f->next) {
+            if (!ShouldSkipFunction(f) && FuncData(f)) {
+                CountLutCalls(f, cand, ncand);
+            }
+        }
+    }
+    for (i = 0; i < ncand; i++) {
+        if (cand[i].profiled) {
+            // CountLutCalls added in some static counts, which we
+            // do not need
+            ProfileFuncCount(cand[i].f, &cand[i].calls);
+        }
+    }
+
+    // 0/1 knapsack over the LUT space
+    best = (unsigned long long *)calloc((ncand+1) * (capacity+1), sizeof(*best));
+    keep = (unsigned char *)calloc((ncand+1) * (capacity+1), 1);
+#define BEST(i, w) best[(i)*(capacity+1) + (w)]
+#define KEEP(i, w) keep[(i)*(capacity+1) + (w)]
+    for (i = 1; i <= ncand; i++) {
+        gain = (unsigned long long)cand[i-1].calls * cand[i-1].savedPerCall;
+        for (w = 0; w <= capacity; w++) {
+            BEST(i, w) = BEST(i-1, w);
+            if (gain > 0 && cand[i-1].size <= w
+                && BEST(i-1, w - cand[i-1].size) + gain > BEST(i, w))
+            {
+                BEST(i, w) = BEST(i-1, w - cand[i-1].size) + gain;
+                KEEP(i, w) = 1;
+            }
+        }
+    }
+    w = capacity;
+    for (i = ncand; i > 0; --i) {
+        if (KEEP(i, w)) {
+            cand[i-1].chosen = true;
+            w -= cand[i-1].size;
+        }
+    }
+#undef BEST
+#undef KEEP
+    free(keep);
+    free(best);
+
+    used = 0;
+    for (i = 0; i < ncand; i++) {
+        if (!cand[i].chosen) continue;
+        f = cand[i].f;
+        MoveFunctionToLut(f);
+        used += cand[i].size;
+        if (cand[i].profiled) {
+            gain = (unsigned long long)cand[i].calls * cand[i].savedPerCall;
+            total += gain;
+            DEBUG(f->body, "moved %s to LUT (%d longs); saves about %lu cycles per call, %llu in the profiled run",
+                  f->name, cand[i].size, cand[i].savedPerCall, gain);
+        } else {
+            DEBUG(f->body, "moved %s to LUT (%d longs); saves about %lu cycles per call",
+                  f->name, cand[i].size, cand[i].savedPerCall);
+        }
+    }
+    if (used) {
+        if (total) {
+            DEBUG(NULL, "automatic LUT placement used %d of %d longs, saving about %llu cycles in the profiled run", used, AUTO_LUT_LONGS, total);
+        } else {
+            DEBUG(NULL, "automatic LUT placement used %d of %d longs", used, AUTO_LUT_LONGS);
+        }
+    }
+    flexbuf_delete(&cb);
+}
 /*
  * emit builtin functions like mul and div
  */
@@ -5949,6 +6473,26 @@ EmitVarSection(IRList *irl, Module *P)
     return 0;
 }
 
+// with --profile-gen, print the counters after the main program returns
+static void
+EmitProfileDump(IRList *irl)
+{
+    Symbol *sym;
+    Function *dumpf;
+
+    if (!gl_profile_gen) {
+        return;
+    }
+    sym = FindSymbol(&systemModule->objsyms, "_profile_dump");
+    if (!sym || sym->kind != SYM_FUNCTION) {
+        ERROR(NULL, "Internal error could not find _profile_dump");
+        return;
+    }
+    dumpf = (Function *)sym->val;
+    FuncData(dumpf)->actual_callsites++;
+    EmitOp1(irl, OPC_CALL, GetSystemFunction("_profile_dump"));
+}
+
 /*
  * emit a small main program
  * it looks something like:
@@ -6033,6 +6577,7 @@ EmitMain_P1(IRList *irl, Module *P)
     } else {
         EmitOp1(irl, OPC_CALL, NewOperand(IMM_HUB_LABEL, firstfuncname, 0));
     }
+    EmitProfileDump(irl);
     EmitLabel(irl, cogexit);
     EmitOp1(irl, OPC_COGID, arg1);
     EmitOp1(irl, OPC_COGSTOP, arg1);
@@ -6140,7 +6685,7 @@ EmitMain_P2(IRList *irl, Module *P, Operand *lutstart)
 
     // force LUT code, if any, to be loaded
     if (lutstart) {
-        ir = EmitOp2(irl, OPC_MOV, pa_reg, lutstart);
+        ir = lutload = EmitOp2(irl, OPC_MOV, pa_reg, lutstart);
         EmitOp1(irl, OPC_SETQ2, NewImmediate(255));
         EmitOp2(irl, OPC_RDLONG, NewOperand(REG_HW, "0", 0), pa_reg);
     }
@@ -6149,6 +6694,7 @@ EmitMain_P2(IRList *irl, Module *P, Operand *lutstart)
     } else {
         EmitOp1(irl, OPC_CALL, NewOperand(IMM_HUB_LABEL, firstfuncname, 0));
     }
+    EmitProfileDump(irl);
     EmitLabel(irl, cogexit);
     EmitOp1(irl, OPC_WAITX, NewImmediate(160000)); // 1 ms delay at 160 MHz
     EmitOp1(irl, OPC_COGID, arg1);
@@ -6277,6 +6823,7 @@ InitAsmCode()
     if (initDone) return;
 
     newlineOp = NewOperand(IMM_STRING, "\n", 0);
+    InitPeepholes();
     initDone = 1;
 }
 
@@ -6307,16 +6854,19 @@ CompileSystemModule(IRList *where, Module *M, int flag)
     VisitRecursive(where, M, CompileToIR_internal, flag);
 }
 
+static void WriteAsmText(const char *fname, const char *asmcode);
+
 void
 OutputAsmCode(const char *fname, Module *P, int outputMain)
 {
-    FILE *f = NULL;
     Module *save;
     IR *orgh = NULL;
     Operand *entrylabel = NewOperand(IMM_COG_LABEL, ENTRYNAME, 0);
     Operand *lutstart = NULL;
     Operand *cog_bss_start = NewOperand(IMM_COG_LABEL, "COG_BSS_START", 0);
     bool emitSpinCode = true;
+    bool autoLut;
+    struct timespan span;
     
     const char *asmcode;
     int maxargs = 2; // initialization code wants 2 arguments
@@ -6337,6 +6887,7 @@ OutputAsmCode(const char *fname, Module *P, int outputMain)
         }
     }
     InitAsmCode();
+    autoLut = emitSpinCode && AutoLutEnabled(outputMain);
     CompileIntermediate(systemModule);
     
     memset(&cogcode, 0, sizeof(cogcode));
@@ -6427,7 +6978,8 @@ OutputAsmCode(const char *fname, Module *P, int outputMain)
     if (emitSpinCode) {
         // output the main stub
         EmitLabel(&cogcode, entrylabel);
-        if (gl_have_lut) {
+        lutload = NULL;
+        if (gl_have_lut || autoLut) {
             lutstart = NewOperand(STRING_DEF, "lutentry", 0);
             EmitOp1(&lutcode, OPC_ORG, NewImmediate(0x200));
             EmitLabel(&lutcode, lutstart);
@@ -6443,6 +6995,19 @@ OutputAsmCode(const char *fname, Module *P, int outputMain)
         }
         // generate code for inlining
         CompileIntermediate(P);
+        if (autoLut) {
+            PlaceHotFunctions(P);
+            if (!gl_have_lut && lutstart) {
+                // nothing was moved, so there is no LUT to load
+                if (lutload) {
+                    DeleteIR(&cogcode, lutload->next->next);
+                    DeleteIR(&cogcode, lutload->next);
+                    DeleteIR(&cogcode, lutload);
+                }
+                memset(&lutcode, 0, sizeof(lutcode));
+                lutstart = NULL;
+            }
+        }
         // compile COG functions
         if (!CompileToIR_cog(&cogcode, P)) {
             return;
@@ -6484,16 +7049,21 @@ OutputAsmCode(const char *fname, Module *P, int outputMain)
 
     if (emitSpinCode) {
         // add LUT checks
-        if (gl_have_lut) {
+        if (lutstart) {
             EmitOp1(&lutcode, OPC_FIT, NewImmediate(0x300));
             AppendIR(&hubcode, lutcode.head);
         }
         AppendIR(&cogcode, hubcode.head);
 
         // we have to optimize all code before emitting any variables
+        timereport_begin(&span, "OptimizeIRGlobal", NULL);
         OptimizeIRGlobal(&cogcode);
+        timereport_end(&span, 0);
 
         // cog data
+        if (profilenames && !profilenames->left) {
+            profilenames->left = AstInteger(0);
+        }
         EmitGlobals(&cogdata, &cogbss, &hubdata);
     
         // COG bss
@@ -6568,10 +7138,29 @@ OutputAsmCode(const char *fname, Module *P, int outputMain)
     AppendIR(&cogcode, cogbss.head);
 
     // and assemble the result
+    if (!fname) {
+        // the caller will use AssembleAsmCode to assemble it directly
+        current = save;
+        return;
+    }
+    timereport_begin(&span, "IRAssemble", NULL);
     asmcode = IRAssemble(&cogcode, P);
+    timereport_end(&span, 0);
+    if (gl_cycle_report && emitSpinCode) {
+        // after IRAssemble, so labels match the listing
+        OutputCycleReport(ReplaceExtension(fname, ".cycles.json"), &cogcode);
+    }
     
     current = save;
 
+    WriteAsmText(fname, asmcode);
+}
+
+static void
+WriteAsmText(const char *fname, const char *asmcode)
+{
+    FILE *f;
+
     f = fopen(fname, "w");
     if (!f) {
         fprintf(stderr, "Unable to open pasm output: ");
@@ -6586,3 +7175,39 @@ OutputAsmCode(const char *fname, Module *P, int outputMain)
     fwrite(asmcode, 1, strlen(asmcode), f);
     fclose(f);
 }
+
+/*
+ * write the code built by OutputAsmCode(NULL, P, ...) out as text,
+ * just as OutputAsmCode(fname, P, ...) would have
+ */
+void
+WriteAsmCode(const char *fname, Module *P)
+{
+    Module *save = current;
+    const char *asmcode;
+
+    current = P;
+    asmcode = IRAssemble(&cogcode, P);
+    current = save;
+    WriteAsmText(fname, asmcode);
+}
+
+/*
+ * assemble the code built by OutputAsmCode(NULL, P, ...) directly
+ * into the DAT block of module Q; this skips printing the assembly
+ * and parsing it again, which is a large part of the compile time
+ * for big programs
+ */
+void
+AssembleAsmCode(Module *Q, Module *P)
+{
+    Module *save = current;
+
+    struct timespan span;
+
+    current = P;
+    timereport_begin(&span, "IRAssembleToModule", NULL);
+    IRAssembleToModule(&cogcode, P, Q);
+    timereport_end(&span, 0);
+    current = save;
+}
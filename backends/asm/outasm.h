@@ -49,6 +49,10 @@ IRCond InvertCond(IRCond v);
 // assembly
 char *IRAssemble(IRList *list, Module *P);
 
+// function to build the DAT block of module Q directly from an IR list,
+// without going through text
+void IRAssembleToModule(IRList *list, Module *P, Module *Q);
+
 // do instruction compression
 void IRCompress(IRList *list, IRList *kernel);
 
@@ -64,6 +68,9 @@ void OptimizeFcache(IRList *irl);
 bool ShouldBeInlined(Function *f);
 bool RemoveIfInlined(Function *f);
 int  ExpandInlines(IRList *irl);
+int  AllocateLocalRegs(IRList *irl, Function *f, int firstreg, int isLeaf);
+void InitPeepholes(void);
+void ReportPeepholeStats(void);
 
 void ReplaceOpcode(IR *ir, IROpcode op);
 
@@ -77,6 +84,12 @@ bool IsHwReg(Operand *reg);
 bool IsHubDest(Operand *dst);
 Operand *JumpDest(IR *ir);
 
+// P2 instruction timing
+bool IsAugImmediate(Operand *op);
+int InstrMinCycles(IR *ir);
+int InstrMaxCycles(IR *ir);
+bool InstrUsesHub(IR *ir);
+
 typedef enum callconvention {
     FAST_CALL,   // arguments & return in registers, native call
     STACK_CALL,  // arguments & return on stack
@@ -134,6 +147,12 @@ typedef struct ir_bedata {
 
     /* firl emitted already */
     bool firl_done;
+
+    /* number of loops given profile names so far */
+    int profileLoops;
+
+    /* code placement was not given explicitly, so we may move it */
+    bool autoPlace;
 } IRFuncData;
 
 #define FuncData(f) ((IRFuncData *)(f)->bedata)
@@ -157,6 +176,16 @@ Instruction *FindInstrForOpc(IROpcode kind);
 #define INLINE_ASM_FLAG_FCACHE 0x02
 
 void CompileInlineAsm(IRList *irl, AST *ast, unsigned asmFlags);
+
+// profile data (--profile-gen and --profile-use)
+const char *ProfileLoopName(Function *f, Operand *label);
+bool ProfileFuncCount(Function *f, unsigned long *count);
+int ProfileFuncHeat(Function *f);
+bool ProfileLoopIsCold(Operand *label);
+
+// static timing report (--cycle-report)
+void OutputCycleReport(const char *fname, IRList *irl);
+const char *AsmLabelName(const char *name);
 Operand *CompileIdentifier(IRList *irl, AST *expr);
 
 /* assign variable space in COG memory */
@@ -177,6 +206,7 @@ const char *VarName(AST *ast);
 
 // get operands for argument and result registers
 Operand *GetArgReg(int n);
+Operand *GetLocalReg(int n, int isLeaf);
 Operand *GetResultReg(int n);
 
 // convert to an effective address
@@ -0,0 +1,235 @@
+/*
+ * Spin to Pasm converter
+ * Copyright 2024 Total Spectrum Software Inc.
+ * Profile guided optimization support
+ *
+ * With --profile-gen every function entry and every loop gets a hub
+ * counter, and the counters are printed over the serial port when the
+ * main function returns, as lines of the form
+ *
+ *     PROFILE <name> <count>
+ *
+ * where <name> is the assembly name of the function, followed by
+ * #N for the N'th loop in it (counting from 1, in source order).
+ * With --profile-use=file those lines are read back in (anything else
+ * in the file is ignored, and counts for the same name are added up)
+ * and used to guide fcache and inlining decisions.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "spinc.h"
+#include "outasm.h"
+
+int gl_profile_gen;
+const char *gl_profile_use;
+
+#define PROFILE_HASH_SIZE 1024
+
+typedef struct ProfileEntry {
+    struct ProfileEntry *next;
+    const char *name;
+    unsigned long count;
+} ProfileEntry;
+
+// a loop head label which the profile knows about
+typedef struct ProfileLoop {
+    struct ProfileLoop *next;
+    Operand *label;
+    Function *func;
+    const char *name;
+} ProfileLoop;
+
+static ProfileEntry *profileHash[PROFILE_HASH_SIZE];
+static ProfileLoop *loopHash[PROFILE_HASH_SIZE];
+static unsigned long maxFuncCount;
+static bool profileLoaded;
+
+#define LoopHashLabel(label) ((((uintptr_t)(label)) >> 4) % PROFILE_HASH_SIZE)
+
+static unsigned
+ProfileHashName(const char *name)
+{
+    unsigned h = 0;
+    while (*name) {
+        h = h * 31 + (unsigned char)*name++;
+    }
+    return h % PROFILE_HASH_SIZE;
+}
+
+static ProfileEntry *
+FindProfileEntry(const char *name)
+{
+    ProfileEntry *e;
+    for (e = profileHash[ProfileHashName(name)]; e; e = e->next) {
+        if (!strcmp(e->name, name)) {
+            return e;
+        }
+    }
+    return NULL;
+}
+
+static void
+AddProfileCount(const char *name, unsigned long count)
+{
+    ProfileEntry *e = FindProfileEntry(name);
+    unsigned h;
+
+    if (!e) {
+        h = ProfileHashName(name);
+        e = (ProfileEntry *)calloc(1, sizeof(*e));
+        e->name = strdup(name);
+        e->next = profileHash[h];
+        profileHash[h] = e;
+    }
+    e->count += count;
+    if (!strchr(name, '#') && e->count > maxFuncCount) {
+        maxFuncCount = e->count;
+    }
+}
+
+//
+// read the --profile-use file; returns true if profile data is available
+//
+static bool
+LoadProfile(void)
+{
+    FILE *f;
+    char line[1024];
+    char name[1024];
+    unsigned long count;
+    int entries = 0;
+
+    if (profileLoaded) {
+        return maxFuncCount > 0;
+    }
+    profileLoaded = true;
+    if (!gl_profile_use) {
+        return false;
+    }
+    f = fopen(gl_profile_use, "r");
+    if (!f) {
+        ERROR(NULL, "Unable to open profile file %s", gl_profile_use);
+        return false;
+    }
+    while (fgets(line, sizeof(line), f)) {
+        // the serial terminal may have left junk in front of the line
+        char *s = strstr(line, "PROFILE ");
+        if (s && sscanf(s, "PROFILE %1023s %lu", name, &count) == 2) {
+            AddProfileCount(name, count);
+            entries++;
+        }
+    }
+    fclose(f);
+    if (entries == 0) {
+        WARNING(NULL, "No profile data found in %s", gl_profile_use);
+    } else {
+        DEBUG(NULL, "read %d profile counts from %s", entries, gl_profile_use);
+    }
+    return maxFuncCount > 0;
+}
+
+//
+// the name a loop's counter has in the profile
+//
+const char *
+ProfileLoopName(Function *f, Operand *label)
+{
+    ProfileLoop *loop;
+    char *name;
+    const char *fname = FuncData(f)->asmname->name;
+    unsigned h;
+
+    name = (char *)malloc(strlen(fname) + 16);
+    sprintf(name, "%s#%d", fname, ++FuncData(f)->profileLoops);
+    if (gl_profile_use) {
+        h = LoopHashLabel(label);
+        loop = (ProfileLoop *)calloc(1, sizeof(*loop));
+        loop->label = label;
+        loop->func = f;
+        loop->name = name;
+        loop->next = loopHash[h];
+        loopHash[h] = loop;
+    }
+    return name;
+}
+
+//
+// find the number of times function f was entered; returns false
+// if there is no profile information for it
+//
+bool
+ProfileFuncCount(Function *f, unsigned long *count)
+{
+    ProfileEntry *e;
+
+    if (!LoadProfile() || !FuncData(f) || !FuncData(f)->asmname) {
+        return false;
+    }
+    // every function built with --profile-gen is in the profile, even
+    // if it was never called, so a missing one was not instrumented
+    e = FindProfileEntry(FuncData(f)->asmname->name);
+    if (!e) {
+        return false;
+    }
+    *count = e->count;
+    return true;
+}
+
+//
+// decide whether function f was hot (returns 1) or never
+// called (returns -1) in the profile; returns 0 if it was
+// neither, or we have no profile
+//
+int
+ProfileFuncHeat(Function *f)
+{
+    unsigned long count;
+
+    if (!ProfileFuncCount(f, &count)) {
+        return 0;
+    }
+    if (count == 0) {
+        return -1;
+    }
+    // within a factor of 16 of the most called function
+    if (count >= maxFuncCount / 16) {
+        return 1;
+    }
+    return 0;
+}
+
+//
+// check whether the loop starting at "label" ran often enough
+// during profiling to be worth loading into fcache; a loop which
+// averages fewer than 2 trips per call of its function costs more
+// to load than it saves
+//
+bool
+ProfileLoopIsCold(Operand *label)
+{
+    ProfileLoop *loop;
+    ProfileEntry *e;
+    unsigned long loopcount, funccount;
+
+    if (!LoadProfile()) {
+        return false;
+    }
+    for (loop = loopHash[LoopHashLabel(label)]; loop; loop = loop->next) {
+        if (loop->label == label) {
+            break;
+        }
+    }
+    if (!loop) {
+        // not a loop we numbered (it may be an inlined copy)
+        return false;
+    }
+    e = FindProfileEntry(loop->name);
+    if (!e || !ProfileFuncCount(loop->func, &funccount)) {
+        return false;
+    }
+    loopcount = e->count;
+    return loopcount == 0 || loopcount < 2 * funccount;
+}
@@ -0,0 +1,877 @@
+/*
+ * Spin to Pasm converter
+ * Copyright 2024 Total Spectrum Software Inc.
+ * Static timing analysis of the generated code
+ *
+ * With --cycle-report we compute lower and upper bounds on the number
+ * of clock cycles taken by every basic block, loop and function and
+ * write them to a .cycles.json file. On P2 the instruction timings
+ * are the InstrMinCycles/InstrMaxCycles ones the optimizer uses, so
+ * the bounds are only as good as those; in particular hub accesses
+ * (and setq bursts) are assumed to take anywhere from the best to the
+ * worst case of the hub window, and time spent in called
+ * functions is not included (the callees are listed instead).
+ * An upper bound of null means "unknown", e.g. a loop whose trip
+ * count we cannot determine, or a wait instruction.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "spinc.h"
+#include "outasm.h"
+
+int gl_cycle_report;
+
+#define CYCLES_UNBOUNDED (-1LL)
+
+typedef struct CycleBound {
+    long long min;
+    long long max;   // CYCLES_UNBOUNDED if we do not know
+} CycleBound;
+
+typedef struct LoopTiming {
+    const char *label;
+    long long count;     // 0 if unknown
+    bool rep;            // P2 REP block
+    bool fcache;         // runs from fcache
+    bool iterReached;
+    CycleBound iter;
+    CycleBound total;
+} LoopTiming;
+
+typedef struct FuncTiming {
+    Function *f;
+    IR **code;
+    int n;
+    bool inCog;
+    int *target;      // branch target index, -1 if outside the function
+    int *loopEnd;     // for a loop head label, index of its last back edge
+    struct flexbuf loops;
+    struct flexbuf calls;
+} FuncTiming;
+
+static CycleBound
+Bound(long long min, long long max)
+{
+    CycleBound b;
+    b.min = min;
+    b.max = max;
+    return b;
+}
+
+static CycleBound
+BoundAdd(CycleBound a, CycleBound b)
+{
+    CycleBound r;
+    r.min = a.min + b.min;
+    if (a.max == CYCLES_UNBOUNDED || b.max == CYCLES_UNBOUNDED) {
+        r.max = CYCLES_UNBOUNDED;
+    } else {
+        r.max = a.max + b.max;
+    }
+    return r;
+}
+
+// a bound covering both a and b
+static CycleBound
+BoundJoin(CycleBound a, CycleBound b)
+{
+    CycleBound r;
+    r.min = (a.min < b.min) ? a.min : b.min;
+    if (a.max == CYCLES_UNBOUNDED || b.max == CYCLES_UNBOUNDED) {
+        r.max = CYCLES_UNBOUNDED;
+    } else {
+        r.max = (a.max > b.max) ? a.max : b.max;
+    }
+    return r;
+}
+
+static CycleBound
+BoundScale(CycleBound a, long long n)
+{
+    CycleBound r;
+    r.min = a.min * n;
+    r.max = (a.max == CYCLES_UNBOUNDED) ? CYCLES_UNBOUNDED : a.max * n;
+    return r;
+}
+
+static bool
+IsBranchOpc(IR *ir)
+{
+    switch (ir->opc) {
+    case OPC_JUMP:
+    case OPC_DJNZ:
+    case OPC_GENERIC_BRCOND:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static bool
+IsHubLabel(Operand *op)
+{
+    return op && op->kind == IMM_HUB_LABEL;
+}
+
+static int
+FcacheSize(IR *fc)
+{
+    IR *ir;
+    int n = 0;
+    for (ir = fc->next; ir; ir = ir->next) {
+        if (ir->opc == OPC_LABEL && ir->dst == fc->dst) break;
+        if (!IsDummy(ir) && ir->opc != OPC_LABEL && ir->opc < OPC_PUSH_REGS) {
+            n++;
+        }
+    }
+    return n;
+}
+
+static bool
+GenericNameIn(IR *ir, const char * const *names)
+{
+    const char *name = ir->instr ? ir->instr->name : NULL;
+    if (!name) return false;
+    for (; *names; names++) {
+        if (!strcmp(name, *names)) return true;
+    }
+    return false;
+}
+
+// P1 instructions which wait for the hub window
+static const char * const p1HubNames[] = {
+    "rdbyte", "rdword", "rdlong", "wrbyte", "wrword", "wrlong", "hubop",
+    "clkset", "cogid", "coginit", "cogstop", "locknew", "lockret", "lockset",
+    "lockclr", NULL
+};
+static const char * const p1WaitNames[] = {
+    "waitcnt", "waitpeq", "waitpne", "waitvid", NULL
+};
+
+/*
+ * timing for a single instruction; for branches "exec" is the
+ * time when the branch is taken, and "skip" when it is not
+ * the P1 LMM numbers assume the default unrolled LMM loop, where
+ * fetching each instruction takes a hub read and an add
+ */
+static void
+InstrTiming(FuncTiming *ft, IR *ir, CycleBound *exec, CycleBound *skip)
+{
+    bool inHub = !ft->inCog && !ir->fcache;
+    CycleBound b;
+    CycleBound notrun;
+
+    if (gl_p2) {
+        int aug = 0;
+        int max;
+        if (!IsBranchOpc(ir) && ir->opc != OPC_CALL) {
+            if (IsAugImmediate(ir->src)) aug += 2;
+            if (IsAugImmediate(ir->dst)) aug += 2;
+        }
+        notrun = Bound(2+aug, 2+aug);
+        switch (ir->opc) {
+        case OPC_JUMP:
+        case OPC_DJNZ:
+        case OPC_GENERIC_BRCOND:
+        case OPC_CALL:
+        case OPC_RET:
+            // a branch into hub has to reload the FIFO
+            if (inHub || (!ir->fcache && IsHubLabel(JumpDest(ir)))) {
+                b = Bound(13, 20);
+            } else {
+                b = Bound(4, 4);
+            }
+            *exec = b;
+            *skip = notrun;
+            return;
+        case OPC_FCACHE:
+            // loc, call, and a setq/rdlong block read
+            b = Bound(2 + 13 + 9 + FcacheSize(ir), 2 + 20 + 16 + FcacheSize(ir));
+            break;
+        default:
+            max = InstrMaxCycles(ir);
+            b.min = InstrMinCycles(ir);
+            b.max = (max < 0) ? CYCLES_UNBOUNDED : max;
+            if (inHub && b.max != CYCLES_UNBOUNDED && InstrUsesHub(ir)) {
+                // hub accesses compete with the FIFO in hubexec
+                b.max += 10;
+            }
+            break;
+        }
+    } else {
+        notrun = Bound(4, 4);
+        switch (ir->opc) {
+        case OPC_RDBYTE:
+        case OPC_RDWORD:
+        case OPC_RDLONG:
+        case OPC_WRBYTE:
+        case OPC_WRWORD:
+        case OPC_WRLONG:
+        case OPC_COGID:
+        case OPC_COGSTOP:
+        case OPC_LOCKNEW:
+        case OPC_LOCKRET:
+        case OPC_LOCKSET:
+        case OPC_LOCKCLR:
+            b = Bound(8, 23);
+            break;
+        case OPC_WAITCNT:
+            b = Bound(6, CYCLES_UNBOUNDED);
+            break;
+        case OPC_DJNZ:
+            // djnz takes longer when it does not jump
+            *exec = Bound(4, 4);
+            *skip = Bound(8, 8);
+            if (inHub) {
+                *exec = Bound(16, 31);
+                *skip = Bound(20, 35);
+            }
+            return;
+        case OPC_JUMP:
+        case OPC_GENERIC_BRCOND:
+            b = inHub ? Bound(16, 31) : Bound(4, 4);
+            *exec = b;
+            *skip = inHub ? Bound(16, 31) : notrun;
+            return;
+        case OPC_CALL:
+        case OPC_RET:
+            // in LMM these go through the kernel and use the hub stack
+            b = inHub ? Bound(40, 80) : Bound(4, 4);
+            *exec = b;
+            *skip = inHub ? Bound(16, 31) : notrun;
+            return;
+        case OPC_FCACHE:
+            b = Bound(32 + 16 * FcacheSize(ir), 64 + 16 * FcacheSize(ir));
+            break;
+        case OPC_GENERIC:
+        case OPC_GENERIC_NR:
+        case OPC_GENERIC_DELAY:
+        case OPC_GENERIC_NOFLAGS:
+        case OPC_GENERIC_NR_NOFLAGS:
+        case OPC_GENERIC_BRANCH:
+            if (GenericNameIn(ir, p1WaitNames)) {
+                b = Bound(6, CYCLES_UNBOUNDED);
+            } else if (GenericNameIn(ir, p1HubNames)) {
+                b = Bound(8, 23);
+            } else {
+                b = Bound(4, 4);
+            }
+            break;
+        default:
+            b = Bound(4, 4);
+            break;
+        }
+        if (inHub) {
+            // fetch of the instruction by the LMM loop
+            b = BoundAdd(b, Bound(12, 27));
+            notrun = BoundAdd(notrun, Bound(12, 27));
+        }
+    }
+    if (ir->cond != COND_TRUE) {
+        // the instruction may not execute at all
+        b = BoundJoin(b, notrun);
+    }
+    *exec = *skip = b;
+}
+
+static int
+FindLabelIndex(FuncTiming *ft, Operand *label)
+{
+    int i;
+    if (!label) return -1;
+    for (i = 0; i < ft->n; i++) {
+        if (ft->code[i]->opc == OPC_LABEL && ft->code[i]->dst == label) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+//
+// find the constant which "reg" holds on entry to instruction i;
+// we only look back as far as the nearest label or branch
+//
+static bool
+InitialValue(FuncTiming *ft, int i, Operand *reg, long long *val)
+{
+    IR *ir;
+
+    for (--i; i >= 0; --i) {
+        ir = ft->code[i];
+        if (IsDummy(ir)) continue;
+        if (ir->opc == OPC_LABEL || IsBranchOpc(ir) || ir->opc == OPC_CALL) {
+            return false;
+        }
+        if (!InstrModifies(ir, reg)) continue;
+        if (ir->opc == OPC_MOV && ir->cond == COND_TRUE && ir->src && ir->src->kind == IMM_INT) {
+            *val = ir->src->val;
+            return true;
+        }
+        return false;
+    }
+    return false;
+}
+
+//
+// find the trip count of the loop from label "top" to the back
+// edge at "end"; returns 0 if we cannot tell. We know about
+//     djnz reg, #top         with reg set to a constant before the loop
+//     add reg, #step
+//     cmp(s) reg, #limit wc
+//  if_b jmp #top             the usual "repeat i from a to b"
+//
+static long long
+LoopCount(FuncTiming *ft, int top, int end)
+{
+    IR *ir = ft->code[end];
+    IR *cmp = NULL;
+    Operand *reg;
+    long long start, step = 0, limit;
+    int i;
+
+    if (ir->opc == OPC_DJNZ && ir->cond == COND_TRUE) {
+        reg = ir->dst;
+        for (i = top+1; i < end; i++) {
+            if (InstrModifies(ft->code[i], reg)) {
+                return 0;
+            }
+        }
+        if (!InitialValue(ft, top, reg, &start) || start <= 0) {
+            return 0;
+        }
+        return start;
+    }
+    if (ir->opc != OPC_JUMP || (ir->cond != COND_LT && ir->cond != COND_NE)) {
+        return 0;
+    }
+    for (i = end-1; i > top; --i) {
+        if (!IsDummy(ft->code[i])) {
+            cmp = ft->code[i];
+            break;
+        }
+    }
+    if (!cmp || (cmp->opc != OPC_CMP && cmp->opc != OPC_CMPS) || cmp->cond != COND_TRUE
+        || !cmp->src || cmp->src->kind != IMM_INT)
+    {
+        return 0;
+    }
+    if (!(cmp->flags & (ir->cond == COND_LT ? FLAG_WC : FLAG_WZ))) {
+        return 0;
+    }
+    reg = cmp->dst;
+    limit = cmp->src->val;
+    if (cmp->opc == OPC_CMP) {
+        limit &= 0xffffffffLL;
+    }
+    for (i = top+1; i < end; i++) {
+        IR *x = ft->code[i];
+        if (!InstrModifies(x, reg)) continue;
+        if (step || x->opc != OPC_ADD || x->cond != COND_TRUE
+            || !x->src || x->src->kind != IMM_INT || x->src->val <= 0)
+        {
+            return 0;
+        }
+        step = x->src->val;
+    }
+    if (!step || !InitialValue(ft, top, reg, &start) || start >= limit) {
+        return 0;
+    }
+    if (ir->cond == COND_NE && (limit - start) % step != 0) {
+        return 0;
+    }
+    return (limit - start + step - 1) / step;
+}
+
+// the trip count of a P2 "rep" block; 0 if not known
+static long long
+RepCount(FuncTiming *ft, int i)
+{
+    Operand *cnt = ft->code[i]->src;
+    long long n;
+
+    if (!cnt) return 0;
+    if (cnt->kind == IMM_INT) {
+        return cnt->val;
+    }
+    if (InitialValue(ft, i, cnt, &n) && n > 0) {
+        return n;
+    }
+    return 0;
+}
+
+typedef struct RegionResult {
+    bool endReached, iterReached, exitReached;
+    CycleBound end;    // falls out of the bottom of the region
+    CycleBound iter;   // jumps back to the loop head
+    CycleBound exit;   // leaves some other way
+} RegionResult;
+
+static void Relax(bool *reached, CycleBound *dist, CycleBound b)
+{
+    if (*reached) {
+        *dist = BoundJoin(*dist, b);
+    } else {
+        *reached = true;
+        *dist = b;
+    }
+}
+
+static CycleBound LoopTimingFor(FuncTiming *ft, int top, int end, bool *canExit);
+
+//
+// find bounds on the time from instruction lo to the bottom of the
+// region lo..hi (or to a jump back to "top", or out of the region);
+// the code is laid out so every branch inside a region goes forward
+// once inner loops are treated as single steps
+//
+static void
+SolveRegion(FuncTiming *ft, int lo, int hi, int top, RegionResult *res)
+{
+    int size = hi - lo + 2;
+    bool *reached = (bool *)calloc(size, sizeof(bool));
+    CycleBound *dist = (CycleBound *)calloc(size, sizeof(CycleBound));
+    CycleBound exec, skip, c;
+    IR *ir;
+    int i, j, t, e;
+    bool canExit;
+
+    memset(res, 0, sizeof(*res));
+#define REACH(idx, b) Relax(&reached[(idx)-lo], &dist[(idx)-lo], b)
+#define REACH_EXIT(b) Relax(&res->exitReached, &res->exit, b)
+    reached[0] = true;
+    dist[0] = Bound(0, 0);
+    for (i = lo; i <= hi; i++) {
+        if (!reached[i-lo]) continue;
+        c = dist[i-lo];
+        ir = ft->code[i];
+        if (ir->opc == OPC_LABEL && i != top && ft->loopEnd[i] > i && ft->loopEnd[i] <= hi) {
+            // an inner loop; step over it
+            e = ft->loopEnd[i];
+            c = BoundAdd(c, LoopTimingFor(ft, i, e, &canExit));
+            REACH(e+1, c);
+            for (j = i; canExit && j <= e; j++) {
+                t = ft->target[j];
+                if (t > e && t <= hi + 1) {
+                    REACH(t, c);
+                } else if (IsBranchOpc(ft->code[j]) && (t < 0 || t > hi + 1)) {
+                    REACH_EXIT(c);
+                } else if (t == top && t >= 0) {
+                    Relax(&res->iterReached, &res->iter, c);
+                }
+            }
+            i = e;
+            continue;
+        }
+        if (IsDummy(ir) || ir->opc == OPC_LABEL || ir->opc == OPC_REPEAT_END || (ir->opc >= OPC_PUSH_REGS && ir->opc != OPC_FCACHE)) {
+            REACH(i+1, c);
+            continue;
+        }
+        if (ir->opc == OPC_REPEAT) {
+            // P2 rep block; the body has no branches
+            RegionResult body;
+            long long n;
+            LoopTiming lt;
+
+            e = ft->target[i];
+            InstrTiming(ft, ir, &exec, &skip);
+            if (e <= i || e > hi + 1) {
+                REACH_EXIT(BoundAdd(c, Bound(exec.min, CYCLES_UNBOUNDED)));
+                continue;
+            }
+            SolveRegion(ft, i+1, e-1, -1, &body);
+            n = RepCount(ft, i);
+            memset(&lt, 0, sizeof(lt));
+            lt.label = ft->code[e]->dst->name;
+            lt.rep = true;
+            lt.fcache = ir->fcache != NULL;
+            lt.count = n;
+            lt.iterReached = true;
+            lt.iter = body.end;
+            if (n > 0) {
+                lt.total = BoundAdd(exec, BoundScale(body.end, n));
+            } else {
+                lt.total = BoundAdd(exec, Bound(body.end.min, CYCLES_UNBOUNDED));
+            }
+            flexbuf_addmem(&ft->loops, (const char *)&lt, sizeof(lt));
+            REACH(e, BoundAdd(c, lt.total));
+            i = e - 1;
+            continue;
+        }
+        InstrTiming(ft, ir, &exec, &skip);
+        if (ir->opc == OPC_CALL) {
+            REACH(i+1, BoundAdd(c, exec));
+            continue;
+        }
+        if (ir->opc == OPC_RET) {
+            REACH_EXIT(BoundAdd(c, exec));
+            if (ir->cond != COND_TRUE) {
+                REACH(i+1, BoundAdd(c, skip));
+            }
+            continue;
+        }
+        if (ir->opc == OPC_JMPREL) {
+            // jump table: any of the jumps after it may be next
+            REACH(i+1, BoundAdd(c, exec));
+            for (j = i+1; j <= hi && ft->code[j]->opc == OPC_JUMP; j++) {
+                REACH(j, BoundAdd(c, exec));
+            }
+            continue;
+        }
+        if (ir->opc == OPC_GENERIC_BRANCH) {
+            // a branch we know nothing about
+            REACH_EXIT(BoundAdd(c, Bound(exec.min, CYCLES_UNBOUNDED)));
+            if (ir->cond != COND_TRUE) {
+                REACH(i+1, BoundAdd(c, skip));
+            }
+            continue;
+        }
+        if (IsBranchOpc(ir)) {
+            t = ft->target[i];
+            if (t == top && t >= 0) {
+                Relax(&res->iterReached, &res->iter, BoundAdd(c, exec));
+            } else if (t > i && t <= hi + 1) {
+                REACH(t, BoundAdd(c, exec));
+            } else {
+                REACH_EXIT(BoundAdd(c, exec));
+            }
+            if (ir->cond != COND_TRUE || ir->opc == OPC_DJNZ || ir->opc == OPC_GENERIC_BRCOND) {
+                REACH(i+1, BoundAdd(c, skip));
+            }
+            continue;
+        }
+        REACH(i+1, BoundAdd(c, exec));
+    }
+#undef REACH
+#undef REACH_EXIT
+    if (reached[size-1]) {
+        res->endReached = true;
+        res->end = dist[size-1];
+    }
+    free(dist);
+    free(reached);
+}
+
+//
+// bounds on the time for the loop from label "top" to the back
+// edge at "end", including all of its iterations
+//
+static CycleBound
+LoopTimingFor(FuncTiming *ft, int top, int end, bool *canExit)
+{
+    RegionResult r;
+    LoopTiming lt;
+    CycleBound out;
+    long long n;
+
+    SolveRegion(ft, top, end, top, &r);
+    n = LoopCount(ft, top, end);
+    if (r.endReached && r.exitReached) {
+        out = BoundJoin(r.end, r.exit);
+    } else if (r.endReached) {
+        out = r.end;
+    } else if (r.exitReached) {
+        out = r.exit;
+    } else {
+        // never leaves (e.g. "repeat" with no condition)
+        out = Bound(0, 0);
+    }
+    memset(&lt, 0, sizeof(lt));
+    lt.label = ft->code[top]->dst->name;
+    lt.fcache = ft->code[top]->fcache != NULL;
+    lt.count = n;
+    lt.iterReached = r.iterReached;
+    lt.iter = r.iter;
+    if (!r.iterReached) {
+        lt.total = out;
+    } else if (n > 0) {
+        lt.total = BoundAdd(BoundScale(r.iter, n-1), r.end);
+        if (r.exitReached) {
+            lt.total = BoundJoin(lt.total, r.exit);
+        }
+        if (!r.endReached && !r.exitReached) {
+            lt.total.max = CYCLES_UNBOUNDED;
+        }
+    } else {
+        lt.total = Bound(out.min, CYCLES_UNBOUNDED);
+    }
+    flexbuf_addmem(&ft->loops, (const char *)&lt, sizeof(lt));
+    *canExit = r.exitReached;
+    return lt.total;
+}
+
+static void
+PrintBound(FILE *f, CycleBound b)
+{
+    fprintf(f, "{\"min\": %lld, \"max\": ", b.min);
+    if (b.max == CYCLES_UNBOUNDED) {
+        fprintf(f, "null}");
+    } else {
+        fprintf(f, "%lld}", b.max);
+    }
+}
+
+static void
+PrintJsonString(FILE *f, const char *s)
+{
+    fputc('"', f);
+    while (s && *s) {
+        if (*s == '"' || *s == '\\') {
+            fputc('\\', f);
+            fputc(*s, f);
+        } else if ((unsigned char)*s < ' ') {
+            fprintf(f, "\\u%04x", (unsigned char)*s);
+        } else {
+            fputc(*s, f);
+        }
+        s++;
+    }
+    fputc('"', f);
+}
+
+// labels are printed the way they appear in the listing
+static void
+PrintJsonLabel(FILE *f, const char *name)
+{
+    PrintJsonString(f, AsmLabelName(name));
+}
+
+static void
+PrintBlocks(FILE *f, FuncTiming *ft)
+{
+    int i, offset = 0, start = 0, count = 0;
+    const char *label = NULL;
+    CycleBound sum = Bound(0, 0), exec, skip;
+    bool first = true;
+    IR *ir;
+
+    fprintf(f, "      \"blocks\": [");
+    for (i = 0; i <= ft->n; i++) {
+        ir = (i < ft->n) ? ft->code[i] : NULL;
+        if (!ir || ir->opc == OPC_LABEL) {
+            if (count > 0) {
+                fprintf(f, "%s\n        {\"label\": ", first ? "" : ",");
+                if (label) PrintJsonLabel(f, label); else fprintf(f, "null");
+                fprintf(f, ", \"offset\": %d, \"instructions\": %d, \"cycles\": ", start, count);
+                PrintBound(f, sum);
+                fprintf(f, "}");
+                first = false;
+            }
+            if (!ir) break;
+            if (count > 0 || !label) {
+                label = ir->dst->name;
+            }
+            start = offset;
+            count = 0;
+            sum = Bound(0, 0);
+            continue;
+        }
+        if (IsDummy(ir) || (ir->opc >= OPC_PUSH_REGS && ir->opc != OPC_FCACHE)
+            || ir->opc == OPC_REPEAT_END)
+        {
+            continue;
+        }
+        InstrTiming(ft, ir, &exec, &skip);
+        if (ir->cond == COND_TRUE && ir->opc != OPC_DJNZ && ir->opc != OPC_GENERIC_BRCOND) {
+            sum = BoundAdd(sum, exec);
+        } else {
+            sum = BoundAdd(sum, BoundJoin(exec, skip));
+        }
+        count++;
+        offset++;
+        if (IsBranchOpc(ir) || ir->opc == OPC_RET || ir->opc == OPC_JMPREL
+            || ir->opc == OPC_GENERIC_BRANCH || ir->opc == OPC_REPEAT)
+        {
+            // end of the block
+            fprintf(f, "%s\n        {\"label\": ", first ? "" : ",");
+            if (label) PrintJsonLabel(f, label); else fprintf(f, "null");
+            fprintf(f, ", \"offset\": %d, \"instructions\": %d, \"cycles\": ", start, count);
+            PrintBound(f, sum);
+            fprintf(f, "}");
+            first = false;
+            label = NULL;
+            start = offset;
+            count = 0;
+            sum = Bound(0, 0);
+        }
+    }
+    fprintf(f, "\n      ]");
+}
+
+static void
+ReportFunction(FILE *f, Function *func, IR *start, IR *retlabel, bool firstFunc)
+{
+    FuncTiming ft;
+    RegionResult r;
+    CycleBound self;
+    IR *ir;
+    int i, j, n;
+    LoopTiming *loops;
+    const char **calls;
+    int ncalls;
+
+    memset(&ft, 0, sizeof(ft));
+    ft.f = func;
+    ft.inCog = func->code_placement != CODE_PLACE_HUB;
+    // the function runs from its label to the "ret" after its return label
+    n = 0;
+    for (ir = start; ir; ir = ir->next) {
+        n++;
+        if (ir == retlabel) {
+            while (ir->next && ir->next->opc != OPC_RET && (IsDummy(ir->next) || ir->next->opc == OPC_LABEL)) {
+                ir = ir->next;
+                n++;
+            }
+            if (ir->next && ir->next->opc == OPC_RET) n++;
+            break;
+        }
+    }
+    ft.n = n;
+    ft.code = (IR **)calloc(n, sizeof(IR *));
+    ft.target = (int *)calloc(n, sizeof(int));
+    ft.loopEnd = (int *)calloc(n, sizeof(int));
+    for (i = 0, ir = start; i < n; i++, ir = ir->next) {
+        ft.code[i] = ir;
+    }
+    flexbuf_init(&ft.loops, 256);
+    flexbuf_init(&ft.calls, 256);
+    for (i = 0; i < n; i++) {
+        ir = ft.code[i];
+        ft.loopEnd[i] = -1;
+        if (IsBranchOpc(ir)) {
+            ft.target[i] = FindLabelIndex(&ft, JumpDest(ir));
+        } else if (ir->opc == OPC_REPEAT) {
+            ft.target[i] = FindLabelIndex(&ft, ir->dst);
+        } else {
+            ft.target[i] = -1;
+        }
+        if (ir->opc == OPC_CALL && ir->dst && ir->dst->name) {
+            flexbuf_addmem(&ft.calls, (const char *)&ir->dst->name, sizeof(const char *));
+        }
+    }
+    for (i = 0; i < n; i++) {
+        j = ft.target[i];
+        if (IsBranchOpc(ft.code[i]) && j >= 0 && j <= i && ft.loopEnd[j] < i) {
+            ft.loopEnd[j] = i;
+        }
+    }
+    SolveRegion(&ft, 0, n-1, -1, &r);
+    if (r.endReached && r.exitReached) {
+        self = BoundJoin(r.end, r.exit);
+    } else if (r.exitReached) {
+        self = r.exit;
+    } else if (r.endReached) {
+        self = r.end;
+    } else {
+        self = Bound(0, CYCLES_UNBOUNDED);
+    }
+
+    fprintf(f, "%s\n    {\n      \"name\": ", firstFunc ? "" : ",");
+    PrintJsonLabel(f, FuncData(func)->asmname->name);
+    fprintf(f, ",\n      \"source\": ");
+    PrintJsonString(f, func->user_name ? func->user_name : func->name);
+    fprintf(f, ",\n      \"memory\": \"%s\",\n      \"cycles\": ",
+            func->code_placement == CODE_PLACE_LUT ? "lut" : ft.inCog ? "cog" : "hub");
+    PrintBound(f, self);
+    fprintf(f, ",\n      \"calls\": [");
+    calls = (const char **)flexbuf_peek(&ft.calls);
+    ncalls = flexbuf_curlen(&ft.calls) / sizeof(const char *);
+    for (i = 0; i < ncalls; i++) {
+        for (j = 0; j < i; j++) {
+            if (!strcmp(calls[i], calls[j])) break;
+        }
+        if (j < i) continue;
+        if (i > 0) fprintf(f, ", ");
+        PrintJsonLabel(f, calls[i]);
+    }
+    fprintf(f, "],\n      \"loops\": [");
+    loops = (LoopTiming *)flexbuf_peek(&ft.loops);
+    n = flexbuf_curlen(&ft.loops) / sizeof(LoopTiming);
+    for (i = 0; i < n; i++) {
+        fprintf(f, "%s\n        {\"label\": ", i ? "," : "");
+        PrintJsonLabel(f, loops[i].label);
+        fprintf(f, ", \"kind\": \"%s\", \"fcache\": %s, \"count\": ",
+                loops[i].rep ? "rep" : "branch", loops[i].fcache ? "true" : "false");
+        if (loops[i].count > 0) {
+            fprintf(f, "%lld", loops[i].count);
+        } else {
+            fprintf(f, "null");
+        }
+        fprintf(f, ", \"iteration\": ");
+        if (loops[i].iterReached) {
+            PrintBound(f, loops[i].iter);
+        } else {
+            fprintf(f, "null");
+        }
+        fprintf(f, ", \"total\": ");
+        PrintBound(f, loops[i].total);
+        fprintf(f, "}");
+    }
+    fprintf(f, "%s],\n", n ? "\n      " : "");
+    PrintBlocks(f, &ft);
+    fprintf(f, "\n    }");
+
+    flexbuf_delete(&ft.calls);
+    flexbuf_delete(&ft.loops);
+    free(ft.loopEnd);
+    free(ft.target);
+    free(ft.code);
+}
+
+static int
+ReportModule(FILE *f, Module *Q, IRList *irl, int nfuncs)
+{
+    Function *func;
+    IR *ir, *start, *retlabel;
+
+    for (func = Q->functions; func; func = func->next) {
+        if (!FuncData(func) || !FuncData(func)->firl_done) {
+            continue;
+        }
+        start = retlabel = NULL;
+        for (ir = irl->head; ir; ir = ir->next) {
+            if (ir->opc != OPC_LABEL) continue;
+            if (!start && ir->dst == FuncData(func)->asmname) {
+                start = ir;
+            } else if (start && ir->dst == FuncData(func)->asmretname) {
+                retlabel = ir;
+                break;
+            }
+        }
+        if (!start || !retlabel) {
+            continue;
+        }
+        ReportFunction(f, func, start, retlabel, nfuncs == 0);
+        nfuncs++;
+    }
+    return nfuncs;
+}
+
+//
+// write the timing report for the final code in irl
+//
+void
+OutputCycleReport(const char *fname, IRList *irl)
+{
+    FILE *f;
+    Module *Q;
+    int nfuncs = 0;
+    bool sawSystem = false;
+
+    f = fopen(fname, "w");
+    if (!f) {
+        ERROR(NULL, "Unable to open %s for the cycle report", fname);
+        return;
+    }
+    fprintf(f, "{\n  \"cpu\": \"%s\",\n  \"units\": \"cycles\",\n  \"functions\": [", gl_p2 ? "P2" : "P1");
+    for (Q = allparse; Q; Q = Q->next) {
+        if (Q == systemModule) sawSystem = true;
+        nfuncs = ReportModule(f, Q, irl, nfuncs);
+    }
+    if (!sawSystem && systemModule) {
+        nfuncs = ReportModule(f, systemModule, irl, nfuncs);
+    }
+    fprintf(f, "\n  ]\n}\n");
+    fclose(f);
+}
@@ -111,11 +111,125 @@ static bool BCIR_SizeDetermined(ByteOpIR *ir) {
     return ir->fixedSize >= 0;
 }
 
+// While the sizes of a function's ops are being determined, the
+// (non-recursive) size bounds of every op are kept in a pair of Fenwick
+// trees, so the distance between any two ops is found in O(log n)
+// instead of by walking the list between them, and fixing the size of
+// an op is an O(log n) update.
+typedef struct BCIRLayout {
+    int count;
+    ByteOpIR **ops;
+    int *minSize, *maxSize;  // current bounds of each op
+    int *minTree, *maxTree;  // Fenwick trees over those (1-based)
+} BCIRLayout;
+
+static BCIRLayout *current_layout;
+
+static void BCIR_LayoutAdd(int *tree,int count,int idx,int delta) {
+    for (idx++;idx<=count;idx+=idx&-idx) tree[idx] += delta;
+}
+
+// Sum of the sizes of ops 0..idx-1
+static int BCIR_LayoutPrefix(int *tree,int idx) {
+    int sum = 0;
+    for (;idx>0;idx-=idx&-idx) sum += tree[idx];
+    return sum;
+}
+
+static BCIRLayout *BCIR_MakeLayout(BCIRBuffer *irbuf) {
+    BCIRLayout *L = calloc(1,sizeof(BCIRLayout));
+    int n = 0;
+    for (ByteOpIR *ir=irbuf->head;ir;ir=ir->next) n++;
+    L->count = n;
+    L->ops = calloc(n+1,sizeof(ByteOpIR *));
+    L->minSize = calloc(n+1,sizeof(int));
+    L->maxSize = calloc(n+1,sizeof(int));
+    L->minTree = calloc(n+1,sizeof(int));
+    L->maxTree = calloc(n+1,sizeof(int));
+    if (!L->ops || !L->minSize || !L->maxSize || !L->minTree || !L->maxTree) {
+        ERROR(NULL,"Out of memory (while allocating bytecode layout)");
+        exit(2);
+    }
+    n = 0;
+    for (ByteOpIR *ir=irbuf->head;ir;ir=ir->next,n++) {
+        ir->layoutIndex = n;
+        L->ops[n] = ir;
+        GetSizeBound_Func(ir,&L->minSize[n],&L->maxSize[n],false);
+        L->minTree[n+1] = L->minSize[n];
+        L->maxTree[n+1] = L->maxSize[n];
+    }
+    // build the trees in place
+    for (int i=1;i<=L->count;i++) {
+        int up = i + (i&-i);
+        if (up <= L->count) {
+            L->minTree[up] += L->minTree[i];
+            L->maxTree[up] += L->maxTree[i];
+        }
+    }
+    return L;
+}
+
+static void BCIR_FreeLayout(BCIRLayout *L) {
+    if (!L) return;
+    free(L->ops);
+    free(L->minSize);
+    free(L->maxSize);
+    free(L->minTree);
+    free(L->maxTree);
+    free(L);
+}
+
+static bool BCIR_InLayout(BCIRLayout *L,ByteOpIR *ir) {
+    return ir && ir->layoutIndex >= 0 && ir->layoutIndex < L->count && L->ops[ir->layoutIndex] == ir;
+}
+
+// Fix the size of ir, keeping the layout up to date
+static void BCIR_FixSize(ByteOpIR *ir,int size) {
+    BCIRLayout *L = current_layout;
+    ir->fixedSize = size;
+    if (L && BCIR_InLayout(L,ir)) {
+        int idx = ir->layoutIndex;
+        BCIR_LayoutAdd(L->minTree,L->count,idx,size - L->minSize[idx]);
+        BCIR_LayoutAdd(L->maxTree,L->count,idx,size - L->maxSize[idx]);
+        L->minSize[idx] = L->maxSize[idx] = size;
+    }
+}
+
+// Same result as the list walk in BCIR_GetJumpOffsetBounds
+static void BCIR_LayoutOffsetBounds(BCIRLayout *L,ByteOpIR *jump,bool func_relative,int *minDist, int *maxDist) {
+    ByteOpIR *target = jump->jumpTo;
+    if (!BCIR_InLayout(L,target)) {
+        *minDist = 0xBADBAD;
+        *maxDist = -1;
+        return;
+    }
+    int t = target->layoutIndex;
+    if (func_relative) {
+        *minDist = BCIR_LayoutPrefix(L->minTree,t);
+        *maxDist = BCIR_LayoutPrefix(L->maxTree,t);
+        return;
+    }
+    int j = jump->layoutIndex;
+    if (t > j) {
+        // forward: the ops after the jump, up to the target
+        *minDist = BCIR_LayoutPrefix(L->minTree,t) - BCIR_LayoutPrefix(L->minTree,j+1);
+        *maxDist = BCIR_LayoutPrefix(L->maxTree,t) - BCIR_LayoutPrefix(L->maxTree,j+1);
+    } else {
+        // backward: the ops after the target, up to and including the jump
+        *minDist = BCIR_LayoutPrefix(L->minTree,t+1) - BCIR_LayoutPrefix(L->minTree,j+1);
+        *maxDist = BCIR_LayoutPrefix(L->maxTree,t+1) - BCIR_LayoutPrefix(L->maxTree,j+1);
+    }
+}
+
 void BCIR_GetJumpOffsetBounds(ByteOpIR *jump,bool func_relative,int *minDist, int *maxDist,int recursionsLeft) {
     ByteOpIR *searchingFor = jump->jumpTo;
     *minDist = *maxDist = 0;
     bool found = false;
     if (recursionsLeft) --recursionsLeft;
+    if (current_layout && (func_relative || BCIR_InLayout(current_layout,jump))) {
+        BCIR_LayoutOffsetBounds(current_layout,jump,func_relative,minDist,maxDist);
+        return;
+    }
     // Try searching forward (don't include jump itself)
     for (ByteOpIR *ir=func_relative?current_birb->head:jump->next;ir;ir=ir->next) {
         if (ir==searchingFor) {
@@ -561,10 +675,10 @@ BCIR_DetermineSizes(BCIRBuffer *irbuf,bool force,int maxRecursion) {
         GetSizeBound_Func(ir,&min,&max,maxRecursion);
         if (min<0||max<0) ERROR(NULL,"Internal error, size bounds negative");
         if (min==max) {
-            ir->fixedSize = max;
+            BCIR_FixSize(ir,max);
             didSomething = true;
         } else if (force && BCIR_CanBeOversized(ir)) {
-            ir->fixedSize = max;
+            BCIR_FixSize(ir,max);
             return true;
         }
     }
@@ -581,9 +695,12 @@ BCIR_AllDetermined(BCIRBuffer *irbuf) {
     return true;
 }
 
+// Determine the sizes of all ops; leaves current_layout set up for
+// the caller, which must free it
 static void
 BCIR_Compact(BCIRBuffer *irbuf,int maxRecursion) {
     for(ByteOpIR *ir=irbuf->head;ir;ir=ir->next) ir->fixedSize = -1; // Initialize all sizes to -1
+    current_layout = BCIR_MakeLayout(irbuf);
     for(;;) {
         // Fix sizes until we cant anymore
         while (BCIR_DetermineSizes(irbuf,false,maxRecursion));
@@ -613,6 +730,8 @@ void BCIR_to_BOB(BCIRBuffer *irbuf,ByteOutputBuffer *bob,int pbase_funoffset) {
         instrSpan->comment = comment;
         BOB_PushSpan(bob,instrSpan);
     }
+    BCIR_FreeLayout(current_layout);
+    current_layout = NULL;
     current_birb = NULL;
 }
 
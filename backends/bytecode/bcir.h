@@ -234,6 +234,7 @@ typedef struct bcirstruct {
     struct bcirstruct *jumpTo; // Label that is referenced
 
     int fixedSize; // If set, the size of this op is known. For BOK_LABEL and other zero-size ops, this is irrelevant
+    int layoutIndex; // Position of this op in the function, only valid while sizes are being determined
 
 } ByteOpIR;
 
@@ -314,9 +314,14 @@ GetBytecodeFor(NuIr *ir)
     return b;
 }
 //
-// scan list of instructions for pairs that may be combined into a macro
+// keep track of pairs of instructions that may be combined into a macro
 // only opcodes that have been assigned single bytecodes may be merged
 //
+// every adjacent pair of instructions that could ever be merged is
+// recorded in a NuPair, along with a list of where it occurs; merging
+// a pair only changes the counts of the pairs next to each place it
+// was merged, so we never have to rescan the whole program
+//
 typedef struct NuMacro {
     NuBytecode *firstCode;
     NuBytecode *secondCode;
@@ -324,92 +329,326 @@ typedef struct NuMacro {
     int depth;
 } NuMacro;
 
-static NuMacro macros[256][256];
-
 #define MAX_MACRO_DEPTH 4
 
-// scan for potential macro pairs
-static NuMacro *NuScanForMacros(NuIrList *lists, int *savings) {
-    NuIrList *irl = lists;
+struct NuPairSite;
+
+typedef struct NuPair {
+    NuBytecode *first;
+    NuBytecode *second;
+    int count;
+    int heapIndex;              // position in pairHeap, or -1 if not a candidate
+    struct NuPairSite *head;    // occurrences, in program order
+    struct NuPairSite *tail;
+    struct NuPair *hashNext;
+    struct NuPair *nextWithFirst;
+    struct NuPair *nextWithSecond;
+} NuPair;
+
+typedef struct NuPairSite {
     NuIr *ir;
-    int maxCount = 0;
-    NuBytecode *prevCode, *curCode;
-    NuMacro *where = 0;
-    int savedBytes;
-    static int found_macro = 0;
+    NuIrList *irl;
+    struct NuPairSite *prev;    // neighbouring instructions
+    struct NuPairSite *next;
+    NuPair *pair;               // pair starting at this instruction, if any
+    struct NuPairSite *pairPrev;
+    struct NuPairSite *pairNext;
+    int seq;                    // position in the original program
+} NuPairSite;
 
-//    if (found_macro > 48) {
-//        return NULL;
-//    }
-    memset(macros, 0, sizeof(macros));
-    while (irl) {
-        prevCode = NULL;
-        for (ir = irl->head; ir; ir = ir->next) {
-            curCode = ir->bytecode;
-            if (curCode && (curCode->is_inline_asm || curCode->is_rel_branch)) {
-                // no macros involving inline asm or relative branches
-                curCode = NULL;
+static NuPairSite *pairSites;
+static NuPair **pairHash;
+static unsigned pairHashMask;
+static NuPair **pairHeap;
+static int pairHeapSize;
+static int pairHeapMax;
+
+static unsigned NuPairHash(NuBytecode *first, NuBytecode *second) {
+    uintptr_t h = (uintptr_t)first * 31 + (uintptr_t)second;
+    h ^= h >> 15;
+    h *= 0x2c1b3c6d;
+    h ^= h >> 12;
+    return (unsigned)h & pairHashMask;
+}
+
+static bool NuPairCanStart(NuBytecode *bc) {
+    return bc && !bc->is_inline_asm && !bc->is_rel_branch && !bc->is_any_branch;
+}
+
+static bool NuPairCanEnd(NuBytecode *bc) {
+    return bc && !bc->is_inline_asm && !bc->is_rel_branch;
+}
+
+// pairs are only worth merging if both halves have single byte codes
+static bool NuPairIsCandidate(NuPair *p) {
+    return p->count > 0
+        && p->first->code >= FIRST_BYTECODE && p->second->code >= FIRST_BYTECODE
+        && p->first->macro_depth < MAX_MACRO_DEPTH && p->second->macro_depth < MAX_MACRO_DEPTH;
+}
+
+// the best pair is the most frequent one; ties go to the pair
+// whose last occurrence comes first, which is the one a scan of
+// the program would have seen reach that count first
+static bool NuPairBetter(NuPair *a, NuPair *b) {
+    if (a->count != b->count) {
+        return a->count > b->count;
+    }
+    return a->tail->seq < b->tail->seq;
+}
+
+static void NuHeapSet(int i, NuPair *p) {
+    pairHeap[i] = p;
+    p->heapIndex = i;
+}
+
+static void NuHeapSiftUp(int i) {
+    NuPair *p = pairHeap[i];
+    while (i > 0) {
+        int parent = (i-1)/2;
+        if (!NuPairBetter(p, pairHeap[parent])) break;
+        NuHeapSet(i, pairHeap[parent]);
+        i = parent;
+    }
+    NuHeapSet(i, p);
+}
+
+static void NuHeapSiftDown(int i) {
+    NuPair *p = pairHeap[i];
+    for(;;) {
+        int child = 2*i+1;
+        if (child >= pairHeapSize) break;
+        if (child+1 < pairHeapSize && NuPairBetter(pairHeap[child+1], pairHeap[child])) {
+            child++;
+        }
+        if (!NuPairBetter(pairHeap[child], p)) break;
+        NuHeapSet(i, pairHeap[child]);
+        i = child;
+    }
+    NuHeapSet(i, p);
+}
+
+// put p in the right place in the heap after its count or eligibility changed
+static void NuPairUpdate(NuPair *p) {
+    int i = p->heapIndex;
+    if (!NuPairIsCandidate(p)) {
+        if (i >= 0) {
+            NuPair *last = pairHeap[--pairHeapSize];
+            p->heapIndex = -1;
+            if (last != p) {
+                NuHeapSet(i, last);
+                NuHeapSiftUp(i);
+                NuHeapSiftDown(last->heapIndex);
             }
-            if (curCode && prevCode && curCode->macro_depth < MAX_MACRO_DEPTH && prevCode->macro_depth < MAX_MACRO_DEPTH) {
-                int bc1, bc2;
-                bc1 = prevCode->code;
-                bc2 = curCode->code;
-                if (bc1 >= FIRST_BYTECODE && bc2 >= FIRST_BYTECODE) {
-                    macros[bc1][bc2].count++;
-                    if (macros[bc1][bc2].count > maxCount) {
-                        maxCount = macros[bc1][bc2].count;
-                        where = &macros[bc1][bc2];
-                        where->firstCode = prevCode;
-                        where->secondCode = curCode;
-                    }
-                }
+        }
+        return;
+    }
+    if (i < 0) {
+        if (pairHeapSize == pairHeapMax) {
+            pairHeapMax = pairHeapMax ? 2*pairHeapMax : 256;
+            pairHeap = (NuPair **)realloc(pairHeap, pairHeapMax * sizeof(NuPair *));
+            if (!pairHeap) {
+                ERROR(NULL, "Out of memory");
+                exit(2);
             }
-            if (curCode && !curCode->is_any_branch) {
-                prevCode = curCode;
-            } else {
-                prevCode = NULL;
+        }
+        i = pairHeapSize++;
+        NuHeapSet(i, p);
+    }
+    NuHeapSiftUp(i);
+    NuHeapSiftDown(p->heapIndex);
+}
+
+static NuPair *NuFindPair(NuBytecode *first, NuBytecode *second) {
+    unsigned h = NuPairHash(first, second);
+    NuPair *p;
+    for (p = pairHash[h]; p; p = p->hashNext) {
+        if (p->first == first && p->second == second) {
+            return p;
+        }
+    }
+    p = (NuPair *)calloc(1, sizeof(*p));
+    if (!p) {
+        ERROR(NULL, "Out of memory");
+        exit(2);
+    }
+    p->first = first;
+    p->second = second;
+    p->heapIndex = -1;
+    p->hashNext = pairHash[h];
+    pairHash[h] = p;
+    p->nextWithFirst = first->firstPairs;
+    first->firstPairs = p;
+    p->nextWithSecond = second->secondPairs;
+    second->secondPairs = p;
+    return p;
+}
+
+// record the pair (if any) starting at site
+static void NuAddPairAt(NuPairSite *site) {
+    NuBytecode *first, *second;
+    NuPairSite *where;
+    NuPair *p;
+
+    if (!site || !site->next) return;
+    first = site->ir->bytecode;
+    second = site->next->ir->bytecode;
+    if (!NuPairCanStart(first) || !NuPairCanEnd(second)) return;
+    p = NuFindPair(first, second);
+    // new sites are almost always at the end, but keep the list sorted
+    where = p->tail;
+    while (where && where->seq > site->seq) {
+        where = where->pairPrev;
+    }
+    site->pair = p;
+    site->pairPrev = where;
+    site->pairNext = where ? where->pairNext : p->head;
+    if (site->pairNext) {
+        site->pairNext->pairPrev = site;
+    } else {
+        p->tail = site;
+    }
+    if (where) {
+        where->pairNext = site;
+    } else {
+        p->head = site;
+    }
+    p->count++;
+    NuPairUpdate(p);
+}
+
+// forget the pair starting at site
+static void NuRemovePairAt(NuPairSite *site) {
+    NuPair *p;
+    if (!site || !site->pair) return;
+    p = site->pair;
+    if (site->pairPrev) {
+        site->pairPrev->pairNext = site->pairNext;
+    } else {
+        p->head = site->pairNext;
+    }
+    if (site->pairNext) {
+        site->pairNext->pairPrev = site->pairPrev;
+    } else {
+        p->tail = site->pairPrev;
+    }
+    site->pair = NULL;
+    site->pairPrev = site->pairNext = NULL;
+    --p->count;
+    NuPairUpdate(p);
+}
+
+static void NuInitPairs(NuIrList *lists) {
+    NuIrList *irl;
+    NuIr *ir;
+    NuPairSite *site, *prev;
+    int n = 0;
+    unsigned hashSize = 256;
+    int i;
+
+    for (irl = lists; irl; irl = irl->nextList) {
+        for (ir = irl->head; ir; ir = ir->next) {
+            n++;
+        }
+    }
+    while (hashSize < (unsigned)n) {
+        hashSize *= 2;
+    }
+    pairHashMask = hashSize - 1;
+    pairHash = (NuPair **)calloc(hashSize, sizeof(NuPair *));
+    pairSites = (NuPairSite *)calloc(n+1, sizeof(NuPairSite));
+    if (!pairHash || !pairSites) {
+        ERROR(NULL, "Out of memory");
+        exit(2);
+    }
+    pairHeapSize = 0;
+    site = pairSites;
+    for (irl = lists; irl; irl = irl->nextList) {
+        prev = NULL;
+        for (ir = irl->head; ir; ir = ir->next) {
+            site->ir = ir;
+            site->irl = irl;
+            site->seq = site - pairSites;
+            site->prev = prev;
+            if (prev) {
+                prev->next = site;
             }
+            prev = site++;
         }
-        irl = irl->nextList;
     }
+    for (i = 0; i < n; i++) {
+        NuAddPairAt(&pairSites[i]);
+    }
+}
+
+static void NuFreePairs(void) {
+    unsigned i;
+    NuPair *p, *next;
+    int j;
+
+    for (i = 0; i <= pairHashMask; i++) {
+        for (p = pairHash[i]; p; p = next) {
+            next = p->hashNext;
+            free(p);
+        }
+    }
+    for (j = 0; j < num_bytecodes; j++) {
+        globalBytecodes[j]->firstPairs = globalBytecodes[j]->secondPairs = NULL;
+    }
+    free(pairHash);
+    free(pairSites);
+    free(pairHeap);
+    pairHash = NULL;
+    pairSites = NULL;
+    pairHeap = NULL;
+    pairHeapSize = pairHeapMax = 0;
+}
+
+// called when bc has just been given a bytecode of its own, so pairs
+// involving it may now be merged
+static void NuPairsCodeChanged(NuBytecode *bc) {
+    NuPair *p;
+    for (p = bc->firstPairs; p; p = p->nextWithFirst) {
+        NuPairUpdate(p);
+    }
+    for (p = bc->secondPairs; p; p = p->nextWithSecond) {
+        NuPairUpdate(p);
+    }
+}
+
+// find the best pair to make into a macro
+static NuMacro *NuFindMacro(int *savings) {
+    static NuMacro best;
+    NuPair *p;
+    int savedBytes;
+
+    if (pairHeapSize == 0) {
+        return NULL;
+    }
+    p = pairHeap[0];
     // figure out the benefit of doing this replacement
     // the new macro requires at least 10 bytes implementation
     // it will save 1 byte per invocation
-    savedBytes = maxCount - 10;
+    savedBytes = p->count - 10;
     if (savedBytes < 0) {
         return NULL;
     }
     *savings = savedBytes;
-    found_macro++;
-    where->depth = where->firstCode->macro_depth;
-    if (where->secondCode->macro_depth > where->depth) {
-        where->depth = where->secondCode->macro_depth;
+    best.firstCode = p->first;
+    best.secondCode = p->second;
+    best.count = p->count;
+    best.depth = p->first->macro_depth;
+    if (p->second->macro_depth > best.depth) {
+        best.depth = p->second->macro_depth;
     }
-    where->depth += 1;
-    return where;
+    best.depth += 1;
+    return &best;
 }
 
 //
-// recalculate usage of bytescodes
+// usage counts are kept up to date as macros are created, so we
+// only need to re-sort the bytecodes
 //
-static void NuRecalcUsage(NuIrList *lists) {
-    NuIrList *irl = lists;
-    NuIr *ir;
-    NuBytecode *curCode;
-    int i;
-
-    for (i = 0; i < num_bytecodes; i++) {
-        globalBytecodes[i]->usage = 0;
-    }
-    while (irl) {
-        for (ir = irl->head; ir; ir = ir->next) {
-            curCode = ir->bytecode;
-            if (curCode) {
-                curCode->usage++;
-            }
-        }
-        irl = irl->nextList;
-    }
+static void NuSortByUsage(void) {
     qsort(&globalBytecodes, num_bytecodes, sizeof(globalBytecodes[0]), usage_sortfunc);
 }
 
@@ -500,10 +739,10 @@ const char *NuMergeBytecodes(const char *bcname, NuBytecode *first, NuBytecode *
     return flexbuf_get(fb);
 }
 
-static NuBytecode *NuReplaceMacro(NuIrList *lists, NuMacro *macro) {
-    NuIrList *irl = lists;
-    NuIr *ir;
+static NuBytecode *NuReplaceMacro(NuMacro *macro) {
     NuBytecode *bc, *first, *second;
+    NuPair *pair;
+    NuPairSite *site, *delsite;
 
     bc = AllocBytecode();
     if (!bc) {
@@ -517,24 +756,36 @@ static NuBytecode *NuReplaceMacro(NuIrList *lists, NuMacro *macro) {
     bc->name = auto_printf(128, "%s_%s", first->name, second->name);
     bc->impl_ptr = NuMergeBytecodes(bc->name, first, second);
     bc->impl_size = NuImplSize(bc->impl_ptr);
-    while (irl) {
-        for (ir = irl->head; ir; ir = ir->next) {
-            NuIr *delir = ir->next;
-            if (ir->bytecode == first && delir && delir->bytecode == second) {                
-                ir->bytecode = bc;
-                bc->usage++;
-                ir->next = delir->next;
-                if (ir->next) {
-                    ir->next->prev = ir;
-                } else {
-                    irl->tail = ir;
-                }
-                first->usage--;
-                second->usage--;
-            }
+
+    // replace the occurrences in program order; each replacement
+    // removes the occurrence at the head, along with any overlapping one
+    pair = NuFindPair(first, second);
+    while ( (site = pair->head) != NULL ) {
+        NuIr *ir = site->ir;
+        NuIr *delir = ir->next;
+
+        delsite = site->next;
+        NuRemovePairAt(site->prev);
+        NuRemovePairAt(site);
+        NuRemovePairAt(delsite);
+
+        ir->bytecode = bc;
+        bc->usage++;
+        ir->next = delir->next;
+        if (ir->next) {
+            ir->next->prev = ir;
+        } else {
+            site->irl->tail = ir;
         }
-        
-        irl = irl->nextList;
+        site->next = delsite->next;
+        if (site->next) {
+            site->next->prev = site;
+        }
+        first->usage--;
+        second->usage--;
+
+        NuAddPairAt(site->prev);
+        NuAddPairAt(site);
     }
     return bc;
 }
@@ -584,6 +835,9 @@ void NuCreateBytecodes(NuIrList *lists)
     }
 
     // while there's room for more bytecodes, find ways to compress the code
+    if (gl_optimize_flags & OPT_MAKE_MACROS) {
+        NuInitPairs(lists);
+    }
     while (code < (MAX_BYTECODE-1) && (gl_optimize_flags & OPT_MAKE_MACROS)) {
         int32_t val;
         int compressValue, macroValue;
@@ -591,9 +845,9 @@ void NuCreateBytecodes(NuIrList *lists)
         const char *opname;
         NuMacro *macro;
 
-        NuRecalcUsage(lists);
+        NuSortByUsage();
         bc = NuFindCompressBytecode(lists, &compressValue);
-        macro = NuScanForMacros(lists, &macroValue);
+        macro = NuFindMacro(&macroValue);
         if (bc && macro) {
             // pick which is better
             if (compressValue >= macroValue) {
@@ -637,11 +891,15 @@ void NuCreateBytecodes(NuIrList *lists)
             bc->impl_size = (immflag[0]) ? 3 : 2;
             bc->is_const = 0; // don't need to emit PUSHI for this one
         } else if (macro) {
-            bc = NuReplaceMacro(lists, macro);
+            bc = NuReplaceMacro(macro);
         } else {
             break;
         }
         bc->code = code++;
+        NuPairsCodeChanged(bc);
+    }
+    if (gl_optimize_flags & OPT_MAKE_MACROS) {
+        NuFreePairs();
     }
     // finally, sort byte bytecode
     qsort(&globalBytecodes, num_bytecodes, elemsize, codenum_sortfunc);
@@ -181,6 +181,8 @@ typedef struct NuBytecode {
     const char *impl_ptr;
     int impl_size;
     unsigned char macro_depth;
+    struct NuPair *firstPairs;  /* macro candidates starting with this bytecode */
+    struct NuPair *secondPairs; /* macro candidates ending with this bytecode */
     unsigned is_rel_branch:1;
     unsigned is_any_branch:1;
     unsigned is_inline_asm:1;
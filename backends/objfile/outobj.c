@@ -4,6 +4,24 @@
 // Copyright 2012-2020 Total Spectrum Software Inc.
 // see the file COPYING for conditions of redistribution
 //
+
+//
+// An object file is the preprocessed source of one compilation unit,
+// preceded by a header saying which global functions and variables the
+// unit defines and which names it refers to:
+//
+//   // flexobj 1 .c <compiler version>
+//   // flexobj func <name> <attributes>
+//   // flexobj var <name>
+//   // flexobj ref <name>
+//   // flexobj end
+//
+// Code generation works on the whole program at once (inlining, register
+// use, and removal of unused code all cross compilation units) so the
+// objects are parsed again when they are linked. The header lets the link
+// leave out objects nothing refers to, and the payload does not have to
+// go through the preprocessor again.
+//
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdarg.h>
@@ -11,6 +29,124 @@
 #include <math.h>
 #include <errno.h>
 #include "spinc.h"
+#include "preprocess.h"
+#include "version.h"
+
+#define OBJ_MAGIC "// flexobj "
+#define OBJ_FORMAT 1
+
+// collect all the names used in "ast" that are not in "locals"
+static void
+AddRefs(SymbolTable *refs, SymbolTable *locals, AST *ast)
+{
+    const char *name;
+
+    while (ast) {
+        name = NULL;
+        if (ast->kind == AST_IDENTIFIER) {
+            name = ast->d.string;
+        } else if (ast->kind == AST_SYMBOL) {
+            name = ((Symbol *)ast->d.ptr)->our_name;
+        }
+        if (name && !FindSymbol(refs, name) && !(locals && FindSymbol(locals, name))) {
+            AddSymbol(refs, name, SYM_NAME, NULL, NULL);
+        }
+        AddRefs(refs, locals, ast->left);
+        ast = ast->right;
+    }
+}
+
+// true if "ast" came from the file being written (rather than
+// from a library that was loaded into the module)
+static int
+FromThisUnit(Module *P, AST *ast)
+{
+    return ast && ast->lexdata == P->Lptr;
+}
+
+typedef struct objheader {
+    FILE *f;
+    SymbolTable *defs;
+} ObjHeader;
+
+static int
+PrintRef(Symbol *sym, void *arg)
+{
+    ObjHeader *H = (ObjHeader *)arg;
+
+    if (!FindSymbol(H->defs, sym->our_name)) {
+        fprintf(H->f, OBJ_MAGIC "ref %s\n", sym->our_name);
+    }
+    return 1;
+}
+
+static void
+OutputObjHeader(FILE *f, Module *P)
+{
+    SymbolTable defs, refs;
+    ObjHeader H;
+    Module *Q;
+    Function *pf;
+    AST *list, *decl, *ident;
+    const char *ext;
+
+    memset(&defs, 0, sizeof(defs));
+    memset(&refs, 0, sizeof(refs));
+    H.f = f;
+    H.defs = &defs;
+
+    ext = strrchr(P->fullname, '.');
+    if (!ext || strchr(ext, '/') || strchr(ext, '\\')) {
+        ext = ".c";
+    }
+    fprintf(f, OBJ_MAGIC "%d %s %s\n", OBJ_FORMAT, ext, version_string);
+
+    // functions defined here
+    for (pf = P->functions; pf; pf = pf->next) {
+        if (!pf->body || pf->body->kind == AST_STRING || !FromThisUnit(P, pf->decl)) {
+            continue;
+        }
+        AddSymbol(&defs, pf->name, SYM_NAME, NULL, NULL);
+        // static functions are renamed, and are not visible outside
+        if (pf->user_name && strcmp(pf->name, pf->user_name) != 0) {
+            AddSymbol(&defs, pf->user_name, SYM_NAME, NULL, NULL);
+            continue;
+        }
+        fprintf(f, OBJ_MAGIC "func %s %x\n", pf->name, pf->attributes);
+    }
+    // variables defined here, with or without initializers
+    for (list = P->datblock; list; list = list->right) {
+        decl = list->left;
+        if (decl && decl->kind == AST_COMMENTEDNODE) {
+            decl = decl->left;
+        }
+        if (!decl || decl->kind != AST_DECLARE_VAR) {
+            AddRefs(&refs, NULL, decl);
+            continue;
+        }
+        ident = decl->right;
+        if (ident && ident->kind == AST_ASSIGN) {
+            AddRefs(&refs, NULL, ident->right);
+            ident = ident->left;
+        }
+        if (!ident || !IsIdentifier(ident) || !FromThisUnit(P, ident)) continue;
+        AddSymbol(&defs, GetIdentifierName(ident), SYM_NAME, NULL, NULL);
+        fprintf(f, OBJ_MAGIC "var %s\n", GetIdentifierName(ident));
+    }
+
+    // names used here
+    for (Q = allparse; Q; Q = Q->next) {
+        if (IsSystemModule(Q)) continue;
+        for (pf = Q->functions; pf; pf = pf->next) {
+            if (FromThisUnit(P, pf->decl)) {
+                AddRefs(&refs, &pf->localsyms, pf->body);
+            }
+        }
+    }
+    IterateOverSymbols(&refs, PrintRef, &H);
+
+    fprintf(f, OBJ_MAGIC "end\n");
+}
 
 void
 OutputObjFile(const char *fname, Module *P)
@@ -28,6 +164,7 @@ OutputObjFile(const char *fname, Module *P)
         gl_errors++;
         return;
     }
+    OutputObjHeader(f, P);
     srcinfo = (LineInfo *)flexbuf_peek(&L->lineInfo);
     maxline = flexbuf_curlen(&L->lineInfo) / sizeof(LineInfo);
 
@@ -38,3 +175,190 @@ OutputObjFile(const char *fname, Module *P)
     }
     fclose(f);
 }
+
+//
+// if "text" starts with an object file header, return a pointer to
+// the preprocessed source after it, otherwise NULL
+//
+char *
+ObjFilePayload(char *text)
+{
+    char *ptr;
+
+    if (strncmp(text, OBJ_MAGIC, strlen(OBJ_MAGIC)) != 0) {
+        return NULL;
+    }
+    ptr = strstr(text, "\n" OBJ_MAGIC "end\n");
+    if (!ptr) {
+        return NULL;
+    }
+    return ptr + strlen("\n" OBJ_MAGIC "end\n");
+}
+
+//
+// linking: figure out which of the object files on the command line
+// are actually needed
+//
+
+typedef struct objinfo {
+    const char *name;     // name as given on the command line
+    int keep;
+    int queued;
+    Flexbuf refs;         // array of const char *
+    struct objinfo *nextQueued;
+} ObjInfo;
+
+typedef struct objdef {
+    ObjInfo *obj;
+    struct objdef *next;
+} ObjDef;
+
+static void
+AddObjDef(SymbolTable *defs, const char *name, ObjInfo *obj)
+{
+    Symbol *sym = FindSymbol(defs, name);
+    ObjDef *D = (ObjDef *)calloc(1, sizeof(*D));
+
+    D->obj = obj;
+    if (sym) {
+        D->next = (ObjDef *)sym->val;
+        sym->val = (void *)D;
+    } else {
+        AddSymbol(defs, strdup(name), SYM_NAME, (void *)D, NULL);
+    }
+}
+
+//
+// read the header of object file "name"; returns 0 if it is not an
+// object file we understand
+//
+static int
+ReadObjHeader(const char *name, ObjInfo *obj, SymbolTable *defs)
+{
+    char buf[1024];
+    char word[256];
+    char *fname;
+    char *ptr;
+    unsigned attributes;
+    int format = 0;
+    int ok = 0;
+    FILE *f;
+
+    fname = find_file_on_path(&gl_pp, name, ".o", NULL);
+    f = fopen(fname ? fname : name, "r");
+    if (!f) {
+        return 0;
+    }
+    ptr = fgets(buf, sizeof(buf), f);
+    if (!ptr || strncmp(buf, OBJ_MAGIC, strlen(OBJ_MAGIC)) != 0
+        || sscanf(buf + strlen(OBJ_MAGIC), "%d %255s", &format, word) != 2
+        || format != OBJ_FORMAT)
+    {
+        fclose(f);
+        return 0;
+    }
+    // only C objects have enough information to be left out
+    obj->keep = strcmp(word, ".c") != 0;
+    while (fgets(buf, sizeof(buf), f)) {
+        if (strncmp(buf, OBJ_MAGIC, strlen(OBJ_MAGIC)) != 0) {
+            break;
+        }
+        ptr = buf + strlen(OBJ_MAGIC);
+        if (!strncmp(ptr, "end", 3)) {
+            ok = 1;
+            break;
+        }
+        attributes = 0;
+        if (sscanf(ptr, "func %255s %x", word, &attributes) >= 1) {
+            AddObjDef(defs, word, obj);
+            if (!strcmp(word, "main")
+                || (attributes & (FUNC_ATTR_CONSTRUCTOR|FUNC_ATTR_NEEDSINIT)))
+            {
+                obj->keep = 1;
+            }
+        } else if (sscanf(ptr, "var %255s", word) == 1) {
+            AddObjDef(defs, word, obj);
+        } else if (sscanf(ptr, "ref %255s", word) == 1) {
+            ptr = strdup(word);
+            flexbuf_addmem(&obj->refs, (char *)&ptr, sizeof(ptr));
+        }
+    }
+    fclose(f);
+    return ok;
+}
+
+//
+// given the list of files to link, return the list with any object
+// files that nothing refers to removed; "*argcp" is updated with the
+// new count
+//
+const char **
+LinkObjFiles(const char *argv[], int *argcp)
+{
+    int argc = *argcp;
+    ObjInfo *objs;
+    ObjInfo *queue = NULL;
+    ObjInfo *obj;
+    ObjDef *D;
+    SymbolTable defs;
+    Symbol *sym;
+    const char **newargv;
+    const char **refs;
+    const char *ext;
+    int i, n, numrefs;
+    int roots = 0;
+
+    memset(&defs, 0, sizeof(defs));
+    objs = (ObjInfo *)calloc(argc, sizeof(*objs));
+    for (i = 0; i < argc; i++) {
+        obj = &objs[i];
+        obj->name = argv[i];
+        flexbuf_init(&obj->refs, 256);
+        ext = strrchr(argv[i], '.');
+        // if any input is not an object file, we cannot tell what it uses
+        if (!ext || strcmp(ext, ".o") != 0 || !ReadObjHeader(argv[i], obj, &defs)) {
+            return argv;
+        }
+        if (obj->keep) {
+            obj->queued = 1;
+            obj->nextQueued = queue;
+            queue = obj;
+            roots++;
+        }
+    }
+    if (!roots) {
+        // no main program among the objects; keep everything
+        return argv;
+    }
+
+    // everything defining a name used by a kept object is kept too
+    while (queue) {
+        obj = queue;
+        queue = obj->nextQueued;
+        obj->keep = 1;
+        refs = (const char **)flexbuf_peek(&obj->refs);
+        numrefs = flexbuf_curlen(&obj->refs) / sizeof(*refs);
+        for (i = 0; i < numrefs; i++) {
+            sym = FindSymbol(&defs, refs[i]);
+            for (D = sym ? (ObjDef *)sym->val : NULL; D; D = D->next) {
+                if (!D->obj->queued) {
+                    D->obj->queued = 1;
+                    D->obj->nextQueued = queue;
+                    queue = D->obj;
+                }
+            }
+        }
+    }
+
+    newargv = (const char **)calloc(argc + 1, sizeof(*newargv));
+    n = 0;
+    for (i = 0; i < argc; i++) {
+        if (objs[i].keep) {
+            newargv[n++] = argv[i];
+        } else {
+            DEBUG(NULL, "Leaving out %s: nothing refers to it", argv[i]);
+        }
+    }
+    *argcp = n;
+    return newargv;
+}
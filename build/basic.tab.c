@@ -0,0 +1,7070 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 1
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+/* Substitute the type names.  */
+#define YYSTYPE         BASICYYSTYPE
+/* Substitute the variable and function names.  */
+#define yyparse         basicyyparse
+#define yylex           basicyylex
+#define yyerror         basicyyerror
+#define yydebug         basicyydebug
+#define yynerrs         basicyynerrs
+
+/* First part of user prologue.  */
+#line 9 "frontends/basic/basic.y"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <ctype.h>
+#include <stdlib.h>
+#include "frontends/common.h"
+#include "frontends/lexer.h"
+
+#define BASICYYSTYPE AST*
+#undef  YYSTYPE
+#define YYSTYPE BASICYYSTYPE
+    
+/* Yacc functions */
+    void basicyyerror(const char *);
+    int basicyylex();
+
+    extern int gl_errors;
+
+    extern AST *last_ast;
+    extern AST *CommentedListHolder(AST *); // in spin.y
+    
+#define YYERROR_VERBOSE 1
+
+extern AST *IntegerLabel(AST *);
+    
+AST *GetIORegisterPair(const char *name1, const char *name2)
+{
+    Symbol *sym = FindSymbol(&basicReservedWords, name1);
+    AST *reg1, *reg2;
+    if (!sym) {
+        SYNTAX_ERROR("Unknown ioregister %s", name1);
+        return NULL;
+    }
+    reg1 = NewAST(AST_HWREG, NULL, NULL);
+    reg2 = NULL;
+    
+    reg1->d.ptr = sym->val;
+    if (name2 && gl_p2) {
+        // for now, only use the register pairs on P2 (where it matters)
+        // (FIXME? it could also come into play for P1V on FPGA...)
+        sym = FindSymbol(&basicReservedWords, name2);
+        if (sym) {
+            reg2 = NewAST(AST_HWREG, NULL, NULL);
+            reg2->d.ptr = sym->val;
+        }
+    }
+    if (reg2) {
+        reg1 = NewAST(AST_REGPAIR, reg1, reg2);
+    }
+    return reg1;
+}
+
+AST *GetPinRange(const char *name1, const char *name2, AST *range)
+{
+    AST *reg = GetIORegisterPair(name1, name2);
+    AST *ast = NULL;
+    if (reg) {
+        ast = NewAST(AST_RANGEREF, reg, range);
+    }
+    return ast;
+}
+
+static AST *
+InputHandle(AST *h)
+{
+    return h ? h : AstInteger(0);
+}
+
+static AST *
+OutputHandle(AST *h)
+{
+    return h ? h : AstInteger(1);
+}
+
+#define ARRAY_BASE_NAME "__array_base"
+#define IMPLICIT_TYPE_NAME "__implicit_types"
+#define EXPLICIT_DECL_NAME "__explicit_declares_required"
+/* __explicit_declares_required is a bitmask saying which kinds of things
+ * require explicit declarations:
+ *  1 == assignment statements without LET
+ *  2 == assignment statements with LET
+ *  4 == read statements
+ *  8 == for loop variables
+ */
+#define DEFAULT_EXPLICIT_DECLARES 0x5
+#define GetExplicitDeclares() GetCurOptionSymbol(EXPLICIT_DECL_NAME, DEFAULT_EXPLICIT_DECLARES)
+
+Symbol *
+GetCurOptionSymbol(const char *name, int defval)
+{
+#if 0
+    // this would make option base work nicely inside scopes
+    SymbolTable *symtab = currentTypes;
+#else
+    // this is more practical and keeps a value for option base that we
+    // can use later for pointer dereferences
+    SymbolTable *symtab = current ? &current->objsyms : currentTypes;
+#endif    
+    Symbol *sym = LookupSymbolInTable(symtab, name);
+    if (!sym) {
+        sym = AddSymbol(symtab, name, SYM_CONSTANT, AstInteger(defval), NULL);
+    }
+    return sym;
+}
+
+Symbol *
+GetCurArrayBase(void)
+{
+    return GetCurOptionSymbol(ARRAY_BASE_NAME, 0);
+}
+
+Symbol *
+GetCurImplicitTypes(void)
+{
+    return GetCurOptionSymbol(IMPLICIT_TYPE_NAME, 0);
+}
+
+static AST *
+HandleBASICOption(AST *optid, AST *exprlist)
+{
+    const char *name = GetIdentifierName(optid);
+    AST *expr;
+    Symbol *sym;
+    if (!name) {
+        SYNTAX_ERROR("Error in option list");
+        return NULL;
+    }
+    if (!strcasecmp(name, "base")) {
+        int arrayBase;
+        expr = NULL;
+        if (exprlist && exprlist->kind == AST_EXPRLIST) {
+            expr = exprlist->left;
+            exprlist = exprlist->right;
+            if (exprlist) expr = NULL;
+        }
+        if (!expr || !IsConstExpr(expr)) {
+            SYNTAX_ERROR("option base must be followed by an integer");
+            return NULL;
+        }
+        arrayBase = EvalConstExpr(expr);
+        sym = GetCurArrayBase();
+        sym->val = AstInteger(arrayBase);
+    } else if (!strcasecmp(name, "explicit")) {
+        sym = GetExplicitDeclares();
+        sym->val = AstInteger(255);
+    } else if (!strcasecmp(name, "implicit")) {
+        sym = GetExplicitDeclares();
+        sym->val = AstInteger(0);
+    } else {
+        SYNTAX_ERROR("Unknown option %s", name);
+    }
+    return NULL;
+}
+
+AST *
+DefineDefaultVarTypes(AST *deflist, AST *type)
+{
+    Symbol *sym = GetCurImplicitTypes();
+    AST *entry;
+    const char *first, *last;
+    uint32_t flags;
+    uint32_t low, high;
+    uint32_t mask;
+
+    flags = EvalConstExpr( (AST *)sym->val );
+    if (IsIntType(type)) {
+        mask = 0;
+    } else if (IsFloatType(type)) {
+        mask = 1;
+    } else {
+        SYNTAX_ERROR("defXXX is supported only for int and sng");
+        return NULL;
+    }
+    while (deflist) {
+        entry = deflist->left;
+        deflist = deflist->right;
+        if (entry->kind != AST_SEQUENCE) {
+            SYNTAX_ERROR("Internal error, expected AST_SEQUENCE");
+            return NULL;
+        }
+        if (!entry->left || !entry->right) {
+            SYNTAX_ERROR("Internal error in defvar parsing");
+            return NULL;
+        }
+        first = GetIdentifierName(entry->left);
+        last = GetIdentifierName(entry->right);
+        low = toupper(first[0]) - 'A';
+        high = toupper(last[0]) - 'A';
+        if (strlen(first) != 1 || strlen(last) != 1 || low > 25 || high > 25) {
+            SYNTAX_ERROR("defXXX requires single letters in patterns");
+            return NULL;
+        }
+        if (high < low) {
+            WARNING(NULL, "range `%c' - `%c' is empty", low, high);
+        }
+        while (low <= high) {
+            if (mask) {
+                flags |= (1U << low);
+            } else {
+                flags &= ~(1U << low);
+            }
+            low++;
+        }
+    }
+    sym->val = AstInteger(flags);
+    return NULL;
+}
+
+void
+DeclareBASICMemberVariables(AST *ast)
+{
+    AST *idlist, *typ;
+    AST *ident;
+    int is_private = 0;
+    
+    if (!ast) return;
+    if (ast->kind == AST_SEQUENCE) {
+        ERROR(ast, "Internal error, unexpected sequence");
+        return;
+    }
+    if (ast->kind == AST_DECLARE_ALIAS) {
+        AST *newname = ast->left;
+        AST *oldname = ast->right;
+        Symbol *sym;
+        if (!newname || !oldname) {
+            ERROR(ast, "Internal error, bad alias structure");
+            return;
+        }
+        sym = DeclareAlias(&current->objsyms, newname, oldname);
+        (void)sym;
+        return;
+    }
+    if (ast->kind != AST_DECLARE_VAR) {
+        ERROR(ast, "Internal error, unexpected ast");
+        return;
+    }
+    idlist = ast->right;
+    typ = ast->left;
+    if (idlist->kind == AST_LISTHOLDER) {
+        while (idlist) {
+            ident = idlist->left;
+            MaybeDeclareMemberVar(current, ident, typ, is_private, NORMAL_VAR);
+            idlist = idlist->right;
+        }
+    } else {
+        MaybeDeclareMemberVar(current, idlist, typ, is_private, NORMAL_VAR);
+    }
+    return;
+}
+
+void
+DeclareBASICSharedVariables(AST *ast)
+{
+    // declare globals in DAT section
+    DeclareTypedGlobalVariables(ast, 1);
+}
+
+AST *BASICArrayRef(AST *id, AST *expr)
+{
+    AST *ast;
+    ast = NewAST(AST_ARRAYREF, id, expr);
+    return ast;
+}
+
+AST *AstCharItem(int c)
+{
+    AST *expr = NewAST(AST_CHAR, AstInteger(c), NULL);
+    return NewAST(AST_EXPRLIST, expr, NULL);
+}
+
+AST *AddTemplateTypes(AST *list)
+{
+  AST *orig = list;
+  AST *ident;
+  while (list) {
+    ident = list->left;
+    list = list->right;
+    AddSymbol(currentTypes, ident->d.string, SYM_TYPEDEF, (void *)ident, NULL);
+  }
+  return orig;
+}
+
+#define MAX_LOOP_NEST 256
+static int loop_stack[MAX_LOOP_NEST];
+static int loop_sp;
+
+static void
+PushLoop(int token)
+{
+    if (loop_sp >= MAX_LOOP_NEST) {
+        SYNTAX_ERROR("loops nested too deeply");
+    } else {
+        loop_stack[loop_sp++] = token;
+    }
+}
+
+static void
+PopLoop(void)
+{
+    if (loop_sp > 0) {
+        --loop_sp;
+    }
+}
+
+static int
+GetCurrentLoop(int token)
+{
+    if (loop_sp == 0 || (token && loop_stack[loop_sp-1] != token)) {
+        return 0;
+    }
+    return 1;
+}
+
+static AST *
+BuildOnGotoCases(AST *exprlist)
+{
+    AST *list = NULL;
+    AST *target;
+    AST *item;
+    int index = 1;
+    AST *gostmt;
+    while (exprlist) {
+        target = exprlist->left;
+        exprlist = exprlist->right;
+        if (IsIdentifier(target)) {
+            gostmt = NewAST(AST_GOTO, target, NULL);
+        } else if (target->kind == AST_INTEGER) {
+            gostmt = NewAST(AST_GOTO, IntegerLabel(target), NULL);
+        } else {
+            SYNTAX_ERROR("ON GOTO accepts labels or integers only");
+            return NULL;
+        }
+        gostmt = NewAST(AST_STMTLIST, gostmt, NULL);
+        item = NewAST(AST_EXPRLIST, AstInteger(index), NULL);
+        item = NewAST(AST_CASEITEM, item, gostmt);
+        item = NewAST(AST_STMTLIST, item, NULL);
+        list = AddToList(list, item);
+        index++;
+    }
+    return list;
+}
+
+static AST *
+AdjustParamType(AST *param)
+{
+    AST *typ = param->left;
+    if (typ && !IsIdentifier(typ) && (IsClassType(typ) || IsArrayType(typ))) {
+        param->left = NewAST(AST_REFTYPE, typ, NULL);
+    }
+    return param;        
+}
+
+static AST *
+AdjustParamForByRef(AST *param)
+{
+    AST *typ = param->left;
+    param->left = NewAST(AST_REFTYPE, typ, NULL);
+    return param;
+}
+
+static AST *
+AdjustParamForByVal(AST *param)
+{
+    AST *typ = param->left;
+    if (typ && !IsIdentifier(typ) && (IsClassType(typ) || IsArrayType(typ))) {
+        param->left = NewAST(AST_COPYREFTYPE, typ, NULL);
+    }
+    return param;
+}
+
+
+#line 449 "./build/basic.tab.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "basic.tab.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_BAS_EMPTY = 3,                  /* "_"  */
+  YYSYMBOL_BAS_IDENTIFIER = 4,             /* "identifier"  */
+  YYSYMBOL_BAS_LABEL_INFERRED = 5,         /* "label"  */
+  YYSYMBOL_BAS_LABEL_EXPLICIT = 6,         /* "label:"  */
+  YYSYMBOL_BAS_INTEGER = 7,                /* "integer number"  */
+  YYSYMBOL_BAS_FLOAT = 8,                  /* "number"  */
+  YYSYMBOL_BAS_STRING = 9,                 /* "literal string"  */
+  YYSYMBOL_BAS_EOLN = 10,                  /* "end of line"  */
+  YYSYMBOL_BAS_EOF = 11,                   /* "end of file"  */
+  YYSYMBOL_BAS_TYPENAME = 12,              /* "type name"  */
+  YYSYMBOL_BAS_INSTR = 13,                 /* "asm instruction"  */
+  YYSYMBOL_BAS_INSTRMODIFIER = 14,         /* "asm instruction modifier"  */
+  YYSYMBOL_BAS_HWREG = 15,                 /* "hardware register"  */
+  YYSYMBOL_BAS_ALIGNL = 16,                /* "alignl"  */
+  YYSYMBOL_BAS_ALIGNW = 17,                /* "alignw"  */
+  YYSYMBOL_BAS_FILE = 18,                  /* "file"  */
+  YYSYMBOL_BAS_FIT = 19,                   /* "fit"  */
+  YYSYMBOL_BAS_ORG = 20,                   /* "org"  */
+  YYSYMBOL_BAS_ORGF = 21,                  /* "orgf"  */
+  YYSYMBOL_BAS_ORGH = 22,                  /* "orgh"  */
+  YYSYMBOL_BAS_RES = 23,                   /* "res"  */
+  YYSYMBOL_BAS_ABS = 24,                   /* "abs"  */
+  YYSYMBOL_BAS_ALIAS = 25,                 /* "alias"  */
+  YYSYMBOL_BAS_AND = 26,                   /* "and"  */
+  YYSYMBOL_BAS_ANDALSO = 27,               /* "andalso"  */
+  YYSYMBOL_BAS_ANY = 28,                   /* "any"  */
+  YYSYMBOL_BAS_APPEND = 29,                /* "append"  */
+  YYSYMBOL_BAS_AS = 30,                    /* "as"  */
+  YYSYMBOL_BAS_ASC = 31,                   /* "asc"  */
+  YYSYMBOL_BAS_ASM = 32,                   /* "asm"  */
+  YYSYMBOL_BAS_ALLOCA = 33,                /* "__builtin_alloca"  */
+  YYSYMBOL_BAS_BYREF = 34,                 /* "byref"  */
+  YYSYMBOL_BAS_BYTE = 35,                  /* "byte"  */
+  YYSYMBOL_BAS_BYVAL = 36,                 /* "byval"  */
+  YYSYMBOL_BAS_CALL = 37,                  /* "call"  */
+  YYSYMBOL_BAS_CASE = 38,                  /* "case"  */
+  YYSYMBOL_BAS_CAST = 39,                  /* "cast"  */
+  YYSYMBOL_BAS_CATCH = 40,                 /* "catch"  */
+  YYSYMBOL_BAS_CHAIN = 41,                 /* "chain"  */
+  YYSYMBOL_BAS_CLASS = 42,                 /* "class"  */
+  YYSYMBOL_BAS_CLOSE = 43,                 /* "close"  */
+  YYSYMBOL_BAS_CONST = 44,                 /* "const"  */
+  YYSYMBOL_BAS_CONTINUE = 45,              /* "continue"  */
+  YYSYMBOL_BAS_CPU = 46,                   /* "cpu"  */
+  YYSYMBOL_BAS_DATA = 47,                  /* "data"  */
+  YYSYMBOL_BAS_DECLARE = 48,               /* "declare"  */
+  YYSYMBOL_BAS_DEF = 49,                   /* "def"  */
+  YYSYMBOL_BAS_DEFINT = 50,                /* "defint"  */
+  YYSYMBOL_BAS_DEFSNG = 51,                /* "defsng"  */
+  YYSYMBOL_BAS_DELETE = 52,                /* "delete"  */
+  YYSYMBOL_BAS_DIM = 53,                   /* "dim"  */
+  YYSYMBOL_BAS_DIRECTION = 54,             /* "direction"  */
+  YYSYMBOL_BAS_DO = 55,                    /* "do"  */
+  YYSYMBOL_BAS_DOUBLE = 56,                /* "double"  */
+  YYSYMBOL_BAS_ELSE = 57,                  /* "else"  */
+  YYSYMBOL_BAS_END = 58,                   /* "end"  */
+  YYSYMBOL_BAS_ENDIF = 59,                 /* "endif"  */
+  YYSYMBOL_BAS_ENUM = 60,                  /* "enum"  */
+  YYSYMBOL_BAS_EXIT = 61,                  /* "exit"  */
+  YYSYMBOL_BAS_EXTERN = 62,                /* "extern"  */
+  YYSYMBOL_BAS_FIXED = 63,                 /* "fixed"  */
+  YYSYMBOL_BAS_FOR = 64,                   /* "for"  */
+  YYSYMBOL_BAS_FUNCTION = 65,              /* "function"  */
+  YYSYMBOL_BAS_FUNC_NAME = 66,             /* "__FUNCTION__"  */
+  YYSYMBOL_BAS_GET = 67,                   /* "get"  */
+  YYSYMBOL_BAS_GOTO = 68,                  /* "goto"  */
+  YYSYMBOL_BAS_GOSUB = 69,                 /* "gosub"  */
+  YYSYMBOL_BAS_HASMETHOD = 70,             /* "_hasmethod"  */
+  YYSYMBOL_BAS_IF = 71,                    /* "if"  */
+  YYSYMBOL_BAS_IMPORT = 72,                /* "import"  */
+  YYSYMBOL_BAS_INPUT = 73,                 /* "input"  */
+  YYSYMBOL_BAS_CAST_INT = 74,              /* "int"  */
+  YYSYMBOL_BAS_INTEGER_KW = 75,            /* "integer"  */
+  YYSYMBOL_BAS_LET = 76,                   /* "let"  */
+  YYSYMBOL_BAS_LIB = 77,                   /* "lib"  */
+  YYSYMBOL_BAS_LINE = 78,                  /* "line"  */
+  YYSYMBOL_BAS_LONG = 79,                  /* "long"  */
+  YYSYMBOL_BAS_LONGINT = 80,               /* "longint"  */
+  YYSYMBOL_BAS_LOOP = 81,                  /* "loop"  */
+  YYSYMBOL_BAS_MOD = 82,                   /* "mod"  */
+  YYSYMBOL_BAS_NEW = 83,                   /* "new"  */
+  YYSYMBOL_BAS_NEXT = 84,                  /* "next"  */
+  YYSYMBOL_BAS_NIL = 85,                   /* "nil"  */
+  YYSYMBOL_BAS_NOT = 86,                   /* "not"  */
+  YYSYMBOL_BAS_ON = 87,                    /* "on"  */
+  YYSYMBOL_BAS_OPEN = 88,                  /* "open"  */
+  YYSYMBOL_BAS_OPTION = 89,                /* "option"  */
+  YYSYMBOL_BAS_OR = 90,                    /* "or"  */
+  YYSYMBOL_BAS_ORELSE = 91,                /* "orelse"  */
+  YYSYMBOL_BAS_OUTPUT = 92,                /* "output"  */
+  YYSYMBOL_BAS_POINTER = 93,               /* "pointer"  */
+  YYSYMBOL_BAS_PRINT = 94,                 /* "print"  */
+  YYSYMBOL_BAS_PRIVATE = 95,               /* "private"  */
+  YYSYMBOL_BAS_PROGRAM = 96,               /* "program"  */
+  YYSYMBOL_BAS_PTR = 97,                   /* "ptr"  */
+  YYSYMBOL_BAS_PUT = 98,                   /* "put"  */
+  YYSYMBOL_BAS_READ = 99,                  /* "read"  */
+  YYSYMBOL_BAS_RESTORE = 100,              /* "restore"  */
+  YYSYMBOL_BAS_RETURN = 101,               /* "return"  */
+  YYSYMBOL_BAS_SAMETYPES = 102,            /* "_sametypes"  */
+  YYSYMBOL_BAS_SELECT = 103,               /* "select"  */
+  YYSYMBOL_BAS_SELF = 104,                 /* "self"  */
+  YYSYMBOL_BAS_SHARED = 105,               /* "shared"  */
+  YYSYMBOL_BAS_SHORT = 106,                /* "short"  */
+  YYSYMBOL_BAS_SINGLE = 107,               /* "single"  */
+  YYSYMBOL_BAS_SIZEOF = 108,               /* "sizeof"  */
+  YYSYMBOL_BAS_SQRT = 109,                 /* "sqrt"  */
+  YYSYMBOL_BAS_STEP = 110,                 /* "step"  */
+  YYSYMBOL_BAS_STRING_KW = 111,            /* "string"  */
+  YYSYMBOL_BAS_STRUCT = 112,               /* "struct"  */
+  YYSYMBOL_BAS_SUB = 113,                  /* "sub"  */
+  YYSYMBOL_BAS_THEN = 114,                 /* "then"  */
+  YYSYMBOL_BAS_THROW = 115,                /* "throw"  */
+  YYSYMBOL_BAS_THROWIFCAUGHT = 116,        /* "throwifcaught"  */
+  YYSYMBOL_BAS_TO = 117,                   /* "to"  */
+  YYSYMBOL_BAS_TRY = 118,                  /* "try"  */
+  YYSYMBOL_BAS_TYPE = 119,                 /* "type"  */
+  YYSYMBOL_BAS_UBYTE = 120,                /* "ubyte"  */
+  YYSYMBOL_BAS_UINTEGER = 121,             /* "uinteger"  */
+  YYSYMBOL_BAS_ULONG = 122,                /* "ulong"  */
+  YYSYMBOL_BAS_ULONGINT = 123,             /* "ulongint"  */
+  YYSYMBOL_BAS_UNTIL = 124,                /* "until"  */
+  YYSYMBOL_BAS_USHORT = 125,               /* "ushort"  */
+  YYSYMBOL_BAS_USING = 126,                /* "using"  */
+  YYSYMBOL_BAS_VAR = 127,                  /* "var"  */
+  YYSYMBOL_BAS_WEND = 128,                 /* "wend"  */
+  YYSYMBOL_BAS_WITH = 129,                 /* "with"  */
+  YYSYMBOL_BAS_WHILE = 130,                /* "while"  */
+  YYSYMBOL_BAS_WORD = 131,                 /* "word"  */
+  YYSYMBOL_BAS_XOR = 132,                  /* "xor"  */
+  YYSYMBOL_BAS_LE = 133,                   /* "<="  */
+  YYSYMBOL_BAS_GE = 134,                   /* ">="  */
+  YYSYMBOL_BAS_NE = 135,                   /* "<>"  */
+  YYSYMBOL_BAS_SHL = 136,                  /* "shl"  */
+  YYSYMBOL_BAS_SHR = 137,                  /* "shr"  */
+  YYSYMBOL_BAS_ADD_ASSIGN = 138,           /* "+="  */
+  YYSYMBOL_BAS_SUB_ASSIGN = 139,           /* "-="  */
+  YYSYMBOL_BAS_MUL_ASSIGN = 140,           /* "*="  */
+  YYSYMBOL_BAS_DIV_ASSIGN = 141,           /* "/="  */
+  YYSYMBOL_BAS_MOD_ASSIGN = 142,           /* "MOD="  */
+  YYSYMBOL_BAS_AND_ASSIGN = 143,           /* "AND="  */
+  YYSYMBOL_BAS_OR_ASSIGN = 144,            /* "OR="  */
+  YYSYMBOL_BAS_XOR_ASSIGN = 145,           /* "XOR="  */
+  YYSYMBOL_146_ = 146,                     /* '<'  */
+  YYSYMBOL_147_ = 147,                     /* '>'  */
+  YYSYMBOL_148_ = 148,                     /* '='  */
+  YYSYMBOL_149_ = 149,                     /* '-'  */
+  YYSYMBOL_150_ = 150,                     /* '+'  */
+  YYSYMBOL_151_ = 151,                     /* '*'  */
+  YYSYMBOL_152_ = 152,                     /* '/'  */
+  YYSYMBOL_153_ = 153,                     /* '@'  */
+  YYSYMBOL_154_ = 154,                     /* '.'  */
+  YYSYMBOL_155_ = 155,                     /* '('  */
+  YYSYMBOL_156_ = 156,                     /* ':'  */
+  YYSYMBOL_157_ = 157,                     /* ')'  */
+  YYSYMBOL_158_ = 158,                     /* ','  */
+  YYSYMBOL_159_ = 159,                     /* '#'  */
+  YYSYMBOL_160_ = 160,                     /* ';'  */
+  YYSYMBOL_161_ = 161,                     /* '\\'  */
+  YYSYMBOL_162_ = 162,                     /* '['  */
+  YYSYMBOL_163_ = 163,                     /* ']'  */
+  YYSYMBOL_164_ = 164,                     /* '^'  */
+  YYSYMBOL_165_ = 165,                     /* '{'  */
+  YYSYMBOL_166_ = 166,                     /* '}'  */
+  YYSYMBOL_YYACCEPT = 167,                 /* $accept  */
+  YYSYMBOL_toplist = 168,                  /* toplist  */
+  YYSYMBOL_eoln = 169,                     /* eoln  */
+  YYSYMBOL_eolnseq = 170,                  /* eolnseq  */
+  YYSYMBOL_toplabel = 171,                 /* toplabel  */
+  YYSYMBOL_topitem = 172,                  /* topitem  */
+  YYSYMBOL_wrapped_stmt = 173,             /* wrapped_stmt  */
+  YYSYMBOL_optstatementlist = 174,         /* optstatementlist  */
+  YYSYMBOL_stmtlistitem = 175,             /* stmtlistitem  */
+  YYSYMBOL_statementlist = 176,            /* statementlist  */
+  YYSYMBOL_realstatementlist = 177,        /* realstatementlist  */
+  YYSYMBOL_ifline = 178,                   /* ifline  */
+  YYSYMBOL_statement = 179,                /* statement  */
+  YYSYMBOL_assignment_operator = 180,      /* assignment_operator  */
+  YYSYMBOL_varassignlist = 181,            /* varassignlist  */
+  YYSYMBOL_multivars = 182,                /* multivars  */
+  YYSYMBOL_simple_assign_statement = 183,  /* simple_assign_statement  */
+  YYSYMBOL_assign_statement = 184,         /* assign_statement  */
+  YYSYMBOL_branchstmt = 185,               /* branchstmt  */
+  YYSYMBOL_optcomma = 186,                 /* optcomma  */
+  YYSYMBOL_file_handle = 187,              /* file_handle  */
+  YYSYMBOL_iostmt = 188,                   /* iostmt  */
+  YYSYMBOL_inputitem = 189,                /* inputitem  */
+  YYSYMBOL_inputlist = 190,                /* inputlist  */
+  YYSYMBOL_printitem = 191,                /* printitem  */
+  YYSYMBOL_rawprintlist = 192,             /* rawprintlist  */
+  YYSYMBOL_usingprintlist = 193,           /* usingprintlist  */
+  YYSYMBOL_printlist = 194,                /* printlist  */
+  YYSYMBOL_putgetargs = 195,               /* putgetargs  */
+  YYSYMBOL_optzeroexpritem = 196,          /* optzeroexpritem  */
+  YYSYMBOL_optvar = 197,                   /* optvar  */
+  YYSYMBOL_ifstmt = 198,                   /* ifstmt  */
+  YYSYMBOL_thenelseblock = 199,            /* thenelseblock  */
+  YYSYMBOL_endif = 200,                    /* endif  */
+  YYSYMBOL_whilestmt = 201,                /* whilestmt  */
+  YYSYMBOL_202_1 = 202,                    /* $@1  */
+  YYSYMBOL_endwhile = 203,                 /* endwhile  */
+  YYSYMBOL_doloopstmt = 204,               /* doloopstmt  */
+  YYSYMBOL_205_2 = 205,                    /* $@2  */
+  YYSYMBOL_206_3 = 206,                    /* $@3  */
+  YYSYMBOL_207_4 = 207,                    /* $@4  */
+  YYSYMBOL_doloopend = 208,                /* doloopend  */
+  YYSYMBOL_selectstmt = 209,               /* selectstmt  */
+  YYSYMBOL_casematchlist = 210,            /* casematchlist  */
+  YYSYMBOL_casematchitem = 211,            /* casematchitem  */
+  YYSYMBOL_casematch = 212,                /* casematch  */
+  YYSYMBOL_caseitem = 213,                 /* caseitem  */
+  YYSYMBOL_caselist = 214,                 /* caselist  */
+  YYSYMBOL_forstmt = 215,                  /* forstmt  */
+  YYSYMBOL_216_5 = 216,                    /* $@5  */
+  YYSYMBOL_endfor = 217,                   /* endfor  */
+  YYSYMBOL_optstep = 218,                  /* optstep  */
+  YYSYMBOL_trycatchstmt = 219,             /* trycatchstmt  */
+  YYSYMBOL_endtry = 220,                   /* endtry  */
+  YYSYMBOL_exitstmt = 221,                 /* exitstmt  */
+  YYSYMBOL_topdecl = 222,                  /* topdecl  */
+  YYSYMBOL_defitem = 223,                  /* defitem  */
+  YYSYMBOL_deflist = 224,                  /* deflist  */
+  YYSYMBOL_varexpr = 225,                  /* varexpr  */
+  YYSYMBOL_varassigntarget = 226,          /* varassigntarget  */
+  YYSYMBOL_pinrange = 227,                 /* pinrange  */
+  YYSYMBOL_register_expr = 228,            /* register_expr  */
+  YYSYMBOL_np_primary_expr = 229,          /* np_primary_expr  */
+  YYSYMBOL_primary_expr = 230,             /* primary_expr  */
+  YYSYMBOL_unary_op = 231,                 /* unary_op  */
+  YYSYMBOL_pseudofunc_expr = 232,          /* pseudofunc_expr  */
+  YYSYMBOL_unary_expr = 233,               /* unary_expr  */
+  YYSYMBOL_np_unary_expr = 234,            /* np_unary_expr  */
+  YYSYMBOL_lambdaexpr = 235,               /* lambdaexpr  */
+  YYSYMBOL_opttype = 236,                  /* opttype  */
+  YYSYMBOL_mult_op = 237,                  /* mult_op  */
+  YYSYMBOL_power_expr = 238,               /* power_expr  */
+  YYSYMBOL_np_power_expr = 239,            /* np_power_expr  */
+  YYSYMBOL_mult_expr = 240,                /* mult_expr  */
+  YYSYMBOL_np_mult_expr = 241,             /* np_mult_expr  */
+  YYSYMBOL_add_expr = 242,                 /* add_expr  */
+  YYSYMBOL_np_add_expr = 243,              /* np_add_expr  */
+  YYSYMBOL_compare_expr = 244,             /* compare_expr  */
+  YYSYMBOL_bit_expr = 245,                 /* bit_expr  */
+  YYSYMBOL_bool_expr = 246,                /* bool_expr  */
+  YYSYMBOL_expr = 247,                     /* expr  */
+  YYSYMBOL_np_expr = 248,                  /* np_expr  */
+  YYSYMBOL_optexprlist = 249,              /* optexprlist  */
+  YYSYMBOL_exprlist = 250,                 /* exprlist  */
+  YYSYMBOL_expritem = 251,                 /* expritem  */
+  YYSYMBOL_np_expritem = 252,              /* np_expritem  */
+  YYSYMBOL_np_exprlist = 253,              /* np_exprlist  */
+  YYSYMBOL_subbody = 254,                  /* subbody  */
+  YYSYMBOL_endsub = 255,                   /* endsub  */
+  YYSYMBOL_funcbody = 256,                 /* funcbody  */
+  YYSYMBOL_endfunc = 257,                  /* endfunc  */
+  YYSYMBOL_attributes = 258,               /* attributes  */
+  YYSYMBOL_subdecl = 259,                  /* subdecl  */
+  YYSYMBOL_funcdecl = 260,                 /* funcdecl  */
+  YYSYMBOL_functemplate = 261,             /* functemplate  */
+  YYSYMBOL_templateheader = 262,           /* templateheader  */
+  YYSYMBOL_identlist = 263,                /* identlist  */
+  YYSYMBOL_classdecl = 264,                /* classdecl  */
+  YYSYMBOL_classheader = 265,              /* classheader  */
+  YYSYMBOL_classdecllist = 266,            /* classdecllist  */
+  YYSYMBOL_classend = 267,                 /* classend  */
+  YYSYMBOL_classdeclitem = 268,            /* classdeclitem  */
+  YYSYMBOL_constdecl = 269,                /* constdecl  */
+  YYSYMBOL_constitem = 270,                /* constitem  */
+  YYSYMBOL_constlist = 271,                /* constlist  */
+  YYSYMBOL_typedecl = 272,                 /* typedecl  */
+  YYSYMBOL_typename = 273,                 /* typename  */
+  YYSYMBOL_typelist = 274,                 /* typelist  */
+  YYSYMBOL_ptrdef = 275,                   /* ptrdef  */
+  YYSYMBOL_basetypename = 276,             /* basetypename  */
+  YYSYMBOL_paramdecl = 277,                /* paramdecl  */
+  YYSYMBOL_paramdecl1 = 278,               /* paramdecl1  */
+  YYSYMBOL_paramitem = 279,                /* paramitem  */
+  YYSYMBOL_paramvar = 280,                 /* paramvar  */
+  YYSYMBOL_dimension = 281,                /* dimension  */
+  YYSYMBOL_opt_type_as = 282,              /* opt_type_as  */
+  YYSYMBOL_dimlist = 283,                  /* dimlist  */
+  YYSYMBOL_dimitem = 284,                  /* dimitem  */
+  YYSYMBOL_identdecl = 285,                /* identdecl  */
+  YYSYMBOL_asmstmt = 286,                  /* asmstmt  */
+  YYSYMBOL_asmlist = 287,                  /* asmlist  */
+  YYSYMBOL_asmline = 288,                  /* asmline  */
+  YYSYMBOL_basedatline = 289,              /* basedatline  */
+  YYSYMBOL_operand = 290,                  /* operand  */
+  YYSYMBOL_pasmexpr = 291,                 /* pasmexpr  */
+  YYSYMBOL_operandlist = 292,              /* operandlist  */
+  YYSYMBOL_instruction = 293,              /* instruction  */
+  YYSYMBOL_instrmodifier = 294,            /* instrmodifier  */
+  YYSYMBOL_modifierlist = 295              /* modifierlist  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if 1
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* 1 */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined BASICYYSTYPE_IS_TRIVIAL && BASICYYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  239
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   5830
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  167
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  129
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  430
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  855
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   400
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_uint8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,   159,     2,     2,     2,     2,
+     155,   157,   151,   150,   158,   149,   154,   152,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,   156,   160,
+     146,   148,   147,     2,   153,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,   162,   161,   163,   164,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,   165,     2,   166,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145
+};
+
+#if BASICYYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   545,   545,   546,   547,   551,   552,   556,   557,   561,
+     572,   573,   579,   581,   586,   593,   597,   602,   611,   612,
+     617,   619,   621,   623,   632,   634,   639,   641,   646,   648,
+     653,   657,   663,   669,   675,   681,   688,   701,   703,   705,
+     707,   709,   711,   713,   715,   717,   719,   724,   726,   728,
+     730,   732,   734,   736,   738,   744,   749,   751,   757,   764,
+     768,   775,   777,   781,   793,   808,   809,   811,   813,   815,
+     817,   819,   821,   823,   827,   841,   841,   844,   845,   850,
+     852,   854,   856,   871,   889,   891,   899,   906,   915,   924,
+     933,   939,   951,   963,   983,  1006,  1018,  1020,  1027,  1029,
+    1034,  1036,  1038,  1043,  1045,  1047,  1053,  1054,  1056,  1058,
+    1060,  1062,  1071,  1089,  1115,  1119,  1125,  1128,  1134,  1138,
+    1145,  1152,  1160,  1162,  1164,  1169,  1170,  1171,  1175,  1175,
+    1183,  1184,  1185,  1189,  1189,  1195,  1195,  1201,  1201,  1209,
+    1211,  1213,  1218,  1220,  1225,  1227,  1232,  1250,  1255,  1257,
+    1259,  1264,  1266,  1275,  1275,  1314,  1316,  1322,  1323,  1328,
+    1350,  1354,  1356,  1358,  1369,  1380,  1391,  1402,  1413,  1424,
+    1435,  1446,  1460,  1464,  1468,  1477,  1481,  1482,  1483,  1484,
+    1485,  1486,  1490,  1495,  1497,  1506,  1508,  1510,  1512,  1514,
+    1516,  1518,  1520,  1525,  1527,  1532,  1534,  1539,  1541,  1543,
+    1549,  1551,  1553,  1555,  1557,  1559,  1561,  1563,  1566,  1582,
+    1586,  1593,  1595,  1600,  1602,  1604,  1606,  1608,  1613,  1618,
+    1622,  1630,  1636,  1642,  1647,  1652,  1654,  1656,  1658,  1663,
+    1665,  1667,  1669,  1674,  1685,  1693,  1701,  1709,  1722,  1723,
+    1728,  1730,  1732,  1734,  1736,  1741,  1743,  1750,  1752,  1759,
+    1761,  1769,  1771,  1780,  1782,  1784,  1789,  1791,  1793,  1798,
+    1800,  1802,  1804,  1806,  1808,  1810,  1815,  1817,  1819,  1821,
+    1826,  1828,  1830,  1835,  1837,  1842,  1843,  1848,  1849,  1854,
+    1856,  1861,  1866,  1870,  1872,  1877,  1882,  1883,  1887,  1892,
+    1893,  1898,  1899,  1908,  1919,  1930,  1946,  1958,  1970,  1983,
+    2001,  2017,  2036,  2044,  2048,  2056,  2063,  2067,  2085,  2086,
+    2089,  2099,  2100,  2105,  2114,  2115,  2116,  2120,  2126,  2134,
+    2136,  2141,  2147,  2149,  2151,  2153,  2155,  2167,  2169,  2181,
+    2181,  2185,  2187,  2189,  2191,  2193,  2195,  2197,  2199,  2201,
+    2203,  2205,  2207,  2209,  2220,  2222,  2224,  2226,  2228,  2230,
+    2232,  2247,  2248,  2252,  2254,  2259,  2261,  2263,  2268,  2270,
+    2272,  2274,  2280,  2285,  2287,  2289,  2291,  2293,  2295,  2297,
+    2307,  2322,  2323,  2328,  2330,  2334,  2336,  2338,  2343,  2345,
+    2358,  2370,  2387,  2410,  2415,  2420,  2425,  2429,  2434,  2436,
+    2441,  2442,  2459,  2461,  2463,  2465,  2467,  2469,  2471,  2473,
+    2475,  2477,  2479,  2481,  2483,  2485,  2487,  2489,  2491,  2493,
+    2495,  2497,  2499,  2501,  2503,  2508,  2510,  2512,  2514,  2516,
+    2521,  2523,  2525,  2530,  2532,  2537,  2539,  2544,  2549,  2551,
+    2553
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if 1
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "\"_\"",
+  "\"identifier\"", "\"label\"", "\"label:\"", "\"integer number\"",
+  "\"number\"", "\"literal string\"", "\"end of line\"", "\"end of file\"",
+  "\"type name\"", "\"asm instruction\"", "\"asm instruction modifier\"",
+  "\"hardware register\"", "\"alignl\"", "\"alignw\"", "\"file\"",
+  "\"fit\"", "\"org\"", "\"orgf\"", "\"orgh\"", "\"res\"", "\"abs\"",
+  "\"alias\"", "\"and\"", "\"andalso\"", "\"any\"", "\"append\"", "\"as\"",
+  "\"asc\"", "\"asm\"", "\"__builtin_alloca\"", "\"byref\"", "\"byte\"",
+  "\"byval\"", "\"call\"", "\"case\"", "\"cast\"", "\"catch\"",
+  "\"chain\"", "\"class\"", "\"close\"", "\"const\"", "\"continue\"",
+  "\"cpu\"", "\"data\"", "\"declare\"", "\"def\"", "\"defint\"",
+  "\"defsng\"", "\"delete\"", "\"dim\"", "\"direction\"", "\"do\"",
+  "\"double\"", "\"else\"", "\"end\"", "\"endif\"", "\"enum\"", "\"exit\"",
+  "\"extern\"", "\"fixed\"", "\"for\"", "\"function\"", "\"__FUNCTION__\"",
+  "\"get\"", "\"goto\"", "\"gosub\"", "\"_hasmethod\"", "\"if\"",
+  "\"import\"", "\"input\"", "\"int\"", "\"integer\"", "\"let\"",
+  "\"lib\"", "\"line\"", "\"long\"", "\"longint\"", "\"loop\"", "\"mod\"",
+  "\"new\"", "\"next\"", "\"nil\"", "\"not\"", "\"on\"", "\"open\"",
+  "\"option\"", "\"or\"", "\"orelse\"", "\"output\"", "\"pointer\"",
+  "\"print\"", "\"private\"", "\"program\"", "\"ptr\"", "\"put\"",
+  "\"read\"", "\"restore\"", "\"return\"", "\"_sametypes\"", "\"select\"",
+  "\"self\"", "\"shared\"", "\"short\"", "\"single\"", "\"sizeof\"",
+  "\"sqrt\"", "\"step\"", "\"string\"", "\"struct\"", "\"sub\"",
+  "\"then\"", "\"throw\"", "\"throwifcaught\"", "\"to\"", "\"try\"",
+  "\"type\"", "\"ubyte\"", "\"uinteger\"", "\"ulong\"", "\"ulongint\"",
+  "\"until\"", "\"ushort\"", "\"using\"", "\"var\"", "\"wend\"",
+  "\"with\"", "\"while\"", "\"word\"", "\"xor\"", "\"<=\"", "\">=\"",
+  "\"<>\"", "\"shl\"", "\"shr\"", "\"+=\"", "\"-=\"", "\"*=\"", "\"/=\"",
+  "\"MOD=\"", "\"AND=\"", "\"OR=\"", "\"XOR=\"", "'<'", "'>'", "'='",
+  "'-'", "'+'", "'*'", "'/'", "'@'", "'.'", "'('", "':'", "')'", "','",
+  "'#'", "';'", "'\\\\'", "'['", "']'", "'^'", "'{'", "'}'", "$accept",
+  "toplist", "eoln", "eolnseq", "toplabel", "topitem", "wrapped_stmt",
+  "optstatementlist", "stmtlistitem", "statementlist", "realstatementlist",
+  "ifline", "statement", "assignment_operator", "varassignlist",
+  "multivars", "simple_assign_statement", "assign_statement", "branchstmt",
+  "optcomma", "file_handle", "iostmt", "inputitem", "inputlist",
+  "printitem", "rawprintlist", "usingprintlist", "printlist", "putgetargs",
+  "optzeroexpritem", "optvar", "ifstmt", "thenelseblock", "endif",
+  "whilestmt", "$@1", "endwhile", "doloopstmt", "$@2", "$@3", "$@4",
+  "doloopend", "selectstmt", "casematchlist", "casematchitem", "casematch",
+  "caseitem", "caselist", "forstmt", "$@5", "endfor", "optstep",
+  "trycatchstmt", "endtry", "exitstmt", "topdecl", "defitem", "deflist",
+  "varexpr", "varassigntarget", "pinrange", "register_expr",
+  "np_primary_expr", "primary_expr", "unary_op", "pseudofunc_expr",
+  "unary_expr", "np_unary_expr", "lambdaexpr", "opttype", "mult_op",
+  "power_expr", "np_power_expr", "mult_expr", "np_mult_expr", "add_expr",
+  "np_add_expr", "compare_expr", "bit_expr", "bool_expr", "expr",
+  "np_expr", "optexprlist", "exprlist", "expritem", "np_expritem",
+  "np_exprlist", "subbody", "endsub", "funcbody", "endfunc", "attributes",
+  "subdecl", "funcdecl", "functemplate", "templateheader", "identlist",
+  "classdecl", "classheader", "classdecllist", "classend", "classdeclitem",
+  "constdecl", "constitem", "constlist", "typedecl", "typename",
+  "typelist", "ptrdef", "basetypename", "paramdecl", "paramdecl1",
+  "paramitem", "paramvar", "dimension", "opt_type_as", "dimlist",
+  "dimitem", "identdecl", "asmstmt", "asmlist", "asmline", "basedatline",
+  "operand", "pasmexpr", "operandlist", "instruction", "instrmodifier",
+  "modifierlist", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-716)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-359)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+    4723,  -716,  3935,  -716,  -716,  -716,   -64,    43,  -716,   118,
+      23,    51,   -21,  5511,   183,   122,  -716,    39,   180,   193,
+     193,  3551,    80,    82,    89,  -716,   257,   105,  -716,    16,
+      48,   149,   269,  3551,    91,  -716,  5462,  -716,  -716,  3551,
+    3551,   225,   112,   115,   121,  5631,  -716,  3551,   256,   273,
+    -716,  -716,  -716,    37,  3551,  3551,    71,   306,  -716,  -716,
+    -716,  -716,  -716,   314,  3551,    38,  4723,  -716,  -716,   172,
+    -716,  -716,  -716,  -716,  -716,  -716,  -716,  -716,  -716,  -716,
+    -716,  -716,   317,   166,   191,  -716,  -716,  -716,    20,  -716,
+     254,  -716,  -716,   195,  -716,  -716,   164,  -716,  -716,  -716,
+    -716,  -716,  -716,   190,   196,   230,  5705,   207,   216,  -716,
+     227,   231,   237,   851,  -716,  -716,   239,  -716,  3551,  -716,
+     240,  -716,  4432,  4432,  2512,   -42,  -716,  -716,  4432,  -716,
+    -716,  -716,   202,    -9,    -4,  -716,   238,  -716,   394,  -716,
+      71,  -716,  4012,   389,   247,  -716,   396,    53,   398,  3551,
+     261,    71,   258,   265,  -716,   263,  -716,  -716,  -716,  -716,
+      71,   397,   420,   422,   272,   279,  -716,   274,   274,  4432,
+    3551,    90,  -716,  -716,  4432,  -716,  -716,  -716,   267,    -9,
+     427,  -716,   138,    44,  -716,   284,   851,   101,     5,  -716,
+     281,  3551,  3551,  3551,  -716,  -716,  -716,  -716,  -716,  -716,
+    -716,   430,   436,   425,    90,   438,  3551,  -716,  -716,  -716,
+    -716,  5104,  3551,  3551,  5602,  -716,   484,   378,    70,  3551,
+    3551,  1720,  3551,  -716,   290,   -42,  -716,   291,  -716,  3551,
+      71,    90,   447,  -716,  -716,  4058,   423,   311,    71,  -716,
+     444,  4723,  -716,  3551,  -716,  -716,  -716,  -716,  -716,  -716,
+    -716,  -716,    64,  2904,  3551,  5482,  3679,   460,   462,   -64,
+     405,   405,  -716,  -716,  -716,  -716,    59,  -716,    28,    74,
+    3551,  3551,   851,  3551,    90,   851,  3551,   851,  -716,    21,
+    3807,  -716,    90,  -716,  -716,     3,   469,   469,   315,   318,
+     323,  -716,  -716,  -716,  4555,  -716,  -716,  -716,  -716,  -716,
+    4555,  4432,  4432,  3551,  -716,    95,  4012,   472,   632,  -716,
+    -716,  -716,   473,   474,   476,  1852,  1984,  2640,  2116,  2640,
+    1324,  1456,  1588,   488,  -716,  -716,  1192,   271,  -716,  3032,
+    -716,   477,  -716,  -716,  -716,  3551,  4012,   483,  4012,   282,
+     411,   413,    90,   487,   193,  -716,   338,     7,  -716,  4432,
+    4432,  4432,  4432,  4432,  4432,  4432,  4432,  4432,  4432,  4432,
+    4432,  4432,  4432,  4432,  3551,   492,   851,    67,   851,   492,
+    1064,   340,   342,    71,    71,  4058,   355,   365,  -716,   357,
+     360,  -716,   358,  5651,  4183,  -716,   361,   359,   139,   290,
+    3551,   368,   167,  -716,   291,   362,   511,  2772,  3551,  -716,
+     148,  -716,  -716,  -716,  5631,  3551,    71,  4012,   367,    25,
+    4851,   524,  4058,  -716,    71,   489,  -716,  -716,  -716,   851,
+    3551,  -716,  -716,  -716,   291,  -716,  -716,  -716,   178,  -716,
+     372,   -42,  -716,   231,   112,  -716,   377,   379,   491,   254,
+    -716,   851,  -716,  -716,   380,   390,   203,   393,   395,   400,
+     407,   182,  -716,  -716,  3551,  -716,  3807,   410,   412,   146,
+     414,   851,  3551,   421,  -716,  -716,  -716,  4058,    90,  -716,
+     202,    -9,    -9,   291,  -716,   531,   981,  -716,  -716,  -716,
+    -716,   526,  -716,  -716,  3551,  -716,   537,  -716,   541,   542,
+    -716,   544,   545,  -716,  2248,  -716,   -39,    42,  -716,    47,
+    -716,    52,   547,  -716,  -716,    30,  -716,    40,  -716,  -716,
+     211,  -716,  -716,  1028,  -716,  4632,   539,   550,   572,   573,
+     426,  -716,  -716,  -716,  -716,   267,   224,   224,   224,   224,
+     224,   224,    -9,    -9,  -716,  -716,  -716,   138,   138,   -28,
+     431,   492,   851,  -716,  -716,  3551,  -716,  -716,  3551,  -716,
+    -716,   503,  -716,  -716,  3551,   558,    90,  3551,  -716,  4058,
+     435,  -716,  -716,  -716,  -716,  5631,  5631,   291,  3551,   562,
+     565,   567,  -716,   442,  -716,  -716,  3160,  3160,  -716,  -716,
+     566,  4678,  -716,    90,    71,  4979,  5232,  -716,  -716,  -716,
+    4058,   601,  -716,  -716,  4058,  -716,  5482,    90,    90,  -716,
+    -716,  -716,  -716,  3551,  -716,  3295,   602,  -716,  -716,  -716,
+     451,   851,   851,    71,  -716,   579,   582,   479,   452,  -716,
+    -716,   584,  -716,  -716,  -716,  -716,  -716,  -716,  -716,  2640,
+    -716,   464,  2640,  -716,  2380,  -716,  -716,  -716,  -716,    50,
+    -716,   603,  -716,  -716,   586,   594,   851,  -716,   851,   475,
+     486,   496,  3551,  -716,  3551,   431,  -716,   -50,  -716,  4058,
+    4058,   -15,  -716,   514,  5705,   490,   498,  -716,   233,  -716,
+    5357,   290,   290,  -716,   499,   502,   504,  3160,  -716,  -716,
+    3423,    99,  -716,    71,   625,   505,  4058,  -716,  -716,    71,
+      19,  -716,   507,   508,   509,   851,  -716,   512,  -716,   517,
+     518,  4058,   851,   851,  3551,  -716,  -716,  -716,  -716,   471,
+    -716,  -716,  -716,  -716,  -716,  -716,  -716,    90,    90,  3551,
+     219,   519,  -716,   587,   597,  3551,  3551,  3551,  -716,    65,
+    3551,  4308,   609,  -716,  -716,  -716,  3551,  3551,  3551,  -716,
+     156,  -716,  -716,   523,   570,   585,  -716,  4058,  -716,    71,
+     624,  -716,  4058,   559,  -716,  -716,   660,    71,  -716,    71,
+      76,  -716,  -716,  -716,  -716,  -716,  -716,   663,  -716,   538,
+     540,  -716,  -716,  3551,  -716,  -716,  -716,  -716,  -716,   588,
+     851,  4058,   536,  4058,  -716,  -716,  -716,  -716,  -716,  3160,
+    3160,  3423,  3551,  -716,  -716,  4058,   583,  -716,   642,  -716,
+     851,  4058,  4058,   851,   543,   672,  -716,   591,  3551,    71,
+    -716,    60,   645,  -716,  3551,   320,  -716,  -716,  -716,  -716,
+    -716,  -716,   595,  -716,    60,  -716,  -716,  -716,  -716,   851,
+    3551,  -716,  4058,   851,  4058,   639,  -716,   551,  -716,  -716,
+    4058,   554,   548,   631,  -716,  -716,  -716,  3551,  -716,  -716,
+    -716,   714,  -716,  -716,  -716
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
+{
+      10,   194,   185,     9,    68,   346,   345,     0,   335,     0,
+       0,     0,     0,     0,   171,     0,    13,     0,     0,     0,
+       0,     0,     0,     0,     0,   342,   167,     0,   153,   291,
+       0,     0,     0,     0,    77,   339,     0,   333,   334,     0,
+       0,     0,     0,    77,     0,     0,    85,    66,     0,     0,
+     336,   341,   344,   291,     0,     0,     0,     0,   331,   340,
+     337,   338,   332,     0,     0,     0,    10,     2,    11,     0,
+      63,    30,    39,    38,    40,    41,    42,    45,    43,    44,
+      65,    12,    36,     0,     0,   179,   178,   181,     0,   176,
+     311,   180,   177,     0,   174,    46,   185,   202,   203,   207,
+     215,   345,   216,     0,     0,     0,     0,     0,     0,   206,
+       0,     0,     0,     0,   204,   214,     0,   205,     0,   217,
+       0,   213,     0,     0,   351,   200,   201,   229,     0,   230,
+     247,   276,   251,   256,   275,   282,   283,    31,     0,     7,
+       0,     5,     0,     6,    32,    92,     0,     0,     0,     0,
+       0,     0,     0,     0,   320,   317,   347,   170,   168,   169,
+       0,     0,     0,     0,     0,     0,   183,   173,   172,     0,
+       0,   351,   211,   225,     0,   226,   245,   274,   249,   253,
+     259,   266,   270,   273,    37,   378,     0,     0,   363,   373,
+     375,     0,     0,     0,   137,   165,   163,   161,   166,   162,
+     164,     0,     0,     0,   351,     0,     0,    69,    70,    71,
+      72,     0,     0,     0,     0,    64,   193,     0,     0,   277,
+       0,   106,     0,    96,    84,    95,   281,    67,   279,     0,
+       0,   351,     0,    73,    74,     0,     0,     0,     0,     1,
+       0,    10,    14,     0,    50,    51,    48,    49,    52,    54,
+      53,    47,     0,     0,     0,     0,     0,     0,     0,     0,
+     291,   291,   315,   314,   316,   306,     0,   313,     0,     0,
+       0,     0,     0,     0,   351,     0,     0,     0,   208,   322,
+       0,   210,   351,   231,   224,   185,     0,     0,     0,     0,
+     352,   353,   355,   232,     0,   242,   243,   244,   240,   241,
+       0,     0,     0,     0,   303,     0,     0,     0,     0,   392,
+     425,   427,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   388,   390,     0,     0,     8,     0,
+      91,     0,   307,   350,    90,     0,     0,     0,     0,     0,
+       0,     0,   351,     0,     0,   227,     0,   358,   228,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   366,     0,     0,
+       0,     0,   195,     0,     0,    18,     0,     0,   292,     0,
+       0,    93,     0,     0,     0,   120,     0,    75,     0,    81,
+       0,     0,     0,   175,   278,     0,     0,   106,     0,   100,
+     107,    79,    98,    94,     0,     0,     0,     0,     0,   351,
+      22,     0,     0,    20,    26,     0,    24,    15,    21,     0,
+       0,   128,     4,     3,    59,   189,   190,   187,     0,    58,
+      55,   193,    56,    61,    62,    60,     0,     0,     0,   311,
+     308,     0,   191,   192,     0,     0,     0,     0,     0,     0,
+       0,     0,   329,   330,     0,   323,     0,     0,     0,   322,
+       0,     0,     0,     0,   356,   357,   186,    18,     0,   248,
+     252,   258,   257,   284,   302,     0,     0,   393,   391,   404,
+     405,     0,   413,   422,     0,   420,     0,   406,     0,     0,
+     408,     0,     0,   394,     0,   423,   415,     0,   398,     0,
+     396,     0,     0,   389,   400,     0,   428,     0,   426,    33,
+       0,   305,   318,     0,   319,     0,   371,     0,     0,     0,
+       0,   182,   184,   212,   246,   250,   264,   265,   263,   261,
+     262,   260,   255,   254,   267,   268,   269,   271,   272,     0,
+     365,     0,     0,   364,   374,     0,   376,   199,     0,   135,
+     133,     0,    19,   343,     0,     0,   351,   114,   119,    18,
+     121,    28,   197,    76,    78,     0,     0,   143,     0,     0,
+       0,     0,   198,     0,    80,    99,   108,   109,    97,   280,
+       0,     0,   349,   351,     0,     0,     0,    16,    23,    25,
+      18,     0,   321,    35,    18,   188,     0,   351,   351,   310,
+     309,   312,   209,     0,   220,     0,     0,   218,   325,   324,
+       0,     0,     0,   349,   360,   359,     0,     0,    19,   354,
+     304,     0,   414,   421,   412,   407,   410,   409,   411,     0,
+     416,     0,     0,   395,     0,   399,   397,   383,   401,     0,
+     402,     0,   429,    34,     0,     0,     0,   369,     0,     0,
+       0,     0,     0,   379,     0,   368,   367,     0,   196,    18,
+      18,   141,   138,     0,     0,     0,     0,   115,     0,   118,
+       0,    82,    83,    86,     0,     0,     0,     0,   102,   101,
+       0,     0,   144,     0,     0,     0,    18,    17,    27,     0,
+       0,    57,     0,     0,     0,     0,   233,     0,   326,     0,
+       0,    18,     0,     0,     0,   236,   387,   417,   419,     0,
+     424,   403,   430,   384,   385,   372,   370,   351,   351,     0,
+       0,     0,   377,     0,     0,     0,     0,     0,   348,     0,
+       0,     0,   125,   127,   122,    29,     0,     0,     0,   103,
+     110,   150,   151,   147,   148,     0,   145,    18,   386,     0,
+       0,   294,     0,   132,   130,   129,     0,     0,   219,     0,
+     348,   221,   223,   222,   235,   362,   361,   238,   418,     0,
+       0,   299,   380,     0,   381,   136,   134,   140,   139,   157,
+       0,    18,   112,    18,   124,   126,    89,    87,    88,     0,
+     111,     0,     0,   142,   146,    18,   286,   285,     0,   131,
+       0,    18,    18,     0,     0,     0,   295,     0,     0,     0,
+     327,     0,     0,   296,     0,     0,   105,   104,   152,   149,
+     293,   287,     0,   159,     0,   301,   234,   239,   237,     0,
+       0,   158,    18,     0,    18,   289,   288,   116,   123,   160,
+      18,   298,     0,     0,   328,   297,   290,     0,   113,   300,
+     382,   155,   154,   117,   156
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -716,  -716,    27,  -716,  -716,   -35,  -382,  -364,  -716,  -231,
+    -716,  -716,     1,  -716,  -716,  -716,   683,  -716,  -716,  -716,
+     677,  -716,   319,  -207,  -556,  -716,  -716,   324,   506,  -716,
+    -716,  -716,  -716,   -91,  -716,  -716,  -716,  -716,  -716,  -716,
+    -716,  -716,  -716,  -716,    45,  -716,   -62,  -716,  -716,  -716,
+    -716,  -716,  -716,  -716,  -716,  -716,   391,   713,     0,  -246,
+     -71,    13,     4,  -716,    15,    17,   -81,   440,   734,  -716,
+     604,   388,   439,   -30,  -716,   -22,  -716,   -17,    18,  -716,
+     223,  -716,  -716,  -197,  -204,  -716,  -716,  -629,  -716,  -715,
+    -716,   -38,   -85,   -76,   -74,  -716,  -716,  -716,  -716,   301,
+    -716,  -716,  -716,   404,  -716,  -716,   -11,  -693,   292,   450,
+    -192,  -716,   277,   103,     8,  -716,   -19,   373,  -716,  -716,
+     -55,  -293,   441,   114,  -292,  -182,   419,  -316,   245
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,    65,   412,   143,    66,    67,   413,   750,   414,   552,
+     416,   560,   417,   254,    69,   430,    70,    71,    72,   564,
+     214,    73,   223,   224,   399,   400,   740,   401,   381,   666,
+     848,    74,   669,   734,    75,   594,   755,    76,   660,   659,
+     375,   662,    77,   681,   682,   683,   742,   743,    78,   202,
+     852,   809,    79,   823,    80,    81,   166,   167,   125,    83,
+     371,   126,   172,   173,   174,   175,   176,   130,   177,   804,
+     350,   178,   132,   179,   133,   180,   134,   181,   182,   183,
+     226,   135,   393,   227,   228,   136,   137,   751,   797,   813,
+     836,   205,    85,    86,    87,    88,   305,    89,    90,   265,
+     440,   266,    91,   154,   155,    92,   810,   811,   455,    93,
+     289,   290,   291,   292,   418,   647,   268,   189,   190,    95,
+     323,   324,   325,   495,   496,   497,   326,   327,   507
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+      82,    68,   382,   188,   415,   262,   127,   389,    94,   432,
+     506,   551,   379,    84,   263,   232,   264,   128,   382,   129,
+     678,   679,   394,   486,   488,   489,   491,   492,   587,   347,
+     503,   242,   145,   461,   142,   368,   216,   461,   239,   408,
+     638,   283,   284,   161,   311,   225,   424,   293,   139,    84,
+     640,   194,   633,   139,   311,   147,   428,   635,   441,   286,
+     711,   287,   636,   139,   311,   451,    82,    68,   425,   139,
+     139,   362,   764,   295,    94,   139,   446,   753,   442,    84,
+     203,   139,   447,   235,   185,   257,  -322,   826,   345,   652,
+     460,   138,   241,   348,   347,   780,   240,   542,   267,   139,
+     391,   203,   278,   617,   162,   185,   473,   824,   405,   725,
+     186,   631,   252,   253,   452,   726,   722,   438,   453,   845,
+     451,   739,   144,   632,   286,   849,   287,   296,   297,   653,
+     654,   366,   510,   258,   392,   363,   841,   680,   149,   499,
+     501,   386,   298,   299,   505,   301,   302,   754,   140,   395,
+     520,   462,   163,   207,   160,   462,   208,   745,   463,  -358,
+     426,  -358,   463,   369,   359,   270,   820,   306,   367,   452,
+     443,   204,   825,   453,   332,   365,   454,   148,   336,   331,
+     583,   589,   146,   503,   164,   187,   369,   338,   634,   506,
+     451,   642,   231,   567,   141,   668,   569,   165,   641,   141,
+     634,   579,   630,   587,   687,   634,   423,   206,   641,   141,
+     634,    82,   385,   192,   225,   141,   141,   584,   833,   193,
+     503,   141,   503,   232,    84,   369,   688,   141,   360,   219,
+     690,   454,  -322,   816,   817,    82,   618,   191,   157,   452,
+     570,    82,    68,   453,   184,   141,   212,   158,    84,    94,
+     213,   476,   474,   475,    84,   431,   211,   407,   185,   571,
+     201,   445,   217,   218,   448,   421,   450,   220,   524,   458,
+     361,   471,   472,   209,   213,   452,   210,   233,   234,   453,
+     222,   513,   259,   515,   310,   311,   516,   238,   503,   517,
+     731,   732,   733,   439,   229,   723,   724,   565,   127,   566,
+     269,   454,    17,    18,   127,   230,   576,    22,   577,   128,
+     236,   129,   195,   159,   789,   128,   790,   129,   237,   260,
+     243,   196,   197,   642,   255,   712,   270,   532,   533,   526,
+     527,   528,   529,   530,   531,   595,   405,   707,   198,   256,
+     709,   281,   534,   535,   536,   271,   540,   288,   657,   269,
+     691,   272,   581,   667,   262,   541,   148,   543,   671,   672,
+     604,   405,   273,   263,   665,   264,   294,   261,   643,   405,
+     199,   274,   334,   357,   358,    82,   772,   773,   732,   733,
+     537,   538,   275,   794,    82,   561,   212,   200,    84,   464,
+     465,   685,   276,   346,   280,   282,   303,    84,   304,   328,
+     549,   550,   329,   330,   225,   692,   693,   333,   592,   335,
+      82,   559,    82,   204,   372,   373,   374,   812,   588,   815,
+     231,   337,   339,    84,   340,    84,   341,   342,   343,   370,
+     601,   349,   344,   580,   378,   372,   387,   376,   812,   364,
+     377,   590,   380,   372,   402,   450,   390,   267,   404,   405,
+     614,   409,   406,   419,   422,   244,   245,   246,   247,   420,
+     248,   249,   250,   156,   436,   251,   437,    82,   843,   203,
+     812,   252,   253,   347,   467,  -193,   812,   429,   466,   435,
+      84,   468,   477,   479,   480,   481,   511,   150,   518,   307,
+     519,   521,   308,   288,   444,   523,   185,   547,   309,   449,
+     548,   310,   311,   457,   312,   313,   314,   315,   316,   317,
+     318,   319,   553,   554,   555,   556,   557,   563,   562,   572,
+     573,   798,   655,   320,   582,   769,   770,   568,   161,   591,
+     596,   656,   597,   599,   598,   620,   622,   602,   485,   485,
+     485,   485,   485,   485,   485,   485,   502,   624,   603,   485,
+     605,   625,   626,   606,   627,   628,   156,   607,   512,    82,
+     351,   352,   353,   279,   608,   225,   225,   321,   611,   646,
+     612,   613,    84,   354,   355,   356,   357,   358,   616,   637,
+     648,   649,   650,   651,   661,    82,    82,   539,   664,   369,
+      82,   670,   674,   546,    82,   675,   431,   676,    84,    84,
+     699,   700,   677,    84,   680,   689,   697,    84,   698,   702,
+     837,   686,   703,   704,   708,   705,   706,   311,   713,   322,
+     402,   575,   244,   245,   246,   247,   714,   248,   249,   250,
+     717,   727,   251,   307,   768,   715,   279,   716,   252,   253,
+     701,   718,   309,   593,   719,   310,   311,   729,   312,   313,
+     314,   315,   316,   317,   318,   319,   730,   748,   736,    82,
+      82,   737,   749,   738,   756,   757,   758,   320,   775,   761,
+      82,   735,    84,    84,   762,   763,   774,   610,   776,   346,
+     785,   791,   796,    84,   759,   615,    82,   792,   793,   799,
+     800,   765,   766,   803,   814,   805,   821,   806,   808,    84,
+     822,    82,   829,   835,   846,   850,   828,   623,   830,   847,
+     747,   321,   833,   839,    84,   851,   752,   485,   854,   215,
+     221,   574,   279,   578,   838,   279,   746,   279,   403,   818,
+     459,    82,   784,   168,   469,   522,   131,   300,   525,   470,
+     600,   514,   544,   609,    84,   619,   508,    82,   710,   478,
+     639,     0,    82,     0,     0,     0,   781,     0,   783,     0,
+      84,     0,     0,   322,     0,    84,     0,     0,     0,     0,
+       0,   658,     0,     0,     0,     0,   795,   663,     0,     0,
+       0,    82,     0,    82,   801,     0,   802,     0,     0,     0,
+       0,   673,   827,     0,    84,    82,    84,     0,     0,   402,
+     402,    82,    82,     0,     0,     0,     0,     0,    84,     0,
+       0,     0,     0,     0,    84,    84,   279,     0,   279,     0,
+       0,     0,   844,     0,     0,     0,   694,     0,   696,     0,
+       0,     0,    82,   156,    82,     0,   832,     0,   834,     0,
+      82,     0,     0,     0,     0,    84,     0,    84,     0,     0,
+       0,   840,   485,    84,     0,   485,     0,   485,     0,     0,
+       0,     0,     0,     5,     0,     0,     0,     0,     0,   279,
+       0,     0,     0,     0,     0,   720,     0,   721,     0,   101,
+       0,     0,     0,     0,     0,     0,     8,     0,     0,     0,
+       0,   279,     0,   105,     0,   106,     0,     0,     0,     0,
+     402,     0,     0,   744,     0,     0,   459,    25,     0,     0,
+       0,   279,     0,     0,    27,     0,   152,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    35,   767,     0,     0,
+      37,    38,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   771,     0,     0,     0,     0,     0,   777,   778,
+     779,     0,     0,   782,     0,     0,     0,    50,    51,   786,
+     787,   788,    52,     0,   153,     0,     0,     0,     0,     0,
+       0,    58,    59,    60,    61,     0,    62,     0,     0,     0,
+       0,     0,   307,     0,     0,   308,     0,     0,     0,     0,
+       0,   309,   279,     0,   310,   311,   807,   312,   313,   314,
+     315,   316,   317,   318,   319,     0,   277,     0,     0,     0,
+       0,     0,   402,   402,   744,   819,   320,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   307,
+       0,   831,   308,     0,     0,     0,     0,     0,   309,   621,
+       0,   310,   311,     0,   312,   313,   314,   315,   316,   317,
+     318,   319,     0,   842,     0,     0,     0,     0,     0,     0,
+     321,   279,   279,   320,     0,     0,     0,     0,    96,     0,
+     853,    97,    98,    99,     0,     0,     5,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   644,     0,   100,     0,
+       0,     0,   101,     0,     0,   102,   279,   103,   279,     8,
+       0,     0,     0,   104,     0,     0,   105,   321,   106,     0,
+     107,     0,   322,     0,   728,     0,     0,     0,    23,     0,
+      25,     0,     0,     0,     0,     0,     0,    27,     0,   108,
+     109,     0,     0,     0,   110,     0,     0,   111,   112,    35,
+       0,     0,     0,    37,    38,   760,     0,   113,     0,   114,
+     115,     0,   279,   279,     0,     0,    42,     0,     0,   322,
+       0,     0,     0,     0,     0,     0,   116,     0,   117,     0,
+      50,    51,   118,   119,     0,    52,     0,   120,     0,     0,
+       0,     0,     0,     0,    58,    59,    60,    61,     0,    62,
+       0,     0,     0,     0,     0,     0,    96,     0,     0,    97,
+      98,    99,   504,     0,     5,     0,   311,   483,     0,     0,
+       0,     0,     0,   121,   169,     0,   100,   123,     0,   170,
+     101,     0,     0,   102,     0,   103,   171,     8,     0,   545,
+     279,   104,     0,     0,   105,     0,   106,     0,   107,     0,
+       0,     0,     0,     0,     0,     0,    23,     0,    25,     0,
+     279,     0,     0,   279,     0,    27,     0,   108,   109,     0,
+       0,     0,   110,     0,     0,   111,   112,    35,     0,     0,
+       0,    37,    38,     0,     0,   113,     0,   114,   115,   279,
+       0,     0,     0,   279,    42,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   116,     0,   117,     0,    50,    51,
+     118,   119,     0,    52,     0,   120,     0,     0,     0,     0,
+       0,     0,    58,    59,    60,    61,     0,    62,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    96,     0,
+       0,    97,    98,    99,   493,     0,     5,     0,     0,   483,
+       0,   121,   169,     0,     0,   123,     0,   170,   100,     0,
+       0,   494,   101,   484,   171,   102,     0,   103,     0,     8,
+       0,     0,     0,   104,     0,     0,   105,     0,   106,     0,
+     107,     0,     0,     0,     0,     0,     0,     0,    23,     0,
+      25,     0,     0,     0,     0,     0,     0,    27,     0,   108,
+     109,     0,     0,     0,   110,     0,     0,   111,   112,    35,
+       0,     0,     0,    37,    38,     0,     0,   113,     0,   114,
+     115,     0,     0,     0,     0,     0,    42,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   116,     0,   117,     0,
+      50,    51,   118,   119,     0,    52,     0,   120,     0,     0,
+       0,     0,     0,     0,    58,    59,    60,    61,     0,    62,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      96,     0,     0,    97,    98,    99,   498,     0,     5,     0,
+       0,   483,     0,   121,   169,     0,     0,   123,     0,   170,
+     100,     0,     0,   494,   101,   484,   171,   102,     0,   103,
+       0,     8,     0,     0,     0,   104,     0,     0,   105,     0,
+     106,     0,   107,     0,     0,     0,     0,     0,     0,     0,
+      23,     0,    25,     0,     0,     0,     0,     0,     0,    27,
+       0,   108,   109,     0,     0,     0,   110,     0,     0,   111,
+     112,    35,     0,     0,     0,    37,    38,     0,     0,   113,
+       0,   114,   115,     0,     0,     0,     0,     0,    42,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   116,     0,
+     117,     0,    50,    51,   118,   119,     0,    52,     0,   120,
+       0,     0,     0,     0,     0,     0,    58,    59,    60,    61,
+       0,    62,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    96,     0,     0,    97,    98,    99,   500,     0,
+       5,     0,     0,   483,     0,   121,   169,     0,     0,   123,
+       0,   170,   100,     0,     0,   494,   101,   484,   171,   102,
+       0,   103,     0,     8,     0,     0,     0,   104,     0,     0,
+     105,     0,   106,     0,   107,     0,     0,     0,     0,     0,
+       0,     0,    23,     0,    25,     0,     0,     0,     0,     0,
+       0,    27,     0,   108,   109,     0,     0,     0,   110,     0,
+       0,   111,   112,    35,     0,     0,     0,    37,    38,     0,
+       0,   113,     0,   114,   115,     0,     0,     0,     0,     0,
+      42,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     116,     0,   117,     0,    50,    51,   118,   119,     0,    52,
+       0,   120,     0,     0,     0,     0,     0,     0,    58,    59,
+      60,    61,     0,    62,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    96,     0,     0,    97,    98,    99,
+       0,     0,     5,     0,     0,     0,     0,   121,   169,     0,
+       0,   123,     0,   170,   100,     0,     0,   494,   101,   484,
+     171,   102,     0,   103,     0,     8,     0,     0,     0,   104,
+       0,     0,   105,     0,   106,     0,   107,     0,     0,     0,
+       0,     0,     0,     0,    23,     0,    25,     0,     0,     0,
+       0,     0,     0,    27,     0,   108,   109,     0,     0,     0,
+     110,     0,     0,   111,   112,    35,     0,     0,     0,    37,
+      38,     0,     0,   113,     0,   114,   115,     0,     0,     0,
+       0,     0,    42,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   116,     0,   117,     0,    50,    51,   118,   119,
+       0,    52,     0,   120,     0,     0,     0,     0,     0,     0,
+      58,    59,    60,    61,     0,    62,   396,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    96,     0,     0,    97,
+      98,    99,   482,     0,     5,     0,     0,   483,     0,   121,
+     169,     0,     0,   123,     0,   170,   100,     0,   397,     0,
+     101,   398,   171,   102,     0,   103,     0,     8,     0,     0,
+       0,   104,     0,     0,   105,     0,   106,     0,   107,     0,
+       0,     0,     0,     0,     0,     0,    23,     0,    25,     0,
+       0,     0,     0,     0,     0,    27,     0,   108,   109,     0,
+       0,     0,   110,     0,     0,   111,   112,    35,     0,     0,
+       0,    37,    38,     0,     0,   113,     0,   114,   115,     0,
+       0,     0,     0,     0,    42,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   116,     0,   117,     0,    50,    51,
+     118,   119,     0,    52,     0,   120,     0,     0,     0,     0,
+       0,     0,    58,    59,    60,    61,     0,    62,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    96,     0,
+       0,    97,    98,    99,   487,     0,     5,     0,     0,   483,
+       0,   121,   169,     0,     0,   123,     0,   170,   100,     0,
+       0,     0,   101,   484,   171,   102,     0,   103,     0,     8,
+       0,     0,     0,   104,     0,     0,   105,     0,   106,     0,
+     107,     0,     0,     0,     0,     0,     0,     0,    23,     0,
+      25,     0,     0,     0,     0,     0,     0,    27,     0,   108,
+     109,     0,     0,     0,   110,     0,     0,   111,   112,    35,
+       0,     0,     0,    37,    38,     0,     0,   113,     0,   114,
+     115,     0,     0,     0,     0,     0,    42,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   116,     0,   117,     0,
+      50,    51,   118,   119,     0,    52,     0,   120,     0,     0,
+       0,     0,     0,     0,    58,    59,    60,    61,     0,    62,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      96,     0,     0,    97,    98,    99,   490,     0,     5,     0,
+       0,   483,     0,   121,   169,     0,     0,   123,     0,   170,
+     100,     0,     0,     0,   101,   484,   171,   102,     0,   103,
+       0,     8,     0,     0,     0,   104,     0,     0,   105,     0,
+     106,     0,   107,     0,     0,     0,     0,     0,     0,     0,
+      23,     0,    25,     0,     0,     0,     0,     0,     0,    27,
+       0,   108,   109,     0,     0,     0,   110,     0,     0,   111,
+     112,    35,     0,     0,     0,    37,    38,     0,     0,   113,
+       0,   114,   115,     0,     0,     0,     0,     0,    42,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   116,     0,
+     117,     0,    50,    51,   118,   119,     0,    52,     0,   120,
+       0,     0,     0,     0,     0,     0,    58,    59,    60,    61,
+       0,    62,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    96,     0,     0,    97,    98,    99,     0,     0,
+       5,     0,     0,   483,     0,   121,   169,     0,     0,   123,
+       0,   170,   100,     0,     0,     0,   101,   484,   171,   102,
+       0,   103,     0,     8,     0,     0,     0,   104,     0,     0,
+     105,     0,   106,     0,   107,     0,     0,     0,     0,     0,
+       0,     0,    23,     0,    25,     0,     0,     0,     0,     0,
+       0,    27,     0,   108,   109,     0,     0,     0,   110,     0,
+       0,   111,   112,    35,     0,     0,     0,    37,    38,     0,
+       0,   113,     0,   114,   115,     0,     0,     0,     0,     0,
+      42,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     116,     0,   117,     0,    50,    51,   118,   119,     0,    52,
+       0,   120,     0,     0,     0,     0,     0,     0,    58,    59,
+      60,    61,     0,    62,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    96,     0,     0,    97,    98,    99,
+       0,     0,     5,     0,     0,   483,     0,   121,   169,     0,
+       0,   123,     0,   170,   100,     0,     0,   629,   101,   484,
+     171,   102,     0,   103,     0,     8,     0,     0,     0,   104,
+       0,     0,   105,     0,   106,     0,   107,     0,     0,     0,
+       0,     0,     0,     0,    23,     0,    25,     0,     0,     0,
+       0,     0,     0,    27,     0,   108,   109,     0,     0,     0,
+     110,     0,     0,   111,   112,    35,     0,     0,     0,    37,
+      38,     0,     0,   113,     0,   114,   115,     0,     0,     0,
+       0,     0,    42,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   116,     0,   117,     0,    50,    51,   118,   119,
+       0,    52,     0,   120,     0,     0,     0,     0,     0,     0,
+      58,    59,    60,    61,     0,    62,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   285,     0,     0,    97,
+      98,    99,     0,     0,     5,     0,     0,     0,     0,   121,
+     169,     0,     0,   123,     0,   170,   100,     0,     0,   494,
+     101,   484,   171,   102,     0,   103,   286,     8,   287,     0,
+       0,   104,     0,     0,   105,     0,   106,     0,   107,     0,
+       0,     0,     0,     0,     0,     0,    23,     0,    25,     0,
+       0,     0,     0,     0,     0,    27,     0,   108,   109,     0,
+       0,     0,   110,     0,     0,   111,   112,    35,     0,     0,
+       0,    37,    38,     0,     0,   113,     0,   114,   115,     0,
+       0,     0,     0,     0,    42,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   116,     0,   117,     0,    50,    51,
+     118,   119,     0,    52,     0,   120,     0,     0,     0,     0,
+       0,     0,    58,    59,    60,    61,     0,    62,     0,     0,
+       0,     0,     0,     0,    96,     0,     0,    97,    98,    99,
+       0,     0,     5,     0,     0,   483,     0,     0,     0,     0,
+       0,   121,   169,     0,   100,   123,     0,   170,   101,     0,
+       0,   102,     0,   103,   171,     8,     0,     0,     0,   104,
+       0,     0,   105,     0,   106,     0,   107,     0,     0,     0,
+       0,     0,     0,     0,    23,     0,    25,     0,     0,     0,
+       0,     0,     0,    27,     0,   108,   109,     0,     0,     0,
+     110,     0,     0,   111,   112,    35,     0,     0,     0,    37,
+      38,     0,     0,   113,     0,   114,   115,     0,     0,     0,
+       0,     0,    42,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   116,     0,   117,     0,    50,    51,   118,   119,
+       0,    52,     0,   120,     0,     0,     0,     0,     0,     0,
+      58,    59,    60,    61,     0,    62,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    96,     0,     0,    97,
+      98,    99,     0,     0,     5,     0,     0,     0,     0,   121,
+     169,     0,     0,   123,     0,   170,   100,     0,     0,     0,
+     101,   484,   171,   102,     0,   103,     0,     8,     0,     0,
+       0,   104,     0,     0,   105,     0,   106,     0,   107,     0,
+       0,     0,     0,     0,     0,     0,    23,     0,    25,     0,
+       0,     0,     0,     0,     0,    27,     0,   108,   109,     0,
+       0,     0,   110,     0,     0,   111,   112,    35,     0,     0,
+       0,    37,    38,     0,     0,   113,     0,   114,   115,     0,
+       0,     0,     0,     0,    42,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   116,     0,   117,     0,    50,    51,
+     118,   119,     0,    52,     0,   120,     0,     0,     0,     0,
+       0,     0,    58,    59,    60,    61,     0,    62,   396,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    96,     0,
+       0,    97,    98,    99,     0,     0,     5,     0,     0,     0,
+       0,   121,   169,     0,     0,   123,     0,   170,   100,     0,
+       0,     0,   101,   398,   171,   102,     0,   103,     0,     8,
+       0,     0,     0,   104,     0,     0,   105,     0,   106,     0,
+     107,     0,     0,     0,     0,     0,     0,     0,    23,     0,
+      25,     0,     0,     0,     0,     0,     0,    27,     0,   108,
+     109,     0,     0,     0,   110,     0,     0,   111,   112,    35,
+       0,     0,     0,    37,    38,     0,     0,   113,     0,   114,
+     115,     0,     0,     0,     0,     0,    42,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   116,     0,   117,     0,
+      50,    51,   118,   119,     0,    52,     0,   120,     0,     0,
+       0,     0,     0,     0,    58,    59,    60,    61,     0,    62,
+       0,     0,     0,     0,     0,     0,    96,     0,     0,    97,
+      98,    99,     0,     0,     5,     0,     0,     0,     0,     0,
+       0,     0,     0,   121,   169,     0,   100,   123,     0,   170,
+     101,   427,     0,   102,     0,   103,   171,     8,     0,     0,
+       0,   104,     0,     0,   105,     0,   106,     0,   107,     0,
+       0,     0,     0,     0,     0,     0,    23,     0,    25,     0,
+       0,     0,     0,     0,     0,    27,     0,   108,   109,     0,
+       0,     0,   110,     0,     0,   111,   112,    35,     0,     0,
+       0,    37,    38,     0,     0,   113,     0,   114,   115,     0,
+       0,     0,     0,     0,    42,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   116,     0,   117,     0,    50,    51,
+     118,   119,     0,    52,     0,   120,     0,     0,     0,     0,
+       0,     0,    58,    59,    60,    61,     0,    62,     0,     0,
+       0,     0,     0,     0,    96,     0,     0,    97,    98,    99,
+       0,     0,     5,     0,     0,     0,     0,     0,     0,     0,
+       0,   121,   169,     0,   100,   123,     0,   170,   101,   509,
+       0,   102,     0,   103,   171,     8,     0,     0,     0,   104,
+       0,     0,   105,     0,   106,     0,   107,     0,     0,     0,
+       0,     0,     0,     0,    23,     0,    25,     0,     0,     0,
+       0,     0,     0,    27,     0,   108,   109,     0,     0,     0,
+     110,     0,     0,   111,   112,    35,     0,     0,     0,    37,
+      38,     0,     0,   113,     0,   114,   115,     0,     0,     0,
+       0,     0,    42,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   116,     0,   117,     0,    50,    51,   118,   119,
+       0,    52,     0,   120,     0,     0,     0,     0,     0,     0,
+      58,    59,    60,    61,     0,    62,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    96,
+       0,     0,    97,    98,    99,     0,     0,     5,     0,   121,
+     169,     0,     0,   123,     0,   170,     0,     0,     0,   100,
+       0,   398,   171,   101,     0,   695,   102,     0,   103,     0,
+       8,     0,     0,     0,   104,     0,     0,   105,     0,   106,
+       0,   107,     0,     0,     0,     0,     0,     0,     0,    23,
+       0,    25,     0,     0,     0,     0,     0,     0,    27,     0,
+     108,   109,     0,     0,     0,   110,     0,     0,   111,   112,
+      35,     0,     0,     0,    37,    38,     0,     0,   113,     0,
+     114,   115,     0,     0,     0,     0,     0,    42,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   116,     0,   117,
+       0,    50,    51,   118,   119,     0,    52,     0,   120,     0,
+       0,     0,     0,     0,     0,    58,    59,    60,    61,     0,
+      62,     0,     0,     0,     0,     0,     0,    96,     0,     0,
+      97,    98,    99,     0,     0,     5,     0,     0,     0,     0,
+       0,     0,     0,     0,   121,   169,     0,   100,   123,     0,
+     170,   101,     0,     0,   102,     0,   103,   171,     8,     0,
+       0,     0,   104,     0,     0,   105,     0,   106,     0,   107,
+       0,     0,     0,     0,     0,     0,     0,    23,     0,    25,
+     741,     0,     0,     0,     0,     0,    27,     0,   108,   109,
+       0,     0,     0,   110,     0,     0,   111,   112,    35,     0,
+       0,     0,    37,    38,     0,     0,   113,     0,   114,   115,
+       0,     0,     0,     0,     0,    42,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   116,     0,   117,     0,    50,
+      51,   118,   119,     0,    52,     0,   120,     0,     0,     0,
+       0,     0,     0,    58,    59,    60,    61,     0,    62,     0,
+       0,     0,     0,     0,     0,    96,     0,     0,    97,    98,
+      99,     0,     0,     5,     0,     0,     0,     0,     0,     0,
+       0,     0,   121,   169,     0,   100,   123,     0,   170,   101,
+       0,     0,   102,     0,   103,   171,     8,     0,     0,     0,
+     104,     0,     0,   105,     0,   106,     0,   107,     0,     0,
+       0,     0,     0,     0,     0,    23,     0,    25,     0,     0,
+       0,     0,     0,     0,    27,     0,   108,   109,     0,     0,
+       0,   110,     0,     0,   111,   112,    35,     0,     0,     0,
+      37,    38,     0,     0,   113,     0,   114,   115,     0,     0,
+       0,     0,     0,    42,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   116,     0,   117,     0,    50,    51,   118,
+     119,     0,    52,     0,   120,     0,     0,     0,     0,     0,
+       0,    58,    59,    60,    61,     0,    62,     0,     0,     0,
+       0,     0,     0,    96,     0,     0,    97,    98,    99,     0,
+       0,     5,     0,     0,     0,     0,     0,     0,     0,     0,
+     121,   169,     0,   100,   123,     0,   170,   101,     0,     0,
+     102,     0,   103,   171,     8,     0,     0,     0,   104,     0,
+       0,   105,     0,   106,     0,   107,     0,     0,     0,     0,
+       0,     0,     0,    23,     0,    25,     0,     0,     0,     0,
+       0,     0,    27,     0,   108,   109,     0,     0,     0,   110,
+       0,     0,   433,   112,    35,     0,     0,     0,    37,    38,
+       0,     0,   113,     0,   114,   115,     0,     0,     0,     0,
+       0,   434,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   116,     0,   117,     0,    50,    51,   118,   119,     0,
+      52,     0,   120,     0,     0,     0,     0,     0,     0,    58,
+      59,    60,    61,     0,    62,     0,     0,     0,     0,     0,
+       0,    96,     0,     0,    97,    98,    99,     0,     0,     5,
+       0,     0,     0,     0,     0,     0,     0,     0,   121,   169,
+       0,   100,   123,     0,   170,   101,     0,     0,   102,     0,
+     103,   171,     8,     0,     0,     0,   104,     0,     0,   105,
+       0,   106,     0,   107,     0,     0,     0,     0,     0,     0,
+       0,    23,     0,    25,     0,     0,     0,     0,     0,     0,
+      27,     0,   108,   109,     0,     0,     0,   110,     0,     0,
+     111,   112,    35,     0,     0,     0,    37,    38,     0,     0,
+     113,     0,   114,   115,     0,     0,     0,     0,     0,    42,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   116,
+       0,   117,     0,    50,    51,   118,   119,     0,    52,     0,
+     120,     0,     0,     0,     0,     0,     0,    58,    59,    60,
+      61,     0,    62,     0,     0,     0,     0,     0,     0,    96,
+       0,     0,    97,    98,    99,     0,     0,     5,     0,     0,
+       0,     0,     0,     0,     0,     0,   121,   169,     0,   100,
+     123,     0,   456,   101,     0,     0,   102,     0,   103,   171,
+       8,     0,     0,     0,   104,     0,     0,   105,     0,   106,
+       0,   107,     0,     0,     0,     0,     0,     0,     0,    23,
+       0,    25,     0,     0,     0,     0,     0,     0,    27,     0,
+     108,   109,     0,     0,     0,   110,     0,     0,   111,   112,
+      35,     0,     0,   307,    37,    38,   308,     0,   113,     0,
+     114,   115,   309,     0,     0,   310,   311,    42,   312,   313,
+     314,   315,   316,   317,   318,   319,     0,   116,     0,   117,
+       0,    50,    51,   118,   119,     0,    52,   320,   120,     0,
+       0,     0,     0,     0,     0,    58,    59,    60,    61,     0,
+      62,     1,     2,   410,     4,     0,     0,     0,   139,     0,
+       5,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   121,   122,   101,     0,   123,     0,
+       7,   321,     0,     8,     0,     9,     0,   124,     0,    10,
+     105,    12,   383,    14,    15,     0,   411,     0,     0,     0,
+      21,    22,    23,    24,    25,     0,     0,     0,     0,    26,
+       0,    27,    28,   152,     0,    30,    31,    32,     0,    33,
+       0,    34,     0,    35,    36,     0,     0,    37,    38,     0,
+       0,     0,     0,   322,     0,    39,    40,     0,     0,     0,
+      42,     0,    43,     0,     0,     0,    44,    45,    46,    47,
+       0,    48,     0,    49,    50,    51,     0,     0,     0,    52,
+       0,   153,     0,    54,    55,     0,    56,     0,    58,    59,
+      60,    61,     0,    62,     0,    63,     1,     2,    64,     4,
+     558,     0,     0,   139,     0,     5,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   101,     0,     0,   141,     7,     0,     0,     8,     0,
+       9,     0,     0,     0,    10,   105,    12,   383,    14,    15,
+       0,     0,     0,     0,     0,    21,     0,    23,    24,    25,
+       0,     0,     0,     0,    26,     0,    27,    28,   152,     0,
+      30,    31,    32,     0,    33,     0,    34,     0,    35,    36,
+       0,     0,    37,    38,     0,     0,     0,     0,     0,     0,
+      39,    40,     0,     0,     0,    42,     0,    43,     0,     0,
+       0,    44,    45,    46,    47,     0,    48,     0,    49,    50,
+      51,     0,     0,     0,    52,     0,   153,     0,    54,    55,
+       0,    56,     0,    58,    59,    60,    61,     0,    62,     0,
+      63,     1,     2,    64,     4,     0,     0,     0,   139,     0,
+       5,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   101,     0,     0,   141,
+       7,     0,     0,     8,     0,     9,     0,     0,     0,    10,
+     105,    12,   383,    14,    15,     0,     0,     0,     0,     0,
+      21,     0,    23,    24,    25,     0,     0,     0,     0,    26,
+       0,    27,    28,   152,     0,    30,    31,    32,     0,    33,
+       0,    34,     0,    35,    36,     0,     0,    37,    38,     0,
+       0,     0,     0,     0,     0,    39,    40,     0,     0,     0,
+      42,     0,    43,     0,     0,     0,    44,    45,    46,    47,
+       0,    48,     0,    49,    50,    51,     0,     0,     0,    52,
+       0,   153,     0,    54,    55,     0,    56,     0,    58,    59,
+      60,    61,     0,    62,     0,    63,    96,     0,    64,    97,
+      98,    99,     0,     0,     5,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   100,     0,     0,     0,
+     101,     0,     0,   102,   141,   103,     0,     8,     0,     0,
+       0,   104,     0,     0,   105,     0,   106,     0,   107,     0,
+       0,     0,     0,     0,     0,     0,    23,     0,    25,     0,
+       0,     0,     0,     0,     0,    27,     0,   152,   109,     0,
+       0,     0,   110,     0,     0,   111,   112,    35,     0,     0,
+       0,    37,    38,     0,     0,   113,     0,   114,   115,     0,
+       0,     0,     0,     0,    42,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   116,     0,   117,     0,    50,    51,
+     118,   119,     0,    52,     0,   153,     0,     0,     0,     0,
+       0,     0,    58,    59,    60,    61,     0,    62,     0,    96,
+       0,     0,    97,    98,    99,     0,     0,     5,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   100,
+       0,   121,   169,   101,     0,   123,   102,   170,   103,     0,
+       8,     0,     0,     0,   104,     0,     0,   105,     0,   106,
+       0,   107,     0,     0,     0,     0,     0,     0,     0,    23,
+       0,    25,     0,     0,     0,     0,     0,     0,    27,     0,
+     152,   109,     0,     0,     0,   110,     0,     0,   111,   112,
+      35,     0,     0,   307,    37,    38,   308,     0,   113,     0,
+     114,   115,   309,     0,     0,   310,   311,    42,   312,   313,
+     314,   315,   316,   317,   318,   319,     0,   116,     0,   117,
+       0,    50,    51,   118,   119,     0,    52,   320,   153,     0,
+       0,     0,     0,     0,     0,    58,    59,    60,    61,   307,
+      62,     0,   308,     0,     0,     0,     0,     0,   309,     0,
+     645,   310,   311,     0,   312,   313,   314,   315,   316,   317,
+     318,   319,     0,     0,   121,   122,     0,     0,   123,     0,
+       0,   321,     0,   320,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     1,     2,     3,     4,
+       0,     0,     0,     0,     0,     5,   684,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     6,     0,     0,     0,     7,     0,   321,     8,     0,
+       9,     0,     0,   322,    10,    11,    12,    13,    14,    15,
+      16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
+       0,     0,     0,     0,    26,     0,    27,    28,    29,     0,
+      30,    31,    32,     0,    33,     0,    34,     0,    35,    36,
+       0,     0,    37,    38,     0,     0,     0,     0,     0,   322,
+      39,    40,    41,     0,     0,    42,     0,    43,     0,     0,
+       0,    44,    45,    46,    47,     0,    48,     0,    49,    50,
+      51,     0,     0,     0,    52,     0,    53,     0,    54,    55,
+       0,    56,    57,    58,    59,    60,    61,     0,    62,     0,
+      63,     0,     0,    64,     1,     2,   585,     4,     0,     0,
+       0,   586,     0,     5,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   101,
+       0,     0,     0,     7,     0,     0,     8,     0,     9,     0,
+       0,     0,    10,   105,    12,   383,    14,    15,     0,   411,
+       0,     0,     0,    21,    22,    23,    24,    25,     0,     0,
+       0,     0,    26,     0,    27,    28,   152,     0,    30,    31,
+      32,     0,    33,     0,    34,     0,    35,    36,     0,     0,
+      37,    38,     0,     0,     0,     0,     0,     0,    39,    40,
+       0,     0,     0,    42,     0,    43,     0,     0,     0,    44,
+      45,    46,    47,     0,    48,     0,    49,    50,    51,     0,
+       0,     0,    52,     0,   153,     0,    54,    55,     0,    56,
+       0,    58,    59,    60,    61,     0,    62,     0,    63,     0,
+       0,    64,     1,     2,   585,     4,     0,     0,     0,   586,
+       0,     5,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   101,     0,     0,
+       0,     7,     0,     0,     8,     0,     9,     0,     0,     0,
+      10,   105,    12,   383,    14,    15,     0,     0,     0,     0,
+       0,    21,     0,    23,    24,    25,     0,     0,     0,     0,
+      26,     0,    27,    28,   152,     0,    30,    31,    32,     0,
+      33,     0,    34,     0,    35,    36,     0,     0,    37,    38,
+       0,     0,     0,     0,     0,     0,    39,    40,     0,     0,
+       0,    42,     0,    43,     0,     0,     0,    44,    45,    46,
+      47,     0,    48,     0,    49,    50,    51,     0,     0,     0,
+      52,     0,   153,     0,    54,    55,     0,    56,     0,    58,
+      59,    60,    61,     0,    62,     0,    63,     1,     2,    64,
+       4,     0,     0,     0,     0,     0,     5,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   101,     0,     0,     0,     7,     0,     0,     8,
+       0,     9,     0,     0,     0,    10,   105,    12,   383,    14,
+      15,     0,     0,     0,     0,     0,    21,     0,    23,    24,
+      25,     0,     0,     0,     0,    26,     0,    27,    28,   152,
+       0,    30,    31,    32,     0,    33,     0,    34,     0,    35,
+      36,     0,     0,    37,    38,     0,     0,     0,     0,     0,
+       0,    39,    40,     0,     0,     0,    42,     0,    43,     0,
+       0,     0,    44,    45,    46,    47,     0,    48,     0,    49,
+      50,    51,     0,     0,     0,    52,     0,   153,   384,    54,
+      55,     0,    56,     0,    58,    59,    60,    61,     0,    62,
+       0,    63,     0,     0,    64,     1,     2,   585,     4,     0,
+       0,     0,     0,     0,     5,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     101,     0,     0,     0,     7,     0,     0,     8,     0,     9,
+       0,     0,     0,    10,   105,    12,   383,    14,    15,     0,
+       0,     0,     0,     0,    21,     0,    23,    24,    25,     0,
+       0,     0,     0,    26,     0,    27,    28,   152,     0,    30,
+      31,    32,     0,    33,     0,    34,     0,    35,    36,     0,
+       0,    37,    38,     0,     0,     0,     0,     0,     0,    39,
+      40,     0,     0,     0,    42,     0,    43,     0,     0,     0,
+      44,    45,    46,    47,     0,    48,     0,    49,    50,    51,
+       0,     0,     0,    52,     0,   153,     0,    54,    55,     0,
+      56,     0,    58,    59,    60,    61,     0,    62,     0,    63,
+       1,     2,    64,     4,     0,     0,     0,     0,     0,     5,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   101,     0,     0,     0,     7,
+       0,     0,     8,     0,     9,     0,     0,     0,    10,   105,
+      12,   383,    14,    15,     0,     0,     0,     0,     0,    21,
+       0,    23,    24,    25,     0,     0,     0,     0,    26,     0,
+      27,    28,   152,     0,    30,    31,    32,     0,    33,     0,
+      34,     0,    35,    36,     0,     0,    37,    38,     0,     0,
+       0,     0,     0,     0,    39,    40,     0,     0,     0,    42,
+       0,    43,     0,     0,     0,    44,    45,    46,    47,     0,
+      48,     0,    49,    50,    51,     1,    96,     0,    52,     0,
+     153,     0,    54,    55,     5,    56,     0,    58,    59,    60,
+      61,     0,    62,     0,    63,     1,    96,    64,     0,     0,
+     101,     0,     0,     0,     5,     0,     0,     8,     0,     0,
+       0,     0,     0,     0,   105,     0,   106,     0,     0,     0,
+     101,     0,     0,     0,     0,   150,    23,     8,    25,     0,
+       0,     0,     0,     5,   105,    27,   106,   152,     0,     0,
+       0,     0,     0,     0,     0,   111,     0,    35,    25,   101,
+       0,    37,    38,   151,     0,    27,     8,   152,     0,     0,
+       0,     0,     0,   105,    42,   106,     0,    35,     0,     0,
+       0,    37,    38,     0,     0,     0,     0,    25,    50,    51,
+       0,     0,     0,    52,    27,   153,   152,     0,     0,     0,
+       0,     0,    58,    59,    60,    61,    35,    62,    50,    51,
+      37,    38,     0,    52,     0,   153,     0,     0,     0,     0,
+       0,     0,    58,    59,    60,    61,    96,    62,     0,     0,
+       0,   388,     0,     0,     5,     0,     0,    50,    51,     0,
+       0,     0,    52,     0,   153,     0,     0,     0,     0,     0,
+     101,    58,    59,    60,    61,    96,    62,     8,     0,     0,
+       0,     0,     0,     5,   105,     0,   106,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    25,   101,
+       0,     0,     0,     5,     0,    27,     8,   152,     0,     0,
+       0,     0,     0,   105,     0,   106,     0,    35,     0,   101,
+       0,    37,    38,   151,     0,     0,     8,    25,     0,     0,
+       0,     0,     0,   105,    27,   106,   152,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    35,    25,    50,    51,
+      37,    38,     0,    52,    27,   153,   152,     5,     0,     0,
+       0,     0,    58,    59,    60,    61,    35,    62,     0,     0,
+      37,    38,     0,   101,     0,     0,     0,    50,    51,     0,
+       8,     0,    52,     0,   153,     0,     0,   105,     0,   106,
+       0,    58,    59,    60,    61,     0,    62,    50,    51,     0,
+       0,    25,    52,     0,   153,     0,     0,     0,    27,     0,
+     152,    58,    59,    60,    61,     0,    62,     0,     0,     0,
+      35,     0,     0,     0,    37,    38,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    50,    51,     0,     0,     0,    52,     0,   153,     0,
+       0,     0,     0,     0,     0,    58,    59,    60,    61,     0,
+      62
+};
+
+static const yytype_int16 yycheck[] =
+{
+       0,     0,   206,    22,   235,    90,     2,   214,     0,   255,
+     326,   375,   204,     0,    90,    53,    90,     2,   222,     2,
+     576,   577,   219,   315,   316,   317,   318,   319,   410,     4,
+     323,    66,     9,    30,     7,    30,    36,    30,     0,   231,
+      10,   122,   123,     4,    14,    45,   243,   128,    10,    36,
+      10,    24,    10,    10,    14,     4,   253,    10,    30,    34,
+      10,    36,    10,    10,    14,    44,    66,    66,     4,    10,
+      10,    27,   701,    82,    66,    10,   273,    58,     4,    66,
+      64,    10,   274,    56,     4,    65,    10,   802,   169,   117,
+     282,   155,    65,   174,     4,    30,    58,    30,    90,    10,
+      30,    64,   113,   467,    65,     4,   303,   800,   158,   124,
+      30,   150,   154,   155,    93,   130,   166,    58,    97,   834,
+      44,   677,     4,   162,    34,   840,    36,   136,   137,   157,
+     158,    30,   329,   113,    64,    91,   829,    38,   159,   321,
+     322,   212,   151,   152,   326,   149,   150,   128,   105,   220,
+     342,   148,   113,     4,    32,   148,     7,    58,   155,   156,
+      96,   158,   155,   158,    26,   162,   795,   140,   187,    93,
+      96,   155,   801,    97,   147,   186,   155,   126,   151,   126,
+     155,   412,   159,   476,     4,   105,   158,   160,   158,   505,
+      44,   507,   155,   390,   156,   559,    29,     4,   158,   156,
+     158,   405,   494,   585,   586,   158,   241,   159,   158,   156,
+     158,   211,   211,   124,   214,   156,   156,   409,   158,   130,
+     513,   156,   515,   261,   211,   158,   590,   156,    90,     4,
+     594,   155,   156,   789,   790,   235,   467,   155,    55,    93,
+      73,   241,   241,    97,    21,   156,   155,    64,   235,   241,
+     159,   306,   157,   158,   241,   255,    33,   230,     4,    92,
+     155,   272,    39,    40,   275,   238,   277,   155,   349,   280,
+     132,   301,   302,     4,   159,    93,     7,    54,    55,    97,
+     159,   336,    28,   338,    13,    14,     4,    64,   581,     7,
+      57,    58,    59,   266,    38,   659,   660,   158,   294,   160,
+     154,   155,    48,    49,   300,    32,   158,    53,   160,   294,
+       4,   294,    55,   130,   158,   300,   160,   300,     4,    65,
+     148,    64,    65,   639,   158,   641,   162,   357,   358,   351,
+     352,   353,   354,   355,   356,   157,   158,   629,    81,   148,
+     632,   118,   359,   360,   361,   155,   365,   124,   545,   154,
+     596,   155,   407,   557,   439,   366,   126,   368,   565,   566,
+     157,   158,   155,   439,   556,   439,   164,   113,   157,   158,
+     113,   155,   149,   149,   150,   375,   157,   158,    58,    59,
+     362,   363,   155,   747,   384,   384,   155,   130,   375,   286,
+     287,   583,   155,   170,   155,   155,   158,   384,     4,    10,
+     373,   374,   155,     7,   404,   597,   598,     9,   419,   148,
+     410,   384,   412,   155,   191,   192,   193,   781,   410,   783,
+     155,   158,    25,   410,     4,   412,     4,   155,   149,   148,
+     441,   164,   158,   406,     9,   212,   213,     7,   802,   155,
+       4,   414,     4,   220,   221,   456,    68,   439,   158,   158,
+     461,     4,   229,    30,    10,   138,   139,   140,   141,   148,
+     143,   144,   145,    13,     4,   148,     4,   467,   832,    64,
+     834,   154,   155,     4,   156,   158,   840,   254,   163,   256,
+     467,   158,    10,    10,    10,     9,     9,     4,    77,     1,
+      77,     4,     4,   270,   271,   157,     4,   157,    10,   276,
+     158,    13,    14,   280,    16,    17,    18,    19,    20,    21,
+      22,    23,   157,   148,   157,   155,   158,   158,   157,   157,
+       9,   752,   541,    35,   157,   717,   718,   159,     4,    40,
+     158,   542,   155,    42,   155,     4,    10,   157,   315,   316,
+     317,   318,   319,   320,   321,   322,    58,    10,   158,   326,
+     157,    10,    10,   158,    10,    10,   106,   157,   335,   559,
+     133,   134,   135,   113,   157,   565,   566,    79,   158,    30,
+     158,   157,   559,   146,   147,   148,   149,   150,   157,    32,
+      30,     9,     9,   157,    81,   585,   586,   364,    30,   158,
+     590,   156,    30,   370,   594,    30,   596,    30,   585,   586,
+     611,   612,   160,   590,    38,     4,     4,   594,   157,    30,
+     814,   584,    30,   134,   150,   163,    32,    14,    32,   131,
+     397,   398,   138,   139,   140,   141,    32,   143,   144,   145,
+     155,   117,   148,     1,   163,   646,   186,   648,   154,   155,
+     613,   155,    10,   420,   148,    13,    14,   157,    16,    17,
+      18,    19,    20,    21,    22,    23,   158,    32,   159,   659,
+     660,   159,   157,   159,   157,   157,   157,    35,    81,   157,
+     670,   670,   659,   660,   157,   157,   157,   454,    81,   456,
+      71,   158,    58,   670,   695,   462,   686,   117,   103,   130,
+      30,   702,   703,    30,   158,   157,   113,   157,   110,   686,
+      58,   701,    30,    58,    65,   157,   163,   484,   117,   158,
+     683,    79,   158,   118,   701,    84,   689,   494,     4,    36,
+      43,   397,   272,   404,   815,   275,   681,   277,   222,   791,
+     280,   731,   731,    20,   294,   344,     2,   133,   350,   300,
+     439,   337,   369,   451,   731,   468,   327,   747,   634,   308,
+     505,    -1,   752,    -1,    -1,    -1,   729,    -1,   731,    -1,
+     747,    -1,    -1,   131,    -1,   752,    -1,    -1,    -1,    -1,
+      -1,   548,    -1,    -1,    -1,    -1,   749,   554,    -1,    -1,
+      -1,   781,    -1,   783,   757,    -1,   759,    -1,    -1,    -1,
+      -1,   568,   803,    -1,   781,   795,   783,    -1,    -1,   576,
+     577,   801,   802,    -1,    -1,    -1,    -1,    -1,   795,    -1,
+      -1,    -1,    -1,    -1,   801,   802,   366,    -1,   368,    -1,
+      -1,    -1,   833,    -1,    -1,    -1,   603,    -1,   605,    -1,
+      -1,    -1,   832,   383,   834,    -1,   809,    -1,   811,    -1,
+     840,    -1,    -1,    -1,    -1,   832,    -1,   834,    -1,    -1,
+      -1,   824,   629,   840,    -1,   632,    -1,   634,    -1,    -1,
+      -1,    -1,    -1,    12,    -1,    -1,    -1,    -1,    -1,   419,
+      -1,    -1,    -1,    -1,    -1,   652,    -1,   654,    -1,    28,
+      -1,    -1,    -1,    -1,    -1,    -1,    35,    -1,    -1,    -1,
+      -1,   441,    -1,    42,    -1,    44,    -1,    -1,    -1,    -1,
+     677,    -1,    -1,   680,    -1,    -1,   456,    56,    -1,    -1,
+      -1,   461,    -1,    -1,    63,    -1,    65,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    75,   704,    -1,    -1,
+      79,    80,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   719,    -1,    -1,    -1,    -1,    -1,   725,   726,
+     727,    -1,    -1,   730,    -1,    -1,    -1,   106,   107,   736,
+     737,   738,   111,    -1,   113,    -1,    -1,    -1,    -1,    -1,
+      -1,   120,   121,   122,   123,    -1,   125,    -1,    -1,    -1,
+      -1,    -1,     1,    -1,    -1,     4,    -1,    -1,    -1,    -1,
+      -1,    10,   542,    -1,    13,    14,   773,    16,    17,    18,
+      19,    20,    21,    22,    23,    -1,   155,    -1,    -1,    -1,
+      -1,    -1,   789,   790,   791,   792,    35,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     1,
+      -1,   808,     4,    -1,    -1,    -1,    -1,    -1,    10,    58,
+      -1,    13,    14,    -1,    16,    17,    18,    19,    20,    21,
+      22,    23,    -1,   830,    -1,    -1,    -1,    -1,    -1,    -1,
+      79,   611,   612,    35,    -1,    -1,    -1,    -1,     4,    -1,
+     847,     7,     8,     9,    -1,    -1,    12,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    58,    -1,    24,    -1,
+      -1,    -1,    28,    -1,    -1,    31,   646,    33,   648,    35,
+      -1,    -1,    -1,    39,    -1,    -1,    42,    79,    44,    -1,
+      46,    -1,   131,    -1,   664,    -1,    -1,    -1,    54,    -1,
+      56,    -1,    -1,    -1,    -1,    -1,    -1,    63,    -1,    65,
+      66,    -1,    -1,    -1,    70,    -1,    -1,    73,    74,    75,
+      -1,    -1,    -1,    79,    80,   695,    -1,    83,    -1,    85,
+      86,    -1,   702,   703,    -1,    -1,    92,    -1,    -1,   131,
+      -1,    -1,    -1,    -1,    -1,    -1,   102,    -1,   104,    -1,
+     106,   107,   108,   109,    -1,   111,    -1,   113,    -1,    -1,
+      -1,    -1,    -1,    -1,   120,   121,   122,   123,    -1,   125,
+      -1,    -1,    -1,    -1,    -1,    -1,     4,    -1,    -1,     7,
+       8,     9,    10,    -1,    12,    -1,    14,    15,    -1,    -1,
+      -1,    -1,    -1,   149,   150,    -1,    24,   153,    -1,   155,
+      28,    -1,    -1,    31,    -1,    33,   162,    35,    -1,   165,
+     780,    39,    -1,    -1,    42,    -1,    44,    -1,    46,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    54,    -1,    56,    -1,
+     800,    -1,    -1,   803,    -1,    63,    -1,    65,    66,    -1,
+      -1,    -1,    70,    -1,    -1,    73,    74,    75,    -1,    -1,
+      -1,    79,    80,    -1,    -1,    83,    -1,    85,    86,   829,
+      -1,    -1,    -1,   833,    92,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   102,    -1,   104,    -1,   106,   107,
+     108,   109,    -1,   111,    -1,   113,    -1,    -1,    -1,    -1,
+      -1,    -1,   120,   121,   122,   123,    -1,   125,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     4,    -1,
+      -1,     7,     8,     9,    10,    -1,    12,    -1,    -1,    15,
+      -1,   149,   150,    -1,    -1,   153,    -1,   155,    24,    -1,
+      -1,   159,    28,   161,   162,    31,    -1,    33,    -1,    35,
+      -1,    -1,    -1,    39,    -1,    -1,    42,    -1,    44,    -1,
+      46,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    54,    -1,
+      56,    -1,    -1,    -1,    -1,    -1,    -1,    63,    -1,    65,
+      66,    -1,    -1,    -1,    70,    -1,    -1,    73,    74,    75,
+      -1,    -1,    -1,    79,    80,    -1,    -1,    83,    -1,    85,
+      86,    -1,    -1,    -1,    -1,    -1,    92,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   102,    -1,   104,    -1,
+     106,   107,   108,   109,    -1,   111,    -1,   113,    -1,    -1,
+      -1,    -1,    -1,    -1,   120,   121,   122,   123,    -1,   125,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+       4,    -1,    -1,     7,     8,     9,    10,    -1,    12,    -1,
+      -1,    15,    -1,   149,   150,    -1,    -1,   153,    -1,   155,
+      24,    -1,    -1,   159,    28,   161,   162,    31,    -1,    33,
+      -1,    35,    -1,    -1,    -1,    39,    -1,    -1,    42,    -1,
+      44,    -1,    46,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      54,    -1,    56,    -1,    -1,    -1,    -1,    -1,    -1,    63,
+      -1,    65,    66,    -1,    -1,    -1,    70,    -1,    -1,    73,
+      74,    75,    -1,    -1,    -1,    79,    80,    -1,    -1,    83,
+      -1,    85,    86,    -1,    -1,    -1,    -1,    -1,    92,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   102,    -1,
+     104,    -1,   106,   107,   108,   109,    -1,   111,    -1,   113,
+      -1,    -1,    -1,    -1,    -1,    -1,   120,   121,   122,   123,
+      -1,   125,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,     4,    -1,    -1,     7,     8,     9,    10,    -1,
+      12,    -1,    -1,    15,    -1,   149,   150,    -1,    -1,   153,
+      -1,   155,    24,    -1,    -1,   159,    28,   161,   162,    31,
+      -1,    33,    -1,    35,    -1,    -1,    -1,    39,    -1,    -1,
+      42,    -1,    44,    -1,    46,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    54,    -1,    56,    -1,    -1,    -1,    -1,    -1,
+      -1,    63,    -1,    65,    66,    -1,    -1,    -1,    70,    -1,
+      -1,    73,    74,    75,    -1,    -1,    -1,    79,    80,    -1,
+      -1,    83,    -1,    85,    86,    -1,    -1,    -1,    -1,    -1,
+      92,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     102,    -1,   104,    -1,   106,   107,   108,   109,    -1,   111,
+      -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,   120,   121,
+     122,   123,    -1,   125,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,     4,    -1,    -1,     7,     8,     9,
+      -1,    -1,    12,    -1,    -1,    -1,    -1,   149,   150,    -1,
+      -1,   153,    -1,   155,    24,    -1,    -1,   159,    28,   161,
+     162,    31,    -1,    33,    -1,    35,    -1,    -1,    -1,    39,
+      -1,    -1,    42,    -1,    44,    -1,    46,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    54,    -1,    56,    -1,    -1,    -1,
+      -1,    -1,    -1,    63,    -1,    65,    66,    -1,    -1,    -1,
+      70,    -1,    -1,    73,    74,    75,    -1,    -1,    -1,    79,
+      80,    -1,    -1,    83,    -1,    85,    86,    -1,    -1,    -1,
+      -1,    -1,    92,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   102,    -1,   104,    -1,   106,   107,   108,   109,
+      -1,   111,    -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,
+     120,   121,   122,   123,    -1,   125,   126,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,     4,    -1,    -1,     7,
+       8,     9,    10,    -1,    12,    -1,    -1,    15,    -1,   149,
+     150,    -1,    -1,   153,    -1,   155,    24,    -1,   158,    -1,
+      28,   161,   162,    31,    -1,    33,    -1,    35,    -1,    -1,
+      -1,    39,    -1,    -1,    42,    -1,    44,    -1,    46,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    54,    -1,    56,    -1,
+      -1,    -1,    -1,    -1,    -1,    63,    -1,    65,    66,    -1,
+      -1,    -1,    70,    -1,    -1,    73,    74,    75,    -1,    -1,
+      -1,    79,    80,    -1,    -1,    83,    -1,    85,    86,    -1,
+      -1,    -1,    -1,    -1,    92,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   102,    -1,   104,    -1,   106,   107,
+     108,   109,    -1,   111,    -1,   113,    -1,    -1,    -1,    -1,
+      -1,    -1,   120,   121,   122,   123,    -1,   125,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     4,    -1,
+      -1,     7,     8,     9,    10,    -1,    12,    -1,    -1,    15,
+      -1,   149,   150,    -1,    -1,   153,    -1,   155,    24,    -1,
+      -1,    -1,    28,   161,   162,    31,    -1,    33,    -1,    35,
+      -1,    -1,    -1,    39,    -1,    -1,    42,    -1,    44,    -1,
+      46,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    54,    -1,
+      56,    -1,    -1,    -1,    -1,    -1,    -1,    63,    -1,    65,
+      66,    -1,    -1,    -1,    70,    -1,    -1,    73,    74,    75,
+      -1,    -1,    -1,    79,    80,    -1,    -1,    83,    -1,    85,
+      86,    -1,    -1,    -1,    -1,    -1,    92,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   102,    -1,   104,    -1,
+     106,   107,   108,   109,    -1,   111,    -1,   113,    -1,    -1,
+      -1,    -1,    -1,    -1,   120,   121,   122,   123,    -1,   125,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+       4,    -1,    -1,     7,     8,     9,    10,    -1,    12,    -1,
+      -1,    15,    -1,   149,   150,    -1,    -1,   153,    -1,   155,
+      24,    -1,    -1,    -1,    28,   161,   162,    31,    -1,    33,
+      -1,    35,    -1,    -1,    -1,    39,    -1,    -1,    42,    -1,
+      44,    -1,    46,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      54,    -1,    56,    -1,    -1,    -1,    -1,    -1,    -1,    63,
+      -1,    65,    66,    -1,    -1,    -1,    70,    -1,    -1,    73,
+      74,    75,    -1,    -1,    -1,    79,    80,    -1,    -1,    83,
+      -1,    85,    86,    -1,    -1,    -1,    -1,    -1,    92,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   102,    -1,
+     104,    -1,   106,   107,   108,   109,    -1,   111,    -1,   113,
+      -1,    -1,    -1,    -1,    -1,    -1,   120,   121,   122,   123,
+      -1,   125,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,     4,    -1,    -1,     7,     8,     9,    -1,    -1,
+      12,    -1,    -1,    15,    -1,   149,   150,    -1,    -1,   153,
+      -1,   155,    24,    -1,    -1,    -1,    28,   161,   162,    31,
+      -1,    33,    -1,    35,    -1,    -1,    -1,    39,    -1,    -1,
+      42,    -1,    44,    -1,    46,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    54,    -1,    56,    -1,    -1,    -1,    -1,    -1,
+      -1,    63,    -1,    65,    66,    -1,    -1,    -1,    70,    -1,
+      -1,    73,    74,    75,    -1,    -1,    -1,    79,    80,    -1,
+      -1,    83,    -1,    85,    86,    -1,    -1,    -1,    -1,    -1,
+      92,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     102,    -1,   104,    -1,   106,   107,   108,   109,    -1,   111,
+      -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,   120,   121,
+     122,   123,    -1,   125,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,     4,    -1,    -1,     7,     8,     9,
+      -1,    -1,    12,    -1,    -1,    15,    -1,   149,   150,    -1,
+      -1,   153,    -1,   155,    24,    -1,    -1,   159,    28,   161,
+     162,    31,    -1,    33,    -1,    35,    -1,    -1,    -1,    39,
+      -1,    -1,    42,    -1,    44,    -1,    46,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    54,    -1,    56,    -1,    -1,    -1,
+      -1,    -1,    -1,    63,    -1,    65,    66,    -1,    -1,    -1,
+      70,    -1,    -1,    73,    74,    75,    -1,    -1,    -1,    79,
+      80,    -1,    -1,    83,    -1,    85,    86,    -1,    -1,    -1,
+      -1,    -1,    92,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   102,    -1,   104,    -1,   106,   107,   108,   109,
+      -1,   111,    -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,
+     120,   121,   122,   123,    -1,   125,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,     4,    -1,    -1,     7,
+       8,     9,    -1,    -1,    12,    -1,    -1,    -1,    -1,   149,
+     150,    -1,    -1,   153,    -1,   155,    24,    -1,    -1,   159,
+      28,   161,   162,    31,    -1,    33,    34,    35,    36,    -1,
+      -1,    39,    -1,    -1,    42,    -1,    44,    -1,    46,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    54,    -1,    56,    -1,
+      -1,    -1,    -1,    -1,    -1,    63,    -1,    65,    66,    -1,
+      -1,    -1,    70,    -1,    -1,    73,    74,    75,    -1,    -1,
+      -1,    79,    80,    -1,    -1,    83,    -1,    85,    86,    -1,
+      -1,    -1,    -1,    -1,    92,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   102,    -1,   104,    -1,   106,   107,
+     108,   109,    -1,   111,    -1,   113,    -1,    -1,    -1,    -1,
+      -1,    -1,   120,   121,   122,   123,    -1,   125,    -1,    -1,
+      -1,    -1,    -1,    -1,     4,    -1,    -1,     7,     8,     9,
+      -1,    -1,    12,    -1,    -1,    15,    -1,    -1,    -1,    -1,
+      -1,   149,   150,    -1,    24,   153,    -1,   155,    28,    -1,
+      -1,    31,    -1,    33,   162,    35,    -1,    -1,    -1,    39,
+      -1,    -1,    42,    -1,    44,    -1,    46,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    54,    -1,    56,    -1,    -1,    -1,
+      -1,    -1,    -1,    63,    -1,    65,    66,    -1,    -1,    -1,
+      70,    -1,    -1,    73,    74,    75,    -1,    -1,    -1,    79,
+      80,    -1,    -1,    83,    -1,    85,    86,    -1,    -1,    -1,
+      -1,    -1,    92,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   102,    -1,   104,    -1,   106,   107,   108,   109,
+      -1,   111,    -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,
+     120,   121,   122,   123,    -1,   125,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,     4,    -1,    -1,     7,
+       8,     9,    -1,    -1,    12,    -1,    -1,    -1,    -1,   149,
+     150,    -1,    -1,   153,    -1,   155,    24,    -1,    -1,    -1,
+      28,   161,   162,    31,    -1,    33,    -1,    35,    -1,    -1,
+      -1,    39,    -1,    -1,    42,    -1,    44,    -1,    46,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    54,    -1,    56,    -1,
+      -1,    -1,    -1,    -1,    -1,    63,    -1,    65,    66,    -1,
+      -1,    -1,    70,    -1,    -1,    73,    74,    75,    -1,    -1,
+      -1,    79,    80,    -1,    -1,    83,    -1,    85,    86,    -1,
+      -1,    -1,    -1,    -1,    92,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   102,    -1,   104,    -1,   106,   107,
+     108,   109,    -1,   111,    -1,   113,    -1,    -1,    -1,    -1,
+      -1,    -1,   120,   121,   122,   123,    -1,   125,   126,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     4,    -1,
+      -1,     7,     8,     9,    -1,    -1,    12,    -1,    -1,    -1,
+      -1,   149,   150,    -1,    -1,   153,    -1,   155,    24,    -1,
+      -1,    -1,    28,   161,   162,    31,    -1,    33,    -1,    35,
+      -1,    -1,    -1,    39,    -1,    -1,    42,    -1,    44,    -1,
+      46,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    54,    -1,
+      56,    -1,    -1,    -1,    -1,    -1,    -1,    63,    -1,    65,
+      66,    -1,    -1,    -1,    70,    -1,    -1,    73,    74,    75,
+      -1,    -1,    -1,    79,    80,    -1,    -1,    83,    -1,    85,
+      86,    -1,    -1,    -1,    -1,    -1,    92,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   102,    -1,   104,    -1,
+     106,   107,   108,   109,    -1,   111,    -1,   113,    -1,    -1,
+      -1,    -1,    -1,    -1,   120,   121,   122,   123,    -1,   125,
+      -1,    -1,    -1,    -1,    -1,    -1,     4,    -1,    -1,     7,
+       8,     9,    -1,    -1,    12,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   149,   150,    -1,    24,   153,    -1,   155,
+      28,   157,    -1,    31,    -1,    33,   162,    35,    -1,    -1,
+      -1,    39,    -1,    -1,    42,    -1,    44,    -1,    46,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    54,    -1,    56,    -1,
+      -1,    -1,    -1,    -1,    -1,    63,    -1,    65,    66,    -1,
+      -1,    -1,    70,    -1,    -1,    73,    74,    75,    -1,    -1,
+      -1,    79,    80,    -1,    -1,    83,    -1,    85,    86,    -1,
+      -1,    -1,    -1,    -1,    92,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   102,    -1,   104,    -1,   106,   107,
+     108,   109,    -1,   111,    -1,   113,    -1,    -1,    -1,    -1,
+      -1,    -1,   120,   121,   122,   123,    -1,   125,    -1,    -1,
+      -1,    -1,    -1,    -1,     4,    -1,    -1,     7,     8,     9,
+      -1,    -1,    12,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   149,   150,    -1,    24,   153,    -1,   155,    28,   157,
+      -1,    31,    -1,    33,   162,    35,    -1,    -1,    -1,    39,
+      -1,    -1,    42,    -1,    44,    -1,    46,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    54,    -1,    56,    -1,    -1,    -1,
+      -1,    -1,    -1,    63,    -1,    65,    66,    -1,    -1,    -1,
+      70,    -1,    -1,    73,    74,    75,    -1,    -1,    -1,    79,
+      80,    -1,    -1,    83,    -1,    85,    86,    -1,    -1,    -1,
+      -1,    -1,    92,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   102,    -1,   104,    -1,   106,   107,   108,   109,
+      -1,   111,    -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,
+     120,   121,   122,   123,    -1,   125,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     4,
+      -1,    -1,     7,     8,     9,    -1,    -1,    12,    -1,   149,
+     150,    -1,    -1,   153,    -1,   155,    -1,    -1,    -1,    24,
+      -1,   161,   162,    28,    -1,    30,    31,    -1,    33,    -1,
+      35,    -1,    -1,    -1,    39,    -1,    -1,    42,    -1,    44,
+      -1,    46,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    54,
+      -1,    56,    -1,    -1,    -1,    -1,    -1,    -1,    63,    -1,
+      65,    66,    -1,    -1,    -1,    70,    -1,    -1,    73,    74,
+      75,    -1,    -1,    -1,    79,    80,    -1,    -1,    83,    -1,
+      85,    86,    -1,    -1,    -1,    -1,    -1,    92,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   102,    -1,   104,
+      -1,   106,   107,   108,   109,    -1,   111,    -1,   113,    -1,
+      -1,    -1,    -1,    -1,    -1,   120,   121,   122,   123,    -1,
+     125,    -1,    -1,    -1,    -1,    -1,    -1,     4,    -1,    -1,
+       7,     8,     9,    -1,    -1,    12,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   149,   150,    -1,    24,   153,    -1,
+     155,    28,    -1,    -1,    31,    -1,    33,   162,    35,    -1,
+      -1,    -1,    39,    -1,    -1,    42,    -1,    44,    -1,    46,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    54,    -1,    56,
+      57,    -1,    -1,    -1,    -1,    -1,    63,    -1,    65,    66,
+      -1,    -1,    -1,    70,    -1,    -1,    73,    74,    75,    -1,
+      -1,    -1,    79,    80,    -1,    -1,    83,    -1,    85,    86,
+      -1,    -1,    -1,    -1,    -1,    92,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   102,    -1,   104,    -1,   106,
+     107,   108,   109,    -1,   111,    -1,   113,    -1,    -1,    -1,
+      -1,    -1,    -1,   120,   121,   122,   123,    -1,   125,    -1,
+      -1,    -1,    -1,    -1,    -1,     4,    -1,    -1,     7,     8,
+       9,    -1,    -1,    12,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   149,   150,    -1,    24,   153,    -1,   155,    28,
+      -1,    -1,    31,    -1,    33,   162,    35,    -1,    -1,    -1,
+      39,    -1,    -1,    42,    -1,    44,    -1,    46,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    54,    -1,    56,    -1,    -1,
+      -1,    -1,    -1,    -1,    63,    -1,    65,    66,    -1,    -1,
+      -1,    70,    -1,    -1,    73,    74,    75,    -1,    -1,    -1,
+      79,    80,    -1,    -1,    83,    -1,    85,    86,    -1,    -1,
+      -1,    -1,    -1,    92,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   102,    -1,   104,    -1,   106,   107,   108,
+     109,    -1,   111,    -1,   113,    -1,    -1,    -1,    -1,    -1,
+      -1,   120,   121,   122,   123,    -1,   125,    -1,    -1,    -1,
+      -1,    -1,    -1,     4,    -1,    -1,     7,     8,     9,    -1,
+      -1,    12,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     149,   150,    -1,    24,   153,    -1,   155,    28,    -1,    -1,
+      31,    -1,    33,   162,    35,    -1,    -1,    -1,    39,    -1,
+      -1,    42,    -1,    44,    -1,    46,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    54,    -1,    56,    -1,    -1,    -1,    -1,
+      -1,    -1,    63,    -1,    65,    66,    -1,    -1,    -1,    70,
+      -1,    -1,    73,    74,    75,    -1,    -1,    -1,    79,    80,
+      -1,    -1,    83,    -1,    85,    86,    -1,    -1,    -1,    -1,
+      -1,    92,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   102,    -1,   104,    -1,   106,   107,   108,   109,    -1,
+     111,    -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,   120,
+     121,   122,   123,    -1,   125,    -1,    -1,    -1,    -1,    -1,
+      -1,     4,    -1,    -1,     7,     8,     9,    -1,    -1,    12,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   149,   150,
+      -1,    24,   153,    -1,   155,    28,    -1,    -1,    31,    -1,
+      33,   162,    35,    -1,    -1,    -1,    39,    -1,    -1,    42,
+      -1,    44,    -1,    46,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    54,    -1,    56,    -1,    -1,    -1,    -1,    -1,    -1,
+      63,    -1,    65,    66,    -1,    -1,    -1,    70,    -1,    -1,
+      73,    74,    75,    -1,    -1,    -1,    79,    80,    -1,    -1,
+      83,    -1,    85,    86,    -1,    -1,    -1,    -1,    -1,    92,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   102,
+      -1,   104,    -1,   106,   107,   108,   109,    -1,   111,    -1,
+     113,    -1,    -1,    -1,    -1,    -1,    -1,   120,   121,   122,
+     123,    -1,   125,    -1,    -1,    -1,    -1,    -1,    -1,     4,
+      -1,    -1,     7,     8,     9,    -1,    -1,    12,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   149,   150,    -1,    24,
+     153,    -1,   155,    28,    -1,    -1,    31,    -1,    33,   162,
+      35,    -1,    -1,    -1,    39,    -1,    -1,    42,    -1,    44,
+      -1,    46,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    54,
+      -1,    56,    -1,    -1,    -1,    -1,    -1,    -1,    63,    -1,
+      65,    66,    -1,    -1,    -1,    70,    -1,    -1,    73,    74,
+      75,    -1,    -1,     1,    79,    80,     4,    -1,    83,    -1,
+      85,    86,    10,    -1,    -1,    13,    14,    92,    16,    17,
+      18,    19,    20,    21,    22,    23,    -1,   102,    -1,   104,
+      -1,   106,   107,   108,   109,    -1,   111,    35,   113,    -1,
+      -1,    -1,    -1,    -1,    -1,   120,   121,   122,   123,    -1,
+     125,     3,     4,     5,     6,    -1,    -1,    -1,    10,    -1,
+      12,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   149,   150,    28,    -1,   153,    -1,
+      32,    79,    -1,    35,    -1,    37,    -1,   162,    -1,    41,
+      42,    43,    44,    45,    46,    -1,    48,    -1,    -1,    -1,
+      52,    53,    54,    55,    56,    -1,    -1,    -1,    -1,    61,
+      -1,    63,    64,    65,    -1,    67,    68,    69,    -1,    71,
+      -1,    73,    -1,    75,    76,    -1,    -1,    79,    80,    -1,
+      -1,    -1,    -1,   131,    -1,    87,    88,    -1,    -1,    -1,
+      92,    -1,    94,    -1,    -1,    -1,    98,    99,   100,   101,
+      -1,   103,    -1,   105,   106,   107,    -1,    -1,    -1,   111,
+      -1,   113,    -1,   115,   116,    -1,   118,    -1,   120,   121,
+     122,   123,    -1,   125,    -1,   127,     3,     4,   130,     6,
+       7,    -1,    -1,    10,    -1,    12,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    28,    -1,    -1,   156,    32,    -1,    -1,    35,    -1,
+      37,    -1,    -1,    -1,    41,    42,    43,    44,    45,    46,
+      -1,    -1,    -1,    -1,    -1,    52,    -1,    54,    55,    56,
+      -1,    -1,    -1,    -1,    61,    -1,    63,    64,    65,    -1,
+      67,    68,    69,    -1,    71,    -1,    73,    -1,    75,    76,
+      -1,    -1,    79,    80,    -1,    -1,    -1,    -1,    -1,    -1,
+      87,    88,    -1,    -1,    -1,    92,    -1,    94,    -1,    -1,
+      -1,    98,    99,   100,   101,    -1,   103,    -1,   105,   106,
+     107,    -1,    -1,    -1,   111,    -1,   113,    -1,   115,   116,
+      -1,   118,    -1,   120,   121,   122,   123,    -1,   125,    -1,
+     127,     3,     4,   130,     6,    -1,    -1,    -1,    10,    -1,
+      12,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    28,    -1,    -1,   156,
+      32,    -1,    -1,    35,    -1,    37,    -1,    -1,    -1,    41,
+      42,    43,    44,    45,    46,    -1,    -1,    -1,    -1,    -1,
+      52,    -1,    54,    55,    56,    -1,    -1,    -1,    -1,    61,
+      -1,    63,    64,    65,    -1,    67,    68,    69,    -1,    71,
+      -1,    73,    -1,    75,    76,    -1,    -1,    79,    80,    -1,
+      -1,    -1,    -1,    -1,    -1,    87,    88,    -1,    -1,    -1,
+      92,    -1,    94,    -1,    -1,    -1,    98,    99,   100,   101,
+      -1,   103,    -1,   105,   106,   107,    -1,    -1,    -1,   111,
+      -1,   113,    -1,   115,   116,    -1,   118,    -1,   120,   121,
+     122,   123,    -1,   125,    -1,   127,     4,    -1,   130,     7,
+       8,     9,    -1,    -1,    12,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    24,    -1,    -1,    -1,
+      28,    -1,    -1,    31,   156,    33,    -1,    35,    -1,    -1,
+      -1,    39,    -1,    -1,    42,    -1,    44,    -1,    46,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    54,    -1,    56,    -1,
+      -1,    -1,    -1,    -1,    -1,    63,    -1,    65,    66,    -1,
+      -1,    -1,    70,    -1,    -1,    73,    74,    75,    -1,    -1,
+      -1,    79,    80,    -1,    -1,    83,    -1,    85,    86,    -1,
+      -1,    -1,    -1,    -1,    92,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   102,    -1,   104,    -1,   106,   107,
+     108,   109,    -1,   111,    -1,   113,    -1,    -1,    -1,    -1,
+      -1,    -1,   120,   121,   122,   123,    -1,   125,    -1,     4,
+      -1,    -1,     7,     8,     9,    -1,    -1,    12,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    24,
+      -1,   149,   150,    28,    -1,   153,    31,   155,    33,    -1,
+      35,    -1,    -1,    -1,    39,    -1,    -1,    42,    -1,    44,
+      -1,    46,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    54,
+      -1,    56,    -1,    -1,    -1,    -1,    -1,    -1,    63,    -1,
+      65,    66,    -1,    -1,    -1,    70,    -1,    -1,    73,    74,
+      75,    -1,    -1,     1,    79,    80,     4,    -1,    83,    -1,
+      85,    86,    10,    -1,    -1,    13,    14,    92,    16,    17,
+      18,    19,    20,    21,    22,    23,    -1,   102,    -1,   104,
+      -1,   106,   107,   108,   109,    -1,   111,    35,   113,    -1,
+      -1,    -1,    -1,    -1,    -1,   120,   121,   122,   123,     1,
+     125,    -1,     4,    -1,    -1,    -1,    -1,    -1,    10,    -1,
+      58,    13,    14,    -1,    16,    17,    18,    19,    20,    21,
+      22,    23,    -1,    -1,   149,   150,    -1,    -1,   153,    -1,
+      -1,    79,    -1,    35,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,     3,     4,     5,     6,
+      -1,    -1,    -1,    -1,    -1,    12,    58,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    28,    -1,    -1,    -1,    32,    -1,    79,    35,    -1,
+      37,    -1,    -1,   131,    41,    42,    43,    44,    45,    46,
+      47,    48,    49,    50,    51,    52,    53,    54,    55,    56,
+      -1,    -1,    -1,    -1,    61,    -1,    63,    64,    65,    -1,
+      67,    68,    69,    -1,    71,    -1,    73,    -1,    75,    76,
+      -1,    -1,    79,    80,    -1,    -1,    -1,    -1,    -1,   131,
+      87,    88,    89,    -1,    -1,    92,    -1,    94,    -1,    -1,
+      -1,    98,    99,   100,   101,    -1,   103,    -1,   105,   106,
+     107,    -1,    -1,    -1,   111,    -1,   113,    -1,   115,   116,
+      -1,   118,   119,   120,   121,   122,   123,    -1,   125,    -1,
+     127,    -1,    -1,   130,     3,     4,     5,     6,    -1,    -1,
+      -1,    10,    -1,    12,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    28,
+      -1,    -1,    -1,    32,    -1,    -1,    35,    -1,    37,    -1,
+      -1,    -1,    41,    42,    43,    44,    45,    46,    -1,    48,
+      -1,    -1,    -1,    52,    53,    54,    55,    56,    -1,    -1,
+      -1,    -1,    61,    -1,    63,    64,    65,    -1,    67,    68,
+      69,    -1,    71,    -1,    73,    -1,    75,    76,    -1,    -1,
+      79,    80,    -1,    -1,    -1,    -1,    -1,    -1,    87,    88,
+      -1,    -1,    -1,    92,    -1,    94,    -1,    -1,    -1,    98,
+      99,   100,   101,    -1,   103,    -1,   105,   106,   107,    -1,
+      -1,    -1,   111,    -1,   113,    -1,   115,   116,    -1,   118,
+      -1,   120,   121,   122,   123,    -1,   125,    -1,   127,    -1,
+      -1,   130,     3,     4,     5,     6,    -1,    -1,    -1,    10,
+      -1,    12,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    28,    -1,    -1,
+      -1,    32,    -1,    -1,    35,    -1,    37,    -1,    -1,    -1,
+      41,    42,    43,    44,    45,    46,    -1,    -1,    -1,    -1,
+      -1,    52,    -1,    54,    55,    56,    -1,    -1,    -1,    -1,
+      61,    -1,    63,    64,    65,    -1,    67,    68,    69,    -1,
+      71,    -1,    73,    -1,    75,    76,    -1,    -1,    79,    80,
+      -1,    -1,    -1,    -1,    -1,    -1,    87,    88,    -1,    -1,
+      -1,    92,    -1,    94,    -1,    -1,    -1,    98,    99,   100,
+     101,    -1,   103,    -1,   105,   106,   107,    -1,    -1,    -1,
+     111,    -1,   113,    -1,   115,   116,    -1,   118,    -1,   120,
+     121,   122,   123,    -1,   125,    -1,   127,     3,     4,   130,
+       6,    -1,    -1,    -1,    -1,    -1,    12,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    28,    -1,    -1,    -1,    32,    -1,    -1,    35,
+      -1,    37,    -1,    -1,    -1,    41,    42,    43,    44,    45,
+      46,    -1,    -1,    -1,    -1,    -1,    52,    -1,    54,    55,
+      56,    -1,    -1,    -1,    -1,    61,    -1,    63,    64,    65,
+      -1,    67,    68,    69,    -1,    71,    -1,    73,    -1,    75,
+      76,    -1,    -1,    79,    80,    -1,    -1,    -1,    -1,    -1,
+      -1,    87,    88,    -1,    -1,    -1,    92,    -1,    94,    -1,
+      -1,    -1,    98,    99,   100,   101,    -1,   103,    -1,   105,
+     106,   107,    -1,    -1,    -1,   111,    -1,   113,   114,   115,
+     116,    -1,   118,    -1,   120,   121,   122,   123,    -1,   125,
+      -1,   127,    -1,    -1,   130,     3,     4,     5,     6,    -1,
+      -1,    -1,    -1,    -1,    12,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      28,    -1,    -1,    -1,    32,    -1,    -1,    35,    -1,    37,
+      -1,    -1,    -1,    41,    42,    43,    44,    45,    46,    -1,
+      -1,    -1,    -1,    -1,    52,    -1,    54,    55,    56,    -1,
+      -1,    -1,    -1,    61,    -1,    63,    64,    65,    -1,    67,
+      68,    69,    -1,    71,    -1,    73,    -1,    75,    76,    -1,
+      -1,    79,    80,    -1,    -1,    -1,    -1,    -1,    -1,    87,
+      88,    -1,    -1,    -1,    92,    -1,    94,    -1,    -1,    -1,
+      98,    99,   100,   101,    -1,   103,    -1,   105,   106,   107,
+      -1,    -1,    -1,   111,    -1,   113,    -1,   115,   116,    -1,
+     118,    -1,   120,   121,   122,   123,    -1,   125,    -1,   127,
+       3,     4,   130,     6,    -1,    -1,    -1,    -1,    -1,    12,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    28,    -1,    -1,    -1,    32,
+      -1,    -1,    35,    -1,    37,    -1,    -1,    -1,    41,    42,
+      43,    44,    45,    46,    -1,    -1,    -1,    -1,    -1,    52,
+      -1,    54,    55,    56,    -1,    -1,    -1,    -1,    61,    -1,
+      63,    64,    65,    -1,    67,    68,    69,    -1,    71,    -1,
+      73,    -1,    75,    76,    -1,    -1,    79,    80,    -1,    -1,
+      -1,    -1,    -1,    -1,    87,    88,    -1,    -1,    -1,    92,
+      -1,    94,    -1,    -1,    -1,    98,    99,   100,   101,    -1,
+     103,    -1,   105,   106,   107,     3,     4,    -1,   111,    -1,
+     113,    -1,   115,   116,    12,   118,    -1,   120,   121,   122,
+     123,    -1,   125,    -1,   127,     3,     4,   130,    -1,    -1,
+      28,    -1,    -1,    -1,    12,    -1,    -1,    35,    -1,    -1,
+      -1,    -1,    -1,    -1,    42,    -1,    44,    -1,    -1,    -1,
+      28,    -1,    -1,    -1,    -1,     4,    54,    35,    56,    -1,
+      -1,    -1,    -1,    12,    42,    63,    44,    65,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    73,    -1,    75,    56,    28,
+      -1,    79,    80,    32,    -1,    63,    35,    65,    -1,    -1,
+      -1,    -1,    -1,    42,    92,    44,    -1,    75,    -1,    -1,
+      -1,    79,    80,    -1,    -1,    -1,    -1,    56,   106,   107,
+      -1,    -1,    -1,   111,    63,   113,    65,    -1,    -1,    -1,
+      -1,    -1,   120,   121,   122,   123,    75,   125,   106,   107,
+      79,    80,    -1,   111,    -1,   113,    -1,    -1,    -1,    -1,
+      -1,    -1,   120,   121,   122,   123,     4,   125,    -1,    -1,
+      -1,     9,    -1,    -1,    12,    -1,    -1,   106,   107,    -1,
+      -1,    -1,   111,    -1,   113,    -1,    -1,    -1,    -1,    -1,
+      28,   120,   121,   122,   123,     4,   125,    35,    -1,    -1,
+      -1,    -1,    -1,    12,    42,    -1,    44,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    56,    28,
+      -1,    -1,    -1,    12,    -1,    63,    35,    65,    -1,    -1,
+      -1,    -1,    -1,    42,    -1,    44,    -1,    75,    -1,    28,
+      -1,    79,    80,    32,    -1,    -1,    35,    56,    -1,    -1,
+      -1,    -1,    -1,    42,    63,    44,    65,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    75,    56,   106,   107,
+      79,    80,    -1,   111,    63,   113,    65,    12,    -1,    -1,
+      -1,    -1,   120,   121,   122,   123,    75,   125,    -1,    -1,
+      79,    80,    -1,    28,    -1,    -1,    -1,   106,   107,    -1,
+      35,    -1,   111,    -1,   113,    -1,    -1,    42,    -1,    44,
+      -1,   120,   121,   122,   123,    -1,   125,   106,   107,    -1,
+      -1,    56,   111,    -1,   113,    -1,    -1,    -1,    63,    -1,
+      65,   120,   121,   122,   123,    -1,   125,    -1,    -1,    -1,
+      75,    -1,    -1,    -1,    79,    80,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   106,   107,    -1,    -1,    -1,   111,    -1,   113,    -1,
+      -1,    -1,    -1,    -1,    -1,   120,   121,   122,   123,    -1,
+     125
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int16 yystos[] =
+{
+       0,     3,     4,     5,     6,    12,    28,    32,    35,    37,
+      41,    42,    43,    44,    45,    46,    47,    48,    49,    50,
+      51,    52,    53,    54,    55,    56,    61,    63,    64,    65,
+      67,    68,    69,    71,    73,    75,    76,    79,    80,    87,
+      88,    89,    92,    94,    98,    99,   100,   101,   103,   105,
+     106,   107,   111,   113,   115,   116,   118,   119,   120,   121,
+     122,   123,   125,   127,   130,   168,   171,   172,   179,   181,
+     183,   184,   185,   188,   198,   201,   204,   209,   215,   219,
+     221,   222,   225,   226,   228,   259,   260,   261,   262,   264,
+     265,   269,   272,   276,   281,   286,     4,     7,     8,     9,
+      24,    28,    31,    33,    39,    42,    44,    46,    65,    66,
+      70,    73,    74,    83,    85,    86,   102,   104,   108,   109,
+     113,   149,   150,   153,   162,   225,   228,   229,   231,   232,
+     234,   235,   239,   241,   243,   248,   252,   253,   155,    10,
+     105,   156,   169,   170,     4,     9,   159,     4,   126,   159,
+       4,    32,    65,   113,   270,   271,   276,    55,    64,   130,
+      32,     4,    65,   113,     4,     4,   223,   224,   224,   150,
+     155,   162,   229,   230,   231,   232,   233,   235,   238,   240,
+     242,   244,   245,   246,   247,     4,    30,   105,   283,   284,
+     285,   155,   124,   130,   169,    55,    64,    65,    81,   113,
+     130,   155,   216,    64,   155,   258,   159,     4,     7,     4,
+       7,   247,   155,   159,   187,   183,   225,   247,   247,     4,
+     155,   187,   159,   189,   190,   225,   247,   250,   251,    38,
+      32,   155,   258,   247,   247,   169,     4,     4,   247,     0,
+      58,   169,   172,   148,   138,   139,   140,   141,   143,   144,
+     145,   148,   154,   155,   180,   158,   148,    65,   113,    28,
+      65,   113,   259,   260,   261,   266,   268,   281,   283,   154,
+     162,   155,   155,   155,   155,   155,   155,   155,   273,   276,
+     155,   247,   155,   233,   233,     4,    34,    36,   247,   277,
+     278,   279,   280,   233,   164,    82,   136,   137,   151,   152,
+     237,   149,   150,   158,     4,   263,   169,     1,     4,    10,
+      13,    14,    16,    17,    18,    19,    20,    21,    22,    23,
+      35,    79,   131,   287,   288,   289,   293,   294,    10,   155,
+       7,   126,   169,     9,   247,   148,   169,   158,   169,    25,
+       4,     4,   155,   149,   158,   233,   247,     4,   233,   164,
+     237,   133,   134,   135,   146,   147,   148,   149,   150,    26,
+      90,   132,    27,    91,   155,   273,    30,   283,    30,   158,
+     148,   227,   247,   247,   247,   207,     7,     4,     9,   277,
+       4,   195,   251,    44,   114,   179,   227,   247,     9,   190,
+      68,    30,    64,   249,   250,   227,   126,   158,   161,   191,
+     192,   194,   247,   195,   158,   158,   247,   169,   277,     4,
+       5,    48,   169,   173,   175,   176,   177,   179,   281,    30,
+     148,   169,    10,   172,   250,     4,    96,   157,   250,   247,
+     182,   225,   226,    73,    92,   247,     4,     4,    58,   169,
+     267,    30,     4,    96,   247,   273,   250,   277,   273,   247,
+     273,    44,    93,    97,   155,   275,   155,   247,   273,   276,
+     277,    30,   148,   155,   280,   280,   163,   156,   158,   234,
+     239,   240,   240,   250,   157,   158,   287,    10,   289,    10,
+      10,     9,    10,    15,   161,   247,   291,    10,   291,   291,
+      10,   291,   291,    10,   159,   290,   291,   292,    10,   292,
+      10,   292,    58,   288,    10,   292,   294,   295,   293,   157,
+     250,     9,   247,   287,   270,   287,     4,     7,    77,    77,
+     277,     4,   223,   157,   233,   238,   242,   242,   242,   242,
+     242,   242,   240,   240,   244,   244,   244,   245,   245,   247,
+     283,   273,    30,   273,   284,   165,   247,   157,   158,   169,
+     169,   174,   176,   157,   148,   157,   155,   158,     7,   169,
+     178,   179,   157,   158,   186,   158,   160,   250,   159,    29,
+      73,    92,   157,     9,   194,   247,   158,   160,   189,   251,
+     169,   287,   157,   155,   277,     5,    10,   173,   281,   176,
+     169,    40,   273,   247,   202,   157,   158,   155,   155,    42,
+     266,   273,   157,   158,   157,   157,   158,   157,   157,   275,
+     247,   158,   158,   157,   273,   247,   157,   174,   176,   279,
+       4,    58,    10,   247,    10,    10,    10,    10,    10,   159,
+     291,   150,   162,    10,   158,    10,    10,    32,    10,   295,
+      10,   158,   294,   157,    58,    58,    30,   282,    30,     9,
+       9,   157,   117,   157,   158,   283,   273,   250,   247,   206,
+     205,    81,   208,   247,    30,   277,   196,   251,   174,   199,
+     156,   190,   190,   247,    30,    30,    30,   160,   191,   191,
+      38,   210,   211,   212,    58,   277,   169,   173,   174,     4,
+     174,   226,   277,   277,   247,    30,   247,     4,   157,   273,
+     273,   169,    30,    30,   134,   163,    32,   291,   150,   291,
+     290,    10,   294,    32,    32,   273,   273,   155,   155,   148,
+     247,   247,   166,   174,   174,   124,   130,   117,   276,   157,
+     158,    57,    58,    59,   200,   179,   159,   159,   159,   191,
+     193,    57,   213,   214,   247,    58,   211,   169,    32,   157,
+     174,   254,   169,    58,   128,   203,   157,   157,   157,   273,
+     276,   157,   157,   157,   254,   273,   273,   247,   163,   277,
+     277,   247,   157,   158,   157,    81,    81,   247,   247,   247,
+      30,   169,   247,   169,   179,    71,   247,   247,   247,   158,
+     160,   158,   117,   103,   174,   169,    58,   255,   176,   130,
+      30,   169,   169,    30,   236,   157,   157,   247,   110,   218,
+     273,   274,   174,   256,   158,   174,   191,   191,   213,   247,
+     254,   113,    58,   220,   274,   254,   256,   273,   163,    30,
+     117,   247,   169,   158,   169,    58,   257,   251,   200,   118,
+     169,   274,   247,   174,   273,   256,    65,   158,   197,   256,
+     157,    84,   217,   247,     4
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int16 yyr1[] =
+{
+       0,   167,   168,   168,   168,   169,   169,   170,   170,   171,
+     172,   172,   172,   172,   172,   173,   173,   173,   174,   174,
+     175,   175,   175,   175,   176,   176,   177,   177,   178,   178,
+     179,   179,   179,   179,   179,   179,   179,   179,   179,   179,
+     179,   179,   179,   179,   179,   179,   179,   180,   180,   180,
+     180,   180,   180,   180,   180,   181,   182,   182,   183,   183,
+     183,   183,   183,   184,   184,   185,   185,   185,   185,   185,
+     185,   185,   185,   185,   185,   186,   186,   187,   187,   188,
+     188,   188,   188,   188,   188,   188,   188,   188,   188,   188,
+     188,   188,   188,   188,   188,   189,   190,   190,   191,   191,
+     192,   192,   192,   193,   193,   193,   194,   194,   194,   194,
+     194,   194,   195,   195,   196,   196,   197,   197,   198,   198,
+     198,   198,   199,   199,   199,   200,   200,   200,   202,   201,
+     203,   203,   203,   205,   204,   206,   204,   207,   204,   208,
+     208,   208,   209,   209,   210,   210,   211,   212,   213,   213,
+     213,   214,   214,   216,   215,   217,   217,   218,   218,   219,
+     220,   221,   221,   221,   221,   221,   221,   221,   221,   221,
+     221,   221,   222,   222,   222,   222,   222,   222,   222,   222,
+     222,   222,   223,   224,   224,   225,   225,   225,   225,   225,
+     225,   225,   225,   226,   226,   227,   227,   228,   228,   228,
+     229,   229,   229,   229,   229,   229,   229,   229,   229,   229,
+     229,   230,   230,   231,   231,   231,   231,   231,   232,   232,
+     232,   232,   232,   232,   232,   233,   233,   233,   233,   234,
+     234,   234,   234,   235,   235,   235,   235,   235,   236,   236,
+     237,   237,   237,   237,   237,   238,   238,   239,   239,   240,
+     240,   241,   241,   242,   242,   242,   243,   243,   243,   244,
+     244,   244,   244,   244,   244,   244,   245,   245,   245,   245,
+     246,   246,   246,   247,   247,   248,   248,   249,   249,   250,
+     250,   251,   252,   253,   253,   254,   255,   255,   256,   257,
+     257,   258,   258,   259,   259,   259,   260,   260,   260,   260,
+     261,   261,   262,   263,   263,   264,   264,   265,   266,   266,
+     267,   268,   268,   268,   268,   268,   268,   269,   270,   271,
+     271,   272,   273,   273,   273,   273,   273,   274,   274,   275,
+     275,   276,   276,   276,   276,   276,   276,   276,   276,   276,
+     276,   276,   276,   276,   276,   276,   276,   276,   276,   276,
+     276,   277,   277,   278,   278,   279,   279,   279,   280,   280,
+     280,   280,   280,   281,   281,   281,   281,   281,   281,   281,
+     281,   282,   282,   283,   283,   284,   284,   284,   285,   285,
+     285,   285,   285,   286,   286,   286,   286,   286,   287,   287,
+     288,   288,   289,   289,   289,   289,   289,   289,   289,   289,
+     289,   289,   289,   289,   289,   289,   289,   289,   289,   289,
+     289,   289,   289,   289,   289,   290,   290,   290,   290,   290,
+     291,   291,   291,   292,   292,   293,   293,   294,   295,   295,
+     295
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     3,     3,     1,     1,     1,     2,     1,
+       0,     1,     1,     1,     2,     1,     2,     3,     0,     1,
+       1,     1,     1,     2,     1,     2,     1,     3,     1,     3,
+       1,     2,     2,     4,     5,     4,     1,     2,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     3,     1,     3,     3,     3,
+       3,     3,     3,     1,     2,     1,     1,     2,     1,     2,
+       2,     2,     2,     2,     2,     0,     1,     0,     3,     3,
+       4,     3,     5,     5,     2,     1,     5,     7,     7,     7,
+       3,     3,     2,     3,     3,     1,     1,     3,     1,     2,
+       1,     3,     3,     1,     3,     3,     0,     1,     2,     2,
+       4,     5,     5,     8,     0,     1,     0,     2,     5,     4,
+       3,     4,     2,     5,     3,     1,     2,     1,     0,     6,
+       1,     2,     1,     0,     7,     0,     7,     0,     5,     3,
+       3,     1,     7,     4,     1,     2,     3,     2,     1,     3,
+       1,     1,     3,     0,    11,     1,     2,     0,     2,     8,
+       2,     2,     2,     2,     2,     2,     2,     1,     2,     2,
+       2,     1,     2,     2,     1,     3,     1,     1,     1,     1,
+       1,     1,     3,     1,     3,     1,     4,     3,     4,     3,
+       3,     3,     3,     1,     1,     1,     3,     4,     4,     4,
+       1,     1,     1,     1,     1,     1,     1,     1,     2,     4,
+       2,     1,     3,     1,     1,     1,     1,     1,     4,     6,
+       4,     6,     6,     6,     2,     1,     1,     2,     2,     1,
+       1,     2,     2,     5,     8,     6,     5,     8,     0,     2,
+       1,     1,     1,     1,     1,     1,     3,     1,     3,     1,
+       3,     1,     3,     1,     3,     3,     1,     3,     3,     1,
+       3,     3,     3,     3,     3,     3,     1,     3,     3,     3,
+       1,     3,     3,     1,     1,     1,     1,     0,     1,     1,
+       3,     1,     1,     1,     3,     2,     1,     2,     2,     1,
+       2,     0,     2,     8,     6,     8,     8,    10,    10,     7,
+      10,     8,     4,     1,     3,     4,     2,     3,     2,     3,
+       2,     0,     3,     1,     1,     1,     1,     2,     3,     3,
+       1,     4,     1,     2,     3,     3,     4,     1,     3,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     4,     1,     1,     1,     2,     6,     4,
+       3,     0,     1,     1,     3,     1,     2,     2,     1,     3,
+       3,     5,     5,     2,     4,     4,     3,     5,     5,     5,
+       6,     0,     2,     1,     3,     1,     3,     5,     1,     4,
+       6,     6,    10,     5,     6,     6,     6,     6,     1,     2,
+       1,     2,     1,     2,     2,     3,     2,     3,     2,     3,
+       2,     3,     3,     4,     2,     2,     2,     3,     2,     3,
+       3,     3,     3,     2,     3,     1,     2,     3,     4,     3,
+       1,     2,     1,     1,     3,     1,     2,     1,     1,     2,
+       3
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = BASICYYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == BASICYYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use BASICYYerror or BASICYYUNDEF. */
+#define YYERRCODE BASICYYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if BASICYYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !BASICYYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !BASICYYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+/* Context of a parse error.  */
+typedef struct
+{
+  yy_state_t *yyssp;
+  yysymbol_kind_t yytoken;
+} yypcontext_t;
+
+/* Put in YYARG at most YYARGN of the expected tokens given the
+   current YYCTX, and return the number of tokens stored in YYARG.  If
+   YYARG is null, return the number of expected tokens (guaranteed to
+   be less than YYNTOKENS).  Return YYENOMEM on memory exhaustion.
+   Return 0 if there are more than YYARGN expected tokens, yet fill
+   YYARG up to YYARGN. */
+static int
+yypcontext_expected_tokens (const yypcontext_t *yyctx,
+                            yysymbol_kind_t yyarg[], int yyargn)
+{
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  int yyn = yypact[+*yyctx->yyssp];
+  if (!yypact_value_is_default (yyn))
+    {
+      /* Start YYX at -YYN if negative to avoid negative indexes in
+         YYCHECK.  In other words, skip the first -YYN actions for
+         this state because they are default actions.  */
+      int yyxbegin = yyn < 0 ? -yyn : 0;
+      /* Stay within bounds of both yycheck and yytname.  */
+      int yychecklim = YYLAST - yyn + 1;
+      int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+      int yyx;
+      for (yyx = yyxbegin; yyx < yyxend; ++yyx)
+        if (yycheck[yyx + yyn] == yyx && yyx != YYSYMBOL_YYerror
+            && !yytable_value_is_error (yytable[yyx + yyn]))
+          {
+            if (!yyarg)
+              ++yycount;
+            else if (yycount == yyargn)
+              return 0;
+            else
+              yyarg[yycount++] = YY_CAST (yysymbol_kind_t, yyx);
+          }
+    }
+  if (yyarg && yycount == 0 && 0 < yyargn)
+    yyarg[0] = YYSYMBOL_YYEMPTY;
+  return yycount;
+}
+
+
+
+
+#ifndef yystrlen
+# if defined __GLIBC__ && defined _STRING_H
+#  define yystrlen(S) (YY_CAST (YYPTRDIFF_T, strlen (S)))
+# else
+/* Return the length of YYSTR.  */
+static YYPTRDIFF_T
+yystrlen (const char *yystr)
+{
+  YYPTRDIFF_T yylen;
+  for (yylen = 0; yystr[yylen]; yylen++)
+    continue;
+  return yylen;
+}
+# endif
+#endif
+
+#ifndef yystpcpy
+# if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
+#  define yystpcpy stpcpy
+# else
+/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
+   YYDEST.  */
+static char *
+yystpcpy (char *yydest, const char *yysrc)
+{
+  char *yyd = yydest;
+  const char *yys = yysrc;
+
+  while ((*yyd++ = *yys++) != '\0')
+    continue;
+
+  return yyd - 1;
+}
+# endif
+#endif
+
+#ifndef yytnamerr
+/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
+   quotes and backslashes, so that it's suitable for yyerror.  The
+   heuristic is that double-quoting is unnecessary unless the string
+   contains an apostrophe, a comma, or backslash (other than
+   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
+   null, do not copy; instead, return the length of what the result
+   would have been.  */
+static YYPTRDIFF_T
+yytnamerr (char *yyres, const char *yystr)
+{
+  if (*yystr == '"')
+    {
+      YYPTRDIFF_T yyn = 0;
+      char const *yyp = yystr;
+      for (;;)
+        switch (*++yyp)
+          {
+          case '\'':
+          case ',':
+            goto do_not_strip_quotes;
+
+          case '\\':
+            if (*++yyp != '\\')
+              goto do_not_strip_quotes;
+            else
+              goto append;
+
+          append:
+          default:
+            if (yyres)
+              yyres[yyn] = *yyp;
+            yyn++;
+            break;
+
+          case '"':
+            if (yyres)
+              yyres[yyn] = '\0';
+            return yyn;
+          }
+    do_not_strip_quotes: ;
+    }
+
+  if (yyres)
+    return yystpcpy (yyres, yystr) - yyres;
+  else
+    return yystrlen (yystr);
+}
+#endif
+
+
+static int
+yy_syntax_error_arguments (const yypcontext_t *yyctx,
+                           yysymbol_kind_t yyarg[], int yyargn)
+{
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  /* There are many possibilities here to consider:
+     - If this state is a consistent state with a default action, then
+       the only way this function was invoked is if the default action
+       is an error action.  In that case, don't check for expected
+       tokens because there are none.
+     - The only way there can be no lookahead present (in yychar) is if
+       this state is a consistent state with a default action.  Thus,
+       detecting the absence of a lookahead is sufficient to determine
+       that there is no unexpected or expected token to report.  In that
+       case, just report a simple "syntax error".
+     - Don't assume there isn't a lookahead just because this state is a
+       consistent state with a default action.  There might have been a
+       previous inconsistent state, consistent state with a non-default
+       action, or user semantic action that manipulated yychar.
+     - Of course, the expected token list depends on states to have
+       correct lookahead information, and it depends on the parser not
+       to perform extra reductions after fetching a lookahead from the
+       scanner and before detecting a syntax error.  Thus, state merging
+       (from LALR or IELR) and default reductions corrupt the expected
+       token list.  However, the list is correct for canonical LR with
+       one exception: it will still contain any token that will not be
+       accepted due to an error action in a later state.
+  */
+  if (yyctx->yytoken != YYSYMBOL_YYEMPTY)
+    {
+      int yyn;
+      if (yyarg)
+        yyarg[yycount] = yyctx->yytoken;
+      ++yycount;
+      yyn = yypcontext_expected_tokens (yyctx,
+                                        yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+      if (yyn == YYENOMEM)
+        return YYENOMEM;
+      else
+        yycount += yyn;
+    }
+  return yycount;
+}
+
+/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
+   about the unexpected token YYTOKEN for the state stack whose top is
+   YYSSP.
+
+   Return 0 if *YYMSG was successfully written.  Return -1 if *YYMSG is
+   not large enough to hold the message.  In that case, also set
+   *YYMSG_ALLOC to the required number of bytes.  Return YYENOMEM if the
+   required number of bytes is too large to store.  */
+static int
+yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
+                const yypcontext_t *yyctx)
+{
+  enum { YYARGS_MAX = 5 };
+  /* Internationalized format string. */
+  const char *yyformat = YY_NULLPTR;
+  /* Arguments of yyformat: reported tokens (one for the "unexpected",
+     one per "expected"). */
+  yysymbol_kind_t yyarg[YYARGS_MAX];
+  /* Cumulated lengths of YYARG.  */
+  YYPTRDIFF_T yysize = 0;
+
+  /* Actual size of YYARG. */
+  int yycount = yy_syntax_error_arguments (yyctx, yyarg, YYARGS_MAX);
+  if (yycount == YYENOMEM)
+    return YYENOMEM;
+
+  switch (yycount)
+    {
+#define YYCASE_(N, S)                       \
+      case N:                               \
+        yyformat = S;                       \
+        break
+    default: /* Avoid compiler warnings. */
+      YYCASE_(0, YY_("syntax error"));
+      YYCASE_(1, YY_("syntax error, unexpected %s"));
+      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
+      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
+      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
+      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
+#undef YYCASE_
+    }
+
+  /* Compute error message size.  Don't count the "%s"s, but reserve
+     room for the terminator.  */
+  yysize = yystrlen (yyformat) - 2 * yycount + 1;
+  {
+    int yyi;
+    for (yyi = 0; yyi < yycount; ++yyi)
+      {
+        YYPTRDIFF_T yysize1
+          = yysize + yytnamerr (YY_NULLPTR, yytname[yyarg[yyi]]);
+        if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
+          yysize = yysize1;
+        else
+          return YYENOMEM;
+      }
+  }
+
+  if (*yymsg_alloc < yysize)
+    {
+      *yymsg_alloc = 2 * yysize;
+      if (! (yysize <= *yymsg_alloc
+             && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
+        *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
+      return -1;
+    }
+
+  /* Avoid sprintf, as that infringes on the user's name space.
+     Don't have undefined behavior even if the translation
+     produced a string with the wrong number of "%s"s.  */
+  {
+    char *yyp = *yymsg;
+    int yyi = 0;
+    while ((*yyp = *yyformat) != '\0')
+      if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
+        {
+          yyp += yytnamerr (yyp, yytname[yyarg[yyi++]]);
+          yyformat += 2;
+        }
+      else
+        {
+          ++yyp;
+          ++yyformat;
+        }
+  }
+  return 0;
+}
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
+{
+  YY_USE (yyvaluep);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void)
+{
+/* Lookahead token kind.  */
+int yychar;
+
+
+/* The semantic value of the lookahead symbol.  */
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
+
+    /* Number of syntax errors so far.  */
+    int yynerrs = 0;
+
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+
+  /* Buffer for error messages, and its allocated size.  */
+  char yymsgbuf[128];
+  char *yymsg = yymsgbuf;
+  YYPTRDIFF_T yymsg_alloc = sizeof yymsgbuf;
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = BASICYYEMPTY; /* Cause a token to be read.  */
+
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == BASICYYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex (&yylval);
+    }
+
+  if (yychar <= BASICYYEOF)
+    {
+      yychar = BASICYYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == BASICYYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = BASICYYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = BASICYYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 9: /* toplabel: "label"  */
+#line 562 "frontends/basic/basic.y"
+  {
+        AST *label = NewAST(AST_LABEL, yyvsp[0], NULL);
+        AST *stmt = NewAST(AST_STMTLIST, label, NULL);
+        current->body = AddToList(current->body, stmt);
+  }
+#line 3641 "./build/basic.tab.c"
+    break;
+
+  case 10: /* topitem: %empty  */
+#line 572 "frontends/basic/basic.y"
+    { yyval = NULL; }
+#line 3647 "./build/basic.tab.c"
+    break;
+
+  case 11: /* topitem: statement  */
+#line 574 "frontends/basic/basic.y"
+    {
+        AST *stmtholder = NewAST(AST_STMTLIST, yyvsp[0], NULL);
+        current->body = AddToList(current->body, stmtholder);
+        yyval = stmtholder;
+    }
+#line 3657 "./build/basic.tab.c"
+    break;
+
+  case 12: /* topitem: topdecl  */
+#line 580 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 3663 "./build/basic.tab.c"
+    break;
+
+  case 13: /* topitem: "data"  */
+#line 582 "frontends/basic/basic.y"
+    {
+        AST *list = NewAST(AST_EXPRLIST, yyvsp[0], NULL);
+        current->bas_data = AddToListEx(current->bas_data, list, &current->bas_data_tail);
+    }
+#line 3672 "./build/basic.tab.c"
+    break;
+
+  case 14: /* topitem: toplabel topitem  */
+#line 587 "frontends/basic/basic.y"
+    {
+        yyval = yyvsp[0];
+    }
+#line 3680 "./build/basic.tab.c"
+    break;
+
+  case 15: /* wrapped_stmt: statement  */
+#line 594 "frontends/basic/basic.y"
+    {
+        yyval = NewAST(AST_STMTLIST, yyvsp[0], NULL);
+    }
+#line 3688 "./build/basic.tab.c"
+    break;
+
+  case 16: /* wrapped_stmt: "label" wrapped_stmt  */
+#line 598 "frontends/basic/basic.y"
+    {
+        AST *label = NewAST(AST_LABEL, yyvsp[-1], NULL);
+        yyval = NewAST(AST_STMTLIST, label, yyvsp[0]);
+    }
+#line 3697 "./build/basic.tab.c"
+    break;
+
+  case 17: /* wrapped_stmt: "label" "end of line" wrapped_stmt  */
+#line 603 "frontends/basic/basic.y"
+    {
+        AST *label = NewAST(AST_LABEL, yyvsp[-2], NULL);
+        yyval = NewAST(AST_STMTLIST, label, yyvsp[0]);
+    }
+#line 3706 "./build/basic.tab.c"
+    break;
+
+  case 18: /* optstatementlist: %empty  */
+#line 611 "frontends/basic/basic.y"
+    { yyval = NULL; }
+#line 3712 "./build/basic.tab.c"
+    break;
+
+  case 19: /* optstatementlist: statementlist  */
+#line 613 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 3718 "./build/basic.tab.c"
+    break;
+
+  case 20: /* stmtlistitem: wrapped_stmt  */
+#line 618 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 3724 "./build/basic.tab.c"
+    break;
+
+  case 21: /* stmtlistitem: dimension  */
+#line 620 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_STMTLIST, yyvsp[0], NULL); }
+#line 3730 "./build/basic.tab.c"
+    break;
+
+  case 22: /* stmtlistitem: "label"  */
+#line 622 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_STMTLIST, NewAST(AST_LABEL, yyvsp[0], NULL), NULL); }
+#line 3736 "./build/basic.tab.c"
+    break;
+
+  case 23: /* stmtlistitem: "label" dimension  */
+#line 624 "frontends/basic/basic.y"
+      {
+        AST *label = NewAST(AST_STMTLIST, NewAST(AST_LABEL, yyvsp[-1], NULL), NULL);
+        AST *dim = NewAST(AST_STMTLIST, yyvsp[0], label);
+        yyval = dim;
+      }
+#line 3746 "./build/basic.tab.c"
+    break;
+
+  case 24: /* statementlist: realstatementlist  */
+#line 633 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 3752 "./build/basic.tab.c"
+    break;
+
+  case 25: /* statementlist: eoln statementlist  */
+#line 635 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 3758 "./build/basic.tab.c"
+    break;
+
+  case 26: /* realstatementlist: stmtlistitem  */
+#line 640 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 3764 "./build/basic.tab.c"
+    break;
+
+  case 27: /* realstatementlist: stmtlistitem eoln optstatementlist  */
+#line 642 "frontends/basic/basic.y"
+    { yyval = AddToList(yyvsp[-2], yyvsp[0]); }
+#line 3770 "./build/basic.tab.c"
+    break;
+
+  case 28: /* ifline: statement  */
+#line 647 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_STMTLIST, yyvsp[0], NULL); }
+#line 3776 "./build/basic.tab.c"
+    break;
+
+  case 29: /* ifline: ifline ':' statement  */
+#line 649 "frontends/basic/basic.y"
+    { yyval = AddToList(yyvsp[-2], NewAST(AST_STMTLIST, yyvsp[0], NULL)); }
+#line 3782 "./build/basic.tab.c"
+    break;
+
+  case 30: /* statement: assign_statement  */
+#line 654 "frontends/basic/basic.y"
+    {
+        yyval = yyvsp[0];
+    }
+#line 3790 "./build/basic.tab.c"
+    break;
+
+  case 31: /* statement: "identifier" np_exprlist  */
+#line 658 "frontends/basic/basic.y"
+    {
+        AST *params;
+        params = yyvsp[0];
+        yyval = NewAST(AST_FUNCCALL, yyvsp[-1], params);
+    }
+#line 3800 "./build/basic.tab.c"
+    break;
+
+  case 32: /* statement: "call" "identifier"  */
+#line 664 "frontends/basic/basic.y"
+    {
+        AST *params;
+        params = NULL;
+        yyval = NewAST(AST_FUNCCALL, yyvsp[0], params);
+    }
+#line 3810 "./build/basic.tab.c"
+    break;
+
+  case 33: /* statement: "call" "identifier" '(' ')'  */
+#line 670 "frontends/basic/basic.y"
+    {
+        AST *params;
+        params = NULL;
+        yyval = NewAST(AST_FUNCCALL, yyvsp[-2], params);
+    }
+#line 3820 "./build/basic.tab.c"
+    break;
+
+  case 34: /* statement: "call" "identifier" '(' exprlist ')'  */
+#line 676 "frontends/basic/basic.y"
+    {
+        AST *params;
+        params = yyvsp[-1];
+        yyval = NewAST(AST_FUNCCALL, yyvsp[-3], params);
+    }
+#line 3830 "./build/basic.tab.c"
+    break;
+
+  case 35: /* statement: "var" "identifier" '=' expr  */
+#line 682 "frontends/basic/basic.y"
+    {
+      AST *name = yyvsp[-2];
+      AST *assign = AstAssign(name, yyvsp[0]);
+      assign = NewAST(AST_LISTHOLDER, assign, NULL);
+      yyval = NewAST(AST_DECLARE_VAR, NULL, assign);
+    }
+#line 3841 "./build/basic.tab.c"
+    break;
+
+  case 36: /* statement: varexpr  */
+#line 689 "frontends/basic/basic.y"
+    {
+        AST *top = yyvsp[0];
+        AST *ast = top;
+        while (ast && ast->kind == AST_COMMENTEDNODE) {
+            ast = ast->left;
+        }
+        if (ast && ast->kind != AST_FUNCCALL) {
+            yyval = NewAST(AST_FUNCCALL, ast, NULL);
+        } else {
+            yyval = top;
+        }
+    }
+#line 3858 "./build/basic.tab.c"
+    break;
+
+  case 37: /* statement: "delete" expr  */
+#line 702 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_DELETE, yyvsp[0], NULL); }
+#line 3864 "./build/basic.tab.c"
+    break;
+
+  case 38: /* statement: iostmt  */
+#line 704 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 3870 "./build/basic.tab.c"
+    break;
+
+  case 39: /* statement: branchstmt  */
+#line 706 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 3876 "./build/basic.tab.c"
+    break;
+
+  case 40: /* statement: ifstmt  */
+#line 708 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 3882 "./build/basic.tab.c"
+    break;
+
+  case 41: /* statement: whilestmt  */
+#line 710 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 3888 "./build/basic.tab.c"
+    break;
+
+  case 42: /* statement: doloopstmt  */
+#line 712 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 3894 "./build/basic.tab.c"
+    break;
+
+  case 43: /* statement: forstmt  */
+#line 714 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 3900 "./build/basic.tab.c"
+    break;
+
+  case 44: /* statement: trycatchstmt  */
+#line 716 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 3906 "./build/basic.tab.c"
+    break;
+
+  case 45: /* statement: selectstmt  */
+#line 718 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 3912 "./build/basic.tab.c"
+    break;
+
+  case 46: /* statement: asmstmt  */
+#line 720 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 3918 "./build/basic.tab.c"
+    break;
+
+  case 47: /* assignment_operator: '='  */
+#line 725 "frontends/basic/basic.y"
+            { yyval = AstAssign(NULL, NULL); }
+#line 3924 "./build/basic.tab.c"
+    break;
+
+  case 48: /* assignment_operator: "*="  */
+#line 727 "frontends/basic/basic.y"
+            { yyval = AstOpAssign('*', NULL, NULL); }
+#line 3930 "./build/basic.tab.c"
+    break;
+
+  case 49: /* assignment_operator: "/="  */
+#line 729 "frontends/basic/basic.y"
+            { yyval = AstOpAssign('/', NULL, NULL); }
+#line 3936 "./build/basic.tab.c"
+    break;
+
+  case 50: /* assignment_operator: "+="  */
+#line 731 "frontends/basic/basic.y"
+            { yyval = AstOpAssign('+', NULL, NULL); }
+#line 3942 "./build/basic.tab.c"
+    break;
+
+  case 51: /* assignment_operator: "-="  */
+#line 733 "frontends/basic/basic.y"
+            { yyval = AstOpAssign('-', NULL, NULL); }
+#line 3948 "./build/basic.tab.c"
+    break;
+
+  case 52: /* assignment_operator: "AND="  */
+#line 735 "frontends/basic/basic.y"
+            { yyval = AstOpAssign('&', NULL, NULL); }
+#line 3954 "./build/basic.tab.c"
+    break;
+
+  case 53: /* assignment_operator: "XOR="  */
+#line 737 "frontends/basic/basic.y"
+            { yyval = AstOpAssign('^', NULL, NULL); }
+#line 3960 "./build/basic.tab.c"
+    break;
+
+  case 54: /* assignment_operator: "OR="  */
+#line 739 "frontends/basic/basic.y"
+            { yyval = AstOpAssign('|', NULL, NULL); }
+#line 3966 "./build/basic.tab.c"
+    break;
+
+  case 55: /* varassignlist: varassigntarget ',' multivars  */
+#line 745 "frontends/basic/basic.y"
+      { yyval = NewAST(AST_EXPRLIST, yyvsp[-2], yyvsp[0]); }
+#line 3972 "./build/basic.tab.c"
+    break;
+
+  case 56: /* multivars: varassigntarget  */
+#line 750 "frontends/basic/basic.y"
+      { yyval = NewAST(AST_EXPRLIST, yyvsp[0], NULL); }
+#line 3978 "./build/basic.tab.c"
+    break;
+
+  case 57: /* multivars: multivars ',' varassigntarget  */
+#line 752 "frontends/basic/basic.y"
+      { yyval = AddToList(yyvsp[-2], NewAST(AST_EXPRLIST, yyvsp[0], NULL)); }
+#line 3984 "./build/basic.tab.c"
+    break;
+
+  case 58: /* simple_assign_statement: varexpr assignment_operator expr  */
+#line 758 "frontends/basic/basic.y"
+    {
+        AST *op = yyvsp[-1];
+        op->left = yyvsp[-2];
+        op->right = yyvsp[0];
+        yyval = op;
+    }
+#line 3995 "./build/basic.tab.c"
+    break;
+
+  case 59: /* simple_assign_statement: varassignlist '=' exprlist  */
+#line 765 "frontends/basic/basic.y"
+  {
+      yyval = AstAssignList(yyvsp[-2], yyvsp[0], yyvsp[-1]);
+  }
+#line 4003 "./build/basic.tab.c"
+    break;
+
+  case 60: /* simple_assign_statement: register_expr '=' expr  */
+#line 769 "frontends/basic/basic.y"
+    {
+        AST *op = AstAssign(NULL, NULL);
+        op->left = yyvsp[-2];
+        op->right = yyvsp[0];
+        yyval = op;
+    }
+#line 4014 "./build/basic.tab.c"
+    break;
+
+  case 61: /* simple_assign_statement: register_expr '=' "input"  */
+#line 776 "frontends/basic/basic.y"
+    { yyval = AstAssign(yyvsp[-2], AstInteger(0)); }
+#line 4020 "./build/basic.tab.c"
+    break;
+
+  case 62: /* simple_assign_statement: register_expr '=' "output"  */
+#line 778 "frontends/basic/basic.y"
+    { yyval = AstAssign(yyvsp[-2], AstInteger(-1)); }
+#line 4026 "./build/basic.tab.c"
+    break;
+
+  case 63: /* assign_statement: simple_assign_statement  */
+#line 782 "frontends/basic/basic.y"
+    {
+        AST *assign = yyvsp[0];
+        AST *ident;
+        Symbol *sym = GetExplicitDeclares();
+        int explicit_flag = EvalConstExpr((AST *)sym->val);
+        if (0 == (explicit_flag & 0x1) ) {
+            ident = assign->left;
+            MaybeDeclareMemberVar(current, ident, NULL, 0, IMPLICIT_VAR);
+        }
+        yyval = assign;
+    }
+#line 4042 "./build/basic.tab.c"
+    break;
+
+  case 64: /* assign_statement: "let" simple_assign_statement  */
+#line 794 "frontends/basic/basic.y"
+    {
+        AST *assign = yyvsp[0];
+        AST *ident;
+        Symbol *sym = GetExplicitDeclares();
+        int explicit_flag = EvalConstExpr((AST *)sym->val);
+        if (0 == (explicit_flag & 0x2) ) {
+            ident = assign->left;
+            MaybeDeclareMemberVar(current, ident, NULL, 0, IMPLICIT_VAR);
+        }
+        yyval = assign;
+    }
+#line 4058 "./build/basic.tab.c"
+    break;
+
+  case 66: /* branchstmt: "return"  */
+#line 810 "frontends/basic/basic.y"
+    { yyval = AstReturn(NULL, yyvsp[0]); }
+#line 4064 "./build/basic.tab.c"
+    break;
+
+  case 67: /* branchstmt: "return" exprlist  */
+#line 812 "frontends/basic/basic.y"
+    { yyval = AstReturn(yyvsp[0], yyvsp[-1]); }
+#line 4070 "./build/basic.tab.c"
+    break;
+
+  case 68: /* branchstmt: "label:"  */
+#line 814 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_LABEL, yyvsp[0], NULL); }
+#line 4076 "./build/basic.tab.c"
+    break;
+
+  case 69: /* branchstmt: "goto" "identifier"  */
+#line 816 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_GOTO, yyvsp[0], NULL); }
+#line 4082 "./build/basic.tab.c"
+    break;
+
+  case 70: /* branchstmt: "goto" "integer number"  */
+#line 818 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_GOTO, IntegerLabel(yyvsp[0]), NULL); }
+#line 4088 "./build/basic.tab.c"
+    break;
+
+  case 71: /* branchstmt: "gosub" "identifier"  */
+#line 820 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_GOSUB, yyvsp[0], NULL); }
+#line 4094 "./build/basic.tab.c"
+    break;
+
+  case 72: /* branchstmt: "gosub" "integer number"  */
+#line 822 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_GOSUB, IntegerLabel(yyvsp[0]), NULL); }
+#line 4100 "./build/basic.tab.c"
+    break;
+
+  case 73: /* branchstmt: "throw" expr  */
+#line 824 "frontends/basic/basic.y"
+    {
+        yyval = NewCommentedAST(AST_THROW, yyvsp[0], NULL, yyvsp[-1]);
+    }
+#line 4108 "./build/basic.tab.c"
+    break;
+
+  case 74: /* branchstmt: "throwifcaught" expr  */
+#line 828 "frontends/basic/basic.y"
+    {
+        AST *top = NewCommentedAST(AST_THROW, yyvsp[0], NULL, yyvsp[-1]);
+        AST *throwit;
+        if (top && top->kind != AST_THROW) {
+            throwit = top->left;
+        } else {
+            throwit = top;
+        }
+        throwit->d.ival = 1;
+        yyval = top;
+    }
+#line 4124 "./build/basic.tab.c"
+    break;
+
+  case 77: /* file_handle: %empty  */
+#line 844 "frontends/basic/basic.y"
+   { yyval = NULL; }
+#line 4130 "./build/basic.tab.c"
+    break;
+
+  case 78: /* file_handle: '#' expr optcomma  */
+#line 846 "frontends/basic/basic.y"
+   { yyval = yyvsp[-1]; }
+#line 4136 "./build/basic.tab.c"
+    break;
+
+  case 79: /* iostmt: "print" file_handle printlist  */
+#line 851 "frontends/basic/basic.y"
+    { yyval = NewCommentedAST(AST_PRINT, yyvsp[0], yyvsp[-1], yyvsp[-2]); }
+#line 4142 "./build/basic.tab.c"
+    break;
+
+  case 80: /* iostmt: "print" file_handle ',' printlist  */
+#line 853 "frontends/basic/basic.y"
+    { yyval = NewCommentedAST(AST_PRINT, yyvsp[0], yyvsp[-2], yyvsp[-3]); }
+#line 4148 "./build/basic.tab.c"
+    break;
+
+  case 81: /* iostmt: "input" file_handle inputlist  */
+#line 855 "frontends/basic/basic.y"
+    { yyval = NewCommentedAST(AST_READ, yyvsp[0], InputHandle(yyvsp[-1]), yyvsp[-2]); }
+#line 4154 "./build/basic.tab.c"
+    break;
+
+  case 82: /* iostmt: "input" file_handle "literal string" ',' inputlist  */
+#line 857 "frontends/basic/basic.y"
+    {
+        AST *inhandle = InputHandle(yyvsp[-3]);
+        AST *outhandle = OutputHandle(yyvsp[-3]);
+        AST *string = NewAST(AST_STRINGPTR,
+                             NewAST(AST_EXPRLIST, yyvsp[-2], NULL), NULL);
+        AST *printlist = NewAST(AST_EXPRLIST, string, NULL);
+        AST *printstmt = NewCommentedAST(AST_PRINT, printlist, outhandle, yyvsp[-4]);
+        AST *inpstmt = NewAST(AST_READ, yyvsp[0], inhandle);
+        AST *stmt;
+        stmt = NewAST(AST_STMTLIST,
+                      printstmt,
+                      NewAST(AST_STMTLIST, inpstmt, NULL));
+        yyval = stmt;
+    }
+#line 4173 "./build/basic.tab.c"
+    break;
+
+  case 83: /* iostmt: "input" file_handle "literal string" ';' inputlist  */
+#line 872 "frontends/basic/basic.y"
+    {
+        AST *inhandle = InputHandle(yyvsp[-3]);
+        AST *outhandle = InputHandle(yyvsp[-3]);
+        AST *question = NewAST(AST_EXPRLIST,
+                               AstInteger(63),
+                               NewAST(AST_EXPRLIST, AstInteger(32), NULL));
+        AST *string = NewAST(AST_STRINGPTR,
+                             NewAST(AST_EXPRLIST, yyvsp[-2], question), NULL);
+        AST *printlist = NewAST(AST_EXPRLIST, string, NULL);
+        AST *printstmt = NewCommentedAST(AST_PRINT, printlist, outhandle, yyvsp[-4]);
+        AST *inpstmt = NewAST(AST_READ, yyvsp[0], inhandle);
+        AST *stmt;
+        stmt = NewAST(AST_STMTLIST,
+                      printstmt,
+                      NewAST(AST_STMTLIST, inpstmt, NULL));
+        yyval = stmt;
+    }
+#line 4195 "./build/basic.tab.c"
+    break;
+
+  case 84: /* iostmt: "read" inputlist  */
+#line 890 "frontends/basic/basic.y"
+    { yyval = NewCommentedAST(AST_READ, yyvsp[0], NULL, yyvsp[-1]); }
+#line 4201 "./build/basic.tab.c"
+    break;
+
+  case 85: /* iostmt: "restore"  */
+#line 892 "frontends/basic/basic.y"
+    {
+      AST *varname = AstIdentifier("__basic_data_ptr");
+      AST *labelref = AstIdentifier("__basic_data");
+      AST *init;
+      init = AstAssign(varname, NewAST(AST_ADDROF, labelref, NULL));
+      yyval = init;
+    }
+#line 4213 "./build/basic.tab.c"
+    break;
+
+  case 86: /* iostmt: "open" expr "as" '#' expr  */
+#line 900 "frontends/basic/basic.y"
+    {
+        yyval = NewCommentedAST(AST_FUNCCALL,
+                AstIdentifier("_basic_open"),
+                NewAST(AST_EXPRLIST, yyvsp[0],
+                       NewAST(AST_EXPRLIST, yyvsp[-3], NULL)), yyvsp[-4]);
+    }
+#line 4224 "./build/basic.tab.c"
+    break;
+
+  case 87: /* iostmt: "open" expr "for" "input" "as" '#' expr  */
+#line 907 "frontends/basic/basic.y"
+    {
+        yyval = NewCommentedAST(AST_FUNCCALL,
+                AstIdentifier("_basic_open_string"),
+                NewAST(AST_EXPRLIST, yyvsp[0],
+                       NewAST(AST_EXPRLIST, yyvsp[-5],
+                              /* mode 0 is O_RDONLY */
+                              NewAST(AST_EXPRLIST, AstInteger(0), NULL))), yyvsp[-6]);
+    }
+#line 4237 "./build/basic.tab.c"
+    break;
+
+  case 88: /* iostmt: "open" expr "for" "output" "as" '#' expr  */
+#line 916 "frontends/basic/basic.y"
+    {
+        yyval = NewCommentedAST(AST_FUNCCALL,
+                AstIdentifier("_basic_open_string"),
+                NewAST(AST_EXPRLIST, yyvsp[0],
+                       NewAST(AST_EXPRLIST, yyvsp[-5],
+                              /* mode is O_WRONLY | O_CREAT | O_TRUNC */
+                              NewAST(AST_EXPRLIST, AstInteger(1 + 4 + 8), NULL))), yyvsp[-6]);
+    }
+#line 4250 "./build/basic.tab.c"
+    break;
+
+  case 89: /* iostmt: "open" expr "for" "append" "as" '#' expr  */
+#line 925 "frontends/basic/basic.y"
+    {
+        yyval = NewCommentedAST(AST_FUNCCALL,
+                AstIdentifier("_basic_open_string"),
+                NewAST(AST_EXPRLIST, yyvsp[0],
+                       NewAST(AST_EXPRLIST, yyvsp[-5],
+                              /* mode is O_WRONLY | O_CREAT | O_APPEND */
+                              NewAST(AST_EXPRLIST, AstInteger(1 + 4 + 32), NULL))), yyvsp[-6]);
+    }
+#line 4263 "./build/basic.tab.c"
+    break;
+
+  case 90: /* iostmt: "close" '#' expr  */
+#line 934 "frontends/basic/basic.y"
+    {
+        yyval = NewCommentedAST(AST_FUNCCALL,
+                    AstIdentifier("_basic_close"),
+                             NewAST(AST_EXPRLIST, yyvsp[0], NULL), yyvsp[-2]);
+    }
+#line 4273 "./build/basic.tab.c"
+    break;
+
+  case 91: /* iostmt: "chain" '#' "integer number"  */
+#line 940 "frontends/basic/basic.y"
+    {
+        AST *twonulls = NewAST(AST_EXPRLIST,
+                              AstInteger(0),
+                              NewAST(AST_EXPRLIST,
+                                     AstInteger(0),
+                                     NULL));
+        AST *handle = yyvsp[0];
+        yyval = NewCommentedAST(AST_FUNCCALL,
+                    AstIdentifier("_fexecve"),
+                             NewAST(AST_EXPRLIST, handle, twonulls), yyvsp[-2]);
+    }
+#line 4289 "./build/basic.tab.c"
+    break;
+
+  case 92: /* iostmt: "chain" "literal string"  */
+#line 952 "frontends/basic/basic.y"
+    {
+        AST *twonulls = NewAST(AST_EXPRLIST,
+                              AstInteger(0),
+                              NewAST(AST_EXPRLIST,
+                                     AstInteger(0),
+                                     NULL));
+        AST *name = NewAST(AST_STRINGPTR, NewAST(AST_EXPRLIST, yyvsp[0], NULL), NULL);
+        yyval = NewCommentedAST(AST_FUNCCALL,
+                    AstIdentifier("_execve"),
+                             NewAST(AST_EXPRLIST, name, twonulls), yyvsp[-1]);
+    }
+#line 4305 "./build/basic.tab.c"
+    break;
+
+  case 93: /* iostmt: "get" '#' putgetargs  */
+#line 964 "frontends/basic/basic.y"
+    {
+        AST *params = yyvsp[0];
+        AST *thefunc = AstIdentifier("_basic_get");
+        AST *result = NULL;
+        AST *call;
+        AST *comment = yyvsp[-2];
+        if (params && params->kind == AST_ASSIGN) {
+            result = params->left;
+            params = params->right;
+        }
+        call = NewAST(AST_FUNCCALL, thefunc, params);
+        if (result) {
+            call = AstAssign(result, call);
+        }
+        if (comment) {
+            call = NewAST(AST_COMMENTEDNODE, call, comment);
+        }
+        yyval = call;
+    }
+#line 4329 "./build/basic.tab.c"
+    break;
+
+  case 94: /* iostmt: "put" '#' putgetargs  */
+#line 984 "frontends/basic/basic.y"
+    {
+        AST *params = yyvsp[0];
+        AST *thefunc = AstIdentifier("_basic_put");
+        AST *result = NULL;
+        AST *call;
+        AST *comment = yyvsp[-2];
+        if (params && params->kind == AST_ASSIGN) {
+            result = params->left;
+            params = params->right;
+        }
+        call = NewAST(AST_FUNCCALL, thefunc, params);
+        if (result) {
+            call = AstAssign(result, call);
+        }
+        if (comment) {
+            call = NewAST(AST_COMMENTEDNODE, call, comment);
+        }
+        yyval = call;
+    }
+#line 4353 "./build/basic.tab.c"
+    break;
+
+  case 95: /* inputitem: varexpr  */
+#line 1007 "frontends/basic/basic.y"
+    {
+        Symbol *sym = GetExplicitDeclares();
+        int explicit_flag = EvalConstExpr((AST *)sym->val);
+        if (0 == (explicit_flag & 0x4)) {
+            MaybeDeclareMemberVar(current, yyvsp[0], NULL, 0, IMPLICIT_VAR);
+        }
+        yyval = NewAST(AST_EXPRLIST, yyvsp[0], NULL);
+    }
+#line 4366 "./build/basic.tab.c"
+    break;
+
+  case 96: /* inputlist: inputitem  */
+#line 1019 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 4372 "./build/basic.tab.c"
+    break;
+
+  case 97: /* inputlist: inputlist ',' inputitem  */
+#line 1021 "frontends/basic/basic.y"
+    {
+        yyval = AddToList(yyvsp[-2], yyvsp[0]);
+    }
+#line 4380 "./build/basic.tab.c"
+    break;
+
+  case 98: /* printitem: expr  */
+#line 1028 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_EXPRLIST, yyvsp[0], NULL); }
+#line 4386 "./build/basic.tab.c"
+    break;
+
+  case 99: /* printitem: '\\' expr  */
+#line 1030 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_EXPRLIST, NewAST(AST_CHAR, yyvsp[0], NULL), NULL); }
+#line 4392 "./build/basic.tab.c"
+    break;
+
+  case 100: /* rawprintlist: printitem  */
+#line 1035 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 4398 "./build/basic.tab.c"
+    break;
+
+  case 101: /* rawprintlist: rawprintlist ';' printitem  */
+#line 1037 "frontends/basic/basic.y"
+    { yyval = AddToList(yyvsp[-2], yyvsp[0]); }
+#line 4404 "./build/basic.tab.c"
+    break;
+
+  case 102: /* rawprintlist: rawprintlist ',' printitem  */
+#line 1039 "frontends/basic/basic.y"
+    { yyval = AddToList(AddToList(yyvsp[-2], AstCharItem('\t')), yyvsp[0]); }
+#line 4410 "./build/basic.tab.c"
+    break;
+
+  case 103: /* usingprintlist: printitem  */
+#line 1044 "frontends/basic/basic.y"
+  { yyval = yyvsp[0]; }
+#line 4416 "./build/basic.tab.c"
+    break;
+
+  case 104: /* usingprintlist: usingprintlist ';' printitem  */
+#line 1046 "frontends/basic/basic.y"
+  { yyval = AddToList(yyvsp[-2], yyvsp[0]); }
+#line 4422 "./build/basic.tab.c"
+    break;
+
+  case 105: /* usingprintlist: usingprintlist ',' printitem  */
+#line 1048 "frontends/basic/basic.y"
+  { yyval = AddToList(yyvsp[-2], yyvsp[0]); }
+#line 4428 "./build/basic.tab.c"
+    break;
+
+  case 106: /* printlist: %empty  */
+#line 1053 "frontends/basic/basic.y"
+    { yyval = AstCharItem('\n'); }
+#line 4434 "./build/basic.tab.c"
+    break;
+
+  case 107: /* printlist: rawprintlist  */
+#line 1055 "frontends/basic/basic.y"
+    { yyval = AddToList(yyvsp[0], AstCharItem('\n')); }
+#line 4440 "./build/basic.tab.c"
+    break;
+
+  case 108: /* printlist: rawprintlist ','  */
+#line 1057 "frontends/basic/basic.y"
+    { yyval = AddToList(yyvsp[-1], AstCharItem('\t')); }
+#line 4446 "./build/basic.tab.c"
+    break;
+
+  case 109: /* printlist: rawprintlist ';'  */
+#line 1059 "frontends/basic/basic.y"
+    { yyval = yyvsp[-1]; }
+#line 4452 "./build/basic.tab.c"
+    break;
+
+  case 110: /* printlist: "using" "literal string" ';' usingprintlist  */
+#line 1061 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_USING, yyvsp[-2], AddToList(yyvsp[0], AstCharItem('\n'))); }
+#line 4458 "./build/basic.tab.c"
+    break;
+
+  case 111: /* printlist: "using" "literal string" ';' usingprintlist ';'  */
+#line 1063 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_USING, yyvsp[-3], yyvsp[-1]); }
+#line 4464 "./build/basic.tab.c"
+    break;
+
+  case 112: /* putgetargs: expritem ',' optzeroexpritem ',' expr  */
+#line 1072 "frontends/basic/basic.y"
+  {
+      AST *filenum = yyvsp[-4];
+      AST *position = yyvsp[-2];
+      AST *data = yyvsp[0];
+      AST *amount = AstInteger(1);
+      AST *size = NewAST(AST_SIZEOF, data, NULL);
+
+      amount = NewAST(AST_EXPRLIST, amount, NULL);
+      size = NewAST(AST_EXPRLIST, size, NULL);
+      data = NewAST(AST_ADDROF, data, NULL);
+      data = NewAST(AST_EXPRLIST, data, NULL);
+      amount->right = size;
+      data->right = amount;
+      position->right = data;
+      filenum->right = position;
+      yyval = filenum;
+  }
+#line 4486 "./build/basic.tab.c"
+    break;
+
+  case 113: /* putgetargs: expritem ',' optzeroexpritem ',' expr ',' expritem optvar  */
+#line 1090 "frontends/basic/basic.y"
+  {
+      AST *filenum = yyvsp[-7];
+      AST *position = yyvsp[-5];
+      AST *data = yyvsp[-3];
+      AST *amount = yyvsp[-1];
+      AST *var = yyvsp[0];
+      AST *size = NewAST(AST_SIZEOF, data, NULL);
+      size = NewAST(AST_EXPRLIST, size, NULL);
+      
+      data = NewAST(AST_ADDROF, data, NULL);
+      data = NewAST(AST_EXPRLIST, data, NULL);
+      amount->right = size;
+      data->right = amount;
+      position->right = data;
+      filenum->right = position;
+
+      if (var) {
+          filenum = AstAssign(var, filenum);
+      }
+      yyval = filenum;
+  }
+#line 4512 "./build/basic.tab.c"
+    break;
+
+  case 114: /* optzeroexpritem: %empty  */
+#line 1115 "frontends/basic/basic.y"
+    {
+        AST *zero = AstInteger(0);
+        yyval = NewAST(AST_EXPRLIST, zero, NULL);
+    }
+#line 4521 "./build/basic.tab.c"
+    break;
+
+  case 115: /* optzeroexpritem: expritem  */
+#line 1120 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 4527 "./build/basic.tab.c"
+    break;
+
+  case 116: /* optvar: %empty  */
+#line 1125 "frontends/basic/basic.y"
+    {
+        yyval = NULL;
+    }
+#line 4535 "./build/basic.tab.c"
+    break;
+
+  case 117: /* optvar: ',' expr  */
+#line 1129 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 4541 "./build/basic.tab.c"
+    break;
+
+  case 118: /* ifstmt: "if" expr "then" eoln thenelseblock  */
+#line 1135 "frontends/basic/basic.y"
+    {
+        yyval = NewCommentedAST(AST_IF, yyvsp[-3], yyvsp[0], yyvsp[-4]);
+    }
+#line 4549 "./build/basic.tab.c"
+    break;
+
+  case 119: /* ifstmt: "if" expr "then" "integer number"  */
+#line 1139 "frontends/basic/basic.y"
+    {
+        AST *stmtlist = NewCommentedStatement(
+            NewAST(AST_GOTO, IntegerLabel(yyvsp[0]), NULL));
+        AST *elseblock = NewAST(AST_THENELSE, stmtlist, NULL);
+        yyval = NewCommentedAST(AST_IF, yyvsp[-2], elseblock, yyvsp[-3]);
+    }
+#line 4560 "./build/basic.tab.c"
+    break;
+
+  case 120: /* ifstmt: "if" expr statement  */
+#line 1146 "frontends/basic/basic.y"
+    {
+        AST *condition = yyvsp[-1];
+        AST *stmtlist = NewCommentedStatement(yyvsp[0]);
+        AST *elseblock = NewAST(AST_THENELSE, stmtlist, NULL);
+        yyval = NewCommentedAST(AST_IF, condition, elseblock, yyvsp[-2]);
+    }
+#line 4571 "./build/basic.tab.c"
+    break;
+
+  case 121: /* ifstmt: "if" expr "then" ifline  */
+#line 1153 "frontends/basic/basic.y"
+    {
+        AST *elseblock = NewAST(AST_THENELSE, yyvsp[0], NULL);
+        yyval = NewCommentedAST(AST_IF, yyvsp[-2], elseblock, yyvsp[-3]);
+    }
+#line 4580 "./build/basic.tab.c"
+    break;
+
+  case 122: /* thenelseblock: optstatementlist endif  */
+#line 1161 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_THENELSE, yyvsp[-1], NULL); }
+#line 4586 "./build/basic.tab.c"
+    break;
+
+  case 123: /* thenelseblock: optstatementlist "else" eoln optstatementlist endif  */
+#line 1163 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_THENELSE, yyvsp[-4], yyvsp[-1]); }
+#line 4592 "./build/basic.tab.c"
+    break;
+
+  case 124: /* thenelseblock: optstatementlist "else" statement  */
+#line 1165 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_THENELSE, yyvsp[-2], NewCommentedStatement(yyvsp[0])); }
+#line 4598 "./build/basic.tab.c"
+    break;
+
+  case 128: /* $@1: %empty  */
+#line 1175 "frontends/basic/basic.y"
+                        { PushLoop(BAS_WHILE); }
+#line 4604 "./build/basic.tab.c"
+    break;
+
+  case 129: /* whilestmt: "while" expr eoln $@1 optstatementlist endwhile  */
+#line 1176 "frontends/basic/basic.y"
+    { AST *body = CheckYield(yyvsp[-1]);
+      yyval = NewCommentedAST(AST_WHILE, yyvsp[-4], body, yyvsp[-5]);
+      PopLoop();
+    }
+#line 4613 "./build/basic.tab.c"
+    break;
+
+  case 133: /* $@2: %empty  */
+#line 1189 "frontends/basic/basic.y"
+                             { PushLoop(BAS_DO); }
+#line 4619 "./build/basic.tab.c"
+    break;
+
+  case 134: /* doloopstmt: "do" "while" expr eoln $@2 optstatementlist "loop"  */
+#line 1190 "frontends/basic/basic.y"
+    { AST *body = CheckYield(yyvsp[-1]);
+      AST *cond = yyvsp[-4];
+      yyval = NewCommentedAST(AST_WHILE, cond, body, yyvsp[-6]);
+      PopLoop();
+    }
+#line 4629 "./build/basic.tab.c"
+    break;
+
+  case 135: /* $@3: %empty  */
+#line 1195 "frontends/basic/basic.y"
+                               {PushLoop(BAS_DO); }
+#line 4635 "./build/basic.tab.c"
+    break;
+
+  case 136: /* doloopstmt: "do" "until" expr eoln $@3 optstatementlist "loop"  */
+#line 1196 "frontends/basic/basic.y"
+    { AST *body = CheckYield(yyvsp[-1]);
+      AST *cond = AstOperator(K_BOOL_NOT, NULL, yyvsp[-4]);
+      yyval = NewCommentedAST(AST_WHILE, cond, body, yyvsp[-6]);
+      PopLoop();
+    }
+#line 4645 "./build/basic.tab.c"
+    break;
+
+  case 137: /* $@4: %empty  */
+#line 1201 "frontends/basic/basic.y"
+                {PushLoop(BAS_DO); }
+#line 4651 "./build/basic.tab.c"
+    break;
+
+  case 138: /* doloopstmt: "do" eoln $@4 optstatementlist doloopend  */
+#line 1202 "frontends/basic/basic.y"
+    {
+        yyval = NewCommentedAST(AST_DOWHILE, yyvsp[0], CheckYield(yyvsp[-1]), yyvsp[-4]);
+        PopLoop();
+    }
+#line 4660 "./build/basic.tab.c"
+    break;
+
+  case 139: /* doloopend: "loop" "while" expr  */
+#line 1210 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 4666 "./build/basic.tab.c"
+    break;
+
+  case 140: /* doloopend: "loop" "until" expr  */
+#line 1212 "frontends/basic/basic.y"
+    { yyval = AstOperator(K_BOOL_NOT, NULL, yyvsp[0]); }
+#line 4672 "./build/basic.tab.c"
+    break;
+
+  case 141: /* doloopend: "loop"  */
+#line 1214 "frontends/basic/basic.y"
+    { yyval = AstInteger(1); }
+#line 4678 "./build/basic.tab.c"
+    break;
+
+  case 142: /* selectstmt: "select" "case" expr eoln casematchlist "end" "select"  */
+#line 1219 "frontends/basic/basic.y"
+    { yyval = NewCommentedAST(AST_CASE, yyvsp[-4], yyvsp[-2], yyvsp[-6]); }
+#line 4684 "./build/basic.tab.c"
+    break;
+
+  case 143: /* selectstmt: "on" expr "goto" exprlist  */
+#line 1221 "frontends/basic/basic.y"
+    { yyval = NewCommentedAST(AST_CASETABLE, yyvsp[-2], BuildOnGotoCases(yyvsp[0]), yyvsp[-3]); }
+#line 4690 "./build/basic.tab.c"
+    break;
+
+  case 144: /* casematchlist: casematchitem  */
+#line 1226 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 4696 "./build/basic.tab.c"
+    break;
+
+  case 145: /* casematchlist: casematchlist casematchitem  */
+#line 1228 "frontends/basic/basic.y"
+    { yyval = AddToList(yyvsp[-1], yyvsp[0]); }
+#line 4702 "./build/basic.tab.c"
+    break;
+
+  case 146: /* casematchitem: casematch eoln optstatementlist  */
+#line 1233 "frontends/basic/basic.y"
+    {
+        AST *expr = yyvsp[-2];
+        AST *stmts = yyvsp[0];
+        AST *firststmt;
+        AST *breakstmt = NewAST(AST_ENDCASE, NULL, NULL);
+        stmts = AddToList(stmts, NewAST(AST_STMTLIST, breakstmt, NULL));
+        firststmt = stmts->left;
+        if (expr->kind == AST_OTHER) {
+            stmts->left = NewAST(AST_OTHER, firststmt, NULL);
+        } else {
+            stmts->left = NewAST(AST_CASEITEM, expr, firststmt);
+        }
+        yyval = stmts;
+    }
+#line 4721 "./build/basic.tab.c"
+    break;
+
+  case 147: /* casematch: "case" caselist  */
+#line 1251 "frontends/basic/basic.y"
+    {  yyval = yyvsp[0]; }
+#line 4727 "./build/basic.tab.c"
+    break;
+
+  case 148: /* caseitem: expr  */
+#line 1256 "frontends/basic/basic.y"
+    {  yyval = NewAST(AST_EXPRLIST, yyvsp[0], NULL); }
+#line 4733 "./build/basic.tab.c"
+    break;
+
+  case 149: /* caseitem: expr "to" expr  */
+#line 1258 "frontends/basic/basic.y"
+    {  yyval = NewAST(AST_EXPRLIST, NewAST(AST_RANGE, yyvsp[-2], yyvsp[0]), NULL); }
+#line 4739 "./build/basic.tab.c"
+    break;
+
+  case 150: /* caseitem: "else"  */
+#line 1260 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_OTHER, NULL, NULL); }
+#line 4745 "./build/basic.tab.c"
+    break;
+
+  case 151: /* caselist: caseitem  */
+#line 1265 "frontends/basic/basic.y"
+    {  yyval = yyvsp[0]; }
+#line 4751 "./build/basic.tab.c"
+    break;
+
+  case 152: /* caselist: caselist ',' caseitem  */
+#line 1267 "frontends/basic/basic.y"
+    {  yyval = AddToList(yyvsp[-2], yyvsp[0]); }
+#line 4757 "./build/basic.tab.c"
+    break;
+
+  case 153: /* $@5: %empty  */
+#line 1275 "frontends/basic/basic.y"
+            { PushLoop(BAS_FOR); }
+#line 4763 "./build/basic.tab.c"
+    break;
+
+  case 154: /* forstmt: "for" $@5 "identifier" '=' expr "to" expr optstep eoln optstatementlist endfor  */
+#line 1276 "frontends/basic/basic.y"
+    {
+      AST *from, *to, *step;
+      AST *ident = yyvsp[-8];
+      AST *closeident = yyvsp[0];
+      AST *declare;
+      AST *loop;
+      Symbol *sym = GetExplicitDeclares();
+      int explicit_flag = EvalConstExpr((AST *)sym->val);
+
+      if (0 == (explicit_flag & 0x8)) {
+          /* create a WEAK definition for ident (it will not override any existing definition) */
+          declare = NewAST(AST_DECLARE_VAR_WEAK, InferTypeFromName(ident), ident);
+      } else {
+          declare = 0;
+      }
+      step = NewAST(AST_STEP, yyvsp[-3], yyvsp[-1]);
+      to = NewAST(AST_TO, yyvsp[-4], step);
+      from = NewAST(AST_FROM, yyvsp[-6], to);
+      loop = NewCommentedAST(AST_COUNTREPEAT, yyvsp[-8], from, yyvsp[-10]);
+      // validate the "next i"
+      if (closeident && !AstMatch(ident, closeident)) {
+          SETCOLOR(PRINT_ERROR);
+          ERRORHEADER(current->Lptr->fileName, current->Lptr->lineCounter, "error");
+          fprintf(stderr, "Wrong variable in next: expected %s, saw %s\n", ident->d.string, closeident->d.string);
+          gl_errors++;
+          RESETCOLOR();
+      }
+      loop = NewAST(AST_STMTLIST, loop, NULL);
+      if (declare) {
+          loop = NewAST(AST_STMTLIST, declare,
+                        NewAST(AST_STMTLIST, loop, NULL));
+      }
+      yyval = loop;
+      PopLoop();
+    }
+#line 4803 "./build/basic.tab.c"
+    break;
+
+  case 155: /* endfor: "next"  */
+#line 1315 "frontends/basic/basic.y"
+    { yyval = NULL; }
+#line 4809 "./build/basic.tab.c"
+    break;
+
+  case 156: /* endfor: "next" "identifier"  */
+#line 1317 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 4815 "./build/basic.tab.c"
+    break;
+
+  case 157: /* optstep: %empty  */
+#line 1322 "frontends/basic/basic.y"
+    { yyval = AstInteger(1); }
+#line 4821 "./build/basic.tab.c"
+    break;
+
+  case 158: /* optstep: "step" expr  */
+#line 1324 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 4827 "./build/basic.tab.c"
+    break;
+
+  case 159: /* trycatchstmt: "try" eoln statementlist "catch" "identifier" eoln statementlist endtry  */
+#line 1329 "frontends/basic/basic.y"
+  {
+      AST *tryblock = yyvsp[-5];
+      AST *catchvar = yyvsp[-3];
+      AST *catchblock = yyvsp[-1];
+      AST *try_if;
+      AST *trytest;
+
+      catchblock = NewAST(AST_STMTLIST,
+                          AstAssign(catchvar, NewAST(AST_CATCHRESULT, NULL, NULL)),
+                          catchblock);
+      trytest = NewAST(AST_SETJMP, NULL, NULL);
+      try_if = NewAST(AST_IF,
+                      AstOperator(K_EQ, trytest, AstInteger(0)),
+                      NewAST(AST_THENELSE, tryblock, catchblock));
+      try_if = NewCommentedStatement(try_if);
+      
+      yyval = NewAST(AST_TRYENV, try_if, NULL);
+  }
+#line 4850 "./build/basic.tab.c"
+    break;
+
+  case 161: /* exitstmt: "exit" "function"  */
+#line 1355 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_RETURN, NULL, NULL); }
+#line 4856 "./build/basic.tab.c"
+    break;
+
+  case 162: /* exitstmt: "exit" "sub"  */
+#line 1357 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_RETURN, NULL, NULL); }
+#line 4862 "./build/basic.tab.c"
+    break;
+
+  case 163: /* exitstmt: "exit" "for"  */
+#line 1359 "frontends/basic/basic.y"
+    {
+        int curLoop = GetCurrentLoop(BAS_FOR);
+        AST *modifier = NULL;
+        if (!curLoop) {
+            SYNTAX_ERROR("'exit for' is not inside a for loop");
+        } else {
+            modifier = AstInteger(curLoop);
+        }
+        yyval = NewAST(AST_QUITLOOP, modifier, NULL);
+    }
+#line 4877 "./build/basic.tab.c"
+    break;
+
+  case 164: /* exitstmt: "exit" "while"  */
+#line 1370 "frontends/basic/basic.y"
+    {
+        int curLoop = GetCurrentLoop(BAS_WHILE);
+        AST *modifier = NULL;
+        if (!curLoop) {
+            SYNTAX_ERROR("'exit while' is not inside a while loop");
+        } else {
+            modifier = AstInteger(curLoop);
+        }
+        yyval = NewAST(AST_QUITLOOP, modifier, NULL);
+    }
+#line 4892 "./build/basic.tab.c"
+    break;
+
+  case 165: /* exitstmt: "exit" "do"  */
+#line 1381 "frontends/basic/basic.y"
+    {
+        int curLoop = GetCurrentLoop(BAS_DO);
+        AST *modifier = NULL;
+        if (!curLoop) {
+            SYNTAX_ERROR("'exit do' is not inside a do loop");
+        } else {
+            modifier = AstInteger(curLoop);
+        }
+        yyval = NewAST(AST_QUITLOOP, modifier, NULL);
+    }
+#line 4907 "./build/basic.tab.c"
+    break;
+
+  case 166: /* exitstmt: "exit" "loop"  */
+#line 1392 "frontends/basic/basic.y"
+    {
+        int curLoop = GetCurrentLoop(BAS_DO);
+        AST *modifier = NULL;
+        if (!curLoop) {
+            SYNTAX_ERROR("'exit loop' is not inside a do loop");
+        } else {
+            modifier = AstInteger(curLoop);
+        }
+        yyval = NewAST(AST_QUITLOOP, modifier, NULL);
+    }
+#line 4922 "./build/basic.tab.c"
+    break;
+
+  case 167: /* exitstmt: "exit"  */
+#line 1403 "frontends/basic/basic.y"
+    {
+        int curLoop = GetCurrentLoop(0);
+        AST *modifier = NULL;
+        if (!curLoop) {
+            SYNTAX_ERROR("'exit' is not inside a loop");
+        } else {
+            modifier = AstInteger(curLoop);
+        }
+        yyval = NewAST(AST_QUITLOOP, modifier, NULL);
+    }
+#line 4937 "./build/basic.tab.c"
+    break;
+
+  case 168: /* exitstmt: "continue" "for"  */
+#line 1414 "frontends/basic/basic.y"
+    {
+        int curLoop = GetCurrentLoop(BAS_FOR);
+        AST *modifier = NULL;
+        if (!curLoop) {
+            SYNTAX_ERROR("'continue for' is not inside a for loop");
+        } else {
+            modifier = AstInteger(curLoop);
+        }
+        yyval = NewAST(AST_CONTINUE, modifier, NULL);
+    }
+#line 4952 "./build/basic.tab.c"
+    break;
+
+  case 169: /* exitstmt: "continue" "while"  */
+#line 1425 "frontends/basic/basic.y"
+    {
+        int curLoop = GetCurrentLoop(BAS_WHILE);
+        AST *modifier = NULL;
+        if (!curLoop) {
+            SYNTAX_ERROR("'continue while' is not inside a while loop");
+        } else {
+            modifier = AstInteger(curLoop);
+        }
+        yyval = NewAST(AST_CONTINUE, modifier, NULL);
+    }
+#line 4967 "./build/basic.tab.c"
+    break;
+
+  case 170: /* exitstmt: "continue" "do"  */
+#line 1436 "frontends/basic/basic.y"
+    {
+        int curLoop = GetCurrentLoop(BAS_DO);
+        AST *modifier = NULL;
+        if (!curLoop) {
+            SYNTAX_ERROR("'continue do' is not inside a do loop");
+        } else {
+            modifier = AstInteger(curLoop);
+        }
+        yyval = NewAST(AST_CONTINUE, modifier, NULL);
+    }
+#line 4982 "./build/basic.tab.c"
+    break;
+
+  case 171: /* exitstmt: "continue"  */
+#line 1447 "frontends/basic/basic.y"
+    {
+        int curLoop = GetCurrentLoop(0);
+        AST *modifier = NULL;
+        if (!curLoop) {
+            SYNTAX_ERROR("'continue' is not inside a loop");
+        } else {
+            modifier = AstInteger(curLoop);
+        }
+        yyval = NewAST(AST_CONTINUE, modifier, NULL);
+    }
+#line 4997 "./build/basic.tab.c"
+    break;
+
+  case 172: /* topdecl: "defsng" deflist  */
+#line 1461 "frontends/basic/basic.y"
+    {
+      yyval = DefineDefaultVarTypes(yyvsp[0], ast_type_float);
+    }
+#line 5005 "./build/basic.tab.c"
+    break;
+
+  case 173: /* topdecl: "defint" deflist  */
+#line 1465 "frontends/basic/basic.y"
+    {
+      yyval = DefineDefaultVarTypes(yyvsp[0], ast_type_long);
+    }
+#line 5013 "./build/basic.tab.c"
+    break;
+
+  case 174: /* topdecl: dimension  */
+#line 1469 "frontends/basic/basic.y"
+    {
+        AST *ast = yyvsp[0];
+        if (ast->kind == AST_GLOBALVARS) {
+            DeclareBASICSharedVariables(ast->left);
+        } else {
+            DeclareBASICMemberVariables(ast);
+        }
+    }
+#line 5026 "./build/basic.tab.c"
+    break;
+
+  case 175: /* topdecl: "option" "identifier" optexprlist  */
+#line 1478 "frontends/basic/basic.y"
+    {
+      yyval = HandleBASICOption(yyvsp[-1], yyvsp[0]);
+    }
+#line 5034 "./build/basic.tab.c"
+    break;
+
+  case 182: /* defitem: "identifier" '-' "identifier"  */
+#line 1491 "frontends/basic/basic.y"
+     { yyval = NewAST(AST_SEQUENCE, yyvsp[-2], yyvsp[0]); }
+#line 5040 "./build/basic.tab.c"
+    break;
+
+  case 183: /* deflist: defitem  */
+#line 1496 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_EXPRLIST, yyvsp[0], NULL); }
+#line 5046 "./build/basic.tab.c"
+    break;
+
+  case 184: /* deflist: deflist ',' defitem  */
+#line 1498 "frontends/basic/basic.y"
+    {
+        AST *list = yyvsp[-2];
+        AST *item = NewAST(AST_EXPRLIST, yyvsp[0], NULL);
+        yyval = AddToListEx(list, item, (AST **)&list->d.ptr);
+    }
+#line 5056 "./build/basic.tab.c"
+    break;
+
+  case 185: /* varexpr: "identifier"  */
+#line 1507 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 5062 "./build/basic.tab.c"
+    break;
+
+  case 186: /* varexpr: "identifier" '[' expr ']'  */
+#line 1509 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_ARRAYREF, yyvsp[-3], yyvsp[-1]); }
+#line 5068 "./build/basic.tab.c"
+    break;
+
+  case 187: /* varexpr: varexpr '(' ')'  */
+#line 1511 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_FUNCCALL, yyvsp[-2], NULL); }
+#line 5074 "./build/basic.tab.c"
+    break;
+
+  case 188: /* varexpr: varexpr '(' exprlist ')'  */
+#line 1513 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_FUNCCALL, yyvsp[-3], yyvsp[-1]); }
+#line 5080 "./build/basic.tab.c"
+    break;
+
+  case 189: /* varexpr: varexpr '.' "identifier"  */
+#line 1515 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_METHODREF, yyvsp[-2], yyvsp[0]); }
+#line 5086 "./build/basic.tab.c"
+    break;
+
+  case 190: /* varexpr: varexpr '.' "program"  */
+#line 1517 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_METHODREF, yyvsp[-2], AstIdentifier("program")); }
+#line 5092 "./build/basic.tab.c"
+    break;
+
+  case 191: /* varexpr: basetypename '.' "identifier"  */
+#line 1519 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_METHODREF, yyvsp[-2], yyvsp[0]); }
+#line 5098 "./build/basic.tab.c"
+    break;
+
+  case 192: /* varexpr: basetypename '.' "program"  */
+#line 1521 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_METHODREF, yyvsp[-2], AstIdentifier("program")); }
+#line 5104 "./build/basic.tab.c"
+    break;
+
+  case 193: /* varassigntarget: varexpr  */
+#line 1526 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 5110 "./build/basic.tab.c"
+    break;
+
+  case 194: /* varassigntarget: "_"  */
+#line 1528 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_EMPTY, NULL, NULL); }
+#line 5116 "./build/basic.tab.c"
+    break;
+
+  case 195: /* pinrange: expr  */
+#line 1533 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_RANGE, yyvsp[0], NULL); }
+#line 5122 "./build/basic.tab.c"
+    break;
+
+  case 196: /* pinrange: expr ',' expr  */
+#line 1535 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_RANGE, yyvsp[-2], yyvsp[0]); }
+#line 5128 "./build/basic.tab.c"
+    break;
+
+  case 197: /* register_expr: "input" '(' pinrange ')'  */
+#line 1540 "frontends/basic/basic.y"
+    { yyval = GetPinRange("ina", "inb", yyvsp[-1]); }
+#line 5134 "./build/basic.tab.c"
+    break;
+
+  case 198: /* register_expr: "output" '(' pinrange ')'  */
+#line 1542 "frontends/basic/basic.y"
+    { yyval = GetPinRange("outa", "outb", yyvsp[-1]); }
+#line 5140 "./build/basic.tab.c"
+    break;
+
+  case 199: /* register_expr: "direction" '(' pinrange ')'  */
+#line 1544 "frontends/basic/basic.y"
+    { yyval = GetPinRange("dira", "dirb", yyvsp[-1]); }
+#line 5146 "./build/basic.tab.c"
+    break;
+
+  case 200: /* np_primary_expr: varexpr  */
+#line 1550 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 5152 "./build/basic.tab.c"
+    break;
+
+  case 201: /* np_primary_expr: register_expr  */
+#line 1552 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 5158 "./build/basic.tab.c"
+    break;
+
+  case 202: /* np_primary_expr: "integer number"  */
+#line 1554 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 5164 "./build/basic.tab.c"
+    break;
+
+  case 203: /* np_primary_expr: "number"  */
+#line 1556 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 5170 "./build/basic.tab.c"
+    break;
+
+  case 204: /* np_primary_expr: "nil"  */
+#line 1558 "frontends/basic/basic.y"
+    { yyval = AstBitValue(0); }
+#line 5176 "./build/basic.tab.c"
+    break;
+
+  case 205: /* np_primary_expr: "self"  */
+#line 1560 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_SELF, NULL, NULL); }
+#line 5182 "./build/basic.tab.c"
+    break;
+
+  case 206: /* np_primary_expr: "__FUNCTION__"  */
+#line 1562 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_FUNC_NAME, NULL, NULL); }
+#line 5188 "./build/basic.tab.c"
+    break;
+
+  case 207: /* np_primary_expr: "literal string"  */
+#line 1564 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_STRINGPTR,
+                  NewAST(AST_EXPRLIST, yyvsp[0], NULL), NULL); }
+#line 5195 "./build/basic.tab.c"
+    break;
+
+  case 208: /* np_primary_expr: "new" typename  */
+#line 1567 "frontends/basic/basic.y"
+    {
+        AST *numElements;
+        AST *baseType;
+        baseType = yyvsp[0];
+        if (baseType->kind == AST_ARRAYTYPE) {
+            int size = TypeSize(baseType->left);
+            (void)size;
+            numElements = baseType->right;
+            baseType = baseType->left;
+        } else {
+            numElements = AstInteger(1);
+        }
+        baseType = NewAST(AST_PTRTYPE, baseType, NULL);
+        yyval = NewAST(AST_NEW, baseType, numElements);
+    }
+#line 5215 "./build/basic.tab.c"
+    break;
+
+  case 209: /* np_primary_expr: "__builtin_alloca" '(' expr ')'  */
+#line 1583 "frontends/basic/basic.y"
+    {
+        yyval = NewAST(AST_ALLOCA, ast_type_ptr_void, yyvsp[-1]);
+    }
+#line 5223 "./build/basic.tab.c"
+    break;
+
+  case 210: /* np_primary_expr: "sizeof" expr  */
+#line 1587 "frontends/basic/basic.y"
+    {
+        yyval = NewAST(AST_SIZEOF, yyvsp[0], NULL);
+    }
+#line 5231 "./build/basic.tab.c"
+    break;
+
+  case 211: /* primary_expr: np_primary_expr  */
+#line 1594 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 5237 "./build/basic.tab.c"
+    break;
+
+  case 212: /* primary_expr: '(' expr ')'  */
+#line 1596 "frontends/basic/basic.y"
+    { yyval = yyvsp[-1]; }
+#line 5243 "./build/basic.tab.c"
+    break;
+
+  case 213: /* unary_op: '-'  */
+#line 1601 "frontends/basic/basic.y"
+    { yyval = AstOperator(K_NEGATE, NULL, NULL); }
+#line 5249 "./build/basic.tab.c"
+    break;
+
+  case 214: /* unary_op: "not"  */
+#line 1603 "frontends/basic/basic.y"
+    { yyval = AstOperator(K_BIT_NOT, NULL, NULL); }
+#line 5255 "./build/basic.tab.c"
+    break;
+
+  case 215: /* unary_op: "abs"  */
+#line 1605 "frontends/basic/basic.y"
+    { yyval = AstOperator(K_ABS, NULL, NULL); }
+#line 5261 "./build/basic.tab.c"
+    break;
+
+  case 216: /* unary_op: "asc"  */
+#line 1607 "frontends/basic/basic.y"
+    { yyval = AstOperator(K_ASC, NULL, NULL); }
+#line 5267 "./build/basic.tab.c"
+    break;
+
+  case 217: /* unary_op: "sqrt"  */
+#line 1609 "frontends/basic/basic.y"
+    { yyval = AstOperator(K_SQRT, NULL, NULL); }
+#line 5273 "./build/basic.tab.c"
+    break;
+
+  case 218: /* pseudofunc_expr: "int" '(' expr ')'  */
+#line 1614 "frontends/basic/basic.y"
+    {
+        AST *orig = yyvsp[-1];
+        yyval = NewAST(AST_CAST, ast_type_long, orig);
+    }
+#line 5282 "./build/basic.tab.c"
+    break;
+
+  case 219: /* pseudofunc_expr: "cast" '(' typename ',' expr ')'  */
+#line 1619 "frontends/basic/basic.y"
+    {
+        yyval = NewAST(AST_CAST, yyvsp[-3], yyvsp[-1]);
+    }
+#line 5290 "./build/basic.tab.c"
+    break;
+
+  case 220: /* pseudofunc_expr: "cpu" '(' exprlist ')'  */
+#line 1623 "frontends/basic/basic.y"
+    {
+        AST *elist;
+        AST *immval = AstInteger(0x1e); // works to cognew both P1 and P2
+        elist = NewAST(AST_EXPRLIST, immval, NULL);
+        elist = AddToList(elist, yyvsp[-1]);
+        yyval = NewAST(AST_COGINIT, elist, NULL);
+    }
+#line 5302 "./build/basic.tab.c"
+    break;
+
+  case 221: /* pseudofunc_expr: "_hasmethod" '(' typename ',' "identifier" ')'  */
+#line 1631 "frontends/basic/basic.y"
+    {
+        AST *typnam = yyvsp[-3];
+        AST *ident = yyvsp[-1];
+        yyval = NewAST(AST_HASMETHOD, typnam, ident);
+    }
+#line 5312 "./build/basic.tab.c"
+    break;
+
+  case 222: /* pseudofunc_expr: "_sametypes" '(' typename ',' typename ')'  */
+#line 1637 "frontends/basic/basic.y"
+    {
+        AST *expr = yyvsp[-3];
+        AST *typnam = yyvsp[-1];
+        yyval = NewAST(AST_SAMETYPES, expr, typnam);
+    }
+#line 5322 "./build/basic.tab.c"
+    break;
+
+  case 223: /* pseudofunc_expr: "_sametypes" '(' expr ',' typename ')'  */
+#line 1643 "frontends/basic/basic.y"
+    {
+        SYNTAX_ERROR("SameTypes requires two type names");
+        yyval = AstInteger(0);
+    }
+#line 5331 "./build/basic.tab.c"
+    break;
+
+  case 224: /* pseudofunc_expr: '@' unary_expr  */
+#line 1648 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_ADDROF, yyvsp[0], NULL); }
+#line 5337 "./build/basic.tab.c"
+    break;
+
+  case 225: /* unary_expr: primary_expr  */
+#line 1653 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 5343 "./build/basic.tab.c"
+    break;
+
+  case 226: /* unary_expr: pseudofunc_expr  */
+#line 1655 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 5349 "./build/basic.tab.c"
+    break;
+
+  case 227: /* unary_expr: '+' unary_expr  */
+#line 1657 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 5355 "./build/basic.tab.c"
+    break;
+
+  case 228: /* unary_expr: unary_op unary_expr  */
+#line 1659 "frontends/basic/basic.y"
+    { yyval = yyvsp[-1]; yyval->right = yyvsp[0]; }
+#line 5361 "./build/basic.tab.c"
+    break;
+
+  case 229: /* np_unary_expr: np_primary_expr  */
+#line 1664 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 5367 "./build/basic.tab.c"
+    break;
+
+  case 230: /* np_unary_expr: pseudofunc_expr  */
+#line 1666 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 5373 "./build/basic.tab.c"
+    break;
+
+  case 231: /* np_unary_expr: '+' unary_expr  */
+#line 1668 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 5379 "./build/basic.tab.c"
+    break;
+
+  case 232: /* np_unary_expr: unary_op unary_expr  */
+#line 1670 "frontends/basic/basic.y"
+    { yyval = yyvsp[-1]; yyval->right = yyvsp[0]; }
+#line 5385 "./build/basic.tab.c"
+    break;
+
+  case 233: /* lambdaexpr: "function" '(' paramdecl ')' expr  */
+#line 1675 "frontends/basic/basic.y"
+    {
+      AST *params = yyvsp[-2];
+      AST *rettype = NULL;
+      AST *body = yyvsp[0];
+      AST *functype = NewAST(AST_FUNCTYPE, rettype, params);
+
+      body = NewCommentedStatement(AstReturn(body, NULL));
+
+      yyval = NewAST(AST_LAMBDA, functype, body);
+    }
+#line 5400 "./build/basic.tab.c"
+    break;
+
+  case 234: /* lambdaexpr: "function" '(' paramdecl ')' "as" typename eoln funcbody  */
+#line 1686 "frontends/basic/basic.y"
+    {
+      AST *params = yyvsp[-5];
+      AST *rettype = yyvsp[-2];
+      AST *body = yyvsp[0];
+      AST *functype = NewAST(AST_FUNCTYPE, rettype, params);
+      yyval = NewAST(AST_LAMBDA, functype, body);
+    }
+#line 5412 "./build/basic.tab.c"
+    break;
+
+  case 235: /* lambdaexpr: "sub" '(' paramdecl ')' eoln subbody  */
+#line 1694 "frontends/basic/basic.y"
+    {
+      AST *params = yyvsp[-3];
+      AST *rettype = ast_type_void;
+      AST *body = yyvsp[0];
+      AST *functype = NewAST(AST_FUNCTYPE, rettype, params);
+      yyval = NewAST(AST_LAMBDA, functype, body);
+    }
+#line 5424 "./build/basic.tab.c"
+    break;
+
+  case 236: /* lambdaexpr: '[' paramdecl ':' statementlist ']'  */
+#line 1702 "frontends/basic/basic.y"
+    {
+      AST *params = yyvsp[-3];
+      AST *rettype = ast_type_void;
+      AST *body = yyvsp[-1];
+      AST *functype = NewAST(AST_FUNCTYPE, rettype, params);
+      yyval = NewAST(AST_LAMBDA, functype, body);
+    }
+#line 5436 "./build/basic.tab.c"
+    break;
+
+  case 237: /* lambdaexpr: '[' paramdecl ':' optstatementlist ">=" expr opttype ']'  */
+#line 1710 "frontends/basic/basic.y"
+    {
+      AST *params = yyvsp[-6];
+      AST *rettype = yyvsp[-1];
+      AST *body = yyvsp[-4];
+      AST *retstmt = NewCommentedStatement(AstReturn(yyvsp[-2], NULL));
+      AST *functype = NewAST(AST_FUNCTYPE, rettype, params);
+      body = AddToList(body, retstmt);
+      yyval = NewAST(AST_LAMBDA, functype, body);
+    }
+#line 5450 "./build/basic.tab.c"
+    break;
+
+  case 238: /* opttype: %empty  */
+#line 1722 "frontends/basic/basic.y"
+    { yyval = NULL; }
+#line 5456 "./build/basic.tab.c"
+    break;
+
+  case 239: /* opttype: "as" typename  */
+#line 1724 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 5462 "./build/basic.tab.c"
+    break;
+
+  case 240: /* mult_op: '*'  */
+#line 1729 "frontends/basic/basic.y"
+    { yyval = AstOperator('*', NULL, NULL); }
+#line 5468 "./build/basic.tab.c"
+    break;
+
+  case 241: /* mult_op: '/'  */
+#line 1731 "frontends/basic/basic.y"
+    { yyval = AstOperator('/', NULL, NULL); }
+#line 5474 "./build/basic.tab.c"
+    break;
+
+  case 242: /* mult_op: "mod"  */
+#line 1733 "frontends/basic/basic.y"
+    { yyval = AstOperator(K_MODULUS, NULL, NULL); }
+#line 5480 "./build/basic.tab.c"
+    break;
+
+  case 243: /* mult_op: "shl"  */
+#line 1735 "frontends/basic/basic.y"
+    { yyval = AstOperator(K_SHL, NULL, NULL); }
+#line 5486 "./build/basic.tab.c"
+    break;
+
+  case 244: /* mult_op: "shr"  */
+#line 1737 "frontends/basic/basic.y"
+    { yyval = AstOperator(K_SAR, NULL, NULL); }
+#line 5492 "./build/basic.tab.c"
+    break;
+
+  case 245: /* power_expr: unary_expr  */
+#line 1742 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 5498 "./build/basic.tab.c"
+    break;
+
+  case 246: /* power_expr: power_expr '^' unary_expr  */
+#line 1744 "frontends/basic/basic.y"
+    {
+        yyval = AstOperator(K_POWER, yyvsp[-2], yyvsp[0]);
+    }
+#line 5506 "./build/basic.tab.c"
+    break;
+
+  case 247: /* np_power_expr: np_unary_expr  */
+#line 1751 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 5512 "./build/basic.tab.c"
+    break;
+
+  case 248: /* np_power_expr: np_power_expr '^' np_unary_expr  */
+#line 1753 "frontends/basic/basic.y"
+    {
+        yyval = AstOperator(K_POWER, yyvsp[-2], yyvsp[0]);
+    }
+#line 5520 "./build/basic.tab.c"
+    break;
+
+  case 249: /* mult_expr: power_expr  */
+#line 1760 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 5526 "./build/basic.tab.c"
+    break;
+
+  case 250: /* mult_expr: mult_expr mult_op power_expr  */
+#line 1762 "frontends/basic/basic.y"
+    {
+        yyval = yyvsp[-1];
+        yyval->left = yyvsp[-2];
+        yyval->right = yyvsp[0];
+    }
+#line 5536 "./build/basic.tab.c"
+    break;
+
+  case 251: /* np_mult_expr: np_power_expr  */
+#line 1770 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 5542 "./build/basic.tab.c"
+    break;
+
+  case 252: /* np_mult_expr: np_mult_expr mult_op np_power_expr  */
+#line 1772 "frontends/basic/basic.y"
+    {
+        yyval = yyvsp[-1];
+        yyval->left = yyvsp[-2];
+        yyval->right = yyvsp[0];
+    }
+#line 5552 "./build/basic.tab.c"
+    break;
+
+  case 253: /* add_expr: mult_expr  */
+#line 1781 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 5558 "./build/basic.tab.c"
+    break;
+
+  case 254: /* add_expr: add_expr '+' mult_expr  */
+#line 1783 "frontends/basic/basic.y"
+    { yyval = AstOperator('+', yyvsp[-2], yyvsp[0]); }
+#line 5564 "./build/basic.tab.c"
+    break;
+
+  case 255: /* add_expr: add_expr '-' mult_expr  */
+#line 1785 "frontends/basic/basic.y"
+    { yyval = AstOperator('-', yyvsp[-2], yyvsp[0]); }
+#line 5570 "./build/basic.tab.c"
+    break;
+
+  case 256: /* np_add_expr: np_mult_expr  */
+#line 1790 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 5576 "./build/basic.tab.c"
+    break;
+
+  case 257: /* np_add_expr: np_add_expr '+' mult_expr  */
+#line 1792 "frontends/basic/basic.y"
+    { yyval = AstOperator('+', yyvsp[-2], yyvsp[0]); }
+#line 5582 "./build/basic.tab.c"
+    break;
+
+  case 258: /* np_add_expr: np_add_expr '-' mult_expr  */
+#line 1794 "frontends/basic/basic.y"
+    { yyval = AstOperator('-', yyvsp[-2], yyvsp[0]); }
+#line 5588 "./build/basic.tab.c"
+    break;
+
+  case 259: /* compare_expr: add_expr  */
+#line 1799 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 5594 "./build/basic.tab.c"
+    break;
+
+  case 260: /* compare_expr: add_expr '=' add_expr  */
+#line 1801 "frontends/basic/basic.y"
+    { yyval = AstOperator(K_EQ, yyvsp[-2], yyvsp[0]); }
+#line 5600 "./build/basic.tab.c"
+    break;
+
+  case 261: /* compare_expr: add_expr '<' add_expr  */
+#line 1803 "frontends/basic/basic.y"
+    { yyval = AstOperator('<', yyvsp[-2], yyvsp[0]); }
+#line 5606 "./build/basic.tab.c"
+    break;
+
+  case 262: /* compare_expr: add_expr '>' add_expr  */
+#line 1805 "frontends/basic/basic.y"
+    { yyval = AstOperator('>', yyvsp[-2], yyvsp[0]); }
+#line 5612 "./build/basic.tab.c"
+    break;
+
+  case 263: /* compare_expr: add_expr "<>" add_expr  */
+#line 1807 "frontends/basic/basic.y"
+    { yyval = AstOperator(K_NE, yyvsp[-2], yyvsp[0]); }
+#line 5618 "./build/basic.tab.c"
+    break;
+
+  case 264: /* compare_expr: add_expr "<=" add_expr  */
+#line 1809 "frontends/basic/basic.y"
+    { yyval = AstOperator(K_LE, yyvsp[-2], yyvsp[0]); }
+#line 5624 "./build/basic.tab.c"
+    break;
+
+  case 265: /* compare_expr: add_expr ">=" add_expr  */
+#line 1811 "frontends/basic/basic.y"
+    { yyval = AstOperator(K_GE, yyvsp[-2], yyvsp[0]); }
+#line 5630 "./build/basic.tab.c"
+    break;
+
+  case 266: /* bit_expr: compare_expr  */
+#line 1816 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 5636 "./build/basic.tab.c"
+    break;
+
+  case 267: /* bit_expr: bit_expr "and" compare_expr  */
+#line 1818 "frontends/basic/basic.y"
+    { yyval = AstOperator('&', yyvsp[-2], yyvsp[0]); }
+#line 5642 "./build/basic.tab.c"
+    break;
+
+  case 268: /* bit_expr: bit_expr "or" compare_expr  */
+#line 1820 "frontends/basic/basic.y"
+    { yyval = AstOperator('|', yyvsp[-2], yyvsp[0]); }
+#line 5648 "./build/basic.tab.c"
+    break;
+
+  case 269: /* bit_expr: bit_expr "xor" compare_expr  */
+#line 1822 "frontends/basic/basic.y"
+    { yyval = AstOperator('^', yyvsp[-2], yyvsp[0]); }
+#line 5654 "./build/basic.tab.c"
+    break;
+
+  case 270: /* bool_expr: bit_expr  */
+#line 1827 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 5660 "./build/basic.tab.c"
+    break;
+
+  case 271: /* bool_expr: bool_expr "andalso" bit_expr  */
+#line 1829 "frontends/basic/basic.y"
+    { yyval = AstOperator(K_BOOL_AND, yyvsp[-2], yyvsp[0]); }
+#line 5666 "./build/basic.tab.c"
+    break;
+
+  case 272: /* bool_expr: bool_expr "orelse" bit_expr  */
+#line 1831 "frontends/basic/basic.y"
+    { yyval = AstOperator(K_BOOL_OR, yyvsp[-2], yyvsp[0]); }
+#line 5672 "./build/basic.tab.c"
+    break;
+
+  case 273: /* expr: bool_expr  */
+#line 1836 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 5678 "./build/basic.tab.c"
+    break;
+
+  case 274: /* expr: lambdaexpr  */
+#line 1838 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 5684 "./build/basic.tab.c"
+    break;
+
+  case 277: /* optexprlist: %empty  */
+#line 1848 "frontends/basic/basic.y"
+    { yyval = NULL; }
+#line 5690 "./build/basic.tab.c"
+    break;
+
+  case 278: /* optexprlist: exprlist  */
+#line 1850 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 5696 "./build/basic.tab.c"
+    break;
+
+  case 279: /* exprlist: expritem  */
+#line 1855 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 5702 "./build/basic.tab.c"
+    break;
+
+  case 280: /* exprlist: exprlist ',' expritem  */
+#line 1857 "frontends/basic/basic.y"
+   { yyval = AddToList(yyvsp[-2], yyvsp[0]); }
+#line 5708 "./build/basic.tab.c"
+    break;
+
+  case 281: /* expritem: expr  */
+#line 1862 "frontends/basic/basic.y"
+   { yyval = NewAST(AST_EXPRLIST, yyvsp[0], NULL); }
+#line 5714 "./build/basic.tab.c"
+    break;
+
+  case 282: /* np_expritem: np_expr  */
+#line 1867 "frontends/basic/basic.y"
+   { yyval = NewAST(AST_EXPRLIST, yyvsp[0], NULL); }
+#line 5720 "./build/basic.tab.c"
+    break;
+
+  case 283: /* np_exprlist: np_expritem  */
+#line 1871 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 5726 "./build/basic.tab.c"
+    break;
+
+  case 284: /* np_exprlist: np_expritem ',' exprlist  */
+#line 1873 "frontends/basic/basic.y"
+    { yyval = AddToList(yyvsp[-2], yyvsp[0]); }
+#line 5732 "./build/basic.tab.c"
+    break;
+
+  case 285: /* subbody: optstatementlist endsub  */
+#line 1878 "frontends/basic/basic.y"
+  { yyval = yyvsp[-1]; }
+#line 5738 "./build/basic.tab.c"
+    break;
+
+  case 288: /* funcbody: optstatementlist endfunc  */
+#line 1888 "frontends/basic/basic.y"
+  { yyval = yyvsp[-1]; }
+#line 5744 "./build/basic.tab.c"
+    break;
+
+  case 291: /* attributes: %empty  */
+#line 1898 "frontends/basic/basic.y"
+    { yyval = 0; }
+#line 5750 "./build/basic.tab.c"
+    break;
+
+  case 292: /* attributes: "for" "literal string"  */
+#line 1900 "frontends/basic/basic.y"
+    {
+        AST *ast = yyvsp[0];
+        ast->kind = AST_ANNOTATION;
+        yyval = ast;
+    }
+#line 5760 "./build/basic.tab.c"
+    break;
+
+  case 293: /* subdecl: "sub" attributes "identifier" '(' paramdecl ')' eoln subbody  */
+#line 1909 "frontends/basic/basic.y"
+  {
+    AST *attrib = yyvsp[-6];
+    AST *ident = yyvsp[-5];
+    AST *parms = yyvsp[-3];
+    AST *body = yyvsp[0];
+    AST *funcdecl = NewAST(AST_FUNCDECL, ident, NULL);
+    AST *funcvars = NewAST(AST_FUNCVARS, parms, NULL);
+    AST *funcdef = NewAST(AST_FUNCDEF, funcdecl, funcvars);
+    DeclareFunction(current, ast_type_void, 1, funcdef, body, attrib, yyvsp[-7]);
+  }
+#line 5775 "./build/basic.tab.c"
+    break;
+
+  case 294: /* subdecl: "sub" attributes "identifier" paramdecl eoln subbody  */
+#line 1920 "frontends/basic/basic.y"
+  {
+    AST *attrib = yyvsp[-4];
+    AST *ident = yyvsp[-3];
+    AST *parms = yyvsp[-2];
+    AST *body = yyvsp[0];
+    AST *funcdecl = NewAST(AST_FUNCDECL, ident, NULL);
+    AST *funcvars = NewAST(AST_FUNCVARS, parms, NULL);
+    AST *funcdef = NewAST(AST_FUNCDEF, funcdecl, funcvars);
+    DeclareFunction(current, ast_type_void, 1, funcdef, body, attrib, yyvsp[-5]);
+  }
+#line 5790 "./build/basic.tab.c"
+    break;
+
+  case 295: /* subdecl: "declare" "sub" "identifier" "lib" "literal string" '(' paramdecl ')'  */
+#line 1931 "frontends/basic/basic.y"
+     {
+         AST *attrib = NULL;
+         AST *name = yyvsp[-5];
+         AST *parms = yyvsp[-1];
+         AST *rettype = ast_type_void;
+         AST *body = yyvsp[-3];
+         AST *funcdecl = NewAST(AST_FUNCDECL, name, NULL);
+         AST *funcvars = NewAST(AST_FUNCVARS, parms, NULL);
+         AST *funcdef = NewAST(AST_FUNCDEF, funcdecl, funcvars);
+         
+         DeclareFunction(current, rettype, 1, funcdef, body, attrib, yyvsp[-7]);
+     }
+#line 5807 "./build/basic.tab.c"
+    break;
+
+  case 296: /* funcdecl: "function" attributes "identifier" '(' paramdecl ')' eoln funcbody  */
+#line 1947 "frontends/basic/basic.y"
+  {
+    AST *attrib = yyvsp[-6];
+    AST *name = yyvsp[-5];
+    AST *parms = yyvsp[-3];
+    AST *body = yyvsp[0];
+    AST *funcdecl = NewAST(AST_FUNCDECL, name, NULL);
+    AST *funcvars = NewAST(AST_FUNCVARS, parms, NULL);
+    AST *funcdef = NewAST(AST_FUNCDEF, funcdecl, funcvars);
+    AST *rettype = InferTypeFromName(name);
+    DeclareFunction(current, rettype, 1, funcdef, body, attrib, yyvsp[-7]);
+  }
+#line 5823 "./build/basic.tab.c"
+    break;
+
+  case 297: /* funcdecl: "function" attributes "identifier" '(' paramdecl ')' "as" typelist eoln funcbody  */
+#line 1959 "frontends/basic/basic.y"
+  {
+    AST *attrib = yyvsp[-8];
+    AST *name = yyvsp[-7];
+    AST *parms = yyvsp[-5];
+    AST *rettype = yyvsp[-2];
+    AST *body = yyvsp[0];
+    AST *funcdecl = NewAST(AST_FUNCDECL, name, NULL);
+    AST *funcvars = NewAST(AST_FUNCVARS, parms, NULL);
+    AST *funcdef = NewAST(AST_FUNCDEF, funcdecl, funcvars);
+    DeclareFunction(current, rettype, 1, funcdef, body, attrib, yyvsp[-9]);
+  }
+#line 5839 "./build/basic.tab.c"
+    break;
+
+  case 298: /* funcdecl: "declare" "function" "identifier" "lib" "literal string" '(' paramdecl ')' "as" typelist  */
+#line 1971 "frontends/basic/basic.y"
+     {
+         AST *attrib = NULL;
+         AST *name = yyvsp[-7];
+         AST *parms = yyvsp[-3];
+         AST *rettype = yyvsp[0];
+         AST *body = yyvsp[-5];
+         AST *funcdecl = NewAST(AST_FUNCDECL, name, NULL);
+         AST *funcvars = NewAST(AST_FUNCVARS, parms, NULL);
+         AST *funcdef = NewAST(AST_FUNCDEF, funcdecl, funcvars);
+         
+         DeclareFunction(current, rettype, 1, funcdef, body, attrib, yyvsp[-9]);
+     }
+#line 5856 "./build/basic.tab.c"
+    break;
+
+  case 299: /* funcdecl: "def" "identifier" '(' paramdecl ')' '=' expr  */
+#line 1984 "frontends/basic/basic.y"
+  {
+    AST *name = yyvsp[-5];
+    AST *funcdecl = NewAST(AST_FUNCDECL, name, NULL);
+    AST *funcvars = NewAST(AST_FUNCVARS, yyvsp[-3], NULL);
+    AST *funcdef = NewAST(AST_FUNCDEF, funcdecl, funcvars);
+    AST *rettype = InferTypeFromName(name);
+    AST *retval = yyvsp[0];
+    AST *body;
+
+    body = NewAST(AST_STMTLIST,
+                  NewAST(AST_RETURN, retval, NULL),
+                  NULL);
+    DeclareFunction(current, rettype, 1, funcdef, body, NULL, yyvsp[-6]);
+  }
+#line 5875 "./build/basic.tab.c"
+    break;
+
+  case 300: /* functemplate: templateheader "function" "identifier" '(' paramdecl ')' "as" typelist eoln funcbody  */
+#line 2002 "frontends/basic/basic.y"
+    {
+        AST *name = yyvsp[-7];
+	AST *types = yyvsp[-9];
+        AST *paramvars = yyvsp[-5];
+        AST *rettype = yyvsp[-2];
+	AST *functype = NewAST(AST_FUNCTYPE, rettype, paramvars);
+	AST *body = yyvsp[0];
+	AST *top_decl;
+	top_decl = NewAST(AST_LISTHOLDER, functype,
+			  NewAST(AST_LISTHOLDER, name,
+				 NewAST(AST_LISTHOLDER, body, NULL)));
+        PopCurrentTypes();
+	top_decl = NewAST(AST_FUNC_TEMPLATE, types, top_decl);
+	DeclareFunctionTemplate(current, top_decl);
+    }
+#line 5895 "./build/basic.tab.c"
+    break;
+
+  case 301: /* functemplate: templateheader "sub" "identifier" '(' paramdecl ')' eoln subbody  */
+#line 2018 "frontends/basic/basic.y"
+    {
+        AST *name = yyvsp[-5];
+	AST *types = yyvsp[-7];
+        AST *paramvars = yyvsp[-3];
+        AST *rettype = ast_type_void;
+	AST *functype = NewAST(AST_FUNCTYPE, rettype, paramvars);
+	AST *body = yyvsp[0];
+	AST *top_decl;
+	top_decl = NewAST(AST_LISTHOLDER, functype,
+			  NewAST(AST_LISTHOLDER, name,
+				 NewAST(AST_LISTHOLDER, body, NULL)));
+        PopCurrentTypes();
+	top_decl = NewAST(AST_FUNC_TEMPLATE, types, top_decl);
+	DeclareFunctionTemplate(current, top_decl);
+    }
+#line 5915 "./build/basic.tab.c"
+    break;
+
+  case 302: /* templateheader: "any" '(' identlist ')'  */
+#line 2037 "frontends/basic/basic.y"
+    {
+      PushCurrentTypes();
+      yyval = AddTemplateTypes(yyvsp[-1]);
+    }
+#line 5924 "./build/basic.tab.c"
+    break;
+
+  case 303: /* identlist: "identifier"  */
+#line 2045 "frontends/basic/basic.y"
+    {
+      yyval = NewAST(AST_LISTHOLDER, yyvsp[0], NULL);
+    }
+#line 5932 "./build/basic.tab.c"
+    break;
+
+  case 304: /* identlist: identlist ',' "identifier"  */
+#line 2049 "frontends/basic/basic.y"
+    {
+      AST *rhs = NewAST(AST_LISTHOLDER, yyvsp[0], NULL);
+      yyval = AddToList(yyvsp[-2], rhs);
+    }
+#line 5941 "./build/basic.tab.c"
+    break;
+
+  case 305: /* classdecl: "class" "identifier" "using" "literal string"  */
+#line 2057 "frontends/basic/basic.y"
+    {
+        AST *newobj = NewAbstractObject( yyvsp[-2], yyvsp[0] );
+        current->objblock = AddToList(current->objblock, newobj);
+        AddSymbol(currentTypes, yyvsp[-2]->d.string, SYM_TYPEDEF, newobj, NULL);
+        yyval = NULL;
+    }
+#line 5952 "./build/basic.tab.c"
+    break;
+
+  case 307: /* classheader: "class" "identifier" eoln  */
+#line 2068 "frontends/basic/basic.y"
+  {
+    AST *ident = yyvsp[-1];
+    const char *classname = ident->d.string;
+    Module *P = NewModule(classname, current->curLanguage);
+    AST *newobj = NewAbstractObject( yyvsp[-1], NULL );
+    newobj->d.ptr = P;
+    AddSymbol(currentTypes, yyvsp[-1]->d.string, SYM_TYPEDEF, newobj, NULL);
+    P->Lptr = current->Lptr;
+    P->subclasses = current->subclasses;
+    current->subclasses = P;
+    P->superclass = current;
+    current = P;
+    yyval = NULL;
+  }
+#line 5971 "./build/basic.tab.c"
+    break;
+
+  case 310: /* classend: "end" "class"  */
+#line 2090 "frontends/basic/basic.y"
+{
+  if (!current->superclass) {
+    SYNTAX_ERROR("END CLASS not inside class");
+  } else {
+    current = current->superclass;
+  }
+}
+#line 5983 "./build/basic.tab.c"
+    break;
+
+  case 312: /* classdeclitem: dimlist "as" typename  */
+#line 2101 "frontends/basic/basic.y"
+    {
+        AST *ast = NewAST(AST_DECLARE_VAR, yyvsp[0], yyvsp[-2]);
+        DeclareBASICMemberVariables(ast);
+    }
+#line 5992 "./build/basic.tab.c"
+    break;
+
+  case 313: /* classdeclitem: dimension  */
+#line 2106 "frontends/basic/basic.y"
+    {
+        AST *ast = yyvsp[0];
+        if (ast->kind == AST_GLOBALVARS) {
+            DeclareBASICSharedVariables(ast->left);
+        } else {
+            DeclareBASICMemberVariables(ast);
+        }
+    }
+#line 6005 "./build/basic.tab.c"
+    break;
+
+  case 317: /* constdecl: "const" constlist  */
+#line 2121 "frontends/basic/basic.y"
+  {
+      yyval = current->conblock = AddToList(current->conblock, yyvsp[0]);
+  }
+#line 6013 "./build/basic.tab.c"
+    break;
+
+  case 318: /* constitem: "identifier" '=' expr  */
+#line 2127 "frontends/basic/basic.y"
+    {
+      AST *decl = AstAssign(yyvsp[-2], yyvsp[0]);
+      decl = CommentedListHolder(decl);
+      yyval = decl;
+    }
+#line 6023 "./build/basic.tab.c"
+    break;
+
+  case 319: /* constlist: constlist ',' constitem  */
+#line 2135 "frontends/basic/basic.y"
+    { yyval = AddToList(yyvsp[-2], yyvsp[0]); }
+#line 6029 "./build/basic.tab.c"
+    break;
+
+  case 320: /* constlist: constitem  */
+#line 2137 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 6035 "./build/basic.tab.c"
+    break;
+
+  case 321: /* typedecl: "type" "identifier" "as" typename  */
+#line 2142 "frontends/basic/basic.y"
+    {
+        AddSymbol(currentTypes, yyvsp[-2]->d.string, SYM_TYPEDEF, yyvsp[0], NULL);
+    }
+#line 6043 "./build/basic.tab.c"
+    break;
+
+  case 322: /* typename: basetypename  */
+#line 2148 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 6049 "./build/basic.tab.c"
+    break;
+
+  case 323: /* typename: basetypename ptrdef  */
+#line 2150 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_PTRTYPE, yyvsp[-1], NULL); }
+#line 6055 "./build/basic.tab.c"
+    break;
+
+  case 324: /* typename: basetypename "const" ptrdef  */
+#line 2152 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_MODIFIER_CONST, NewAST(AST_PTRTYPE, yyvsp[-2], NULL), NULL); }
+#line 6061 "./build/basic.tab.c"
+    break;
+
+  case 325: /* typename: '(' typename ')'  */
+#line 2154 "frontends/basic/basic.y"
+    { yyval = yyvsp[-1]; }
+#line 6067 "./build/basic.tab.c"
+    break;
+
+  case 326: /* typename: basetypename '(' expr ')'  */
+#line 2156 "frontends/basic/basic.y"
+    {
+        Symbol *sym = GetCurArrayBase();
+        AST *size = yyvsp[-1];
+        AST *base = (AST *)sym->val;
+        size = AstOperator('-', size, AstOperator('-', base, AstInteger(1)));
+        yyval = MakeArrayType(yyvsp[-3], size);
+        yyval->d.ptr = (AST *)sym->val;
+    }
+#line 6080 "./build/basic.tab.c"
+    break;
+
+  case 327: /* typelist: typename  */
+#line 2168 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 6086 "./build/basic.tab.c"
+    break;
+
+  case 328: /* typelist: typelist ',' typename  */
+#line 2170 "frontends/basic/basic.y"
+    {
+        AST *list = yyvsp[-2];
+        AST *added = yyvsp[0];
+        if (list->kind != AST_TUPLE_TYPE) {
+            list = NewAST(AST_TUPLE_TYPE, list, NULL);
+        }
+        yyval = AddToList(list, NewAST(AST_TUPLE_TYPE, added, NULL));
+    }
+#line 6099 "./build/basic.tab.c"
+    break;
+
+  case 331: /* basetypename: "ubyte"  */
+#line 2186 "frontends/basic/basic.y"
+    { yyval = ast_type_byte; }
+#line 6105 "./build/basic.tab.c"
+    break;
+
+  case 332: /* basetypename: "ushort"  */
+#line 2188 "frontends/basic/basic.y"
+    { yyval = ast_type_word; }
+#line 6111 "./build/basic.tab.c"
+    break;
+
+  case 333: /* basetypename: "long"  */
+#line 2190 "frontends/basic/basic.y"
+    { yyval = ast_type_long; }
+#line 6117 "./build/basic.tab.c"
+    break;
+
+  case 334: /* basetypename: "longint"  */
+#line 2192 "frontends/basic/basic.y"
+    { yyval = ast_type_long64; }
+#line 6123 "./build/basic.tab.c"
+    break;
+
+  case 335: /* basetypename: "byte"  */
+#line 2194 "frontends/basic/basic.y"
+    { yyval = ast_type_signed_byte; }
+#line 6129 "./build/basic.tab.c"
+    break;
+
+  case 336: /* basetypename: "short"  */
+#line 2196 "frontends/basic/basic.y"
+    { yyval = ast_type_signed_word; }
+#line 6135 "./build/basic.tab.c"
+    break;
+
+  case 337: /* basetypename: "ulong"  */
+#line 2198 "frontends/basic/basic.y"
+    { yyval = ast_type_unsigned_long; }
+#line 6141 "./build/basic.tab.c"
+    break;
+
+  case 338: /* basetypename: "ulongint"  */
+#line 2200 "frontends/basic/basic.y"
+    { yyval = ast_type_unsigned_long64; }
+#line 6147 "./build/basic.tab.c"
+    break;
+
+  case 339: /* basetypename: "integer"  */
+#line 2202 "frontends/basic/basic.y"
+    { yyval = ast_type_long; }
+#line 6153 "./build/basic.tab.c"
+    break;
+
+  case 340: /* basetypename: "uinteger"  */
+#line 2204 "frontends/basic/basic.y"
+    { yyval = ast_type_unsigned_long; }
+#line 6159 "./build/basic.tab.c"
+    break;
+
+  case 341: /* basetypename: "single"  */
+#line 2206 "frontends/basic/basic.y"
+    { yyval = ast_type_float; }
+#line 6165 "./build/basic.tab.c"
+    break;
+
+  case 342: /* basetypename: "double"  */
+#line 2208 "frontends/basic/basic.y"
+    { yyval = ast_type_float; }
+#line 6171 "./build/basic.tab.c"
+    break;
+
+  case 343: /* basetypename: "fixed" '(' "integer number" ')'  */
+#line 2210 "frontends/basic/basic.y"
+    {
+        AST *sizeexpr = yyvsp[-1];
+        int siz = sizeexpr->d.ival;
+        if (siz < 1 || siz > 31) {
+            SYNTAX_ERROR("Fixed point size %d is out of range 1..31", siz);
+            siz = 16;
+        }
+        SYNTAX_ERROR("Fixed point types not implemented yet");
+        yyval = ast_type_float;
+    }
+#line 6186 "./build/basic.tab.c"
+    break;
+
+  case 344: /* basetypename: "string"  */
+#line 2221 "frontends/basic/basic.y"
+    { yyval = ast_type_string; }
+#line 6192 "./build/basic.tab.c"
+    break;
+
+  case 345: /* basetypename: "any"  */
+#line 2223 "frontends/basic/basic.y"
+    { yyval = ast_type_generic; }
+#line 6198 "./build/basic.tab.c"
+    break;
+
+  case 346: /* basetypename: "type name"  */
+#line 2225 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 6204 "./build/basic.tab.c"
+    break;
+
+  case 347: /* basetypename: "const" basetypename  */
+#line 2227 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_MODIFIER_CONST, yyvsp[0], NULL); }
+#line 6210 "./build/basic.tab.c"
+    break;
+
+  case 348: /* basetypename: "function" '(' paramdecl ')' "as" basetypename  */
+#line 2229 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_PTRTYPE, NewAST(AST_FUNCTYPE, yyvsp[0], yyvsp[-3]), NULL); }
+#line 6216 "./build/basic.tab.c"
+    break;
+
+  case 349: /* basetypename: "sub" '(' paramdecl ')'  */
+#line 2231 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_PTRTYPE, NewAST(AST_FUNCTYPE, ast_type_void, yyvsp[-1]), NULL); }
+#line 6222 "./build/basic.tab.c"
+    break;
+
+  case 350: /* basetypename: "class" "using" "literal string"  */
+#line 2233 "frontends/basic/basic.y"
+    {
+        AST *tempnam = NewAST(AST_IDENTIFIER, NULL, NULL);
+        const char *name = NewTemporaryVariable("_class_", NULL);
+        AST *newobj;
+
+        tempnam->d.string = name;
+        newobj = NewAbstractObject( tempnam, yyvsp[0] );        
+        current->objblock = AddToList(current->objblock, newobj);
+        yyval = newobj;
+    }
+#line 6237 "./build/basic.tab.c"
+    break;
+
+  case 351: /* paramdecl: %empty  */
+#line 2247 "frontends/basic/basic.y"
+    { yyval = NULL; }
+#line 6243 "./build/basic.tab.c"
+    break;
+
+  case 352: /* paramdecl: paramdecl1  */
+#line 2249 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 6249 "./build/basic.tab.c"
+    break;
+
+  case 353: /* paramdecl1: paramitem  */
+#line 2253 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_LISTHOLDER, yyvsp[0], NULL); }
+#line 6255 "./build/basic.tab.c"
+    break;
+
+  case 354: /* paramdecl1: paramdecl1 ',' paramitem  */
+#line 2255 "frontends/basic/basic.y"
+    { yyval = AddToList(yyvsp[-2], NewAST(AST_LISTHOLDER, yyvsp[0], NULL)); }
+#line 6261 "./build/basic.tab.c"
+    break;
+
+  case 355: /* paramitem: paramvar  */
+#line 2260 "frontends/basic/basic.y"
+    { yyval = AdjustParamType(yyvsp[0]); }
+#line 6267 "./build/basic.tab.c"
+    break;
+
+  case 356: /* paramitem: "byref" paramvar  */
+#line 2262 "frontends/basic/basic.y"
+    { yyval = AdjustParamForByRef(yyvsp[0]); }
+#line 6273 "./build/basic.tab.c"
+    break;
+
+  case 357: /* paramitem: "byval" paramvar  */
+#line 2264 "frontends/basic/basic.y"
+    { yyval = AdjustParamForByVal(yyvsp[0]); }
+#line 6279 "./build/basic.tab.c"
+    break;
+
+  case 358: /* paramvar: "identifier"  */
+#line 2269 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_DECLARE_VAR, InferTypeFromName(yyvsp[0]), yyvsp[0]); }
+#line 6285 "./build/basic.tab.c"
+    break;
+
+  case 359: /* paramvar: "identifier" '=' expr  */
+#line 2271 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_DECLARE_VAR, InferTypeFromName(yyvsp[-2]), AstAssign(yyvsp[-2], yyvsp[0])); }
+#line 6291 "./build/basic.tab.c"
+    break;
+
+  case 360: /* paramvar: "identifier" "as" typename  */
+#line 2273 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_DECLARE_VAR, yyvsp[0], yyvsp[-2]); }
+#line 6297 "./build/basic.tab.c"
+    break;
+
+  case 361: /* paramvar: "identifier" '(' ')' "as" typename  */
+#line 2275 "frontends/basic/basic.y"
+    {
+        AST *typ = yyvsp[0];
+        typ = MakeArrayType(typ, AstInteger(0));
+        yyval = NewAST(AST_DECLARE_VAR, typ, yyvsp[-4]);
+    }
+#line 6307 "./build/basic.tab.c"
+    break;
+
+  case 362: /* paramvar: "identifier" '=' expr "as" typename  */
+#line 2281 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_DECLARE_VAR, yyvsp[0], AstAssign(yyvsp[-4], yyvsp[-2])); }
+#line 6313 "./build/basic.tab.c"
+    break;
+
+  case 363: /* dimension: "dim" dimlist  */
+#line 2286 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_DECLARE_VAR, NULL, yyvsp[0]); }
+#line 6319 "./build/basic.tab.c"
+    break;
+
+  case 364: /* dimension: "dim" dimlist "as" typename  */
+#line 2288 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_DECLARE_VAR, yyvsp[0], yyvsp[-2]); }
+#line 6325 "./build/basic.tab.c"
+    break;
+
+  case 365: /* dimension: "dim" "as" typename dimlist  */
+#line 2290 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_DECLARE_VAR, yyvsp[-1], yyvsp[0]); }
+#line 6331 "./build/basic.tab.c"
+    break;
+
+  case 366: /* dimension: "dim" "shared" dimlist  */
+#line 2292 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_GLOBALVARS, NewAST(AST_DECLARE_VAR, NULL, yyvsp[0]), NULL); }
+#line 6337 "./build/basic.tab.c"
+    break;
+
+  case 367: /* dimension: "dim" "shared" dimlist "as" typename  */
+#line 2294 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_GLOBALVARS, NewAST(AST_DECLARE_VAR, yyvsp[0], yyvsp[-2]), NULL); }
+#line 6343 "./build/basic.tab.c"
+    break;
+
+  case 368: /* dimension: "dim" "shared" "as" typename dimlist  */
+#line 2296 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_GLOBALVARS, NewAST(AST_DECLARE_VAR, yyvsp[-1], yyvsp[0]), NULL); }
+#line 6349 "./build/basic.tab.c"
+    break;
+
+  case 369: /* dimension: "declare" "identifier" "alias" "identifier" opt_type_as  */
+#line 2298 "frontends/basic/basic.y"
+    {
+        AST *newname = yyvsp[-3];
+        AST *oldname = yyvsp[-1];
+        AST *newtype = yyvsp[0];
+        if (newtype) {
+            oldname = NewAST(AST_TYPEDEF, newtype, oldname);
+        }
+        yyval = NewAST(AST_DECLARE_ALIAS, newname, oldname);
+    }
+#line 6363 "./build/basic.tab.c"
+    break;
+
+  case 370: /* dimension: "declare" "identifier" "alias" "integer number" "as" typename  */
+#line 2308 "frontends/basic/basic.y"
+    {
+        AST *newname = yyvsp[-4];
+        AST *addr = yyvsp[-2];
+        AST *newtype = yyvsp[0];
+
+        addr = NewAST(AST_MEMREF, newtype, addr);
+        addr = BASICArrayRef(addr, AstInteger(0));
+        addr = NewAST(AST_TYPEDEF, newtype, addr);
+        yyval = NewAST(AST_DECLARE_ALIAS, newname, addr);
+    }
+#line 6378 "./build/basic.tab.c"
+    break;
+
+  case 371: /* opt_type_as: %empty  */
+#line 2322 "frontends/basic/basic.y"
+    { yyval = NULL; }
+#line 6384 "./build/basic.tab.c"
+    break;
+
+  case 372: /* opt_type_as: "as" typename  */
+#line 2324 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 6390 "./build/basic.tab.c"
+    break;
+
+  case 373: /* dimlist: dimitem  */
+#line 2329 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 6396 "./build/basic.tab.c"
+    break;
+
+  case 374: /* dimlist: dimlist ',' dimitem  */
+#line 2331 "frontends/basic/basic.y"
+    { yyval = AddToList(yyvsp[-2], yyvsp[0]); }
+#line 6402 "./build/basic.tab.c"
+    break;
+
+  case 375: /* dimitem: identdecl  */
+#line 2335 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_LISTHOLDER, yyvsp[0], NULL); }
+#line 6408 "./build/basic.tab.c"
+    break;
+
+  case 376: /* dimitem: identdecl '=' expr  */
+#line 2337 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_LISTHOLDER, AstAssign(yyvsp[-2], yyvsp[0]), NULL); }
+#line 6414 "./build/basic.tab.c"
+    break;
+
+  case 377: /* dimitem: identdecl '=' '{' exprlist '}'  */
+#line 2339 "frontends/basic/basic.y"
+    { yyval = NewAST(AST_LISTHOLDER, AstAssign(yyvsp[-4], yyvsp[-1]), NULL); }
+#line 6420 "./build/basic.tab.c"
+    break;
+
+  case 378: /* identdecl: "identifier"  */
+#line 2344 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 6426 "./build/basic.tab.c"
+    break;
+
+  case 379: /* identdecl: "identifier" '(' expr ')'  */
+#line 2346 "frontends/basic/basic.y"
+    {
+        Symbol *sym = GetCurArrayBase();
+        AST *ident = yyvsp[-3];
+        AST *base = (AST *)sym->val;
+        AST *size = yyvsp[-1];
+        AST *decl;
+        size = AstOperator('-', size, AstOperator('-', base, AstInteger(1)));
+//        size = AstInteger(EvalConstExpr(size));
+        decl = NewAST(AST_ARRAYDECL, ident, size);
+        decl->d.ptr = base;
+        yyval = decl;
+    }
+#line 6443 "./build/basic.tab.c"
+    break;
+
+  case 380: /* identdecl: "identifier" '(' expr "to" expr ')'  */
+#line 2359 "frontends/basic/basic.y"
+    {
+        AST *ident = yyvsp[-5];
+        AST *base = yyvsp[-3];
+        AST *size = yyvsp[-1];
+        AST *decl;
+        size = AstOperator('-', size, AstOperator('-', base, AstInteger(1)));
+//        size = AstInteger(EvalConstExpr(size));
+        decl = NewAST(AST_ARRAYDECL, ident, size);
+        decl->d.ptr = base;
+        yyval = decl;
+    }
+#line 6459 "./build/basic.tab.c"
+    break;
+
+  case 381: /* identdecl: "identifier" '(' expr ',' expr ')'  */
+#line 2371 "frontends/basic/basic.y"
+    {
+        Symbol *sym = GetCurArrayBase();
+        AST *ident = yyvsp[-5];
+        AST *base = (AST *)sym->val;
+        AST *size1 = yyvsp[-3];
+        AST *size2 = yyvsp[-1];
+        AST *sizelist;
+        AST *decl;
+        size1 = AstOperator('-', size1, AstOperator('-', base, AstInteger(1)));
+        size2 = AstOperator('-', size2, AstOperator('-', base, AstInteger(1)));
+        sizelist = NewAST(AST_EXPRLIST, size1,
+                          NewAST(AST_EXPRLIST, size2, NULL));
+        decl = NewAST(AST_ARRAYDECL, ident, sizelist);
+        decl->d.ptr = base;
+        yyval = decl;
+    }
+#line 6480 "./build/basic.tab.c"
+    break;
+
+  case 382: /* identdecl: "identifier" '(' expr "to" expr ',' expr "to" expr ')'  */
+#line 2388 "frontends/basic/basic.y"
+    {
+        AST *ident = yyvsp[-9];
+        AST *base1 = yyvsp[-7];
+        AST *size1 = yyvsp[-5];
+        AST *base2 = yyvsp[-3];
+        AST *size2 = yyvsp[-1];
+        AST *sizelist;
+        AST *decl;
+        size1 = AstOperator('-', size1, AstOperator('-', base1, AstInteger(1)));
+        size2 = AstOperator('-', size2, AstOperator('-', base2, AstInteger(1)));
+        sizelist = NewAST(AST_EXPRLIST, size1,
+                          NewAST(AST_EXPRLIST, size2, NULL));
+        decl = NewAST(AST_ARRAYDECL, ident, sizelist);
+        if (!AstMatch(base1, base2)) {
+            SYNTAX_ERROR("Base values for multi-dimensional array indices must match");
+        }
+        decl->d.ptr = base1;
+        yyval = decl;
+    }
+#line 6504 "./build/basic.tab.c"
+    break;
+
+  case 383: /* asmstmt: "asm" eoln asmlist "end" "asm"  */
+#line 2411 "frontends/basic/basic.y"
+      {
+          // integer 0 means default asm
+          yyval = NewCommentedAST(AST_INLINEASM, yyvsp[-2], AstInteger(0), yyvsp[-4]);
+      }
+#line 6513 "./build/basic.tab.c"
+    break;
+
+  case 384: /* asmstmt: "const" "asm" eoln asmlist "end" "asm"  */
+#line 2416 "frontends/basic/basic.y"
+      {
+          // integer 1 means const asm
+          yyval = NewCommentedAST(AST_INLINEASM, yyvsp[-2], AstInteger(1), yyvsp[-5]);
+      }
+#line 6522 "./build/basic.tab.c"
+    break;
+
+  case 385: /* asmstmt: "cpu" "asm" eoln asmlist "end" "asm"  */
+#line 2421 "frontends/basic/basic.y"
+      {
+          // integer 3 means const asm execute from FCACHE
+          yyval = NewCommentedAST(AST_INLINEASM, yyvsp[-2], AstInteger(3), yyvsp[-5]);
+      }
+#line 6531 "./build/basic.tab.c"
+    break;
+
+  case 386: /* asmstmt: "shared" "asm" eoln asmlist "end" "asm"  */
+#line 2426 "frontends/basic/basic.y"
+      { current->datblock = AddToListEx(current->datblock, yyvsp[-2], &current->datblock_tail); yyval = 0;}
+#line 6537 "./build/basic.tab.c"
+    break;
+
+  case 387: /* asmstmt: "asm" "shared" eoln asmlist "end" "asm"  */
+#line 2430 "frontends/basic/basic.y"
+      { current->datblock = AddToListEx(current->datblock, yyvsp[-2], &current->datblock_tail); yyval = 0;}
+#line 6543 "./build/basic.tab.c"
+    break;
+
+  case 388: /* asmlist: asmline  */
+#line 2435 "frontends/basic/basic.y"
+  { yyval = yyvsp[0]; }
+#line 6549 "./build/basic.tab.c"
+    break;
+
+  case 389: /* asmlist: asmlist asmline  */
+#line 2437 "frontends/basic/basic.y"
+  { yyval = AddToList(yyvsp[-1], yyvsp[0]); }
+#line 6555 "./build/basic.tab.c"
+    break;
+
+  case 391: /* asmline: "identifier" basedatline  */
+#line 2443 "frontends/basic/basic.y"
+    {   AST *linebreak;
+        AST *comment = GetComments();
+        AST *ast;
+        ast = yyvsp[-1];
+        if (comment && (comment->d.string || comment->kind == AST_SRCCOMMENT)) {
+            linebreak = NewCommentedAST(AST_LINEBREAK, NULL, NULL, comment);
+        } else {
+            linebreak = NewAST(AST_LINEBREAK, NULL, NULL);
+        }
+        ast = AddToList(ast, yyvsp[0]);
+        ast = AddToList(linebreak, ast);
+        yyval = ast;
+    }
+#line 6573 "./build/basic.tab.c"
+    break;
+
+  case 392: /* basedatline: "end of line"  */
+#line 2460 "frontends/basic/basic.y"
+    { yyval = NULL; }
+#line 6579 "./build/basic.tab.c"
+    break;
+
+  case 393: /* basedatline: error "end of line"  */
+#line 2462 "frontends/basic/basic.y"
+    { yyval = NULL; }
+#line 6585 "./build/basic.tab.c"
+    break;
+
+  case 394: /* basedatline: "byte" "end of line"  */
+#line 2464 "frontends/basic/basic.y"
+    { yyval = NewCommentedAST(AST_BYTELIST, NULL, NULL, yyvsp[-1]); }
+#line 6591 "./build/basic.tab.c"
+    break;
+
+  case 395: /* basedatline: "byte" operandlist "end of line"  */
+#line 2466 "frontends/basic/basic.y"
+    { yyval = NewCommentedAST(AST_BYTELIST, yyvsp[-1], NULL, yyvsp[-2]); }
+#line 6597 "./build/basic.tab.c"
+    break;
+
+  case 396: /* basedatline: "word" "end of line"  */
+#line 2468 "frontends/basic/basic.y"
+    { yyval = NewCommentedAST(AST_WORDLIST, NULL, NULL, yyvsp[-1]); }
+#line 6603 "./build/basic.tab.c"
+    break;
+
+  case 397: /* basedatline: "word" operandlist "end of line"  */
+#line 2470 "frontends/basic/basic.y"
+    { yyval = NewCommentedAST(AST_WORDLIST, yyvsp[-1], NULL, yyvsp[-2]); }
+#line 6609 "./build/basic.tab.c"
+    break;
+
+  case 398: /* basedatline: "long" "end of line"  */
+#line 2472 "frontends/basic/basic.y"
+    { yyval = NewCommentedAST(AST_LONGLIST, NULL, NULL, yyvsp[-1]); }
+#line 6615 "./build/basic.tab.c"
+    break;
+
+  case 399: /* basedatline: "long" operandlist "end of line"  */
+#line 2474 "frontends/basic/basic.y"
+    { yyval = NewCommentedAST(AST_LONGLIST, yyvsp[-1], NULL, yyvsp[-2]); }
+#line 6621 "./build/basic.tab.c"
+    break;
+
+  case 400: /* basedatline: instruction "end of line"  */
+#line 2476 "frontends/basic/basic.y"
+    { yyval = NewCommentedInstr(yyvsp[-1]); }
+#line 6627 "./build/basic.tab.c"
+    break;
+
+  case 401: /* basedatline: instruction operandlist "end of line"  */
+#line 2478 "frontends/basic/basic.y"
+    { yyval = NewCommentedInstr(AddToList(yyvsp[-2], yyvsp[-1])); }
+#line 6633 "./build/basic.tab.c"
+    break;
+
+  case 402: /* basedatline: instruction modifierlist "end of line"  */
+#line 2480 "frontends/basic/basic.y"
+    { yyval = NewCommentedInstr(AddToList(yyvsp[-2], yyvsp[-1])); }
+#line 6639 "./build/basic.tab.c"
+    break;
+
+  case 403: /* basedatline: instruction operandlist modifierlist "end of line"  */
+#line 2482 "frontends/basic/basic.y"
+    { yyval = NewCommentedInstr(AddToList(yyvsp[-3], AddToList(yyvsp[-2], yyvsp[-1]))); }
+#line 6645 "./build/basic.tab.c"
+    break;
+
+  case 404: /* basedatline: "alignl" "end of line"  */
+#line 2484 "frontends/basic/basic.y"
+    { yyval = NewCommentedAST(AST_ALIGN, AstInteger(4), NULL, yyvsp[-1]); }
+#line 6651 "./build/basic.tab.c"
+    break;
+
+  case 405: /* basedatline: "alignw" "end of line"  */
+#line 2486 "frontends/basic/basic.y"
+    { yyval = NewCommentedAST(AST_ALIGN, AstInteger(2), NULL, yyvsp[-1]); }
+#line 6657 "./build/basic.tab.c"
+    break;
+
+  case 406: /* basedatline: "org" "end of line"  */
+#line 2488 "frontends/basic/basic.y"
+    { yyval = NewCommentedAST(AST_ORG, NULL, NULL, yyvsp[-1]); }
+#line 6663 "./build/basic.tab.c"
+    break;
+
+  case 407: /* basedatline: "org" pasmexpr "end of line"  */
+#line 2490 "frontends/basic/basic.y"
+    { yyval = NewCommentedAST(AST_ORG, yyvsp[-1], NULL, yyvsp[-2]); }
+#line 6669 "./build/basic.tab.c"
+    break;
+
+  case 408: /* basedatline: "orgh" "end of line"  */
+#line 2492 "frontends/basic/basic.y"
+    { yyval = NewCommentedAST(AST_ORGH, NULL, NULL, yyvsp[-1]); }
+#line 6675 "./build/basic.tab.c"
+    break;
+
+  case 409: /* basedatline: "orgh" pasmexpr "end of line"  */
+#line 2494 "frontends/basic/basic.y"
+    { yyval = NewCommentedAST(AST_ORGH, yyvsp[-1], NULL, yyvsp[-2]); }
+#line 6681 "./build/basic.tab.c"
+    break;
+
+  case 410: /* basedatline: "orgf" pasmexpr "end of line"  */
+#line 2496 "frontends/basic/basic.y"
+    { yyval = NewCommentedAST(AST_ORGF, yyvsp[-1], NULL, yyvsp[-2]); }
+#line 6687 "./build/basic.tab.c"
+    break;
+
+  case 411: /* basedatline: "res" pasmexpr "end of line"  */
+#line 2498 "frontends/basic/basic.y"
+    { yyval = NewCommentedAST(AST_RES, yyvsp[-1], NULL, yyvsp[-2]); }
+#line 6693 "./build/basic.tab.c"
+    break;
+
+  case 412: /* basedatline: "fit" pasmexpr "end of line"  */
+#line 2500 "frontends/basic/basic.y"
+    { yyval = NewCommentedAST(AST_FIT, yyvsp[-1], NULL, yyvsp[-2]); }
+#line 6699 "./build/basic.tab.c"
+    break;
+
+  case 413: /* basedatline: "fit" "end of line"  */
+#line 2502 "frontends/basic/basic.y"
+    { yyval = NewCommentedAST(AST_FIT, AstInteger(0x1f0), NULL, yyvsp[-1]); }
+#line 6705 "./build/basic.tab.c"
+    break;
+
+  case 414: /* basedatline: "file" "literal string" "end of line"  */
+#line 2504 "frontends/basic/basic.y"
+    { yyval = NewCommentedAST(AST_FILE, GetFullFileName(yyvsp[-1]), NULL, yyvsp[-2]); }
+#line 6711 "./build/basic.tab.c"
+    break;
+
+  case 415: /* operand: pasmexpr  */
+#line 2509 "frontends/basic/basic.y"
+   { yyval = NewAST(AST_EXPRLIST, yyvsp[0], NULL); }
+#line 6717 "./build/basic.tab.c"
+    break;
+
+  case 416: /* operand: '#' pasmexpr  */
+#line 2511 "frontends/basic/basic.y"
+   { yyval = NewAST(AST_EXPRLIST, NewAST(AST_IMMHOLDER, yyvsp[0], NULL), NULL); }
+#line 6723 "./build/basic.tab.c"
+    break;
+
+  case 417: /* operand: '#' '#' pasmexpr  */
+#line 2513 "frontends/basic/basic.y"
+   { yyval = NewAST(AST_EXPRLIST, NewAST(AST_BIGIMMHOLDER, yyvsp[0], NULL), NULL); }
+#line 6729 "./build/basic.tab.c"
+    break;
+
+  case 418: /* operand: pasmexpr '[' pasmexpr ']'  */
+#line 2515 "frontends/basic/basic.y"
+   { yyval = NewAST(AST_EXPRLIST, NewAST(AST_ARRAYREF, yyvsp[-3], yyvsp[-1]), NULL); }
+#line 6735 "./build/basic.tab.c"
+    break;
+
+  case 419: /* operand: pasmexpr '+' '+'  */
+#line 2517 "frontends/basic/basic.y"
+   { yyval = NewAST(AST_EXPRLIST, AstOperator(K_INCREMENT, yyvsp[-2], NULL), NULL); }
+#line 6741 "./build/basic.tab.c"
+    break;
+
+  case 420: /* pasmexpr: expr  */
+#line 2522 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 6747 "./build/basic.tab.c"
+    break;
+
+  case 421: /* pasmexpr: '\\' expr  */
+#line 2524 "frontends/basic/basic.y"
+    { yyval = AstCatch(yyvsp[0]); }
+#line 6753 "./build/basic.tab.c"
+    break;
+
+  case 422: /* pasmexpr: "hardware register"  */
+#line 2526 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 6759 "./build/basic.tab.c"
+    break;
+
+  case 423: /* operandlist: operand  */
+#line 2531 "frontends/basic/basic.y"
+   { yyval = yyvsp[0]; }
+#line 6765 "./build/basic.tab.c"
+    break;
+
+  case 424: /* operandlist: operandlist ',' operand  */
+#line 2533 "frontends/basic/basic.y"
+   { yyval = AddToList(yyvsp[-2], yyvsp[0]); }
+#line 6771 "./build/basic.tab.c"
+    break;
+
+  case 425: /* instruction: "asm instruction"  */
+#line 2538 "frontends/basic/basic.y"
+  { yyval = yyvsp[0]; }
+#line 6777 "./build/basic.tab.c"
+    break;
+
+  case 426: /* instruction: instrmodifier instruction  */
+#line 2540 "frontends/basic/basic.y"
+  { yyval = AddToList(yyvsp[0], yyvsp[-1]); }
+#line 6783 "./build/basic.tab.c"
+    break;
+
+  case 427: /* instrmodifier: "asm instruction modifier"  */
+#line 2545 "frontends/basic/basic.y"
+  { yyval = yyvsp[0]; }
+#line 6789 "./build/basic.tab.c"
+    break;
+
+  case 428: /* modifierlist: instrmodifier  */
+#line 2550 "frontends/basic/basic.y"
+    { yyval = yyvsp[0]; }
+#line 6795 "./build/basic.tab.c"
+    break;
+
+  case 429: /* modifierlist: modifierlist instrmodifier  */
+#line 2552 "frontends/basic/basic.y"
+    { yyval = AddToList(yyvsp[-1], yyvsp[0]); }
+#line 6801 "./build/basic.tab.c"
+    break;
+
+  case 430: /* modifierlist: modifierlist ',' instrmodifier  */
+#line 2554 "frontends/basic/basic.y"
+    { yyval = AddToList(yyvsp[-2], yyvsp[0]); }
+#line 6807 "./build/basic.tab.c"
+    break;
+
+
+#line 6811 "./build/basic.tab.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == BASICYYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      {
+        yypcontext_t yyctx
+          = {yyssp, yytoken};
+        char const *yymsgp = YY_("syntax error");
+        int yysyntax_error_status;
+        yysyntax_error_status = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
+        if (yysyntax_error_status == 0)
+          yymsgp = yymsg;
+        else if (yysyntax_error_status == -1)
+          {
+            if (yymsg != yymsgbuf)
+              YYSTACK_FREE (yymsg);
+            yymsg = YY_CAST (char *,
+                             YYSTACK_ALLOC (YY_CAST (YYSIZE_T, yymsg_alloc)));
+            if (yymsg)
+              {
+                yysyntax_error_status
+                  = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
+                yymsgp = yymsg;
+              }
+            else
+              {
+                yymsg = yymsgbuf;
+                yymsg_alloc = sizeof yymsgbuf;
+                yysyntax_error_status = YYENOMEM;
+              }
+          }
+        yyerror (yymsgp);
+        if (yysyntax_error_status == YYENOMEM)
+          YYNOMEM;
+      }
+    }
+
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= BASICYYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == BASICYYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = BASICYYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != BASICYYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+  if (yymsg != yymsgbuf)
+    YYSTACK_FREE (yymsg);
+  return yyresult;
+}
+
+#line 2557 "frontends/basic/basic.y"
+
+void
+basicyyerror(const char *msg)
+{
+    extern int saved_basicyychar;
+    int yychar = saved_basicyychar;
+    
+    SETCOLOR(PRINT_ERROR);
+    ERRORHEADER(current->Lptr->fileName, current->Lptr->lineCounter, "error");
+
+    if (!strcmp(msg, "syntax error, unexpected $end")) {
+        fprintf(stderr, "unexpected end of input");
+        msg = "";
+    }
+    // massage bison's error messages to make them easier to understand
+    while (*msg) {
+        // say which identifier was unexpected
+        if (!strncmp(msg, "unexpected identifier", strlen("unexpected identifier")) && last_ast && last_ast->kind == AST_IDENTIFIER) {
+            fprintf(stderr, "unexpected identifier `%s'", last_ast->d.string);
+            msg += strlen("unexpected identifier");
+        }
+        // if we get a stray character in source, sometimes bison tries to treat it as a token for
+        // error purposes, resulting in $undefined as the token
+        else if (!strncmp(msg, "$undefined", strlen("$undefined")) && yychar >= ' ' && yychar < 127) {
+            fprintf(stderr, "%c", yychar);
+            msg += strlen("$undefined");
+        }
+        else {
+            fprintf(stderr, "%c", *msg);
+            msg++;
+        }
+    }
+    fprintf(stderr, "\n");     
+    gl_errors++;
+    RESETCOLOR();
+}
@@ -0,0 +1,225 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_BASICYY_BUILD_BASIC_TAB_H_INCLUDED
+# define YY_BASICYY_BUILD_BASIC_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef BASICYYDEBUG
+# if defined YYDEBUG
+#if YYDEBUG
+#   define BASICYYDEBUG 1
+#  else
+#   define BASICYYDEBUG 0
+#  endif
+# else /* ! defined YYDEBUG */
+#  define BASICYYDEBUG 1
+# endif /* ! defined YYDEBUG */
+#endif  /* ! defined BASICYYDEBUG */
+#if BASICYYDEBUG
+extern int basicyydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef BASICYYTOKENTYPE
+# define BASICYYTOKENTYPE
+  enum basicyytokentype
+  {
+    BASICYYEMPTY = -2,
+    BASICYYEOF = 0,                /* "end of file"  */
+    BASICYYerror = 256,            /* error  */
+    BASICYYUNDEF = 257,            /* "invalid token"  */
+    BAS_EMPTY = 258,               /* "_"  */
+    BAS_IDENTIFIER = 259,          /* "identifier"  */
+    BAS_LABEL_INFERRED = 260,      /* "label"  */
+    BAS_LABEL_EXPLICIT = 261,      /* "label:"  */
+    BAS_INTEGER = 262,             /* "integer number"  */
+    BAS_FLOAT = 263,               /* "number"  */
+    BAS_STRING = 264,              /* "literal string"  */
+    BAS_EOLN = 265,                /* "end of line"  */
+    BAS_EOF = 266,                 /* "end of file"  */
+    BAS_TYPENAME = 267,            /* "type name"  */
+    BAS_INSTR = 268,               /* "asm instruction"  */
+    BAS_INSTRMODIFIER = 269,       /* "asm instruction modifier"  */
+    BAS_HWREG = 270,               /* "hardware register"  */
+    BAS_ALIGNL = 271,              /* "alignl"  */
+    BAS_ALIGNW = 272,              /* "alignw"  */
+    BAS_FILE = 273,                /* "file"  */
+    BAS_FIT = 274,                 /* "fit"  */
+    BAS_ORG = 275,                 /* "org"  */
+    BAS_ORGF = 276,                /* "orgf"  */
+    BAS_ORGH = 277,                /* "orgh"  */
+    BAS_RES = 278,                 /* "res"  */
+    BAS_ABS = 279,                 /* "abs"  */
+    BAS_ALIAS = 280,               /* "alias"  */
+    BAS_AND = 281,                 /* "and"  */
+    BAS_ANDALSO = 282,             /* "andalso"  */
+    BAS_ANY = 283,                 /* "any"  */
+    BAS_APPEND = 284,              /* "append"  */
+    BAS_AS = 285,                  /* "as"  */
+    BAS_ASC = 286,                 /* "asc"  */
+    BAS_ASM = 287,                 /* "asm"  */
+    BAS_ALLOCA = 288,              /* "__builtin_alloca"  */
+    BAS_BYREF = 289,               /* "byref"  */
+    BAS_BYTE = 290,                /* "byte"  */
+    BAS_BYVAL = 291,               /* "byval"  */
+    BAS_CALL = 292,                /* "call"  */
+    BAS_CASE = 293,                /* "case"  */
+    BAS_CAST = 294,                /* "cast"  */
+    BAS_CATCH = 295,               /* "catch"  */
+    BAS_CHAIN = 296,               /* "chain"  */
+    BAS_CLASS = 297,               /* "class"  */
+    BAS_CLOSE = 298,               /* "close"  */
+    BAS_CONST = 299,               /* "const"  */
+    BAS_CONTINUE = 300,            /* "continue"  */
+    BAS_CPU = 301,                 /* "cpu"  */
+    BAS_DATA = 302,                /* "data"  */
+    BAS_DECLARE = 303,             /* "declare"  */
+    BAS_DEF = 304,                 /* "def"  */
+    BAS_DEFINT = 305,              /* "defint"  */
+    BAS_DEFSNG = 306,              /* "defsng"  */
+    BAS_DELETE = 307,              /* "delete"  */
+    BAS_DIM = 308,                 /* "dim"  */
+    BAS_DIRECTION = 309,           /* "direction"  */
+    BAS_DO = 310,                  /* "do"  */
+    BAS_DOUBLE = 311,              /* "double"  */
+    BAS_ELSE = 312,                /* "else"  */
+    BAS_END = 313,                 /* "end"  */
+    BAS_ENDIF = 314,               /* "endif"  */
+    BAS_ENUM = 315,                /* "enum"  */
+    BAS_EXIT = 316,                /* "exit"  */
+    BAS_EXTERN = 317,              /* "extern"  */
+    BAS_FIXED = 318,               /* "fixed"  */
+    BAS_FOR = 319,                 /* "for"  */
+    BAS_FUNCTION = 320,            /* "function"  */
+    BAS_FUNC_NAME = 321,           /* "__FUNCTION__"  */
+    BAS_GET = 322,                 /* "get"  */
+    BAS_GOTO = 323,                /* "goto"  */
+    BAS_GOSUB = 324,               /* "gosub"  */
+    BAS_HASMETHOD = 325,           /* "_hasmethod"  */
+    BAS_IF = 326,                  /* "if"  */
+    BAS_IMPORT = 327,              /* "import"  */
+    BAS_INPUT = 328,               /* "input"  */
+    BAS_CAST_INT = 329,            /* "int"  */
+    BAS_INTEGER_KW = 330,          /* "integer"  */
+    BAS_LET = 331,                 /* "let"  */
+    BAS_LIB = 332,                 /* "lib"  */
+    BAS_LINE = 333,                /* "line"  */
+    BAS_LONG = 334,                /* "long"  */
+    BAS_LONGINT = 335,             /* "longint"  */
+    BAS_LOOP = 336,                /* "loop"  */
+    BAS_MOD = 337,                 /* "mod"  */
+    BAS_NEW = 338,                 /* "new"  */
+    BAS_NEXT = 339,                /* "next"  */
+    BAS_NIL = 340,                 /* "nil"  */
+    BAS_NOT = 341,                 /* "not"  */
+    BAS_ON = 342,                  /* "on"  */
+    BAS_OPEN = 343,                /* "open"  */
+    BAS_OPTION = 344,              /* "option"  */
+    BAS_OR = 345,                  /* "or"  */
+    BAS_ORELSE = 346,              /* "orelse"  */
+    BAS_OUTPUT = 347,              /* "output"  */
+    BAS_POINTER = 348,             /* "pointer"  */
+    BAS_PRINT = 349,               /* "print"  */
+    BAS_PRIVATE = 350,             /* "private"  */
+    BAS_PROGRAM = 351,             /* "program"  */
+    BAS_PTR = 352,                 /* "ptr"  */
+    BAS_PUT = 353,                 /* "put"  */
+    BAS_READ = 354,                /* "read"  */
+    BAS_RESTORE = 355,             /* "restore"  */
+    BAS_RETURN = 356,              /* "return"  */
+    BAS_SAMETYPES = 357,           /* "_sametypes"  */
+    BAS_SELECT = 358,              /* "select"  */
+    BAS_SELF = 359,                /* "self"  */
+    BAS_SHARED = 360,              /* "shared"  */
+    BAS_SHORT = 361,               /* "short"  */
+    BAS_SINGLE = 362,              /* "single"  */
+    BAS_SIZEOF = 363,              /* "sizeof"  */
+    BAS_SQRT = 364,                /* "sqrt"  */
+    BAS_STEP = 365,                /* "step"  */
+    BAS_STRING_KW = 366,           /* "string"  */
+    BAS_STRUCT = 367,              /* "struct"  */
+    BAS_SUB = 368,                 /* "sub"  */
+    BAS_THEN = 369,                /* "then"  */
+    BAS_THROW = 370,               /* "throw"  */
+    BAS_THROWIFCAUGHT = 371,       /* "throwifcaught"  */
+    BAS_TO = 372,                  /* "to"  */
+    BAS_TRY = 373,                 /* "try"  */
+    BAS_TYPE = 374,                /* "type"  */
+    BAS_UBYTE = 375,               /* "ubyte"  */
+    BAS_UINTEGER = 376,            /* "uinteger"  */
+    BAS_ULONG = 377,               /* "ulong"  */
+    BAS_ULONGINT = 378,            /* "ulongint"  */
+    BAS_UNTIL = 379,               /* "until"  */
+    BAS_USHORT = 380,              /* "ushort"  */
+    BAS_USING = 381,               /* "using"  */
+    BAS_VAR = 382,                 /* "var"  */
+    BAS_WEND = 383,                /* "wend"  */
+    BAS_WITH = 384,                /* "with"  */
+    BAS_WHILE = 385,               /* "while"  */
+    BAS_WORD = 386,                /* "word"  */
+    BAS_XOR = 387,                 /* "xor"  */
+    BAS_LE = 388,                  /* "<="  */
+    BAS_GE = 389,                  /* ">="  */
+    BAS_NE = 390,                  /* "<>"  */
+    BAS_SHL = 391,                 /* "shl"  */
+    BAS_SHR = 392,                 /* "shr"  */
+    BAS_ADD_ASSIGN = 393,          /* "+="  */
+    BAS_SUB_ASSIGN = 394,          /* "-="  */
+    BAS_MUL_ASSIGN = 395,          /* "*="  */
+    BAS_DIV_ASSIGN = 396,          /* "/="  */
+    BAS_MOD_ASSIGN = 397,          /* "MOD="  */
+    BAS_AND_ASSIGN = 398,          /* "AND="  */
+    BAS_OR_ASSIGN = 399,           /* "OR="  */
+    BAS_XOR_ASSIGN = 400           /* "XOR="  */
+  };
+  typedef enum basicyytokentype basicyytoken_kind_t;
+#endif
+
+/* Value type.  */
+#if ! defined BASICYYSTYPE && ! defined BASICYYSTYPE_IS_DECLARED
+typedef int BASICYYSTYPE;
+# define BASICYYSTYPE_IS_TRIVIAL 1
+# define BASICYYSTYPE_IS_DECLARED 1
+#endif
+
+
+
+
+int basicyyparse (void);
+
+
+#endif /* !YY_BASICYY_BUILD_BASIC_TAB_H_INCLUDED  */
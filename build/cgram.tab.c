@@ -0,0 +1,7010 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 1
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+/* Substitute the type names.  */
+#define YYSTYPE         CGRAMYYSTYPE
+/* Substitute the variable and function names.  */
+#define yyparse         cgramyyparse
+#define yylex           cgramyylex
+#define yyerror         cgramyyerror
+#define yydebug         cgramyydebug
+#define yynerrs         cgramyynerrs
+
+/* First part of user prologue.  */
+#line 9 "frontends/c/cgram.y"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <ctype.h>
+#include <stdlib.h>
+#include "frontends/common.h"
+#include "frontends/lexer.h"
+
+#define CGRAMYYSTYPE AST*
+#undef  YYSTYPE
+#define YYSTYPE CGRAMYYSTYPE
+#define IN_DAT 1
+    
+/* special flag */
+    AST *ast_type_c_signed = NULL;
+    AST *ast_type_c_long = NULL;
+    
+/* Yacc functions */
+    void cgramyyerror(const char *);
+    int cgramyylex();
+
+    extern int gl_errors;
+
+    extern AST *last_ast;
+    extern AST *CommentedListHolder(AST *); // in spin.y
+
+#define YYERROR_VERBOSE 1
+
+extern int allow_type_names;
+    
+static void
+DisallowTypeNames()
+{
+    allow_type_names = 0;
+}
+
+static void
+AllowTypeNames()
+{
+    allow_type_names = 1;
+}
+
+static AST *
+MakeSigned(AST *type, int isSigned)
+{
+    if (!type) return type;
+    if (type->kind == AST_INTTYPE) {
+        if (isSigned) return type;
+        return NewAST(AST_UNSIGNEDTYPE, type->left, NULL);
+    }
+    if (type->kind == AST_UNSIGNEDTYPE) {
+        if (!isSigned) return type;
+        return NewAST(AST_INTTYPE, type->left, NULL);
+    }
+    type->left = MakeSigned(type->left, isSigned);
+    return type;
+}
+static AST *
+LengthenType(AST *type)
+{
+    if (!type) {
+        return ast_type_c_long;
+    }
+    if (type == ast_type_c_long) {
+        // "long long" -> 8 byte type
+        return NewAST(AST_INTTYPE, AstInteger(8), NULL);
+    }
+    if (type->kind == AST_FLOATTYPE) {
+        // "long double" -> 8 byte double
+        return NewAST(AST_FLOATTYPE, AstInteger(8), NULL);
+    }
+    // otherwise make sure it is 4 bytes long
+    // and that further lengthening it will make it 8 bytes
+    return ast_type_c_long;
+}
+
+static AST *
+LabelName(AST *x)
+{
+    const char *orig_name = GetUserIdentifierName(x);
+    char *new_name;
+
+    if (!orig_name) return x;
+    new_name = calloc(strlen(orig_name) + 8, 1);
+    strcpy(new_name, "label:");
+    strcat(new_name, orig_name);
+    return AstIdentifier(new_name);
+}
+
+static AST *CombineTypes(AST *first, AST *second, AST **identifier, Module **module);
+
+static AST *
+C_ModifySignedUnsigned(AST *modifier, AST *type)
+{
+    if (modifier == ast_type_c_signed) {
+        type = MakeSigned(type, 1);
+    } else if (modifier == ast_type_unsigned_long) {
+        type = MakeSigned(type, 0);
+    } else if (modifier == ast_type_c_long) {
+    // we need to be able to distinguish between
+    // "long long" and "long int"
+        type = LengthenType(type);
+    } else {
+        type = CombineTypes(modifier, type, NULL, NULL);
+    }
+    return type;
+}
+
+static AST *
+CombinePointer(AST *ptr, AST *type)
+{
+    AST *q = ptr;
+    while (q && q->left) {
+        q = q->left;
+    }
+    if (q) {
+        q->left = type;
+    }
+    return ptr;
+}
+
+Module *
+FindClassByAst(AST *astName)
+{
+    const char *name = GetUserIdentifierName(astName);
+    Module *P = NULL;
+    Symbol *sym = LookupSymbolInTable(currentTypes, name);
+    if (sym && sym->kind == SYM_TYPEDEF) {
+        AST *typ = (AST *)sym->val;
+        if (typ->kind != AST_OBJECT) {
+            ERROR(astName, "%s is not a class", name);
+            return NULL;
+        }
+        P = GetClassPtr(typ);
+    }
+    if (!P) {
+        ERROR(astName, "cannot find class %s", name);
+    }
+    return P;
+}
+
+static AST *MergePrefix(AST *prefix, AST *first)
+{
+    if (prefix) {
+        // make sure we migrate STATIC to the front of the list
+        if (first && first->kind == AST_STATIC) {
+            first->left = AddToLeftList(prefix, first->left);
+        } else {
+            first = AddToLeftList(prefix, first);
+        }
+    }
+    return first;
+}
+
+static AST *
+CombineTypes(AST *first, AST *second, AST **identifier, Module **module)
+{
+    AST *expr, *ident;
+    AST *prefix = NULL;
+    
+    if (second && second->kind == AST_COMMENT) {
+        second = NULL;
+    }
+    if (first && first->kind == AST_COMMENT) {
+        first = NULL;
+    }
+    if (!second || first == second) {
+        return first;
+    }
+    if (first && (first->kind == AST_STATIC || first->kind == AST_TYPEDEF || first->kind == AST_EXTERN)) {
+        prefix = DupAST(first);
+        first = first->left;
+        prefix->left = NULL;
+    }
+    switch (second->kind) {
+    case AST_DECLARE_VAR:
+        first = CombineTypes(first, second->left, identifier, module);
+        first = CombineTypes(first, second->right, identifier, module);
+        return MergePrefix(prefix, first);
+    case AST_METHODREF:
+        if (module) {
+            if (*module) {
+                ERROR(second, "flexspin only supports one :: in declarations");
+            } else {
+                *module = FindClassByAst(second->left);
+            }
+            second = second->right;
+        }
+        /* fall through */
+    case AST_SYMBOL:
+    case AST_LOCAL_IDENTIFIER:
+    case AST_IDENTIFIER:
+        if (identifier) {
+            *identifier = second;
+        }
+        return MergePrefix(prefix, first);
+    case AST_ARRAYDECL:
+    case AST_ARRAYTYPE:
+        first = NewAST(AST_ARRAYTYPE, first, second->right);
+        return MergePrefix(prefix, CombineTypes(first, second->left, identifier, module));
+    case AST_REFTYPE:
+    case AST_PTRTYPE:
+        first = NewAST(second->kind, first, NULL);
+        second = CombineTypes(first, second->left, identifier, module);
+        return MergePrefix(prefix, second);
+        
+    case AST_FUNCTYPE:
+        second->left = CombineTypes(first, second->left, identifier,  module);
+        return MergePrefix(prefix, second);
+    case AST_ASSIGN:
+        expr = second->right;
+        first = CombineTypes(first, second->left, &ident, module);
+        ident = AstAssign(ident, expr);
+        if (identifier) {
+            *identifier = ident;
+        }
+        return MergePrefix(prefix, first);
+    case AST_MODIFIER_CONST:
+    case AST_MODIFIER_VOLATILE:
+        expr = NewAST(second->kind, NULL, NULL);
+        second = MergePrefix(prefix, CombineTypes(first, second->left, identifier, module));
+        expr->left = second;
+        return expr;
+    case AST_BITFIELD:
+        // first == type
+        // second == BITFIELD(ident, size)
+        // -> BITFIELD(type, size)
+        if (identifier) {
+            *identifier = second->left;
+        }
+        second->left = first;
+        return second;
+    default:
+        if (!first) {
+            return MergePrefix(prefix, second);
+        }
+        if (second && second == ast_type_long) {
+            return first;
+        }
+        ERROR(first ? first : second, "Unable to combine types");
+        return first;
+    }
+}
+
+static AST *
+DeclareStatics(Module *P, AST *basetype, AST *decllist)
+{
+    AST *ident;
+    AST *decl;
+    AST *nameAst;
+    AST *globalname;
+    AST *results = NULL;
+    const char *nameString;
+    int needs_initializer = 0;
+    int has_initializer;
+    int inSubModule = !IsTopLevel(P);
+    
+    // ignore static declarations like
+    //   static int blah[]
+    if (basetype && basetype->kind == AST_ARRAYTYPE && !basetype->right) {
+        needs_initializer = 1;
+    }
+    // go through the identifier list
+    while (decllist) {
+        has_initializer = 0;
+        if (decllist->kind == AST_LISTHOLDER) {
+            decl = decllist->left;
+            decllist = decllist->right;
+        } else {
+            decl = decllist;
+            decllist = NULL;
+        }
+        if (decl->kind == AST_ASSIGN) {
+            ident = decl->left;
+            has_initializer = 1;
+        } else {
+            ident = decl;
+        }
+        if (ident->kind == AST_ARRAYDECL) {
+            nameAst = ident->left;
+        } else {
+            nameAst = ident;
+        }
+        if (needs_initializer && !has_initializer) {
+            continue;
+        }
+        if (nameAst->kind == AST_LOCAL_IDENTIFIER) {
+            // we have to be very careful here; a new static declaration
+            // for an identifier needs to override an existing static in
+            // an outer scope
+            Symbol *sym;
+            const char *idstr = GetUserIdentifierName(nameAst);
+            // use FindSymbol to look only in current tables, not enclosing
+            // ones
+            sym = FindSymbol(currentTypes, idstr);
+            if (!sym) {
+                *nameAst = *nameAst->right; // create a new local
+            }
+        }
+        if (nameAst->kind == AST_LOCAL_IDENTIFIER || inSubModule) {
+            DeclareOneGlobalVar(P, decl, basetype, IN_DAT);
+        } else {
+            // OK, "nameAst" is the name we want it to be known as inside
+            // the function, but we will want to create a global variable
+            // with a new name
+
+            nameString = GetIdentifierName(nameAst);
+            globalname = AstTempIdentifier(nameString);
+            EnterLocalAlias(currentTypes, globalname, nameString);
+            // and enter a new global definition
+            *nameAst = *globalname;
+            DeclareOneGlobalVar(P, decl, basetype, IN_DAT);
+        }
+    }
+    return results;
+}
+
+static AST *
+MultipleDeclareVar(AST *first, AST *second)
+{
+    AST *ident, *type;
+    AST *stmtlist = NULL;
+    AST *item;
+    Module *module = NULL;
+    
+    while (second) {
+        if (second->kind != AST_LISTHOLDER) {
+            ERROR(second, "internal error in createVarDeclarations: expected listholder");
+            return stmtlist;
+        }
+        item = second->left;
+        second = second->right;
+        type = CombineTypes(first, item, &ident, &module);
+        if (module) {
+            ERROR(first, ":: not supported yet");
+        }
+        if (type && type->kind == AST_STATIC) {
+            stmtlist = AddToList(stmtlist, DeclareStatics(current, type->left, ident));
+        } else if (type && type->kind == AST_EXTERN) {
+            /* declare a global variable */
+            ident = NewAST(AST_DECLARE_VAR, type->left, ident);
+            DeclareTypedGlobalVariables(ident, 1); // "extern" variables are always in DAT
+        } else {
+            ident = NewAST(AST_DECLARE_VAR, type, ident);
+            stmtlist = AddToList(stmtlist, NewAST(AST_STMTLIST, ident, NULL));
+        }
+    }
+    return stmtlist;
+}
+
+AST *
+SingleDeclareVar(AST *decl_spec, AST *declarator)
+{
+    AST *type, *ident;
+    Module *module = NULL;
+    
+    ident = NULL;
+    type = CombineTypes(decl_spec, declarator, &ident, &module);
+    if (type && type->kind == AST_EXTERN) {
+        // just ignore EXTERN declarations
+        return NULL;
+    }
+    if (!ident && !type) {
+        return NULL;
+    }
+    if (module) {
+        ERROR(declarator, ":: not supported for variable declarations yet");
+    }
+    return NewAST(AST_DECLARE_VAR, type, ident);
+}
+
+static void
+DeclareCGlobalVariables(AST *slist)
+{
+    AST *temp;
+    int inDat;
+
+    if (!current || IsTopLevel(current) || !strcmp(current->classname, "_system_")) {
+        inDat = 1;
+    } else {
+//        inDat = 0;
+        inDat = 1;
+    }
+    if (slist && slist->kind == AST_DECLARE_VAR) {
+        DeclareTypedGlobalVariables(slist, inDat);
+        return;
+    }
+    while (slist) {
+        if (slist->kind != AST_STMTLIST) {
+            ERROR(slist, "internal error in DeclareCGlobalVars");
+        }
+        temp = slist->left;
+        DeclareTypedGlobalVariables(temp, inDat);
+        slist = slist->right;
+    }
+}
+
+/* process a parameter list and fix it up as necessary */
+static AST *
+ProcessParamList(AST *list)
+{
+    AST *entry, *type;
+    int count = 0;
+    AST *orig_list = list;
+    
+    if (list->kind == AST_EXPRLIST) {
+        while (list) {
+            entry = list->left;
+            list->left = NewAST(AST_DECLARE_VAR, ast_type_long, entry);
+            list->kind = AST_LISTHOLDER;
+            list = list->right;
+        }
+        list = orig_list;
+    }
+    while (list) {
+        entry = list->left;
+        list = list->right;
+        if (entry == ast_type_void) {
+            if (list || count) {
+                SYNTAX_ERROR("void should appear alone in a parameter list");
+            }
+            return NULL;
+        }
+        if (entry && entry->kind == AST_DECLARE_VAR) {
+            type = entry->left;
+            while (type->kind == AST_MODIFIER_CONST || type->kind == AST_MODIFIER_VOLATILE) {
+                type = type->left;
+            }
+            if (type->kind == AST_ARRAYTYPE) {
+                type->kind = AST_PTRTYPE;
+            }
+        }
+        count++;
+    }
+    return orig_list;
+}
+
+/* make sure a statement is embedded in a statement list */
+static AST *
+ForceStatementList(AST *stmt)
+{
+    if (stmt && stmt->kind != AST_STMTLIST) {
+        return NewAST(AST_STMTLIST, stmt, NULL);
+    }
+    return stmt;
+}
+
+static AST *
+AddEnumerators(AST *identifier, AST *enumlist)
+{
+    AST *resetZero = NewAST(AST_ENUMSET, AstInteger(0), NULL);
+    Module *P;
+    enumlist = NewAST(AST_LISTHOLDER, resetZero, enumlist);
+
+    if (current->curLanguage == LANG_CFAMILY_C) {
+        // enum symbols in C get declared with global scope
+        P = GetTopLevelModule();
+        if (P->curLanguage != LANG_CFAMILY_C) {
+            // handle the case where a C file is included as a module
+            // in another language
+            P = current;
+        }
+    } else {
+        // in C++ enums get declared in the context of the class
+        // they're declared in
+        P = current;
+    }
+    // we have to process the enumerators now so that they may be used
+    // in struct definitions and such
+    P->conblock = AddToList(P->conblock, enumlist);
+    DeclareConstants(P, &P->conblock);
+    P->conblock = NULL;
+    return ast_type_long;
+}
+
+static void
+DeclareCMemberVariables(Module *P, AST *astlist, int is_union)
+{
+    AST *idlist, *typ;
+    AST *ident;
+    AST *ast;
+    int bitfield_offset = 0;
+    int bitfield_size = 0;
+    int max_bitfield_size = 0;
+    AST *bitfield_ident = 0;
+    int is_private = -P->defaultPrivate;
+    AST *last_pos = 0;
+    
+    if (!astlist) return;
+    if (astlist->kind != AST_STMTLIST) {
+        ERROR(astlist, "Internal error, expected stmt list");
+        return;
+    }
+    if (is_union) {
+        P->isUnion = 1;
+    }
+    while (astlist) {
+        ast = astlist->left;
+        astlist = astlist->right;
+        if (ast->kind == AST_PUBFUNC) {
+            is_private = 0;
+            continue;
+        }
+        if (ast->kind == AST_PRIFUNC) {
+            is_private = 1;
+            continue;
+        }
+        if (is_private == -1) {
+            WARNING(ast, "declarations in class with no explicit public or private; assuming private");
+            is_private = 1;
+        }
+        if (ast->kind == AST_FUNCDECL) {
+            AST *type;
+            AST *ident;
+            AST *body;
+            int is_public = !is_private;
+            AST *list = ast->left;
+            if (list->kind != AST_LISTHOLDER) {
+                ERROR(list, "malformed func decl");
+                return;
+            }
+            type = list->left; list = list->right;
+            ident = list->left; list = list->right;
+            body = list->left;
+            DeclareTypedFunction(P, type, ident, is_public, body, NULL, NULL);
+            continue;
+        }
+        if (ast->kind != AST_DECLARE_VAR) {
+            ERROR(ast, "internal error, not DECLARE_VAR");
+            return;
+        }
+        idlist = ast->right;
+        typ = ast->left;
+        if (idlist->kind == AST_LISTHOLDER) {
+            if (typ->kind == AST_BITFIELD) {
+                ERROR(typ, "Internal error, bitfield in a list");
+                typ = typ->left;
+            }
+            while (idlist) {
+                ident = idlist->left;
+                // not in a bitfield
+                max_bitfield_size = bitfield_size = bitfield_offset = 0;
+                MaybeDeclareMemberVar(P, ident, typ, is_private, NORMAL_VAR);
+                idlist = idlist->right;
+            }
+        } else {
+            ident = idlist;
+            if (typ->kind == AST_BITFIELD) {
+                AST *bfield_ast = typ->right;
+                AST *bfield_typ = typ->left;
+                AST *bfield_access;
+                AST *bfield_list = 0;
+                int tsize;
+                int bsize = EvalConstExpr(bfield_ast);
+                Symbol *sym = FindSymbol(&P->objsyms, GetIdentifierName(ident));
+
+                if (sym && sym->kind == SYM_ALIAS) {
+                    goto skip_decl;
+                }
+                tsize = TypeSize(bfield_typ) * 8;
+                if (max_bitfield_size == 0 || max_bitfield_size != tsize || bitfield_offset + bsize > max_bitfield_size) {
+                    // start a new bitfield
+                    max_bitfield_size = tsize;
+                    bitfield_offset = 0;
+                    bitfield_ident = AstTempIdentifier("__bitfield_");
+                    last_pos = MaybeDeclareMemberVar(P, bitfield_ident, bfield_typ, is_private, HIDDEN_VAR);
+                }
+                if (bsize > max_bitfield_size) {
+                    ERROR(bfield_ast, "bitfield size %d is greater than type size %d",
+                          bsize, max_bitfield_size);
+                    bsize = max_bitfield_size;
+                }
+                if (bsize < 0) {
+                    bsize = 1;
+                }
+                bfield_access = NewAST(AST_RANGE, AstInteger(bitfield_offset + bsize - 1), AstInteger(bitfield_offset));
+                bfield_access = NewAST(AST_RANGEREF, bitfield_ident, bfield_access);
+                bfield_access = NewAST(AST_CAST, bfield_typ, bfield_access);
+                DeclareMemberAlias(P, ident, bfield_access);
+                bfield_list = NewAST(AST_DECLARE_BITFIELD, bfield_access, ident);
+                bfield_list = NewAST(AST_LISTHOLDER, bfield_list, NULL);
+                P->pendingvarblock = ListInsertBefore(P->pendingvarblock, last_pos, bfield_list);
+                bitfield_offset += bsize;
+            skip_decl:
+                ;
+            } else {
+                // not in a bitfield
+                max_bitfield_size = bitfield_size = bitfield_offset = 0;
+                MaybeDeclareMemberVar(P, ident, typ, is_private, NORMAL_VAR);
+            }
+        }
+    }
+
+}
+
+static void
+AddStructBody(Module *C, AST *body)
+{
+    if (body) {
+        int is_union = C->isUnion;
+        DeclareCMemberVariables(C, body, is_union);
+        DeclareMemberVariables(C);
+    }
+}
+
+// make a new struct
+// skind is either AST_STRUCT or AST_UNION
+// identifier is NULL or is a struct tag
+// body is the contents of the struct, or NULL
+// if no struct tag is given, we use one generated from the
+// file name and line number
+//
+static AST *
+MakeNewStruct(Module *Parent, AST *skind, AST *identifier, AST *body)
+{
+    int is_union;
+    int is_class;
+    const char *name;
+    const char *classname;
+    char *typname;
+    Module *C;
+    Symbol *sym;
+    AST *class_type;
+    
+    if (identifier && identifier->kind == AST_LOCAL_IDENTIFIER) {
+        identifier = identifier->right;
+    }
+    if (Parent->mainLanguage == LANG_CFAMILY_C) {
+        // structs inside structs get declared with global scope
+        Module *Q = GetTopLevelModule();
+        if (Q->mainLanguage == LANG_CFAMILY_C) {
+            Parent = Q;
+        }
+    }
+    /* attempt to better handle class inside class */
+    if (0 && current && !IsTopLevel(current)) {
+        /* this causes problems with struct references inside structs */
+        classname = current->classname;
+    } else {
+        classname = "";
+    }
+    if (skind->kind == AST_STRUCT) {
+        is_union = 0;
+        is_class = skind->d.ival != 0;
+    } else if (skind->kind == AST_UNION) {
+        is_union = 1;
+        is_class = 0;
+    } else {
+        ERROR(skind, "Internal error, not struct or union");
+        return NULL;
+    }
+    if (!identifier) {
+        // use file name and line number
+        char buf[128];
+        unsigned int hash = RawSymbolHash(current->Lptr->fileName);
+        sprintf(buf, "_anon_%08x%08x", hash, current->Lptr->lineCounter);
+        identifier = AstIdentifier(strdup(buf));
+    }
+    if (!IsIdentifier(identifier)) {
+        ERROR(identifier, "Internal error, bad struct def");
+        return NULL;
+    }
+    name = GetIdentifierName(identifier);
+    typname = (char *)malloc(strlen(name)+strlen(classname)+16);
+    if (LangStructAutoTypedef(current->curLanguage)) {
+        strcpy(typname, name);
+    } else {
+        strcpy(typname, classname);
+        strcat(typname, "_struct__");
+        strcat(typname, name);
+    }
+    /* see if there is already a type with that name */
+    sym = LookupSymbolInTable(currentTypes, typname);
+    if (!sym) {
+        sym = LookupSymbolInTable(&Parent->objsyms, typname);
+    }
+    if (sym && sym->kind == SYM_TYPEDEF) {
+        class_type = (AST *)sym->val;
+        if (!IsClassType(class_type)) {
+            SYNTAX_ERROR("%s is not a class", typname);
+            return NULL;
+        }
+        C = (Module *)class_type->d.ptr;
+        if (C->isUnion != is_union) {
+            SYNTAX_ERROR("Inconsistent use of union/struct for %s", typname);
+        }
+        C->Lptr = current->Lptr;
+    } else {
+        if (body && body->kind == AST_STRING) {
+            class_type = NewAbstractObject(AstIdentifier(typname), body);
+            Parent->objblock = AddToList(Parent->objblock, class_type);
+            body = NULL;
+            C = NULL;
+        } else {
+            C = NewModule(typname, LANG_CFAMILY_C);
+            C->defaultPrivate = is_class;
+            C->Lptr = current->Lptr;
+            C->isUnion = is_union;
+            class_type = NewAbstractObject(AstIdentifier(typname), NULL);
+            class_type->d.ptr = C;
+            AddSymbol(currentTypes, typname, SYM_TYPEDEF, class_type, NULL);
+            AddSymbol(&Parent->objsyms, typname, SYM_TYPEDEF, class_type, NULL);
+            AddSubClass(Parent, C);
+        }
+    }
+    AddStructBody(C, body);
+    return class_type;
+}
+
+//
+// utility function: find a variable in a declaration list
+//
+static AST *
+FindDeclInList(AST *param, AST *decl_list)
+{
+    AST *decl;
+    AST *ident;
+    while (decl_list) {
+        if (decl_list->kind != AST_STMTLIST) {
+            ERROR(decl_list, "Internal error, badly formed declaration list");
+            return NULL;
+        }
+        decl = decl_list->left;
+        if (decl->kind == AST_DECLARE_VAR) {
+            ident = decl->right;
+            if (AstUses(ident, param)) {
+                return DupAST(decl);
+            }
+        }
+        decl_list = decl_list->right;
+    }
+    return NULL;
+}
+
+//
+// convert an old style declaration like:
+//   int strlen(x) char *x; { ... }
+// into
+//   int strlen(char *x) { ... }
+//
+// actually this part just finds the declarations
+//
+AST *
+MergeOldStyleDeclarationList(AST *orig_funcdecl, AST *decl_list)
+{
+    AST *funcdecl = orig_funcdecl;
+    AST *param_list;
+    AST *param;
+    if (!funcdecl) return NULL;
+    while (funcdecl && funcdecl->kind == AST_PTRTYPE) {
+        funcdecl = funcdecl->left;
+    }
+    if (funcdecl->kind != AST_DECLARE_VAR) {
+        ERROR(funcdecl, "Internal error expected declaration");
+        return orig_funcdecl;
+    }
+    if (funcdecl->left->kind != AST_FUNCTYPE) {
+        ERROR(funcdecl, "Expected function declaration");
+        return orig_funcdecl;
+    }
+    funcdecl = funcdecl->left;
+    param_list = funcdecl->right;
+    while(param_list) {
+        AST *newdecl;
+        param = param_list->left;
+        if (!param || param->kind != AST_DECLARE_VAR) {
+            ERROR(param, "Internal error, expecting to find variable");
+            return orig_funcdecl;
+        }
+        // find the corresponding one from decl_list and replace it
+        newdecl = FindDeclInList(param->right, decl_list);
+        if (newdecl) {
+            param_list->left = newdecl;
+        }
+        param_list = param_list->right;
+    }
+    return orig_funcdecl;
+}
+
+static int IsStatic(AST *ftype) {
+    return ftype && ftype->kind == AST_STATIC;
+}
+
+/* declare a typed function, optionally using a local identifier (if the function is STATIC) */
+static AST *
+DeclareCTypedFunction(Module *P, AST *ftype, AST *nameAst, int is_public, AST *body, AST *attribute)
+{
+    if (IsStatic(ftype) && nameAst->kind == AST_IDENTIFIER) {
+        /* declare a local alias for the name */
+        const char *nameString = GetIdentifierName(nameAst);
+        AST *globalName = AstTempIdentifier(nameString);
+        AST *origName = nameAst;
+        EnterLocalAlias(currentTypes, globalName, nameString);
+        nameAst = NewAST(AST_LOCAL_IDENTIFIER, globalName, nameAst);
+        // we have to fix up the body of the function so that references
+        // to the original name are replaced with the new name
+        ReplaceAst(body, origName, nameAst);
+    }
+    return DeclareTypedFunction(P, ftype, nameAst, is_public, body, attribute, NULL);
+}
+
+static AST *
+ConstructDefaultValue(AST *decl, AST *val)
+{
+    AST *ident;
+    AST *ast;
+    if (!val) {
+        return decl;
+    }
+    if (!decl || decl->kind != AST_DECLARE_VAR) {
+        ERROR(decl, "Internal error, expected variable declaration");
+        return decl;
+    }
+    ident = decl->right;
+    ast = NewAST(AST_ASSIGN, ident, val);
+    decl->right = ast;
+    return decl;
+}
+
+
+#line 898 "./build/cgram.tab.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "cgram.tab.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_C_IDENTIFIER = 3,               /* "identifier"  */
+  YYSYMBOL_C_CONSTANT = 4,                 /* "constant"  */
+  YYSYMBOL_C_STRING_LITERAL = 5,           /* "string literal"  */
+  YYSYMBOL_C_SIZEOF = 6,                   /* "sizeof"  */
+  YYSYMBOL_C_TYPEOF = 7,                   /* "typeof"  */
+  YYSYMBOL_C_PTR_OP = 8,                   /* "->"  */
+  YYSYMBOL_C_INC_OP = 9,                   /* "++"  */
+  YYSYMBOL_C_DEC_OP = 10,                  /* "--"  */
+  YYSYMBOL_C_LEFT_OP = 11,                 /* "<<"  */
+  YYSYMBOL_C_RIGHT_OP = 12,                /* ">>"  */
+  YYSYMBOL_C_LE_OP = 13,                   /* "<="  */
+  YYSYMBOL_C_GE_OP = 14,                   /* ">="  */
+  YYSYMBOL_C_EQ_OP = 15,                   /* "=="  */
+  YYSYMBOL_C_NE_OP = 16,                   /* "!="  */
+  YYSYMBOL_C_AND_OP = 17,                  /* "&&"  */
+  YYSYMBOL_C_OR_OP = 18,                   /* "||"  */
+  YYSYMBOL_C_MUL_ASSIGN = 19,              /* "*="  */
+  YYSYMBOL_C_DIV_ASSIGN = 20,              /* "/="  */
+  YYSYMBOL_C_MOD_ASSIGN = 21,              /* "%="  */
+  YYSYMBOL_C_ADD_ASSIGN = 22,              /* "+="  */
+  YYSYMBOL_C_SUB_ASSIGN = 23,              /* "-="  */
+  YYSYMBOL_C_LEFT_ASSIGN = 24,             /* "<<="  */
+  YYSYMBOL_C_RIGHT_ASSIGN = 25,            /* ">>="  */
+  YYSYMBOL_C_AND_ASSIGN = 26,              /* "&="  */
+  YYSYMBOL_C_XOR_ASSIGN = 27,              /* "^="  */
+  YYSYMBOL_C_OR_ASSIGN = 28,               /* "|="  */
+  YYSYMBOL_C_TYPE_NAME = 29,               /* "type name"  */
+  YYSYMBOL_C_LIMITMIN_OP = 30,             /* "#<"  */
+  YYSYMBOL_C_LIMITMAX_OP = 31,             /* "#>"  */
+  YYSYMBOL_C_TYPEDEF = 32,                 /* "typedef"  */
+  YYSYMBOL_C_EXTERN = 33,                  /* "extern"  */
+  YYSYMBOL_C_STATIC = 34,                  /* "static"  */
+  YYSYMBOL_C_AUTO = 35,                    /* "auto"  */
+  YYSYMBOL_C_REGISTER = 36,                /* "register"  */
+  YYSYMBOL_C_RESTRICT = 37,                /* "__restrict"  */
+  YYSYMBOL_C_BOOL = 38,                    /* "_Bool"  */
+  YYSYMBOL_C_CHAR = 39,                    /* "char"  */
+  YYSYMBOL_C_SHORT = 40,                   /* "short"  */
+  YYSYMBOL_C_IMAGINARY = 41,               /* "_Imaginary"  */
+  YYSYMBOL_C_INLINE = 42,                  /* "inline"  */
+  YYSYMBOL_C_INT = 43,                     /* "int"  */
+  YYSYMBOL_C_LONG = 44,                    /* "long"  */
+  YYSYMBOL_C_SIGNED = 45,                  /* "signed"  */
+  YYSYMBOL_C_UNSIGNED = 46,                /* "unsigned"  */
+  YYSYMBOL_C_FLOAT = 47,                   /* "float"  */
+  YYSYMBOL_C_DOUBLE = 48,                  /* "double"  */
+  YYSYMBOL_C_CONST = 49,                   /* "const"  */
+  YYSYMBOL_C_VOLATILE = 50,                /* "volatile"  */
+  YYSYMBOL_C_VOID = 51,                    /* "void"  */
+  YYSYMBOL_C_STRUCT = 52,                  /* "struct"  */
+  YYSYMBOL_C_UNION = 53,                   /* "union"  */
+  YYSYMBOL_C_ENUM = 54,                    /* "enum"  */
+  YYSYMBOL_C_ELLIPSIS = 55,                /* "..."  */
+  YYSYMBOL_C_DOUBLECOLON = 56,             /* "::"  */
+  YYSYMBOL_C_CASE = 57,                    /* "case"  */
+  YYSYMBOL_C_DEFAULT = 58,                 /* "default"  */
+  YYSYMBOL_C_IF = 59,                      /* "if"  */
+  YYSYMBOL_C_ELSE = 60,                    /* "else"  */
+  YYSYMBOL_C_SWITCH = 61,                  /* "switch"  */
+  YYSYMBOL_C_WHILE = 62,                   /* "while"  */
+  YYSYMBOL_C_DO = 63,                      /* "do"  */
+  YYSYMBOL_C_FOR = 64,                     /* "for"  */
+  YYSYMBOL_C_GOTO = 65,                    /* "goto"  */
+  YYSYMBOL_C_CONTINUE = 66,                /* "continue"  */
+  YYSYMBOL_C_BREAK = 67,                   /* "break"  */
+  YYSYMBOL_C_RETURN = 68,                  /* "return"  */
+  YYSYMBOL_C_FROMFILE = 69,                /* "__fromfile"  */
+  YYSYMBOL_C_USING = 70,                   /* "__using"  */
+  YYSYMBOL_C_ATTRIBUTE = 71,               /* "__attribute__"  */
+  YYSYMBOL_C_ASM = 72,                     /* "__asm"  */
+  YYSYMBOL_C_PASM = 73,                    /* "__pasm"  */
+  YYSYMBOL_C_INSTR = 74,                   /* "asm instruction"  */
+  YYSYMBOL_C_INSTRMODIFIER = 75,           /* "instruction modifier"  */
+  YYSYMBOL_C_HWREG = 76,                   /* "hardware register"  */
+  YYSYMBOL_C_CATCH = 77,                   /* "catch"  */
+  YYSYMBOL_C_CLASS = 78,                   /* "class"  */
+  YYSYMBOL_C_DELETE = 79,                  /* "delete"  */
+  YYSYMBOL_C_FALSE = 80,                   /* "false"  */
+  YYSYMBOL_C_NEW = 81,                     /* "new"  */
+  YYSYMBOL_C_NULLPTR = 82,                 /* "nullptr"  */
+  YYSYMBOL_C_TRUE = 83,                    /* "true"  */
+  YYSYMBOL_C_PRIVATE = 84,                 /* "private"  */
+  YYSYMBOL_C_PUBLIC = 85,                  /* "public"  */
+  YYSYMBOL_C_TEMPLATE = 86,                /* "template"  */
+  YYSYMBOL_C_THIS = 87,                    /* "this"  */
+  YYSYMBOL_C_THROW = 88,                   /* "throw"  */
+  YYSYMBOL_C_THROWIF = 89,                 /* "__throwifcaught"  */
+  YYSYMBOL_C_TRY = 90,                     /* "try"  */
+  YYSYMBOL_C_ALIGNL = 91,                  /* "alignl"  */
+  YYSYMBOL_C_ALIGNW = 92,                  /* "alignw"  */
+  YYSYMBOL_C_BYTE = 93,                    /* "byte"  */
+  YYSYMBOL_C_FILE = 94,                    /* "file"  */
+  YYSYMBOL_C_FIT = 95,                     /* "fit"  */
+  YYSYMBOL_C_ORG = 96,                     /* "org"  */
+  YYSYMBOL_C_ORGH = 97,                    /* "orgh"  */
+  YYSYMBOL_C_ORGF = 98,                    /* "orgf"  */
+  YYSYMBOL_C_RES = 99,                     /* "res"  */
+  YYSYMBOL_C_WORD = 100,                   /* "word"  */
+  YYSYMBOL_C_EOLN = 101,                   /* "end of line"  */
+  YYSYMBOL_C_FUNC = 102,                   /* "__func__ or __FUNCTION__"  */
+  YYSYMBOL_C_BUILTIN_ABS = 103,            /* "__builtin_abs"  */
+  YYSYMBOL_C_BUILTIN_CLZ = 104,            /* "__builtin_clz"  */
+  YYSYMBOL_C_BUILTIN_SQRT = 105,           /* "__builtin_sqrt"  */
+  YYSYMBOL_C_BUILTIN_FRAC = 106,           /* "__builtin_frac"  */
+  YYSYMBOL_C_BUILTIN_MULH = 107,           /* "__builtin_mulh"  */
+  YYSYMBOL_C_BUILTIN_MULUH = 108,          /* "__builtin_muluh"  */
+  YYSYMBOL_C_BUILTIN_ALLOCA = 109,         /* "__builtin_alloca"  */
+  YYSYMBOL_C_BUILTIN_COGSTART = 110,       /* "__builtin_cogstart"  */
+  YYSYMBOL_C_BUILTIN_EXPECT = 111,         /* "__builtin_expect"  */
+  YYSYMBOL_C_BUILTIN_PRINTF = 112,         /* "__builtin_printf"  */
+  YYSYMBOL_C_BUILTIN_REV = 113,            /* "__builtin_rev"  */
+  YYSYMBOL_C_BUILTIN_VA_START = 114,       /* "__builtin_va_start"  */
+  YYSYMBOL_C_BUILTIN_VA_ARG = 115,         /* "__builtin_va_arg"  */
+  YYSYMBOL_C_BUILTIN_SETJMP = 116,         /* "__builtin_setjmp"  */
+  YYSYMBOL_C_BUILTIN_LONGJMP = 117,        /* "__builtin_longjmp"  */
+  YYSYMBOL_C_EOF = 118,                    /* "end of file"  */
+  YYSYMBOL_119_ = 119,                     /* '$'  */
+  YYSYMBOL_120_ = 120,                     /* '('  */
+  YYSYMBOL_121_ = 121,                     /* ')'  */
+  YYSYMBOL_122_ = 122,                     /* '{'  */
+  YYSYMBOL_123_ = 123,                     /* '}'  */
+  YYSYMBOL_124_ = 124,                     /* ','  */
+  YYSYMBOL_125_ = 125,                     /* '['  */
+  YYSYMBOL_126_ = 126,                     /* ']'  */
+  YYSYMBOL_127_ = 127,                     /* '.'  */
+  YYSYMBOL_128_ = 128,                     /* '&'  */
+  YYSYMBOL_129_ = 129,                     /* '@'  */
+  YYSYMBOL_130_ = 130,                     /* '*'  */
+  YYSYMBOL_131_ = 131,                     /* '+'  */
+  YYSYMBOL_132_ = 132,                     /* '-'  */
+  YYSYMBOL_133_ = 133,                     /* '~'  */
+  YYSYMBOL_134_ = 134,                     /* '!'  */
+  YYSYMBOL_135_ = 135,                     /* '/'  */
+  YYSYMBOL_136_ = 136,                     /* '%'  */
+  YYSYMBOL_137_ = 137,                     /* '<'  */
+  YYSYMBOL_138_ = 138,                     /* '>'  */
+  YYSYMBOL_139_ = 139,                     /* '^'  */
+  YYSYMBOL_140_ = 140,                     /* '|'  */
+  YYSYMBOL_141_ = 141,                     /* '?'  */
+  YYSYMBOL_142_ = 142,                     /* ':'  */
+  YYSYMBOL_143_ = 143,                     /* '='  */
+  YYSYMBOL_144_ = 144,                     /* ';'  */
+  YYSYMBOL_145_ = 145,                     /* '#'  */
+  YYSYMBOL_146_ = 146,                     /* '\\'  */
+  YYSYMBOL_YYACCEPT = 147,                 /* $accept  */
+  YYSYMBOL_primary_expression = 148,       /* primary_expression  */
+  YYSYMBOL_postfix_expression = 149,       /* postfix_expression  */
+  YYSYMBOL_argument_expression_list = 150, /* argument_expression_list  */
+  YYSYMBOL_unary_expression = 151,         /* unary_expression  */
+  YYSYMBOL_unary_operator = 152,           /* unary_operator  */
+  YYSYMBOL_cast_expression = 153,          /* cast_expression  */
+  YYSYMBOL_multiplicative_expression = 154, /* multiplicative_expression  */
+  YYSYMBOL_additive_expression = 155,      /* additive_expression  */
+  YYSYMBOL_shift_expression = 156,         /* shift_expression  */
+  YYSYMBOL_relational_expression = 157,    /* relational_expression  */
+  YYSYMBOL_equality_expression = 158,      /* equality_expression  */
+  YYSYMBOL_and_expression = 159,           /* and_expression  */
+  YYSYMBOL_exclusive_or_expression = 160,  /* exclusive_or_expression  */
+  YYSYMBOL_inclusive_or_expression = 161,  /* inclusive_or_expression  */
+  YYSYMBOL_logical_and_expression = 162,   /* logical_and_expression  */
+  YYSYMBOL_logical_or_expression = 163,    /* logical_or_expression  */
+  YYSYMBOL_conditional_expression = 164,   /* conditional_expression  */
+  YYSYMBOL_assignment_expression = 165,    /* assignment_expression  */
+  YYSYMBOL_assignment_operator = 166,      /* assignment_operator  */
+  YYSYMBOL_expression = 167,               /* expression  */
+  YYSYMBOL_constant_expression = 168,      /* constant_expression  */
+  YYSYMBOL_declaration = 169,              /* declaration  */
+  YYSYMBOL_declaration_specifiers = 170,   /* declaration_specifiers  */
+  YYSYMBOL_reset_identifier_expectation = 171, /* reset_identifier_expectation  */
+  YYSYMBOL_init_declarator_list = 172,     /* init_declarator_list  */
+  YYSYMBOL_init_declarator = 173,          /* init_declarator  */
+  YYSYMBOL_storage_class_specifier = 174,  /* storage_class_specifier  */
+  YYSYMBOL_type_specifier = 175,           /* type_specifier  */
+  YYSYMBOL_struct_or_union_specifier = 176, /* struct_or_union_specifier  */
+  YYSYMBOL_any_identifier = 177,           /* any_identifier  */
+  YYSYMBOL_struct_or_union = 178,          /* struct_or_union  */
+  YYSYMBOL_fromfile_clause = 179,          /* fromfile_clause  */
+  YYSYMBOL_struct_open = 180,              /* struct_open  */
+  YYSYMBOL_struct_close = 181,             /* struct_close  */
+  YYSYMBOL_struct_declaration_list = 182,  /* struct_declaration_list  */
+  YYSYMBOL_struct_declaration = 183,       /* struct_declaration  */
+  YYSYMBOL_struct_specifier_qualifier_list = 184, /* struct_specifier_qualifier_list  */
+  YYSYMBOL_specifier_qualifier_list = 185, /* specifier_qualifier_list  */
+  YYSYMBOL_struct_declarator_list = 186,   /* struct_declarator_list  */
+  YYSYMBOL_struct_declarator = 187,        /* struct_declarator  */
+  YYSYMBOL_enum_specifier = 188,           /* enum_specifier  */
+  YYSYMBOL_enumerator_list = 189,          /* enumerator_list  */
+  YYSYMBOL_enumerator = 190,               /* enumerator  */
+  YYSYMBOL_type_qualifier = 191,           /* type_qualifier  */
+  YYSYMBOL_declarator = 192,               /* declarator  */
+  YYSYMBOL_direct_declarator = 193,        /* direct_declarator  */
+  YYSYMBOL_pointer = 194,                  /* pointer  */
+  YYSYMBOL_type_qualifier_list = 195,      /* type_qualifier_list  */
+  YYSYMBOL_parameter_type_list = 196,      /* parameter_type_list  */
+  YYSYMBOL_parameter_list = 197,           /* parameter_list  */
+  YYSYMBOL_raw_parameter_declaration = 198, /* raw_parameter_declaration  */
+  YYSYMBOL_parameter_declaration = 199,    /* parameter_declaration  */
+  YYSYMBOL_opt_param_default = 200,        /* opt_param_default  */
+  YYSYMBOL_identifier_list = 201,          /* identifier_list  */
+  YYSYMBOL_type_name = 202,                /* type_name  */
+  YYSYMBOL_abstract_declarator = 203,      /* abstract_declarator  */
+  YYSYMBOL_direct_abstract_declarator = 204, /* direct_abstract_declarator  */
+  YYSYMBOL_initializer = 205,              /* initializer  */
+  YYSYMBOL_initializer_list = 206,         /* initializer_list  */
+  YYSYMBOL_designation = 207,              /* designation  */
+  YYSYMBOL_designator_list = 208,          /* designator_list  */
+  YYSYMBOL_designator = 209,               /* designator  */
+  YYSYMBOL_statement = 210,                /* statement  */
+  YYSYMBOL_labeled_statement = 211,        /* labeled_statement  */
+  YYSYMBOL_compound_statement = 212,       /* compound_statement  */
+  YYSYMBOL_compound_statement_open = 213,  /* compound_statement_open  */
+  YYSYMBOL_compound_statement_close = 214, /* compound_statement_close  */
+  YYSYMBOL_for_statement_start = 215,      /* for_statement_start  */
+  YYSYMBOL_block_item_list = 216,          /* block_item_list  */
+  YYSYMBOL_block_item = 217,               /* block_item  */
+  YYSYMBOL_asm_statement = 218,            /* asm_statement  */
+  YYSYMBOL_opt_asm_volatile = 219,         /* opt_asm_volatile  */
+  YYSYMBOL_top_asm = 220,                  /* top_asm  */
+  YYSYMBOL_asmlist = 221,                  /* asmlist  */
+  YYSYMBOL_asmline = 222,                  /* asmline  */
+  YYSYMBOL_asm_eoln = 223,                 /* asm_eoln  */
+  YYSYMBOL_asm_baseline = 224,             /* asm_baseline  */
+  YYSYMBOL_asm_operand = 225,              /* asm_operand  */
+  YYSYMBOL_asm_operandlist = 226,          /* asm_operandlist  */
+  YYSYMBOL_asmexpr = 227,                  /* asmexpr  */
+  YYSYMBOL_instruction = 228,              /* instruction  */
+  YYSYMBOL_instrmodifier = 229,            /* instrmodifier  */
+  YYSYMBOL_modifierlist = 230,             /* modifierlist  */
+  YYSYMBOL_func_declaration_list = 231,    /* func_declaration_list  */
+  YYSYMBOL_declaration_list = 232,         /* declaration_list  */
+  YYSYMBOL_expression_statement = 233,     /* expression_statement  */
+  YYSYMBOL_selection_statement = 234,      /* selection_statement  */
+  YYSYMBOL_iteration_statement = 235,      /* iteration_statement  */
+  YYSYMBOL_for_declaration = 236,          /* for_declaration  */
+  YYSYMBOL_jump_statement = 237,           /* jump_statement  */
+  YYSYMBOL_try_statement = 238,            /* try_statement  */
+  YYSYMBOL_handler_sequence = 239,         /* handler_sequence  */
+  YYSYMBOL_handler_item = 240,             /* handler_item  */
+  YYSYMBOL_push_current_types = 241,       /* push_current_types  */
+  YYSYMBOL_pop_current_types = 242,        /* pop_current_types  */
+  YYSYMBOL_handler_declarator = 243,       /* handler_declarator  */
+  YYSYMBOL_translation_unit = 244,         /* translation_unit  */
+  YYSYMBOL_external_declaration = 245,     /* external_declaration  */
+  YYSYMBOL_function_definition = 246,      /* function_definition  */
+  YYSYMBOL_attribute_decl = 247,           /* attribute_decl  */
+  YYSYMBOL_fromfile_decl = 248,            /* fromfile_decl  */
+  YYSYMBOL_compound_statement_or_fromfile = 249, /* compound_statement_or_fromfile  */
+  YYSYMBOL_top_pasm = 250,                 /* top_pasm  */
+  YYSYMBOL_pasmlist = 251,                 /* pasmlist  */
+  YYSYMBOL_pasmline = 252,                 /* pasmline  */
+  YYSYMBOL_pasm_baseline = 253,            /* pasm_baseline  */
+  YYSYMBOL_pasm_operand = 254,             /* pasm_operand  */
+  YYSYMBOL_pasm_operandlist = 255,         /* pasm_operandlist  */
+  YYSYMBOL_optpasmrange = 256,             /* optpasmrange  */
+  YYSYMBOL_pasmatom = 257,                 /* pasmatom  */
+  YYSYMBOL_pasmunary = 258,                /* pasmunary  */
+  YYSYMBOL_pasm_e1 = 259,                  /* pasm_e1  */
+  YYSYMBOL_pasm_e2 = 260,                  /* pasm_e2  */
+  YYSYMBOL_pasm_e3 = 261,                  /* pasm_e3  */
+  YYSYMBOL_pasm_e4 = 262,                  /* pasm_e4  */
+  YYSYMBOL_pasm_e5 = 263,                  /* pasm_e5  */
+  YYSYMBOL_pasm_e6 = 264,                  /* pasm_e6  */
+  YYSYMBOL_pasm_e7 = 265,                  /* pasm_e7  */
+  YYSYMBOL_pasmexpr = 266                  /* pasmexpr  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if 1
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* 1 */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined CGRAMYYSTYPE_IS_TRIVIAL && CGRAMYYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  92
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   4240
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  147
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  120
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  428
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  770
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   373
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_uint8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,   134,     2,   145,   119,   136,   128,     2,
+     120,   121,   130,   131,   124,   132,   127,   135,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,   142,   144,
+     137,   143,   138,   141,   129,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,   125,   146,   126,   139,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,   122,   140,   123,   133,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,   117,   118
+};
+
+#if CGRAMYYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   967,   967,   969,   971,   973,   975,   977,   979,   981,
+     983,   985,   987,   989,   991,   996,   998,  1000,  1006,  1008,
+    1034,  1057,  1080,  1103,  1107,  1112,  1116,  1118,  1126,  1128,
+    1132,  1134,  1136,  1138,  1140,  1145,  1147,  1149,  1166,  1183,
+    1185,  1190,  1192,  1194,  1196,  1204,  1206,  1211,  1213,  1215,
+    1217,  1219,  1221,  1223,  1228,  1230,  1242,  1244,  1246,  1248,
+    1253,  1255,  1257,  1262,  1264,  1266,  1271,  1273,  1275,  1277,
+    1279,  1284,  1286,  1288,  1293,  1295,  1300,  1302,  1307,  1309,
+    1314,  1316,  1321,  1323,  1328,  1330,  1335,  1337,  1342,  1344,
+    1346,  1348,  1350,  1352,  1354,  1356,  1358,  1360,  1362,  1367,
+    1369,  1374,  1379,  1381,  1388,  1390,  1396,  1398,  1400,  1402,
+    1408,  1412,  1414,  1419,  1421,  1426,  1428,  1430,  1432,  1434,
+    1436,  1441,  1443,  1445,  1447,  1449,  1451,  1460,  1462,  1464,
+    1473,  1475,  1477,  1479,  1490,  1502,  1509,  1511,  1516,  1518,
+    1522,  1528,  1534,  1539,  1550,  1561,  1575,  1581,  1583,  1588,
+    1603,  1607,  1612,  1617,  1644,  1646,  1648,  1650,  1652,  1661,
+    1663,  1665,  1667,  1672,  1674,  1679,  1681,  1683,  1690,  1692,
+    1694,  1696,  1698,  1703,  1705,  1710,  1712,  1722,  1724,  1726,
+    1731,  1733,  1738,  1740,  1746,  1748,  1750,  1752,  1754,  1756,
+    1761,  1763,  1767,  1769,  1777,  1779,  1783,  1785,  1796,  1798,
+    1804,  1806,  1815,  1817,  1822,  1824,  1826,  1830,  1838,  1841,
+    1845,  1847,  1852,  1854,  1859,  1861,  1863,  1868,  1870,  1872,
+    1874,  1876,  1878,  1880,  1882,  1884,  1889,  1891,  1893,  1898,
+    1903,  1913,  1920,  1934,  1943,  1945,  1955,  1957,  1962,  1963,
+    1964,  1965,  1966,  1967,  1968,  1969,  1973,  1979,  1986,  1993,
+    2000,  2002,  2007,  2012,  2017,  2022,  2024,  2029,  2034,  2039,
+    2046,  2057,  2058,  2060,  2065,  2067,  2072,  2074,  2079,  2080,
+    2097,  2098,  2102,  2104,  2106,  2108,  2110,  2112,  2114,  2116,
+    2118,  2120,  2122,  2124,  2126,  2128,  2130,  2132,  2134,  2136,
+    2138,  2140,  2142,  2144,  2146,  2151,  2153,  2155,  2157,  2162,
+    2164,  2169,  2171,  2176,  2178,  2183,  2188,  2190,  2192,  2197,
+    2199,  2204,  2206,  2211,  2213,  2218,  2221,  2225,  2232,  2236,
+    2240,  2257,  2274,  2294,  2316,  2321,  2323,  2325,  2327,  2329,
+    2331,  2333,  2348,  2379,  2381,  2389,  2399,  2402,  2406,  2411,
+    2420,  2421,  2425,  2426,  2427,  2428,  2433,  2450,  2466,  2482,
+    2500,  2505,  2509,  2520,  2521,  2526,  2528,  2533,  2535,  2540,
+    2541,  2558,  2560,  2562,  2564,  2566,  2568,  2570,  2572,  2574,
+    2576,  2578,  2580,  2582,  2584,  2586,  2588,  2590,  2592,  2594,
+    2596,  2598,  2600,  2602,  2607,  2609,  2611,  2618,  2620,  2625,
+    2627,  2630,  2634,  2636,  2638,  2640,  2655,  2657,  2659,  2661,
+    2663,  2668,  2670,  2672,  2677,  2679,  2681,  2685,  2687,  2691,
+    2693,  2695,  2699,  2701,  2703,  2705,  2709,  2711,  2713,  2717,
+    2719,  2721,  2725,  2727,  2729,  2731,  2733,  2738,  2740
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if 1
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "\"identifier\"",
+  "\"constant\"", "\"string literal\"", "\"sizeof\"", "\"typeof\"",
+  "\"->\"", "\"++\"", "\"--\"", "\"<<\"", "\">>\"", "\"<=\"", "\">=\"",
+  "\"==\"", "\"!=\"", "\"&&\"", "\"||\"", "\"*=\"", "\"/=\"", "\"%=\"",
+  "\"+=\"", "\"-=\"", "\"<<=\"", "\">>=\"", "\"&=\"", "\"^=\"", "\"|=\"",
+  "\"type name\"", "\"#<\"", "\"#>\"", "\"typedef\"", "\"extern\"",
+  "\"static\"", "\"auto\"", "\"register\"", "\"__restrict\"", "\"_Bool\"",
+  "\"char\"", "\"short\"", "\"_Imaginary\"", "\"inline\"", "\"int\"",
+  "\"long\"", "\"signed\"", "\"unsigned\"", "\"float\"", "\"double\"",
+  "\"const\"", "\"volatile\"", "\"void\"", "\"struct\"", "\"union\"",
+  "\"enum\"", "\"...\"", "\"::\"", "\"case\"", "\"default\"", "\"if\"",
+  "\"else\"", "\"switch\"", "\"while\"", "\"do\"", "\"for\"", "\"goto\"",
+  "\"continue\"", "\"break\"", "\"return\"", "\"__fromfile\"",
+  "\"__using\"", "\"__attribute__\"", "\"__asm\"", "\"__pasm\"",
+  "\"asm instruction\"", "\"instruction modifier\"",
+  "\"hardware register\"", "\"catch\"", "\"class\"", "\"delete\"",
+  "\"false\"", "\"new\"", "\"nullptr\"", "\"true\"", "\"private\"",
+  "\"public\"", "\"template\"", "\"this\"", "\"throw\"",
+  "\"__throwifcaught\"", "\"try\"", "\"alignl\"", "\"alignw\"", "\"byte\"",
+  "\"file\"", "\"fit\"", "\"org\"", "\"orgh\"", "\"orgf\"", "\"res\"",
+  "\"word\"", "\"end of line\"", "\"__func__ or __FUNCTION__\"",
+  "\"__builtin_abs\"", "\"__builtin_clz\"", "\"__builtin_sqrt\"",
+  "\"__builtin_frac\"", "\"__builtin_mulh\"", "\"__builtin_muluh\"",
+  "\"__builtin_alloca\"", "\"__builtin_cogstart\"", "\"__builtin_expect\"",
+  "\"__builtin_printf\"", "\"__builtin_rev\"", "\"__builtin_va_start\"",
+  "\"__builtin_va_arg\"", "\"__builtin_setjmp\"", "\"__builtin_longjmp\"",
+  "\"end of file\"", "'$'", "'('", "')'", "'{'", "'}'", "','", "'['",
+  "']'", "'.'", "'&'", "'@'", "'*'", "'+'", "'-'", "'~'", "'!'", "'/'",
+  "'%'", "'<'", "'>'", "'^'", "'|'", "'?'", "':'", "'='", "';'", "'#'",
+  "'\\\\'", "$accept", "primary_expression", "postfix_expression",
+  "argument_expression_list", "unary_expression", "unary_operator",
+  "cast_expression", "multiplicative_expression", "additive_expression",
+  "shift_expression", "relational_expression", "equality_expression",
+  "and_expression", "exclusive_or_expression", "inclusive_or_expression",
+  "logical_and_expression", "logical_or_expression",
+  "conditional_expression", "assignment_expression", "assignment_operator",
+  "expression", "constant_expression", "declaration",
+  "declaration_specifiers", "reset_identifier_expectation",
+  "init_declarator_list", "init_declarator", "storage_class_specifier",
+  "type_specifier", "struct_or_union_specifier", "any_identifier",
+  "struct_or_union", "fromfile_clause", "struct_open", "struct_close",
+  "struct_declaration_list", "struct_declaration",
+  "struct_specifier_qualifier_list", "specifier_qualifier_list",
+  "struct_declarator_list", "struct_declarator", "enum_specifier",
+  "enumerator_list", "enumerator", "type_qualifier", "declarator",
+  "direct_declarator", "pointer", "type_qualifier_list",
+  "parameter_type_list", "parameter_list", "raw_parameter_declaration",
+  "parameter_declaration", "opt_param_default", "identifier_list",
+  "type_name", "abstract_declarator", "direct_abstract_declarator",
+  "initializer", "initializer_list", "designation", "designator_list",
+  "designator", "statement", "labeled_statement", "compound_statement",
+  "compound_statement_open", "compound_statement_close",
+  "for_statement_start", "block_item_list", "block_item", "asm_statement",
+  "opt_asm_volatile", "top_asm", "asmlist", "asmline", "asm_eoln",
+  "asm_baseline", "asm_operand", "asm_operandlist", "asmexpr",
+  "instruction", "instrmodifier", "modifierlist", "func_declaration_list",
+  "declaration_list", "expression_statement", "selection_statement",
+  "iteration_statement", "for_declaration", "jump_statement",
+  "try_statement", "handler_sequence", "handler_item",
+  "push_current_types", "pop_current_types", "handler_declarator",
+  "translation_unit", "external_declaration", "function_definition",
+  "attribute_decl", "fromfile_decl", "compound_statement_or_fromfile",
+  "top_pasm", "pasmlist", "pasmline", "pasm_baseline", "pasm_operand",
+  "pasm_operandlist", "optpasmrange", "pasmatom", "pasmunary", "pasm_e1",
+  "pasm_e2", "pasm_e3", "pasm_e4", "pasm_e5", "pasm_e6", "pasm_e7",
+  "pasmexpr", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-585)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-352)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+    3555,    39,    75,  -585,  -585,  -585,  -585,  -585,  -585,  -585,
+    -585,  -585,  -585,  -585,  -585,  -585,  -585,  -585,  -585,  -585,
+    -585,  -585,  -585,  -585,  -585,    48,   166,   175,  -585,   120,
+     216,   216,  -585,    24,  4066,  -585,  -585,   112,  3864,  -585,
+    4066,  3918,    88,    27,  -585,  3502,  -585,  -585,  -585,    69,
+    3240,  -585,  -585,   209,    63,    96,  1326,   102,  1359,    40,
+    -585,  -585,   216,  -585,   216,  -585,   -25,  -585,  2324,  -585,
+    4066,   110,  -585,   153,  4114,    99,   131,  4162,  3762,  -585,
+      29,  4114,  -585,  -585,    21,    24,    65,  4066,    65,  3712,
+    2664,    88,  -585,  -585,  -585,  -585,  -585,  -585,  3299,  3240,
+    3240,  -585,  -585,  -585,  -585,  -585,  -585,   190,   194,   221,
+     231,   244,   256,   259,   288,   303,  -585,   319,   321,   326,
+     332,   338,  -585,  2376,  -585,  -585,  -585,  -585,  -585,  -585,
+    -585,  -585,   320,   342,  3384,   327,     3,  -585,   209,  1326,
+     -57,  1387,   785,  -585,  -585,   -57,   -57,   785,   467,   870,
+     870,   870,  1075,  1075,   785,  -585,  -585,   337,  -585,  -585,
+    -585,   618,   183,  1359,   -57,  1398,   422,   -57,   -57,   422,
+     477,  1135,  1135,  1135,  1440,  1440,   422,  -585,  1401,   617,
+    -585,  -585,  -585,  -585,  -585,  -585,   120,  -585,  2723,   362,
+      65,  -585,   489,  -585,  -585,  -585,  -585,  -585,  4162,  -585,
+    4162,  -585,  -585,  3384,  -585,   169,  -585,   354,  -585,   357,
+     386,  -585,  -585,  1578,  -585,  -585,   152,  -585,  -585,  -585,
+     119,   383,   426,   387,  -585,   236,  2376,  -585,  -585,  -585,
+     182,   189,   510,    41,   509,   427,   420,   433,   565,    15,
+    -585,   459,  2376,  -585,  -585,  -585,  3384,  3384,  3384,  3384,
+    3384,  3384,  3384,  3384,  3384,  3384,  3240,  3384,  3384,  3384,
+    1842,   612,  -585,  -585,   280,   228,   466,    49,  -585,  -585,
+    2808,  3384,    49,  -585,  -585,  3384,  -585,    14,   403,  1149,
+    -585,  -585,   930,  3384,  -585,  -585,  -585,   154,   463,  -585,
+    -585,  -585,   154,   -57,  -585,   -57,  -585,   -57,  -585,   -57,
+     -57,   -57,  -585,   154,  -585,  -585,  -585,   145,  -585,   158,
+    -585,  1209,  -585,  -585,  -585,  -585,  -585,   464,  -585,  1440,
+     588,   835,   835,   699,  1440,  -585,  -585,   159,   519,  -585,
+     522,   468,   396,   224,   406,   513,   125,  -585,  -585,  -585,
+    -585,   159,   -57,  -585,   -57,  -585,   -57,  -585,   -57,   -57,
+     -57,  -585,   159,  -585,   158,   163,  -585,  -585,  -585,  2579,
+    -585,  -585,  -585,  -585,   471,  -585,  -585,  -585,  -585,    95,
+    -585,  -585,  3384,   589,   453,   455,  3384,   456,   479,   480,
+     481,  2063,  -585,    49,   460,   461,  2151,   490,  3384,  3384,
+     362,  -585,  -585,   148,  -585,   469,  -585,  -585,  -585,  -585,
+     483,  1578,  -585,  -585,  -585,  -585,  -585,  -585,  -585,  3608,
+    2867,  -585,    66,  -585,   253,  -585,  3966,  3384,  -585,  -585,
+     603,   488,  3384,  3384,  3384,  3384,  3384,  3384,  3384,  3384,
+    3384,  3384,  3384,  3384,  3384,  3384,  3384,  3384,  3384,  3384,
+    3384,  -585,   492,   493,   495,   498,   289,  -585,   293,   294,
+     504,   350,   486,   367,   502,   517,   508,   518,  1710,  -585,
+    -585,  -585,  -585,  -585,  -585,  -585,  -585,  -585,  -585,  -585,
+    3384,  -585,  3384,  3659,   255,  -585,   521,  -585,  -585,   368,
+     -38,  -585,  -585,  -585,  -585,  -585,    46,  -585,  1075,  -585,
+    -585,  1015,  -585,  1075,  -585,  -585,  -585,  -585,  -585,  -585,
+    -585,  -585,  -585,   158,   571,  -585,  -585,  -585,  1393,  -585,
+     527,  -585,  -585,  -585,  1440,  -585,  -585,  1432,  -585,  -585,
+    -585,   835,   835,   835,   835,   835,   835,   330,   835,   835,
+     835,   835,   835,   835,   835,   835,  -585,  -585,  -585,  -585,
+    -585,  -585,  -585,  -585,  -585,  -585,   158,  3384,    49,  -585,
+     434,  2723,   225,  -585,  -585,  -585,  -585,   528,    16,  2063,
+    3384,  3384,  3384,   591,   516,  -585,  -585,  -585,   160,  -585,
+    -585,   184,   171,   195,   580,  -585,  2063,  1974,  -585,  -585,
+    -585,   541,   542,  -585,   538,   253,  3816,  2952,  -585,  -585,
+    -585,  -585,  3011,  -585,  -585,  -585,   182,   182,   189,   189,
+     510,   510,   510,   510,    41,    41,   509,   427,   420,   433,
+     565,   -62,   521,  -585,  -585,  -585,  -585,  3384,  -585,  -585,
+    -585,  -585,  3384,  -585,   664,  4162,  -585,  3384,   554,  -585,
+    -585,  2579,  -585,  -585,  -585,  -585,  -585,   556,  -585,  -585,
+     540,   560,  -585,  -585,  -585,  -585,  -585,   522,   468,   468,
+     396,   835,   396,   224,   224,   406,   406,   513,   513,   513,
+     513,  -585,   562,  -585,  -585,  2435,  -585,  -585,  -585,   545,
+    3384,  2063,  -585,   369,   384,   389,   570,  -585,  -585,   573,
+    1326,  -585,  -585,  -585,   580,  -585,  -585,  -585,  2210,  2210,
+    -585,  -585,  -585,  -585,   575,  -585,   581,  -585,  3384,  -585,
+     576,   578,   585,   615,  -585,   438,  -585,  1440,  -585,   396,
+    -585,  -585,  -585,  2723,  -585,   597,  -585,  2063,  2063,  2063,
+    3384,  1326,  1224,   621,  -585,  3096,  3155,  -585,  -585,  -585,
+    -585,  -585,  -585,  -585,  -585,  2520,   616,  -585,  2063,   683,
+    -585,  -585,   391,  1284,  -585,  4016,  2063,   393,  2063,   395,
+    -585,  -585,  -585,  2063,   600,  -585,  -585,  -585,   632,  -585,
+    2063,  -585,  2063,  -585,  -585,   362,  -585,  -585,  -585,  -585
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
+{
+       0,   182,     0,   133,   115,   116,   117,   118,   120,   179,
+     123,   122,   124,   119,   125,   126,   129,   130,   127,   128,
+     177,   178,   121,   140,   142,     0,     0,     0,   141,     0,
+     194,   190,   345,     0,   104,   110,   131,     0,     0,   132,
+     108,   351,   181,     0,   343,     0,   340,   342,   344,     0,
+       0,   138,   139,     0,   172,     0,     0,     0,     0,     0,
+     198,   196,   195,   192,   191,   102,     0,   111,   113,   105,
+     106,     0,   145,   136,     0,     0,     0,   155,     0,   147,
+       0,   157,   109,   350,   311,     0,     0,     0,     0,     0,
+       0,   180,     1,   341,   183,     2,     3,     9,     0,     0,
+       0,     4,     7,     8,     6,     5,    10,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    11,     0,     0,     0,
+       0,     0,    12,     0,    47,    48,    49,    50,    51,    52,
+      53,    15,    41,     0,     0,   175,     0,   173,     0,     0,
+       0,     0,     0,   303,   305,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   270,   271,     0,   266,   272,
+     268,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   361,     0,     0,
+     357,   359,   184,   199,   197,   193,     0,   103,     0,     0,
+       0,   107,     0,   137,   144,   158,   152,   151,   160,   154,
+     162,   146,   148,     0,   149,     0,   163,   165,   156,   113,
+       0,   252,   354,     0,   353,   348,   312,   349,   210,   189,
+     206,     0,   200,   209,   202,     0,     0,   186,    54,    56,
+      60,    63,    66,    71,    74,    76,    78,    80,    82,    84,
+     101,     0,     0,    46,    42,    43,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    54,    86,    99,     0,   212,     0,     0,    35,    36,
+       0,     0,     0,   134,    44,     0,   168,     0,     0,     0,
+     273,   269,     0,     0,   301,   278,   299,     0,   295,   284,
+     285,   274,     0,     0,   293,     0,   286,     0,   288,     0,
+       0,     0,   276,     0,   264,   267,   280,     0,   306,     0,
+     304,     0,   362,   360,   392,   393,   396,   391,   394,     0,
+       0,     0,     0,     0,     0,   367,   387,     0,   401,   404,
+     407,   409,   412,   416,   419,   422,   427,   384,   373,   374,
+     363,     0,     0,   382,     0,   375,     0,   377,     0,     0,
+       0,   365,     0,   369,     0,     0,   355,   358,   112,     0,
+     226,   114,   346,   347,     0,   159,   161,   135,   166,     0,
+     150,   153,     0,     0,     2,   133,     0,     0,     0,     0,
+       0,     0,   254,     0,     0,     0,     0,   261,     0,     0,
+       0,   253,   313,     0,   257,     0,   258,   238,   239,   250,
+       0,     0,   255,   244,   240,   241,   242,   243,   245,     0,
+       0,   204,   214,   205,   215,   187,     0,     0,   207,   188,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   185,     0,     0,     0,     0,     0,    39,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    89,
+      90,    91,    92,    93,    94,    95,    96,    97,    98,    88,
+       0,    13,     0,     0,   214,   213,     0,    34,    31,     0,
+       0,    33,   176,   170,   174,   169,     0,   265,     0,   296,
+     302,     0,   279,     0,   275,   294,   292,   287,   289,   290,
+     291,   277,   281,     0,     0,   282,   307,   356,     0,   395,
+       0,   397,   402,   403,     0,   385,   428,     0,   368,   399,
+     400,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   364,   383,   381,   376,
+     378,   379,   380,   366,   371,   370,     0,     0,     0,   229,
+       0,     0,     0,   234,   143,   164,   167,     0,     0,     0,
+       0,     0,     0,     0,     0,   326,   327,   328,     0,   263,
+     262,     0,     0,     0,     0,   314,     0,     0,   251,   256,
+     222,     0,     0,   218,     0,   216,     0,     0,   201,   203,
+     208,   211,     0,    57,    58,    59,    61,    62,    64,    65,
+      69,    70,    67,    68,    72,    73,    75,    77,    79,    81,
+      83,     0,    45,    16,    17,    18,    20,     0,    22,    21,
+      26,    27,     0,    19,     0,     0,    25,     0,     0,    87,
+     100,     0,    32,    30,   171,   297,   300,     0,   283,   308,
+       0,     0,   398,   386,   388,   405,   406,   408,   411,   410,
+     413,     0,   414,   417,   418,   420,   421,   425,   426,   424,
+     423,   372,     0,   237,   227,     0,   230,   233,   235,     0,
+       0,     0,   249,     0,     0,     0,     0,   325,   329,     0,
+       0,   330,   331,   336,   332,   333,   246,   324,     0,     0,
+     223,   217,   219,   224,     0,   220,     0,    55,     0,    40,
+       0,     0,     0,     0,    14,     0,   298,     0,   389,   415,
+     236,   228,   231,     0,   352,     0,   248,     0,     0,     0,
+       0,     0,     0,     0,   334,     0,     0,   225,   221,    85,
+      28,    23,    24,    29,    37,     0,     0,   232,     0,   315,
+     317,   318,     0,     0,   259,     0,     0,     0,     0,     0,
+      38,   390,   247,     0,     0,   260,   339,   338,     0,   320,
+       0,   322,     0,   316,   319,     0,   321,   323,   337,   335
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -585,  -585,  -585,    92,   -40,  -585,  -123,   139,   118,    25,
+     137,   322,   318,   323,   328,   317,  -585,   -86,   -48,  -585,
+    -118,  -184,    38,     0,  -585,  -585,   572,  -585,    19,  -585,
+     -16,  -585,  -585,  -585,  -585,  -585,   681,   109,   -24,  -585,
+     398,  -585,   627,  -259,    54,   151,   -12,    12,   737,   -87,
+    -585,    26,   353,  -585,  -585,  -206,   -84,  -373,  -182,   141,
+    -584,  -585,   218,  -251,  -585,   -85,  -585,   372,  -585,   514,
+    -355,  -585,  -585,  -585,  -131,  -150,   505,   635,   286,   162,
+    -127,   -17,   -28,  -141,   710,  -585,  -495,  -585,  -585,  -585,
+    -585,  -585,  -585,    97,  -585,  -585,  -585,  -585,   734,  -585,
+     712,  -585,   -15,  -585,   619,  -144,   620,   266,   196,  -585,
+    -585,  -293,   261,    51,  -479,    52,    47,   -55,  -585,  -159
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,   131,   132,   446,   261,   134,   229,   230,   231,   232,
+     233,   234,   235,   236,   237,   238,   239,   262,   263,   470,
+     393,   241,   394,    85,    70,    66,    67,    34,    35,    36,
+     395,    37,   193,    38,   367,    78,    79,    80,   265,   205,
+     206,    39,   136,   137,    40,    41,    42,    43,    62,   581,
+     222,   223,   224,   418,   225,   266,   582,   414,   549,   550,
+     551,   552,   553,   396,   397,   398,   213,   399,   400,   401,
+     402,   403,   571,    44,   157,   158,   159,   160,   286,   287,
+     288,   161,   162,   309,    86,    87,   404,   405,   406,   689,
+     407,   408,   684,   685,   723,   769,   758,    45,    46,    47,
+      88,   214,   215,    48,   179,   180,   181,   326,   327,   509,
+     328,   329,   330,   331,   332,   333,   334,   335,   336,   337
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+      33,   212,   221,   212,   240,   264,   361,   305,   279,    54,
+     133,   274,   344,   346,   348,   349,   350,   135,   484,   368,
+     421,    73,   295,   297,   299,   300,   301,     1,   512,   513,
+       1,    91,     1,   439,    69,   357,   442,   354,    32,   585,
+      82,   178,    61,    63,   155,    33,   579,   650,   652,   135,
+     228,    51,    51,   199,   429,   430,   284,    77,   243,   244,
+     245,   284,   472,   284,   284,   284,   284,   284,   284,     1,
+     191,   670,    94,   217,   184,   284,   185,    52,    52,    84,
+     698,   713,   688,    32,    60,    60,   472,   156,   633,   220,
+    -309,   482,    81,    77,   228,    49,   198,    77,     1,   186,
+      77,   585,   228,   579,   362,   212,    84,   228,   264,   228,
+     228,   228,   228,   228,   228,    51,   183,   240,   183,   187,
+     371,   228,     1,     1,   264,   216,   276,   277,    81,   305,
+     563,   200,    81,   308,   210,    81,   413,   483,   532,   533,
+     360,    52,   198,  -309,    29,   310,   178,    29,   178,    29,
+     308,   713,    30,   480,    31,   489,   440,    30,   671,    31,
+     510,   182,   178,   228,   515,   516,   503,   357,    65,   634,
+      53,   203,   709,   204,   365,   363,   366,   200,   431,   432,
+      59,   475,    71,   195,    68,   138,   409,   211,   556,   240,
+     208,   410,   558,   725,   726,    50,   284,   490,   443,   444,
+     445,   447,   447,   447,   450,   447,   452,   447,    89,   455,
+     456,   457,   135,    90,   546,    29,   454,   198,   139,   198,
+     144,  -310,   447,    30,   163,    31,   584,   484,   645,   646,
+     192,   207,   412,   144,    72,   228,   209,   203,   144,   409,
+      29,   196,   228,   228,   410,   198,   155,    30,    30,    31,
+      31,   477,   200,     9,   200,   155,   481,   143,   144,   155,
+     155,   198,   534,   535,   155,    20,    21,    55,   568,   491,
+     572,   573,   472,   197,  -310,   194,    57,   474,   491,   308,
+     200,   506,   504,   517,   472,   679,   240,   517,    56,   156,
+     240,   211,   575,   369,   178,   472,   200,    58,   156,   593,
+     594,   595,   156,   156,   678,   574,   680,   156,   672,   292,
+     246,   360,   422,   370,   247,   681,   303,   423,   424,   472,
+     425,   426,   611,   307,   240,   686,   506,   308,   267,   268,
+     269,   590,   228,   314,   315,   316,   228,   209,   140,   682,
+     141,   248,   448,   449,    30,   451,    31,   453,   473,   641,
+     547,   249,   548,   410,   526,   643,    30,   419,    31,   527,
+     420,   635,   479,   662,   250,   341,   637,   564,   667,   666,
+     228,   411,   352,   586,   355,   473,   251,   228,   587,   252,
+     410,   142,   228,   228,   228,   228,   228,   228,   228,   228,
+     228,   228,   228,   228,   228,   228,   228,   228,   228,   228,
+      91,   471,   284,   696,   472,   284,   317,   284,   253,   220,
+     616,   143,   144,   617,   618,   619,   220,   617,   617,   702,
+     716,   412,   629,   254,   630,   314,   315,   316,   145,   146,
+     147,   148,   149,   150,   151,   152,   153,   154,   155,   255,
+     270,   256,   673,   674,   675,   271,   257,   272,   228,   318,
+     319,   228,   258,   228,   600,   601,   602,   603,   259,   320,
+     304,   240,   321,   273,   322,   651,   739,   740,   741,   697,
+     275,   621,   293,   220,   617,   506,   639,   657,   658,   659,
+     660,   156,   342,   712,   211,   474,   715,   752,   623,   632,
+     717,   617,   617,   472,   364,   759,   372,   761,   317,   694,
+     188,   240,   763,   360,   415,   718,   373,   228,   472,   766,
+     719,   767,   754,   472,   760,   472,   762,   472,   506,   472,
+     207,   427,   428,   155,   433,   434,   485,   486,   519,   520,
+     417,   737,   663,   521,   522,   524,   525,   528,   529,   569,
+     570,   318,   319,   530,   531,   598,   599,   228,   736,   722,
+     416,   320,   228,   712,   321,   435,   322,   664,   665,   436,
+      59,   734,   735,   177,   596,   597,   156,   323,   324,   699,
+     604,   605,   305,   437,   700,   648,   649,   655,   656,   703,
+     653,   654,   438,   360,   240,   441,   220,   476,   493,   508,
+     743,   511,   554,   305,   557,  -138,   523,  -139,   559,   560,
+     561,   562,   742,   577,   565,   566,   591,   747,   749,   592,
+     622,   576,   729,   612,   613,   687,   614,   360,   164,   615,
+     165,    95,    96,    97,    98,   620,   624,    99,   100,   626,
+     228,   459,   460,   461,   462,   463,   464,   465,   466,   467,
+     468,   625,   627,   631,   198,   280,   144,   285,   642,   669,
+     289,   290,   291,   676,   294,   296,   298,   683,   228,   302,
+     677,   166,   690,   691,   692,   360,   306,   701,   177,   312,
+     177,   325,   338,   339,   340,   704,   343,   345,   347,   200,
+     768,   351,   706,   353,   177,   707,   708,   360,   710,   714,
+     720,   143,   144,   144,   101,   721,   727,   730,   102,   731,
+     103,   104,   314,   315,   316,   105,   732,   728,   167,   168,
+     169,   170,   171,   172,   173,   174,   175,   176,   155,   155,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,   115,
+     116,   117,   118,   119,   120,   121,   733,   122,   226,   738,
+     356,   745,   751,   753,   764,   220,   124,   125,   126,   127,
+     128,   129,   130,   765,   607,   469,   610,   606,   358,   202,
+     608,   156,   156,   282,   283,   278,   609,   555,    64,   589,
+     668,   757,   705,   578,   458,   317,   281,   636,   189,    93,
+     190,   724,   311,   644,   647,   313,     0,     0,    95,    96,
+      97,    98,   492,     0,    99,   100,     0,   494,   495,     0,
+     496,     0,   497,     0,   498,   499,   500,     0,   501,     0,
+       0,     0,   502,     0,   505,     0,   177,     0,   318,   319,
+       0,     0,     0,     0,     0,     0,     0,     0,   320,     0,
+       0,   321,   518,   322,     0,     0,     0,     0,   314,   315,
+     316,     0,     0,     0,   514,   324,   536,   537,     0,   538,
+       0,   539,     0,   540,   541,   542,     0,   543,     0,   544,
+     545,   101,     0,     0,     0,   102,     0,   103,   104,     0,
+       0,     0,   105,    95,    96,    97,    98,     0,     0,    99,
+     100,     0,     0,     0,     0,     0,   155,   106,   107,   108,
+     109,   110,   111,   112,   113,   114,   115,   116,   117,   118,
+     119,   120,   121,     0,   122,   226,     0,     0,     0,     0,
+       0,   317,     0,   124,   125,   126,   127,   128,   129,   130,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   156,
+     282,   283,     0,    95,    96,    97,    98,     0,     0,    99,
+     100,     0,     0,     0,     0,     0,   101,     0,     0,     0,
+     102,     0,   103,   104,   318,   319,     0,   105,     0,     0,
+       0,     0,     0,     0,   320,     0,     0,   321,     0,   322,
+       0,   155,   106,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,   117,   118,   119,   120,   121,     0,   122,
+     226,     0,     0,     0,     0,     0,     0,     0,   124,   125,
+     126,   127,   128,   129,   130,     0,   101,     0,   638,     0,
+     102,     0,   103,   104,   156,     0,   283,   105,    95,    96,
+      97,    98,     0,     0,    99,   100,     0,     0,     0,     0,
+       0,     0,   106,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,   117,   118,   119,   120,   121,     0,   122,
+     226,   661,     0,     0,     0,     0,     0,     0,   124,   125,
+     126,   127,   128,   129,   130,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   488,   283,     0,    95,    96,
+      97,    98,     0,     0,    99,   100,     0,     0,     0,     0,
+       0,   101,     0,     0,     0,   102,     0,   103,   104,     0,
+       0,     0,   105,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   106,   107,   108,
+     109,   110,   111,   112,   113,   114,   115,   116,   117,   118,
+     119,   120,   121,     0,   122,   226,     0,     0,   314,   315,
+     316,     0,     0,   124,   125,   126,   127,   128,   129,   130,
+     140,   101,   141,     0,     0,   102,     0,   103,   104,     0,
+     282,   283,   105,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   106,   107,   108,
+     109,   110,   111,   112,   113,   114,   115,   116,   117,   118,
+     119,   120,   121,   142,   122,   226,     0,     0,     0,     0,
+       0,     0,     0,   124,   125,   126,   127,   128,   129,   130,
+     164,   317,   165,     0,     0,     0,     0,     0,     0,     0,
+       0,   283,     0,   143,   144,   140,     0,   141,     0,     0,
+       0,     0,     0,     0,     0,     0,   155,     0,     0,     0,
+     145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
+     155,     0,     0,   166,   318,   319,     0,     0,     0,     0,
+       0,     0,     0,     0,   320,     0,     0,   321,   142,   322,
+       0,     0,   487,     0,     0,     0,     0,     0,     0,   156,
+       0,   324,     0,   143,   144,   140,     0,   141,     0,     0,
+       0,     0,     0,   156,     0,     0,     0,     0,   143,   144,
+     167,   168,   169,   170,   171,   172,   173,   174,   175,   176,
+     155,     0,     0,     0,     0,   145,   146,   147,   148,   149,
+     150,   151,   152,   153,   154,   155,     0,   140,   142,   141,
+       0,     0,   507,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   744,     0,     0,
+       0,     0,     0,   156,     0,     0,     0,     0,   143,   144,
+     164,     0,   165,     0,     0,     0,     0,     0,   156,     0,
+     142,     0,     0,     0,     0,   145,   146,   147,   148,   149,
+     150,   151,   152,   153,   154,   155,     0,     0,   140,     0,
+       0,     0,     0,     0,     0,     0,   314,   315,   316,   164,
+     143,   144,     0,   166,   314,   315,   316,   755,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   145,   146,   147,
+     148,   149,   150,   151,   152,   153,   154,   155,   156,     0,
+       0,   142,     0,   143,   144,   314,   315,   316,     0,     0,
+       0,     0,   166,   314,   315,   316,     0,     0,     0,     0,
+     167,   168,   169,   170,   171,   172,   173,   174,   175,   176,
+     155,   143,   144,     0,     0,     0,     0,     0,     0,   317,
+     156,     0,   143,   144,     0,     0,   144,   317,   145,   146,
+     147,   148,   149,   150,   151,   152,   153,   154,   155,   167,
+     168,   169,   170,   171,   172,   173,   174,   175,   176,   155,
+       0,     0,   155,   156,     0,     0,     0,     0,   317,     0,
+       0,     0,   318,   319,     0,     0,   317,     0,     0,     0,
+     318,   319,   320,     0,     0,   321,     0,   322,     0,     0,
+     320,   156,     0,   321,     0,   322,     0,     0,   640,   324,
+       0,     0,   156,     0,     0,   156,   323,   324,     0,     0,
+       0,   318,   319,     0,     0,     0,     0,     0,     0,   318,
+     319,   320,     0,     0,   321,     0,   322,     0,     0,   320,
+       0,     0,   321,     0,   322,     0,     0,   323,   324,     0,
+       0,   374,    96,    97,    98,     2,   324,    99,   100,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   375,     0,     0,
+       4,     5,     6,     7,     8,     9,    10,    11,    12,     0,
+      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
+      23,    24,    25,     0,     0,   376,   377,   378,     0,   379,
+     380,   381,   382,   383,   384,   385,   386,     0,     0,     0,
+     387,     0,     0,     0,   101,     0,    28,     0,   102,     0,
+     103,   104,     0,     0,     0,   105,   388,   389,   390,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,   115,
+     116,   117,   118,   119,   120,   121,     0,   122,   226,     0,
+     211,   391,     0,     0,     0,     0,   124,   125,   126,   127,
+     128,   129,   130,   374,    96,    97,    98,     2,     0,    99,
+     100,     0,   392,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   375,
+       0,     0,     4,     5,     6,     7,     8,     9,    10,    11,
+      12,     0,    13,    14,    15,    16,    17,    18,    19,    20,
+      21,    22,    23,    24,    25,     0,     0,   376,   377,   378,
+       0,   379,   380,   381,   382,   383,   384,   385,   386,     0,
+       0,     0,   387,     0,     0,     0,   101,     0,    28,     0,
+     102,     0,   103,   104,     0,     0,     0,   105,   388,   389,
+     390,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   106,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,   117,   118,   119,   120,   121,     0,   122,
+     226,     0,   211,   628,     0,     0,     0,     0,   124,   125,
+     126,   127,   128,   129,   130,   374,    96,    97,    98,     2,
+       0,    99,   100,     0,   392,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   375,     0,     0,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,     0,    13,    14,    15,    16,    17,    18,
+      19,    20,    21,    22,    23,    24,    25,     0,     0,   376,
+     377,   378,     0,   379,   380,   381,   382,   383,   384,   385,
+     386,     0,     0,     0,   387,     0,     0,     0,   101,     0,
+      28,     0,   102,     0,   103,   104,     0,     0,     0,   105,
+     388,   389,   390,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,   117,   118,   119,   120,   121,
+       0,   122,   226,     0,   211,     0,     0,     0,     0,     0,
+     124,   125,   126,   127,   128,   129,   130,    95,    96,    97,
+      98,     2,     0,    99,   100,     0,   392,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     3,     0,     0,     4,     5,     6,     7,
+       8,     9,    10,    11,    12,     0,    13,    14,    15,    16,
+      17,    18,    19,    20,    21,    22,    23,    24,    25,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     101,     0,    28,     0,   102,     0,   103,   104,     0,     0,
+       0,   105,     0,     0,     0,     0,   374,    96,    97,    98,
+       0,     0,    99,   100,     0,     0,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,   117,   118,   119,
+     120,   121,    52,   122,   226,     0,     0,     0,     0,     0,
+       0,     0,   124,   125,   126,   127,   128,   129,   130,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   392,     0,
+     376,   377,   378,     0,   379,   380,   381,   382,   383,   384,
+     385,   386,     0,     0,     0,   387,     0,     0,     0,   101,
+       0,     0,     0,   102,     0,   103,   104,     0,     0,     0,
+     105,   388,   389,   390,    95,    96,    97,    98,     0,     0,
+      99,   100,     0,     0,     0,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,   115,   116,   117,   118,   119,   120,
+     121,     0,   122,   226,     0,   211,     0,     0,     0,     0,
+       0,   124,   125,   126,   127,   128,   129,   130,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   392,     0,     0,
+       0,     0,     0,    95,    96,    97,    98,     0,     0,    99,
+     100,     0,     0,     0,     0,     0,     0,   101,     0,     0,
+       0,   102,     0,   103,   104,     0,     0,     0,   105,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   106,   107,   108,   109,   110,   111,   112,
+     113,   114,   115,   116,   117,   118,   119,   120,   121,     0,
+     122,   226,     0,     0,     0,     0,     0,     0,     0,   124,
+     125,   126,   127,   128,   129,   130,   101,     0,     0,     0,
+     102,     0,   103,   104,     0,   567,     0,   105,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   106,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,   117,   118,   119,   120,   121,     0,   122,
+     226,     2,     0,     0,     0,     0,     0,     0,   124,   125,
+     126,   127,   128,   129,   130,     0,     0,     0,     0,     0,
+       0,     0,     0,     3,   392,     0,     4,     5,     6,     7,
+       8,     9,    10,    11,    12,     0,    13,    14,    15,    16,
+      17,    18,    19,    20,    21,    22,    23,    24,    25,    95,
+      96,    97,    98,     2,     0,    99,   100,     0,     0,     0,
+       0,     0,     0,  -351,     0,    83,     0,     0,     0,     0,
+       0,     0,    28,     0,     0,     3,     0,     0,     0,     0,
+       0,     0,     0,     9,    10,    11,    12,     0,     0,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,     0,     0,     0,     0,     0,     0,     0,    95,    96,
+      97,    98,     0,     0,    99,   100,  -351,     0,     0,     0,
+       0,     0,   101,     0,    28,     0,   102,     0,   103,   104,
+       0,     0,     0,   105,     0,     0,     0,   188,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   106,   107,
+     108,   109,   110,   111,   112,   113,   114,   115,   116,   117,
+     118,   119,   120,   121,     0,   122,   226,     0,   260,     0,
+       0,     0,     0,     0,   124,   125,   126,   127,   128,   129,
+     130,   101,     0,     0,     0,   102,     0,   103,   104,     0,
+       0,     0,   105,    95,    96,    97,    98,     0,     0,    99,
+     100,     0,     0,     0,     0,     0,     0,   106,   107,   108,
+     109,   110,   111,   112,   113,   114,   115,   116,   117,   118,
+     119,   120,   121,     0,   122,   226,     0,   359,   711,     0,
+     547,     0,   548,   124,   125,   126,   127,   128,   129,   130,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    95,    96,    97,    98,     0,     0,    99,   100,
+       0,     0,     0,     0,     0,     0,   101,     0,     0,     0,
+     102,     0,   103,   104,     0,     0,     0,   105,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   106,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,   117,   118,   119,   120,   121,     0,   122,
+     226,     0,   359,   750,     0,   547,     0,   548,   124,   125,
+     126,   127,   128,   129,   130,   101,     0,     0,     0,   102,
+       0,   103,   104,     0,     0,     0,   105,    95,    96,    97,
+      98,     0,     0,    99,   100,     0,     0,     0,     0,     0,
+       0,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,   117,   118,   119,   120,   121,     0,   122,   226,
+       0,   359,     0,     0,   547,     0,   548,   124,   125,   126,
+     127,   128,   129,   130,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    95,    96,    97,    98,
+       0,     0,    99,   100,     0,     0,     0,     0,     0,     0,
+     101,     0,     0,     0,   102,     0,   103,   104,     0,     0,
+       0,   105,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,   117,   118,   119,
+     120,   121,     0,   122,   226,     0,     0,     0,     0,     0,
+     227,     0,   124,   125,   126,   127,   128,   129,   130,   101,
+       0,     0,     0,   102,     0,   103,   104,     0,     0,     0,
+     105,    95,    96,    97,    98,     0,     0,    99,   100,     0,
+       0,     0,     0,     0,     0,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,   115,   116,   117,   118,   119,   120,
+     121,     0,   122,   226,     0,   359,     0,     0,     0,     0,
+       0,   124,   125,   126,   127,   128,   129,   130,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      95,    96,    97,    98,     0,     0,    99,   100,     0,     0,
+       0,     0,     0,     0,   101,     0,     0,     0,   102,     0,
+     103,   104,     0,     0,     0,   105,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,   115,
+     116,   117,   118,   119,   120,   121,     0,   122,   226,   478,
+       0,     0,     0,     0,     0,     0,   124,   125,   126,   127,
+     128,   129,   130,   101,     0,     0,     0,   102,     0,   103,
+     104,     0,     0,     0,   105,    95,    96,    97,    98,     0,
+       0,    99,   100,     0,     0,     0,     0,     0,     0,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,   115,   116,
+     117,   118,   119,   120,   121,     0,   122,   226,     0,     0,
+       0,     0,     0,   583,     0,   124,   125,   126,   127,   128,
+     129,   130,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    95,    96,    97,    98,     0,     0,
+      99,   100,     0,     0,     0,     0,     0,     0,   101,     0,
+       0,     0,   102,     0,   103,   104,     0,     0,     0,   105,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,   117,   118,   119,   120,   121,
+       0,   122,   226,     0,     0,     0,     0,     0,   695,     0,
+     124,   125,   126,   127,   128,   129,   130,   101,     0,     0,
+       0,   102,     0,   103,   104,     0,     0,     0,   105,    95,
+      96,    97,    98,     0,     0,    99,   100,     0,     0,     0,
+       0,     0,     0,   106,   107,   108,   109,   110,   111,   112,
+     113,   114,   115,   116,   117,   118,   119,   120,   121,     0,
+     122,   226,     0,   631,     0,     0,     0,     0,     0,   124,
+     125,   126,   127,   128,   129,   130,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    95,    96,
+      97,    98,     0,     0,    99,   100,     0,     0,     0,     0,
+       0,     0,   101,     0,     0,     0,   102,     0,   103,   104,
+       0,     0,     0,   105,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   106,   107,
+     108,   109,   110,   111,   112,   113,   114,   115,   116,   117,
+     118,   119,   120,   121,     0,   122,   226,   746,     0,     0,
+       0,     0,     0,     0,   124,   125,   126,   127,   128,   129,
+     130,   101,     0,     0,     0,   102,     0,   103,   104,     0,
+       0,     0,   105,    95,    96,    97,    98,     0,     0,    99,
+     100,     0,     0,     0,     0,     0,     0,   106,   107,   108,
+     109,   110,   111,   112,   113,   114,   115,   116,   117,   118,
+     119,   120,   121,     0,   122,   226,   748,     0,     0,     0,
+       0,     0,     0,   124,   125,   126,   127,   128,   129,   130,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    95,    96,    97,    98,     0,     0,    99,   100,
+       0,     0,     0,     0,     0,     0,   101,     0,     0,     0,
+     102,     0,   103,   104,     0,     0,     0,   105,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   106,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,   117,   118,   119,   120,   121,     0,   122,
+     123,     0,     0,     0,     0,     0,     0,     0,   124,   125,
+     126,   127,   128,   129,   130,   101,     0,     0,     0,   102,
+       0,   103,   104,     0,     0,     0,   105,    95,    96,    97,
+      98,     0,     0,    99,   100,     0,     0,     0,     0,     0,
+       0,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,   117,   118,   119,   120,   121,     0,   122,   242,
+       0,     0,     0,     0,     0,     0,     0,   124,   125,   126,
+     127,   128,   129,   130,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     101,     0,     0,     0,   102,     0,   103,   104,     0,     0,
+       0,   105,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,   117,   118,   119,
+     120,   121,    92,   122,   226,     1,     0,     0,     0,     2,
+       0,     0,   124,   125,   126,   127,   128,   129,   130,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     3,     0,     0,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,     0,    13,    14,    15,    16,    17,    18,
+      19,    20,    21,    22,    23,    24,    25,     0,     1,     0,
+       0,     0,     2,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    26,    27,     0,     0,     0,     0,
+      28,     0,     0,     0,     3,     0,     0,     4,     5,     6,
+       7,     8,     9,    10,    11,    12,     0,    13,    14,    15,
+      16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
+       0,     1,     0,     0,     0,     2,     0,     0,     0,     0,
+       0,     0,    29,     0,     0,     0,     0,    26,    27,     0,
+      30,     0,    31,    28,     0,     0,     0,     3,     0,     0,
+       4,     5,     6,     7,     8,     9,    10,    11,    12,     0,
+      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
+      23,    24,    25,     0,     0,     0,     2,     0,     0,     0,
+       0,     0,     0,     0,     0,    29,     0,     0,     0,     0,
+       0,     0,     0,    30,     0,    31,    28,     0,     3,     0,
+       0,     4,     5,     6,     7,     8,     9,    10,    11,    12,
+       0,    13,    14,    15,    16,    17,    18,    19,    20,    21,
+      22,    23,    24,    25,     0,   218,     0,     0,     0,     2,
+       0,     0,     0,     0,     0,     0,     0,     0,   409,   580,
+       0,     0,     0,   410,     0,     0,    30,    28,    31,     0,
+       0,     3,     0,     0,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,     0,    13,    14,    15,    16,    17,    18,
+      19,    20,    21,    22,    23,    24,    25,     0,     0,     2,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   473,
+     580,     0,     0,     0,   410,     0,     0,    30,     0,    31,
+      28,     3,     0,     0,     0,     0,    74,     0,     0,     9,
+      10,    11,    12,     0,     0,    14,    15,    16,    17,    18,
+      19,    20,    21,    22,    23,    24,    25,     0,     0,     0,
+       0,     0,     0,     2,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   219,     0,     0,     0,     0,     0,     0,
+      28,     0,     0,     0,     0,     3,    75,    76,     4,     5,
+       6,     7,     8,     9,    10,    11,    12,     0,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,     2,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   201,     0,     0,     0,     0,
+       0,     0,     0,     3,    28,     0,     0,     0,    74,     0,
+       0,     9,    10,    11,    12,     0,     0,    14,    15,    16,
+      17,    18,    19,    20,    21,    22,    23,    24,    25,     0,
+       0,     0,     0,     0,     0,     2,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   693,     0,     0,
+       0,     0,    28,     0,     0,     0,     0,     3,    75,    76,
+       4,     5,     6,     7,     8,     9,    10,    11,    12,     0,
+      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
+      23,    24,    25,     2,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    83,
+       0,     0,     0,     0,     0,     3,    28,     0,     4,     5,
+       6,     7,     8,     9,    10,    11,    12,     0,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,   588,     0,     2,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    28,     3,     0,     0,     4,     5,
+       6,     7,     8,     9,    10,    11,    12,     0,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,   756,     0,     2,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    28,     3,     0,     0,     4,     5,
+       6,     7,     8,     9,    10,    11,    12,     0,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,     2,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     3,    28,     0,     0,     0,    74,     0,
+       0,     9,    10,    11,    12,     0,     0,    14,    15,    16,
+      17,    18,    19,    20,    21,    22,    23,    24,    25,     2,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     3,    28,     0,     0,     0,     0,     0,     0,     9,
+      10,    11,    12,     0,     0,    14,    15,    16,    17,    18,
+      19,    20,    21,    22,    23,    24,    25,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      28
+};
+
+static const yytype_int16 yycheck[] =
+{
+       0,    86,    89,    88,    90,   123,   188,   157,   139,    25,
+      50,   134,   171,   172,   173,   174,   175,     3,   277,   203,
+     226,    37,   149,   150,   151,   152,   153,     3,   321,   322,
+       3,    43,     3,    18,    34,   179,   242,   178,     0,   412,
+      40,    58,    30,    31,   101,    45,   401,   526,   527,     3,
+      90,     3,     3,    77,    13,    14,   142,    38,    98,    99,
+     100,   147,   124,   149,   150,   151,   152,   153,   154,     3,
+      70,    55,     3,    88,    62,   161,    64,    29,    29,    41,
+     142,   665,   577,    45,    30,    31,   124,   144,   126,    89,
+      69,   275,    38,    74,   134,    56,    77,    78,     3,   124,
+      81,   474,   142,   458,   189,   190,    68,   147,   226,   149,
+     150,   151,   152,   153,   154,     3,    62,   203,    64,   144,
+     205,   161,     3,     3,   242,    87,   123,   124,    74,   279,
+     381,    77,    78,   161,    69,    81,   220,   123,    13,    14,
+     188,    29,   123,   122,   120,   162,   163,   120,   165,   120,
+     178,   735,   128,   271,   130,   282,   141,   128,   142,   130,
+     319,   121,   179,   203,   323,   324,   307,   311,   144,   123,
+     122,   142,   651,   144,   198,   190,   200,   123,   137,   138,
+      29,   265,    70,    74,    33,   122,   120,   122,   372,   275,
+      81,   125,   376,   688,   689,   120,   282,   283,   246,   247,
+     248,   249,   250,   251,   252,   253,   254,   255,   120,   257,
+     258,   259,     3,   125,   355,   120,   256,   198,   122,   200,
+      75,    69,   270,   128,   122,   130,   410,   486,   521,   522,
+     120,    80,   220,    75,   122,   275,    85,   142,    75,   120,
+     120,   142,   282,   283,   125,   226,   101,   128,   128,   130,
+     130,   267,   198,    37,   200,   101,   272,    74,    75,   101,
+     101,   242,   137,   138,   101,    49,    50,   101,   386,   124,
+     388,   389,   124,   142,   122,   122,   101,   265,   124,   307,
+     226,   309,   124,   124,   124,   101,   372,   124,   122,   144,
+     376,   122,   144,   124,   311,   124,   242,   122,   144,   422,
+     423,   424,   144,   144,   144,   390,   122,   144,   559,   147,
+     120,   359,   130,   144,   120,   144,   154,   135,   136,   124,
+     131,   132,   440,   161,   410,   576,   354,   355,     8,     9,
+      10,   417,   372,     3,     4,     5,   376,   186,     1,   144,
+       3,   120,   250,   251,   128,   253,   130,   255,   120,   508,
+     125,   120,   127,   125,   130,   514,   128,   121,   130,   135,
+     124,   488,   270,   547,   120,   169,   493,   383,   143,   551,
+     410,   220,   176,   120,   178,   120,   120,   417,   125,   120,
+     125,    44,   422,   423,   424,   425,   426,   427,   428,   429,
+     430,   431,   432,   433,   434,   435,   436,   437,   438,   439,
+     412,   121,   488,   587,   124,   491,    76,   493,   120,   409,
+     121,    74,    75,   124,   121,   121,   416,   124,   124,   625,
+     671,   409,   470,   120,   472,     3,     4,     5,    91,    92,
+      93,    94,    95,    96,    97,    98,    99,   100,   101,   120,
+     120,   120,   560,   561,   562,   125,   120,   127,   488,   119,
+     120,   491,   120,   493,   429,   430,   431,   432,   120,   129,
+     123,   547,   132,   121,   134,   135,   717,   718,   719,   592,
+     143,   121,     5,   473,   124,   503,   504,   532,   533,   534,
+     535,   144,     5,   665,   122,   473,   670,   738,   121,   121,
+     121,   124,   124,   124,     5,   746,   142,   748,    76,   586,
+     143,   587,   753,   551,   121,   121,   120,   547,   124,   760,
+     121,   762,   121,   124,   121,   124,   121,   124,   546,   124,
+     369,    11,    12,   101,    15,    16,   123,   124,     9,    10,
+     143,   713,   548,    11,    12,   139,   140,   131,   132,    49,
+      50,   119,   120,    30,    31,   427,   428,   587,   707,   680,
+     124,   129,   592,   735,   132,   128,   134,   123,   124,   139,
+     409,   123,   124,    58,   425,   426,   144,   145,   146,   617,
+     433,   434,   722,   140,   622,   524,   525,   530,   531,   627,
+     528,   529,    17,   631,   670,   126,   586,   121,   125,   125,
+     721,     3,   121,   743,     5,   142,   128,   142,   142,   120,
+     120,   120,   720,   120,   144,   144,     3,   725,   726,   121,
+     124,   142,   698,   121,   121,   577,   121,   665,     1,   121,
+       3,     3,     4,     5,     6,   121,   124,     9,    10,   121,
+     670,    19,    20,    21,    22,    23,    24,    25,    26,    27,
+      28,   124,   124,   122,   625,   140,    75,   142,   121,   121,
+     145,   146,   147,    62,   149,   150,   151,    77,   698,   154,
+     144,    44,   121,   121,   126,   713,   161,     3,   163,   164,
+     165,   166,   167,   168,   169,   121,   171,   172,   173,   625,
+     765,   176,   126,   178,   179,   145,   126,   735,   126,   144,
+     120,    74,    75,    75,    76,   122,   121,   121,    80,   121,
+      82,    83,     3,     4,     5,    87,   121,   126,    91,    92,
+      93,    94,    95,    96,    97,    98,    99,   100,   101,   101,
+     102,   103,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,   117,   121,   119,   120,   142,
+     123,   120,   126,    60,   144,   745,   128,   129,   130,   131,
+     132,   133,   134,   121,   436,   143,   439,   435,   186,    78,
+     437,   144,   144,   145,   146,   138,   438,   369,    31,   416,
+     552,   745,   631,   401,   260,    76,   141,   491,    68,    45,
+      68,   684,   163,   517,   523,   165,    -1,    -1,     3,     4,
+       5,     6,   287,    -1,     9,    10,    -1,   292,   293,    -1,
+     295,    -1,   297,    -1,   299,   300,   301,    -1,   303,    -1,
+      -1,    -1,   307,    -1,   309,    -1,   311,    -1,   119,   120,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   129,    -1,
+      -1,   132,   327,   134,    -1,    -1,    -1,    -1,     3,     4,
+       5,    -1,    -1,    -1,   145,   146,   341,   342,    -1,   344,
+      -1,   346,    -1,   348,   349,   350,    -1,   352,    -1,   354,
+     355,    76,    -1,    -1,    -1,    80,    -1,    82,    83,    -1,
+      -1,    -1,    87,     3,     4,     5,     6,    -1,    -1,     9,
+      10,    -1,    -1,    -1,    -1,    -1,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,   117,    -1,   119,   120,    -1,    -1,    -1,    -1,
+      -1,    76,    -1,   128,   129,   130,   131,   132,   133,   134,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   144,
+     145,   146,    -1,     3,     4,     5,     6,    -1,    -1,     9,
+      10,    -1,    -1,    -1,    -1,    -1,    76,    -1,    -1,    -1,
+      80,    -1,    82,    83,   119,   120,    -1,    87,    -1,    -1,
+      -1,    -1,    -1,    -1,   129,    -1,    -1,   132,    -1,   134,
+      -1,   101,   102,   103,   104,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,   117,    -1,   119,
+     120,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   128,   129,
+     130,   131,   132,   133,   134,    -1,    76,    -1,   503,    -1,
+      80,    -1,    82,    83,   144,    -1,   146,    87,     3,     4,
+       5,     6,    -1,    -1,     9,    10,    -1,    -1,    -1,    -1,
+      -1,    -1,   102,   103,   104,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,   117,    -1,   119,
+     120,   546,    -1,    -1,    -1,    -1,    -1,    -1,   128,   129,
+     130,   131,   132,   133,   134,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   145,   146,    -1,     3,     4,
+       5,     6,    -1,    -1,     9,    10,    -1,    -1,    -1,    -1,
+      -1,    76,    -1,    -1,    -1,    80,    -1,    82,    83,    -1,
+      -1,    -1,    87,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,   117,    -1,   119,   120,    -1,    -1,     3,     4,
+       5,    -1,    -1,   128,   129,   130,   131,   132,   133,   134,
+       1,    76,     3,    -1,    -1,    80,    -1,    82,    83,    -1,
+     145,   146,    87,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,   117,    44,   119,   120,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   128,   129,   130,   131,   132,   133,   134,
+       1,    76,     3,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   146,    -1,    74,    75,     1,    -1,     3,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   101,    -1,    -1,    -1,
+      91,    92,    93,    94,    95,    96,    97,    98,    99,   100,
+     101,    -1,    -1,    44,   119,   120,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   129,    -1,    -1,   132,    44,   134,
+      -1,    -1,   123,    -1,    -1,    -1,    -1,    -1,    -1,   144,
+      -1,   146,    -1,    74,    75,     1,    -1,     3,    -1,    -1,
+      -1,    -1,    -1,   144,    -1,    -1,    -1,    -1,    74,    75,
+      91,    92,    93,    94,    95,    96,    97,    98,    99,   100,
+     101,    -1,    -1,    -1,    -1,    91,    92,    93,    94,    95,
+      96,    97,    98,    99,   100,   101,    -1,     1,    44,     3,
+      -1,    -1,   123,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   123,    -1,    -1,
+      -1,    -1,    -1,   144,    -1,    -1,    -1,    -1,    74,    75,
+       1,    -1,     3,    -1,    -1,    -1,    -1,    -1,   144,    -1,
+      44,    -1,    -1,    -1,    -1,    91,    92,    93,    94,    95,
+      96,    97,    98,    99,   100,   101,    -1,    -1,     1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,     3,     4,     5,     1,
+      74,    75,    -1,    44,     3,     4,     5,   123,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    91,    92,    93,
+      94,    95,    96,    97,    98,    99,   100,   101,   144,    -1,
+      -1,    44,    -1,    74,    75,     3,     4,     5,    -1,    -1,
+      -1,    -1,    44,     3,     4,     5,    -1,    -1,    -1,    -1,
+      91,    92,    93,    94,    95,    96,    97,    98,    99,   100,
+     101,    74,    75,    -1,    -1,    -1,    -1,    -1,    -1,    76,
+     144,    -1,    74,    75,    -1,    -1,    75,    76,    91,    92,
+      93,    94,    95,    96,    97,    98,    99,   100,   101,    91,
+      92,    93,    94,    95,    96,    97,    98,    99,   100,   101,
+      -1,    -1,   101,   144,    -1,    -1,    -1,    -1,    76,    -1,
+      -1,    -1,   119,   120,    -1,    -1,    76,    -1,    -1,    -1,
+     119,   120,   129,    -1,    -1,   132,    -1,   134,    -1,    -1,
+     129,   144,    -1,   132,    -1,   134,    -1,    -1,   145,   146,
+      -1,    -1,   144,    -1,    -1,   144,   145,   146,    -1,    -1,
+      -1,   119,   120,    -1,    -1,    -1,    -1,    -1,    -1,   119,
+     120,   129,    -1,    -1,   132,    -1,   134,    -1,    -1,   129,
+      -1,    -1,   132,    -1,   134,    -1,    -1,   145,   146,    -1,
+      -1,     3,     4,     5,     6,     7,   146,     9,    10,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    29,    -1,    -1,
+      32,    33,    34,    35,    36,    37,    38,    39,    40,    -1,
+      42,    43,    44,    45,    46,    47,    48,    49,    50,    51,
+      52,    53,    54,    -1,    -1,    57,    58,    59,    -1,    61,
+      62,    63,    64,    65,    66,    67,    68,    -1,    -1,    -1,
+      72,    -1,    -1,    -1,    76,    -1,    78,    -1,    80,    -1,
+      82,    83,    -1,    -1,    -1,    87,    88,    89,    90,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     102,   103,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,   117,    -1,   119,   120,    -1,
+     122,   123,    -1,    -1,    -1,    -1,   128,   129,   130,   131,
+     132,   133,   134,     3,     4,     5,     6,     7,    -1,     9,
+      10,    -1,   144,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    29,
+      -1,    -1,    32,    33,    34,    35,    36,    37,    38,    39,
+      40,    -1,    42,    43,    44,    45,    46,    47,    48,    49,
+      50,    51,    52,    53,    54,    -1,    -1,    57,    58,    59,
+      -1,    61,    62,    63,    64,    65,    66,    67,    68,    -1,
+      -1,    -1,    72,    -1,    -1,    -1,    76,    -1,    78,    -1,
+      80,    -1,    82,    83,    -1,    -1,    -1,    87,    88,    89,
+      90,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   102,   103,   104,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,   117,    -1,   119,
+     120,    -1,   122,   123,    -1,    -1,    -1,    -1,   128,   129,
+     130,   131,   132,   133,   134,     3,     4,     5,     6,     7,
+      -1,     9,    10,    -1,   144,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    29,    -1,    -1,    32,    33,    34,    35,    36,    37,
+      38,    39,    40,    -1,    42,    43,    44,    45,    46,    47,
+      48,    49,    50,    51,    52,    53,    54,    -1,    -1,    57,
+      58,    59,    -1,    61,    62,    63,    64,    65,    66,    67,
+      68,    -1,    -1,    -1,    72,    -1,    -1,    -1,    76,    -1,
+      78,    -1,    80,    -1,    82,    83,    -1,    -1,    -1,    87,
+      88,    89,    90,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   102,   103,   104,   105,   106,   107,
+     108,   109,   110,   111,   112,   113,   114,   115,   116,   117,
+      -1,   119,   120,    -1,   122,    -1,    -1,    -1,    -1,    -1,
+     128,   129,   130,   131,   132,   133,   134,     3,     4,     5,
+       6,     7,    -1,     9,    10,    -1,   144,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    29,    -1,    -1,    32,    33,    34,    35,
+      36,    37,    38,    39,    40,    -1,    42,    43,    44,    45,
+      46,    47,    48,    49,    50,    51,    52,    53,    54,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      76,    -1,    78,    -1,    80,    -1,    82,    83,    -1,    -1,
+      -1,    87,    -1,    -1,    -1,    -1,     3,     4,     5,     6,
+      -1,    -1,     9,    10,    -1,    -1,   102,   103,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,   115,
+     116,   117,    29,   119,   120,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   128,   129,   130,   131,   132,   133,   134,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   144,    -1,
+      57,    58,    59,    -1,    61,    62,    63,    64,    65,    66,
+      67,    68,    -1,    -1,    -1,    72,    -1,    -1,    -1,    76,
+      -1,    -1,    -1,    80,    -1,    82,    83,    -1,    -1,    -1,
+      87,    88,    89,    90,     3,     4,     5,     6,    -1,    -1,
+       9,    10,    -1,    -1,    -1,   102,   103,   104,   105,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,   115,   116,
+     117,    -1,   119,   120,    -1,   122,    -1,    -1,    -1,    -1,
+      -1,   128,   129,   130,   131,   132,   133,   134,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   144,    -1,    -1,
+      -1,    -1,    -1,     3,     4,     5,     6,    -1,    -1,     9,
+      10,    -1,    -1,    -1,    -1,    -1,    -1,    76,    -1,    -1,
+      -1,    80,    -1,    82,    83,    -1,    -1,    -1,    87,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   102,   103,   104,   105,   106,   107,   108,
+     109,   110,   111,   112,   113,   114,   115,   116,   117,    -1,
+     119,   120,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   128,
+     129,   130,   131,   132,   133,   134,    76,    -1,    -1,    -1,
+      80,    -1,    82,    83,    -1,   144,    -1,    87,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   102,   103,   104,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,   117,    -1,   119,
+     120,     7,    -1,    -1,    -1,    -1,    -1,    -1,   128,   129,
+     130,   131,   132,   133,   134,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    29,   144,    -1,    32,    33,    34,    35,
+      36,    37,    38,    39,    40,    -1,    42,    43,    44,    45,
+      46,    47,    48,    49,    50,    51,    52,    53,    54,     3,
+       4,     5,     6,     7,    -1,     9,    10,    -1,    -1,    -1,
+      -1,    -1,    -1,    69,    -1,    71,    -1,    -1,    -1,    -1,
+      -1,    -1,    78,    -1,    -1,    29,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    37,    38,    39,    40,    -1,    -1,    43,
+      44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
+      54,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     3,     4,
+       5,     6,    -1,    -1,     9,    10,   122,    -1,    -1,    -1,
+      -1,    -1,    76,    -1,    78,    -1,    80,    -1,    82,    83,
+      -1,    -1,    -1,    87,    -1,    -1,    -1,   143,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   102,   103,
+     104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,   117,    -1,   119,   120,    -1,   122,    -1,
+      -1,    -1,    -1,    -1,   128,   129,   130,   131,   132,   133,
+     134,    76,    -1,    -1,    -1,    80,    -1,    82,    83,    -1,
+      -1,    -1,    87,     3,     4,     5,     6,    -1,    -1,     9,
+      10,    -1,    -1,    -1,    -1,    -1,    -1,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,   117,    -1,   119,   120,    -1,   122,   123,    -1,
+     125,    -1,   127,   128,   129,   130,   131,   132,   133,   134,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,     3,     4,     5,     6,    -1,    -1,     9,    10,
+      -1,    -1,    -1,    -1,    -1,    -1,    76,    -1,    -1,    -1,
+      80,    -1,    82,    83,    -1,    -1,    -1,    87,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   102,   103,   104,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,   117,    -1,   119,
+     120,    -1,   122,   123,    -1,   125,    -1,   127,   128,   129,
+     130,   131,   132,   133,   134,    76,    -1,    -1,    -1,    80,
+      -1,    82,    83,    -1,    -1,    -1,    87,     3,     4,     5,
+       6,    -1,    -1,     9,    10,    -1,    -1,    -1,    -1,    -1,
+      -1,   102,   103,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,   115,   116,   117,    -1,   119,   120,
+      -1,   122,    -1,    -1,   125,    -1,   127,   128,   129,   130,
+     131,   132,   133,   134,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,     3,     4,     5,     6,
+      -1,    -1,     9,    10,    -1,    -1,    -1,    -1,    -1,    -1,
+      76,    -1,    -1,    -1,    80,    -1,    82,    83,    -1,    -1,
+      -1,    87,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   102,   103,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,   115,
+     116,   117,    -1,   119,   120,    -1,    -1,    -1,    -1,    -1,
+     126,    -1,   128,   129,   130,   131,   132,   133,   134,    76,
+      -1,    -1,    -1,    80,    -1,    82,    83,    -1,    -1,    -1,
+      87,     3,     4,     5,     6,    -1,    -1,     9,    10,    -1,
+      -1,    -1,    -1,    -1,    -1,   102,   103,   104,   105,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,   115,   116,
+     117,    -1,   119,   120,    -1,   122,    -1,    -1,    -1,    -1,
+      -1,   128,   129,   130,   131,   132,   133,   134,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+       3,     4,     5,     6,    -1,    -1,     9,    10,    -1,    -1,
+      -1,    -1,    -1,    -1,    76,    -1,    -1,    -1,    80,    -1,
+      82,    83,    -1,    -1,    -1,    87,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     102,   103,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,   117,    -1,   119,   120,   121,
+      -1,    -1,    -1,    -1,    -1,    -1,   128,   129,   130,   131,
+     132,   133,   134,    76,    -1,    -1,    -1,    80,    -1,    82,
+      83,    -1,    -1,    -1,    87,     3,     4,     5,     6,    -1,
+      -1,     9,    10,    -1,    -1,    -1,    -1,    -1,    -1,   102,
+     103,   104,   105,   106,   107,   108,   109,   110,   111,   112,
+     113,   114,   115,   116,   117,    -1,   119,   120,    -1,    -1,
+      -1,    -1,    -1,   126,    -1,   128,   129,   130,   131,   132,
+     133,   134,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,     3,     4,     5,     6,    -1,    -1,
+       9,    10,    -1,    -1,    -1,    -1,    -1,    -1,    76,    -1,
+      -1,    -1,    80,    -1,    82,    83,    -1,    -1,    -1,    87,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   102,   103,   104,   105,   106,   107,
+     108,   109,   110,   111,   112,   113,   114,   115,   116,   117,
+      -1,   119,   120,    -1,    -1,    -1,    -1,    -1,   126,    -1,
+     128,   129,   130,   131,   132,   133,   134,    76,    -1,    -1,
+      -1,    80,    -1,    82,    83,    -1,    -1,    -1,    87,     3,
+       4,     5,     6,    -1,    -1,     9,    10,    -1,    -1,    -1,
+      -1,    -1,    -1,   102,   103,   104,   105,   106,   107,   108,
+     109,   110,   111,   112,   113,   114,   115,   116,   117,    -1,
+     119,   120,    -1,   122,    -1,    -1,    -1,    -1,    -1,   128,
+     129,   130,   131,   132,   133,   134,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     3,     4,
+       5,     6,    -1,    -1,     9,    10,    -1,    -1,    -1,    -1,
+      -1,    -1,    76,    -1,    -1,    -1,    80,    -1,    82,    83,
+      -1,    -1,    -1,    87,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   102,   103,
+     104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,   117,    -1,   119,   120,   121,    -1,    -1,
+      -1,    -1,    -1,    -1,   128,   129,   130,   131,   132,   133,
+     134,    76,    -1,    -1,    -1,    80,    -1,    82,    83,    -1,
+      -1,    -1,    87,     3,     4,     5,     6,    -1,    -1,     9,
+      10,    -1,    -1,    -1,    -1,    -1,    -1,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,   117,    -1,   119,   120,   121,    -1,    -1,    -1,
+      -1,    -1,    -1,   128,   129,   130,   131,   132,   133,   134,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,     3,     4,     5,     6,    -1,    -1,     9,    10,
+      -1,    -1,    -1,    -1,    -1,    -1,    76,    -1,    -1,    -1,
+      80,    -1,    82,    83,    -1,    -1,    -1,    87,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   102,   103,   104,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,   117,    -1,   119,
+     120,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   128,   129,
+     130,   131,   132,   133,   134,    76,    -1,    -1,    -1,    80,
+      -1,    82,    83,    -1,    -1,    -1,    87,     3,     4,     5,
+       6,    -1,    -1,     9,    10,    -1,    -1,    -1,    -1,    -1,
+      -1,   102,   103,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,   115,   116,   117,    -1,   119,   120,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   128,   129,   130,
+     131,   132,   133,   134,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      76,    -1,    -1,    -1,    80,    -1,    82,    83,    -1,    -1,
+      -1,    87,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   102,   103,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,   115,
+     116,   117,     0,   119,   120,     3,    -1,    -1,    -1,     7,
+      -1,    -1,   128,   129,   130,   131,   132,   133,   134,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    29,    -1,    -1,    32,    33,    34,    35,    36,    37,
+      38,    39,    40,    -1,    42,    43,    44,    45,    46,    47,
+      48,    49,    50,    51,    52,    53,    54,    -1,     3,    -1,
+      -1,    -1,     7,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    72,    73,    -1,    -1,    -1,    -1,
+      78,    -1,    -1,    -1,    29,    -1,    -1,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    -1,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      -1,     3,    -1,    -1,    -1,     7,    -1,    -1,    -1,    -1,
+      -1,    -1,   120,    -1,    -1,    -1,    -1,    72,    73,    -1,
+     128,    -1,   130,    78,    -1,    -1,    -1,    29,    -1,    -1,
+      32,    33,    34,    35,    36,    37,    38,    39,    40,    -1,
+      42,    43,    44,    45,    46,    47,    48,    49,    50,    51,
+      52,    53,    54,    -1,    -1,    -1,     7,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   128,    -1,   130,    78,    -1,    29,    -1,
+      -1,    32,    33,    34,    35,    36,    37,    38,    39,    40,
+      -1,    42,    43,    44,    45,    46,    47,    48,    49,    50,
+      51,    52,    53,    54,    -1,     3,    -1,    -1,    -1,     7,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   120,   121,
+      -1,    -1,    -1,   125,    -1,    -1,   128,    78,   130,    -1,
+      -1,    29,    -1,    -1,    32,    33,    34,    35,    36,    37,
+      38,    39,    40,    -1,    42,    43,    44,    45,    46,    47,
+      48,    49,    50,    51,    52,    53,    54,    -1,    -1,     7,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   120,
+     121,    -1,    -1,    -1,   125,    -1,    -1,   128,    -1,   130,
+      78,    29,    -1,    -1,    -1,    -1,    34,    -1,    -1,    37,
+      38,    39,    40,    -1,    -1,    43,    44,    45,    46,    47,
+      48,    49,    50,    51,    52,    53,    54,    -1,    -1,    -1,
+      -1,    -1,    -1,     7,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   121,    -1,    -1,    -1,    -1,    -1,    -1,
+      78,    -1,    -1,    -1,    -1,    29,    84,    85,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,    -1,    42,    43,
+      44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
+      54,     7,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   123,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    29,    78,    -1,    -1,    -1,    34,    -1,
+      -1,    37,    38,    39,    40,    -1,    -1,    43,    44,    45,
+      46,    47,    48,    49,    50,    51,    52,    53,    54,    -1,
+      -1,    -1,    -1,    -1,    -1,     7,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   121,    -1,    -1,
+      -1,    -1,    78,    -1,    -1,    -1,    -1,    29,    84,    85,
+      32,    33,    34,    35,    36,    37,    38,    39,    40,    -1,
+      42,    43,    44,    45,    46,    47,    48,    49,    50,    51,
+      52,    53,    54,     7,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    71,
+      -1,    -1,    -1,    -1,    -1,    29,    78,    -1,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,    -1,    42,    43,
+      44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
+      54,    55,    -1,     7,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    78,    29,    -1,    -1,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,    -1,    42,    43,
+      44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
+      54,    55,    -1,     7,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    78,    29,    -1,    -1,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,    -1,    42,    43,
+      44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
+      54,     7,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    29,    78,    -1,    -1,    -1,    34,    -1,
+      -1,    37,    38,    39,    40,    -1,    -1,    43,    44,    45,
+      46,    47,    48,    49,    50,    51,    52,    53,    54,     7,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    29,    78,    -1,    -1,    -1,    -1,    -1,    -1,    37,
+      38,    39,    40,    -1,    -1,    43,    44,    45,    46,    47,
+      48,    49,    50,    51,    52,    53,    54,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      78
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int16 yystos[] =
+{
+       0,     3,     7,    29,    32,    33,    34,    35,    36,    37,
+      38,    39,    40,    42,    43,    44,    45,    46,    47,    48,
+      49,    50,    51,    52,    53,    54,    72,    73,    78,   120,
+     128,   130,   169,   170,   174,   175,   176,   178,   180,   188,
+     191,   192,   193,   194,   220,   244,   245,   246,   250,    56,
+     120,     3,    29,   122,   177,   101,   122,   101,   122,   192,
+     191,   194,   195,   194,   195,   144,   172,   173,   192,   170,
+     171,    70,   122,   177,    34,    84,    85,   175,   182,   183,
+     184,   191,   170,    71,   169,   170,   231,   232,   247,   120,
+     125,   193,     0,   245,     3,     3,     4,     5,     6,     9,
+      10,    76,    80,    82,    83,    87,   102,   103,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,   115,
+     116,   117,   119,   120,   128,   129,   130,   131,   132,   133,
+     134,   148,   149,   151,   152,     3,   189,   190,   122,   122,
+       1,     3,    44,    74,    75,    91,    92,    93,    94,    95,
+      96,    97,    98,    99,   100,   101,   144,   221,   222,   223,
+     224,   228,   229,   122,     1,     3,    44,    91,    92,    93,
+      94,    95,    96,    97,    98,    99,   100,   223,   228,   251,
+     252,   253,   121,   191,   194,   194,   124,   144,   143,   231,
+     247,   170,   120,   179,   122,   184,   142,   142,   175,   185,
+     191,   123,   183,   142,   144,   186,   187,   192,   184,   192,
+      69,   122,   212,   213,   248,   249,   169,   249,     3,   121,
+     170,   196,   197,   198,   199,   201,   120,   126,   151,   153,
+     154,   155,   156,   157,   158,   159,   160,   161,   162,   163,
+     164,   168,   120,   151,   151,   151,   120,   120,   120,   120,
+     120,   120,   120,   120,   120,   120,   120,   120,   120,   120,
+     122,   151,   164,   165,   167,   185,   202,     8,     9,    10,
+     120,   125,   127,   121,   153,   143,   123,   124,   189,   221,
+     223,   224,   145,   146,   164,   223,   225,   226,   227,   223,
+     223,   223,   226,     5,   223,   227,   223,   227,   223,   227,
+     227,   227,   223,   226,   123,   222,   223,   226,   229,   230,
+     228,   251,   223,   253,     3,     4,     5,    76,   119,   120,
+     129,   132,   134,   145,   146,   223,   254,   255,   257,   258,
+     259,   260,   261,   262,   263,   264,   265,   266,   223,   223,
+     223,   255,     5,   223,   266,   223,   266,   223,   266,   266,
+     266,   223,   255,   223,   230,   255,   123,   252,   173,   122,
+     165,   205,   212,   249,     5,   185,   185,   181,   168,   124,
+     144,   212,   142,   120,     3,    29,    57,    58,    59,    61,
+      62,    63,    64,    65,    66,    67,    68,    72,    88,    89,
+      90,   123,   144,   167,   169,   177,   210,   211,   212,   214,
+     215,   216,   217,   218,   233,   234,   235,   237,   238,   120,
+     125,   192,   194,   203,   204,   121,   124,   143,   200,   121,
+     124,   202,   130,   135,   136,   131,   132,    11,    12,    13,
+      14,   137,   138,    15,    16,   128,   139,   140,    17,    18,
+     141,   126,   202,   165,   165,   165,   150,   165,   150,   150,
+     165,   150,   165,   150,   151,   165,   165,   165,   216,    19,
+      20,    21,    22,    23,    24,    25,    26,    27,    28,   143,
+     166,   121,   124,   120,   194,   203,   121,   177,   121,   150,
+     167,   177,   168,   123,   190,   123,   124,   123,   145,   227,
+     164,   124,   223,   125,   223,   223,   223,   223,   223,   223,
+     223,   223,   223,   230,   124,   223,   229,   123,   125,   256,
+     266,     3,   258,   258,   145,   266,   266,   124,   223,     9,
+      10,    11,    12,   128,   139,   140,   130,   135,   131,   132,
+      30,    31,    13,    14,   137,   138,   223,   223,   223,   223,
+     223,   223,   223,   223,   223,   223,   230,   125,   127,   205,
+     206,   207,   208,   209,   121,   187,   168,     5,   168,   142,
+     120,   120,   120,   210,   177,   144,   144,   144,   167,    49,
+      50,   219,   167,   167,   212,   144,   142,   120,   214,   217,
+     121,   196,   203,   126,   168,   204,   120,   125,    55,   199,
+     164,     3,   121,   153,   153,   153,   154,   154,   155,   155,
+     156,   156,   156,   156,   157,   157,   158,   159,   160,   161,
+     162,   167,   121,   121,   121,   121,   121,   124,   121,   121,
+     121,   121,   124,   121,   124,   124,   121,   124,   123,   165,
+     165,   122,   121,   126,   123,   227,   225,   227,   223,   229,
+     145,   266,   121,   266,   254,   258,   258,   259,   260,   260,
+     261,   135,   261,   262,   262,   263,   263,   264,   264,   264,
+     264,   223,   168,   177,   123,   124,   205,   143,   209,   121,
+      55,   142,   210,   167,   167,   167,    62,   144,   144,   101,
+     122,   144,   144,    77,   239,   240,   210,   169,   233,   236,
+     121,   121,   126,   121,   196,   126,   168,   153,   142,   165,
+     165,     3,   202,   165,   121,   206,   126,   145,   126,   261,
+     126,   123,   205,   207,   144,   168,   210,   121,   121,   121,
+     120,   122,   221,   241,   240,   233,   233,   121,   126,   164,
+     121,   121,   121,   121,   123,   124,   266,   205,   142,   210,
+     210,   210,   167,   221,   123,   120,   121,   167,   121,   167,
+     123,   126,   210,    60,   121,   123,    55,   198,   243,   210,
+     121,   210,   121,   210,   144,   121,   210,   210,   212,   242
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int16 yyr1[] =
+{
+       0,   147,   148,   148,   148,   148,   148,   148,   148,   148,
+     148,   148,   148,   148,   148,   149,   149,   149,   149,   149,
+     149,   149,   149,   149,   149,   149,   149,   149,   149,   149,
+     149,   149,   149,   149,   149,   149,   149,   149,   149,   150,
+     150,   151,   151,   151,   151,   151,   151,   152,   152,   152,
+     152,   152,   152,   152,   153,   153,   154,   154,   154,   154,
+     155,   155,   155,   156,   156,   156,   157,   157,   157,   157,
+     157,   158,   158,   158,   159,   159,   160,   160,   161,   161,
+     162,   162,   163,   163,   164,   164,   165,   165,   166,   166,
+     166,   166,   166,   166,   166,   166,   166,   166,   166,   167,
+     167,   168,   169,   169,   170,   170,   170,   170,   170,   170,
+     171,   172,   172,   173,   173,   174,   174,   174,   174,   174,
+     174,   175,   175,   175,   175,   175,   175,   175,   175,   175,
+     175,   175,   175,   175,   175,   176,   176,   176,   177,   177,
+     178,   178,   178,   179,   180,   180,   181,   182,   182,   183,
+     183,   183,   183,   183,   184,   184,   184,   184,   184,   185,
+     185,   185,   185,   186,   186,   187,   187,   187,   188,   188,
+     188,   188,   188,   189,   189,   190,   190,   191,   191,   191,
+     192,   192,   193,   193,   193,   193,   193,   193,   193,   193,
+     194,   194,   194,   194,   194,   194,   194,   194,   195,   195,
+     196,   196,   197,   197,   198,   198,   198,   199,   200,   200,
+     201,   201,   202,   202,   203,   203,   203,   204,   204,   204,
+     204,   204,   204,   204,   204,   204,   205,   205,   205,   206,
+     206,   206,   206,   207,   208,   208,   209,   209,   210,   210,
+     210,   210,   210,   210,   210,   210,   211,   211,   211,   211,
+     212,   212,   213,   214,   215,   216,   216,   217,   217,   218,
+     218,   219,   219,   219,   220,   220,   221,   221,   222,   222,
+     223,   223,   224,   224,   224,   224,   224,   224,   224,   224,
+     224,   224,   224,   224,   224,   224,   224,   224,   224,   224,
+     224,   224,   224,   224,   224,   225,   225,   225,   225,   226,
+     226,   227,   227,   228,   228,   229,   230,   230,   230,   231,
+     231,   232,   232,   233,   233,   234,   234,   234,   235,   235,
+     235,   235,   235,   235,   236,   237,   237,   237,   237,   237,
+     237,   237,   238,   239,   239,   240,   241,   242,   243,   243,
+     244,   244,   245,   245,   245,   245,   246,   246,   246,   246,
+     247,   247,   248,   249,   249,   250,   250,   251,   251,   252,
+     252,   253,   253,   253,   253,   253,   253,   253,   253,   253,
+     253,   253,   253,   253,   253,   253,   253,   253,   253,   253,
+     253,   253,   253,   253,   254,   254,   254,   255,   255,   256,
+     256,   256,   257,   257,   257,   257,   257,   257,   257,   257,
+     257,   258,   258,   258,   259,   259,   259,   260,   260,   261,
+     261,   261,   262,   262,   262,   262,   263,   263,   263,   264,
+     264,   264,   265,   265,   265,   265,   265,   266,   266
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     3,     5,     1,     4,     4,     4,     4,
+       4,     4,     4,     6,     6,     4,     4,     4,     6,     6,
+       4,     3,     4,     3,     3,     2,     2,     6,     7,     1,
+       3,     1,     2,     2,     2,     4,     2,     1,     1,     1,
+       1,     1,     1,     1,     1,     4,     1,     3,     3,     3,
+       1,     3,     3,     1,     3,     3,     1,     3,     3,     3,
+       3,     1,     3,     3,     1,     3,     1,     3,     1,     3,
+       1,     3,     1,     3,     1,     5,     1,     3,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       3,     1,     2,     3,     1,     2,     2,     3,     1,     2,
+       0,     1,     3,     1,     3,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     4,     4,     2,     3,     1,     1,
+       1,     1,     1,     3,     3,     2,     0,     1,     2,     2,
+       3,     2,     2,     3,     2,     1,     2,     1,     2,     2,
+       1,     2,     1,     1,     3,     1,     2,     3,     4,     5,
+       5,     6,     2,     1,     3,     1,     3,     1,     1,     1,
+       2,     1,     1,     3,     3,     4,     3,     4,     4,     3,
+       1,     2,     2,     3,     1,     2,     2,     3,     1,     2,
+       1,     3,     1,     3,     2,     2,     1,     2,     2,     0,
+       1,     3,     1,     2,     1,     1,     2,     3,     2,     3,
+       3,     4,     2,     3,     3,     4,     1,     3,     4,     1,
+       2,     3,     4,     2,     1,     2,     3,     2,     1,     1,
+       1,     1,     1,     1,     1,     1,     3,     6,     4,     3,
+       2,     3,     1,     1,     1,     1,     2,     1,     1,     5,
+       6,     0,     1,     1,     4,     5,     1,     2,     1,     2,
+       1,     1,     1,     2,     2,     3,     2,     3,     2,     3,
+       2,     3,     3,     4,     2,     2,     2,     3,     2,     3,
+       3,     3,     3,     2,     3,     1,     2,     3,     4,     1,
+       3,     1,     2,     1,     2,     1,     1,     2,     3,     1,
+       2,     1,     2,     1,     2,     5,     7,     5,     5,     7,
+       6,     7,     6,     7,     1,     3,     2,     2,     2,     3,
+       3,     3,     3,     1,     2,     7,     0,     0,     1,     1,
+       1,     2,     1,     1,     1,     1,     4,     4,     3,     3,
+       1,     0,     5,     1,     1,     4,     5,     1,     2,     1,
+       2,     1,     2,     2,     3,     2,     3,     2,     3,     2,
+       3,     3,     4,     2,     2,     2,     3,     2,     3,     3,
+       3,     3,     2,     3,     1,     2,     3,     1,     3,     3,
+       5,     0,     1,     1,     1,     2,     1,     2,     3,     2,
+       2,     1,     2,     2,     1,     3,     3,     1,     3,     1,
+       3,     3,     1,     3,     3,     4,     1,     3,     3,     1,
+       3,     3,     1,     3,     3,     3,     3,     1,     2
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = CGRAMYYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == CGRAMYYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use CGRAMYYerror or CGRAMYYUNDEF. */
+#define YYERRCODE CGRAMYYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if CGRAMYYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !CGRAMYYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !CGRAMYYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+/* Context of a parse error.  */
+typedef struct
+{
+  yy_state_t *yyssp;
+  yysymbol_kind_t yytoken;
+} yypcontext_t;
+
+/* Put in YYARG at most YYARGN of the expected tokens given the
+   current YYCTX, and return the number of tokens stored in YYARG.  If
+   YYARG is null, return the number of expected tokens (guaranteed to
+   be less than YYNTOKENS).  Return YYENOMEM on memory exhaustion.
+   Return 0 if there are more than YYARGN expected tokens, yet fill
+   YYARG up to YYARGN. */
+static int
+yypcontext_expected_tokens (const yypcontext_t *yyctx,
+                            yysymbol_kind_t yyarg[], int yyargn)
+{
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  int yyn = yypact[+*yyctx->yyssp];
+  if (!yypact_value_is_default (yyn))
+    {
+      /* Start YYX at -YYN if negative to avoid negative indexes in
+         YYCHECK.  In other words, skip the first -YYN actions for
+         this state because they are default actions.  */
+      int yyxbegin = yyn < 0 ? -yyn : 0;
+      /* Stay within bounds of both yycheck and yytname.  */
+      int yychecklim = YYLAST - yyn + 1;
+      int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+      int yyx;
+      for (yyx = yyxbegin; yyx < yyxend; ++yyx)
+        if (yycheck[yyx + yyn] == yyx && yyx != YYSYMBOL_YYerror
+            && !yytable_value_is_error (yytable[yyx + yyn]))
+          {
+            if (!yyarg)
+              ++yycount;
+            else if (yycount == yyargn)
+              return 0;
+            else
+              yyarg[yycount++] = YY_CAST (yysymbol_kind_t, yyx);
+          }
+    }
+  if (yyarg && yycount == 0 && 0 < yyargn)
+    yyarg[0] = YYSYMBOL_YYEMPTY;
+  return yycount;
+}
+
+
+
+
+#ifndef yystrlen
+# if defined __GLIBC__ && defined _STRING_H
+#  define yystrlen(S) (YY_CAST (YYPTRDIFF_T, strlen (S)))
+# else
+/* Return the length of YYSTR.  */
+static YYPTRDIFF_T
+yystrlen (const char *yystr)
+{
+  YYPTRDIFF_T yylen;
+  for (yylen = 0; yystr[yylen]; yylen++)
+    continue;
+  return yylen;
+}
+# endif
+#endif
+
+#ifndef yystpcpy
+# if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
+#  define yystpcpy stpcpy
+# else
+/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
+   YYDEST.  */
+static char *
+yystpcpy (char *yydest, const char *yysrc)
+{
+  char *yyd = yydest;
+  const char *yys = yysrc;
+
+  while ((*yyd++ = *yys++) != '\0')
+    continue;
+
+  return yyd - 1;
+}
+# endif
+#endif
+
+#ifndef yytnamerr
+/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
+   quotes and backslashes, so that it's suitable for yyerror.  The
+   heuristic is that double-quoting is unnecessary unless the string
+   contains an apostrophe, a comma, or backslash (other than
+   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
+   null, do not copy; instead, return the length of what the result
+   would have been.  */
+static YYPTRDIFF_T
+yytnamerr (char *yyres, const char *yystr)
+{
+  if (*yystr == '"')
+    {
+      YYPTRDIFF_T yyn = 0;
+      char const *yyp = yystr;
+      for (;;)
+        switch (*++yyp)
+          {
+          case '\'':
+          case ',':
+            goto do_not_strip_quotes;
+
+          case '\\':
+            if (*++yyp != '\\')
+              goto do_not_strip_quotes;
+            else
+              goto append;
+
+          append:
+          default:
+            if (yyres)
+              yyres[yyn] = *yyp;
+            yyn++;
+            break;
+
+          case '"':
+            if (yyres)
+              yyres[yyn] = '\0';
+            return yyn;
+          }
+    do_not_strip_quotes: ;
+    }
+
+  if (yyres)
+    return yystpcpy (yyres, yystr) - yyres;
+  else
+    return yystrlen (yystr);
+}
+#endif
+
+
+static int
+yy_syntax_error_arguments (const yypcontext_t *yyctx,
+                           yysymbol_kind_t yyarg[], int yyargn)
+{
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  /* There are many possibilities here to consider:
+     - If this state is a consistent state with a default action, then
+       the only way this function was invoked is if the default action
+       is an error action.  In that case, don't check for expected
+       tokens because there are none.
+     - The only way there can be no lookahead present (in yychar) is if
+       this state is a consistent state with a default action.  Thus,
+       detecting the absence of a lookahead is sufficient to determine
+       that there is no unexpected or expected token to report.  In that
+       case, just report a simple "syntax error".
+     - Don't assume there isn't a lookahead just because this state is a
+       consistent state with a default action.  There might have been a
+       previous inconsistent state, consistent state with a non-default
+       action, or user semantic action that manipulated yychar.
+     - Of course, the expected token list depends on states to have
+       correct lookahead information, and it depends on the parser not
+       to perform extra reductions after fetching a lookahead from the
+       scanner and before detecting a syntax error.  Thus, state merging
+       (from LALR or IELR) and default reductions corrupt the expected
+       token list.  However, the list is correct for canonical LR with
+       one exception: it will still contain any token that will not be
+       accepted due to an error action in a later state.
+  */
+  if (yyctx->yytoken != YYSYMBOL_YYEMPTY)
+    {
+      int yyn;
+      if (yyarg)
+        yyarg[yycount] = yyctx->yytoken;
+      ++yycount;
+      yyn = yypcontext_expected_tokens (yyctx,
+                                        yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+      if (yyn == YYENOMEM)
+        return YYENOMEM;
+      else
+        yycount += yyn;
+    }
+  return yycount;
+}
+
+/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
+   about the unexpected token YYTOKEN for the state stack whose top is
+   YYSSP.
+
+   Return 0 if *YYMSG was successfully written.  Return -1 if *YYMSG is
+   not large enough to hold the message.  In that case, also set
+   *YYMSG_ALLOC to the required number of bytes.  Return YYENOMEM if the
+   required number of bytes is too large to store.  */
+static int
+yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
+                const yypcontext_t *yyctx)
+{
+  enum { YYARGS_MAX = 5 };
+  /* Internationalized format string. */
+  const char *yyformat = YY_NULLPTR;
+  /* Arguments of yyformat: reported tokens (one for the "unexpected",
+     one per "expected"). */
+  yysymbol_kind_t yyarg[YYARGS_MAX];
+  /* Cumulated lengths of YYARG.  */
+  YYPTRDIFF_T yysize = 0;
+
+  /* Actual size of YYARG. */
+  int yycount = yy_syntax_error_arguments (yyctx, yyarg, YYARGS_MAX);
+  if (yycount == YYENOMEM)
+    return YYENOMEM;
+
+  switch (yycount)
+    {
+#define YYCASE_(N, S)                       \
+      case N:                               \
+        yyformat = S;                       \
+        break
+    default: /* Avoid compiler warnings. */
+      YYCASE_(0, YY_("syntax error"));
+      YYCASE_(1, YY_("syntax error, unexpected %s"));
+      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
+      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
+      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
+      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
+#undef YYCASE_
+    }
+
+  /* Compute error message size.  Don't count the "%s"s, but reserve
+     room for the terminator.  */
+  yysize = yystrlen (yyformat) - 2 * yycount + 1;
+  {
+    int yyi;
+    for (yyi = 0; yyi < yycount; ++yyi)
+      {
+        YYPTRDIFF_T yysize1
+          = yysize + yytnamerr (YY_NULLPTR, yytname[yyarg[yyi]]);
+        if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
+          yysize = yysize1;
+        else
+          return YYENOMEM;
+      }
+  }
+
+  if (*yymsg_alloc < yysize)
+    {
+      *yymsg_alloc = 2 * yysize;
+      if (! (yysize <= *yymsg_alloc
+             && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
+        *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
+      return -1;
+    }
+
+  /* Avoid sprintf, as that infringes on the user's name space.
+     Don't have undefined behavior even if the translation
+     produced a string with the wrong number of "%s"s.  */
+  {
+    char *yyp = *yymsg;
+    int yyi = 0;
+    while ((*yyp = *yyformat) != '\0')
+      if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
+        {
+          yyp += yytnamerr (yyp, yytname[yyarg[yyi++]]);
+          yyformat += 2;
+        }
+      else
+        {
+          ++yyp;
+          ++yyformat;
+        }
+  }
+  return 0;
+}
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
+{
+  YY_USE (yyvaluep);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void)
+{
+/* Lookahead token kind.  */
+int yychar;
+
+
+/* The semantic value of the lookahead symbol.  */
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
+
+    /* Number of syntax errors so far.  */
+    int yynerrs = 0;
+
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+
+  /* Buffer for error messages, and its allocated size.  */
+  char yymsgbuf[128];
+  char *yymsg = yymsgbuf;
+  YYPTRDIFF_T yymsg_alloc = sizeof yymsgbuf;
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = CGRAMYYEMPTY; /* Cause a token to be read.  */
+
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == CGRAMYYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex (&yylval);
+    }
+
+  if (yychar <= CGRAMYYEOF)
+    {
+      yychar = CGRAMYYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == CGRAMYYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = CGRAMYYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = CGRAMYYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 2: /* primary_expression: "identifier"  */
+#line 968 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 3713 "./build/cgram.tab.c"
+    break;
+
+  case 3: /* primary_expression: "constant"  */
+#line 970 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 3719 "./build/cgram.tab.c"
+    break;
+
+  case 4: /* primary_expression: "hardware register"  */
+#line 972 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 3725 "./build/cgram.tab.c"
+    break;
+
+  case 5: /* primary_expression: "this"  */
+#line 974 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_SELF, NULL, NULL); }
+#line 3731 "./build/cgram.tab.c"
+    break;
+
+  case 6: /* primary_expression: "true"  */
+#line 976 "frontends/c/cgram.y"
+            { yyval = AstInteger(1); }
+#line 3737 "./build/cgram.tab.c"
+    break;
+
+  case 7: /* primary_expression: "false"  */
+#line 978 "frontends/c/cgram.y"
+            { yyval = AstInteger(0); }
+#line 3743 "./build/cgram.tab.c"
+    break;
+
+  case 8: /* primary_expression: "nullptr"  */
+#line 980 "frontends/c/cgram.y"
+            { yyval = AstBitValue(0); }
+#line 3749 "./build/cgram.tab.c"
+    break;
+
+  case 9: /* primary_expression: "string literal"  */
+#line 982 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_STRINGPTR, yyvsp[0], NULL); }
+#line 3755 "./build/cgram.tab.c"
+    break;
+
+  case 10: /* primary_expression: "__func__ or __FUNCTION__"  */
+#line 984 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_FUNC_NAME, NULL, NULL); }
+#line 3761 "./build/cgram.tab.c"
+    break;
+
+  case 11: /* primary_expression: "__builtin_printf"  */
+#line 986 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_PRINT, NULL, NULL); }
+#line 3767 "./build/cgram.tab.c"
+    break;
+
+  case 12: /* primary_expression: '$'  */
+#line 988 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_HERE, NULL, NULL); }
+#line 3773 "./build/cgram.tab.c"
+    break;
+
+  case 13: /* primary_expression: '(' expression ')'  */
+#line 990 "frontends/c/cgram.y"
+            { yyval = yyvsp[-1]; }
+#line 3779 "./build/cgram.tab.c"
+    break;
+
+  case 14: /* primary_expression: '(' '{' block_item_list '}' ')'  */
+#line 992 "frontends/c/cgram.y"
+            { yyval = yyvsp[-2]; }
+#line 3785 "./build/cgram.tab.c"
+    break;
+
+  case 15: /* postfix_expression: primary_expression  */
+#line 997 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 3791 "./build/cgram.tab.c"
+    break;
+
+  case 16: /* postfix_expression: "__builtin_abs" '(' assignment_expression ')'  */
+#line 999 "frontends/c/cgram.y"
+            { yyval = AstOperator(K_ABS, NULL, yyvsp[-1]); }
+#line 3797 "./build/cgram.tab.c"
+    break;
+
+  case 17: /* postfix_expression: "__builtin_clz" '(' assignment_expression ')'  */
+#line 1001 "frontends/c/cgram.y"
+            {
+                AST *expr = AstOperator(K_ENCODE, NULL, yyvsp[-1]);
+                expr = AstOperator('-', AstInteger(32), expr);
+                yyval = expr;
+            }
+#line 3807 "./build/cgram.tab.c"
+    break;
+
+  case 18: /* postfix_expression: "__builtin_sqrt" '(' assignment_expression ')'  */
+#line 1007 "frontends/c/cgram.y"
+            { yyval = AstOperator(K_SQRT, NULL, yyvsp[-1]); }
+#line 3813 "./build/cgram.tab.c"
+    break;
+
+  case 19: /* postfix_expression: "__builtin_rev" '(' argument_expression_list ')'  */
+#line 1009 "frontends/c/cgram.y"
+            {
+                AST *list;
+                AST *arg1, *arg2;
+                
+                list = yyvsp[-1];
+                if (!list || !list->left)
+                {
+                    SYNTAX_ERROR("Missing argument to __builtin_rev");
+                    arg1 = AstInteger(1);
+                } else {
+                    arg1 = list->left;
+                }
+                if (list && list->right) {
+                    arg2 = list->right->left;
+                    if (list->right->right) {
+                        SYNTAX_ERROR("Too many arguments to __builtin_rev");
+                    }
+                } else {
+                    arg2 = AstInteger(0);
+                }
+
+                // PropGCC defines __builtin_rev to match the ASM instruction,
+                // not the >< operator, hence the 32 - arg2
+                yyval = AstOperator(K_REV, arg1, AstOperator('-', AstInteger(32), arg2));
+            }
+#line 3843 "./build/cgram.tab.c"
+    break;
+
+  case 20: /* postfix_expression: "__builtin_frac" '(' argument_expression_list ')'  */
+#line 1035 "frontends/c/cgram.y"
+            {
+                AST *list;
+                AST *arg1, *arg2;
+                
+                list = yyvsp[-1];
+                if (!list || !list->left)
+                {
+                    SYNTAX_ERROR("Missing argument to __builtin_frac");
+                    arg1 = AstInteger(1);
+                } else {
+                    arg1 = list->left;
+                }
+                if (list && list->right) {
+                    arg2 = list->right->left;
+                    if (list->right->right) {
+                        SYNTAX_ERROR("Too many arguments to __builtin_frac");
+                    }
+                } else {
+                    arg2 = AstInteger(0);
+                }
+                yyval = AstOperator(K_FRAC64, arg1, arg2);
+            }
+#line 3870 "./build/cgram.tab.c"
+    break;
+
+  case 21: /* postfix_expression: "__builtin_muluh" '(' argument_expression_list ')'  */
+#line 1058 "frontends/c/cgram.y"
+            {
+                AST *list;
+                AST *arg1, *arg2;
+                
+                list = yyvsp[-1];
+                if (!list || !list->left)
+                {
+                    SYNTAX_ERROR("Missing argument to __builtin_muluh");
+                    arg1 = AstInteger(1);
+                } else {
+                    arg1 = list->left;
+                }
+                if (list && list->right) {
+                    arg2 = list->right->left;
+                    if (list->right->right) {
+                        SYNTAX_ERROR("Too many arguments to __builtin_muluh");
+                    }
+                } else {
+                    arg2 = AstInteger(0);
+                }
+                yyval = AstOperator(K_UNS_HIGHMULT, arg1, arg2);
+            }
+#line 3897 "./build/cgram.tab.c"
+    break;
+
+  case 22: /* postfix_expression: "__builtin_mulh" '(' argument_expression_list ')'  */
+#line 1081 "frontends/c/cgram.y"
+            {
+                AST *list;
+                AST *arg1, *arg2;
+                
+                list = yyvsp[-1];
+                if (!list || !list->left)
+                {
+                    SYNTAX_ERROR("Missing argument to __builtin_mulh");
+                    arg1 = AstInteger(1);
+                } else {
+                    arg1 = list->left;
+                }
+                if (list && list->right) {
+                    arg2 = list->right->left;
+                    if (list->right->right) {
+                        SYNTAX_ERROR("Too many arguments to __builtin_mulh");
+                    }
+                } else {
+                    arg2 = AstInteger(0);
+                }
+                yyval = AstOperator(K_HIGHMULT, arg1, arg2);
+            }
+#line 3924 "./build/cgram.tab.c"
+    break;
+
+  case 23: /* postfix_expression: "__builtin_va_start" '(' unary_expression ',' "identifier" ')'  */
+#line 1104 "frontends/c/cgram.y"
+            {
+                yyval = NewAST(AST_VA_START, yyvsp[-3], yyvsp[-1]);
+            }
+#line 3932 "./build/cgram.tab.c"
+    break;
+
+  case 24: /* postfix_expression: "__builtin_va_arg" '(' assignment_expression ',' type_name ')'  */
+#line 1108 "frontends/c/cgram.y"
+            {
+                // NOTE: like an AST_MEMREF, the type goes first
+                yyval = NewAST(AST_VA_ARG, yyvsp[-1], yyvsp[-3]);
+            }
+#line 3941 "./build/cgram.tab.c"
+    break;
+
+  case 25: /* postfix_expression: "__builtin_setjmp" '(' assignment_expression ')'  */
+#line 1113 "frontends/c/cgram.y"
+            {
+                yyval = NewAST(AST_SETJMP, yyvsp[-1], NULL);
+            }
+#line 3949 "./build/cgram.tab.c"
+    break;
+
+  case 26: /* postfix_expression: "__builtin_alloca" '(' assignment_expression ')'  */
+#line 1117 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_ALLOCA, ast_type_ptr_void, yyvsp[-1]); }
+#line 3955 "./build/cgram.tab.c"
+    break;
+
+  case 27: /* postfix_expression: "__builtin_cogstart" '(' argument_expression_list ')'  */
+#line 1119 "frontends/c/cgram.y"
+            {
+                AST *elist;
+                AST *immval = AstInteger(0x1e);
+                elist = NewAST(AST_EXPRLIST, immval, NULL);
+                elist = AddToList(elist, yyvsp[-1]);
+                yyval = NewAST(AST_COGINIT, elist, NULL);
+            }
+#line 3967 "./build/cgram.tab.c"
+    break;
+
+  case 28: /* postfix_expression: "__builtin_expect" '(' assignment_expression ',' assignment_expression ')'  */
+#line 1127 "frontends/c/cgram.y"
+            { yyval = yyvsp[-3]; }
+#line 3973 "./build/cgram.tab.c"
+    break;
+
+  case 29: /* postfix_expression: "__builtin_longjmp" '(' assignment_expression ',' assignment_expression ')'  */
+#line 1129 "frontends/c/cgram.y"
+            {
+                yyval = NewAST(AST_THROW, yyvsp[-1], yyvsp[-3]);
+            }
+#line 3981 "./build/cgram.tab.c"
+    break;
+
+  case 30: /* postfix_expression: postfix_expression '[' expression ']'  */
+#line 1133 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_ARRAYREF, yyvsp[-3], yyvsp[-1]); }
+#line 3987 "./build/cgram.tab.c"
+    break;
+
+  case 31: /* postfix_expression: postfix_expression '(' ')'  */
+#line 1135 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_FUNCCALL, yyvsp[-2], NULL); }
+#line 3993 "./build/cgram.tab.c"
+    break;
+
+  case 32: /* postfix_expression: postfix_expression '(' argument_expression_list ')'  */
+#line 1137 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_FUNCCALL, yyvsp[-3], yyvsp[-1]); }
+#line 3999 "./build/cgram.tab.c"
+    break;
+
+  case 33: /* postfix_expression: postfix_expression '.' any_identifier  */
+#line 1139 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_METHODREF, yyvsp[-2], yyvsp[0]); }
+#line 4005 "./build/cgram.tab.c"
+    break;
+
+  case 34: /* postfix_expression: postfix_expression "->" any_identifier  */
+#line 1141 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_METHODREF,
+                          NewAST(AST_ARRAYREF, yyvsp[-2], AstInteger(0)),
+                          yyvsp[0]);
+            }
+#line 4014 "./build/cgram.tab.c"
+    break;
+
+  case 35: /* postfix_expression: postfix_expression "++"  */
+#line 1146 "frontends/c/cgram.y"
+            { yyval = AstOperator(K_INCREMENT, yyvsp[-1], NULL); }
+#line 4020 "./build/cgram.tab.c"
+    break;
+
+  case 36: /* postfix_expression: postfix_expression "--"  */
+#line 1148 "frontends/c/cgram.y"
+            { yyval = AstOperator(K_DECREMENT, yyvsp[-1], NULL); }
+#line 4026 "./build/cgram.tab.c"
+    break;
+
+  case 37: /* postfix_expression: '(' type_name ')' '{' initializer_list '}'  */
+#line 1150 "frontends/c/cgram.y"
+            {
+                /* FIXME: treat this like ({ type_name t = initializer_list; t; }) */
+                AST *typ = yyvsp[-4];
+                AST *initlist = yyvsp[-1];
+                AST *id = AstTempIdentifier("_initval_");
+
+                AST *decl;
+                AST *stmt;
+
+                decl = SingleDeclareVar(typ, id);
+                stmt = NewAST(AST_STMTLIST, decl, NULL);
+                stmt = AddToList(stmt,
+                                 NewAST(AST_STMTLIST, AstAssign(id, initlist), NULL));
+                stmt = AddToList(stmt, NewAST(AST_STMTLIST, id, NULL));
+                yyval = stmt;
+            }
+#line 4047 "./build/cgram.tab.c"
+    break;
+
+  case 38: /* postfix_expression: '(' type_name ')' '{' initializer_list ',' '}'  */
+#line 1167 "frontends/c/cgram.y"
+            {
+                /* treat this like ({ type_name t = initializer_list; t; }) */
+                AST *typ = yyvsp[-5];
+                AST *initlist = yyvsp[-2];
+                AST *id = AstTempIdentifier("_initval_");
+
+                AST *decl = AstAssign(id, initlist);
+                AST *stmt;
+
+                DeclareOneGlobalVar(current, decl, typ, IN_DAT);
+                stmt = NewAST(AST_STMTLIST, id, NULL);
+                yyval = stmt;
+            }
+#line 4065 "./build/cgram.tab.c"
+    break;
+
+  case 39: /* argument_expression_list: assignment_expression  */
+#line 1184 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_EXPRLIST, yyvsp[0], NULL); }
+#line 4071 "./build/cgram.tab.c"
+    break;
+
+  case 40: /* argument_expression_list: argument_expression_list ',' assignment_expression  */
+#line 1186 "frontends/c/cgram.y"
+            { yyval = AddToList(yyvsp[-2], NewAST(AST_EXPRLIST, yyvsp[0], NULL)); }
+#line 4077 "./build/cgram.tab.c"
+    break;
+
+  case 41: /* unary_expression: postfix_expression  */
+#line 1191 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 4083 "./build/cgram.tab.c"
+    break;
+
+  case 42: /* unary_expression: "++" unary_expression  */
+#line 1193 "frontends/c/cgram.y"
+            { yyval = AstOperator(K_INCREMENT, NULL, yyvsp[0]); }
+#line 4089 "./build/cgram.tab.c"
+    break;
+
+  case 43: /* unary_expression: "--" unary_expression  */
+#line 1195 "frontends/c/cgram.y"
+            { yyval = AstOperator(K_DECREMENT, NULL, yyvsp[0]); }
+#line 4095 "./build/cgram.tab.c"
+    break;
+
+  case 44: /* unary_expression: unary_operator cast_expression  */
+#line 1197 "frontends/c/cgram.y"
+            {
+                yyval = yyvsp[-1];
+                if (yyval->kind == AST_ADDROF || yyval->kind == AST_ARRAYREF)
+                    yyval->left = yyvsp[0];
+                else
+                    yyval->right = yyvsp[0];
+            }
+#line 4107 "./build/cgram.tab.c"
+    break;
+
+  case 45: /* unary_expression: "sizeof" '(' type_name ')'  */
+#line 1205 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_SIZEOF, yyvsp[-1], NULL); }
+#line 4113 "./build/cgram.tab.c"
+    break;
+
+  case 46: /* unary_expression: "sizeof" unary_expression  */
+#line 1207 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_SIZEOF, yyvsp[0], NULL); }
+#line 4119 "./build/cgram.tab.c"
+    break;
+
+  case 47: /* unary_operator: '&'  */
+#line 1212 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_ADDROF, NULL, NULL); }
+#line 4125 "./build/cgram.tab.c"
+    break;
+
+  case 48: /* unary_operator: '@'  */
+#line 1214 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_ADDROF, NULL, NULL); }
+#line 4131 "./build/cgram.tab.c"
+    break;
+
+  case 49: /* unary_operator: '*'  */
+#line 1216 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_ARRAYREF, NULL, AstInteger(0)); }
+#line 4137 "./build/cgram.tab.c"
+    break;
+
+  case 50: /* unary_operator: '+'  */
+#line 1218 "frontends/c/cgram.y"
+            { yyval = AstOperator('+', NULL, NULL); }
+#line 4143 "./build/cgram.tab.c"
+    break;
+
+  case 51: /* unary_operator: '-'  */
+#line 1220 "frontends/c/cgram.y"
+            { yyval = AstOperator(K_NEGATE, NULL, NULL); }
+#line 4149 "./build/cgram.tab.c"
+    break;
+
+  case 52: /* unary_operator: '~'  */
+#line 1222 "frontends/c/cgram.y"
+            { yyval = AstOperator(K_BIT_NOT, NULL, NULL); }
+#line 4155 "./build/cgram.tab.c"
+    break;
+
+  case 53: /* unary_operator: '!'  */
+#line 1224 "frontends/c/cgram.y"
+            { yyval = AstOperator(K_BOOL_NOT, NULL, NULL); }
+#line 4161 "./build/cgram.tab.c"
+    break;
+
+  case 54: /* cast_expression: unary_expression  */
+#line 1229 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 4167 "./build/cgram.tab.c"
+    break;
+
+  case 55: /* cast_expression: '(' type_name ')' cast_expression  */
+#line 1231 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_CAST, yyvsp[-2], yyvsp[0]); }
+#line 4173 "./build/cgram.tab.c"
+    break;
+
+  case 56: /* multiplicative_expression: cast_expression  */
+#line 1243 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 4179 "./build/cgram.tab.c"
+    break;
+
+  case 57: /* multiplicative_expression: multiplicative_expression '*' cast_expression  */
+#line 1245 "frontends/c/cgram.y"
+            { yyval = AstOperator('*', yyvsp[-2], yyvsp[0]); }
+#line 4185 "./build/cgram.tab.c"
+    break;
+
+  case 58: /* multiplicative_expression: multiplicative_expression '/' cast_expression  */
+#line 1247 "frontends/c/cgram.y"
+            { yyval = AstOperator('/', yyvsp[-2], yyvsp[0]); }
+#line 4191 "./build/cgram.tab.c"
+    break;
+
+  case 59: /* multiplicative_expression: multiplicative_expression '%' cast_expression  */
+#line 1249 "frontends/c/cgram.y"
+            { yyval = AstOperator(K_MODULUS, yyvsp[-2], yyvsp[0]); }
+#line 4197 "./build/cgram.tab.c"
+    break;
+
+  case 60: /* additive_expression: multiplicative_expression  */
+#line 1254 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 4203 "./build/cgram.tab.c"
+    break;
+
+  case 61: /* additive_expression: additive_expression '+' multiplicative_expression  */
+#line 1256 "frontends/c/cgram.y"
+            { yyval = AstOperator('+', yyvsp[-2], yyvsp[0]); }
+#line 4209 "./build/cgram.tab.c"
+    break;
+
+  case 62: /* additive_expression: additive_expression '-' multiplicative_expression  */
+#line 1258 "frontends/c/cgram.y"
+            { yyval = AstOperator('-', yyvsp[-2], yyvsp[0]); }
+#line 4215 "./build/cgram.tab.c"
+    break;
+
+  case 63: /* shift_expression: additive_expression  */
+#line 1263 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 4221 "./build/cgram.tab.c"
+    break;
+
+  case 64: /* shift_expression: shift_expression "<<" additive_expression  */
+#line 1265 "frontends/c/cgram.y"
+            { yyval = AstOperator(K_SHL, yyvsp[-2], yyvsp[0]); }
+#line 4227 "./build/cgram.tab.c"
+    break;
+
+  case 65: /* shift_expression: shift_expression ">>" additive_expression  */
+#line 1267 "frontends/c/cgram.y"
+            { yyval = AstOperator(K_SAR, yyvsp[-2], yyvsp[0]); }
+#line 4233 "./build/cgram.tab.c"
+    break;
+
+  case 66: /* relational_expression: shift_expression  */
+#line 1272 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 4239 "./build/cgram.tab.c"
+    break;
+
+  case 67: /* relational_expression: relational_expression '<' shift_expression  */
+#line 1274 "frontends/c/cgram.y"
+            { yyval = AstOperator('<', yyvsp[-2], yyvsp[0]); }
+#line 4245 "./build/cgram.tab.c"
+    break;
+
+  case 68: /* relational_expression: relational_expression '>' shift_expression  */
+#line 1276 "frontends/c/cgram.y"
+            { yyval = AstOperator('>', yyvsp[-2], yyvsp[0]); }
+#line 4251 "./build/cgram.tab.c"
+    break;
+
+  case 69: /* relational_expression: relational_expression "<=" shift_expression  */
+#line 1278 "frontends/c/cgram.y"
+            { yyval = AstOperator(K_LE, yyvsp[-2], yyvsp[0]); }
+#line 4257 "./build/cgram.tab.c"
+    break;
+
+  case 70: /* relational_expression: relational_expression ">=" shift_expression  */
+#line 1280 "frontends/c/cgram.y"
+            { yyval = AstOperator(K_GE, yyvsp[-2], yyvsp[0]); }
+#line 4263 "./build/cgram.tab.c"
+    break;
+
+  case 71: /* equality_expression: relational_expression  */
+#line 1285 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 4269 "./build/cgram.tab.c"
+    break;
+
+  case 72: /* equality_expression: equality_expression "==" relational_expression  */
+#line 1287 "frontends/c/cgram.y"
+            { yyval = AstOperator(K_EQ, yyvsp[-2], yyvsp[0]); }
+#line 4275 "./build/cgram.tab.c"
+    break;
+
+  case 73: /* equality_expression: equality_expression "!=" relational_expression  */
+#line 1289 "frontends/c/cgram.y"
+            { yyval = AstOperator(K_NE, yyvsp[-2], yyvsp[0]); }
+#line 4281 "./build/cgram.tab.c"
+    break;
+
+  case 74: /* and_expression: equality_expression  */
+#line 1294 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 4287 "./build/cgram.tab.c"
+    break;
+
+  case 75: /* and_expression: and_expression '&' equality_expression  */
+#line 1296 "frontends/c/cgram.y"
+            { yyval = AstOperator('&', yyvsp[-2], yyvsp[0]); }
+#line 4293 "./build/cgram.tab.c"
+    break;
+
+  case 76: /* exclusive_or_expression: and_expression  */
+#line 1301 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 4299 "./build/cgram.tab.c"
+    break;
+
+  case 77: /* exclusive_or_expression: exclusive_or_expression '^' and_expression  */
+#line 1303 "frontends/c/cgram.y"
+            { yyval = AstOperator('^', yyvsp[-2], yyvsp[0]); }
+#line 4305 "./build/cgram.tab.c"
+    break;
+
+  case 78: /* inclusive_or_expression: exclusive_or_expression  */
+#line 1308 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 4311 "./build/cgram.tab.c"
+    break;
+
+  case 79: /* inclusive_or_expression: inclusive_or_expression '|' exclusive_or_expression  */
+#line 1310 "frontends/c/cgram.y"
+            { yyval = AstOperator('|', yyvsp[-2], yyvsp[0]); }
+#line 4317 "./build/cgram.tab.c"
+    break;
+
+  case 80: /* logical_and_expression: inclusive_or_expression  */
+#line 1315 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 4323 "./build/cgram.tab.c"
+    break;
+
+  case 81: /* logical_and_expression: logical_and_expression "&&" inclusive_or_expression  */
+#line 1317 "frontends/c/cgram.y"
+            { yyval = AstOperator(K_BOOL_AND, yyvsp[-2], yyvsp[0]); }
+#line 4329 "./build/cgram.tab.c"
+    break;
+
+  case 82: /* logical_or_expression: logical_and_expression  */
+#line 1322 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 4335 "./build/cgram.tab.c"
+    break;
+
+  case 83: /* logical_or_expression: logical_or_expression "||" logical_and_expression  */
+#line 1324 "frontends/c/cgram.y"
+            { yyval = AstOperator(K_BOOL_OR, yyvsp[-2], yyvsp[0]); }
+#line 4341 "./build/cgram.tab.c"
+    break;
+
+  case 84: /* conditional_expression: logical_or_expression  */
+#line 1329 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 4347 "./build/cgram.tab.c"
+    break;
+
+  case 85: /* conditional_expression: logical_or_expression '?' expression ':' conditional_expression  */
+#line 1331 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_CONDRESULT, yyvsp[-4], NewAST(AST_THENELSE, yyvsp[-2], yyvsp[0])); }
+#line 4353 "./build/cgram.tab.c"
+    break;
+
+  case 86: /* assignment_expression: conditional_expression  */
+#line 1336 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 4359 "./build/cgram.tab.c"
+    break;
+
+  case 87: /* assignment_expression: unary_expression assignment_operator assignment_expression  */
+#line 1338 "frontends/c/cgram.y"
+            { yyval = yyvsp[-1]; yyval->left = yyvsp[-2]; yyval->right = yyvsp[0]; }
+#line 4365 "./build/cgram.tab.c"
+    break;
+
+  case 88: /* assignment_operator: '='  */
+#line 1343 "frontends/c/cgram.y"
+            { yyval = AstAssign(NULL, NULL); }
+#line 4371 "./build/cgram.tab.c"
+    break;
+
+  case 89: /* assignment_operator: "*="  */
+#line 1345 "frontends/c/cgram.y"
+            { yyval = AstOpAssign('*', NULL, NULL); }
+#line 4377 "./build/cgram.tab.c"
+    break;
+
+  case 90: /* assignment_operator: "/="  */
+#line 1347 "frontends/c/cgram.y"
+            { yyval = AstOpAssign('/', NULL, NULL); }
+#line 4383 "./build/cgram.tab.c"
+    break;
+
+  case 91: /* assignment_operator: "%="  */
+#line 1349 "frontends/c/cgram.y"
+            { yyval = AstOpAssign(K_MODULUS, NULL, NULL); }
+#line 4389 "./build/cgram.tab.c"
+    break;
+
+  case 92: /* assignment_operator: "+="  */
+#line 1351 "frontends/c/cgram.y"
+            { yyval = AstOpAssign('+', NULL, NULL); }
+#line 4395 "./build/cgram.tab.c"
+    break;
+
+  case 93: /* assignment_operator: "-="  */
+#line 1353 "frontends/c/cgram.y"
+            { yyval = AstOpAssign('-', NULL, NULL); }
+#line 4401 "./build/cgram.tab.c"
+    break;
+
+  case 94: /* assignment_operator: "<<="  */
+#line 1355 "frontends/c/cgram.y"
+            { yyval = AstOpAssign(K_SHL, NULL, NULL); }
+#line 4407 "./build/cgram.tab.c"
+    break;
+
+  case 95: /* assignment_operator: ">>="  */
+#line 1357 "frontends/c/cgram.y"
+            { yyval = AstOpAssign(K_SAR, NULL, NULL); }
+#line 4413 "./build/cgram.tab.c"
+    break;
+
+  case 96: /* assignment_operator: "&="  */
+#line 1359 "frontends/c/cgram.y"
+            { yyval = AstOpAssign('&', NULL, NULL); }
+#line 4419 "./build/cgram.tab.c"
+    break;
+
+  case 97: /* assignment_operator: "^="  */
+#line 1361 "frontends/c/cgram.y"
+            { yyval = AstOpAssign('^', NULL, NULL); }
+#line 4425 "./build/cgram.tab.c"
+    break;
+
+  case 98: /* assignment_operator: "|="  */
+#line 1363 "frontends/c/cgram.y"
+            { yyval = AstOpAssign('|', NULL, NULL); }
+#line 4431 "./build/cgram.tab.c"
+    break;
+
+  case 99: /* expression: assignment_expression  */
+#line 1368 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 4437 "./build/cgram.tab.c"
+    break;
+
+  case 100: /* expression: expression ',' assignment_expression  */
+#line 1370 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_SEQUENCE, yyvsp[-2], yyvsp[0]); }
+#line 4443 "./build/cgram.tab.c"
+    break;
+
+  case 101: /* constant_expression: conditional_expression  */
+#line 1375 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 4449 "./build/cgram.tab.c"
+    break;
+
+  case 102: /* declaration: declaration_specifiers ';'  */
+#line 1380 "frontends/c/cgram.y"
+            { yyval = SingleDeclareVar(NULL, yyvsp[-1]); }
+#line 4455 "./build/cgram.tab.c"
+    break;
+
+  case 103: /* declaration: declaration_specifiers init_declarator_list ';'  */
+#line 1382 "frontends/c/cgram.y"
+            {
+                yyval = MultipleDeclareVar(yyvsp[-2], yyvsp[-1]);
+            }
+#line 4463 "./build/cgram.tab.c"
+    break;
+
+  case 104: /* declaration_specifiers: storage_class_specifier  */
+#line 1389 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 4469 "./build/cgram.tab.c"
+    break;
+
+  case 105: /* declaration_specifiers: storage_class_specifier declaration_specifiers  */
+#line 1391 "frontends/c/cgram.y"
+            {
+                AST *prefix = yyvsp[-1];
+                AST *suffix = yyvsp[0];
+                yyval = MergePrefix(prefix, suffix);
+            }
+#line 4479 "./build/cgram.tab.c"
+    break;
+
+  case 106: /* declaration_specifiers: type_specifier reset_identifier_expectation  */
+#line 1397 "frontends/c/cgram.y"
+            { yyval = yyvsp[-1]; AllowTypeNames(); }
+#line 4485 "./build/cgram.tab.c"
+    break;
+
+  case 107: /* declaration_specifiers: type_specifier reset_identifier_expectation declaration_specifiers  */
+#line 1399 "frontends/c/cgram.y"
+            { yyval = C_ModifySignedUnsigned(yyvsp[-2], yyvsp[0]); AllowTypeNames(); }
+#line 4491 "./build/cgram.tab.c"
+    break;
+
+  case 108: /* declaration_specifiers: type_qualifier  */
+#line 1401 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; yyval->left = ast_type_long; }
+#line 4497 "./build/cgram.tab.c"
+    break;
+
+  case 109: /* declaration_specifiers: type_qualifier declaration_specifiers  */
+#line 1403 "frontends/c/cgram.y"
+            { yyval = MergePrefix(yyvsp[-1], yyvsp[0]); }
+#line 4503 "./build/cgram.tab.c"
+    break;
+
+  case 110: /* reset_identifier_expectation: %empty  */
+#line 1408 "frontends/c/cgram.y"
+            { DisallowTypeNames(); }
+#line 4509 "./build/cgram.tab.c"
+    break;
+
+  case 111: /* init_declarator_list: init_declarator  */
+#line 1413 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_LISTHOLDER, yyvsp[0], NULL); }
+#line 4515 "./build/cgram.tab.c"
+    break;
+
+  case 112: /* init_declarator_list: init_declarator_list ',' init_declarator  */
+#line 1415 "frontends/c/cgram.y"
+            { yyval = AddToList(yyvsp[-2], NewAST(AST_LISTHOLDER, yyvsp[0], NULL)); }
+#line 4521 "./build/cgram.tab.c"
+    break;
+
+  case 113: /* init_declarator: declarator  */
+#line 1420 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 4527 "./build/cgram.tab.c"
+    break;
+
+  case 114: /* init_declarator: declarator '=' initializer  */
+#line 1422 "frontends/c/cgram.y"
+            { yyval = AstAssign(yyvsp[-2], yyvsp[0]); }
+#line 4533 "./build/cgram.tab.c"
+    break;
+
+  case 115: /* storage_class_specifier: "typedef"  */
+#line 1427 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_TYPEDEF, NULL, NULL); }
+#line 4539 "./build/cgram.tab.c"
+    break;
+
+  case 116: /* storage_class_specifier: "extern"  */
+#line 1429 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_EXTERN, NULL, NULL); }
+#line 4545 "./build/cgram.tab.c"
+    break;
+
+  case 117: /* storage_class_specifier: "static"  */
+#line 1431 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_STATIC, NULL, NULL); }
+#line 4551 "./build/cgram.tab.c"
+    break;
+
+  case 118: /* storage_class_specifier: "auto"  */
+#line 1433 "frontends/c/cgram.y"
+            { yyval = NULL; }
+#line 4557 "./build/cgram.tab.c"
+    break;
+
+  case 119: /* storage_class_specifier: "inline"  */
+#line 1435 "frontends/c/cgram.y"
+            { yyval = NULL; }
+#line 4563 "./build/cgram.tab.c"
+    break;
+
+  case 120: /* storage_class_specifier: "register"  */
+#line 1437 "frontends/c/cgram.y"
+            { yyval = NULL; }
+#line 4569 "./build/cgram.tab.c"
+    break;
+
+  case 121: /* type_specifier: "void"  */
+#line 1442 "frontends/c/cgram.y"
+            { yyval = ast_type_void; }
+#line 4575 "./build/cgram.tab.c"
+    break;
+
+  case 122: /* type_specifier: "char"  */
+#line 1444 "frontends/c/cgram.y"
+            { yyval = ast_type_byte; }
+#line 4581 "./build/cgram.tab.c"
+    break;
+
+  case 123: /* type_specifier: "_Bool"  */
+#line 1446 "frontends/c/cgram.y"
+            { yyval = ast_type_byte; }
+#line 4587 "./build/cgram.tab.c"
+    break;
+
+  case 124: /* type_specifier: "short"  */
+#line 1448 "frontends/c/cgram.y"
+            { yyval = ast_type_signed_word; }
+#line 4593 "./build/cgram.tab.c"
+    break;
+
+  case 125: /* type_specifier: "int"  */
+#line 1450 "frontends/c/cgram.y"
+            { yyval = ast_type_long; }
+#line 4599 "./build/cgram.tab.c"
+    break;
+
+  case 126: /* type_specifier: "long"  */
+#line 1452 "frontends/c/cgram.y"
+            {
+                if (!ast_type_c_long) {
+                    // same as ast_type_long, but a distinct memory address
+                    // so we can distinguish it
+                    ast_type_c_long = NewAST(AST_INTTYPE, AstInteger(4), NULL);
+                }
+                yyval = ast_type_c_long;
+            }
+#line 4612 "./build/cgram.tab.c"
+    break;
+
+  case 127: /* type_specifier: "float"  */
+#line 1461 "frontends/c/cgram.y"
+            { yyval = ast_type_float; }
+#line 4618 "./build/cgram.tab.c"
+    break;
+
+  case 128: /* type_specifier: "double"  */
+#line 1463 "frontends/c/cgram.y"
+            { yyval = ast_type_float; }
+#line 4624 "./build/cgram.tab.c"
+    break;
+
+  case 129: /* type_specifier: "signed"  */
+#line 1465 "frontends/c/cgram.y"
+            {
+                if (!ast_type_c_signed) {
+                    // same as ast_type_long, but a distinct memory address
+                    // so we can distinguish it
+                    ast_type_c_signed = NewAST(AST_INTTYPE, AstInteger(4), NULL);
+                }
+                yyval = ast_type_c_signed;
+            }
+#line 4637 "./build/cgram.tab.c"
+    break;
+
+  case 130: /* type_specifier: "unsigned"  */
+#line 1474 "frontends/c/cgram.y"
+            { yyval = ast_type_unsigned_long; }
+#line 4643 "./build/cgram.tab.c"
+    break;
+
+  case 131: /* type_specifier: struct_or_union_specifier  */
+#line 1476 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 4649 "./build/cgram.tab.c"
+    break;
+
+  case 132: /* type_specifier: enum_specifier  */
+#line 1478 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 4655 "./build/cgram.tab.c"
+    break;
+
+  case 133: /* type_specifier: "type name"  */
+#line 1480 "frontends/c/cgram.y"
+            {
+                AST *ident = yyvsp[0];
+                Symbol *sym = LookupSymbolInTable(currentTypes, ident->d.string);
+                if (sym && sym->kind == SYM_TYPEDEF) {
+                    yyval = (AST *)sym->val;
+                } else {
+                    SYNTAX_ERROR("Internal error, bad typename %s", ident->d.string);
+                    yyval = NULL;
+                }
+            }
+#line 4670 "./build/cgram.tab.c"
+    break;
+
+  case 134: /* type_specifier: "typeof" '(' unary_expression ')'  */
+#line 1491 "frontends/c/cgram.y"
+            {
+                AST *typ = ExprType(yyvsp[-2]);
+                if (!typ) {
+                    WARNING(yyvsp[-3], "Unable to find type of expression, assuming generic");
+                    typ = NULL;
+                }
+                yyval = typ;
+            }
+#line 4683 "./build/cgram.tab.c"
+    break;
+
+  case 135: /* struct_or_union_specifier: struct_open struct_declaration_list '}' struct_close  */
+#line 1503 "frontends/c/cgram.y"
+            {
+                AST *d = yyvsp[-3];
+                AddStructBody(current, yyvsp[-2]);
+                current = current->superclass;
+                yyval = d;
+            }
+#line 4694 "./build/cgram.tab.c"
+    break;
+
+  case 136: /* struct_or_union_specifier: struct_or_union any_identifier  */
+#line 1510 "frontends/c/cgram.y"
+            { yyval = MakeNewStruct(current, yyvsp[-1], yyvsp[0], NULL); }
+#line 4700 "./build/cgram.tab.c"
+    break;
+
+  case 137: /* struct_or_union_specifier: struct_or_union "__using" fromfile_clause  */
+#line 1512 "frontends/c/cgram.y"
+            { yyval = MakeNewStruct(current, yyvsp[-2], NULL, yyvsp[0]); }
+#line 4706 "./build/cgram.tab.c"
+    break;
+
+  case 138: /* any_identifier: "identifier"  */
+#line 1517 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 4712 "./build/cgram.tab.c"
+    break;
+
+  case 139: /* any_identifier: "type name"  */
+#line 1519 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 4718 "./build/cgram.tab.c"
+    break;
+
+  case 140: /* struct_or_union: "struct"  */
+#line 1523 "frontends/c/cgram.y"
+            {
+                AST *c = NewAST(AST_STRUCT, NULL, NULL);
+                c->d.ival = 0;  // public by default
+                yyval = c;
+            }
+#line 4728 "./build/cgram.tab.c"
+    break;
+
+  case 141: /* struct_or_union: "class"  */
+#line 1529 "frontends/c/cgram.y"
+            {
+                AST *c = NewAST(AST_STRUCT, NULL, NULL);
+                c->d.ival = 1;  // private by default
+                yyval = c;
+            }
+#line 4738 "./build/cgram.tab.c"
+    break;
+
+  case 142: /* struct_or_union: "union"  */
+#line 1535 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_UNION, NULL, NULL); }
+#line 4744 "./build/cgram.tab.c"
+    break;
+
+  case 143: /* fromfile_clause: '(' "string literal" ')'  */
+#line 1540 "frontends/c/cgram.y"
+            {
+                AST *str = yyvsp[-1];
+                if (str && str->kind == AST_EXPRLIST) {
+                    str = str->left;
+                }
+                yyval = str;
+            }
+#line 4756 "./build/cgram.tab.c"
+    break;
+
+  case 144: /* struct_open: struct_or_union any_identifier '{'  */
+#line 1551 "frontends/c/cgram.y"
+            {
+                AST *newstruct;
+                Module *C;
+                newstruct = MakeNewStruct(current, yyvsp[-2], yyvsp[-1], NULL);
+                yyval = newstruct;
+                C = GetClassPtr(newstruct);
+                C->superclass = current;
+                current = C;
+                PushCurrentTypes();
+            }
+#line 4771 "./build/cgram.tab.c"
+    break;
+
+  case 145: /* struct_open: struct_or_union '{'  */
+#line 1562 "frontends/c/cgram.y"
+            {
+                AST *newstruct;
+                Module *C;
+                newstruct = MakeNewStruct(current, yyvsp[-1], NULL, NULL);
+                yyval = newstruct;
+                C = GetClassPtr(newstruct);
+                C->superclass = current;
+                current = C;
+                PushCurrentTypes();
+            }
+#line 4786 "./build/cgram.tab.c"
+    break;
+
+  case 146: /* struct_close: %empty  */
+#line 1575 "frontends/c/cgram.y"
+    {
+        PopCurrentTypes();
+    }
+#line 4794 "./build/cgram.tab.c"
+    break;
+
+  case 147: /* struct_declaration_list: struct_declaration  */
+#line 1582 "frontends/c/cgram.y"
+           { yyval = yyvsp[0]; }
+#line 4800 "./build/cgram.tab.c"
+    break;
+
+  case 148: /* struct_declaration_list: struct_declaration_list struct_declaration  */
+#line 1584 "frontends/c/cgram.y"
+           { yyval = AddToList(yyvsp[-1], yyvsp[0]); }
+#line 4806 "./build/cgram.tab.c"
+    break;
+
+  case 149: /* struct_declaration: struct_specifier_qualifier_list ';'  */
+#line 1589 "frontends/c/cgram.y"
+            {
+                AST *dummy;
+                AST *anonstruct = yyvsp[-1];
+                AST *decl;
+                dummy = AstTempIdentifier("__anonymous__");
+                dummy = NewAST(AST_LISTHOLDER, dummy, NULL);
+                decl = MultipleDeclareVar(anonstruct, dummy);
+                // declare aliases for each variable in the object
+                Module *P = GetClassPtr(anonstruct);
+                if (P) {
+                    DeclareAnonymousAliases(current, P, dummy);
+                }
+                yyval = decl;
+            }
+#line 4825 "./build/cgram.tab.c"
+    break;
+
+  case 150: /* struct_declaration: struct_specifier_qualifier_list struct_declarator_list ';'  */
+#line 1604 "frontends/c/cgram.y"
+            {
+                yyval = MultipleDeclareVar(yyvsp[-2], yyvsp[-1]);
+            }
+#line 4833 "./build/cgram.tab.c"
+    break;
+
+  case 151: /* struct_declaration: "public" ':'  */
+#line 1608 "frontends/c/cgram.y"
+            {
+                yyval = NewAST(AST_STMTLIST,
+                            NewAST(AST_PUBFUNC, NULL, NULL), NULL);
+            }
+#line 4842 "./build/cgram.tab.c"
+    break;
+
+  case 152: /* struct_declaration: "private" ':'  */
+#line 1613 "frontends/c/cgram.y"
+            {
+                yyval = NewAST(AST_STMTLIST,
+                            NewAST(AST_PRIFUNC, NULL, NULL), NULL);
+            }
+#line 4851 "./build/cgram.tab.c"
+    break;
+
+  case 153: /* struct_declaration: struct_specifier_qualifier_list struct_declarator_list compound_statement  */
+#line 1618 "frontends/c/cgram.y"
+            {
+                AST *type;
+                AST *ident = NULL;
+                AST *body = yyvsp[0];
+                AST *decl = yyvsp[-1];
+                AST *spqual = yyvsp[-2];
+                AST *top_decl;
+                Module *module = NULL;
+                
+                if (decl->right) {
+                    SYNTAX_ERROR("bad method declaration");
+                }
+                type = CombineTypes(spqual, decl->left, &ident, &module);
+
+                top_decl = NewAST(AST_LISTHOLDER, type,
+                                  NewAST(AST_LISTHOLDER, ident,
+                                         NewAST(AST_LISTHOLDER, body, NULL)));
+                if (module) {
+                    ERROR(decl, ":: not supported inside structures");
+                }
+                top_decl = NewAST(AST_FUNCDECL, top_decl, NULL);
+                yyval = NewAST(AST_STMTLIST, top_decl, NULL);
+            }
+#line 4879 "./build/cgram.tab.c"
+    break;
+
+  case 154: /* struct_specifier_qualifier_list: type_specifier specifier_qualifier_list  */
+#line 1645 "frontends/c/cgram.y"
+            { yyval = C_ModifySignedUnsigned(yyvsp[-1], yyvsp[0]); }
+#line 4885 "./build/cgram.tab.c"
+    break;
+
+  case 155: /* struct_specifier_qualifier_list: type_specifier  */
+#line 1647 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 4891 "./build/cgram.tab.c"
+    break;
+
+  case 156: /* struct_specifier_qualifier_list: type_qualifier struct_specifier_qualifier_list  */
+#line 1649 "frontends/c/cgram.y"
+            { yyval = yyvsp[-1]; yyval->left = yyvsp[0]; }
+#line 4897 "./build/cgram.tab.c"
+    break;
+
+  case 157: /* struct_specifier_qualifier_list: type_qualifier  */
+#line 1651 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; yyval->left = ast_type_long; }
+#line 4903 "./build/cgram.tab.c"
+    break;
+
+  case 158: /* struct_specifier_qualifier_list: "static" struct_specifier_qualifier_list  */
+#line 1653 "frontends/c/cgram.y"
+            {
+                AST *list = yyvsp[0];
+                AST *static_spec = NewAST(AST_STATIC, NULL, NULL);
+                yyval = MergePrefix(static_spec, list);
+            }
+#line 4913 "./build/cgram.tab.c"
+    break;
+
+  case 159: /* specifier_qualifier_list: type_specifier specifier_qualifier_list  */
+#line 1662 "frontends/c/cgram.y"
+            { yyval = C_ModifySignedUnsigned(yyvsp[-1], yyvsp[0]); }
+#line 4919 "./build/cgram.tab.c"
+    break;
+
+  case 160: /* specifier_qualifier_list: type_specifier  */
+#line 1664 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 4925 "./build/cgram.tab.c"
+    break;
+
+  case 161: /* specifier_qualifier_list: type_qualifier specifier_qualifier_list  */
+#line 1666 "frontends/c/cgram.y"
+            { yyval = yyvsp[-1]; yyval->left = yyvsp[0]; }
+#line 4931 "./build/cgram.tab.c"
+    break;
+
+  case 162: /* specifier_qualifier_list: type_qualifier  */
+#line 1668 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; yyval->left = ast_type_long; }
+#line 4937 "./build/cgram.tab.c"
+    break;
+
+  case 163: /* struct_declarator_list: struct_declarator  */
+#line 1673 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_LISTHOLDER, yyvsp[0], NULL); }
+#line 4943 "./build/cgram.tab.c"
+    break;
+
+  case 164: /* struct_declarator_list: struct_declarator_list ',' struct_declarator  */
+#line 1675 "frontends/c/cgram.y"
+            { yyval = AddToList(yyvsp[-2], NewAST(AST_LISTHOLDER, yyvsp[0], NULL)); }
+#line 4949 "./build/cgram.tab.c"
+    break;
+
+  case 165: /* struct_declarator: declarator  */
+#line 1680 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 4955 "./build/cgram.tab.c"
+    break;
+
+  case 166: /* struct_declarator: ':' constant_expression  */
+#line 1682 "frontends/c/cgram.y"
+            { SYNTAX_ERROR("Empty bitfields not supported yet"); yyval = NULL; }
+#line 4961 "./build/cgram.tab.c"
+    break;
+
+  case 167: /* struct_declarator: declarator ':' constant_expression  */
+#line 1684 "frontends/c/cgram.y"
+            {
+                yyval = NewAST(AST_BITFIELD, yyvsp[-2], yyvsp[0]);
+            }
+#line 4969 "./build/cgram.tab.c"
+    break;
+
+  case 168: /* enum_specifier: "enum" '{' enumerator_list '}'  */
+#line 1691 "frontends/c/cgram.y"
+            { yyval = AddEnumerators(NULL, yyvsp[-1]); }
+#line 4975 "./build/cgram.tab.c"
+    break;
+
+  case 169: /* enum_specifier: "enum" any_identifier '{' enumerator_list '}'  */
+#line 1693 "frontends/c/cgram.y"
+            { yyval = AddEnumerators(yyvsp[-3], yyvsp[-1]); }
+#line 4981 "./build/cgram.tab.c"
+    break;
+
+  case 170: /* enum_specifier: "enum" '{' enumerator_list ',' '}'  */
+#line 1695 "frontends/c/cgram.y"
+            { yyval = AddEnumerators(NULL, yyvsp[-2]); }
+#line 4987 "./build/cgram.tab.c"
+    break;
+
+  case 171: /* enum_specifier: "enum" any_identifier '{' enumerator_list ',' '}'  */
+#line 1697 "frontends/c/cgram.y"
+            { yyval = AddEnumerators(yyvsp[-4], yyvsp[-2]); }
+#line 4993 "./build/cgram.tab.c"
+    break;
+
+  case 172: /* enum_specifier: "enum" any_identifier  */
+#line 1699 "frontends/c/cgram.y"
+            { yyval = ast_type_long; }
+#line 4999 "./build/cgram.tab.c"
+    break;
+
+  case 173: /* enumerator_list: enumerator  */
+#line 1704 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 5005 "./build/cgram.tab.c"
+    break;
+
+  case 174: /* enumerator_list: enumerator_list ',' enumerator  */
+#line 1706 "frontends/c/cgram.y"
+            { yyval = AddToList(yyvsp[-2], yyvsp[0]); }
+#line 5011 "./build/cgram.tab.c"
+    break;
+
+  case 175: /* enumerator: "identifier"  */
+#line 1711 "frontends/c/cgram.y"
+            { yyval = CommentedListHolder(yyvsp[0]); }
+#line 5017 "./build/cgram.tab.c"
+    break;
+
+  case 176: /* enumerator: "identifier" '=' constant_expression  */
+#line 1713 "frontends/c/cgram.y"
+            {
+                AST *setval = NewAST(AST_ENUMSET, yyvsp[0], NULL);
+                AST *id = CommentedListHolder(yyvsp[-2]);
+                setval = NewAST(AST_LISTHOLDER, setval, id);
+                yyval = setval;
+            }
+#line 5028 "./build/cgram.tab.c"
+    break;
+
+  case 177: /* type_qualifier: "const"  */
+#line 1723 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_MODIFIER_CONST, NULL, NULL); }
+#line 5034 "./build/cgram.tab.c"
+    break;
+
+  case 178: /* type_qualifier: "volatile"  */
+#line 1725 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_MODIFIER_VOLATILE, NULL, NULL); }
+#line 5040 "./build/cgram.tab.c"
+    break;
+
+  case 179: /* type_qualifier: "__restrict"  */
+#line 1727 "frontends/c/cgram.y"
+            { yyval = NULL; }
+#line 5046 "./build/cgram.tab.c"
+    break;
+
+  case 180: /* declarator: pointer direct_declarator  */
+#line 1732 "frontends/c/cgram.y"
+            {  yyval = CombinePointer(yyvsp[-1], yyvsp[0]); }
+#line 5052 "./build/cgram.tab.c"
+    break;
+
+  case 181: /* declarator: direct_declarator  */
+#line 1734 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 5058 "./build/cgram.tab.c"
+    break;
+
+  case 182: /* direct_declarator: "identifier"  */
+#line 1739 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 5064 "./build/cgram.tab.c"
+    break;
+
+  case 183: /* direct_declarator: "identifier" "::" "identifier"  */
+#line 1741 "frontends/c/cgram.y"
+            {
+                AST *modname = yyvsp[-2];
+                AST *member = yyvsp[0];
+                yyval = NewAST(AST_METHODREF, modname, member);
+            }
+#line 5074 "./build/cgram.tab.c"
+    break;
+
+  case 184: /* direct_declarator: '(' declarator ')'  */
+#line 1747 "frontends/c/cgram.y"
+            { yyval = yyvsp[-1]; }
+#line 5080 "./build/cgram.tab.c"
+    break;
+
+  case 185: /* direct_declarator: direct_declarator '[' constant_expression ']'  */
+#line 1749 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_ARRAYDECL, yyvsp[-3], yyvsp[-1]); }
+#line 5086 "./build/cgram.tab.c"
+    break;
+
+  case 186: /* direct_declarator: direct_declarator '[' ']'  */
+#line 1751 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_ARRAYDECL, yyvsp[-2], NULL); }
+#line 5092 "./build/cgram.tab.c"
+    break;
+
+  case 187: /* direct_declarator: direct_declarator '(' parameter_type_list ')'  */
+#line 1753 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_DECLARE_VAR, NewAST(AST_FUNCTYPE, NULL, ProcessParamList(yyvsp[-1])), yyvsp[-3]); }
+#line 5098 "./build/cgram.tab.c"
+    break;
+
+  case 188: /* direct_declarator: direct_declarator '(' identifier_list ')'  */
+#line 1755 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_DECLARE_VAR, NewAST(AST_FUNCTYPE, NULL, ProcessParamList(yyvsp[-1])), yyvsp[-3]); }
+#line 5104 "./build/cgram.tab.c"
+    break;
+
+  case 189: /* direct_declarator: direct_declarator '(' ')'  */
+#line 1757 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_DECLARE_VAR, NewAST(AST_FUNCTYPE, NULL, NULL), yyvsp[-2]); }
+#line 5110 "./build/cgram.tab.c"
+    break;
+
+  case 190: /* pointer: '*'  */
+#line 1762 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_PTRTYPE, NULL, NULL); }
+#line 5116 "./build/cgram.tab.c"
+    break;
+
+  case 191: /* pointer: '*' type_qualifier_list  */
+#line 1764 "frontends/c/cgram.y"
+            {
+                yyval = CombinePointer(NewAST(AST_PTRTYPE, NULL, NULL), yyvsp[0]);
+            }
+#line 5124 "./build/cgram.tab.c"
+    break;
+
+  case 192: /* pointer: '*' pointer  */
+#line 1768 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_PTRTYPE, yyvsp[0], NULL); }
+#line 5130 "./build/cgram.tab.c"
+    break;
+
+  case 193: /* pointer: '*' type_qualifier_list pointer  */
+#line 1770 "frontends/c/cgram.y"
+            {
+                AST *q = yyvsp[-1];
+                while (q && q->left)
+                    q = q->left;
+                if (q) q->left = yyvsp[0];
+                yyval = NewAST(AST_PTRTYPE, yyvsp[-1], NULL);
+            }
+#line 5142 "./build/cgram.tab.c"
+    break;
+
+  case 194: /* pointer: '&'  */
+#line 1778 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_REFTYPE, NULL, NULL); }
+#line 5148 "./build/cgram.tab.c"
+    break;
+
+  case 195: /* pointer: '&' type_qualifier_list  */
+#line 1780 "frontends/c/cgram.y"
+            {
+                yyval = CombinePointer(NewAST(AST_REFTYPE, NULL, NULL), yyvsp[0]);
+            }
+#line 5156 "./build/cgram.tab.c"
+    break;
+
+  case 196: /* pointer: '&' pointer  */
+#line 1784 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_REFTYPE, yyvsp[0], NULL); }
+#line 5162 "./build/cgram.tab.c"
+    break;
+
+  case 197: /* pointer: '&' type_qualifier_list pointer  */
+#line 1786 "frontends/c/cgram.y"
+            {
+                AST *q = yyvsp[-1];
+                while (q && q->left)
+                    q = q->left;
+                if (q) q->left = yyvsp[0];
+                yyval = NewAST(AST_REFTYPE, yyvsp[-1], NULL);
+            }
+#line 5174 "./build/cgram.tab.c"
+    break;
+
+  case 198: /* type_qualifier_list: type_qualifier  */
+#line 1797 "frontends/c/cgram.y"
+           { yyval = yyvsp[0]; }
+#line 5180 "./build/cgram.tab.c"
+    break;
+
+  case 199: /* type_qualifier_list: type_qualifier_list type_qualifier  */
+#line 1799 "frontends/c/cgram.y"
+           { yyval = yyvsp[-1]; yyval->left = yyvsp[0]; }
+#line 5186 "./build/cgram.tab.c"
+    break;
+
+  case 200: /* parameter_type_list: parameter_list  */
+#line 1805 "frontends/c/cgram.y"
+           { yyval = yyvsp[0]; }
+#line 5192 "./build/cgram.tab.c"
+    break;
+
+  case 201: /* parameter_type_list: parameter_list ',' "..."  */
+#line 1807 "frontends/c/cgram.y"
+            { yyval = AddToList(yyvsp[-2],
+                             NewAST(AST_LISTHOLDER,
+                                    NewAST(AST_VARARGS, NULL, NULL),
+                                    NULL));
+            }
+#line 5202 "./build/cgram.tab.c"
+    break;
+
+  case 202: /* parameter_list: parameter_declaration  */
+#line 1816 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_LISTHOLDER, yyvsp[0], NULL); }
+#line 5208 "./build/cgram.tab.c"
+    break;
+
+  case 203: /* parameter_list: parameter_list ',' parameter_declaration  */
+#line 1818 "frontends/c/cgram.y"
+            { yyval = AddToList(yyvsp[-2], NewAST(AST_LISTHOLDER, yyvsp[0], NULL)); }
+#line 5214 "./build/cgram.tab.c"
+    break;
+
+  case 204: /* raw_parameter_declaration: declaration_specifiers declarator  */
+#line 1823 "frontends/c/cgram.y"
+            { yyval = SingleDeclareVar(yyvsp[-1], yyvsp[0]); }
+#line 5220 "./build/cgram.tab.c"
+    break;
+
+  case 205: /* raw_parameter_declaration: declaration_specifiers abstract_declarator  */
+#line 1825 "frontends/c/cgram.y"
+            { yyval = SingleDeclareVar(yyvsp[-1], yyvsp[0]); }
+#line 5226 "./build/cgram.tab.c"
+    break;
+
+  case 206: /* raw_parameter_declaration: declaration_specifiers  */
+#line 1827 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 5232 "./build/cgram.tab.c"
+    break;
+
+  case 207: /* parameter_declaration: raw_parameter_declaration opt_param_default  */
+#line 1831 "frontends/c/cgram.y"
+            {
+                AST *assign = yyvsp[0];
+                AST *decl = yyvsp[-1];
+                yyval = ConstructDefaultValue(decl, assign);
+            }
+#line 5242 "./build/cgram.tab.c"
+    break;
+
+  case 208: /* opt_param_default: '=' conditional_expression  */
+#line 1839 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 5248 "./build/cgram.tab.c"
+    break;
+
+  case 209: /* opt_param_default: %empty  */
+#line 1841 "frontends/c/cgram.y"
+            { yyval = NULL; }
+#line 5254 "./build/cgram.tab.c"
+    break;
+
+  case 210: /* identifier_list: "identifier"  */
+#line 1846 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_EXPRLIST, yyvsp[0], NULL); }
+#line 5260 "./build/cgram.tab.c"
+    break;
+
+  case 211: /* identifier_list: identifier_list ',' "identifier"  */
+#line 1848 "frontends/c/cgram.y"
+            { yyval = AddToList(yyvsp[-2], NewAST(AST_EXPRLIST, yyvsp[0], NULL)); }
+#line 5266 "./build/cgram.tab.c"
+    break;
+
+  case 212: /* type_name: specifier_qualifier_list  */
+#line 1853 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 5272 "./build/cgram.tab.c"
+    break;
+
+  case 213: /* type_name: specifier_qualifier_list abstract_declarator  */
+#line 1855 "frontends/c/cgram.y"
+            { yyval = CombineTypes(yyvsp[-1], yyvsp[0], NULL, NULL); }
+#line 5278 "./build/cgram.tab.c"
+    break;
+
+  case 214: /* abstract_declarator: pointer  */
+#line 1860 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 5284 "./build/cgram.tab.c"
+    break;
+
+  case 215: /* abstract_declarator: direct_abstract_declarator  */
+#line 1862 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 5290 "./build/cgram.tab.c"
+    break;
+
+  case 216: /* abstract_declarator: pointer direct_abstract_declarator  */
+#line 1864 "frontends/c/cgram.y"
+            { yyval = CombinePointer(yyvsp[-1], yyvsp[0]); }
+#line 5296 "./build/cgram.tab.c"
+    break;
+
+  case 217: /* direct_abstract_declarator: '(' abstract_declarator ')'  */
+#line 1869 "frontends/c/cgram.y"
+            { yyval = yyvsp[-1]; }
+#line 5302 "./build/cgram.tab.c"
+    break;
+
+  case 218: /* direct_abstract_declarator: '[' ']'  */
+#line 1871 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_ARRAYTYPE, NULL, NULL); }
+#line 5308 "./build/cgram.tab.c"
+    break;
+
+  case 219: /* direct_abstract_declarator: '[' constant_expression ']'  */
+#line 1873 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_ARRAYTYPE, NULL, yyvsp[-1]); }
+#line 5314 "./build/cgram.tab.c"
+    break;
+
+  case 220: /* direct_abstract_declarator: direct_abstract_declarator '[' ']'  */
+#line 1875 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_ARRAYTYPE, yyvsp[-2], NULL); }
+#line 5320 "./build/cgram.tab.c"
+    break;
+
+  case 221: /* direct_abstract_declarator: direct_abstract_declarator '[' constant_expression ']'  */
+#line 1877 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_ARRAYTYPE, yyvsp[-3], yyvsp[-1]); }
+#line 5326 "./build/cgram.tab.c"
+    break;
+
+  case 222: /* direct_abstract_declarator: '(' ')'  */
+#line 1879 "frontends/c/cgram.y"
+            { yyval = NULL; }
+#line 5332 "./build/cgram.tab.c"
+    break;
+
+  case 223: /* direct_abstract_declarator: '(' parameter_type_list ')'  */
+#line 1881 "frontends/c/cgram.y"
+            { yyval = NULL; }
+#line 5338 "./build/cgram.tab.c"
+    break;
+
+  case 224: /* direct_abstract_declarator: direct_abstract_declarator '(' ')'  */
+#line 1883 "frontends/c/cgram.y"
+            { yyval = NULL; }
+#line 5344 "./build/cgram.tab.c"
+    break;
+
+  case 225: /* direct_abstract_declarator: direct_abstract_declarator '(' parameter_type_list ')'  */
+#line 1885 "frontends/c/cgram.y"
+            { yyval = NULL; }
+#line 5350 "./build/cgram.tab.c"
+    break;
+
+  case 226: /* initializer: assignment_expression  */
+#line 1890 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 5356 "./build/cgram.tab.c"
+    break;
+
+  case 227: /* initializer: '{' initializer_list '}'  */
+#line 1892 "frontends/c/cgram.y"
+            { yyval = yyvsp[-1]; }
+#line 5362 "./build/cgram.tab.c"
+    break;
+
+  case 228: /* initializer: '{' initializer_list ',' '}'  */
+#line 1894 "frontends/c/cgram.y"
+            { yyval = yyvsp[-2]; }
+#line 5368 "./build/cgram.tab.c"
+    break;
+
+  case 229: /* initializer_list: initializer  */
+#line 1899 "frontends/c/cgram.y"
+            {
+                AST *ast = NewAST(AST_EXPRLIST, yyvsp[0], NULL);
+                yyval = ast;
+            }
+#line 5377 "./build/cgram.tab.c"
+    break;
+
+  case 230: /* initializer_list: designation initializer  */
+#line 1904 "frontends/c/cgram.y"
+            {
+                AST *desig = yyvsp[-1];
+                AST *initval = yyvsp[0];
+                AST *ast;
+
+                ast = NewAST(AST_INITMODIFIER, desig, initval);
+                ast = NewAST(AST_EXPRLIST, ast, NULL);
+                yyval = ast;
+            }
+#line 5391 "./build/cgram.tab.c"
+    break;
+
+  case 231: /* initializer_list: initializer_list ',' initializer  */
+#line 1914 "frontends/c/cgram.y"
+            {
+                AST *list = yyvsp[-2];
+                AST *ast = yyvsp[0];
+                ast = NewAST(AST_EXPRLIST, ast, NULL);
+                yyval = AddToListEx(list, ast, (AST **)&list->d.ptr);
+            }
+#line 5402 "./build/cgram.tab.c"
+    break;
+
+  case 232: /* initializer_list: initializer_list ',' designation initializer  */
+#line 1921 "frontends/c/cgram.y"
+            {
+                AST *list = yyvsp[-3];
+                AST *desig = yyvsp[-1];
+                AST *initval = yyvsp[0];
+                AST *ast;
+                
+                ast = NewAST(AST_INITMODIFIER, desig, initval);
+                ast = NewAST(AST_EXPRLIST, ast, NULL);
+                yyval = AddToListEx(list, ast, (AST **)&list->d.ptr);
+            }
+#line 5417 "./build/cgram.tab.c"
+    break;
+
+  case 233: /* designation: designator_list '='  */
+#line 1935 "frontends/c/cgram.y"
+            { yyval = yyvsp[-1]; }
+#line 5423 "./build/cgram.tab.c"
+    break;
+
+  case 234: /* designator_list: designator  */
+#line 1944 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 5429 "./build/cgram.tab.c"
+    break;
+
+  case 235: /* designator_list: designator_list designator  */
+#line 1946 "frontends/c/cgram.y"
+            {
+                AST *upper = yyvsp[-1];
+                AST *lower = yyvsp[0];
+                upper->left = lower;
+                yyval = upper;
+            }
+#line 5440 "./build/cgram.tab.c"
+    break;
+
+  case 236: /* designator: '[' constant_expression ']'  */
+#line 1956 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_ARRAYREF, NULL, yyvsp[-1]); }
+#line 5446 "./build/cgram.tab.c"
+    break;
+
+  case 237: /* designator: '.' any_identifier  */
+#line 1958 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_METHODREF, NULL, yyvsp[0]); }
+#line 5452 "./build/cgram.tab.c"
+    break;
+
+  case 246: /* labeled_statement: any_identifier ':' statement  */
+#line 1974 "frontends/c/cgram.y"
+            {
+                AST *label = NewAST(AST_LABEL, LabelName(yyvsp[-2]), NULL);
+                yyval = NewAST(AST_STMTLIST, label,
+                              NewAST(AST_STMTLIST, yyvsp[0], NULL));
+            }
+#line 5462 "./build/cgram.tab.c"
+    break;
+
+  case 247: /* labeled_statement: "case" constant_expression "..." constant_expression ':' statement  */
+#line 1980 "frontends/c/cgram.y"
+            {
+                AST *stmt = yyvsp[0];
+                AST *range = NewAST(AST_RANGE, yyvsp[-4], yyvsp[-2]);
+                range = NewAST(AST_EXPRLIST, range, NULL);
+                yyval = NewAST(AST_CASEITEM, range, stmt);
+            }
+#line 5473 "./build/cgram.tab.c"
+    break;
+
+  case 248: /* labeled_statement: "case" constant_expression ':' statement  */
+#line 1987 "frontends/c/cgram.y"
+            {
+                AST *range = yyvsp[-2];
+                AST *stmt = yyvsp[0];
+                range = NewAST(AST_EXPRLIST, range, NULL);
+                yyval = NewAST(AST_CASEITEM, range, stmt);
+            }
+#line 5484 "./build/cgram.tab.c"
+    break;
+
+  case 249: /* labeled_statement: "default" ':' statement  */
+#line 1994 "frontends/c/cgram.y"
+            {
+                yyval = NewAST(AST_OTHER, yyvsp[0], NULL);
+            }
+#line 5492 "./build/cgram.tab.c"
+    break;
+
+  case 250: /* compound_statement: compound_statement_open compound_statement_close  */
+#line 2001 "frontends/c/cgram.y"
+            { yyval = NULL; }
+#line 5498 "./build/cgram.tab.c"
+    break;
+
+  case 251: /* compound_statement: compound_statement_open block_item_list compound_statement_close  */
+#line 2003 "frontends/c/cgram.y"
+            { yyval = yyvsp[-1]; }
+#line 5504 "./build/cgram.tab.c"
+    break;
+
+  case 252: /* compound_statement_open: '{'  */
+#line 2008 "frontends/c/cgram.y"
+    { PushCurrentTypes(); }
+#line 5510 "./build/cgram.tab.c"
+    break;
+
+  case 253: /* compound_statement_close: '}'  */
+#line 2013 "frontends/c/cgram.y"
+    { PopCurrentTypes(); }
+#line 5516 "./build/cgram.tab.c"
+    break;
+
+  case 254: /* for_statement_start: "for"  */
+#line 2018 "frontends/c/cgram.y"
+  { PushCurrentTypes(); }
+#line 5522 "./build/cgram.tab.c"
+    break;
+
+  case 255: /* block_item_list: block_item  */
+#line 2023 "frontends/c/cgram.y"
+       { yyval = yyvsp[0]; }
+#line 5528 "./build/cgram.tab.c"
+    break;
+
+  case 256: /* block_item_list: block_item_list block_item  */
+#line 2025 "frontends/c/cgram.y"
+       { yyval = AddToList(yyvsp[-1], yyvsp[0]); }
+#line 5534 "./build/cgram.tab.c"
+    break;
+
+  case 257: /* block_item: declaration  */
+#line 2030 "frontends/c/cgram.y"
+       {
+           AST *decl = MakeDeclarations(yyvsp[0], currentTypes);
+           yyval = decl;
+       }
+#line 5543 "./build/cgram.tab.c"
+    break;
+
+  case 258: /* block_item: statement  */
+#line 2035 "frontends/c/cgram.y"
+       { yyval = NewAST(AST_STMTLIST, yyvsp[0], NULL); }
+#line 5549 "./build/cgram.tab.c"
+    break;
+
+  case 259: /* asm_statement: "__asm" opt_asm_volatile '{' asmlist '}'  */
+#line 2040 "frontends/c/cgram.y"
+    {
+        AST *asmcode;
+        AST *vol = yyvsp[-3];
+        asmcode = NewAST(AST_INLINEASM, yyvsp[-1], vol);
+        yyval = asmcode;
+    }
+#line 5560 "./build/cgram.tab.c"
+    break;
+
+  case 260: /* asm_statement: "__asm" opt_asm_volatile "end of line" '{' asmlist '}'  */
+#line 2047 "frontends/c/cgram.y"
+    {
+        AST *asmcode;
+        AST *vol = yyvsp[-4];
+        asmcode = NewAST(AST_INLINEASM, yyvsp[-1], vol);
+        yyval = asmcode;
+    }
+#line 5571 "./build/cgram.tab.c"
+    break;
+
+  case 261: /* opt_asm_volatile: %empty  */
+#line 2057 "frontends/c/cgram.y"
+    { yyval = 0; }
+#line 5577 "./build/cgram.tab.c"
+    break;
+
+  case 262: /* opt_asm_volatile: "volatile"  */
+#line 2059 "frontends/c/cgram.y"
+    { yyval = AstInteger(3); }
+#line 5583 "./build/cgram.tab.c"
+    break;
+
+  case 263: /* opt_asm_volatile: "const"  */
+#line 2061 "frontends/c/cgram.y"
+    { yyval = AstInteger(1); }
+#line 5589 "./build/cgram.tab.c"
+    break;
+
+  case 264: /* top_asm: "__asm" '{' asmlist '}'  */
+#line 2066 "frontends/c/cgram.y"
+      { yyval = current->datblock = AddToListEx(current->datblock, yyvsp[-1], &current->datblock_tail); }
+#line 5595 "./build/cgram.tab.c"
+    break;
+
+  case 265: /* top_asm: "__asm" "end of line" '{' asmlist '}'  */
+#line 2068 "frontends/c/cgram.y"
+      { yyval = current->datblock = AddToListEx(current->datblock, yyvsp[-1], &current->datblock_tail); }
+#line 5601 "./build/cgram.tab.c"
+    break;
+
+  case 266: /* asmlist: asmline  */
+#line 2073 "frontends/c/cgram.y"
+  { yyval = yyvsp[0]; }
+#line 5607 "./build/cgram.tab.c"
+    break;
+
+  case 267: /* asmlist: asmlist asmline  */
+#line 2075 "frontends/c/cgram.y"
+  { yyval = AddToList(yyvsp[-1], yyvsp[0]); }
+#line 5613 "./build/cgram.tab.c"
+    break;
+
+  case 269: /* asmline: "identifier" asm_baseline  */
+#line 2081 "frontends/c/cgram.y"
+    {   AST *linebreak;
+        AST *comment = GetComments();
+        AST *ast;
+        ast = yyvsp[-1];
+        if (comment && (comment->d.string || comment->kind == AST_SRCCOMMENT)) {
+            linebreak = NewCommentedAST(AST_LINEBREAK, NULL, NULL, comment);
+        } else {
+            linebreak = NewAST(AST_LINEBREAK, NULL, NULL);
+        }
+        ast = AddToList(ast, yyvsp[0]);
+        ast = AddToList(linebreak, ast);
+        yyval = ast;
+    }
+#line 5631 "./build/cgram.tab.c"
+    break;
+
+  case 272: /* asm_baseline: asm_eoln  */
+#line 2103 "frontends/c/cgram.y"
+    { yyval = NULL; }
+#line 5637 "./build/cgram.tab.c"
+    break;
+
+  case 273: /* asm_baseline: error asm_eoln  */
+#line 2105 "frontends/c/cgram.y"
+    { yyval = NULL; }
+#line 5643 "./build/cgram.tab.c"
+    break;
+
+  case 274: /* asm_baseline: "byte" asm_eoln  */
+#line 2107 "frontends/c/cgram.y"
+    { yyval = NewCommentedAST(AST_BYTELIST, NULL, NULL, yyvsp[-1]); }
+#line 5649 "./build/cgram.tab.c"
+    break;
+
+  case 275: /* asm_baseline: "byte" asm_operandlist asm_eoln  */
+#line 2109 "frontends/c/cgram.y"
+    { yyval = NewCommentedAST(AST_BYTELIST, yyvsp[-1], NULL, yyvsp[-2]); }
+#line 5655 "./build/cgram.tab.c"
+    break;
+
+  case 276: /* asm_baseline: "word" asm_eoln  */
+#line 2111 "frontends/c/cgram.y"
+    { yyval = NewCommentedAST(AST_WORDLIST, NULL, NULL, yyvsp[-1]); }
+#line 5661 "./build/cgram.tab.c"
+    break;
+
+  case 277: /* asm_baseline: "word" asm_operandlist asm_eoln  */
+#line 2113 "frontends/c/cgram.y"
+    { yyval = NewCommentedAST(AST_WORDLIST, yyvsp[-1], NULL, yyvsp[-2]); }
+#line 5667 "./build/cgram.tab.c"
+    break;
+
+  case 278: /* asm_baseline: "long" asm_eoln  */
+#line 2115 "frontends/c/cgram.y"
+    { yyval = NewCommentedAST(AST_LONGLIST, NULL, NULL, yyvsp[-1]); }
+#line 5673 "./build/cgram.tab.c"
+    break;
+
+  case 279: /* asm_baseline: "long" asm_operandlist asm_eoln  */
+#line 2117 "frontends/c/cgram.y"
+    { yyval = NewCommentedAST(AST_LONGLIST, yyvsp[-1], NULL, yyvsp[-2]); }
+#line 5679 "./build/cgram.tab.c"
+    break;
+
+  case 280: /* asm_baseline: instruction asm_eoln  */
+#line 2119 "frontends/c/cgram.y"
+    { yyval = NewCommentedInstr(yyvsp[-1]); }
+#line 5685 "./build/cgram.tab.c"
+    break;
+
+  case 281: /* asm_baseline: instruction asm_operandlist asm_eoln  */
+#line 2121 "frontends/c/cgram.y"
+    { yyval = NewCommentedInstr(AddToList(yyvsp[-2], yyvsp[-1])); }
+#line 5691 "./build/cgram.tab.c"
+    break;
+
+  case 282: /* asm_baseline: instruction modifierlist asm_eoln  */
+#line 2123 "frontends/c/cgram.y"
+    { yyval = NewCommentedInstr(AddToList(yyvsp[-2], yyvsp[-1])); }
+#line 5697 "./build/cgram.tab.c"
+    break;
+
+  case 283: /* asm_baseline: instruction asm_operandlist modifierlist asm_eoln  */
+#line 2125 "frontends/c/cgram.y"
+    { yyval = NewCommentedInstr(AddToList(yyvsp[-3], AddToList(yyvsp[-2], yyvsp[-1]))); }
+#line 5703 "./build/cgram.tab.c"
+    break;
+
+  case 284: /* asm_baseline: "alignl" asm_eoln  */
+#line 2127 "frontends/c/cgram.y"
+    { yyval = NewCommentedAST(AST_ALIGN, AstInteger(4), NULL, yyvsp[-1]); }
+#line 5709 "./build/cgram.tab.c"
+    break;
+
+  case 285: /* asm_baseline: "alignw" asm_eoln  */
+#line 2129 "frontends/c/cgram.y"
+    { yyval = NewCommentedAST(AST_ALIGN, AstInteger(2), NULL, yyvsp[-1]); }
+#line 5715 "./build/cgram.tab.c"
+    break;
+
+  case 286: /* asm_baseline: "org" asm_eoln  */
+#line 2131 "frontends/c/cgram.y"
+    { yyval = NewCommentedAST(AST_ORG, NULL, NULL, yyvsp[-1]); }
+#line 5721 "./build/cgram.tab.c"
+    break;
+
+  case 287: /* asm_baseline: "org" asmexpr asm_eoln  */
+#line 2133 "frontends/c/cgram.y"
+    { yyval = NewCommentedAST(AST_ORG, yyvsp[-1], NULL, yyvsp[-2]); }
+#line 5727 "./build/cgram.tab.c"
+    break;
+
+  case 288: /* asm_baseline: "orgh" asm_eoln  */
+#line 2135 "frontends/c/cgram.y"
+    { yyval = NewCommentedAST(AST_ORGH, NULL, NULL, yyvsp[-1]); }
+#line 5733 "./build/cgram.tab.c"
+    break;
+
+  case 289: /* asm_baseline: "orgh" asmexpr asm_eoln  */
+#line 2137 "frontends/c/cgram.y"
+    { yyval = NewCommentedAST(AST_ORGH, yyvsp[-1], NULL, yyvsp[-2]); }
+#line 5739 "./build/cgram.tab.c"
+    break;
+
+  case 290: /* asm_baseline: "orgf" asmexpr asm_eoln  */
+#line 2139 "frontends/c/cgram.y"
+    { yyval = NewCommentedAST(AST_ORGF, yyvsp[-1], NULL, yyvsp[-2]); }
+#line 5745 "./build/cgram.tab.c"
+    break;
+
+  case 291: /* asm_baseline: "res" asmexpr asm_eoln  */
+#line 2141 "frontends/c/cgram.y"
+    { yyval = NewCommentedAST(AST_RES, yyvsp[-1], NULL, yyvsp[-2]); }
+#line 5751 "./build/cgram.tab.c"
+    break;
+
+  case 292: /* asm_baseline: "fit" asmexpr asm_eoln  */
+#line 2143 "frontends/c/cgram.y"
+    { yyval = NewCommentedAST(AST_FIT, yyvsp[-1], NULL, yyvsp[-2]); }
+#line 5757 "./build/cgram.tab.c"
+    break;
+
+  case 293: /* asm_baseline: "fit" asm_eoln  */
+#line 2145 "frontends/c/cgram.y"
+    { yyval = NewCommentedAST(AST_FIT, AstInteger(0x1f0), NULL, yyvsp[-1]); }
+#line 5763 "./build/cgram.tab.c"
+    break;
+
+  case 294: /* asm_baseline: "file" "string literal" asm_eoln  */
+#line 2147 "frontends/c/cgram.y"
+    { yyval = NewCommentedAST(AST_FILE, GetFullFileName(yyvsp[-1]), NULL, yyvsp[-2]); }
+#line 5769 "./build/cgram.tab.c"
+    break;
+
+  case 295: /* asm_operand: asmexpr  */
+#line 2152 "frontends/c/cgram.y"
+   { yyval = NewAST(AST_EXPRLIST, yyvsp[0], NULL); }
+#line 5775 "./build/cgram.tab.c"
+    break;
+
+  case 296: /* asm_operand: '#' asmexpr  */
+#line 2154 "frontends/c/cgram.y"
+   { yyval = NewAST(AST_EXPRLIST, NewAST(AST_IMMHOLDER, yyvsp[0], NULL), NULL); }
+#line 5781 "./build/cgram.tab.c"
+    break;
+
+  case 297: /* asm_operand: '#' '#' asmexpr  */
+#line 2156 "frontends/c/cgram.y"
+   { yyval = NewAST(AST_EXPRLIST, NewAST(AST_BIGIMMHOLDER, yyvsp[0], NULL), NULL); }
+#line 5787 "./build/cgram.tab.c"
+    break;
+
+  case 298: /* asm_operand: asmexpr '[' asmexpr ']'  */
+#line 2158 "frontends/c/cgram.y"
+   { yyval = NewAST(AST_EXPRLIST, NewAST(AST_ARRAYREF, yyvsp[-3], yyvsp[-1]), NULL); }
+#line 5793 "./build/cgram.tab.c"
+    break;
+
+  case 299: /* asm_operandlist: asm_operand  */
+#line 2163 "frontends/c/cgram.y"
+   { yyval = yyvsp[0]; }
+#line 5799 "./build/cgram.tab.c"
+    break;
+
+  case 300: /* asm_operandlist: asm_operandlist ',' asm_operand  */
+#line 2165 "frontends/c/cgram.y"
+   { yyval = AddToList(yyvsp[-2], yyvsp[0]); }
+#line 5805 "./build/cgram.tab.c"
+    break;
+
+  case 301: /* asmexpr: conditional_expression  */
+#line 2170 "frontends/c/cgram.y"
+    { yyval = yyvsp[0]; }
+#line 5811 "./build/cgram.tab.c"
+    break;
+
+  case 302: /* asmexpr: '\\' conditional_expression  */
+#line 2172 "frontends/c/cgram.y"
+    { yyval = AstCatch(yyvsp[0]); }
+#line 5817 "./build/cgram.tab.c"
+    break;
+
+  case 303: /* instruction: "asm instruction"  */
+#line 2177 "frontends/c/cgram.y"
+  { yyval = yyvsp[0]; }
+#line 5823 "./build/cgram.tab.c"
+    break;
+
+  case 304: /* instruction: instrmodifier instruction  */
+#line 2179 "frontends/c/cgram.y"
+  { yyval = AddToList(yyvsp[0], yyvsp[-1]); }
+#line 5829 "./build/cgram.tab.c"
+    break;
+
+  case 305: /* instrmodifier: "instruction modifier"  */
+#line 2184 "frontends/c/cgram.y"
+  { yyval = yyvsp[0]; }
+#line 5835 "./build/cgram.tab.c"
+    break;
+
+  case 306: /* modifierlist: instrmodifier  */
+#line 2189 "frontends/c/cgram.y"
+    { yyval = yyvsp[0]; }
+#line 5841 "./build/cgram.tab.c"
+    break;
+
+  case 307: /* modifierlist: modifierlist instrmodifier  */
+#line 2191 "frontends/c/cgram.y"
+    { yyval = AddToList(yyvsp[-1], yyvsp[0]); }
+#line 5847 "./build/cgram.tab.c"
+    break;
+
+  case 308: /* modifierlist: modifierlist ',' instrmodifier  */
+#line 2193 "frontends/c/cgram.y"
+    { yyval = AddToList(yyvsp[-2], yyvsp[0]); }
+#line 5853 "./build/cgram.tab.c"
+    break;
+
+  case 309: /* func_declaration_list: declaration  */
+#line 2198 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 5859 "./build/cgram.tab.c"
+    break;
+
+  case 310: /* func_declaration_list: declaration_list declaration  */
+#line 2200 "frontends/c/cgram.y"
+            { yyval = AddToList(yyvsp[-1], yyvsp[0]); }
+#line 5865 "./build/cgram.tab.c"
+    break;
+
+  case 311: /* declaration_list: declaration  */
+#line 2205 "frontends/c/cgram.y"
+            { yyval = MakeDeclarations(yyvsp[0], currentTypes); }
+#line 5871 "./build/cgram.tab.c"
+    break;
+
+  case 312: /* declaration_list: declaration_list declaration  */
+#line 2207 "frontends/c/cgram.y"
+            { yyval = AddToList(yyvsp[-1], MakeDeclarations(yyvsp[0], currentTypes)); }
+#line 5877 "./build/cgram.tab.c"
+    break;
+
+  case 313: /* expression_statement: ';'  */
+#line 2212 "frontends/c/cgram.y"
+            { yyval = NULL; }
+#line 5883 "./build/cgram.tab.c"
+    break;
+
+  case 314: /* expression_statement: expression ';'  */
+#line 2214 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_STMTLIST, yyvsp[-1], NULL); }
+#line 5889 "./build/cgram.tab.c"
+    break;
+
+  case 315: /* selection_statement: "if" '(' expression ')' statement  */
+#line 2219 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_IF, yyvsp[-2],
+                          NewAST(AST_THENELSE, ForceStatementList(yyvsp[0]), NULL)); }
+#line 5896 "./build/cgram.tab.c"
+    break;
+
+  case 316: /* selection_statement: "if" '(' expression ')' statement "else" statement  */
+#line 2222 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_IF, yyvsp[-4],
+                          NewAST(AST_THENELSE, ForceStatementList(yyvsp[-2]), ForceStatementList(yyvsp[0])));
+            }
+#line 5904 "./build/cgram.tab.c"
+    break;
+
+  case 317: /* selection_statement: "switch" '(' expression ')' statement  */
+#line 2226 "frontends/c/cgram.y"
+            {
+                yyval = NewCommentedAST(AST_CASE, yyvsp[-2], yyvsp[0], yyvsp[-4]);
+            }
+#line 5912 "./build/cgram.tab.c"
+    break;
+
+  case 318: /* iteration_statement: "while" '(' expression ')' statement  */
+#line 2233 "frontends/c/cgram.y"
+            { AST *body = ForceStatementList(CheckYield(yyvsp[0]));
+              yyval = NewCommentedAST(AST_WHILE, yyvsp[-2], body, yyvsp[-4]);
+            }
+#line 5920 "./build/cgram.tab.c"
+    break;
+
+  case 319: /* iteration_statement: "do" statement "while" '(' expression ')' ';'  */
+#line 2237 "frontends/c/cgram.y"
+            { AST *body = ForceStatementList(CheckYield(yyvsp[-5]));
+              yyval = NewCommentedAST(AST_DOWHILE, yyvsp[-2], body, yyvsp[-6]);
+            }
+#line 5928 "./build/cgram.tab.c"
+    break;
+
+  case 320: /* iteration_statement: for_statement_start '(' expression_statement expression_statement ')' statement  */
+#line 2241 "frontends/c/cgram.y"
+            {   AST *body = ForceStatementList(CheckYield(yyvsp[0]));
+                AST *init = yyvsp[-3];
+                AST *cond = yyvsp[-2];
+                AST *update = NULL;
+                AST *stepstmt, *condtest;
+                if (init && init->kind == AST_STMTLIST && !init->right) {
+                    init = init->left;
+                }
+                if (cond && cond->kind == AST_STMTLIST && !cond->right) {
+                    cond = cond->left;
+                }
+                stepstmt = NewAST(AST_STEP, update, body);
+                condtest = NewAST(AST_TO, cond, stepstmt);
+                yyval = NewCommentedAST(AST_FOR, init, condtest, yyvsp[-5]);
+                PopCurrentTypes();
+            }
+#line 5949 "./build/cgram.tab.c"
+    break;
+
+  case 321: /* iteration_statement: for_statement_start '(' expression_statement expression_statement expression ')' statement  */
+#line 2258 "frontends/c/cgram.y"
+            {   AST *body = ForceStatementList(CheckYield(yyvsp[0]));
+                AST *init = yyvsp[-4];
+                AST *cond = yyvsp[-3];
+                AST *update = yyvsp[-2];
+                AST *stepstmt, *condtest;
+                if (init && init->kind == AST_STMTLIST && !init->right) {
+                    init = init->left;
+                }
+                if (cond && cond->kind == AST_STMTLIST && !cond->right) {
+                    cond = cond->left;
+                }
+                stepstmt = NewAST(AST_STEP, update, body);
+                condtest = NewAST(AST_TO, cond, stepstmt);
+                yyval = NewCommentedAST(AST_FOR, init, condtest, yyvsp[-6]);
+                PopCurrentTypes();
+            }
+#line 5970 "./build/cgram.tab.c"
+    break;
+
+  case 322: /* iteration_statement: for_statement_start '(' for_declaration expression_statement ')' statement  */
+#line 2275 "frontends/c/cgram.y"
+            {   AST *body = ForceStatementList(CheckYield(yyvsp[0]));
+                AST *init = yyvsp[-3];
+                AST *cond = yyvsp[-2];
+                AST *update = NULL;
+                AST *stepstmt, *condtest;
+                if (init && init->kind == AST_STMTLIST && !init->right) {
+                    init = init->left;
+                }
+                if (cond && cond->kind == AST_STMTLIST && !cond->right) {
+                    cond = cond->left;
+                }
+                stepstmt = NewAST(AST_STEP, update, body);
+                condtest = NewAST(AST_TO, cond, stepstmt);
+                body = NewCommentedAST(AST_FOR, NULL, condtest, yyvsp[-5]);
+                init = NewAST(AST_STMTLIST, init,
+                              NewAST(AST_STMTLIST, body, NULL));
+                yyval = NewAST(AST_SCOPE, init, NULL);
+                PopCurrentTypes();
+            }
+#line 5994 "./build/cgram.tab.c"
+    break;
+
+  case 323: /* iteration_statement: for_statement_start '(' for_declaration expression_statement expression ')' statement  */
+#line 2295 "frontends/c/cgram.y"
+            {   AST *body = ForceStatementList(CheckYield(yyvsp[0]));
+                AST *init = yyvsp[-4];
+                AST *cond = yyvsp[-3];
+                AST *update = yyvsp[-2];
+                AST *stepstmt, *condtest;
+                if (init && init->kind == AST_STMTLIST && !init->right) {
+                    init = init->left;
+                }
+                if (cond && cond->kind == AST_STMTLIST && !cond->right) {
+                    cond = cond->left;
+                }
+                stepstmt = NewAST(AST_STEP, update, body);
+                condtest = NewAST(AST_TO, cond, stepstmt);
+                body = NewCommentedAST(AST_FOR, NULL, condtest, yyvsp[-6]);
+                init = NewAST(AST_STMTLIST, init,
+                              NewAST(AST_STMTLIST, body, NULL));
+                yyval = NewAST(AST_SCOPE, init, NULL);
+                PopCurrentTypes();
+            }
+#line 6018 "./build/cgram.tab.c"
+    break;
+
+  case 324: /* for_declaration: declaration  */
+#line 2317 "frontends/c/cgram.y"
+          { yyval = MakeDeclarations(yyvsp[0], currentTypes); }
+#line 6024 "./build/cgram.tab.c"
+    break;
+
+  case 325: /* jump_statement: "goto" any_identifier ';'  */
+#line 2322 "frontends/c/cgram.y"
+            { yyval = NewCommentedAST(AST_GOTO, LabelName(yyvsp[-1]), NULL, yyvsp[-2]); }
+#line 6030 "./build/cgram.tab.c"
+    break;
+
+  case 326: /* jump_statement: "continue" ';'  */
+#line 2324 "frontends/c/cgram.y"
+            { yyval = NewCommentedAST(AST_CONTINUE, NULL, NULL, yyvsp[-1]); }
+#line 6036 "./build/cgram.tab.c"
+    break;
+
+  case 327: /* jump_statement: "break" ';'  */
+#line 2326 "frontends/c/cgram.y"
+            { yyval = NewCommentedAST(AST_ENDCASE, NULL, NULL, yyvsp[-1]); }
+#line 6042 "./build/cgram.tab.c"
+    break;
+
+  case 328: /* jump_statement: "return" ';'  */
+#line 2328 "frontends/c/cgram.y"
+            { yyval = NewCommentedAST(AST_RETURN, NULL, NULL, yyvsp[-1]); }
+#line 6048 "./build/cgram.tab.c"
+    break;
+
+  case 329: /* jump_statement: "return" expression ';'  */
+#line 2330 "frontends/c/cgram.y"
+            { yyval = NewCommentedAST(AST_RETURN, yyvsp[-1], NULL, yyvsp[-2]); }
+#line 6054 "./build/cgram.tab.c"
+    break;
+
+  case 330: /* jump_statement: "throw" expression ';'  */
+#line 2332 "frontends/c/cgram.y"
+            { yyval = NewCommentedAST(AST_THROW, yyvsp[-1], NULL, yyvsp[-2]); }
+#line 6060 "./build/cgram.tab.c"
+    break;
+
+  case 331: /* jump_statement: "__throwifcaught" expression ';'  */
+#line 2334 "frontends/c/cgram.y"
+          {
+              AST *top = NewCommentedAST(AST_THROW, yyvsp[-1], NULL, yyvsp[-2]);
+              AST *throwit;
+              if (top && top->kind != AST_THROW) {
+                  throwit = top->left;
+              } else {
+                  throwit = top;
+              }
+              throwit->d.ival = 1;
+              yyval = top;
+          }
+#line 6076 "./build/cgram.tab.c"
+    break;
+
+  case 332: /* try_statement: "try" compound_statement handler_sequence  */
+#line 2349 "frontends/c/cgram.y"
+          {
+              AST *tryblock = yyvsp[-1];
+              AST *catchlist = yyvsp[0];
+              AST *catchseq;
+              AST *catchvar, *catchblock, *catchdecl;
+              AST *try_if = NULL;
+              AST *trytest;
+
+              while (catchlist) {
+                  catchseq = catchlist->left;
+                  catchlist = catchlist->right;
+                  catchdecl = catchseq->left;
+                  catchblock = catchseq->right;
+
+                  catchvar = catchdecl->left->right;
+                  catchblock = NewAST(AST_STMTLIST, AstAssign(catchvar, NewAST(AST_CATCHRESULT, NULL, NULL)), catchblock);
+                  catchblock = NewAST(AST_STMTLIST, catchdecl, catchblock);
+
+                  trytest = NewAST(AST_SETJMP, NULL, NULL);
+                  try_if = NewAST(AST_IF,
+                                  AstOperator(K_EQ, trytest, AstInteger(0)),
+                                  NewAST(AST_THENELSE, tryblock, catchblock));
+                  try_if = NewCommentedStatement(try_if);
+                  tryblock = NewAST(AST_TRYENV, try_if, NULL);
+              }
+              yyval = tryblock;
+          }
+#line 6108 "./build/cgram.tab.c"
+    break;
+
+  case 333: /* handler_sequence: handler_item  */
+#line 2380 "frontends/c/cgram.y"
+          { yyval = NewAST(AST_LISTHOLDER, yyvsp[0], NULL); }
+#line 6114 "./build/cgram.tab.c"
+    break;
+
+  case 334: /* handler_sequence: handler_sequence handler_item  */
+#line 2382 "frontends/c/cgram.y"
+          {
+              AST *last = NewAST(AST_LISTHOLDER, yyvsp[0], NULL);
+              yyval = AddToList(yyvsp[-1], last);
+          }
+#line 6123 "./build/cgram.tab.c"
+    break;
+
+  case 335: /* handler_item: "catch" push_current_types '(' handler_declarator ')' compound_statement pop_current_types  */
+#line 2390 "frontends/c/cgram.y"
+          {
+              AST *declarator = yyvsp[-3];
+              AST *block = yyvsp[-1];
+              // NOTE: the declarator is wrapped in a stmtlist
+              yyval = NewAST(AST_SEQUENCE, declarator, block);
+          }
+#line 6134 "./build/cgram.tab.c"
+    break;
+
+  case 336: /* push_current_types: %empty  */
+#line 2399 "frontends/c/cgram.y"
+          { PushCurrentTypes(); }
+#line 6140 "./build/cgram.tab.c"
+    break;
+
+  case 337: /* pop_current_types: %empty  */
+#line 2402 "frontends/c/cgram.y"
+          { PopCurrentTypes(); }
+#line 6146 "./build/cgram.tab.c"
+    break;
+
+  case 338: /* handler_declarator: raw_parameter_declaration  */
+#line 2407 "frontends/c/cgram.y"
+          {
+              AST *decl = MakeDeclarations(yyvsp[0], currentTypes);
+              yyval = decl;
+          }
+#line 6155 "./build/cgram.tab.c"
+    break;
+
+  case 339: /* handler_declarator: "..."  */
+#line 2412 "frontends/c/cgram.y"
+          {
+              AST *var = AstTempIdentifier("catch");
+              var = NewAST(AST_DECLARE_VAR, ast_type_generic, var);
+              yyval = var;
+          }
+#line 6165 "./build/cgram.tab.c"
+    break;
+
+  case 345: /* external_declaration: declaration  */
+#line 2429 "frontends/c/cgram.y"
+           { DeclareCGlobalVariables(yyvsp[0]); }
+#line 6171 "./build/cgram.tab.c"
+    break;
+
+  case 346: /* function_definition: declaration_specifiers declarator func_declaration_list compound_statement  */
+#line 2434 "frontends/c/cgram.y"
+            {
+                AST *type = yyvsp[-3];
+                AST *decl = yyvsp[-2];
+                AST *decl_list = yyvsp[-1];
+                AST *body = yyvsp[0];
+                AST *ident = NULL;
+                Module *module = NULL;
+                int is_public = 1;
+
+                decl = MergeOldStyleDeclarationList(decl, decl_list);
+                type = CombineTypes(type, decl, &ident, &module);
+                if (module) {
+                    ERROR(decl, ":: not supported yet for old style functions");
+                }
+                DeclareCTypedFunction(current, type, ident, is_public, body, NULL);
+            }
+#line 6192 "./build/cgram.tab.c"
+    break;
+
+  case 347: /* function_definition: declaration_specifiers declarator attribute_decl compound_statement_or_fromfile  */
+#line 2451 "frontends/c/cgram.y"
+            {
+                AST *type = yyvsp[-3];
+                AST *decl = yyvsp[-2];
+                AST *anno = yyvsp[-1];
+                AST *body = yyvsp[0];
+                AST *ident = NULL;
+                Module *module = NULL;
+                int is_public = 1;
+                type = CombineTypes(type, decl, &ident, &module);
+                if (module) {
+                    DeclareCTypedFunction(module, type, ident, is_public, body, anno);
+                } else {
+                    DeclareCTypedFunction(current, type, ident, is_public, body, anno);
+                }
+            }
+#line 6212 "./build/cgram.tab.c"
+    break;
+
+  case 348: /* function_definition: declarator func_declaration_list compound_statement_or_fromfile  */
+#line 2467 "frontends/c/cgram.y"
+            {
+                AST *type;
+                AST *ident = NULL;
+                Module *module = NULL;
+                AST *decl = yyvsp[-2];
+                AST *decl_list = yyvsp[-1];
+                AST *body = yyvsp[0];
+                int is_public = 1;
+                decl = MergeOldStyleDeclarationList(decl, decl_list);
+                type = CombineTypes(NULL, decl, &ident, &module);
+                if (module) {
+                    ERROR(decl, ":: not allowed with old style function declarations");
+                }
+                DeclareCTypedFunction(current, type, ident, is_public, body, NULL);
+            }
+#line 6232 "./build/cgram.tab.c"
+    break;
+
+  case 349: /* function_definition: declarator attribute_decl compound_statement_or_fromfile  */
+#line 2483 "frontends/c/cgram.y"
+            {
+                AST *type;
+                AST *ident = NULL;
+                Module *module = NULL;
+                AST *decl = yyvsp[-2];
+                AST *anno = yyvsp[-1];
+                AST *body = yyvsp[0];
+                int is_public = 1;
+                type = CombineTypes(NULL, decl, &ident, &module);
+                if (module) {
+                    ERROR(decl, ":: needs fixing");
+                }
+                DeclareCTypedFunction(current, type, ident, is_public, body, anno);
+            }
+#line 6251 "./build/cgram.tab.c"
+    break;
+
+  case 350: /* attribute_decl: "__attribute__"  */
+#line 2501 "frontends/c/cgram.y"
+            {
+                yyval = yyvsp[0];
+            }
+#line 6259 "./build/cgram.tab.c"
+    break;
+
+  case 351: /* attribute_decl: %empty  */
+#line 2505 "frontends/c/cgram.y"
+            { yyval = NULL; }
+#line 6265 "./build/cgram.tab.c"
+    break;
+
+  case 352: /* fromfile_decl: "__fromfile" '(' "string literal" ')' ';'  */
+#line 2510 "frontends/c/cgram.y"
+            {
+                AST *str = yyvsp[-2];
+                if (str && str->kind == AST_EXPRLIST) {
+                    str = str->left;
+                }
+                yyval = str;
+            }
+#line 6277 "./build/cgram.tab.c"
+    break;
+
+  case 355: /* top_pasm: "__pasm" '{' pasmlist '}'  */
+#line 2527 "frontends/c/cgram.y"
+      { yyval = current->datblock = AddToListEx(current->datblock, yyvsp[-1], &current->datblock_tail); }
+#line 6283 "./build/cgram.tab.c"
+    break;
+
+  case 356: /* top_pasm: "__pasm" "end of line" '{' pasmlist '}'  */
+#line 2529 "frontends/c/cgram.y"
+      { yyval = current->datblock = AddToListEx(current->datblock, yyvsp[-1], &current->datblock_tail); }
+#line 6289 "./build/cgram.tab.c"
+    break;
+
+  case 357: /* pasmlist: pasmline  */
+#line 2534 "frontends/c/cgram.y"
+  { yyval = yyvsp[0]; }
+#line 6295 "./build/cgram.tab.c"
+    break;
+
+  case 358: /* pasmlist: pasmlist pasmline  */
+#line 2536 "frontends/c/cgram.y"
+  { yyval = AddToList(yyvsp[-1], yyvsp[0]); }
+#line 6301 "./build/cgram.tab.c"
+    break;
+
+  case 360: /* pasmline: "identifier" pasm_baseline  */
+#line 2542 "frontends/c/cgram.y"
+    {   AST *linebreak;
+        AST *comment = GetComments();
+        AST *ast;
+        ast = yyvsp[-1];
+        if (comment && (comment->d.string || comment->kind == AST_SRCCOMMENT)) {
+            linebreak = NewCommentedAST(AST_LINEBREAK, NULL, NULL, comment);
+        } else {
+            linebreak = NewAST(AST_LINEBREAK, NULL, NULL);
+        }
+        ast = AddToList(ast, yyvsp[0]);
+        ast = AddToList(linebreak, ast);
+        yyval = ast;
+    }
+#line 6319 "./build/cgram.tab.c"
+    break;
+
+  case 361: /* pasm_baseline: asm_eoln  */
+#line 2559 "frontends/c/cgram.y"
+    { yyval = NULL; }
+#line 6325 "./build/cgram.tab.c"
+    break;
+
+  case 362: /* pasm_baseline: error asm_eoln  */
+#line 2561 "frontends/c/cgram.y"
+    { yyval = NULL; }
+#line 6331 "./build/cgram.tab.c"
+    break;
+
+  case 363: /* pasm_baseline: "byte" asm_eoln  */
+#line 2563 "frontends/c/cgram.y"
+    { yyval = NewCommentedAST(AST_BYTELIST, NULL, NULL, yyvsp[-1]); }
+#line 6337 "./build/cgram.tab.c"
+    break;
+
+  case 364: /* pasm_baseline: "byte" pasm_operandlist asm_eoln  */
+#line 2565 "frontends/c/cgram.y"
+    { yyval = NewCommentedAST(AST_BYTELIST, yyvsp[-1], NULL, yyvsp[-2]); }
+#line 6343 "./build/cgram.tab.c"
+    break;
+
+  case 365: /* pasm_baseline: "word" asm_eoln  */
+#line 2567 "frontends/c/cgram.y"
+    { yyval = NewCommentedAST(AST_WORDLIST, NULL, NULL, yyvsp[-1]); }
+#line 6349 "./build/cgram.tab.c"
+    break;
+
+  case 366: /* pasm_baseline: "word" pasm_operandlist asm_eoln  */
+#line 2569 "frontends/c/cgram.y"
+    { yyval = NewCommentedAST(AST_WORDLIST, yyvsp[-1], NULL, yyvsp[-2]); }
+#line 6355 "./build/cgram.tab.c"
+    break;
+
+  case 367: /* pasm_baseline: "long" asm_eoln  */
+#line 2571 "frontends/c/cgram.y"
+    { yyval = NewCommentedAST(AST_LONGLIST, NULL, NULL, yyvsp[-1]); }
+#line 6361 "./build/cgram.tab.c"
+    break;
+
+  case 368: /* pasm_baseline: "long" pasm_operandlist asm_eoln  */
+#line 2573 "frontends/c/cgram.y"
+    { yyval = NewCommentedAST(AST_LONGLIST, yyvsp[-1], NULL, yyvsp[-2]); }
+#line 6367 "./build/cgram.tab.c"
+    break;
+
+  case 369: /* pasm_baseline: instruction asm_eoln  */
+#line 2575 "frontends/c/cgram.y"
+    { yyval = NewCommentedInstr(yyvsp[-1]); }
+#line 6373 "./build/cgram.tab.c"
+    break;
+
+  case 370: /* pasm_baseline: instruction pasm_operandlist asm_eoln  */
+#line 2577 "frontends/c/cgram.y"
+    { yyval = NewCommentedInstr(AddToList(yyvsp[-2], yyvsp[-1])); }
+#line 6379 "./build/cgram.tab.c"
+    break;
+
+  case 371: /* pasm_baseline: instruction modifierlist asm_eoln  */
+#line 2579 "frontends/c/cgram.y"
+    { yyval = NewCommentedInstr(AddToList(yyvsp[-2], yyvsp[-1])); }
+#line 6385 "./build/cgram.tab.c"
+    break;
+
+  case 372: /* pasm_baseline: instruction pasm_operandlist modifierlist asm_eoln  */
+#line 2581 "frontends/c/cgram.y"
+    { yyval = NewCommentedInstr(AddToList(yyvsp[-3], AddToList(yyvsp[-2], yyvsp[-1]))); }
+#line 6391 "./build/cgram.tab.c"
+    break;
+
+  case 373: /* pasm_baseline: "alignl" asm_eoln  */
+#line 2583 "frontends/c/cgram.y"
+    { yyval = NewCommentedAST(AST_ALIGN, AstInteger(4), NULL, yyvsp[-1]); }
+#line 6397 "./build/cgram.tab.c"
+    break;
+
+  case 374: /* pasm_baseline: "alignw" asm_eoln  */
+#line 2585 "frontends/c/cgram.y"
+    { yyval = NewCommentedAST(AST_ALIGN, AstInteger(2), NULL, yyvsp[-1]); }
+#line 6403 "./build/cgram.tab.c"
+    break;
+
+  case 375: /* pasm_baseline: "org" asm_eoln  */
+#line 2587 "frontends/c/cgram.y"
+    { yyval = NewCommentedAST(AST_ORG, NULL, NULL, yyvsp[-1]); }
+#line 6409 "./build/cgram.tab.c"
+    break;
+
+  case 376: /* pasm_baseline: "org" pasmexpr asm_eoln  */
+#line 2589 "frontends/c/cgram.y"
+    { yyval = NewCommentedAST(AST_ORG, yyvsp[-1], NULL, yyvsp[-2]); }
+#line 6415 "./build/cgram.tab.c"
+    break;
+
+  case 377: /* pasm_baseline: "orgh" asm_eoln  */
+#line 2591 "frontends/c/cgram.y"
+    { yyval = NewCommentedAST(AST_ORGH, NULL, NULL, yyvsp[-1]); }
+#line 6421 "./build/cgram.tab.c"
+    break;
+
+  case 378: /* pasm_baseline: "orgh" pasmexpr asm_eoln  */
+#line 2593 "frontends/c/cgram.y"
+    { yyval = NewCommentedAST(AST_ORGH, yyvsp[-1], NULL, yyvsp[-2]); }
+#line 6427 "./build/cgram.tab.c"
+    break;
+
+  case 379: /* pasm_baseline: "orgf" pasmexpr asm_eoln  */
+#line 2595 "frontends/c/cgram.y"
+    { yyval = NewCommentedAST(AST_ORGF, yyvsp[-1], NULL, yyvsp[-2]); }
+#line 6433 "./build/cgram.tab.c"
+    break;
+
+  case 380: /* pasm_baseline: "res" pasmexpr asm_eoln  */
+#line 2597 "frontends/c/cgram.y"
+    { yyval = NewCommentedAST(AST_RES, yyvsp[-1], NULL, yyvsp[-2]); }
+#line 6439 "./build/cgram.tab.c"
+    break;
+
+  case 381: /* pasm_baseline: "fit" pasmexpr asm_eoln  */
+#line 2599 "frontends/c/cgram.y"
+    { yyval = NewCommentedAST(AST_FIT, yyvsp[-1], NULL, yyvsp[-2]); }
+#line 6445 "./build/cgram.tab.c"
+    break;
+
+  case 382: /* pasm_baseline: "fit" asm_eoln  */
+#line 2601 "frontends/c/cgram.y"
+    { yyval = NewCommentedAST(AST_FIT, AstInteger(0x1f0), NULL, yyvsp[-1]); }
+#line 6451 "./build/cgram.tab.c"
+    break;
+
+  case 383: /* pasm_baseline: "file" "string literal" asm_eoln  */
+#line 2603 "frontends/c/cgram.y"
+    { yyval = NewCommentedAST(AST_FILE, GetFullFileName(yyvsp[-1]), NULL, yyvsp[-2]); }
+#line 6457 "./build/cgram.tab.c"
+    break;
+
+  case 384: /* pasm_operand: pasmexpr  */
+#line 2608 "frontends/c/cgram.y"
+   { yyval = NewAST(AST_EXPRLIST, yyvsp[0], NULL); }
+#line 6463 "./build/cgram.tab.c"
+    break;
+
+  case 385: /* pasm_operand: '#' pasmexpr  */
+#line 2610 "frontends/c/cgram.y"
+   { yyval = NewAST(AST_EXPRLIST, NewAST(AST_IMMHOLDER, yyvsp[0], NULL), NULL); }
+#line 6469 "./build/cgram.tab.c"
+    break;
+
+  case 386: /* pasm_operand: '#' '#' pasmexpr  */
+#line 2612 "frontends/c/cgram.y"
+   { yyval = NewAST(AST_EXPRLIST, NewAST(AST_BIGIMMHOLDER, yyvsp[0], NULL), NULL); }
+#line 6475 "./build/cgram.tab.c"
+    break;
+
+  case 387: /* pasm_operandlist: pasm_operand  */
+#line 2619 "frontends/c/cgram.y"
+   { yyval = yyvsp[0]; }
+#line 6481 "./build/cgram.tab.c"
+    break;
+
+  case 388: /* pasm_operandlist: pasm_operandlist ',' pasm_operand  */
+#line 2621 "frontends/c/cgram.y"
+   { yyval = AddToList(yyvsp[-2], yyvsp[0]); }
+#line 6487 "./build/cgram.tab.c"
+    break;
+
+  case 389: /* optpasmrange: '[' pasmexpr ']'  */
+#line 2626 "frontends/c/cgram.y"
+            { yyval = yyvsp[-1]; }
+#line 6493 "./build/cgram.tab.c"
+    break;
+
+  case 390: /* optpasmrange: '[' '#' '#' pasmexpr ']'  */
+#line 2628 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_BIGIMMHOLDER, yyvsp[-1], NULL); }
+#line 6499 "./build/cgram.tab.c"
+    break;
+
+  case 391: /* optpasmrange: %empty  */
+#line 2630 "frontends/c/cgram.y"
+            { yyval = NULL; }
+#line 6505 "./build/cgram.tab.c"
+    break;
+
+  case 392: /* pasmatom: "identifier"  */
+#line 2635 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 6511 "./build/cgram.tab.c"
+    break;
+
+  case 393: /* pasmatom: "constant"  */
+#line 2637 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 6517 "./build/cgram.tab.c"
+    break;
+
+  case 394: /* pasmatom: '$'  */
+#line 2639 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_HERE, NULL, NULL); }
+#line 6523 "./build/cgram.tab.c"
+    break;
+
+  case 395: /* pasmatom: "hardware register" optpasmrange  */
+#line 2641 "frontends/c/cgram.y"
+            {
+                AST *reg = yyvsp[-1];
+                AST *index = yyvsp[0];
+                if (index) {
+                    if (index->kind == AST_BIGIMMHOLDER) {
+                        index->left = NewAST(AST_RANGEREF, reg, index->left);
+                        yyval = index;
+                    } else {
+                        yyval = NewAST(AST_RANGEREF, reg, index);
+                    }
+                } else {
+                    yyval = reg;
+                }
+            }
+#line 6542 "./build/cgram.tab.c"
+    break;
+
+  case 396: /* pasmatom: "string literal"  */
+#line 2656 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 6548 "./build/cgram.tab.c"
+    break;
+
+  case 397: /* pasmatom: '@' "identifier"  */
+#line 2658 "frontends/c/cgram.y"
+            { yyval = NewAST(AST_ADDROF, yyvsp[0], NULL); }
+#line 6554 "./build/cgram.tab.c"
+    break;
+
+  case 398: /* pasmatom: '(' pasmexpr ')'  */
+#line 2660 "frontends/c/cgram.y"
+            { yyval = yyvsp[-1]; }
+#line 6560 "./build/cgram.tab.c"
+    break;
+
+  case 399: /* pasmatom: pasmatom "++"  */
+#line 2662 "frontends/c/cgram.y"
+            { yyval = AstOperator(K_INCREMENT, yyvsp[-1], NULL); }
+#line 6566 "./build/cgram.tab.c"
+    break;
+
+  case 400: /* pasmatom: pasmatom "--"  */
+#line 2664 "frontends/c/cgram.y"
+            { yyval = AstOperator(K_DECREMENT, yyvsp[-1], NULL); }
+#line 6572 "./build/cgram.tab.c"
+    break;
+
+  case 401: /* pasmunary: pasmatom  */
+#line 2669 "frontends/c/cgram.y"
+          { yyval = yyvsp[0]; }
+#line 6578 "./build/cgram.tab.c"
+    break;
+
+  case 402: /* pasmunary: '-' pasmunary  */
+#line 2671 "frontends/c/cgram.y"
+          { yyval = AstOperator(K_NEGATE, NULL, yyvsp[0]); }
+#line 6584 "./build/cgram.tab.c"
+    break;
+
+  case 403: /* pasmunary: '!' pasmunary  */
+#line 2673 "frontends/c/cgram.y"
+          { yyval = AstOperator(K_BIT_NOT, NULL, yyvsp[0]); }
+#line 6590 "./build/cgram.tab.c"
+    break;
+
+  case 404: /* pasm_e1: pasmunary  */
+#line 2678 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 6596 "./build/cgram.tab.c"
+    break;
+
+  case 405: /* pasm_e1: pasm_e1 "<<" pasmunary  */
+#line 2680 "frontends/c/cgram.y"
+            { yyval = AstOperator(K_SHL, yyvsp[-2], yyvsp[0]); }
+#line 6602 "./build/cgram.tab.c"
+    break;
+
+  case 406: /* pasm_e1: pasm_e1 ">>" pasmunary  */
+#line 2682 "frontends/c/cgram.y"
+            { yyval = AstOperator(K_SHR, yyvsp[-2], yyvsp[0]); }
+#line 6608 "./build/cgram.tab.c"
+    break;
+
+  case 407: /* pasm_e2: pasm_e1  */
+#line 2686 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 6614 "./build/cgram.tab.c"
+    break;
+
+  case 408: /* pasm_e2: pasm_e2 '&' pasm_e1  */
+#line 2688 "frontends/c/cgram.y"
+            { yyval = AstOperator('&', yyvsp[-2], yyvsp[0]); }
+#line 6620 "./build/cgram.tab.c"
+    break;
+
+  case 409: /* pasm_e3: pasm_e2  */
+#line 2692 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 6626 "./build/cgram.tab.c"
+    break;
+
+  case 410: /* pasm_e3: pasm_e3 '|' pasm_e2  */
+#line 2694 "frontends/c/cgram.y"
+            { yyval = AstOperator('|', yyvsp[-2], yyvsp[0]); }
+#line 6632 "./build/cgram.tab.c"
+    break;
+
+  case 411: /* pasm_e3: pasm_e3 '^' pasm_e2  */
+#line 2696 "frontends/c/cgram.y"
+            { yyval = AstOperator('^', yyvsp[-2], yyvsp[0]); }
+#line 6638 "./build/cgram.tab.c"
+    break;
+
+  case 412: /* pasm_e4: pasm_e3  */
+#line 2700 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 6644 "./build/cgram.tab.c"
+    break;
+
+  case 413: /* pasm_e4: pasm_e4 '*' pasm_e3  */
+#line 2702 "frontends/c/cgram.y"
+            { yyval = AstOperator('*', yyvsp[-2], yyvsp[0]); }
+#line 6650 "./build/cgram.tab.c"
+    break;
+
+  case 414: /* pasm_e4: pasm_e4 '/' pasm_e3  */
+#line 2704 "frontends/c/cgram.y"
+            { yyval = AstOperator('/', yyvsp[-2], yyvsp[0]); }
+#line 6656 "./build/cgram.tab.c"
+    break;
+
+  case 415: /* pasm_e4: pasm_e4 '/' '/' pasm_e3  */
+#line 2706 "frontends/c/cgram.y"
+            { yyval = AstOperator(K_MODULUS, yyvsp[-3], yyvsp[0]); }
+#line 6662 "./build/cgram.tab.c"
+    break;
+
+  case 416: /* pasm_e5: pasm_e4  */
+#line 2710 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 6668 "./build/cgram.tab.c"
+    break;
+
+  case 417: /* pasm_e5: pasm_e5 '+' pasm_e4  */
+#line 2712 "frontends/c/cgram.y"
+            { yyval = AstOperator('+', yyvsp[-2], yyvsp[0]); }
+#line 6674 "./build/cgram.tab.c"
+    break;
+
+  case 418: /* pasm_e5: pasm_e5 '-' pasm_e4  */
+#line 2714 "frontends/c/cgram.y"
+            { yyval = AstOperator('-', yyvsp[-2], yyvsp[0]); }
+#line 6680 "./build/cgram.tab.c"
+    break;
+
+  case 419: /* pasm_e6: pasm_e5  */
+#line 2718 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 6686 "./build/cgram.tab.c"
+    break;
+
+  case 420: /* pasm_e6: pasm_e6 "#<" pasm_e5  */
+#line 2720 "frontends/c/cgram.y"
+            { yyval = AstOperator(K_LIMITMIN, yyvsp[-2], yyvsp[0]); }
+#line 6692 "./build/cgram.tab.c"
+    break;
+
+  case 421: /* pasm_e6: pasm_e6 "#>" pasm_e5  */
+#line 2722 "frontends/c/cgram.y"
+            { yyval = AstOperator(K_LIMITMAX, yyvsp[-2], yyvsp[0]); }
+#line 6698 "./build/cgram.tab.c"
+    break;
+
+  case 422: /* pasm_e7: pasm_e6  */
+#line 2726 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 6704 "./build/cgram.tab.c"
+    break;
+
+  case 423: /* pasm_e7: pasm_e7 '>' pasm_e6  */
+#line 2728 "frontends/c/cgram.y"
+            { yyval = AstOperator('>', yyvsp[-2], yyvsp[0]); }
+#line 6710 "./build/cgram.tab.c"
+    break;
+
+  case 424: /* pasm_e7: pasm_e7 '<' pasm_e6  */
+#line 2730 "frontends/c/cgram.y"
+            { yyval = AstOperator('<', yyvsp[-2], yyvsp[0]); }
+#line 6716 "./build/cgram.tab.c"
+    break;
+
+  case 425: /* pasm_e7: pasm_e7 "<=" pasm_e6  */
+#line 2732 "frontends/c/cgram.y"
+            { yyval = AstOperator(K_LE, yyvsp[-2], yyvsp[0]); }
+#line 6722 "./build/cgram.tab.c"
+    break;
+
+  case 426: /* pasm_e7: pasm_e7 ">=" pasm_e6  */
+#line 2734 "frontends/c/cgram.y"
+            { yyval = AstOperator(K_GE, yyvsp[-2], yyvsp[0]); }
+#line 6728 "./build/cgram.tab.c"
+    break;
+
+  case 427: /* pasmexpr: pasm_e7  */
+#line 2739 "frontends/c/cgram.y"
+            { yyval = yyvsp[0]; }
+#line 6734 "./build/cgram.tab.c"
+    break;
+
+  case 428: /* pasmexpr: '\\' pasmexpr  */
+#line 2741 "frontends/c/cgram.y"
+            { yyval = AstCatch(yyvsp[0]); }
+#line 6740 "./build/cgram.tab.c"
+    break;
+
+
+#line 6744 "./build/cgram.tab.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == CGRAMYYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      {
+        yypcontext_t yyctx
+          = {yyssp, yytoken};
+        char const *yymsgp = YY_("syntax error");
+        int yysyntax_error_status;
+        yysyntax_error_status = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
+        if (yysyntax_error_status == 0)
+          yymsgp = yymsg;
+        else if (yysyntax_error_status == -1)
+          {
+            if (yymsg != yymsgbuf)
+              YYSTACK_FREE (yymsg);
+            yymsg = YY_CAST (char *,
+                             YYSTACK_ALLOC (YY_CAST (YYSIZE_T, yymsg_alloc)));
+            if (yymsg)
+              {
+                yysyntax_error_status
+                  = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
+                yymsgp = yymsg;
+              }
+            else
+              {
+                yymsg = yymsgbuf;
+                yymsg_alloc = sizeof yymsgbuf;
+                yysyntax_error_status = YYENOMEM;
+              }
+          }
+        yyerror (yymsgp);
+        if (yysyntax_error_status == YYENOMEM)
+          YYNOMEM;
+      }
+    }
+
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= CGRAMYYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == CGRAMYYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = CGRAMYYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != CGRAMYYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+  if (yymsg != yymsgbuf)
+    YYSTACK_FREE (yymsg);
+  return yyresult;
+}
+
+#line 2744 "frontends/c/cgram.y"
+
+#include <stdio.h>
+
+void
+cgramyyerror(const char *msg)
+{
+    extern int saved_cgramyychar;
+    int yychar = saved_cgramyychar;
+    
+    SETCOLOR(PRINT_ERROR);
+    ERRORHEADER(current->Lptr->fileName, current->Lptr->lineCounter, "error");
+
+    if (!strcmp(msg, "syntax error, unexpected $end")) {
+        fprintf(stderr, "unexpected end of input");
+        msg = "";
+    }
+    // massage bison's error messages to make them easier to understand
+    while (*msg) {
+        // say which identifier was unexpected
+        if (!strncmp(msg, "unexpected identifier", strlen("unexpected identifier")) && last_ast && last_ast->kind == AST_IDENTIFIER) {
+            fprintf(stderr, "unexpected identifier `%s'", last_ast->d.string);
+            msg += strlen("unexpected identifier");
+        }
+        else if (!strncmp(msg, "unexpected type name", strlen("unexpected type name")) && last_ast && last_ast->kind == AST_IDENTIFIER) {
+            fprintf(stderr, "unexpected type name `%s'", last_ast->d.string);
+            msg += strlen("unexpected type name");
+        }
+        // if we get a stray character in source, sometimes bison tries to treat it as a token for
+        // error purposes, resulting in $undefined as the token
+        else if (!strncmp(msg, "$undefined", strlen("$undefined")) && yychar >= ' ' && yychar < 127) {
+            fprintf(stderr, "%c", yychar);
+            msg += strlen("$undefined");
+        }
+        else {
+            fprintf(stderr, "%c", *msg);
+            msg++;
+        }
+    }
+    fprintf(stderr, "\n");
+    gl_errors++;
+    RESETCOLOR();
+}
+
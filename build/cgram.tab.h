@@ -0,0 +1,198 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_CGRAMYY_BUILD_CGRAM_TAB_H_INCLUDED
+# define YY_CGRAMYY_BUILD_CGRAM_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef CGRAMYYDEBUG
+# if defined YYDEBUG
+#if YYDEBUG
+#   define CGRAMYYDEBUG 1
+#  else
+#   define CGRAMYYDEBUG 0
+#  endif
+# else /* ! defined YYDEBUG */
+#  define CGRAMYYDEBUG 1
+# endif /* ! defined YYDEBUG */
+#endif  /* ! defined CGRAMYYDEBUG */
+#if CGRAMYYDEBUG
+extern int cgramyydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef CGRAMYYTOKENTYPE
+# define CGRAMYYTOKENTYPE
+  enum cgramyytokentype
+  {
+    CGRAMYYEMPTY = -2,
+    CGRAMYYEOF = 0,                /* "end of file"  */
+    CGRAMYYerror = 256,            /* error  */
+    CGRAMYYUNDEF = 257,            /* "invalid token"  */
+    C_IDENTIFIER = 258,            /* "identifier"  */
+    C_CONSTANT = 259,              /* "constant"  */
+    C_STRING_LITERAL = 260,        /* "string literal"  */
+    C_SIZEOF = 261,                /* "sizeof"  */
+    C_TYPEOF = 262,                /* "typeof"  */
+    C_PTR_OP = 263,                /* "->"  */
+    C_INC_OP = 264,                /* "++"  */
+    C_DEC_OP = 265,                /* "--"  */
+    C_LEFT_OP = 266,               /* "<<"  */
+    C_RIGHT_OP = 267,              /* ">>"  */
+    C_LE_OP = 268,                 /* "<="  */
+    C_GE_OP = 269,                 /* ">="  */
+    C_EQ_OP = 270,                 /* "=="  */
+    C_NE_OP = 271,                 /* "!="  */
+    C_AND_OP = 272,                /* "&&"  */
+    C_OR_OP = 273,                 /* "||"  */
+    C_MUL_ASSIGN = 274,            /* "*="  */
+    C_DIV_ASSIGN = 275,            /* "/="  */
+    C_MOD_ASSIGN = 276,            /* "%="  */
+    C_ADD_ASSIGN = 277,            /* "+="  */
+    C_SUB_ASSIGN = 278,            /* "-="  */
+    C_LEFT_ASSIGN = 279,           /* "<<="  */
+    C_RIGHT_ASSIGN = 280,          /* ">>="  */
+    C_AND_ASSIGN = 281,            /* "&="  */
+    C_XOR_ASSIGN = 282,            /* "^="  */
+    C_OR_ASSIGN = 283,             /* "|="  */
+    C_TYPE_NAME = 284,             /* "type name"  */
+    C_LIMITMIN_OP = 285,           /* "#<"  */
+    C_LIMITMAX_OP = 286,           /* "#>"  */
+    C_TYPEDEF = 287,               /* "typedef"  */
+    C_EXTERN = 288,                /* "extern"  */
+    C_STATIC = 289,                /* "static"  */
+    C_AUTO = 290,                  /* "auto"  */
+    C_REGISTER = 291,              /* "register"  */
+    C_RESTRICT = 292,              /* "__restrict"  */
+    C_BOOL = 293,                  /* "_Bool"  */
+    C_CHAR = 294,                  /* "char"  */
+    C_SHORT = 295,                 /* "short"  */
+    C_IMAGINARY = 296,             /* "_Imaginary"  */
+    C_INLINE = 297,                /* "inline"  */
+    C_INT = 298,                   /* "int"  */
+    C_LONG = 299,                  /* "long"  */
+    C_SIGNED = 300,                /* "signed"  */
+    C_UNSIGNED = 301,              /* "unsigned"  */
+    C_FLOAT = 302,                 /* "float"  */
+    C_DOUBLE = 303,                /* "double"  */
+    C_CONST = 304,                 /* "const"  */
+    C_VOLATILE = 305,              /* "volatile"  */
+    C_VOID = 306,                  /* "void"  */
+    C_STRUCT = 307,                /* "struct"  */
+    C_UNION = 308,                 /* "union"  */
+    C_ENUM = 309,                  /* "enum"  */
+    C_ELLIPSIS = 310,              /* "..."  */
+    C_DOUBLECOLON = 311,           /* "::"  */
+    C_CASE = 312,                  /* "case"  */
+    C_DEFAULT = 313,               /* "default"  */
+    C_IF = 314,                    /* "if"  */
+    C_ELSE = 315,                  /* "else"  */
+    C_SWITCH = 316,                /* "switch"  */
+    C_WHILE = 317,                 /* "while"  */
+    C_DO = 318,                    /* "do"  */
+    C_FOR = 319,                   /* "for"  */
+    C_GOTO = 320,                  /* "goto"  */
+    C_CONTINUE = 321,              /* "continue"  */
+    C_BREAK = 322,                 /* "break"  */
+    C_RETURN = 323,                /* "return"  */
+    C_FROMFILE = 324,              /* "__fromfile"  */
+    C_USING = 325,                 /* "__using"  */
+    C_ATTRIBUTE = 326,             /* "__attribute__"  */
+    C_ASM = 327,                   /* "__asm"  */
+    C_PASM = 328,                  /* "__pasm"  */
+    C_INSTR = 329,                 /* "asm instruction"  */
+    C_INSTRMODIFIER = 330,         /* "instruction modifier"  */
+    C_HWREG = 331,                 /* "hardware register"  */
+    C_CATCH = 332,                 /* "catch"  */
+    C_CLASS = 333,                 /* "class"  */
+    C_DELETE = 334,                /* "delete"  */
+    C_FALSE = 335,                 /* "false"  */
+    C_NEW = 336,                   /* "new"  */
+    C_NULLPTR = 337,               /* "nullptr"  */
+    C_TRUE = 338,                  /* "true"  */
+    C_PRIVATE = 339,               /* "private"  */
+    C_PUBLIC = 340,                /* "public"  */
+    C_TEMPLATE = 341,              /* "template"  */
+    C_THIS = 342,                  /* "this"  */
+    C_THROW = 343,                 /* "throw"  */
+    C_THROWIF = 344,               /* "__throwifcaught"  */
+    C_TRY = 345,                   /* "try"  */
+    C_ALIGNL = 346,                /* "alignl"  */
+    C_ALIGNW = 347,                /* "alignw"  */
+    C_BYTE = 348,                  /* "byte"  */
+    C_FILE = 349,                  /* "file"  */
+    C_FIT = 350,                   /* "fit"  */
+    C_ORG = 351,                   /* "org"  */
+    C_ORGH = 352,                  /* "orgh"  */
+    C_ORGF = 353,                  /* "orgf"  */
+    C_RES = 354,                   /* "res"  */
+    C_WORD = 355,                  /* "word"  */
+    C_EOLN = 356,                  /* "end of line"  */
+    C_FUNC = 357,                  /* "__func__ or __FUNCTION__"  */
+    C_BUILTIN_ABS = 358,           /* "__builtin_abs"  */
+    C_BUILTIN_CLZ = 359,           /* "__builtin_clz"  */
+    C_BUILTIN_SQRT = 360,          /* "__builtin_sqrt"  */
+    C_BUILTIN_FRAC = 361,          /* "__builtin_frac"  */
+    C_BUILTIN_MULH = 362,          /* "__builtin_mulh"  */
+    C_BUILTIN_MULUH = 363,         /* "__builtin_muluh"  */
+    C_BUILTIN_ALLOCA = 364,        /* "__builtin_alloca"  */
+    C_BUILTIN_COGSTART = 365,      /* "__builtin_cogstart"  */
+    C_BUILTIN_EXPECT = 366,        /* "__builtin_expect"  */
+    C_BUILTIN_PRINTF = 367,        /* "__builtin_printf"  */
+    C_BUILTIN_REV = 368,           /* "__builtin_rev"  */
+    C_BUILTIN_VA_START = 369,      /* "__builtin_va_start"  */
+    C_BUILTIN_VA_ARG = 370,        /* "__builtin_va_arg"  */
+    C_BUILTIN_SETJMP = 371,        /* "__builtin_setjmp"  */
+    C_BUILTIN_LONGJMP = 372,       /* "__builtin_longjmp"  */
+    C_EOF = 373                    /* "end of file"  */
+  };
+  typedef enum cgramyytokentype cgramyytoken_kind_t;
+#endif
+
+/* Value type.  */
+#if ! defined CGRAMYYSTYPE && ! defined CGRAMYYSTYPE_IS_DECLARED
+typedef int CGRAMYYSTYPE;
+# define CGRAMYYSTYPE_IS_TRIVIAL 1
+# define CGRAMYYSTYPE_IS_DECLARED 1
+#endif
+
+
+
+
+int cgramyyparse (void);
+
+
+#endif /* !YY_CGRAMYY_BUILD_CGRAM_TAB_H_INCLUDED  */
@@ -0,0 +1,9643 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 1
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+/* Substitute the type names.  */
+#define YYSTYPE         SPINYYSTYPE
+/* Substitute the variable and function names.  */
+#define yyparse         spinyyparse
+#define yylex           spinyylex
+#define yyerror         spinyyerror
+#define yydebug         spinyydebug
+#define yynerrs         spinyynerrs
+
+/* First part of user prologue.  */
+#line 9 "frontends/spin/spin.y"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <ctype.h>
+#include "spinc.h"
+
+#define SPINYYSTYPE AST*
+#undef  YYSTYPE
+#define YYSTYPE SPINYYSTYPE
+    
+/* Yacc functions */
+    void spinyyerror(const char *);
+    int spinyylex();
+
+    extern int gl_errors;
+
+    extern AST *last_ast;
+    
+AST *
+SpinRetType(AST *funcdef)
+{
+    AST *resultvars = NULL;
+    
+    if (funcdef->kind != AST_FUNCDEF) return NULL;
+    funcdef = funcdef->left;
+    if (funcdef->kind != AST_FUNCDECL) return NULL;
+    resultvars = funcdef->right;
+    if (resultvars && resultvars->kind == AST_DECLARE_VAR) {
+        return resultvars->left;
+    }
+    funcdef = funcdef ->left;
+    if (funcdef->kind != AST_IDENTIFIER) return NULL;
+    if (strrchr(funcdef->d.string, '$') != NULL)
+        return ast_type_string;
+    return NULL;
+}
+
+// in common.c
+extern AST *GenericFunctionPtr(int numresults);
+
+static AST *
+MakeFunccall(AST *func, AST *params, AST *numresults)
+{
+    if (numresults && numresults->kind == AST_INTEGER) {
+        int paramcount;
+        paramcount = numresults->d.ival;
+        func = NewAST(AST_CAST, GenericFunctionPtr(paramcount), func);
+    }
+    return NewAST(AST_FUNCCALL, func, params);
+}
+
+// special handling for things like "abc" | x
+// in Spin this is the same as "ab", "c" | x
+
+static int IsLongString(AST *ast)
+{
+    if (ast && ast->kind == AST_STRING) {
+        return strlen(ast->d.string) > 1;
+    }
+    return 0;
+}
+
+// convert a pin range like 57..46 to an ADDPINS expression
+static AST *
+ConvertPinRange(AST *exprlist)
+{
+    AST *expr;
+    AST *lhs, *rhs;
+    if (!exprlist || !exprlist->left) {
+        return exprlist;
+    }
+    expr = exprlist->left;
+    if (expr->kind != AST_RANGE) {
+        return exprlist;
+    }
+    lhs = expr->left;
+    rhs = expr->right;
+    if (!rhs) {
+        exprlist->left = rhs;
+        return exprlist;
+    }
+    // convert A..B to B ADDPINS  (B-A)
+    lhs = AstOperator('-', lhs, rhs);
+    expr = AstOperator('|', rhs, AstOperator(K_SHL, lhs, AstInteger(6)));
+    exprlist->left = expr;
+    return exprlist;
+}
+
+// Fix up an expression list
+// convert any long string operator entries by folding the operation
+// into the first/last character of the string
+
+static AST *
+FixupList(AST *list)
+{
+    AST *item, *left, *right;
+    AST *origlist = list;
+    char *shortstr;
+    char *singlechar;
+    int slen;
+    int op;
+    
+    while (list && list->kind == AST_EXPRLIST) {
+        item = list->left;
+        if (item && item->kind == AST_OPERATOR) {
+            op = item->d.ival;
+            left = item->left;
+            right = item->right;
+            if (IsLongString(left)) {
+                if (IsLongString(right)) {
+                    SYNTAX_ERROR("unable to apply operator to two strings");
+                } else {
+                    // convert to AST_EXPRLIST( most of left, left_last_char OP right )
+                    shortstr = strdup(left->d.string);
+                    slen = strlen(left->d.string);
+                    singlechar = strdup(shortstr + slen - 1);
+                    shortstr[slen - 1] = 0;
+                    left = AstPlainString(shortstr);
+                    right = AstOperator(op, AstPlainString(singlechar), right);
+                    list->left = left;
+                    list->right = NewAST(AST_EXPRLIST, right, list->right);
+                }
+            } else if (IsLongString(right)) {
+                shortstr = strdup(right->d.string+1);
+                singlechar = calloc(1, 2);
+                singlechar[0] = right->d.string[0];
+                left = AstOperator(op, left, AstPlainString(singlechar));
+                right = AstPlainString(shortstr);
+                list->left = left;
+                list->right = NewAST(AST_EXPRLIST, right, list->right);
+            }
+        }
+        list = list->right;
+    }
+    return origlist;
+}
+
+#define DBG_BITS_DELAY 0x1000
+
+static struct s_dbgfmt {
+    const char *name;
+    const char *cfmt;
+    int bits;
+} dbgfmt[] = {
+    { "uchar#", "%c", 0 },
+    { "zstr", "%s", 0 },
+    { "udec", "%u", 0 },
+    { "fdec", "%g", 0 },
+    { "udec_byte", "%03u", 8 },
+    { "udec_word", "%05u", 16 },
+    { "udec_long", "%09u", 0 },
+    { "sdec", "%d", 0 },
+    { "sdec_byte", "%3d", -8 },
+    { "sdec_word", "%5d", -16 },
+    { "sdec_long", "%9d", 0 },
+    { "uhex", "$%x", 0 },
+    { "uhex_byte", "$%02x", 8 },
+    { "uhex_word", "$%04x", 16 },
+    { "uhex_long", "$%08x", 0 },
+    { "dly", "%.0s", DBG_BITS_DELAY },
+    { 0, 0, 0 }
+};
+
+static AST *GetFormatForDebug(struct flexbuf *fb, const char *itemname_orig, AST *args, int needcomma)
+{
+    char itemname[128];
+    struct s_dbgfmt *ptr = &dbgfmt[0];
+    AST *arg;
+    AST *outlist = NULL;
+    int len;
+    int output_name = 1;
+    const char *idname;
+    int bits = 0;
+    
+    len = strlen(itemname_orig);
+    if (len > sizeof(itemname)-1) {
+        WARNING(args, "Unhandled debug format %s", itemname_orig);
+        return NULL;
+    }
+    strcpy(itemname, itemname_orig);
+    if (itemname[len-1] == '_') {
+        output_name = 0;
+        itemname[len-1] = 0;
+    }
+    while (ptr && ptr->name) {
+        if (!strcasecmp(ptr->name, itemname)) {
+            break;
+        }
+        ptr++;
+    }
+    if (!ptr->name) {
+        WARNING(args, "Unhandled debug format %s", itemname_orig);
+        return NULL;
+    }
+    bits = ptr->bits;
+    if (bits == DBG_BITS_DELAY) {
+        output_name = 0;
+    }
+    // now output all the arguments
+    while (args) {
+        arg = args->left;
+        args = args->right;
+    
+        if (needcomma) {
+            flexbuf_addstr(fb, ", ");
+        }
+        if (output_name) {
+            idname = GetExprString(arg);
+            flexbuf_printf(fb, "%s = %s", idname, ptr->cfmt);
+        } else {
+            flexbuf_addstr(fb, ptr->cfmt);
+        }
+        needcomma = 1;
+        if (bits == DBG_BITS_DELAY) {
+            // cause a delay
+            arg = NewAST(AST_FUNCCALL, AstIdentifier("_waitms"),
+                         NewAST(AST_EXPRLIST, arg, NULL));
+        } else if (bits & 0x1f) {
+            if (bits < 0) {
+                arg = AstOperator(K_SIGNEXTEND, arg, AstInteger(-bits));
+            } else {
+                arg = AstOperator(K_ZEROEXTEND, arg, AstInteger(bits));
+            }
+        }
+        arg = NewAST(AST_EXPRLIST, arg, NULL);
+        outlist = AddToList(outlist, arg);
+    }
+    return outlist;
+}
+
+extern AST *genPrintf(AST *);
+
+AST *
+BuildDebugList(AST *exprlist)
+{
+    AST *outlist = NULL;
+    AST *item;
+    AST *printf_call;
+    AST *sub;
+    struct flexbuf fb;
+    const char *fmtstr;
+    int needcomma = 0;
+    
+    if (!gl_debug) {
+        return NULL;
+    }
+    if (gl_brkdebug) {
+        AST *debug = NewAST(AST_BRKDEBUG, exprlist, NULL);
+        return debug;
+    }
+    flexbuf_init(&fb, 1024);
+
+    if (exprlist && exprlist->left && exprlist->left->kind == AST_LABEL) {   
+        flexbuf_addstr(&fb, "Cog%d  ");
+        outlist = NewAST(AST_FUNCCALL,
+                         AstIdentifier("cogid"),
+                         NULL);
+        outlist = NewAST(AST_EXPRLIST, outlist, NULL);
+        exprlist = exprlist->right;
+    } else {
+        outlist = NULL;
+    }
+    while (exprlist && exprlist->kind == AST_EXPRLIST) {
+        item = exprlist->left;
+        exprlist = exprlist->right;
+        if (!item) continue;
+        if (item->kind == AST_STRING) {
+            sub = NewAST(AST_STRINGPTR, item, NULL);
+            sub = NewAST(AST_EXPRLIST, sub, NULL);
+            outlist = AddToList(outlist, sub);
+            flexbuf_addstr(&fb, "%s");
+            needcomma=0;
+        } else if (item->kind == AST_FUNCCALL) {
+            const char *name = GetUserIdentifierName(item->left);
+            AST *newarg;
+            
+            item = item->right; /* the parameter list */
+            newarg = GetFormatForDebug(&fb, name, item, needcomma);
+            if (newarg) {
+                needcomma = 1;
+                outlist = AddToList(outlist, newarg);
+            }
+        }
+    }
+    flexbuf_addstr(&fb, "\r\n");
+    flexbuf_addchar(&fb, 0);
+    fmtstr = flexbuf_get(&fb);
+    flexbuf_delete(&fb);
+
+    sub = AstStringPtr(fmtstr);
+    sub = NewAST(AST_EXPRLIST, sub, NULL);
+    outlist = AddToList(sub, outlist);
+    printf_call = NewAST(AST_PRINT, NULL, NULL);
+    printf_call = NewAST(AST_FUNCCALL, printf_call, outlist);
+    return genPrintf(printf_call);
+}
+
+#define YYERROR_VERBOSE 1
+
+#line 377 "./build/spin.tab.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "spin.tab.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_SP_IDENTIFIER = 3,              /* "identifier"  */
+  YYSYMBOL_SP_BYTECODE = 4,                /* "__bytecode__"  */
+  YYSYMBOL_SP_NUM = 5,                     /* "number"  */
+  YYSYMBOL_SP_STRING = 6,                  /* "string"  */
+  YYSYMBOL_SP_BACKTICK_STRING = 7,         /* "` string"  */
+  YYSYMBOL_SP_FLOATNUM = 8,                /* "float point number"  */
+  YYSYMBOL_SP_SPR = 9,                     /* "SPR"  */
+  YYSYMBOL_SP_COGREG = 10,                 /* "REG"  */
+  YYSYMBOL_SP_CON = 11,                    /* "CON"  */
+  YYSYMBOL_SP_VAR = 12,                    /* "VAR"  */
+  YYSYMBOL_SP_DAT = 13,                    /* "DAT"  */
+  YYSYMBOL_SP_PUB = 14,                    /* "PUB"  */
+  YYSYMBOL_SP_PRI = 15,                    /* "PRI"  */
+  YYSYMBOL_SP_OBJ = 16,                    /* "OBJ"  */
+  YYSYMBOL_SP_ASM = 17,                    /* "ASM"  */
+  YYSYMBOL_SP_ASM_CONST = 18,              /* "ASM_CONST"  */
+  YYSYMBOL_SP_ENDASM = 19,                 /* "ENDASM"  */
+  YYSYMBOL_SP_END = 20,                    /* "END"  */
+  YYSYMBOL_SP_INLINECCODE = 21,            /* "CCODE"  */
+  YYSYMBOL_SP_BYTE = 22,                   /* "BYTE"  */
+  YYSYMBOL_SP_WORD = 23,                   /* "WORD"  */
+  YYSYMBOL_SP_LONG = 24,                   /* "LONG"  */
+  YYSYMBOL_SP_BYTEFIT = 25,                /* "BYTEFIT"  */
+  YYSYMBOL_SP_WORDFIT = 26,                /* "WORDFIT"  */
+  YYSYMBOL_SP_FVAR = 27,                   /* "FVAR"  */
+  YYSYMBOL_SP_FVARS = 28,                  /* "FVARS"  */
+  YYSYMBOL_SP_ASMCLK = 29,                 /* "ASMCLK"  */
+  YYSYMBOL_SP_INSTR = 30,                  /* "instruction"  */
+  YYSYMBOL_SP_INSTRMODIFIER = 31,          /* "instruction modifier"  */
+  YYSYMBOL_SP_HWREG = 32,                  /* "hardware register"  */
+  YYSYMBOL_SP_ORG = 33,                    /* "ORG"  */
+  YYSYMBOL_SP_ORGH = 34,                   /* "ORGH"  */
+  YYSYMBOL_SP_ORGF = 35,                   /* "ORGF"  */
+  YYSYMBOL_SP_RES = 36,                    /* "RES"  */
+  YYSYMBOL_SP_FIT = 37,                    /* "FIT"  */
+  YYSYMBOL_SP_ALIGNL = 38,                 /* "ALIGNL"  */
+  YYSYMBOL_SP_ALIGNW = 39,                 /* "ALIGNW"  */
+  YYSYMBOL_SP_REPEAT = 40,                 /* "REPEAT"  */
+  YYSYMBOL_SP_FROM = 41,                   /* "FROM"  */
+  YYSYMBOL_SP_TO = 42,                     /* "TO"  */
+  YYSYMBOL_SP_STEP = 43,                   /* "STEP"  */
+  YYSYMBOL_SP_WHILE = 44,                  /* "WHILE"  */
+  YYSYMBOL_SP_UNTIL = 45,                  /* "UNTIL"  */
+  YYSYMBOL_SP_IF = 46,                     /* "IF"  */
+  YYSYMBOL_SP_IFNOT = 47,                  /* "IFNOT"  */
+  YYSYMBOL_SP_ELSE = 48,                   /* "ELSE"  */
+  YYSYMBOL_SP_ELSEIF = 49,                 /* "ELSEIF"  */
+  YYSYMBOL_SP_ELSEIFNOT = 50,              /* "ELSEIFNOT"  */
+  YYSYMBOL_SP_THEN = 51,                   /* "THEN"  */
+  YYSYMBOL_SP_ENDIF = 52,                  /* "ENDIF"  */
+  YYSYMBOL_SP_LOOKDOWN = 53,               /* "LOOKDOWN"  */
+  YYSYMBOL_SP_LOOKDOWNZ = 54,              /* "LOOKDOWNZ"  */
+  YYSYMBOL_SP_LOOKUP = 55,                 /* "LOOKUP"  */
+  YYSYMBOL_SP_LOOKUPZ = 56,                /* "LOOKUPZ"  */
+  YYSYMBOL_SP_COGINIT = 57,                /* "COGINIT"  */
+  YYSYMBOL_SP_COGNEW = 58,                 /* "COGNEW"  */
+  YYSYMBOL_SP_PINR = 59,                   /* "PINREAD"  */
+  YYSYMBOL_SP_PINT = 60,                   /* "PINTOGGLE"  */
+  YYSYMBOL_SP_PINW = 61,                   /* "PINWRITE"  */
+  YYSYMBOL_SP_PINL = 62,                   /* "PINLOW"  */
+  YYSYMBOL_SP_PINH = 63,                   /* "PINHIGH"  */
+  YYSYMBOL_SP_CASE = 64,                   /* "CASE"  */
+  YYSYMBOL_SP_CASE_FAST = 65,              /* "CASE_FAST"  */
+  YYSYMBOL_SP_OTHER = 66,                  /* "OTHER"  */
+  YYSYMBOL_SP_QUIT = 67,                   /* "QUIT"  */
+  YYSYMBOL_SP_NEXT = 68,                   /* "NEXT"  */
+  YYSYMBOL_SP_ALLOCA = 69,                 /* "__BUILTIN_ALLOCA"  */
+  YYSYMBOL_SP_ABORT = 70,                  /* "ABORT"  */
+  YYSYMBOL_SP_RESULT = 71,                 /* "RESULT"  */
+  YYSYMBOL_SP_RETURN = 72,                 /* "RETURN"  */
+  YYSYMBOL_SP_INDENT = 73,                 /* "indentation"  */
+  YYSYMBOL_SP_OUTDENT = 74,                /* "lack of indentation"  */
+  YYSYMBOL_SP_EOLN = 75,                   /* "end of line"  */
+  YYSYMBOL_SP_EOF = 76,                    /* "end of file"  */
+  YYSYMBOL_SP_DOTS = 77,                   /* ".."  */
+  YYSYMBOL_SP_HERE = 78,                   /* "$"  */
+  YYSYMBOL_SP_STRINGPTR = 79,              /* "STRING"  */
+  YYSYMBOL_SP_FILE = 80,                   /* "FILE"  */
+  YYSYMBOL_SP_ANNOTATION = 81,             /* SP_ANNOTATION  */
+  YYSYMBOL_SP_ASSIGN = 82,                 /* ":="  */
+  YYSYMBOL_SP_XOR = 83,                    /* "XOR (^^)"  */
+  YYSYMBOL_SP_OR = 84,                     /* "OR (||)"  */
+  YYSYMBOL_SP_AND = 85,                    /* "AND (&&)"  */
+  YYSYMBOL_SP_ORELSE = 86,                 /* "__ORELSE__"  */
+  YYSYMBOL_SP_ANDTHEN = 87,                /* "__ANDTHEN__"  */
+  YYSYMBOL_SP_GE = 88,                     /* "=>"  */
+  YYSYMBOL_SP_LE = 89,                     /* "=<"  */
+  YYSYMBOL_SP_GEU = 90,                    /* "+=>"  */
+  YYSYMBOL_SP_LEU = 91,                    /* "+=<"  */
+  YYSYMBOL_SP_GTU = 92,                    /* "+>"  */
+  YYSYMBOL_SP_LTU = 93,                    /* "+<"  */
+  YYSYMBOL_SP_NE = 94,                     /* "<>"  */
+  YYSYMBOL_SP_EQ = 95,                     /* "=="  */
+  YYSYMBOL_SP_SGNCOMP = 96,                /* "<=>"  */
+  YYSYMBOL_SP_LIMITMIN = 97,               /* "#>"  */
+  YYSYMBOL_SP_LIMITMAX = 98,               /* "<#"  */
+  YYSYMBOL_SP_REMAINDER = 99,              /* "//"  */
+  YYSYMBOL_SP_UNSDIV = 100,                /* "+/"  */
+  YYSYMBOL_SP_UNSMOD = 101,                /* "+//"  */
+  YYSYMBOL_SP_FRAC = 102,                  /* "FRAC"  */
+  YYSYMBOL_SP_HIGHMULT = 103,              /* "**"  */
+  YYSYMBOL_SP_SCAS = 104,                  /* "SCAS"  */
+  YYSYMBOL_SP_UNSHIGHMULT = 105,           /* "SCA (+**)"  */
+  YYSYMBOL_SP_ROTR = 106,                  /* "ROR (->)"  */
+  YYSYMBOL_SP_ROTL = 107,                  /* "ROL (<-)"  */
+  YYSYMBOL_SP_SHL = 108,                   /* "<<"  */
+  YYSYMBOL_SP_SHR = 109,                   /* ">>"  */
+  YYSYMBOL_SP_SAR = 110,                   /* "SAR (~>)"  */
+  YYSYMBOL_SP_REV = 111,                   /* "><"  */
+  YYSYMBOL_SP_REV2 = 112,                  /* "REV"  */
+  YYSYMBOL_SP_ADDBITS = 113,               /* "ADDBITS"  */
+  YYSYMBOL_SP_ADDPINS = 114,               /* "ADDPINS"  */
+  YYSYMBOL_SP_NEGATE = 115,                /* "-"  */
+  YYSYMBOL_SP_BIT_NOT = 116,               /* "!"  */
+  YYSYMBOL_SP_SQRT = 117,                  /* "SQRT (^^)"  */
+  YYSYMBOL_SP_ABS = 118,                   /* "ABS (||)"  */
+  YYSYMBOL_SP_FSQRT = 119,                 /* "FSQRT"  */
+  YYSYMBOL_SP_FABS = 120,                  /* "FABS"  */
+  YYSYMBOL_SP_DECODE = 121,                /* "DECOD (|<)"  */
+  YYSYMBOL_SP_ENCODE = 122,                /* ">|"  */
+  YYSYMBOL_SP_ENCODE2 = 123,               /* "ENCOD"  */
+  YYSYMBOL_SP_NOT = 124,                   /* "NOT (!!)"  */
+  YYSYMBOL_SP_DOUBLETILDE = 125,           /* "~~"  */
+  YYSYMBOL_SP_INCREMENT = 126,             /* "++"  */
+  YYSYMBOL_SP_DECREMENT = 127,             /* "--"  */
+  YYSYMBOL_SP_DOUBLEAT = 128,              /* "@@"  */
+  YYSYMBOL_SP_TRIPLEAT = 129,              /* "@@@"  */
+  YYSYMBOL_SP_FLOAT = 130,                 /* "floating point number"  */
+  YYSYMBOL_SP_TRUNC = 131,                 /* "TRUNC"  */
+  YYSYMBOL_SP_ROUND = 132,                 /* "ROUND"  */
+  YYSYMBOL_SP_CONSTANT = 133,              /* "constant"  */
+  YYSYMBOL_SP_RANDOM = 134,                /* "??"  */
+  YYSYMBOL_SP_EMPTY = 135,                 /* "empty assignment marker _"  */
+  YYSYMBOL_SP_SIGNX = 136,                 /* "SIGNX"  */
+  YYSYMBOL_SP_ZEROX = 137,                 /* "ZEROX"  */
+  YYSYMBOL_SP_NAN = 138,                   /* "NAN"  */
+  YYSYMBOL_SP_ONES = 139,                  /* "ONES"  */
+  YYSYMBOL_SP_BMASK = 140,                 /* "BMASK"  */
+  YYSYMBOL_SP_QLOG = 141,                  /* "QLOG"  */
+  YYSYMBOL_SP_QEXP = 142,                  /* "QEXP"  */
+  YYSYMBOL_SP_DEBUG = 143,                 /* "DEBUG"  */
+  YYSYMBOL_SP_LOOK_SEP = 144,              /* ": after lookup/down"  */
+  YYSYMBOL_SP_CONDITIONAL = 145,           /* "?"  */
+  YYSYMBOL_SP_CONDITIONAL_SEP = 146,       /* ": after ?"  */
+  YYSYMBOL_SP_FADD = 147,                  /* "+."  */
+  YYSYMBOL_SP_FSUB = 148,                  /* "-."  */
+  YYSYMBOL_SP_FMUL = 149,                  /* "*."  */
+  YYSYMBOL_SP_FDIV = 150,                  /* "%."  */
+  YYSYMBOL_SP_FLT = 151,                   /* "<."  */
+  YYSYMBOL_SP_FGT = 152,                   /* ">."  */
+  YYSYMBOL_SP_FNE = 153,                   /* "<>."  */
+  YYSYMBOL_SP_FEQ = 154,                   /* "==."  */
+  YYSYMBOL_SP_FLE = 155,                   /* "<=."  */
+  YYSYMBOL_SP_FGE = 156,                   /* ">=."  */
+  YYSYMBOL_SP_FNEGATE = 157,               /* "float negate"  */
+  YYSYMBOL_158_ = 158,                     /* '\\'  */
+  YYSYMBOL_159_ = 159,                     /* '<'  */
+  YYSYMBOL_160_ = 160,                     /* '>'  */
+  YYSYMBOL_161_ = 161,                     /* '-'  */
+  YYSYMBOL_162_ = 162,                     /* '+'  */
+  YYSYMBOL_163_ = 163,                     /* '*'  */
+  YYSYMBOL_164_ = 164,                     /* '/'  */
+  YYSYMBOL_165_ = 165,                     /* '|'  */
+  YYSYMBOL_166_ = 166,                     /* '^'  */
+  YYSYMBOL_167_ = 167,                     /* '&'  */
+  YYSYMBOL_168_ = 168,                     /* '@'  */
+  YYSYMBOL_169_ = 169,                     /* '~'  */
+  YYSYMBOL_170_ = 170,                     /* '?'  */
+  YYSYMBOL_171_ = 171,                     /* '='  */
+  YYSYMBOL_172_ = 172,                     /* '('  */
+  YYSYMBOL_173_ = 173,                     /* ')'  */
+  YYSYMBOL_174_ = 174,                     /* ':'  */
+  YYSYMBOL_175_ = 175,                     /* ','  */
+  YYSYMBOL_176_ = 176,                     /* '['  */
+  YYSYMBOL_177_ = 177,                     /* ']'  */
+  YYSYMBOL_178_ = 178,                     /* '#'  */
+  YYSYMBOL_179_ = 179,                     /* '!'  */
+  YYSYMBOL_180_ = 180,                     /* '.'  */
+  YYSYMBOL_YYACCEPT = 181,                 /* $accept  */
+  YYSYMBOL_input = 182,                    /* input  */
+  YYSYMBOL_rest = 183,                     /* rest  */
+  YYSYMBOL_emptyline = 184,                /* emptyline  */
+  YYSYMBOL_emptylines = 185,               /* emptylines  */
+  YYSYMBOL_topelement = 186,               /* topelement  */
+  YYSYMBOL_funcdef = 187,                  /* funcdef  */
+  YYSYMBOL_optparamlist = 188,             /* optparamlist  */
+  YYSYMBOL_resultname = 189,               /* resultname  */
+  YYSYMBOL_localvars = 190,                /* localvars  */
+  YYSYMBOL_funcbody = 191,                 /* funcbody  */
+  YYSYMBOL_stmtlist = 192,                 /* stmtlist  */
+  YYSYMBOL_stmt = 193,                     /* stmt  */
+  YYSYMBOL_basicstmt = 194,                /* basicstmt  */
+  YYSYMBOL_debug_exprlist = 195,           /* debug_exprlist  */
+  YYSYMBOL_debug_exprlist_continue = 196,  /* debug_exprlist_continue  */
+  YYSYMBOL_debug_expritem_first = 197,     /* debug_expritem_first  */
+  YYSYMBOL_debug_expritem = 198,           /* debug_expritem  */
+  YYSYMBOL_asmdebug_func = 199,            /* asmdebug_func  */
+  YYSYMBOL_asmdebug_exprlist = 200,        /* asmdebug_exprlist  */
+  YYSYMBOL_asmdebug_exprlist_continue = 201, /* asmdebug_exprlist_continue  */
+  YYSYMBOL_asmdebug_expritem_first = 202,  /* asmdebug_expritem_first  */
+  YYSYMBOL_asmdebug_expritem = 203,        /* asmdebug_expritem  */
+  YYSYMBOL_multiassign = 204,              /* multiassign  */
+  YYSYMBOL_compoundstmt = 205,             /* compoundstmt  */
+  YYSYMBOL_stmtblock = 206,                /* stmtblock  */
+  YYSYMBOL_ifstmt = 207,                   /* ifstmt  */
+  YYSYMBOL_elseblock = 208,                /* elseblock  */
+  YYSYMBOL_casestmt = 209,                 /* casestmt  */
+  YYSYMBOL_casematchlist = 210,            /* casematchlist  */
+  YYSYMBOL_casematchitem = 211,            /* casematchitem  */
+  YYSYMBOL_casematch = 212,                /* casematch  */
+  YYSYMBOL_matchexprlist = 213,            /* matchexprlist  */
+  YYSYMBOL_matchexpritem = 214,            /* matchexpritem  */
+  YYSYMBOL_rangeexpritem = 215,            /* rangeexpritem  */
+  YYSYMBOL_rangeexprlist = 216,            /* rangeexprlist  */
+  YYSYMBOL_repeatstmt = 217,               /* repeatstmt  */
+  YYSYMBOL_lookupexpr = 218,               /* lookupexpr  */
+  YYSYMBOL_lookdownexpr = 219,             /* lookdownexpr  */
+  YYSYMBOL_conblock = 220,                 /* conblock  */
+  YYSYMBOL_conline = 221,                  /* conline  */
+  YYSYMBOL_enumlist = 222,                 /* enumlist  */
+  YYSYMBOL_enumitem = 223,                 /* enumitem  */
+  YYSYMBOL_datblock = 224,                 /* datblock  */
+  YYSYMBOL_datline = 225,                  /* datline  */
+  YYSYMBOL_basedatline = 226,              /* basedatline  */
+  YYSYMBOL_objblock = 227,                 /* objblock  */
+  YYSYMBOL_objline = 228,                  /* objline  */
+  YYSYMBOL_varblock = 229,                 /* varblock  */
+  YYSYMBOL_varline = 230,                  /* varline  */
+  YYSYMBOL_identlist = 231,                /* identlist  */
+  YYSYMBOL_identdecl = 232,                /* identdecl  */
+  YYSYMBOL_vardecl = 233,                  /* vardecl  */
+  YYSYMBOL_vardecllist = 234,              /* vardecllist  */
+  YYSYMBOL_paramidentdecl = 235,           /* paramidentdecl  */
+  YYSYMBOL_paramidentlist = 236,           /* paramidentlist  */
+  YYSYMBOL_expr = 237,                     /* expr  */
+  YYSYMBOL_lhs = 238,                      /* lhs  */
+  YYSYMBOL_lhsseq = 239,                   /* lhsseq  */
+  YYSYMBOL_lhsseqcont = 240,               /* lhsseqcont  */
+  YYSYMBOL_lhssingle = 241,                /* lhssingle  */
+  YYSYMBOL_memref = 242,                   /* memref  */
+  YYSYMBOL_opt_numrets = 243,              /* opt_numrets  */
+  YYSYMBOL_funccall = 244,                 /* funccall  */
+  YYSYMBOL_expritem = 245,                 /* expritem  */
+  YYSYMBOL_exprlist = 246,                 /* exprlist  */
+  YYSYMBOL_datexpritem = 247,              /* datexpritem  */
+  YYSYMBOL_datexprlist = 248,              /* datexprlist  */
+  YYSYMBOL_operand = 249,                  /* operand  */
+  YYSYMBOL_operandlist = 250,              /* operandlist  */
+  YYSYMBOL_range = 251,                    /* range  */
+  YYSYMBOL_integer = 252,                  /* integer  */
+  YYSYMBOL_float = 253,                    /* float  */
+  YYSYMBOL_string = 254,                   /* string  */
+  YYSYMBOL_identifier = 255,               /* identifier  */
+  YYSYMBOL_annotation = 256,               /* annotation  */
+  YYSYMBOL_hwreg = 257,                    /* hwreg  */
+  YYSYMBOL_instruction = 258,              /* instruction  */
+  YYSYMBOL_instrmodifier = 259,            /* instrmodifier  */
+  YYSYMBOL_modifierlist = 260              /* modifierlist  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if 1
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* 1 */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined SPINYYSTYPE_IS_TRIVIAL && SPINYYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  141
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   20191
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  181
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  80
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  445
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  966
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   412
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_uint8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,   179,     2,   178,     2,     2,   167,     2,
+     172,   173,   163,   162,   175,   161,   180,   164,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,   174,     2,
+     159,   171,   160,   170,   168,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,   176,   158,   177,   166,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,   165,     2,   169,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
+     155,   156,   157
+};
+
+#if SPINYYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   504,   504,   505,   514,   515,   519,   522,   523,   527,
+     529,   531,   536,   538,   542,   544,   546,   548,   550,   552,
+     555,   557,   560,   566,   572,   577,   586,   590,   595,   597,
+     603,   604,   618,   619,   625,   626,   632,   637,   641,   648,
+     650,   652,   654,   659,   661,   665,   667,   677,   679,   680,
+     682,   684,   686,   695,   707,   709,   714,   716,   721,   725,
+     734,   736,   741,   743,   745,   750,   751,   756,   757,   762,
+     766,   776,   778,   780,   782,   787,   789,   793,   795,   797,
+     799,   804,   806,   811,   813,   818,   820,   822,   824,   829,
+     831,   836,   838,   843,   861,   869,   870,   875,   877,   879,
+     885,   887,   892,   893,   898,   905,   907,   909,   914,   922,
+     930,   938,   948,   954,   960,   966,   971,   973,   977,   979,
+     984,   986,   991,   993,   995,  1000,  1002,  1007,  1009,  1011,
+    1015,  1017,  1022,  1028,  1033,  1034,  1051,  1053,  1055,  1057,
+    1059,  1061,  1063,  1065,  1069,  1073,  1075,  1077,  1079,  1081,
+    1083,  1085,  1087,  1089,  1091,  1093,  1095,  1101,  1103,  1105,
+    1107,  1109,  1111,  1113,  1115,  1125,  1136,  1143,  1145,  1150,
+    1152,  1154,  1161,  1172,  1174,  1179,  1181,  1183,  1185,  1190,
+    1192,  1194,  1196,  1201,  1203,  1206,  1211,  1213,  1218,  1220,
+    1222,  1224,  1229,  1231,  1236,  1238,  1240,  1245,  1250,  1255,
+    1260,  1265,  1270,  1275,  1280,  1285,  1290,  1298,  1300,  1303,
+    1308,  1309,  1310,  1311,  1316,  1317,  1328,  1330,  1332,  1334,
+    1336,  1338,  1340,  1342,  1344,  1346,  1348,  1350,  1352,  1354,
+    1356,  1358,  1360,  1362,  1364,  1366,  1368,  1370,  1372,  1374,
+    1376,  1378,  1380,  1382,  1384,  1386,  1389,  1391,  1393,  1395,
+    1397,  1399,  1401,  1403,  1405,  1407,  1409,  1411,  1413,  1415,
+    1417,  1419,  1421,  1423,  1425,  1427,  1429,  1431,  1433,  1435,
+    1437,  1439,  1441,  1443,  1445,  1447,  1449,  1451,  1453,  1455,
+    1457,  1459,  1461,  1463,  1465,  1467,  1469,  1471,  1473,  1475,
+    1477,  1479,  1481,  1483,  1485,  1492,  1499,  1506,  1508,  1510,
+    1512,  1514,  1516,  1518,  1520,  1522,  1524,  1526,  1528,  1530,
+    1532,  1534,  1536,  1538,  1540,  1542,  1553,  1558,  1563,  1565,
+    1567,  1569,  1571,  1573,  1575,  1577,  1579,  1581,  1583,  1585,
+    1587,  1589,  1591,  1593,  1595,  1597,  1599,  1601,  1607,  1609,
+    1611,  1619,  1630,  1632,  1634,  1636,  1638,  1640,  1642,  1644,
+    1646,  1648,  1654,  1660,  1662,  1664,  1666,  1668,  1670,  1672,
+    1674,  1678,  1679,  1683,  1693,  1699,  1701,  1704,  1712,  1715,
+    1717,  1723,  1725,  1727,  1729,  1731,  1733,  1739,  1741,  1746,
+    1748,  1753,  1755,  1760,  1762,  1764,  1766,  1768,  1770,  1776,
+    1777,  1782,  1784,  1789,  1798,  1805,  1812,  1819,  1826,  1830,
+    1840,  1844,  1849,  1853,  1858,  1864,  1873,  1875,  1879,  1883,
+    1889,  1895,  1902,  1903,  1908,  1910,  1912,  1914,  1916,  1922,
+    1927,  1929,  1934,  1935,  1940,  1942,  1944,  1946,  1954,  1956,
+    1961,  1963,  1968,  1972,  1976,  1980,  1982,  1987,  1993,  1998,
+    2000,  2018,  2023,  2028,  2030,  2032
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if 1
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "\"identifier\"",
+  "\"__bytecode__\"", "\"number\"", "\"string\"", "\"` string\"",
+  "\"float point number\"", "\"SPR\"", "\"REG\"", "\"CON\"", "\"VAR\"",
+  "\"DAT\"", "\"PUB\"", "\"PRI\"", "\"OBJ\"", "\"ASM\"", "\"ASM_CONST\"",
+  "\"ENDASM\"", "\"END\"", "\"CCODE\"", "\"BYTE\"", "\"WORD\"", "\"LONG\"",
+  "\"BYTEFIT\"", "\"WORDFIT\"", "\"FVAR\"", "\"FVARS\"", "\"ASMCLK\"",
+  "\"instruction\"", "\"instruction modifier\"", "\"hardware register\"",
+  "\"ORG\"", "\"ORGH\"", "\"ORGF\"", "\"RES\"", "\"FIT\"", "\"ALIGNL\"",
+  "\"ALIGNW\"", "\"REPEAT\"", "\"FROM\"", "\"TO\"", "\"STEP\"",
+  "\"WHILE\"", "\"UNTIL\"", "\"IF\"", "\"IFNOT\"", "\"ELSE\"",
+  "\"ELSEIF\"", "\"ELSEIFNOT\"", "\"THEN\"", "\"ENDIF\"", "\"LOOKDOWN\"",
+  "\"LOOKDOWNZ\"", "\"LOOKUP\"", "\"LOOKUPZ\"", "\"COGINIT\"",
+  "\"COGNEW\"", "\"PINREAD\"", "\"PINTOGGLE\"", "\"PINWRITE\"",
+  "\"PINLOW\"", "\"PINHIGH\"", "\"CASE\"", "\"CASE_FAST\"", "\"OTHER\"",
+  "\"QUIT\"", "\"NEXT\"", "\"__BUILTIN_ALLOCA\"", "\"ABORT\"",
+  "\"RESULT\"", "\"RETURN\"", "\"indentation\"", "\"lack of indentation\"",
+  "\"end of line\"", "\"end of file\"", "\"..\"", "\"$\"", "\"STRING\"",
+  "\"FILE\"", "SP_ANNOTATION", "\":=\"", "\"XOR (^^)\"", "\"OR (||)\"",
+  "\"AND (&&)\"", "\"__ORELSE__\"", "\"__ANDTHEN__\"", "\"=>\"", "\"=<\"",
+  "\"+=>\"", "\"+=<\"", "\"+>\"", "\"+<\"", "\"<>\"", "\"==\"", "\"<=>\"",
+  "\"#>\"", "\"<#\"", "\"//\"", "\"+/\"", "\"+//\"", "\"FRAC\"", "\"**\"",
+  "\"SCAS\"", "\"SCA (+**)\"", "\"ROR (->)\"", "\"ROL (<-)\"", "\"<<\"",
+  "\">>\"", "\"SAR (~>)\"", "\"><\"", "\"REV\"", "\"ADDBITS\"",
+  "\"ADDPINS\"", "\"-\"", "\"!\"", "\"SQRT (^^)\"", "\"ABS (||)\"",
+  "\"FSQRT\"", "\"FABS\"", "\"DECOD (|<)\"", "\">|\"", "\"ENCOD\"",
+  "\"NOT (!!)\"", "\"~~\"", "\"++\"", "\"--\"", "\"@@\"", "\"@@@\"",
+  "\"floating point number\"", "\"TRUNC\"", "\"ROUND\"", "\"constant\"",
+  "\"??\"", "\"empty assignment marker _\"", "\"SIGNX\"", "\"ZEROX\"",
+  "\"NAN\"", "\"ONES\"", "\"BMASK\"", "\"QLOG\"", "\"QEXP\"", "\"DEBUG\"",
+  "\": after lookup/down\"", "\"?\"", "\": after ?\"", "\"+.\"", "\"-.\"",
+  "\"*.\"", "\"%.\"", "\"<.\"", "\">.\"", "\"<>.\"", "\"==.\"", "\"<=.\"",
+  "\">=.\"", "\"float negate\"", "'\\\\'", "'<'", "'>'", "'-'", "'+'",
+  "'*'", "'/'", "'|'", "'^'", "'&'", "'@'", "'~'", "'?'", "'='", "'('",
+  "')'", "':'", "','", "'['", "']'", "'#'", "'!'", "'.'", "$accept",
+  "input", "rest", "emptyline", "emptylines", "topelement", "funcdef",
+  "optparamlist", "resultname", "localvars", "funcbody", "stmtlist",
+  "stmt", "basicstmt", "debug_exprlist", "debug_exprlist_continue",
+  "debug_expritem_first", "debug_expritem", "asmdebug_func",
+  "asmdebug_exprlist", "asmdebug_exprlist_continue",
+  "asmdebug_expritem_first", "asmdebug_expritem", "multiassign",
+  "compoundstmt", "stmtblock", "ifstmt", "elseblock", "casestmt",
+  "casematchlist", "casematchitem", "casematch", "matchexprlist",
+  "matchexpritem", "rangeexpritem", "rangeexprlist", "repeatstmt",
+  "lookupexpr", "lookdownexpr", "conblock", "conline", "enumlist",
+  "enumitem", "datblock", "datline", "basedatline", "objblock", "objline",
+  "varblock", "varline", "identlist", "identdecl", "vardecl",
+  "vardecllist", "paramidentdecl", "paramidentlist", "expr", "lhs",
+  "lhsseq", "lhsseqcont", "lhssingle", "memref", "opt_numrets", "funccall",
+  "expritem", "exprlist", "datexpritem", "datexprlist", "operand",
+  "operandlist", "range", "integer", "float", "string", "identifier",
+  "annotation", "hwreg", "instruction", "instrmodifier", "modifierlist", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-818)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-382)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+     377,   -46,  -818,    94,   417,   959,   216,   306,   232,  -818,
+    -818,  -818, 13235,    58,  -818,   661,   377,  -818,   -21,  -818,
+    -101,  -818,  -818,    49,     4,   123,   123,   123,    59,    76,
+    -818,  1092,  -818,    89,     5,   109,  2313,  2481,  2649,  2817,
+    2985,  -818,  -818,  -818,  4232,  4373, 13235, 13235,  4514,   136,
+     141,  -818,   219,    67,   212,  1195,  -818,  -818,   731, 13871,
+    3321,     7,   278,  1492,    78,    81,   282,  1492,   302,   115,
+     229,  -818,   781,  -818,  -105,  -818,  -818,  -818,   196,   199,
+     208,   220,   224,  -818, 13235,   209,   233,   247,   253,   254,
+     271,   298,   299,   312,   313,   322,   328,  -818,   334,  4655,
+    4796, 13235, 13235,  4937,  5078,  5219,  5360,   714,   714,   714,
+   13235, 13235,   337,   338,   352,   353,   714, 13235,  5501,  5642,
+   13235, 13235, 13235, 13235,  5783, 13235, 13235,   714, 13235,  5924,
+    -818,  -818, 16394,   303,    13,  -818,  -818,  -818,  -818,   273,
+      37,  -818,  -818,  -818,  -818,  -818,     9, 13235, 13235,   329,
+    -818,   -19,  -818,    25,    -7,    -4,  -818,  -818,  -818,  -818,
+   13235,  -818,  6065,  6206,  6347, 13376, 13376, 13376, 13376,  -818,
+    5783, 19663,  -818,  -818,    28,   274,   286,   356,  -818,    63,
+    -818,    87,  -818,    88,  -818,    95,  -818, 14401,  -818, 16582,
+   16675, 16768,  -818, 16861,  -818,  -818,   400,   126,  -818,  -818,
+    -818,  1278,  -818,  6488, 16488,  -818,    -1,  -818,     8,  -818,
+      25,   438,   357, 13871, 13871,  -818, 13871,  3462, 13235, 13235,
+   13235, 13235,   458,   469,  6629,  6770,  1973,  -818,  -818,   381,
+    6911,  -818,  1801,  -818,  -818,  -818,  -818,  -818,  -818,  -818,
+    -818, 16954,   560,   475,   384,    25,    56,   387,  -818,   388,
+       6,    25,   559,  1492,    79,    25,  -818,    25,   561,  1492,
+    -818,  -818,   219,   219, 13235, 13235, 13235, 13235, 13235, 14308,
+   13235, 13235, 13235, 13235, 13376, 13376, 13235, 13235, 13235, 13235,
+   13235, 13235, 13376, 13235,  -818, 13235,  -818,  -818,  -818, 13235,
+    -818, 13235,  -818, 13235,  -818, 13235, 19913, 13235,  -818,    64,
+    -818,  -818,  -818,  -818, 13235, 13235, 13235, 13235,  -818,  -818,
+   13235,  -818, 13235,  -818,  -818,  -818,  -818, 19663, 13235,  -818,
+    -818,  -818,  -818, 18340, 13235,  -818,  7052,  7193,  7334, 13235,
+   13235,  7475,  7616, 13235, 13235, 13235, 13235,  7757, 13235, 13235,
+    7898,  8039,  8180,  8321,  8462,  8603,  8744,  8885,  9026,  9167,
+    9308,  9449,  9590,  9731,  9872, 10013, 10154, 10295, 10436, 10577,
+   13235, 13235, 13235, 13235, 13235, 13235, 13235, 13235, 13235, 13235,
+   13235,  3603, 10718, 10859, 11000, 11141, 11282, 11423, 11564, 11705,
+   13235, 13235,  -818,  -818,  -818,  -818, 13235,  -818, 13235,   395,
+   11846, 13235,    25,    54, 12018,   397,  -818, 19663, 14494,  -818,
+    -818,  -818,    25,  -818,  -818,  -818, 14589,  -818,  -818,  -818,
+    -818,  -818,  -818,  -818,   399,   401,  -818,  3153, 13235, 13235,
+   13235,  -818,  -818,  -818,  -818,  -818, 13235,  -818,  -818,  -818,
+    -818,  -818,  -818,   407,   409,   508,  -818,   412,   413,  -818,
+    -818,  -818,   415, 13235, 19663, 13235,  -818, 12159,    10,  -818,
+     558,  -818,  -818,  -818,   590,  1644,  3227, 12828, 13235, 13235,
+     526, 17047,   237, 14221, 17140, 17233, 17326,  -818,  -818,  -818,
+   17419,  -818, 13376,  -818,   105,  -818,  2145,  3778,   426,  -818,
+    -818, 13517,   480,   530,  -818,    17,   123,   444,    25, 12300,
+   13235,  -818,    25,  -818,  -818,   532,    25,  -818,  -818,  -818,
+   14684, 14779, 14874, 14969, 15064, 13235, 19238, 19323, 19408, 19493,
+     116,   135,   443, 18431,   445,   436,   456,   457, 18516,   138,
+   19663, 19663, 19663, 19663, 19663, 19663, 18607, 13235,    54, 18698,
+   18789, 18880, 18971, 19663, 19663, 19663,    12, 19663, 13235,  1599,
+   13235, 19833, 13235, 19913, 19833, 19913, 13235, 19934, 13235, 19934,
+   19934, 19934, 19934, 19934, 13235, 19934, 19934, 19934, 13235,  1261,
+   13235,  1261, 13235,  1131, 13235,  1131, 13235,  1131, 13235,  1131,
+   13235,  1131, 13235,  1131, 13235,  1131, 13235,  -818, 13235,  -818,
+   13235,  -818, 13235,  -818, 13235,  -818, 13235,  -818, 13235,  -818,
+   13235, 20005, 13235, 20005, 13235,  -818, 13235,  -818, 19578, 20024,
+   20024,  1131,  1131, 19934, 19934, 19934, 19934, 19934, 19934, 13235,
+   13235, 19934, 13235, 19934, 13235, 20024, 13235, 20024, 13235,  1131,
+   13235,  1131, 13235,   975, 13235,  1151, 13235,   773, 15159, 19663,
+   19663, 15254, 13235,   462,   249, 15349,  -818,  -818,  -818,  -818,
+   13235,   110,   439, 19062,   454, 13235,  -818,  -818,  -818, 13235,
+   13235,  -818, 15444, 15539, 15634, 17512, 12159, 12159,  -818,   557,
+     588, 12159, 19663, 15729,  -818,  -818,  -818,   466,  -818,  -818,
+    -818, 17605, 17698,    57,   526, 13235,   526,   526,   567,   568,
+    -818, 18340,   259,  -818, 13376,  -818,  -818,   571,   470,   472,
+    -818,   480, 13376,   473,  -818,   476,  -818,  -818,  -818,   388,
+     498,   575,  -818,   224,   334,   337,    -5, 12441, 13658, 13799,
+   19663, 15824,  -818,  -818,  -818,  -818,  -818,  -818,  -818,  -818,
+   14128, 13235, 13235, 13235, 13235,  -818,  -818,  -818, 13235,  -818,
+   13376,  -818,  -818,  -818,  -818,   477, 15919,   479,  -818,  -818,
+    -818,  -818, 13235, 13235, 19663, 19663, 19663, 19663, 19663, 19663,
+   19663, 19663, 19663, 19663, 19663, 19663, 19663, 19663, 19663, 19663,
+   19663, 19663, 19663, 19663, 19663, 19663, 19663, 19663, 19663, 19663,
+   13235, 19934, 19663, 19663, 19663, 19663, 19663, 19663, 19663, 19663,
+   19663,  -818,   478,   483,   657,  -818,   462,   484,   488, 12582,
+   13235, 13235, 13235,  -818,   489, 16014, 16109,  -818,  -818,  -818,
+    -818,   263,   269,  -818,  -818,   482,  -818,   284,  -818,   592,
+     526,   526, 13235, 13235,  -818, 13948,   150,  -818,  -818, 12754,
+   12754,   593,  -818,  -818,   594, 12922,   290,   341,   480,    25,
+      25,    25,  -818,  -818,   495,  -818,  -818,   654,   224,   224,
+     208,   220,   224,  -818, 13235,  -818,   344,   362,   365,   366,
+   19663,   506,   501, 18248, 16204, 19748,   507,  -818,  -818,  -818,
+      50,  -818,   462,   370, 16299,   505, 19663,  -818,  -818,  -818,
+    -818,  -818,   588,  -818,  -818,  -818,  -818, 17791, 17884, 13235,
+     618, 13235, 13235,  -818,  3950,  -818,   623,  -131,  -818, 19153,
+    4091,  -818,  -818,  -818,   529,  -818,  -818,  -818,  -818,  -818,
+    -818,  -818,  -818,   498,  -818, 19663,  -818, 13235,  -818,  -818,
+    -818,  -818,   537, 13235,  -818, 13235, 13235,   533,  -818,   462,
+    -818,  -818,  -818,  -818,  -818, 14043,   526, 17977, 18070,  -818,
+    -818,   526,  -818, 12754, 13235,  -818, 12922,  -818,  -818, 19663,
+     531,   538, 13063,  -818, 13235,   526,  -818,   526,   526,  -818,
+    -818, 19663,  -818,  -818,  -818,   462,   374, 18163,  -818,  -818,
+    -818,  -818,   462,   526,  -818,  -818
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
+{
+       0,     0,   435,     0,     0,     0,     0,     0,     0,   436,
+     123,   437,     0,     0,     2,     4,     0,   120,     0,   125,
+     128,     7,   124,     0,     0,     0,     0,     0,     0,     0,
+     181,     0,   173,     0,   186,     0,     0,     0,     0,     0,
+       0,   166,   439,   442,     0,     0,     0,     0,     0,     0,
+       0,   136,     0,     0,     0,     0,   132,   134,     0,     0,
+       0,     0,     0,     0,    26,     0,     0,     0,    26,     0,
+       0,   169,     0,   167,     0,   432,   434,   433,     0,     0,
+       0,     0,     0,   438,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   342,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     358,   359,   130,   214,   373,   314,   210,   211,   212,   361,
+     365,     1,     5,     3,   121,   122,     0,     0,     0,    24,
+     182,     0,   183,     0,     0,     0,   179,   180,   174,   178,
+       0,   137,     0,     0,     0,     0,     0,     0,     0,   138,
+       0,   406,   414,   422,     0,   210,   211,   212,   140,     0,
+     146,     0,   142,     0,   144,     0,   154,     0,   157,     0,
+       0,     0,   162,     0,   152,   153,     0,     0,   440,   133,
+     135,     0,   148,     0,   424,   428,     0,   443,     0,   441,
+       0,     0,     0,     0,     0,   115,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    41,   382,     0,
+       0,    14,     0,    37,    39,    48,    40,    79,    77,    80,
+      78,     0,   214,     0,     0,     0,     0,    30,   207,    28,
+     194,     0,     0,     0,    26,     0,    15,     0,     0,     0,
+     170,   168,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   327,     0,   324,   326,   323,     0,
+     329,     0,   331,     0,   332,     0,   321,     0,   352,   361,
+     345,   346,   216,   217,     0,     0,     0,     0,   348,   337,
+       0,   338,     0,   340,   335,   336,   316,   313,     0,   315,
+     317,   215,   351,     0,     0,   318,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   350,   343,   344,   347,     0,   349,     0,     0,
+       0,     0,     0,     0,     0,     0,   126,   127,     0,     6,
+       8,   175,     0,   184,   176,   177,     0,   417,   416,   415,
+     419,   418,   420,   421,   210,   211,   139,     0,     0,     0,
+       0,   141,   147,   143,   145,   155,     0,   158,   159,   160,
+     161,   163,    69,     0,     0,     0,    74,     0,    65,    70,
+      73,    72,     0,     0,   425,     0,   149,     0,     0,   150,
+       0,   444,    18,    42,     0,     0,     0,     0,     0,     0,
+       0,     0,   361,     0,     0,     0,     0,    50,    51,    46,
+       0,    43,     0,   412,     0,    82,     0,     0,     0,    38,
+      49,     0,     0,     0,    27,     0,     0,    32,     0,     0,
+       0,   208,     0,    16,    19,     0,     0,    17,   172,   171,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   100,     0,     0,     0,     0,     0,     0,
+     328,   325,   330,   333,   334,   322,     0,     0,     0,     0,
+       0,     0,     0,   339,   341,   320,   312,   319,     0,   270,
+       0,   269,     0,   268,   267,   266,     0,   230,     0,   231,
+     232,   233,   234,   235,     0,   236,   237,   238,     0,   253,
+       0,   254,     0,   246,     0,   247,     0,   248,     0,   252,
+       0,   249,     0,   250,     0,   251,     0,   262,     0,   261,
+       0,   263,     0,   264,     0,   265,     0,   257,     0,   258,
+       0,   259,     0,   260,     0,   256,     0,   255,     0,   271,
+     272,   273,   274,   242,   241,   240,   239,   244,   243,     0,
+       0,   229,     0,   228,     0,   222,     0,   221,     0,   223,
+       0,   224,     0,   226,     0,   227,     0,   225,     0,   218,
+     220,     0,     0,   389,     0,     0,   219,   386,   387,   388,
+       0,   402,     0,   430,     0,     0,   129,   185,   187,     0,
+       0,   423,     0,     0,     0,     0,     0,     0,   164,     0,
+       0,     0,   426,     0,   429,   151,   445,     0,   112,   113,
+     114,     0,     0,   104,     0,     0,     0,     0,     0,     0,
+      47,   406,     0,    45,     0,    81,    58,     0,     0,    54,
+      59,     0,     0,    76,   381,   378,   379,    23,    29,    31,
+       0,     0,   209,   197,   206,   202,     0,     0,     0,     0,
+     196,     0,    20,    22,    21,   374,   375,   383,   384,   385,
+       0,     0,     0,     0,     0,   398,   399,   394,     0,   397,
+       0,   395,   396,   354,   213,     0,     0,     0,   355,   357,
+     356,   353,     0,     0,   304,   303,   302,   308,   307,   309,
+     289,   290,   282,   283,   284,   288,   285,   287,   286,   298,
+     297,   299,   300,   301,   293,   294,   295,   296,   292,   291,
+       0,   245,   305,   306,   276,   275,   278,   277,   280,   281,
+     279,   131,   369,     0,     0,   392,   389,   362,     0,     0,
+       0,     0,     0,   366,     0,     0,     0,   407,   408,   411,
+     156,     0,     0,   165,    71,    66,    67,     0,   427,     0,
+       0,     0,     0,     0,   111,     0,    85,    83,    84,     0,
+       0,     0,   413,    52,     0,     0,     0,     0,     0,     0,
+       0,     0,   188,   192,    33,    25,   200,     0,   198,   199,
+     205,   204,   203,   195,     0,   102,     0,     0,     0,     0,
+     101,     0,   362,     0,     0,   311,     0,   371,   390,   391,
+       0,   376,   389,     0,     0,     0,   431,   368,   409,   410,
+      63,    64,     0,    62,    35,   107,   108,     0,     0,     0,
+       0,     0,     0,    97,     0,    91,     0,     0,    95,    99,
+       0,    44,    53,    60,    55,    56,    61,   377,    75,   380,
+     189,   190,   191,     0,   201,   360,   119,     0,   118,   117,
+     116,   393,     0,     0,   372,     0,     0,   405,   401,   389,
+     363,   367,    68,   105,   106,     0,     0,     0,     0,    89,
+      92,     0,    94,     0,     0,    90,     0,   193,   103,   310,
+       0,     0,     0,   400,     0,     0,    86,     0,     0,    93,
+      96,    98,    57,   370,   364,   389,     0,     0,   110,    87,
+      88,   404,   389,     0,   403,   109
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -818,  -818,   260,  -818,  -818,  -818,    35,  -818,  -818,  -818,
+     -57,   493,  -230,  -818,  -818,  -818,  -818,  -216,  -818,  -818,
+    -818,  -818,  -651,  -818,  -818,  -440,  -818,  -646,  -818,  -114,
+    -817,  -818,  -818,  -208,  -253,  -312,  -818,  -818,  -818,   723,
+      24,  -818,   581,   -38,   -54,   670,  -818,   667,  -818,   709,
+     205,    14,  -160,  -818,  -245,  -238,   -12,   360,  -818,    53,
+    -225,  -818,  -740,  -818,   -23,  -271,   330,   442,   301,  -433,
+    -517,   663,   652,   459,   948,   999,  -818,   684,   -53,   543
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,    13,    14,   400,   149,    15,    63,   247,   487,   701,
+     231,   232,   233,   234,   688,   894,   689,   895,   436,   437,
+     805,   438,   439,   235,   236,   237,   238,   817,   239,   884,
+     885,   886,   887,   888,   845,   846,   240,   130,   131,    16,
+      17,    18,    19,    55,    56,    57,    72,    73,    31,    32,
+     151,   152,   833,   834,   248,   249,   171,   133,   243,   695,
+     244,   134,   785,   135,   473,   474,   173,   174,   205,   206,
+     644,   136,   137,   138,   139,   251,   140,    60,    61,   208
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+     132,   199,   479,   510,   511,   478,   491,   207,   485,   806,
+     256,   519,     2,   172,   172,   172,   172,   172,    33,   836,
+     673,   201,    74,   512,   514,   515,   516,   517,     2,    22,
+      43,   818,   187,   189,   190,   191,   193,    42,    43,    43,
+     144,    43,    67,   932,   933,    33,   859,   144,   204,    -9,
+       1,   241,     2,     2,   145,   241,   401,     2,   141,     2,
+      -9,    -9,    -9,    -9,    -9,    -9,   262,   930,   404,   263,
+     147,   405,   269,   930,   446,   148,   637,   638,   639,   150,
+       9,     2,     2,   449,     2,   665,    74,   284,   286,   287,
+     288,   290,   292,   294,   296,     1,     9,     2,   302,   303,
+     253,   812,   813,   416,   259,   309,   311,   313,   314,   315,
+     316,   317,   319,   320,   321,   783,   323,   325,     2,   634,
+       9,     9,   918,   788,    10,     9,     2,     9,   794,     2,
+      -9,    75,    76,   432,   156,   397,   398,    11,   421,   407,
+     408,   409,   410,   411,   412,   413,   742,   199,   406,     9,
+       9,   157,     9,   207,   146,   451,   402,   837,   319,    11,
+      11,   252,   422,   423,   159,     9,    54,   403,   402,    10,
+     424,   402,   433,   434,   447,   455,   456,   489,   457,   943,
+     683,   160,   490,   450,   161,   450,     9,    12,   743,   388,
+     698,   444,   488,   389,     9,   258,   493,     9,   880,   881,
+     882,   682,   497,   417,    11,   461,   463,   464,   465,   466,
+     693,   194,   470,   394,   241,   961,   195,   395,   323,     2,
+     241,   922,   964,   801,   802,    76,   916,    12,   807,   484,
+     640,   154,   155,    70,   814,     2,   816,   816,   417,   197,
+     527,   241,   198,   702,   528,   452,   479,   241,   699,   245,
+     246,   246,   500,   501,   502,   503,   504,   696,   506,   507,
+     508,   509,   417,   417,   513,   513,   513,   513,   513,   518,
+     417,   520,    12,   521,   865,   142,   143,   522,   675,   523,
+     684,   524,   789,   525,   210,   526,   790,     9,   255,   725,
+     494,   684,   529,   530,   531,   532,    62,    11,   533,   435,
+     534,   959,   960,     9,   260,     2,   535,    71,   726,     2,
+     684,   734,   537,   684,   539,   541,   543,   544,   545,   547,
+     549,   550,   551,   552,   553,   555,   556,   557,   559,   561,
+     563,   565,   567,   569,   571,   573,   575,   577,   579,   581,
+     583,   585,   587,   589,   591,   593,   595,   597,   598,   599,
+     600,   601,   602,   603,   604,   605,   606,   607,   608,   611,
+     613,   615,   617,   619,   621,   623,   625,   627,   628,   629,
+     875,   876,   264,     9,   630,   265,   631,     9,     1,   635,
+       2,   270,   643,    11,   266,   381,    66,    11,     3,     4,
+       5,     6,     7,     8,   172,   451,   267,   666,   940,   941,
+     268,   199,   199,   199,   399,   271,   652,   653,   654,   390,
+     847,   848,   849,   391,   655,   392,   647,   393,    24,   272,
+       2,   827,   786,   242,   684,   273,   274,   242,   382,   383,
+     384,   662,   821,   663,   684,   204,   870,   385,   447,    25,
+      26,    27,   871,   275,   447,   390,   671,   672,     9,   391,
+     418,   392,    10,   393,   690,    28,    29,   873,    11,   447,
+     681,   386,   419,   897,   241,   828,   696,   298,   300,   301,
+     276,   277,   387,   257,   246,   431,   308,   710,   711,   179,
+     181,   183,   185,     2,   278,   279,   946,   322,     9,    78,
+      79,   949,    30,   720,   280,   177,   177,   177,   177,   177,
+     281,     2,    80,    81,    82,   958,   282,   816,   816,   304,
+     305,   196,    83,   453,   898,   736,   684,   906,   863,   907,
+     829,   830,   831,   965,   306,   307,   744,   712,   745,   454,
+     746,   714,   420,   467,   747,   908,   748,   907,   909,   910,
+     907,   907,   749,   919,   468,   684,   750,   962,   751,   684,
+     752,     9,   753,   477,   754,    12,   755,   481,   756,   482,
+     757,   486,   758,   488,   759,   492,   760,   496,   761,     9,
+     762,   632,   763,   645,   764,   649,   765,   650,   766,   656,
+     767,   657,   768,   658,   769,   659,   242,   661,   660,    43,
+     242,     2,   242,    75,    76,   804,   667,   771,   772,   226,
+     773,   691,   774,   899,   775,   697,   776,   713,   777,   700,
+     778,   730,   779,   242,   780,   228,   727,   791,   729,   242,
+     643,   177,   177,   177,   177,   177,   177,   177,   643,   731,
+     732,   793,   803,   643,   433,   434,   784,   795,   796,   809,
+     819,   820,   381,   824,   204,   204,   823,   825,   684,   204,
+     835,   828,   297,   743,   938,   790,   441,   872,   856,     9,
+     857,   822,   858,   815,   860,   861,   867,   874,   891,   892,
+     903,   956,     3,     4,     5,     6,     7,     8,   904,   911,
+     681,   912,   921,   915,   177,   382,   383,   384,   176,   176,
+     176,   176,   176,   926,   385,   319,   320,   321,   931,   175,
+     175,   175,   175,   175,   936,   942,   890,   851,   953,   513,
+     513,   513,   513,   916,   832,   954,   850,     2,   386,   476,
+     952,   498,   499,    78,    79,   950,    23,   396,   200,   387,
+     853,   854,    35,   177,   177,  -381,    80,    81,    82,   261,
+     158,   177,    11,   937,   826,   209,    83,   651,   664,   448,
+       0,     0,     0,    36,    37,    38,    39,    40,   855,     0,
+      41,    42,    43,     0,    44,    45,    46,    47,    48,    49,
+      50,     0,     0,     0,     0,     0,     0,     0,   864,   643,
+     866,   -13,    70,     0,     2,     9,     0,     0,     0,     0,
+       0,     0,   -13,   -13,   -13,   -13,   -13,   -13,     0,     0,
+     877,   878,   896,     0,     0,     0,    51,   889,   889,     0,
+       0,    52,     0,     0,   176,   176,   176,   176,   176,   176,
+     176,     0,   415,     0,     0,   175,   175,   175,   175,   175,
+     175,   175,   905,   414,     0,     0,   242,     0,     0,     0,
+       0,     0,   694,   900,   901,   902,     0,     0,     0,   177,
+       0,     0,     9,     0,     0,     0,    71,     0,     0,     0,
+     440,     0,   -13,     0,     0,     0,     0,   925,     0,   927,
+     928,     0,   889,     0,    53,     0,   177,   176,   889,   349,
+     350,   351,   352,   353,   354,   355,   297,     0,   175,     0,
+      54,     0,     0,     0,     0,   513,     0,     0,     0,     0,
+       0,   939,     0,   643,   643,     0,     0,     0,     0,   358,
+     359,     0,     0,   896,     0,     0,     0,   832,     0,     0,
+       0,   889,   951,     0,     0,     0,   176,   176,     0,     0,
+       0,   177,   957,     0,   176,     0,   177,   175,   175,     0,
+     177,     0,     0,     0,     0,   175,     0,     0,    20,     0,
+       0,    20,    34,    58,    64,    68,    34,     0,     0,     0,
+      35,     0,     2,     0,    20,     0,     0,     0,     0,     0,
+       0,    20,     0,    34,    34,    34,     0,     0,     0,    34,
+       0,    36,    37,    38,    39,    40,     0,     0,    41,    42,
+      43,     0,    44,    45,    46,    47,    48,    49,    50,    21,
+       0,     0,     0,    58,    59,    65,    69,    58,     0,     0,
+       0,     0,   250,   254,    21,    21,   250,   254,     0,     0,
+      34,     0,     0,     0,   153,   153,   153,     0,     0,     0,
+       9,     0,     0,     0,    51,     0,     0,     0,     0,    52,
+      11,     0,   176,     0,     0,     0,     0,     0,     0,     0,
+       0,   694,     0,   175,     0,   299,   299,   299,     0,     0,
+       0,     0,     0,     0,   299,     0,     0,     0,     0,   176,
+       0,     0,     0,     0,     0,   299,     0,     0,     0,     0,
+     175,   349,   350,   351,   352,   353,   354,   355,     0,     0,
+       0,     0,   -12,    24,    20,     2,     0,     0,     0,     0,
+       0,    34,    53,   -12,   -12,   -12,   -12,   -12,   -12,     0,
+       0,   358,   359,     0,    25,    26,    27,     0,    54,   441,
+       0,     0,     0,     0,   176,     0,     0,     0,     0,   176,
+      28,    29,     0,   176,     0,   175,     0,     0,     0,     0,
+     175,   378,   379,   177,   175,   442,     0,     0,     0,    58,
+       0,   177,     0,     0,     0,     0,     0,     0,   254,     0,
+       0,    58,    58,     9,    58,   462,     0,    30,     0,     0,
+       0,     0,     0,   -12,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   694,   177,
+       0,     0,     0,   483,   250,   -10,    35,     0,     2,   250,
+       0,     0,   250,   254,     0,   495,   -10,   -10,   -10,   -10,
+     -10,   -10,     0,     0,     0,     0,     0,    36,    37,    38,
+      39,    40,     0,     0,    41,    42,    43,     0,    44,    45,
+      46,    47,    48,    49,    50,     0,     0,   349,   350,   351,
+     352,   353,   354,   355,     0,     0,     0,     0,   177,     0,
+       0,     0,     0,     0,     0,     0,     0,   349,   350,   351,
+     352,   353,   354,   355,     0,     0,     9,   358,   359,     0,
+      51,     0,     0,     0,     0,    52,   -10,     0,   -11,    35,
+       0,     2,     0,     0,   177,     0,     0,   358,   359,   -11,
+     -11,   -11,   -11,   -11,   -11,     0,   377,   378,   379,     0,
+      36,    37,    38,    39,    40,     0,     0,    41,    42,    43,
+       0,    44,    45,    46,    47,    48,    49,    50,   379,     0,
+       0,     0,     0,   440,     0,     0,     0,     0,     0,     0,
+       0,   441,     0,     0,     0,     0,   176,     0,    53,     0,
+     636,   641,     0,     0,   176,     0,     0,   175,     0,     9,
+      34,     0,     0,    51,    54,   175,     0,     0,    52,   -11,
+     342,   343,   344,   345,   346,   347,   348,   349,   350,   351,
+     352,   353,   354,   355,     0,     0,     0,     0,     0,     0,
+       0,     0,   176,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   175,     0,   177,     0,   358,   359,     0,
+       0,   177,     0,    58,    58,    58,     0,     0,   361,   362,
+     363,   364,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    53,   373,   374,   375,   376,   377,   378,   379,     0,
+     299,     0,     0,     0,   250,     0,   250,    54,     0,     0,
+     254,   176,     0,     0,   254,     0,     0,     0,     0,     0,
+       0,     0,   175,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   737,   176,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   175,     0,
+       0,     0,   -34,   211,     0,     2,   212,    75,    76,     0,
+      77,    78,    79,   -34,   -34,   -34,   -34,   -34,   -34,   213,
+     214,     0,     0,   215,    80,    81,    82,     0,     0,     0,
+       0,     0,     0,     0,    83,   216,     0,     0,     0,     0,
+       0,     0,   217,     0,     0,   440,     0,     0,   218,   219,
+       0,     0,     0,     0,     0,    85,    86,    87,    88,    89,
+      90,    91,    92,    93,    94,    95,   220,   221,     0,   222,
+     223,    96,   224,     9,   225,   226,     0,   227,     0,     0,
+      97,    98,     0,   -34,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   176,     0,
+       0,     0,     0,     0,   176,     0,     0,     0,     0,   175,
+       0,     0,     0,     0,     0,   175,     0,     0,   442,    99,
+     100,   101,   102,   103,   104,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,   228,     0,     0,
+     117,   118,   119,   120,   121,   229,     0,     0,     0,   299,
+     122,     0,     0,     0,     0,    35,     0,     2,    34,     0,
+     123,     0,     0,   124,   125,     0,     0,     0,     0,     0,
+     126,   127,     0,   668,   230,     0,    36,    37,    38,    39,
+      40,   129,     0,    41,    42,    43,     0,    44,    45,    46,
+      47,    48,    49,    50,   328,     0,   330,   331,   332,   333,
+     334,   335,   336,   337,   338,   339,   340,   341,   342,   343,
+     344,   345,   346,   347,   348,   349,   350,   351,   352,   353,
+     354,   355,   356,   357,     0,     9,     0,     0,     0,    51,
+       0,     0,     0,     0,    52,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   358,   359,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   361,   362,   363,   364,
+     365,   366,   367,   368,   369,   370,     0,     0,   371,   372,
+     373,   374,   375,   376,   377,   378,   379,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   299,    34,    34,    34,
+       0,     0,     0,     0,     0,     0,     0,    53,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   -36,   211,    54,     2,     0,    75,    76,   917,    77,
+      78,    79,   -36,   -36,   -36,   -36,   -36,   -36,   213,   214,
+     442,     0,   215,    80,    81,    82,     0,     0,     0,     0,
+       0,     0,     0,    83,   216,     0,     0,     0,     0,     0,
+       0,   217,     0,     0,     0,     0,     0,   218,   219,     0,
+       0,    34,     0,     0,    85,    86,    87,    88,    89,    90,
+      91,    92,    93,    94,    95,   220,   221,     0,   222,   223,
+      96,   224,     9,   225,   226,     0,   227,     0,     0,    97,
+      98,     0,   -36,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    99,   100,
+     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,   115,   116,   228,     0,     0,   117,
+     118,   119,   120,   121,   229,     0,     0,     0,     0,   122,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   123,
+       0,     0,   124,   125,     0,     0,     0,     0,     0,   126,
+     127,     0,     0,   230,   211,     0,     2,     0,    75,    76,
+     129,    77,    78,    79,     0,     0,     0,     0,     0,     0,
+     213,   214,     0,     0,   215,    80,    81,    82,     0,     0,
+       0,     0,     0,     0,     0,    83,   216,     0,     0,     0,
+       0,     0,     0,   217,     0,     0,     0,     0,     0,   218,
+     219,     0,     0,     0,     0,     0,    85,    86,    87,    88,
+      89,    90,    91,    92,    93,    94,    95,   220,   221,     0,
+     222,   223,    96,   224,     9,   225,   226,   475,   227,     0,
+       0,    97,    98,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
+     109,   110,   111,   112,   113,   114,   115,   116,   228,     0,
+       0,   117,   118,   119,   120,   121,   229,     0,     0,     0,
+       0,   122,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   123,     0,     0,   124,   125,     0,     0,     0,     0,
+       0,   126,   127,     0,     0,   230,   211,     0,     2,     0,
+      75,    76,   129,    77,    78,    79,     0,     0,     0,     0,
+       0,     0,   213,   214,     0,     0,   215,    80,    81,    82,
+       0,     0,     0,     0,     0,     0,     0,    83,   216,     0,
+       0,     0,     0,     0,     0,   217,     0,     0,     0,     0,
+       0,   218,   219,     0,     0,     0,     0,     0,    85,    86,
+      87,    88,    89,    90,    91,    92,    93,    94,    95,   220,
+     221,     0,   222,   223,    96,   224,     9,   225,   226,   685,
+     227,     0,     0,    97,    98,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    99,   100,   101,   102,   103,   104,   105,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,   115,   116,
+     228,     0,     0,   117,   118,   119,   120,   121,   229,     0,
+       0,     0,     0,   122,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   123,     0,     0,   124,   125,     0,     0,
+       0,     0,     0,   126,   127,     0,     2,   230,    75,    76,
+       0,    77,    78,    79,   129,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   162,   163,   164,   165,   166,
+     167,   168,     0,     0,     0,    83,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    84,
+       0,     0,     0,     0,     0,     0,    85,    86,    87,    88,
+      89,    90,    91,    92,    93,    94,    95,     0,     0,     0,
+       0,     0,    96,     0,     9,     0,     0,     0,   169,     0,
+       0,    97,    98,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
+     109,   110,   111,   112,   113,   114,   115,   116,     0,     0,
+       0,   117,   118,   119,   120,   121,     0,     0,     0,     0,
+       0,   122,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   123,     0,     0,   170,   125,     0,     0,     0,     0,
+       0,   126,   127,     0,     2,   128,    75,    76,     0,    77,
+      78,    79,   129,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   162,   163,   164,   165,   166,   167,   168,
+       0,     0,     0,    83,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    84,     0,     0,
+       0,     0,     0,     0,    85,    86,    87,    88,    89,    90,
+      91,    92,    93,    94,    95,     0,     0,     0,     0,     0,
+      96,     0,     9,     0,     0,     0,   178,     0,     0,    97,
+      98,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    99,   100,
+     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,   115,   116,     0,     0,     0,   117,
+     118,   119,   120,   121,     0,     0,     0,     0,     0,   122,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   123,
+       0,     0,   170,   125,     0,     0,     0,     0,     0,   126,
+     127,     0,     2,   128,    75,    76,     0,    77,    78,    79,
+     129,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   162,   163,   164,   165,   166,   167,   168,     0,     0,
+       0,    83,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    84,     0,     0,     0,     0,
+       0,     0,    85,    86,    87,    88,    89,    90,    91,    92,
+      93,    94,    95,     0,     0,     0,     0,     0,    96,     0,
+       9,     0,     0,     0,   180,     0,     0,    97,    98,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    99,   100,   101,   102,
+     103,   104,   105,   106,   107,   108,   109,   110,   111,   112,
+     113,   114,   115,   116,     0,     0,     0,   117,   118,   119,
+     120,   121,     0,     0,     0,     0,     0,   122,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   123,     0,     0,
+     170,   125,     0,     0,     0,     0,     0,   126,   127,     0,
+       2,   128,    75,    76,     0,    77,    78,    79,   129,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   162,
+     163,   164,   165,   166,   167,   168,     0,     0,     0,    83,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    84,     0,     0,     0,     0,     0,     0,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,     0,     0,     0,     0,     0,    96,     0,     9,     0,
+       0,     0,   182,     0,     0,    97,    98,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,     0,     0,     0,   117,   118,   119,   120,   121,
+       0,     0,     0,     0,     0,   122,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   123,     0,     0,   170,   125,
+       0,     0,     0,     0,     0,   126,   127,     0,     2,   128,
+      75,    76,     0,    77,    78,    79,   129,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   162,   163,   164,
+     165,   166,   167,   168,     0,     0,     0,    83,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    84,     0,     0,     0,     0,     0,     0,    85,    86,
+      87,    88,    89,    90,    91,    92,    93,    94,    95,     0,
+       0,     0,     0,     0,    96,     0,     9,     0,     0,     0,
+     184,     0,     0,    97,    98,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    99,   100,   101,   102,   103,   104,   105,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,   115,   116,
+       0,     0,     0,   117,   118,   119,   120,   121,     0,     0,
+       0,     0,     0,   122,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   123,     0,     0,   170,   125,     0,     0,
+       0,     0,     0,   126,   127,     0,     2,   128,    75,    76,
+       0,    77,    78,    79,   129,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   162,   163,   164,   165,   166,
+     167,   168,     0,     0,     0,    83,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    84,
+       0,     0,     0,     0,     0,     0,    85,    86,    87,    88,
+      89,    90,    91,    92,    93,    94,    95,     0,     0,     0,
+       0,     0,    96,     0,     9,     0,     0,     0,    35,     0,
+       2,    97,    98,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   669,     0,     0,    36,
+      37,    38,    39,    40,     0,     0,    41,    42,    43,     0,
+      44,    45,    46,    47,    48,    49,    50,     0,     0,     0,
+      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
+     109,   110,   111,   112,   113,   114,   115,   116,     0,     0,
+       0,   117,   118,   119,   120,   121,     0,     0,     9,     0,
+       0,   122,    51,     0,     0,     0,     0,    52,     0,     0,
+       0,   123,     0,     0,   170,   125,     0,     0,     0,     0,
+       0,   126,   127,     0,     2,   128,    75,    76,     0,    77,
+      78,    79,   129,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    80,    81,    82,     0,     0,     0,     0,
+       0,     0,    43,    83,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    84,     0,     0,
+      53,     0,     0,     0,    85,    86,    87,    88,    89,    90,
+      91,    92,    93,    94,    95,     0,    54,     0,     0,     0,
+      96,     0,     9,     0,     0,     0,   202,     0,     0,    97,
+      98,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    99,   100,
+     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,   115,   116,     0,     0,     0,   117,
+     118,   119,   120,   121,     0,     2,     0,    75,    76,   122,
+      77,    78,    79,     0,     0,     0,     0,     0,     0,   123,
+       0,     0,   124,   125,    80,    81,    82,     0,     0,   126,
+     127,     0,     0,   128,    83,     0,     0,     0,     0,   203,
+     129,     0,     0,     0,     0,     0,   458,   459,    84,     0,
+       0,     0,     0,     0,     0,    85,    86,    87,    88,    89,
+      90,    91,    92,    93,    94,    95,     0,     0,     0,     0,
+       0,    96,     0,     9,     0,     0,     0,   460,     0,     0,
+      97,    98,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    99,
+     100,   101,   102,   103,   104,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,     0,     0,     0,
+     117,   118,   119,   120,   121,     0,     2,     0,    75,    76,
+     122,    77,    78,    79,     0,     0,     0,     0,     0,     0,
+     123,     0,     0,   124,   125,    80,    81,    82,     0,     0,
+     126,   127,     0,     0,   128,    83,     0,     0,     0,     0,
+       0,   129,     0,     0,     0,     0,     0,     0,     0,    84,
+       0,     0,     0,     0,     0,     0,    85,    86,    87,    88,
+      89,    90,    91,    92,    93,    94,    95,     0,     0,     0,
+       0,     0,    96,     0,     9,     0,     0,     0,     0,     0,
+       0,    97,    98,     0,     0,     0,     0,     0,     0,     0,
+       0,   609,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
+     109,   110,   111,   112,   113,   114,   115,   116,     0,     0,
+       0,   117,   118,   119,   120,   121,     0,     0,     0,     0,
+       0,   122,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   123,     0,     0,   124,   125,     0,     0,     0,     0,
+       0,   126,   127,     0,   610,   128,     0,     0,     0,     0,
+       0,     2,   129,    75,    76,   686,    77,    78,    79,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      80,    81,    82,     0,     0,     0,     0,     0,     0,     0,
+      83,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    84,     0,     0,     0,     0,     0,
+       0,    85,    86,    87,    88,    89,    90,    91,    92,    93,
+      94,    95,     0,     0,     0,     0,     0,    96,     0,     9,
+       0,     0,     0,     0,     0,     0,    97,    98,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    99,   100,   101,   102,   103,
+     104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,     0,     0,     0,   117,   118,   119,   120,
+     121,     0,     0,     0,     0,     0,   122,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   123,     0,     0,   170,
+     125,     0,     0,     0,     0,     0,   126,   127,     0,     0,
+     128,   687,     0,     2,     0,    75,    76,   129,    77,    78,
+      79,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    80,    81,    82,     0,     0,     0,     0,     0,
+       0,     0,    83,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    84,     0,     0,     0,
+       0,     0,     0,    85,    86,    87,    88,    89,    90,    91,
+      92,    93,    94,    95,     0,     0,   883,     0,     0,    96,
+       0,     9,     0,     0,   929,     0,     0,     0,    97,    98,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    99,   100,   101,
+     102,   103,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,     0,     0,     0,   117,   118,
+     119,   120,   121,     0,     2,     0,    75,    76,   122,    77,
+      78,    79,     0,     0,     0,     0,     0,     0,   123,     0,
+       0,   124,   125,    80,    81,    82,     0,     0,   126,   127,
+       0,     0,   128,    83,     0,     0,     0,     0,     0,   129,
+       0,     0,     0,     0,     0,     0,     0,    84,     0,     0,
+       0,     0,     0,     0,    85,    86,    87,    88,    89,    90,
+      91,    92,    93,    94,    95,     0,     0,   883,     0,     0,
+      96,     0,     9,     0,     0,   935,     0,     0,     0,    97,
+      98,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    99,   100,
+     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,   115,   116,     0,     0,     0,   117,
+     118,   119,   120,   121,     0,     2,     0,    75,    76,   122,
+      77,    78,    79,     0,     0,     0,     0,     0,     0,   123,
+       0,     0,   124,   125,    80,    81,    82,     0,     0,   126,
+     127,     0,     0,   128,    83,     0,     0,     0,     0,     0,
+     129,     0,     0,     0,     0,     0,     0,     0,    84,     0,
+       0,     0,     0,     0,     0,    85,    86,    87,    88,    89,
+      90,    91,    92,    93,    94,    95,     0,     0,     0,     0,
+       0,    96,     0,     9,     0,     0,     0,   186,     0,     0,
+      97,    98,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    99,
+     100,   101,   102,   103,   104,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,     0,     0,     0,
+     117,   118,   119,   120,   121,     0,     2,     0,    75,    76,
+     122,    77,    78,    79,     0,     0,     0,     0,     0,     0,
+     123,     0,     0,   124,   125,    80,    81,    82,     0,     0,
+     126,   127,     0,     0,   128,    83,     0,     0,     0,     0,
+       0,   129,     0,     0,     0,     0,     0,     0,     0,    84,
+       0,     0,     0,     0,     0,     0,    85,    86,    87,    88,
+      89,    90,    91,    92,    93,    94,    95,     0,     0,     0,
+       0,     0,    96,     0,     9,     0,     0,     0,   188,     0,
+       0,    97,    98,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
+     109,   110,   111,   112,   113,   114,   115,   116,     0,     0,
+       0,   117,   118,   119,   120,   121,     0,     2,     0,    75,
+      76,   122,    77,    78,    79,     0,     0,     0,     0,     0,
+       0,   123,     0,     0,   124,   125,    80,    81,    82,     0,
+       0,   126,   127,     0,     0,   128,    83,     0,     0,     0,
+       0,     0,   129,     0,     0,     0,     0,     0,     0,     0,
+      84,     0,     0,     0,     0,     0,     0,    85,    86,    87,
+      88,    89,    90,    91,    92,    93,    94,    95,     0,     0,
+       0,     0,     0,    96,     0,     9,     0,     0,     0,   192,
+       0,     0,    97,    98,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    99,   100,   101,   102,   103,   104,   105,   106,   107,
+     108,   109,   110,   111,   112,   113,   114,   115,   116,     0,
+       0,     0,   117,   118,   119,   120,   121,     0,     2,     0,
+      75,    76,   122,    77,    78,    79,     0,     0,     0,     0,
+       0,     0,   123,     0,     0,   124,   125,    80,    81,    82,
+       0,     0,   126,   127,     0,     0,   128,    83,     0,     0,
+       0,     0,     0,   129,     0,     0,     0,     0,     0,     0,
+       0,    84,     0,     0,     0,     0,     0,     0,    85,    86,
+      87,    88,    89,    90,    91,    92,    93,    94,    95,     0,
+       0,     0,     0,     0,    96,     0,     9,     0,     0,     0,
+       0,     0,     0,    97,    98,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    99,   100,   101,   102,   103,   104,   105,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,   115,   116,
+       0,     0,     0,   117,   118,   119,   120,   121,     0,     2,
+       0,    75,    76,   122,    77,    78,    79,     0,     0,     0,
+       0,     0,     0,   123,     0,     0,   124,   125,    80,    81,
+      82,     0,     0,   126,   127,     0,   283,   128,    83,     0,
+       0,     0,     0,     0,   129,     0,     0,     0,     0,     0,
+       0,     0,    84,     0,     0,     0,     0,     0,     0,    85,
+      86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
+       0,     0,     0,     0,     0,    96,     0,     9,     0,     0,
+       0,     0,     0,     0,    97,    98,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    99,   100,   101,   102,   103,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,   115,
+     116,     0,     0,     0,   117,   118,   119,   120,   121,     0,
+       2,     0,    75,    76,   122,    77,    78,    79,     0,     0,
+       0,     0,     0,     0,   123,     0,     0,   124,   125,    80,
+      81,    82,     0,     0,   126,   127,     0,   285,   128,    83,
+       0,     0,     0,     0,     0,   129,     0,     0,     0,     0,
+       0,     0,     0,    84,     0,     0,     0,     0,     0,     0,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,     0,     0,     0,     0,     0,    96,     0,     9,     0,
+       0,     0,     0,     0,     0,    97,    98,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,     0,     0,     0,   117,   118,   119,   120,   121,
+       0,     2,     0,    75,    76,   122,    77,    78,    79,     0,
+       0,     0,     0,     0,     0,   123,     0,     0,   124,   125,
+      80,    81,    82,     0,     0,   126,   127,     0,   289,   128,
+      83,     0,     0,     0,     0,     0,   129,     0,     0,     0,
+       0,     0,     0,     0,    84,     0,     0,     0,     0,     0,
+       0,    85,    86,    87,    88,    89,    90,    91,    92,    93,
+      94,    95,     0,     0,     0,     0,     0,    96,     0,     9,
+       0,     0,     0,     0,     0,     0,    97,    98,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    99,   100,   101,   102,   103,
+     104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,     0,     0,     0,   117,   118,   119,   120,
+     121,     0,     2,     0,    75,    76,   122,    77,    78,    79,
+       0,     0,     0,     0,     0,     0,   123,     0,     0,   124,
+     125,    80,    81,    82,     0,     0,   126,   127,     0,   291,
+     128,    83,     0,     0,     0,     0,     0,   129,     0,     0,
+       0,     0,     0,     0,     0,    84,     0,     0,     0,     0,
+       0,     0,    85,    86,    87,    88,    89,    90,    91,    92,
+      93,    94,    95,     0,     0,     0,     0,     0,    96,     0,
+       9,     0,     0,     0,     0,     0,     0,    97,    98,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    99,   100,   101,   102,
+     103,   104,   105,   106,   107,   108,   109,   110,   111,   112,
+     113,   114,   115,   116,     0,     0,     0,   117,   118,   119,
+     120,   121,     0,     2,     0,    75,    76,   122,    77,    78,
+      79,     0,     0,     0,     0,     0,     0,   123,     0,     0,
+     124,   125,    80,    81,    82,     0,     0,   126,   127,     0,
+     293,   128,    83,     0,     0,     0,     0,     0,   129,     0,
+       0,     0,     0,     0,     0,     0,    84,     0,     0,     0,
+       0,     0,     0,    85,    86,    87,    88,    89,    90,    91,
+      92,    93,    94,    95,     0,     0,     0,     0,     0,    96,
+       0,     9,     0,     0,     0,     0,     0,     0,    97,    98,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    99,   100,   101,
+     102,   103,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,     0,     0,     0,   117,   118,
+     119,   120,   121,     0,     2,     0,    75,    76,   122,    77,
+      78,    79,     0,     0,     0,     0,     0,     0,   123,     0,
+       0,   124,   125,    80,    81,    82,     0,     0,   126,   127,
+       0,   295,   128,    83,     0,     0,     0,     0,     0,   129,
+       0,     0,     0,     0,     0,     0,     0,    84,     0,     0,
+       0,     0,     0,     0,    85,    86,    87,    88,    89,    90,
+      91,    92,    93,    94,    95,     0,     0,     0,     0,     0,
+      96,     0,     9,     0,     0,     0,     0,     0,     0,    97,
+      98,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    99,   100,
+     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,   115,   116,     0,     0,     0,   117,
+     118,   119,   120,   121,     0,     2,     0,    75,    76,   122,
+      77,    78,    79,     0,     0,     0,     0,     0,     0,   123,
+       0,     0,   124,   125,    80,    81,    82,     0,     0,   126,
+     127,     0,   310,   128,    83,     0,     0,     0,     0,     0,
+     129,     0,     0,     0,     0,     0,     0,     0,    84,     0,
+       0,     0,     0,     0,     0,    85,    86,    87,    88,    89,
+      90,    91,    92,    93,    94,    95,     0,     0,     0,     0,
+       0,    96,     0,     9,     0,     0,     0,     0,     0,     0,
+      97,    98,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    99,
+     100,   101,   102,   103,   104,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,     0,     0,     0,
+     117,   118,   119,   120,   121,     0,     2,     0,    75,    76,
+     122,    77,    78,    79,     0,     0,     0,     0,     0,     0,
+     123,     0,     0,   124,   125,    80,    81,    82,     0,     0,
+     126,   127,     0,   312,   128,    83,     0,     0,     0,     0,
+       0,   129,     0,     0,     0,     0,     0,     0,     0,    84,
+       0,     0,     0,     0,     0,     0,    85,    86,    87,    88,
+      89,    90,    91,    92,    93,    94,    95,     0,     0,     0,
+       0,     0,    96,     0,     9,     0,     0,     0,     0,     0,
+       0,    97,    98,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
+     109,   110,   111,   112,   113,   114,   115,   116,     0,     0,
+       0,   117,   118,   119,   120,   121,     0,     2,     0,    75,
+      76,   122,    77,    78,    79,     0,     0,     0,     0,     0,
+       0,   123,     0,     0,   124,   125,    80,    81,    82,     0,
+       0,   126,   127,     0,   318,   128,    83,     0,     0,     0,
+       0,     0,   129,     0,     0,     0,     0,     0,     0,     0,
+      84,     0,     0,     0,     0,     0,     0,    85,    86,    87,
+      88,    89,    90,    91,    92,    93,    94,    95,     0,     0,
+       0,     0,     0,    96,     0,     9,     0,     0,     0,     0,
+       0,     0,    97,    98,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    99,   100,   101,   102,   103,   104,   105,   106,   107,
+     108,   109,   110,   111,   112,   113,   114,   115,   116,     0,
+       0,     0,   117,   118,   119,   120,   121,     0,     2,     0,
+      75,    76,   122,    77,    78,    79,     0,     0,     0,     0,
+       0,     0,   123,     0,     0,   124,   125,    80,    81,    82,
+       0,     0,   126,   127,     0,   324,   128,    83,     0,     0,
+       0,     0,     0,   129,     0,     0,     0,     0,     0,     0,
+       0,    84,     0,     0,     0,     0,     0,     0,    85,    86,
+      87,    88,    89,    90,    91,    92,    93,    94,    95,     0,
+       0,     0,     0,     0,    96,     0,     9,     0,     0,     0,
+       0,     0,     0,    97,    98,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    99,   100,   101,   102,   103,   104,   105,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,   115,   116,
+       0,     0,     0,   117,   118,   119,   120,   121,     0,     2,
+       0,    75,    76,   122,    77,    78,    79,     0,     0,     0,
+       0,     0,     0,   123,     0,     0,   170,   125,    80,    81,
+      82,     0,     0,   126,   127,     0,     0,   128,    83,     0,
+       0,   266,     0,     0,   129,     0,     0,     0,     0,     0,
+       0,     0,    84,     0,     0,     0,     0,     0,     0,    85,
+      86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
+       0,     0,     0,     0,     0,    96,     0,     9,     0,     0,
+       0,     0,     0,     0,    97,    98,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    99,   100,   101,   102,   103,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,   115,
+     116,     0,     0,     0,   117,   118,   119,   120,   121,     0,
+       2,     0,    75,    76,   122,    77,    78,    79,     0,     0,
+       0,     0,     0,     0,   123,     0,     0,   170,   125,    80,
+      81,    82,     0,     0,   126,   127,     0,     0,   128,    83,
+       0,     0,   267,     0,     0,   129,     0,     0,     0,     0,
+       0,     0,     0,    84,     0,     0,     0,     0,     0,     0,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,     0,     0,     0,     0,     0,    96,     0,     9,     0,
+       0,     0,     0,     0,     0,    97,    98,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,     0,     0,     0,   117,   118,   119,   120,   121,
+       0,     2,     0,    75,    76,   122,    77,    78,    79,     0,
+       0,     0,     0,     0,     0,   123,     0,     0,   170,   125,
+      80,    81,    82,     0,     0,   126,   127,     0,     0,   128,
+      83,     0,     0,   268,     0,     0,   129,     0,     0,     0,
+       0,     0,     0,     0,    84,     0,     0,     0,     0,     0,
+       0,    85,    86,    87,    88,    89,    90,    91,    92,    93,
+      94,    95,     0,     0,     0,     0,     0,    96,     0,     9,
+       0,     0,     0,     0,     0,     0,    97,    98,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    99,   100,   101,   102,   103,
+     104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,     0,     0,     0,   117,   118,   119,   120,
+     121,     0,     2,     0,    75,    76,   122,    77,    78,    79,
+       0,     0,     0,     0,     0,     0,   123,     0,     0,   124,
+     125,    80,    81,    82,     0,     0,   126,   127,     0,     0,
+     128,    83,     0,     0,     0,     0,   443,   129,     0,     0,
+       0,     0,     0,     0,     0,    84,     0,     0,     0,     0,
+       0,     0,    85,    86,    87,    88,    89,    90,    91,    92,
+      93,    94,    95,     0,     0,     0,     0,     0,    96,     0,
+       9,     0,     0,     0,   469,     0,     0,    97,    98,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    99,   100,   101,   102,
+     103,   104,   105,   106,   107,   108,   109,   110,   111,   112,
+     113,   114,   115,   116,     0,     0,     0,   117,   118,   119,
+     120,   121,     0,     2,     0,    75,    76,   122,    77,    78,
+      79,     0,     0,     0,     0,     0,     0,   123,     0,     0,
+     124,   125,    80,    81,    82,     0,     0,   126,   127,     0,
+       0,   128,    83,     0,     0,     0,     0,     0,   129,     0,
+       0,     0,     0,     0,     0,     0,    84,     0,     0,     0,
+       0,     0,     0,    85,    86,    87,    88,    89,    90,    91,
+      92,    93,    94,    95,     0,     0,     0,     0,     0,    96,
+       0,     9,     0,     0,     0,   471,     0,     0,    97,    98,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    99,   100,   101,
+     102,   103,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,     0,     0,     0,   117,   118,
+     119,   120,   121,     0,     2,     0,    75,    76,   122,    77,
+      78,    79,     0,     0,     0,     0,     0,     0,   123,     0,
+       0,   170,   125,    80,    81,    82,     0,     0,   126,   127,
+       0,     0,   472,    83,     0,     0,     0,     0,     0,   129,
+       0,     0,     0,     0,     0,     0,     0,    84,     0,     0,
+       0,     0,     0,     0,    85,    86,    87,    88,    89,    90,
+      91,    92,    93,    94,    95,     0,     0,     0,     0,     0,
+      96,     0,     9,     0,     0,     0,     0,     0,     0,    97,
+      98,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    99,   100,
+     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,   115,   116,   228,     0,     0,   117,
+     118,   119,   120,   121,     0,     2,     0,    75,    76,   122,
+      77,    78,    79,     0,     0,     0,     0,     0,     0,   123,
+       0,     0,   124,   125,    80,    81,    82,     0,     0,   126,
+     127,     0,     0,   128,    83,     0,     0,     0,     0,     0,
+     129,     0,     0,     0,     0,     0,     0,     0,    84,     0,
+       0,     0,     0,     0,     0,    85,    86,    87,    88,    89,
+      90,    91,    92,    93,    94,    95,     0,     0,     0,     0,
+       0,    96,     0,     9,     0,     0,     0,     0,     0,     0,
+      97,    98,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    99,
+     100,   101,   102,   103,   104,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,     0,     0,     0,
+     117,   118,   119,   120,   121,     0,     2,     0,    75,    76,
+     122,    77,    78,    79,     0,     0,     0,     0,     0,     0,
+     123,     0,     0,   124,   125,    80,    81,    82,     0,     0,
+     126,   127,     0,   538,   128,    83,     0,     0,     0,     0,
+       0,   129,     0,     0,     0,     0,     0,     0,     0,    84,
+       0,     0,     0,     0,     0,     0,    85,    86,    87,    88,
+      89,    90,    91,    92,    93,    94,    95,     0,     0,     0,
+       0,     0,    96,     0,     9,     0,     0,     0,     0,     0,
+       0,    97,    98,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
+     109,   110,   111,   112,   113,   114,   115,   116,     0,     0,
+       0,   117,   118,   119,   120,   121,     0,     2,     0,    75,
+      76,   122,    77,    78,    79,     0,     0,     0,     0,     0,
+       0,   123,     0,     0,   124,   125,    80,    81,    82,     0,
+       0,   126,   127,     0,   540,   128,    83,     0,     0,     0,
+       0,     0,   129,     0,     0,     0,     0,     0,     0,     0,
+      84,     0,     0,     0,     0,     0,     0,    85,    86,    87,
+      88,    89,    90,    91,    92,    93,    94,    95,     0,     0,
+       0,     0,     0,    96,     0,     9,     0,     0,     0,     0,
+       0,     0,    97,    98,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    99,   100,   101,   102,   103,   104,   105,   106,   107,
+     108,   109,   110,   111,   112,   113,   114,   115,   116,     0,
+       0,     0,   117,   118,   119,   120,   121,     0,     2,     0,
+      75,    76,   122,    77,    78,    79,     0,     0,     0,     0,
+       0,     0,   123,     0,     0,   124,   125,    80,    81,    82,
+       0,     0,   126,   127,     0,   542,   128,    83,     0,     0,
+       0,     0,     0,   129,     0,     0,     0,     0,     0,     0,
+       0,    84,     0,     0,     0,     0,     0,     0,    85,    86,
+      87,    88,    89,    90,    91,    92,    93,    94,    95,     0,
+       0,     0,     0,     0,    96,     0,     9,     0,     0,     0,
+       0,     0,     0,    97,    98,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    99,   100,   101,   102,   103,   104,   105,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,   115,   116,
+       0,     0,     0,   117,   118,   119,   120,   121,     0,     2,
+       0,    75,    76,   122,    77,    78,    79,     0,     0,     0,
+       0,     0,     0,   123,     0,     0,   124,   125,    80,    81,
+      82,     0,     0,   126,   127,     0,   546,   128,    83,     0,
+       0,     0,     0,     0,   129,     0,     0,     0,     0,     0,
+       0,     0,    84,     0,     0,     0,     0,     0,     0,    85,
+      86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
+       0,     0,     0,     0,     0,    96,     0,     9,     0,     0,
+       0,     0,     0,     0,    97,    98,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    99,   100,   101,   102,   103,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,   115,
+     116,     0,     0,     0,   117,   118,   119,   120,   121,     0,
+       2,     0,    75,    76,   122,    77,    78,    79,     0,     0,
+       0,     0,     0,     0,   123,     0,     0,   124,   125,    80,
+      81,    82,     0,     0,   126,   127,     0,   548,   128,    83,
+       0,     0,     0,     0,     0,   129,     0,     0,     0,     0,
+       0,     0,     0,    84,     0,     0,     0,     0,     0,     0,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,     0,     0,     0,     0,     0,    96,     0,     9,     0,
+       0,     0,     0,     0,     0,    97,    98,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,     0,     0,     0,   117,   118,   119,   120,   121,
+       0,     2,     0,    75,    76,   122,    77,    78,    79,     0,
+       0,     0,     0,     0,     0,   123,     0,     0,   124,   125,
+      80,    81,    82,     0,     0,   126,   127,     0,   554,   128,
+      83,     0,     0,     0,     0,     0,   129,     0,     0,     0,
+       0,     0,     0,     0,    84,     0,     0,     0,     0,     0,
+       0,    85,    86,    87,    88,    89,    90,    91,    92,    93,
+      94,    95,     0,     0,     0,     0,     0,    96,     0,     9,
+       0,     0,     0,     0,     0,     0,    97,    98,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    99,   100,   101,   102,   103,
+     104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,     0,     0,     0,   117,   118,   119,   120,
+     121,     0,     2,     0,    75,    76,   122,    77,    78,    79,
+       0,     0,     0,     0,     0,     0,   123,     0,     0,   124,
+     125,    80,    81,    82,     0,     0,   126,   127,     0,   558,
+     128,    83,     0,     0,     0,     0,     0,   129,     0,     0,
+       0,     0,     0,     0,     0,    84,     0,     0,     0,     0,
+       0,     0,    85,    86,    87,    88,    89,    90,    91,    92,
+      93,    94,    95,     0,     0,     0,     0,     0,    96,     0,
+       9,     0,     0,     0,     0,     0,     0,    97,    98,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    99,   100,   101,   102,
+     103,   104,   105,   106,   107,   108,   109,   110,   111,   112,
+     113,   114,   115,   116,     0,     0,     0,   117,   118,   119,
+     120,   121,     0,     2,     0,    75,    76,   122,    77,    78,
+      79,     0,     0,     0,     0,     0,     0,   123,     0,     0,
+     124,   125,    80,    81,    82,     0,     0,   126,   127,     0,
+     560,   128,    83,     0,     0,     0,     0,     0,   129,     0,
+       0,     0,     0,     0,     0,     0,    84,     0,     0,     0,
+       0,     0,     0,    85,    86,    87,    88,    89,    90,    91,
+      92,    93,    94,    95,     0,     0,     0,     0,     0,    96,
+       0,     9,     0,     0,     0,     0,     0,     0,    97,    98,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    99,   100,   101,
+     102,   103,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,     0,     0,     0,   117,   118,
+     119,   120,   121,     0,     2,     0,    75,    76,   122,    77,
+      78,    79,     0,     0,     0,     0,     0,     0,   123,     0,
+       0,   124,   125,    80,    81,    82,     0,     0,   126,   127,
+       0,   562,   128,    83,     0,     0,     0,     0,     0,   129,
+       0,     0,     0,     0,     0,     0,     0,    84,     0,     0,
+       0,     0,     0,     0,    85,    86,    87,    88,    89,    90,
+      91,    92,    93,    94,    95,     0,     0,     0,     0,     0,
+      96,     0,     9,     0,     0,     0,     0,     0,     0,    97,
+      98,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    99,   100,
+     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,   115,   116,     0,     0,     0,   117,
+     118,   119,   120,   121,     0,     2,     0,    75,    76,   122,
+      77,    78,    79,     0,     0,     0,     0,     0,     0,   123,
+       0,     0,   124,   125,    80,    81,    82,     0,     0,   126,
+     127,     0,   564,   128,    83,     0,     0,     0,     0,     0,
+     129,     0,     0,     0,     0,     0,     0,     0,    84,     0,
+       0,     0,     0,     0,     0,    85,    86,    87,    88,    89,
+      90,    91,    92,    93,    94,    95,     0,     0,     0,     0,
+       0,    96,     0,     9,     0,     0,     0,     0,     0,     0,
+      97,    98,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    99,
+     100,   101,   102,   103,   104,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,     0,     0,     0,
+     117,   118,   119,   120,   121,     0,     2,     0,    75,    76,
+     122,    77,    78,    79,     0,     0,     0,     0,     0,     0,
+     123,     0,     0,   124,   125,    80,    81,    82,     0,     0,
+     126,   127,     0,   566,   128,    83,     0,     0,     0,     0,
+       0,   129,     0,     0,     0,     0,     0,     0,     0,    84,
+       0,     0,     0,     0,     0,     0,    85,    86,    87,    88,
+      89,    90,    91,    92,    93,    94,    95,     0,     0,     0,
+       0,     0,    96,     0,     9,     0,     0,     0,     0,     0,
+       0,    97,    98,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
+     109,   110,   111,   112,   113,   114,   115,   116,     0,     0,
+       0,   117,   118,   119,   120,   121,     0,     2,     0,    75,
+      76,   122,    77,    78,    79,     0,     0,     0,     0,     0,
+       0,   123,     0,     0,   124,   125,    80,    81,    82,     0,
+       0,   126,   127,     0,   568,   128,    83,     0,     0,     0,
+       0,     0,   129,     0,     0,     0,     0,     0,     0,     0,
+      84,     0,     0,     0,     0,     0,     0,    85,    86,    87,
+      88,    89,    90,    91,    92,    93,    94,    95,     0,     0,
+       0,     0,     0,    96,     0,     9,     0,     0,     0,     0,
+       0,     0,    97,    98,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    99,   100,   101,   102,   103,   104,   105,   106,   107,
+     108,   109,   110,   111,   112,   113,   114,   115,   116,     0,
+       0,     0,   117,   118,   119,   120,   121,     0,     2,     0,
+      75,    76,   122,    77,    78,    79,     0,     0,     0,     0,
+       0,     0,   123,     0,     0,   124,   125,    80,    81,    82,
+       0,     0,   126,   127,     0,   570,   128,    83,     0,     0,
+       0,     0,     0,   129,     0,     0,     0,     0,     0,     0,
+       0,    84,     0,     0,     0,     0,     0,     0,    85,    86,
+      87,    88,    89,    90,    91,    92,    93,    94,    95,     0,
+       0,     0,     0,     0,    96,     0,     9,     0,     0,     0,
+       0,     0,     0,    97,    98,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    99,   100,   101,   102,   103,   104,   105,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,   115,   116,
+       0,     0,     0,   117,   118,   119,   120,   121,     0,     2,
+       0,    75,    76,   122,    77,    78,    79,     0,     0,     0,
+       0,     0,     0,   123,     0,     0,   124,   125,    80,    81,
+      82,     0,     0,   126,   127,     0,   572,   128,    83,     0,
+       0,     0,     0,     0,   129,     0,     0,     0,     0,     0,
+       0,     0,    84,     0,     0,     0,     0,     0,     0,    85,
+      86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
+       0,     0,     0,     0,     0,    96,     0,     9,     0,     0,
+       0,     0,     0,     0,    97,    98,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    99,   100,   101,   102,   103,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,   115,
+     116,     0,     0,     0,   117,   118,   119,   120,   121,     0,
+       2,     0,    75,    76,   122,    77,    78,    79,     0,     0,
+       0,     0,     0,     0,   123,     0,     0,   124,   125,    80,
+      81,    82,     0,     0,   126,   127,     0,   574,   128,    83,
+       0,     0,     0,     0,     0,   129,     0,     0,     0,     0,
+       0,     0,     0,    84,     0,     0,     0,     0,     0,     0,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,     0,     0,     0,     0,     0,    96,     0,     9,     0,
+       0,     0,     0,     0,     0,    97,    98,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,     0,     0,     0,   117,   118,   119,   120,   121,
+       0,     2,     0,    75,    76,   122,    77,    78,    79,     0,
+       0,     0,     0,     0,     0,   123,     0,     0,   124,   125,
+      80,    81,    82,     0,     0,   126,   127,     0,   576,   128,
+      83,     0,     0,     0,     0,     0,   129,     0,     0,     0,
+       0,     0,     0,     0,    84,     0,     0,     0,     0,     0,
+       0,    85,    86,    87,    88,    89,    90,    91,    92,    93,
+      94,    95,     0,     0,     0,     0,     0,    96,     0,     9,
+       0,     0,     0,     0,     0,     0,    97,    98,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    99,   100,   101,   102,   103,
+     104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,     0,     0,     0,   117,   118,   119,   120,
+     121,     0,     2,     0,    75,    76,   122,    77,    78,    79,
+       0,     0,     0,     0,     0,     0,   123,     0,     0,   124,
+     125,    80,    81,    82,     0,     0,   126,   127,     0,   578,
+     128,    83,     0,     0,     0,     0,     0,   129,     0,     0,
+       0,     0,     0,     0,     0,    84,     0,     0,     0,     0,
+       0,     0,    85,    86,    87,    88,    89,    90,    91,    92,
+      93,    94,    95,     0,     0,     0,     0,     0,    96,     0,
+       9,     0,     0,     0,     0,     0,     0,    97,    98,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    99,   100,   101,   102,
+     103,   104,   105,   106,   107,   108,   109,   110,   111,   112,
+     113,   114,   115,   116,     0,     0,     0,   117,   118,   119,
+     120,   121,     0,     2,     0,    75,    76,   122,    77,    78,
+      79,     0,     0,     0,     0,     0,     0,   123,     0,     0,
+     124,   125,    80,    81,    82,     0,     0,   126,   127,     0,
+     580,   128,    83,     0,     0,     0,     0,     0,   129,     0,
+       0,     0,     0,     0,     0,     0,    84,     0,     0,     0,
+       0,     0,     0,    85,    86,    87,    88,    89,    90,    91,
+      92,    93,    94,    95,     0,     0,     0,     0,     0,    96,
+       0,     9,     0,     0,     0,     0,     0,     0,    97,    98,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    99,   100,   101,
+     102,   103,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,     0,     0,     0,   117,   118,
+     119,   120,   121,     0,     2,     0,    75,    76,   122,    77,
+      78,    79,     0,     0,     0,     0,     0,     0,   123,     0,
+       0,   124,   125,    80,    81,    82,     0,     0,   126,   127,
+       0,   582,   128,    83,     0,     0,     0,     0,     0,   129,
+       0,     0,     0,     0,     0,     0,     0,    84,     0,     0,
+       0,     0,     0,     0,    85,    86,    87,    88,    89,    90,
+      91,    92,    93,    94,    95,     0,     0,     0,     0,     0,
+      96,     0,     9,     0,     0,     0,     0,     0,     0,    97,
+      98,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    99,   100,
+     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,   115,   116,     0,     0,     0,   117,
+     118,   119,   120,   121,     0,     2,     0,    75,    76,   122,
+      77,    78,    79,     0,     0,     0,     0,     0,     0,   123,
+       0,     0,   124,   125,    80,    81,    82,     0,     0,   126,
+     127,     0,   584,   128,    83,     0,     0,     0,     0,     0,
+     129,     0,     0,     0,     0,     0,     0,     0,    84,     0,
+       0,     0,     0,     0,     0,    85,    86,    87,    88,    89,
+      90,    91,    92,    93,    94,    95,     0,     0,     0,     0,
+       0,    96,     0,     9,     0,     0,     0,     0,     0,     0,
+      97,    98,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    99,
+     100,   101,   102,   103,   104,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,     0,     0,     0,
+     117,   118,   119,   120,   121,     0,     2,     0,    75,    76,
+     122,    77,    78,    79,     0,     0,     0,     0,     0,     0,
+     123,     0,     0,   124,   125,    80,    81,    82,     0,     0,
+     126,   127,     0,   586,   128,    83,     0,     0,     0,     0,
+       0,   129,     0,     0,     0,     0,     0,     0,     0,    84,
+       0,     0,     0,     0,     0,     0,    85,    86,    87,    88,
+      89,    90,    91,    92,    93,    94,    95,     0,     0,     0,
+       0,     0,    96,     0,     9,     0,     0,     0,     0,     0,
+       0,    97,    98,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
+     109,   110,   111,   112,   113,   114,   115,   116,     0,     0,
+       0,   117,   118,   119,   120,   121,     0,     2,     0,    75,
+      76,   122,    77,    78,    79,     0,     0,     0,     0,     0,
+       0,   123,     0,     0,   124,   125,    80,    81,    82,     0,
+       0,   126,   127,     0,   588,   128,    83,     0,     0,     0,
+       0,     0,   129,     0,     0,     0,     0,     0,     0,     0,
+      84,     0,     0,     0,     0,     0,     0,    85,    86,    87,
+      88,    89,    90,    91,    92,    93,    94,    95,     0,     0,
+       0,     0,     0,    96,     0,     9,     0,     0,     0,     0,
+       0,     0,    97,    98,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    99,   100,   101,   102,   103,   104,   105,   106,   107,
+     108,   109,   110,   111,   112,   113,   114,   115,   116,     0,
+       0,     0,   117,   118,   119,   120,   121,     0,     2,     0,
+      75,    76,   122,    77,    78,    79,     0,     0,     0,     0,
+       0,     0,   123,     0,     0,   124,   125,    80,    81,    82,
+       0,     0,   126,   127,     0,   590,   128,    83,     0,     0,
+       0,     0,     0,   129,     0,     0,     0,     0,     0,     0,
+       0,    84,     0,     0,     0,     0,     0,     0,    85,    86,
+      87,    88,    89,    90,    91,    92,    93,    94,    95,     0,
+       0,     0,     0,     0,    96,     0,     9,     0,     0,     0,
+       0,     0,     0,    97,    98,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    99,   100,   101,   102,   103,   104,   105,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,   115,   116,
+       0,     0,     0,   117,   118,   119,   120,   121,     0,     2,
+       0,    75,    76,   122,    77,    78,    79,     0,     0,     0,
+       0,     0,     0,   123,     0,     0,   124,   125,    80,    81,
+      82,     0,     0,   126,   127,     0,   592,   128,    83,     0,
+       0,     0,     0,     0,   129,     0,     0,     0,     0,     0,
+       0,     0,    84,     0,     0,     0,     0,     0,     0,    85,
+      86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
+       0,     0,     0,     0,     0,    96,     0,     9,     0,     0,
+       0,     0,     0,     0,    97,    98,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    99,   100,   101,   102,   103,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,   115,
+     116,     0,     0,     0,   117,   118,   119,   120,   121,     0,
+       2,     0,    75,    76,   122,    77,    78,    79,     0,     0,
+       0,     0,     0,     0,   123,     0,     0,   124,   125,    80,
+      81,    82,     0,     0,   126,   127,     0,   594,   128,    83,
+       0,     0,     0,     0,     0,   129,     0,     0,     0,     0,
+       0,     0,     0,    84,     0,     0,     0,     0,     0,     0,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,     0,     0,     0,     0,     0,    96,     0,     9,     0,
+       0,     0,     0,     0,     0,    97,    98,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,     0,     0,     0,   117,   118,   119,   120,   121,
+       0,     2,     0,    75,    76,   122,    77,    78,    79,     0,
+       0,     0,     0,     0,     0,   123,     0,     0,   124,   125,
+      80,    81,    82,     0,     0,   126,   127,     0,   596,   128,
+      83,     0,     0,     0,     0,     0,   129,     0,     0,     0,
+       0,     0,     0,     0,    84,     0,     0,     0,     0,     0,
+       0,    85,    86,    87,    88,    89,    90,    91,    92,    93,
+      94,    95,     0,     0,     0,     0,     0,    96,     0,     9,
+       0,     0,     0,     0,     0,     0,    97,    98,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    99,   100,   101,   102,   103,
+     104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,     0,     0,     0,   117,   118,   119,   120,
+     121,     0,     2,     0,    75,    76,   122,    77,    78,    79,
+       0,     0,     0,     0,     0,     0,   123,     0,     0,   124,
+     125,    80,    81,    82,     0,     0,   126,   127,     0,   612,
+     128,    83,     0,     0,     0,     0,     0,   129,     0,     0,
+       0,     0,     0,     0,     0,    84,     0,     0,     0,     0,
+       0,     0,    85,    86,    87,    88,    89,    90,    91,    92,
+      93,    94,    95,     0,     0,     0,     0,     0,    96,     0,
+       9,     0,     0,     0,     0,     0,     0,    97,    98,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    99,   100,   101,   102,
+     103,   104,   105,   106,   107,   108,   109,   110,   111,   112,
+     113,   114,   115,   116,     0,     0,     0,   117,   118,   119,
+     120,   121,     0,     2,     0,    75,    76,   122,    77,    78,
+      79,     0,     0,     0,     0,     0,     0,   123,     0,     0,
+     124,   125,    80,    81,    82,     0,     0,   126,   127,     0,
+     614,   128,    83,     0,     0,     0,     0,     0,   129,     0,
+       0,     0,     0,     0,     0,     0,    84,     0,     0,     0,
+       0,     0,     0,    85,    86,    87,    88,    89,    90,    91,
+      92,    93,    94,    95,     0,     0,     0,     0,     0,    96,
+       0,     9,     0,     0,     0,     0,     0,     0,    97,    98,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    99,   100,   101,
+     102,   103,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,     0,     0,     0,   117,   118,
+     119,   120,   121,     0,     2,     0,    75,    76,   122,    77,
+      78,    79,     0,     0,     0,     0,     0,     0,   123,     0,
+       0,   124,   125,    80,    81,    82,     0,     0,   126,   127,
+       0,   616,   128,    83,     0,     0,     0,     0,     0,   129,
+       0,     0,     0,     0,     0,     0,     0,    84,     0,     0,
+       0,     0,     0,     0,    85,    86,    87,    88,    89,    90,
+      91,    92,    93,    94,    95,     0,     0,     0,     0,     0,
+      96,     0,     9,     0,     0,     0,     0,     0,     0,    97,
+      98,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    99,   100,
+     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,   115,   116,     0,     0,     0,   117,
+     118,   119,   120,   121,     0,     2,     0,    75,    76,   122,
+      77,    78,    79,     0,     0,     0,     0,     0,     0,   123,
+       0,     0,   124,   125,    80,    81,    82,     0,     0,   126,
+     127,     0,   618,   128,    83,     0,     0,     0,     0,     0,
+     129,     0,     0,     0,     0,     0,     0,     0,    84,     0,
+       0,     0,     0,     0,     0,    85,    86,    87,    88,    89,
+      90,    91,    92,    93,    94,    95,     0,     0,     0,     0,
+       0,    96,     0,     9,     0,     0,     0,     0,     0,     0,
+      97,    98,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    99,
+     100,   101,   102,   103,   104,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,     0,     0,     0,
+     117,   118,   119,   120,   121,     0,     2,     0,    75,    76,
+     122,    77,    78,    79,     0,     0,     0,     0,     0,     0,
+     123,     0,     0,   124,   125,    80,    81,    82,     0,     0,
+     126,   127,     0,   620,   128,    83,     0,     0,     0,     0,
+       0,   129,     0,     0,     0,     0,     0,     0,     0,    84,
+       0,     0,     0,     0,     0,     0,    85,    86,    87,    88,
+      89,    90,    91,    92,    93,    94,    95,     0,     0,     0,
+       0,     0,    96,     0,     9,     0,     0,     0,     0,     0,
+       0,    97,    98,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
+     109,   110,   111,   112,   113,   114,   115,   116,     0,     0,
+       0,   117,   118,   119,   120,   121,     0,     2,     0,    75,
+      76,   122,    77,    78,    79,     0,     0,     0,     0,     0,
+       0,   123,     0,     0,   124,   125,    80,    81,    82,     0,
+       0,   126,   127,     0,   622,   128,    83,     0,     0,     0,
+       0,     0,   129,     0,     0,     0,     0,     0,     0,     0,
+      84,     0,     0,     0,     0,     0,     0,    85,    86,    87,
+      88,    89,    90,    91,    92,    93,    94,    95,     0,     0,
+       0,     0,     0,    96,     0,     9,     0,     0,     0,     0,
+       0,     0,    97,    98,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    99,   100,   101,   102,   103,   104,   105,   106,   107,
+     108,   109,   110,   111,   112,   113,   114,   115,   116,     0,
+       0,     0,   117,   118,   119,   120,   121,     0,     2,     0,
+      75,    76,   122,    77,    78,    79,     0,     0,     0,     0,
+       0,     0,   123,     0,     0,   124,   125,    80,    81,    82,
+       0,     0,   126,   127,     0,   624,   128,    83,     0,     0,
+       0,     0,     0,   129,     0,     0,     0,     0,     0,     0,
+       0,    84,     0,     0,     0,     0,     0,     0,    85,    86,
+      87,    88,    89,    90,    91,    92,    93,    94,    95,     0,
+       0,     0,     0,     0,    96,     0,     9,     0,     0,     0,
+       0,     0,     0,    97,    98,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    99,   100,   101,   102,   103,   104,   105,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,   115,   116,
+       0,     0,     0,   117,   118,   119,   120,   121,     0,     2,
+       0,    75,    76,   122,    77,    78,    79,     0,     0,     0,
+       0,     0,     0,   123,     0,     0,   124,   125,    80,    81,
+      82,     0,     0,   126,   127,     0,   626,   128,    83,     0,
+       0,     0,     0,     0,   129,     0,     0,     0,     0,     0,
+       0,     0,    84,     0,     0,     0,     0,     0,     0,    85,
+      86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
+       0,     0,     0,     0,     0,    96,     0,     9,     0,     0,
+       0,     0,     0,     0,    97,    98,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    99,   100,   101,   102,   103,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,   115,
+     116,     0,     0,     0,   117,   118,   119,   120,   121,     0,
+       0,     0,     0,     0,   122,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   123,     0,     0,   170,   125,     0,
+       0,     0,     0,     0,   126,   127,     0,     0,   128,   633,
+       0,     2,     0,    75,    76,   129,    77,    78,    79,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      80,    81,    82,     0,     0,     0,     0,     0,     0,     0,
+      83,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    84,     0,     0,     0,     0,     0,
+       0,    85,    86,    87,    88,    89,    90,    91,    92,    93,
+      94,    95,     0,     0,     0,     0,     0,    96,     0,     9,
+       0,     0,     0,     0,     0,     0,    97,    98,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    99,   100,   101,   102,   103,
+     104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,     0,     0,     0,   117,   118,   119,   120,
+     121,     0,     2,     0,    75,    76,   122,    77,    78,    79,
+       0,     0,     0,     0,     0,     0,   123,     0,     0,   124,
+     125,    80,    81,    82,     0,     0,   126,   127,     0,     0,
+     128,    83,     0,     0,     0,     0,   642,   129,     0,     0,
+       0,     0,     0,     0,     0,    84,     0,     0,     0,     0,
+       0,     0,    85,    86,    87,    88,    89,    90,    91,    92,
+      93,    94,    95,     0,     0,     0,     0,     0,    96,     0,
+       9,     0,     0,     0,     0,     0,     0,    97,    98,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    99,   100,   101,   102,
+     103,   104,   105,   106,   107,   108,   109,   110,   111,   112,
+     113,   114,   115,   116,     0,     0,     0,   117,   118,   119,
+     120,   121,     0,     2,     0,    75,    76,   122,    77,    78,
+      79,     0,     0,     0,     0,     0,     0,   123,     0,     0,
+     124,   125,    80,    81,   703,     0,     0,   126,   127,     0,
+       0,   128,    83,     0,     0,     0,     0,   203,   129,     0,
+       0,     0,     0,     0,     0,     0,    84,     0,     0,     0,
+       0,     0,     0,    85,    86,    87,    88,    89,    90,    91,
+      92,    93,    94,    95,     0,     0,     0,     0,     0,    96,
+       0,     9,     0,     0,     0,     0,     0,     0,    97,   704,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    99,   100,   101,
+     102,   103,   104,   105,   106,   107,   108,   109,   110,   111,
+     705,   113,   114,   115,   116,     0,     0,     0,   117,   118,
+     119,   120,   121,     0,     2,     0,    75,    76,   122,    77,
+      78,    79,     0,     0,     0,     0,     0,     0,   123,     0,
+     706,   707,   708,    80,    81,   838,     0,     0,   709,   127,
+       0,     0,   128,    83,     0,     0,     0,     0,     0,   129,
+       0,     0,     0,     0,     0,     0,     0,    84,     0,     0,
+       0,     0,     0,     0,    85,    86,    87,    88,    89,    90,
+      91,    92,    93,    94,    95,     0,     0,     0,     0,     0,
+      96,     0,     9,     0,     0,     0,     0,     0,     0,    97,
+      98,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    99,   100,
+     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,   115,   116,     0,     0,     0,   117,
+     118,   119,   120,   121,     0,     2,     0,    75,    76,   122,
+      77,    78,    79,     0,     0,     0,     0,     0,     0,   123,
+       0,     0,   124,   125,    80,    81,    82,     0,     0,   126,
+     127,     0,   318,   128,    83,     0,     0,     0,     0,     0,
+     129,     0,     0,     0,     0,     0,     0,     0,    84,     0,
+       0,     0,     0,     0,     0,    85,    86,    87,    88,    89,
+      90,    91,    92,    93,    94,    95,     0,     0,     0,     0,
+       0,    96,     0,     9,     0,     0,     0,     0,     0,     0,
+      97,    98,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    99,
+     100,   101,   102,   103,   104,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,     0,     0,     0,
+     117,   118,   119,   120,   121,     0,     0,     0,     0,     0,
+     122,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     123,     0,     0,   170,   125,     0,     0,     0,     0,     0,
+     126,   127,     0,     0,   128,   862,     0,     2,     0,    75,
+      76,   129,    77,    78,    79,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    80,    81,    82,     0,
+       0,     0,     0,     0,     0,     0,    83,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      84,     0,     0,     0,     0,     0,     0,    85,    86,    87,
+      88,    89,    90,    91,    92,    93,    94,    95,     0,     0,
+     883,     0,     0,    96,     0,     9,     0,     0,     0,    35,
+       0,     2,    97,    98,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   670,     0,
+      36,    37,    38,    39,    40,     0,     0,    41,    42,    43,
+       0,    44,    45,    46,    47,    48,    49,    50,     0,     0,
+       0,    99,   100,   101,   102,   103,   104,   105,   106,   107,
+     108,   109,   110,   111,   112,   113,   114,   115,   116,     0,
+       0,     0,   117,   118,   119,   120,   121,     0,     0,     9,
+       0,     0,   122,    51,     0,     0,     0,     0,    52,     0,
+       0,     0,   123,     0,     0,   124,   125,     0,     0,     0,
+       0,     0,   126,   127,     0,     2,   128,    75,    76,   893,
+      77,    78,    79,   129,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    80,    81,    82,     0,     0,     0,
+       0,     0,     0,     0,    83,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    84,     0,
+       0,    53,     0,     0,     0,    85,    86,    87,    88,    89,
+      90,    91,    92,    93,    94,    95,     0,    54,     0,     0,
+       0,    96,     0,     9,     0,     0,     0,     0,     0,     0,
+      97,    98,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    99,
+     100,   101,   102,   103,   104,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,     0,     0,     0,
+     117,   118,   119,   120,   121,     0,     2,     0,    75,    76,
+     122,    77,    78,    79,     0,     0,     0,     0,     0,     0,
+     123,     0,     0,   170,   125,    80,    81,    82,     0,     0,
+     126,   127,     0,     0,   128,    83,     0,     0,     0,     0,
+       0,   129,     0,     0,     0,     0,     0,     0,     0,    84,
+       0,     0,     0,     0,     0,     0,    85,    86,    87,    88,
+      89,    90,    91,    92,    93,    94,    95,     0,     0,     0,
+       0,     0,    96,     0,     9,     0,     0,     0,     0,     0,
+       0,    97,    98,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
+     109,   110,   111,   112,   113,   114,   115,   116,     0,     0,
+       0,   117,   118,   119,   120,   121,     0,     0,     0,     0,
+       0,   122,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   123,     0,     0,   170,   125,     0,     0,     0,     0,
+       0,   126,   127,     0,     0,   128,   955,     0,     2,     0,
+      75,    76,   129,    77,    78,    79,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    80,    81,    82,
+       0,     0,     0,     0,     0,     0,     0,    83,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    84,     0,     0,     0,     0,     0,     0,    85,    86,
+      87,    88,    89,    90,    91,    92,    93,    94,    95,     0,
+       0,     0,     0,     0,    96,     0,     9,     0,     0,     0,
+       0,     0,     0,    97,    98,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    99,   100,   101,   102,   103,   104,   105,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,   115,   116,
+       0,     0,     0,   117,   118,   119,   120,   121,     0,     2,
+       0,    75,    76,   122,    77,    78,    79,     0,     0,     0,
+       0,     0,     0,   123,     0,     0,   124,   125,    80,    81,
+      82,     0,     0,   126,   127,     0,     0,   128,    83,     0,
+       0,     0,     0,     0,   129,     0,     0,     0,     0,     0,
+       0,     0,    84,     0,     0,     0,     0,     0,     0,    85,
+      86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
+       0,     0,     0,     0,     0,    96,     0,     9,     0,     0,
+       0,     0,     0,     0,    97,    98,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    99,   100,   101,   102,   103,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,   115,
+     116,     0,     0,     0,   117,   118,   119,   120,   121,     0,
+       2,     0,    75,    76,   122,    77,    78,    79,     0,     0,
+       0,     0,     0,     0,   123,     0,     0,   170,   125,    80,
+      81,    82,     0,     0,   126,   127,     0,     0,   128,    83,
+       0,     0,     0,     0,     0,   129,     0,     0,     0,     0,
+       0,     0,     0,    84,     0,     0,     0,     0,     0,     0,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,     0,     0,     0,     0,     0,    96,     0,     9,     0,
+       0,     0,     0,     0,     0,    97,    98,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,     0,     0,     0,   117,   118,   119,   120,   121,
+       0,     2,     0,    75,    76,   122,    77,    78,    79,     0,
+       0,     0,     0,     0,     0,   123,     0,     0,   170,   125,
+      80,    81,   839,     0,     0,   126,   127,     0,     0,   692,
+      83,     0,     0,     0,     0,     0,   129,     0,     0,     0,
+       0,     0,     0,     0,    84,     0,     0,     0,     0,     0,
+       0,    85,    86,    87,    88,    89,    90,    91,    92,    93,
+      94,    95,     0,     0,     0,     0,     0,    96,     0,     9,
+       0,     0,     0,     0,     0,     0,    97,    98,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    99,   100,   101,   102,   103,
+     104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,     0,     0,     0,   117,   118,   119,   120,
+     121,     0,     2,     0,    75,    76,   122,    77,    78,    79,
+       0,     0,     0,     0,     0,     0,   123,     0,     0,   124,
+     125,   840,   841,   842,     0,     0,   126,   127,     0,     0,
+     128,    83,     0,     0,     0,     0,     0,   129,     0,     0,
+       0,     0,     0,     0,     0,    84,     0,     0,     0,     0,
+       0,     0,    85,    86,    87,    88,    89,    90,    91,    92,
+      93,    94,    95,     0,     0,     0,     0,     0,    96,     0,
+       9,     0,    35,     0,     2,     0,     0,    97,    98,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    36,    37,    38,    39,    40,     0,     0,
+      41,    42,    43,     0,    44,    45,    46,    47,    48,    49,
+      50,     0,     0,     0,     0,     0,    99,   100,   101,   102,
+     103,   104,   105,   106,   107,   108,   109,   110,   111,   112,
+     113,   114,   115,   116,     0,     0,     0,   117,   118,   119,
+     120,   121,     9,     0,     0,     0,    51,   122,     0,     0,
+       0,    52,     0,     0,     0,     0,     0,   123,     0,     0,
+     124,   125,     0,     0,     0,     0,     0,   126,   127,     0,
+       0,   128,     0,     0,     0,     0,     0,     0,   129,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     879,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    53,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      54,   326,   327,   328,   329,   330,   331,   332,   333,   334,
+     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
+     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
+     355,   356,   357,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   358,   359,   944,     0,     0,     0,
+       0,     0,     0,   360,     0,   361,   362,   363,   364,   365,
+     366,   367,   368,   369,   370,     0,     0,   371,   372,   373,
+     374,   375,   376,   377,   378,   379,     0,     0,   945,     0,
+       0,     0,     0,     0,     0,     0,   326,   327,   328,   329,
+     330,   331,   332,   333,   334,   335,   336,   337,   338,   339,
+     340,   341,   342,   343,   344,   345,   346,   347,   348,   349,
+     350,   351,   352,   353,   354,   355,   356,   357,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   844,     0,     0,   358,
+     359,     0,     0,     0,     0,     0,     0,     0,   360,     0,
+     361,   362,   363,   364,   365,   366,   367,   368,   369,   370,
+       0,     0,   371,   372,   373,   374,   375,   376,   377,   378,
+     379,   326,   327,   328,   329,   330,   331,   332,   333,   334,
+     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
+     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
+     355,   356,   357,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   358,   359,     0,     0,     0,     0,
+       0,     0,   505,   360,     0,   361,   362,   363,   364,   365,
+     366,   367,   368,   369,   370,     0,     0,   371,   372,   373,
+     374,   375,   376,   377,   378,   379,   676,     0,     0,     0,
+       0,     0,     0,     0,   326,   327,   328,   329,   330,   331,
+     332,   333,   334,   335,   336,   337,   338,   339,   340,   341,
+     342,   343,   344,   345,   346,   347,   348,   349,   350,   351,
+     352,   353,   354,   355,   356,   357,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   358,   359,   505,
+       0,     0,     0,     0,     0,     0,   360,     0,   361,   362,
+     363,   364,   365,   366,   367,   368,   369,   370,     0,     0,
+     371,   372,   373,   374,   375,   376,   377,   378,   379,     0,
+       0,   326,   327,   328,   329,   330,   331,   332,   333,   334,
+     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
+     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
+     355,   356,   357,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   358,   359,     0,     0,     0,     0,
+       0,     0,     0,   360,     0,   361,   362,   363,   364,   365,
+     366,   367,   368,   369,   370,     0,     0,   371,   372,   373,
+     374,   375,   376,   377,   378,   379,   425,     0,     0,     0,
+       0,     0,     0,     0,   326,   327,   328,   329,   330,   331,
+     332,   333,   334,   335,   336,   337,   338,   339,   340,   341,
+     342,   343,   344,   345,   346,   347,   348,   349,   350,   351,
+     352,   353,   354,   355,   356,   357,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   358,   359,     0,
+       0,     0,     0,     0,     0,     0,   360,     0,   361,   362,
+     363,   364,   365,   366,   367,   368,   369,   370,     0,     0,
+     371,   372,   373,   374,   375,   376,   377,   378,   379,     0,
+       0,     0,     0,     0,     0,     0,   426,   326,   327,   328,
+     329,   330,   331,   332,   333,   334,   335,   336,   337,   338,
+     339,   340,   341,   342,   343,   344,   345,   346,   347,   348,
+     349,   350,   351,   352,   353,   354,   355,   356,   357,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     358,   359,     0,     0,     0,     0,     0,     0,     0,   360,
+       0,   361,   362,   363,   364,   365,   366,   367,   368,   369,
+     370,     0,     0,   371,   372,   373,   374,   375,   376,   377,
+     378,   379,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   646,   326,   327,   328,   329,   330,   331,   332,   333,
+     334,   335,   336,   337,   338,   339,   340,   341,   342,   343,
+     344,   345,   346,   347,   348,   349,   350,   351,   352,   353,
+     354,   355,   356,   357,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   358,   359,     0,     0,     0,
+       0,     0,     0,     0,   360,     0,   361,   362,   363,   364,
+     365,   366,   367,   368,   369,   370,     0,     0,   371,   372,
+     373,   374,   375,   376,   377,   378,   379,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   648,   326,   327,   328,
+     329,   330,   331,   332,   333,   334,   335,   336,   337,   338,
+     339,   340,   341,   342,   343,   344,   345,   346,   347,   348,
+     349,   350,   351,   352,   353,   354,   355,   356,   357,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     358,   359,     0,     0,     0,     0,     0,     0,     0,   360,
+       0,   361,   362,   363,   364,   365,   366,   367,   368,   369,
+     370,     0,     0,   371,   372,   373,   374,   375,   376,   377,
+     378,   379,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   715,   326,   327,   328,   329,   330,   331,   332,   333,
+     334,   335,   336,   337,   338,   339,   340,   341,   342,   343,
+     344,   345,   346,   347,   348,   349,   350,   351,   352,   353,
+     354,   355,   356,   357,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   358,   359,     0,     0,     0,
+       0,     0,     0,     0,   360,     0,   361,   362,   363,   364,
+     365,   366,   367,   368,   369,   370,     0,     0,   371,   372,
+     373,   374,   375,   376,   377,   378,   379,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   716,   326,   327,   328,
+     329,   330,   331,   332,   333,   334,   335,   336,   337,   338,
+     339,   340,   341,   342,   343,   344,   345,   346,   347,   348,
+     349,   350,   351,   352,   353,   354,   355,   356,   357,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     358,   359,     0,     0,     0,     0,     0,     0,     0,   360,
+       0,   361,   362,   363,   364,   365,   366,   367,   368,   369,
+     370,     0,     0,   371,   372,   373,   374,   375,   376,   377,
+     378,   379,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   717,   326,   327,   328,   329,   330,   331,   332,   333,
+     334,   335,   336,   337,   338,   339,   340,   341,   342,   343,
+     344,   345,   346,   347,   348,   349,   350,   351,   352,   353,
+     354,   355,   356,   357,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   358,   359,     0,     0,     0,
+       0,     0,     0,     0,   360,     0,   361,   362,   363,   364,
+     365,   366,   367,   368,   369,   370,     0,     0,   371,   372,
+     373,   374,   375,   376,   377,   378,   379,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   718,   326,   327,   328,
+     329,   330,   331,   332,   333,   334,   335,   336,   337,   338,
+     339,   340,   341,   342,   343,   344,   345,   346,   347,   348,
+     349,   350,   351,   352,   353,   354,   355,   356,   357,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     358,   359,     0,     0,     0,     0,     0,     0,     0,   360,
+       0,   361,   362,   363,   364,   365,   366,   367,   368,   369,
+     370,     0,     0,   371,   372,   373,   374,   375,   376,   377,
+     378,   379,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   719,   326,   327,   328,   329,   330,   331,   332,   333,
+     334,   335,   336,   337,   338,   339,   340,   341,   342,   343,
+     344,   345,   346,   347,   348,   349,   350,   351,   352,   353,
+     354,   355,   356,   357,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   358,   359,     0,     0,     0,
+       0,     0,     0,     0,   360,     0,   361,   362,   363,   364,
+     365,   366,   367,   368,   369,   370,     0,     0,   371,   372,
+     373,   374,   375,   376,   377,   378,   379,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   781,   326,   327,   328,
+     329,   330,   331,   332,   333,   334,   335,   336,   337,   338,
+     339,   340,   341,   342,   343,   344,   345,   346,   347,   348,
+     349,   350,   351,   352,   353,   354,   355,   356,   357,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     358,   359,     0,     0,     0,     0,     0,     0,     0,   360,
+       0,   361,   362,   363,   364,   365,   366,   367,   368,   369,
+     370,     0,     0,   371,   372,   373,   374,   375,   376,   377,
+     378,   379,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   782,   326,   327,   328,   329,   330,   331,   332,   333,
+     334,   335,   336,   337,   338,   339,   340,   341,   342,   343,
+     344,   345,   346,   347,   348,   349,   350,   351,   352,   353,
+     354,   355,   356,   357,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   358,   359,     0,     0,     0,
+       0,     0,     0,     0,   360,     0,   361,   362,   363,   364,
+     365,   366,   367,   368,   369,   370,     0,     0,   371,   372,
+     373,   374,   375,   376,   377,   378,   379,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   787,   326,   327,   328,
+     329,   330,   331,   332,   333,   334,   335,   336,   337,   338,
+     339,   340,   341,   342,   343,   344,   345,   346,   347,   348,
+     349,   350,   351,   352,   353,   354,   355,   356,   357,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     358,   359,     0,     0,     0,     0,     0,     0,     0,   360,
+       0,   361,   362,   363,   364,   365,   366,   367,   368,   369,
+     370,     0,     0,   371,   372,   373,   374,   375,   376,   377,
+     378,   379,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   797,   326,   327,   328,   329,   330,   331,   332,   333,
+     334,   335,   336,   337,   338,   339,   340,   341,   342,   343,
+     344,   345,   346,   347,   348,   349,   350,   351,   352,   353,
+     354,   355,   356,   357,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   358,   359,     0,     0,     0,
+       0,     0,     0,     0,   360,     0,   361,   362,   363,   364,
+     365,   366,   367,   368,   369,   370,     0,     0,   371,   372,
+     373,   374,   375,   376,   377,   378,   379,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   798,   326,   327,   328,
+     329,   330,   331,   332,   333,   334,   335,   336,   337,   338,
+     339,   340,   341,   342,   343,   344,   345,   346,   347,   348,
+     349,   350,   351,   352,   353,   354,   355,   356,   357,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     358,   359,     0,     0,     0,     0,     0,     0,     0,   360,
+       0,   361,   362,   363,   364,   365,   366,   367,   368,   369,
+     370,     0,     0,   371,   372,   373,   374,   375,   376,   377,
+     378,   379,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   799,   326,   327,   328,   329,   330,   331,   332,   333,
+     334,   335,   336,   337,   338,   339,   340,   341,   342,   343,
+     344,   345,   346,   347,   348,   349,   350,   351,   352,   353,
+     354,   355,   356,   357,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   358,   359,     0,     0,     0,
+       0,     0,     0,     0,   360,     0,   361,   362,   363,   364,
+     365,   366,   367,   368,   369,   370,     0,     0,   371,   372,
+     373,   374,   375,   376,   377,   378,   379,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   808,   326,   327,   328,
+     329,   330,   331,   332,   333,   334,   335,   336,   337,   338,
+     339,   340,   341,   342,   343,   344,   345,   346,   347,   348,
+     349,   350,   351,   352,   353,   354,   355,   356,   357,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     358,   359,     0,     0,     0,     0,     0,     0,     0,   360,
+       0,   361,   362,   363,   364,   365,   366,   367,   368,   369,
+     370,     0,     0,   371,   372,   373,   374,   375,   376,   377,
+     378,   379,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   843,   326,   327,   328,   329,   330,   331,   332,   333,
+     334,   335,   336,   337,   338,   339,   340,   341,   342,   343,
+     344,   345,   346,   347,   348,   349,   350,   351,   352,   353,
+     354,   355,   356,   357,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   358,   359,     0,     0,     0,
+       0,     0,     0,     0,   360,     0,   361,   362,   363,   364,
+     365,   366,   367,   368,   369,   370,     0,     0,   371,   372,
+     373,   374,   375,   376,   377,   378,   379,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   852,   326,   327,   328,
+     329,   330,   331,   332,   333,   334,   335,   336,   337,   338,
+     339,   340,   341,   342,   343,   344,   345,   346,   347,   348,
+     349,   350,   351,   352,   353,   354,   355,   356,   357,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     358,   359,     0,     0,     0,     0,     0,     0,     0,   360,
+       0,   361,   362,   363,   364,   365,   366,   367,   368,   369,
+     370,     0,     0,   371,   372,   373,   374,   375,   376,   377,
+     378,   379,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   868,   326,   327,   328,   329,   330,   331,   332,   333,
+     334,   335,   336,   337,   338,   339,   340,   341,   342,   343,
+     344,   345,   346,   347,   348,   349,   350,   351,   352,   353,
+     354,   355,   356,   357,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   358,   359,     0,     0,     0,
+       0,     0,     0,     0,   360,     0,   361,   362,   363,   364,
+     365,   366,   367,   368,   369,   370,     0,     0,   371,   372,
+     373,   374,   375,   376,   377,   378,   379,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   869,   326,   327,   328,
+     329,   330,   331,   332,   333,   334,   335,   336,   337,   338,
+     339,   340,   341,   342,   343,   344,   345,   346,   347,   348,
+     349,   350,   351,   352,   353,   354,   355,   356,   357,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     358,   359,     0,     0,     0,     0,     0,     0,     0,   360,
+       0,   361,   362,   363,   364,   365,   366,   367,   368,   369,
+     370,     0,     0,   371,   372,   373,   374,   375,   376,   377,
+     378,   379,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   914,   326,   327,   328,   329,   330,   331,   332,   333,
+     334,   335,   336,   337,   338,   339,   340,   341,   342,   343,
+     344,   345,   346,   347,   348,   349,   350,   351,   352,   353,
+     354,   355,   356,   357,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   358,   359,     0,     0,     0,
+       0,     0,     0,     0,   360,     0,   361,   362,   363,   364,
+     365,   366,   367,   368,   369,   370,     0,     0,   371,   372,
+     373,   374,   375,   376,   377,   378,   379,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   920,   326,   327,   328,
+     329,   330,   331,   332,   333,   334,   335,   336,   337,   338,
+     339,   340,   341,   342,   343,   344,   345,   346,   347,   348,
+     349,   350,   351,   352,   353,   354,   355,   356,   357,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     358,   359,     0,     0,     0,     0,     0,     0,     0,   360,
+       0,   361,   362,   363,   364,   365,   366,   367,   368,   369,
+     370,     0,     0,   371,   372,   373,   374,   375,   376,   377,
+     378,   379,     0,     0,     0,     0,     0,     0,     0,     0,
+     380,   326,   327,   328,   329,   330,   331,   332,   333,   334,
+     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
+     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
+     355,   356,   357,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   358,   359,     0,     0,     0,     0,
+       0,     0,     0,   360,     0,   361,   362,   363,   364,   365,
+     366,   367,   368,   369,   370,     0,     0,   371,   372,   373,
+     374,   375,   376,   377,   378,   379,     0,   427,     0,     0,
+       0,     0,     0,     0,   445,   326,   327,   328,   329,   330,
+     331,   332,   333,   334,   335,   336,   337,   338,   339,   340,
+     341,   342,   343,   344,   345,   346,   347,   348,   349,   350,
+     351,   352,   353,   354,   355,   356,   357,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   358,   359,
+       0,     0,     0,     0,     0,     0,     0,   360,     0,   361,
+     362,   363,   364,   365,   366,   367,   368,   369,   370,     0,
+       0,   371,   372,   373,   374,   375,   376,   377,   378,   379,
+     428,     0,     0,     0,     0,     0,     0,     0,   326,   327,
+     328,   329,   330,   331,   332,   333,   334,   335,   336,   337,
+     338,   339,   340,   341,   342,   343,   344,   345,   346,   347,
+     348,   349,   350,   351,   352,   353,   354,   355,   356,   357,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   358,   359,     0,     0,     0,     0,     0,     0,     0,
+     360,     0,   361,   362,   363,   364,   365,   366,   367,   368,
+     369,   370,     0,     0,   371,   372,   373,   374,   375,   376,
+     377,   378,   379,   429,     0,     0,     0,     0,     0,     0,
+       0,   326,   327,   328,   329,   330,   331,   332,   333,   334,
+     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
+     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
+     355,   356,   357,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   358,   359,     0,     0,     0,     0,
+       0,     0,     0,   360,     0,   361,   362,   363,   364,   365,
+     366,   367,   368,   369,   370,     0,     0,   371,   372,   373,
+     374,   375,   376,   377,   378,   379,   430,     0,     0,     0,
+       0,     0,     0,     0,   326,   327,   328,   329,   330,   331,
+     332,   333,   334,   335,   336,   337,   338,   339,   340,   341,
+     342,   343,   344,   345,   346,   347,   348,   349,   350,   351,
+     352,   353,   354,   355,   356,   357,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   358,   359,     0,
+       0,     0,     0,     0,     0,     0,   360,     0,   361,   362,
+     363,   364,   365,   366,   367,   368,   369,   370,     0,     0,
+     371,   372,   373,   374,   375,   376,   377,   378,   379,   480,
+       0,     0,     0,     0,     0,     0,     0,   326,   327,   328,
+     329,   330,   331,   332,   333,   334,   335,   336,   337,   338,
+     339,   340,   341,   342,   343,   344,   345,   346,   347,   348,
+     349,   350,   351,   352,   353,   354,   355,   356,   357,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     358,   359,     0,     0,     0,     0,     0,     0,     0,   360,
+       0,   361,   362,   363,   364,   365,   366,   367,   368,   369,
+     370,     0,     0,   371,   372,   373,   374,   375,   376,   377,
+     378,   379,   674,     0,     0,     0,     0,     0,     0,     0,
+     326,   327,   328,   329,   330,   331,   332,   333,   334,   335,
+     336,   337,   338,   339,   340,   341,   342,   343,   344,   345,
+     346,   347,   348,   349,   350,   351,   352,   353,   354,   355,
+     356,   357,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   358,   359,     0,     0,     0,     0,     0,
+       0,     0,   360,     0,   361,   362,   363,   364,   365,   366,
+     367,   368,   369,   370,     0,     0,   371,   372,   373,   374,
+     375,   376,   377,   378,   379,   677,     0,     0,     0,     0,
+       0,     0,     0,   326,   327,   328,   329,   330,   331,   332,
+     333,   334,   335,   336,   337,   338,   339,   340,   341,   342,
+     343,   344,   345,   346,   347,   348,   349,   350,   351,   352,
+     353,   354,   355,   356,   357,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   358,   359,     0,     0,
+       0,     0,     0,     0,     0,   360,     0,   361,   362,   363,
+     364,   365,   366,   367,   368,   369,   370,     0,     0,   371,
+     372,   373,   374,   375,   376,   377,   378,   379,   678,     0,
+       0,     0,     0,     0,     0,     0,   326,   327,   328,   329,
+     330,   331,   332,   333,   334,   335,   336,   337,   338,   339,
+     340,   341,   342,   343,   344,   345,   346,   347,   348,   349,
+     350,   351,   352,   353,   354,   355,   356,   357,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   358,
+     359,     0,     0,     0,     0,     0,     0,     0,   360,     0,
+     361,   362,   363,   364,   365,   366,   367,   368,   369,   370,
+       0,     0,   371,   372,   373,   374,   375,   376,   377,   378,
+     379,   679,     0,     0,     0,     0,     0,     0,     0,   326,
+     327,   328,   329,   330,   331,   332,   333,   334,   335,   336,
+     337,   338,   339,   340,   341,   342,   343,   344,   345,   346,
+     347,   348,   349,   350,   351,   352,   353,   354,   355,   356,
+     357,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   358,   359,     0,     0,     0,     0,     0,     0,
+       0,   360,     0,   361,   362,   363,   364,   365,   366,   367,
+     368,   369,   370,     0,     0,   371,   372,   373,   374,   375,
+     376,   377,   378,   379,   680,     0,     0,     0,     0,     0,
+       0,     0,   326,   327,   328,   329,   330,   331,   332,   333,
+     334,   335,   336,   337,   338,   339,   340,   341,   342,   343,
+     344,   345,   346,   347,   348,   349,   350,   351,   352,   353,
+     354,   355,   356,   357,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   358,   359,     0,     0,     0,
+       0,     0,     0,     0,   360,     0,   361,   362,   363,   364,
+     365,   366,   367,   368,   369,   370,     0,     0,   371,   372,
+     373,   374,   375,   376,   377,   378,   379,   800,     0,     0,
+       0,     0,     0,     0,     0,   326,   327,   328,   329,   330,
+     331,   332,   333,   334,   335,   336,   337,   338,   339,   340,
+     341,   342,   343,   344,   345,   346,   347,   348,   349,   350,
+     351,   352,   353,   354,   355,   356,   357,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   358,   359,
+       0,     0,     0,     0,     0,     0,     0,   360,     0,   361,
+     362,   363,   364,   365,   366,   367,   368,   369,   370,     0,
+       0,   371,   372,   373,   374,   375,   376,   377,   378,   379,
+     810,     0,     0,     0,     0,     0,     0,     0,   326,   327,
+     328,   329,   330,   331,   332,   333,   334,   335,   336,   337,
+     338,   339,   340,   341,   342,   343,   344,   345,   346,   347,
+     348,   349,   350,   351,   352,   353,   354,   355,   356,   357,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   358,   359,     0,     0,     0,     0,     0,     0,     0,
+     360,     0,   361,   362,   363,   364,   365,   366,   367,   368,
+     369,   370,     0,     0,   371,   372,   373,   374,   375,   376,
+     377,   378,   379,   811,     0,     0,     0,     0,     0,     0,
+       0,   326,   327,   328,   329,   330,   331,   332,   333,   334,
+     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
+     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
+     355,   356,   357,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   358,   359,     0,     0,     0,     0,
+       0,     0,     0,   360,     0,   361,   362,   363,   364,   365,
+     366,   367,   368,   369,   370,     0,     0,   371,   372,   373,
+     374,   375,   376,   377,   378,   379,   923,     0,     0,     0,
+       0,     0,     0,     0,   326,   327,   328,   329,   330,   331,
+     332,   333,   334,   335,   336,   337,   338,   339,   340,   341,
+     342,   343,   344,   345,   346,   347,   348,   349,   350,   351,
+     352,   353,   354,   355,   356,   357,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   358,   359,     0,
+       0,     0,     0,     0,     0,     0,   360,     0,   361,   362,
+     363,   364,   365,   366,   367,   368,   369,   370,     0,     0,
+     371,   372,   373,   374,   375,   376,   377,   378,   379,   924,
+       0,     0,     0,     0,     0,     0,     0,   326,   327,   328,
+     329,   330,   331,   332,   333,   334,   335,   336,   337,   338,
+     339,   340,   341,   342,   343,   344,   345,   346,   347,   348,
+     349,   350,   351,   352,   353,   354,   355,   356,   357,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     358,   359,     0,     0,     0,     0,     0,     0,     0,   360,
+       0,   361,   362,   363,   364,   365,   366,   367,   368,   369,
+     370,     0,     0,   371,   372,   373,   374,   375,   376,   377,
+     378,   379,   947,     0,     0,     0,     0,     0,     0,     0,
+     326,   327,   328,   329,   330,   331,   332,   333,   334,   335,
+     336,   337,   338,   339,   340,   341,   342,   343,   344,   345,
+     346,   347,   348,   349,   350,   351,   352,   353,   354,   355,
+     356,   357,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   358,   359,     0,     0,     0,     0,     0,
+       0,     0,   360,     0,   361,   362,   363,   364,   365,   366,
+     367,   368,   369,   370,     0,     0,   371,   372,   373,   374,
+     375,   376,   377,   378,   379,   948,     0,     0,     0,     0,
+       0,     0,     0,   326,   327,   328,   329,   330,   331,   332,
+     333,   334,   335,   336,   337,   338,   339,   340,   341,   342,
+     343,   344,   345,   346,   347,   348,   349,   350,   351,   352,
+     353,   354,   355,   356,   357,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   358,   359,     0,     0,
+       0,     0,     0,     0,     0,   360,     0,   361,   362,   363,
+     364,   365,   366,   367,   368,   369,   370,     0,     0,   371,
+     372,   373,   374,   375,   376,   377,   378,   379,   963,     0,
+       0,     0,     0,     0,     0,     0,   326,   327,   328,   329,
+     330,   331,   332,   333,   334,   335,   336,   337,   338,   339,
+     340,   341,   342,   343,   344,   345,   346,   347,   348,   349,
+     350,   351,   352,   353,   354,   355,   356,   357,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   358,
+     359,     0,     0,     0,     0,     0,     0,     0,   360,     0,
+     361,   362,   363,   364,   365,   366,   367,   368,   369,   370,
+       0,     0,   371,   372,   373,   374,   375,   376,   377,   378,
+     379,   326,   327,   328,   329,   330,   331,   332,   333,   334,
+     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
+     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
+     355,   356,   357,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   358,   359,     0,     0,     0,     0,
+       0,     0,     0,   360,     0,   361,   362,   363,   364,   365,
+     366,   367,   368,   369,   370,     0,     0,   371,   372,   373,
+     374,   375,   376,   377,   378,   379,     0,     0,     0,     0,
+       0,     0,   913,   326,   327,   328,   329,   330,   331,   332,
+     333,   334,   335,   336,   337,   338,   339,   340,   341,   342,
+     343,   344,   345,   346,   347,   348,   349,   350,   351,   352,
+     353,   354,   355,   356,   357,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   358,   359,     0,     0,
+       0,     0,     0,     0,     0,   360,     0,   361,   362,   363,
+     364,   365,   366,   367,   368,   369,   370,     0,     0,   371,
+     372,   373,   374,   375,   376,   377,   378,   379,   728,     0,
+       0,     0,     0,   536,   326,   327,   328,   329,   330,   331,
+     332,   333,   334,   335,   336,   337,   338,   339,   340,   341,
+     342,   343,   344,   345,   346,   347,   348,   349,   350,   351,
+     352,   353,   354,   355,   356,   357,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   358,   359,     0,
+       0,     0,     0,     0,     0,     0,   360,     0,   361,   362,
+     363,   364,   365,   366,   367,   368,   369,   370,     0,     0,
+     371,   372,   373,   374,   375,   376,   377,   378,   379,   326,
+     327,   328,   329,   330,   331,   332,   333,   334,   335,   336,
+     337,   338,   339,   340,   341,   342,   343,   344,   345,   346,
+     347,   348,   349,   350,   351,   352,   353,   354,   355,   356,
+     357,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   358,   359,     0,     0,     0,     0,     0,     0,
+       0,   360,     0,   361,   362,   363,   364,   365,   366,   367,
+     368,   369,   370,     0,     0,   371,   372,   373,   374,   375,
+     376,   377,   378,   379,     0,     0,     0,     0,     0,   733,
+     326,   327,   328,   329,   330,   331,   332,   333,   334,   335,
+     336,   337,   338,   339,   340,   341,   342,   343,   344,   345,
+     346,   347,   348,   349,   350,   351,   352,   353,   354,   355,
+     356,   357,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   358,   359,     0,     0,     0,     0,     0,
+       0,     0,   360,     0,   361,   362,   363,   364,   365,   366,
+     367,   368,   369,   370,     0,     0,   371,   372,   373,   374,
+     375,   376,   377,   378,   379,     0,     0,     0,     0,     0,
+     735,   326,   327,   328,   329,   330,   331,   332,   333,   334,
+     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
+     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
+     355,   356,   357,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   358,   359,     0,     0,     0,     0,
+       0,     0,     0,   360,     0,   361,   362,   363,   364,   365,
+     366,   367,   368,   369,   370,     0,     0,   371,   372,   373,
+     374,   375,   376,   377,   378,   379,     0,     0,     0,     0,
+       0,   738,   326,   327,   328,   329,   330,   331,   332,   333,
+     334,   335,   336,   337,   338,   339,   340,   341,   342,   343,
+     344,   345,   346,   347,   348,   349,   350,   351,   352,   353,
+     354,   355,   356,   357,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   358,   359,     0,     0,     0,
+       0,     0,     0,     0,   360,     0,   361,   362,   363,   364,
+     365,   366,   367,   368,   369,   370,     0,     0,   371,   372,
+     373,   374,   375,   376,   377,   378,   379,     0,     0,     0,
+       0,     0,   739,   326,   327,   328,   329,   330,   331,   332,
+     333,   334,   335,   336,   337,   338,   339,   340,   341,   342,
+     343,   344,   345,   346,   347,   348,   349,   350,   351,   352,
+     353,   354,   355,   356,   357,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   358,   359,     0,     0,
+       0,     0,     0,     0,     0,   360,     0,   361,   362,   363,
+     364,   365,   366,   367,   368,   369,   370,     0,     0,   371,
+     372,   373,   374,   375,   376,   377,   378,   379,     0,     0,
+       0,     0,     0,   740,   326,   327,   328,   329,   330,   331,
+     332,   333,   334,   335,   336,   337,   338,   339,   340,   341,
+     342,   343,   344,   345,   346,   347,   348,   349,   350,   351,
+     352,   353,   354,   355,   356,   357,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   358,   359,     0,
+       0,     0,     0,     0,     0,     0,   360,     0,   361,   362,
+     363,   364,   365,   366,   367,   368,   369,   370,     0,     0,
+     371,   372,   373,   374,   375,   376,   377,   378,   379,   792,
+       0,     0,     0,     0,   741,   326,   327,   328,   329,   330,
+     331,   332,   333,   334,   335,   336,   337,   338,   339,   340,
+     341,   342,   343,   344,   345,   346,   347,   348,   349,   350,
+     351,   352,   353,   354,   355,   356,   357,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   358,   359,
+       0,     0,     0,     0,     0,     0,     0,   360,     0,   361,
+     362,   363,   364,   365,   366,   367,   368,   369,   370,     0,
+       0,   371,   372,   373,   374,   375,   376,   377,   378,   379,
+     934,     0,     0,     0,     0,     0,   326,   327,   328,   329,
+     330,   331,   332,   333,   334,   335,   336,   337,   338,   339,
+     340,   341,   342,   343,   344,   345,   346,   347,   348,   349,
+     350,   351,   352,   353,   354,   355,   356,   357,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   358,
+     359,     0,     0,     0,     0,     0,     0,     0,   360,     0,
+     361,   362,   363,   364,   365,   366,   367,   368,   369,   370,
+       0,     0,   371,   372,   373,   374,   375,   376,   377,   378,
+     379,   326,   327,   328,   329,   330,   331,   332,   333,   334,
+     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
+     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
+     355,   356,   357,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   358,   359,     0,     0,     0,     0,
+       0,     0,   721,   360,     0,   361,   362,   363,   364,   365,
+     366,   367,   368,   369,   370,     0,     0,   371,   372,   373,
+     374,   375,   376,   377,   378,   379,   326,   327,   328,   329,
+     330,   331,   332,   333,   334,   335,   336,   337,   338,   339,
+     340,   341,   342,   343,   344,   345,   346,   347,   348,   349,
+     350,   351,   352,   353,   354,   355,   356,   357,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   358,
+     359,     0,     0,     0,     0,     0,     0,   722,   360,     0,
+     361,   362,   363,   364,   365,   366,   367,   368,   369,   370,
+       0,     0,   371,   372,   373,   374,   375,   376,   377,   378,
+     379,   326,   327,   328,   329,   330,   331,   332,   333,   334,
+     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
+     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
+     355,   356,   357,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   358,   359,     0,     0,     0,     0,
+       0,     0,   723,   360,     0,   361,   362,   363,   364,   365,
+     366,   367,   368,   369,   370,     0,     0,   371,   372,   373,
+     374,   375,   376,   377,   378,   379,   326,   327,   328,   329,
+     330,   331,   332,   333,   334,   335,   336,   337,   338,   339,
+     340,   341,   342,   343,   344,   345,   346,   347,   348,   349,
+     350,   351,   352,   353,   354,   355,   356,   357,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   358,
+     359,     0,     0,     0,     0,     0,     0,   724,   360,     0,
+     361,   362,   363,   364,   365,   366,   367,   368,   369,   370,
+       0,     0,   371,   372,   373,   374,   375,   376,   377,   378,
+     379,   326,   327,   328,   329,   330,   331,   332,   333,   334,
+     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
+     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
+     355,   356,   357,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   358,   359,     0,     0,     0,     0,
+       0,     0,     0,   360,   770,   361,   362,   363,   364,   365,
+     366,   367,   368,   369,   370,     0,     0,   371,   372,   373,
+     374,   375,   376,   377,   378,   379,   326,   327,   328,   329,
+     330,   331,   332,   333,   334,   335,   336,   337,   338,   339,
+     340,   341,   342,   343,   344,   345,   346,   347,   348,   349,
+     350,   351,   352,   353,   354,   355,   356,   357,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   358,
+     359,     0,     0,     0,     0,     0,     0,     0,   360,     0,
+     361,   362,   363,   364,   365,   366,   367,   368,   369,   370,
+       0,     0,   371,   372,   373,   374,   375,   376,   377,   378,
+     379,   326,   327,   328,   329,   330,   331,   332,   333,   334,
+     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
+     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
+     355,   356,   357,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   358,   359,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   361,   362,   363,   364,   365,
+     366,   367,   368,   369,   370,     0,     0,   371,   372,   373,
+     374,   375,   376,   377,   378,   379,   326,     0,   328,     0,
+     330,   331,   332,   333,   334,   335,   336,   337,   338,   339,
+     340,   341,   342,   343,   344,   345,   346,   347,   348,   349,
+     350,   351,   352,   353,   354,   355,   356,   357,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   358,
+     359,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     361,   362,   363,   364,   365,   366,   367,   368,   369,   370,
+       0,     0,   371,   372,   373,   374,   375,   376,   377,   378,
+     379,   331,   332,   333,   334,   335,   336,   337,   338,   339,
+     340,   341,   342,   343,   344,   345,   346,   347,   348,   349,
+     350,   351,   352,   353,   354,   355,   356,   357,     0,     0,
+       0,   340,   341,   342,   343,   344,   345,   346,   347,   348,
+     349,   350,   351,   352,   353,   354,   355,   356,   357,   358,
+     359,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     361,   362,   363,   364,   365,   366,   367,   368,   369,   370,
+     358,   359,   371,   372,   373,   374,   375,   376,   377,   378,
+     379,   361,   362,   363,   364,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   373,   374,   375,   376,   377,
+     378,   379,   340,   341,   342,   343,   344,   345,   346,   347,
+     348,   349,   350,   351,   352,   353,   354,   355,     0,     0,
+       0,     0,     0,   342,   343,   344,   345,   346,   347,   348,
+     349,   350,   351,   352,   353,   354,   355,     0,     0,     0,
+       0,   358,   359,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   361,   362,   363,   364,     0,     0,     0,     0,
+     358,   359,     0,     0,     0,     0,   373,   374,   375,   376,
+     377,   378,   379,   363,   364,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   375,   376,   377,
+     378,   379
+};
+
+static const yytype_int16 yycheck[] =
+{
+      12,    55,   232,   274,   275,   230,   251,    60,   246,   660,
+      67,   282,     3,    36,    37,    38,    39,    40,     4,    24,
+     460,    59,     8,   276,   277,   278,   279,   280,     3,    75,
+      31,   677,    44,    45,    46,    47,    48,    30,    31,    31,
+      16,    31,     7,   174,   175,    31,   786,    23,    60,     0,
+       1,    63,     3,     3,    75,    67,    75,     3,     0,     3,
+      11,    12,    13,    14,    15,    16,   171,   884,    75,   174,
+     171,    75,    84,   890,    75,   176,    22,    23,    24,    75,
+      71,     3,     3,    75,     3,    75,    72,    99,   100,   101,
+     102,   103,   104,   105,   106,     1,    71,     3,   110,   111,
+      65,    44,    45,    75,    69,   117,   118,   119,   120,   121,
+     122,   123,   124,   125,   126,   632,   128,   129,     3,   390,
+      71,    71,   862,   640,    75,    71,     3,    71,   645,     3,
+      81,     5,     6,     7,    75,   147,   148,    81,    75,   162,
+     163,   164,   165,   166,   167,   168,   134,   201,   160,    71,
+      71,    75,    71,   206,   175,   208,   175,   162,   170,    81,
+      81,    80,    75,    75,    75,    71,   159,   153,   175,    75,
+      75,   175,    46,    47,   175,   213,   214,   171,   216,   919,
+      75,   176,   176,   175,    75,   175,    71,   178,   176,   176,
+     173,   203,   175,   180,    71,    80,   253,    71,    48,    49,
+      50,   472,   259,   175,    81,   217,   218,   219,   220,   221,
+     481,    75,   224,   176,   226,   955,    75,   180,   230,     3,
+     232,   872,   962,   656,   657,     6,   176,   178,   661,   173,
+     176,    26,    27,     1,   674,     3,   676,   677,   175,   172,
+     176,   253,    30,   488,   180,   210,   476,   259,   486,   171,
+     172,   172,   264,   265,   266,   267,   268,   482,   270,   271,
+     272,   273,   175,   175,   276,   277,   278,   279,   280,   281,
+     175,   283,   178,   285,   791,    15,    16,   289,    41,   291,
+     175,   293,   172,   295,     6,   297,   176,    71,     6,   173,
+     255,   175,   304,   305,   306,   307,    80,    81,   310,   173,
+     312,   947,   948,    71,    75,     3,   318,    75,   173,     3,
+     175,   173,   324,   175,   326,   327,   328,   329,   330,   331,
+     332,   333,   334,   335,   336,   337,   338,   339,   340,   341,
+     342,   343,   344,   345,   346,   347,   348,   349,   350,   351,
+     352,   353,   354,   355,   356,   357,   358,   359,   360,   361,
+     362,   363,   364,   365,   366,   367,   368,   369,   370,   371,
+     372,   373,   374,   375,   376,   377,   378,   379,   380,   381,
+     810,   811,   176,    71,   386,   176,   388,    71,     1,   391,
+       3,   172,   394,    81,   176,    82,    80,    81,    11,    12,
+      13,    14,    15,    16,   417,   448,   176,   450,   915,   916,
+     176,   455,   456,   457,    75,   172,   418,   419,   420,   172,
+     722,   723,   724,   176,   426,   178,   402,   180,     1,   172,
+       3,   692,   173,    63,   175,   172,   172,    67,   125,   126,
+     127,   443,   173,   445,   175,   447,   173,   134,   175,    22,
+      23,    24,   173,   172,   175,   172,   458,   459,    71,   176,
+     176,   178,    75,   180,   477,    38,    39,   173,    81,   175,
+     472,   158,   176,   173,   476,   175,   691,   107,   108,   109,
+     172,   172,   169,   171,   172,    75,   116,   489,   490,    37,
+      38,    39,    40,     3,   172,   172,   926,   127,    71,     9,
+      10,   931,    75,   505,   172,    36,    37,    38,    39,    40,
+     172,     3,    22,    23,    24,   945,   172,   947,   948,   172,
+     172,    52,    32,    75,   173,   527,   175,   173,   789,   175,
+      22,    23,    24,   963,   172,   172,   538,   492,   540,   172,
+     542,   496,   176,    75,   546,   173,   548,   175,   173,   173,
+     175,   175,   554,   173,    75,   175,   558,   173,   560,   175,
+     562,    71,   564,   172,   566,   178,   568,    82,   570,   175,
+     572,   174,   574,   175,   576,     6,   578,     6,   580,    71,
+     582,   176,   584,   176,   586,   176,   588,   176,   590,   172,
+     592,   172,   594,    75,   596,   173,   226,   172,   175,    31,
+     230,     3,   232,     5,     6,     7,     6,   609,   610,    73,
+     612,   175,   614,   828,   616,    75,   618,    75,   620,   165,
+     622,   175,   624,   253,   626,   135,   173,   178,   173,   259,
+     632,   162,   163,   164,   165,   166,   167,   168,   640,   173,
+     173,   177,    75,   645,    46,    47,   174,   649,   650,   173,
+      73,    73,    82,   173,   656,   657,    75,   175,   175,   661,
+      75,   175,   172,   176,   907,   176,   197,   175,   180,    71,
+     177,   684,     5,   675,   180,   177,   177,    75,    75,    75,
+     175,   942,    11,    12,    13,    14,    15,    16,    24,   173,
+     692,   180,   177,   176,   225,   125,   126,   127,    36,    37,
+      38,    39,    40,    75,   134,   707,   708,   709,    75,    36,
+      37,    38,    39,    40,   175,   172,   820,   730,   177,   721,
+     722,   723,   724,   176,   700,   177,   728,     3,   158,   226,
+     936,   262,   263,     9,    10,   933,     3,   146,    58,   169,
+     742,   743,     1,   274,   275,   175,    22,    23,    24,    72,
+      31,   282,    81,   903,   691,    61,    32,   417,   447,   206,
+      -1,    -1,    -1,    22,    23,    24,    25,    26,   770,    -1,
+      29,    30,    31,    -1,    33,    34,    35,    36,    37,    38,
+      39,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   790,   791,
+     792,     0,     1,    -1,     3,    71,    -1,    -1,    -1,    -1,
+      -1,    -1,    11,    12,    13,    14,    15,    16,    -1,    -1,
+     812,   813,   825,    -1,    -1,    -1,    75,   819,   820,    -1,
+      -1,    80,    -1,    -1,   162,   163,   164,   165,   166,   167,
+     168,    -1,   170,    -1,    -1,   162,   163,   164,   165,   166,
+     167,   168,   844,   170,    -1,    -1,   476,    -1,    -1,    -1,
+      -1,    -1,   482,   829,   830,   831,    -1,    -1,    -1,   390,
+      -1,    -1,    71,    -1,    -1,    -1,    75,    -1,    -1,    -1,
+     197,    -1,    81,    -1,    -1,    -1,    -1,   879,    -1,   881,
+     882,    -1,   884,    -1,   143,    -1,   417,   225,   890,   106,
+     107,   108,   109,   110,   111,   112,   172,    -1,   225,    -1,
+     159,    -1,    -1,    -1,    -1,   907,    -1,    -1,    -1,    -1,
+      -1,   913,    -1,   915,   916,    -1,    -1,    -1,    -1,   136,
+     137,    -1,    -1,   936,    -1,    -1,    -1,   903,    -1,    -1,
+      -1,   933,   934,    -1,    -1,    -1,   274,   275,    -1,    -1,
+      -1,   472,   944,    -1,   282,    -1,   477,   274,   275,    -1,
+     481,    -1,    -1,    -1,    -1,   282,    -1,    -1,     0,    -1,
+      -1,     3,     4,     5,     6,     7,     8,    -1,    -1,    -1,
+       1,    -1,     3,    -1,    16,    -1,    -1,    -1,    -1,    -1,
+      -1,    23,    -1,    25,    26,    27,    -1,    -1,    -1,    31,
+      -1,    22,    23,    24,    25,    26,    -1,    -1,    29,    30,
+      31,    -1,    33,    34,    35,    36,    37,    38,    39,     0,
+      -1,    -1,    -1,    55,     5,     6,     7,    59,    -1,    -1,
+      -1,    -1,    64,    65,    15,    16,    68,    69,    -1,    -1,
+      72,    -1,    -1,    -1,    25,    26,    27,    -1,    -1,    -1,
+      71,    -1,    -1,    -1,    75,    -1,    -1,    -1,    -1,    80,
+      81,    -1,   390,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   691,    -1,   390,    -1,   107,   108,   109,    -1,    -1,
+      -1,    -1,    -1,    -1,   116,    -1,    -1,    -1,    -1,   417,
+      -1,    -1,    -1,    -1,    -1,   127,    -1,    -1,    -1,    -1,
+     417,   106,   107,   108,   109,   110,   111,   112,    -1,    -1,
+      -1,    -1,     0,     1,   146,     3,    -1,    -1,    -1,    -1,
+      -1,   153,   143,    11,    12,    13,    14,    15,    16,    -1,
+      -1,   136,   137,    -1,    22,    23,    24,    -1,   159,   660,
+      -1,    -1,    -1,    -1,   472,    -1,    -1,    -1,    -1,   477,
+      38,    39,    -1,   481,    -1,   472,    -1,    -1,    -1,    -1,
+     477,   166,   167,   684,   481,   197,    -1,    -1,    -1,   201,
+      -1,   692,    -1,    -1,    -1,    -1,    -1,    -1,   210,    -1,
+      -1,   213,   214,    71,   216,   217,    -1,    75,    -1,    -1,
+      -1,    -1,    -1,    81,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   828,   730,
+      -1,    -1,    -1,   245,   246,     0,     1,    -1,     3,   251,
+      -1,    -1,   254,   255,    -1,   257,    11,    12,    13,    14,
+      15,    16,    -1,    -1,    -1,    -1,    -1,    22,    23,    24,
+      25,    26,    -1,    -1,    29,    30,    31,    -1,    33,    34,
+      35,    36,    37,    38,    39,    -1,    -1,   106,   107,   108,
+     109,   110,   111,   112,    -1,    -1,    -1,    -1,   789,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   106,   107,   108,
+     109,   110,   111,   112,    -1,    -1,    71,   136,   137,    -1,
+      75,    -1,    -1,    -1,    -1,    80,    81,    -1,     0,     1,
+      -1,     3,    -1,    -1,   825,    -1,    -1,   136,   137,    11,
+      12,    13,    14,    15,    16,    -1,   165,   166,   167,    -1,
+      22,    23,    24,    25,    26,    -1,    -1,    29,    30,    31,
+      -1,    33,    34,    35,    36,    37,    38,    39,   167,    -1,
+      -1,    -1,    -1,   660,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   872,    -1,    -1,    -1,    -1,   684,    -1,   143,    -1,
+     392,   393,    -1,    -1,   692,    -1,    -1,   684,    -1,    71,
+     402,    -1,    -1,    75,   159,   692,    -1,    -1,    80,    81,
+      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
+     109,   110,   111,   112,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   730,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   730,    -1,   936,    -1,   136,   137,    -1,
+      -1,   942,    -1,   455,   456,   457,    -1,    -1,   147,   148,
+     149,   150,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   143,   161,   162,   163,   164,   165,   166,   167,    -1,
+     482,    -1,    -1,    -1,   486,    -1,   488,   159,    -1,    -1,
+     492,   789,    -1,    -1,   496,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   789,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   528,   825,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   825,    -1,
+      -1,    -1,     0,     1,    -1,     3,     4,     5,     6,    -1,
+       8,     9,    10,    11,    12,    13,    14,    15,    16,    17,
+      18,    -1,    -1,    21,    22,    23,    24,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    32,    33,    -1,    -1,    -1,    -1,
+      -1,    -1,    40,    -1,    -1,   872,    -1,    -1,    46,    47,
+      -1,    -1,    -1,    -1,    -1,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,    64,    65,    -1,    67,
+      68,    69,    70,    71,    72,    73,    -1,    75,    -1,    -1,
+      78,    79,    -1,    81,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   936,    -1,
+      -1,    -1,    -1,    -1,   942,    -1,    -1,    -1,    -1,   936,
+      -1,    -1,    -1,    -1,    -1,   942,    -1,    -1,   660,   117,
+     118,   119,   120,   121,   122,   123,   124,   125,   126,   127,
+     128,   129,   130,   131,   132,   133,   134,   135,    -1,    -1,
+     138,   139,   140,   141,   142,   143,    -1,    -1,    -1,   691,
+     148,    -1,    -1,    -1,    -1,     1,    -1,     3,   700,    -1,
+     158,    -1,    -1,   161,   162,    -1,    -1,    -1,    -1,    -1,
+     168,   169,    -1,    19,   172,    -1,    22,    23,    24,    25,
+      26,   179,    -1,    29,    30,    31,    -1,    33,    34,    35,
+      36,    37,    38,    39,    85,    -1,    87,    88,    89,    90,
+      91,    92,    93,    94,    95,    96,    97,    98,    99,   100,
+     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,    -1,    71,    -1,    -1,    -1,    75,
+      -1,    -1,    -1,    -1,    80,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   136,   137,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   147,   148,   149,   150,
+     151,   152,   153,   154,   155,   156,    -1,    -1,   159,   160,
+     161,   162,   163,   164,   165,   166,   167,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   828,   829,   830,   831,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   143,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,     0,     1,   159,     3,    -1,     5,     6,   860,     8,
+       9,    10,    11,    12,    13,    14,    15,    16,    17,    18,
+     872,    -1,    21,    22,    23,    24,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    32,    33,    -1,    -1,    -1,    -1,    -1,
+      -1,    40,    -1,    -1,    -1,    -1,    -1,    46,    47,    -1,
+      -1,   903,    -1,    -1,    53,    54,    55,    56,    57,    58,
+      59,    60,    61,    62,    63,    64,    65,    -1,    67,    68,
+      69,    70,    71,    72,    73,    -1,    75,    -1,    -1,    78,
+      79,    -1,    81,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   117,   118,
+     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
+     129,   130,   131,   132,   133,   134,   135,    -1,    -1,   138,
+     139,   140,   141,   142,   143,    -1,    -1,    -1,    -1,   148,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   158,
+      -1,    -1,   161,   162,    -1,    -1,    -1,    -1,    -1,   168,
+     169,    -1,    -1,   172,     1,    -1,     3,    -1,     5,     6,
+     179,     8,     9,    10,    -1,    -1,    -1,    -1,    -1,    -1,
+      17,    18,    -1,    -1,    21,    22,    23,    24,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    32,    33,    -1,    -1,    -1,
+      -1,    -1,    -1,    40,    -1,    -1,    -1,    -1,    -1,    46,
+      47,    -1,    -1,    -1,    -1,    -1,    53,    54,    55,    56,
+      57,    58,    59,    60,    61,    62,    63,    64,    65,    -1,
+      67,    68,    69,    70,    71,    72,    73,    74,    75,    -1,
+      -1,    78,    79,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     117,   118,   119,   120,   121,   122,   123,   124,   125,   126,
+     127,   128,   129,   130,   131,   132,   133,   134,   135,    -1,
+      -1,   138,   139,   140,   141,   142,   143,    -1,    -1,    -1,
+      -1,   148,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   158,    -1,    -1,   161,   162,    -1,    -1,    -1,    -1,
+      -1,   168,   169,    -1,    -1,   172,     1,    -1,     3,    -1,
+       5,     6,   179,     8,     9,    10,    -1,    -1,    -1,    -1,
+      -1,    -1,    17,    18,    -1,    -1,    21,    22,    23,    24,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    32,    33,    -1,
+      -1,    -1,    -1,    -1,    -1,    40,    -1,    -1,    -1,    -1,
+      -1,    46,    47,    -1,    -1,    -1,    -1,    -1,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    -1,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    -1,    -1,    78,    79,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,    -1,    -1,   138,   139,   140,   141,   142,   143,    -1,
+      -1,    -1,    -1,   148,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   158,    -1,    -1,   161,   162,    -1,    -1,
+      -1,    -1,    -1,   168,   169,    -1,     3,   172,     5,     6,
+      -1,     8,     9,    10,   179,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    22,    23,    24,    25,    26,
+      27,    28,    -1,    -1,    -1,    32,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    46,
+      -1,    -1,    -1,    -1,    -1,    -1,    53,    54,    55,    56,
+      57,    58,    59,    60,    61,    62,    63,    -1,    -1,    -1,
+      -1,    -1,    69,    -1,    71,    -1,    -1,    -1,    75,    -1,
+      -1,    78,    79,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     117,   118,   119,   120,   121,   122,   123,   124,   125,   126,
+     127,   128,   129,   130,   131,   132,   133,   134,    -1,    -1,
+      -1,   138,   139,   140,   141,   142,    -1,    -1,    -1,    -1,
+      -1,   148,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   158,    -1,    -1,   161,   162,    -1,    -1,    -1,    -1,
+      -1,   168,   169,    -1,     3,   172,     5,     6,    -1,     8,
+       9,    10,   179,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    22,    23,    24,    25,    26,    27,    28,
+      -1,    -1,    -1,    32,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    46,    -1,    -1,
+      -1,    -1,    -1,    -1,    53,    54,    55,    56,    57,    58,
+      59,    60,    61,    62,    63,    -1,    -1,    -1,    -1,    -1,
+      69,    -1,    71,    -1,    -1,    -1,    75,    -1,    -1,    78,
+      79,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   117,   118,
+     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
+     129,   130,   131,   132,   133,   134,    -1,    -1,    -1,   138,
+     139,   140,   141,   142,    -1,    -1,    -1,    -1,    -1,   148,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   158,
+      -1,    -1,   161,   162,    -1,    -1,    -1,    -1,    -1,   168,
+     169,    -1,     3,   172,     5,     6,    -1,     8,     9,    10,
+     179,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    22,    23,    24,    25,    26,    27,    28,    -1,    -1,
+      -1,    32,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    46,    -1,    -1,    -1,    -1,
+      -1,    -1,    53,    54,    55,    56,    57,    58,    59,    60,
+      61,    62,    63,    -1,    -1,    -1,    -1,    -1,    69,    -1,
+      71,    -1,    -1,    -1,    75,    -1,    -1,    78,    79,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   117,   118,   119,   120,
+     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+     131,   132,   133,   134,    -1,    -1,    -1,   138,   139,   140,
+     141,   142,    -1,    -1,    -1,    -1,    -1,   148,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   158,    -1,    -1,
+     161,   162,    -1,    -1,    -1,    -1,    -1,   168,   169,    -1,
+       3,   172,     5,     6,    -1,     8,     9,    10,   179,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    22,
+      23,    24,    25,    26,    27,    28,    -1,    -1,    -1,    32,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    46,    -1,    -1,    -1,    -1,    -1,    -1,
+      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
+      63,    -1,    -1,    -1,    -1,    -1,    69,    -1,    71,    -1,
+      -1,    -1,    75,    -1,    -1,    78,    79,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   117,   118,   119,   120,   121,   122,
+     123,   124,   125,   126,   127,   128,   129,   130,   131,   132,
+     133,   134,    -1,    -1,    -1,   138,   139,   140,   141,   142,
+      -1,    -1,    -1,    -1,    -1,   148,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   158,    -1,    -1,   161,   162,
+      -1,    -1,    -1,    -1,    -1,   168,   169,    -1,     3,   172,
+       5,     6,    -1,     8,     9,    10,   179,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    22,    23,    24,
+      25,    26,    27,    28,    -1,    -1,    -1,    32,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    46,    -1,    -1,    -1,    -1,    -1,    -1,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    -1,
+      -1,    -1,    -1,    -1,    69,    -1,    71,    -1,    -1,    -1,
+      75,    -1,    -1,    78,    79,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+      -1,    -1,    -1,   138,   139,   140,   141,   142,    -1,    -1,
+      -1,    -1,    -1,   148,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   158,    -1,    -1,   161,   162,    -1,    -1,
+      -1,    -1,    -1,   168,   169,    -1,     3,   172,     5,     6,
+      -1,     8,     9,    10,   179,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    22,    23,    24,    25,    26,
+      27,    28,    -1,    -1,    -1,    32,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    46,
+      -1,    -1,    -1,    -1,    -1,    -1,    53,    54,    55,    56,
+      57,    58,    59,    60,    61,    62,    63,    -1,    -1,    -1,
+      -1,    -1,    69,    -1,    71,    -1,    -1,    -1,     1,    -1,
+       3,    78,    79,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    19,    -1,    -1,    22,
+      23,    24,    25,    26,    -1,    -1,    29,    30,    31,    -1,
+      33,    34,    35,    36,    37,    38,    39,    -1,    -1,    -1,
+     117,   118,   119,   120,   121,   122,   123,   124,   125,   126,
+     127,   128,   129,   130,   131,   132,   133,   134,    -1,    -1,
+      -1,   138,   139,   140,   141,   142,    -1,    -1,    71,    -1,
+      -1,   148,    75,    -1,    -1,    -1,    -1,    80,    -1,    -1,
+      -1,   158,    -1,    -1,   161,   162,    -1,    -1,    -1,    -1,
+      -1,   168,   169,    -1,     3,   172,     5,     6,    -1,     8,
+       9,    10,   179,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    22,    23,    24,    -1,    -1,    -1,    -1,
+      -1,    -1,    31,    32,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    46,    -1,    -1,
+     143,    -1,    -1,    -1,    53,    54,    55,    56,    57,    58,
+      59,    60,    61,    62,    63,    -1,   159,    -1,    -1,    -1,
+      69,    -1,    71,    -1,    -1,    -1,    75,    -1,    -1,    78,
+      79,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   117,   118,
+     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
+     129,   130,   131,   132,   133,   134,    -1,    -1,    -1,   138,
+     139,   140,   141,   142,    -1,     3,    -1,     5,     6,   148,
+       8,     9,    10,    -1,    -1,    -1,    -1,    -1,    -1,   158,
+      -1,    -1,   161,   162,    22,    23,    24,    -1,    -1,   168,
+     169,    -1,    -1,   172,    32,    -1,    -1,    -1,    -1,   178,
+     179,    -1,    -1,    -1,    -1,    -1,    44,    45,    46,    -1,
+      -1,    -1,    -1,    -1,    -1,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,    -1,    -1,    -1,    -1,
+      -1,    69,    -1,    71,    -1,    -1,    -1,    75,    -1,    -1,
+      78,    79,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   117,
+     118,   119,   120,   121,   122,   123,   124,   125,   126,   127,
+     128,   129,   130,   131,   132,   133,   134,    -1,    -1,    -1,
+     138,   139,   140,   141,   142,    -1,     3,    -1,     5,     6,
+     148,     8,     9,    10,    -1,    -1,    -1,    -1,    -1,    -1,
+     158,    -1,    -1,   161,   162,    22,    23,    24,    -1,    -1,
+     168,   169,    -1,    -1,   172,    32,    -1,    -1,    -1,    -1,
+      -1,   179,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    46,
+      -1,    -1,    -1,    -1,    -1,    -1,    53,    54,    55,    56,
+      57,    58,    59,    60,    61,    62,    63,    -1,    -1,    -1,
+      -1,    -1,    69,    -1,    71,    -1,    -1,    -1,    -1,    -1,
+      -1,    78,    79,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    88,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     117,   118,   119,   120,   121,   122,   123,   124,   125,   126,
+     127,   128,   129,   130,   131,   132,   133,   134,    -1,    -1,
+      -1,   138,   139,   140,   141,   142,    -1,    -1,    -1,    -1,
+      -1,   148,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   158,    -1,    -1,   161,   162,    -1,    -1,    -1,    -1,
+      -1,   168,   169,    -1,   171,   172,    -1,    -1,    -1,    -1,
+      -1,     3,   179,     5,     6,     7,     8,     9,    10,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      22,    23,    24,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      32,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    46,    -1,    -1,    -1,    -1,    -1,
+      -1,    53,    54,    55,    56,    57,    58,    59,    60,    61,
+      62,    63,    -1,    -1,    -1,    -1,    -1,    69,    -1,    71,
+      -1,    -1,    -1,    -1,    -1,    -1,    78,    79,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   117,   118,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+     132,   133,   134,    -1,    -1,    -1,   138,   139,   140,   141,
+     142,    -1,    -1,    -1,    -1,    -1,   148,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   158,    -1,    -1,   161,
+     162,    -1,    -1,    -1,    -1,    -1,   168,   169,    -1,    -1,
+     172,   173,    -1,     3,    -1,     5,     6,   179,     8,     9,
+      10,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    22,    23,    24,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    32,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    46,    -1,    -1,    -1,
+      -1,    -1,    -1,    53,    54,    55,    56,    57,    58,    59,
+      60,    61,    62,    63,    -1,    -1,    66,    -1,    -1,    69,
+      -1,    71,    -1,    -1,    74,    -1,    -1,    -1,    78,    79,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   117,   118,   119,
+     120,   121,   122,   123,   124,   125,   126,   127,   128,   129,
+     130,   131,   132,   133,   134,    -1,    -1,    -1,   138,   139,
+     140,   141,   142,    -1,     3,    -1,     5,     6,   148,     8,
+       9,    10,    -1,    -1,    -1,    -1,    -1,    -1,   158,    -1,
+      -1,   161,   162,    22,    23,    24,    -1,    -1,   168,   169,
+      -1,    -1,   172,    32,    -1,    -1,    -1,    -1,    -1,   179,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    46,    -1,    -1,
+      -1,    -1,    -1,    -1,    53,    54,    55,    56,    57,    58,
+      59,    60,    61,    62,    63,    -1,    -1,    66,    -1,    -1,
+      69,    -1,    71,    -1,    -1,    74,    -1,    -1,    -1,    78,
+      79,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   117,   118,
+     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
+     129,   130,   131,   132,   133,   134,    -1,    -1,    -1,   138,
+     139,   140,   141,   142,    -1,     3,    -1,     5,     6,   148,
+       8,     9,    10,    -1,    -1,    -1,    -1,    -1,    -1,   158,
+      -1,    -1,   161,   162,    22,    23,    24,    -1,    -1,   168,
+     169,    -1,    -1,   172,    32,    -1,    -1,    -1,    -1,    -1,
+     179,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    46,    -1,
+      -1,    -1,    -1,    -1,    -1,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,    -1,    -1,    -1,    -1,
+      -1,    69,    -1,    71,    -1,    -1,    -1,    75,    -1,    -1,
+      78,    79,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   117,
+     118,   119,   120,   121,   122,   123,   124,   125,   126,   127,
+     128,   129,   130,   131,   132,   133,   134,    -1,    -1,    -1,
+     138,   139,   140,   141,   142,    -1,     3,    -1,     5,     6,
+     148,     8,     9,    10,    -1,    -1,    -1,    -1,    -1,    -1,
+     158,    -1,    -1,   161,   162,    22,    23,    24,    -1,    -1,
+     168,   169,    -1,    -1,   172,    32,    -1,    -1,    -1,    -1,
+      -1,   179,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    46,
+      -1,    -1,    -1,    -1,    -1,    -1,    53,    54,    55,    56,
+      57,    58,    59,    60,    61,    62,    63,    -1,    -1,    -1,
+      -1,    -1,    69,    -1,    71,    -1,    -1,    -1,    75,    -1,
+      -1,    78,    79,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     117,   118,   119,   120,   121,   122,   123,   124,   125,   126,
+     127,   128,   129,   130,   131,   132,   133,   134,    -1,    -1,
+      -1,   138,   139,   140,   141,   142,    -1,     3,    -1,     5,
+       6,   148,     8,     9,    10,    -1,    -1,    -1,    -1,    -1,
+      -1,   158,    -1,    -1,   161,   162,    22,    23,    24,    -1,
+      -1,   168,   169,    -1,    -1,   172,    32,    -1,    -1,    -1,
+      -1,    -1,   179,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      46,    -1,    -1,    -1,    -1,    -1,    -1,    53,    54,    55,
+      56,    57,    58,    59,    60,    61,    62,    63,    -1,    -1,
+      -1,    -1,    -1,    69,    -1,    71,    -1,    -1,    -1,    75,
+      -1,    -1,    78,    79,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   117,   118,   119,   120,   121,   122,   123,   124,   125,
+     126,   127,   128,   129,   130,   131,   132,   133,   134,    -1,
+      -1,    -1,   138,   139,   140,   141,   142,    -1,     3,    -1,
+       5,     6,   148,     8,     9,    10,    -1,    -1,    -1,    -1,
+      -1,    -1,   158,    -1,    -1,   161,   162,    22,    23,    24,
+      -1,    -1,   168,   169,    -1,    -1,   172,    32,    -1,    -1,
+      -1,    -1,    -1,   179,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    46,    -1,    -1,    -1,    -1,    -1,    -1,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    -1,
+      -1,    -1,    -1,    -1,    69,    -1,    71,    -1,    -1,    -1,
+      -1,    -1,    -1,    78,    79,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+      -1,    -1,    -1,   138,   139,   140,   141,   142,    -1,     3,
+      -1,     5,     6,   148,     8,     9,    10,    -1,    -1,    -1,
+      -1,    -1,    -1,   158,    -1,    -1,   161,   162,    22,    23,
+      24,    -1,    -1,   168,   169,    -1,   171,   172,    32,    -1,
+      -1,    -1,    -1,    -1,   179,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    46,    -1,    -1,    -1,    -1,    -1,    -1,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
+      -1,    -1,    -1,    -1,    -1,    69,    -1,    71,    -1,    -1,
+      -1,    -1,    -1,    -1,    78,    79,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   117,   118,   119,   120,   121,   122,   123,
+     124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
+     134,    -1,    -1,    -1,   138,   139,   140,   141,   142,    -1,
+       3,    -1,     5,     6,   148,     8,     9,    10,    -1,    -1,
+      -1,    -1,    -1,    -1,   158,    -1,    -1,   161,   162,    22,
+      23,    24,    -1,    -1,   168,   169,    -1,   171,   172,    32,
+      -1,    -1,    -1,    -1,    -1,   179,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    46,    -1,    -1,    -1,    -1,    -1,    -1,
+      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
+      63,    -1,    -1,    -1,    -1,    -1,    69,    -1,    71,    -1,
+      -1,    -1,    -1,    -1,    -1,    78,    79,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   117,   118,   119,   120,   121,   122,
+     123,   124,   125,   126,   127,   128,   129,   130,   131,   132,
+     133,   134,    -1,    -1,    -1,   138,   139,   140,   141,   142,
+      -1,     3,    -1,     5,     6,   148,     8,     9,    10,    -1,
+      -1,    -1,    -1,    -1,    -1,   158,    -1,    -1,   161,   162,
+      22,    23,    24,    -1,    -1,   168,   169,    -1,   171,   172,
+      32,    -1,    -1,    -1,    -1,    -1,   179,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    46,    -1,    -1,    -1,    -1,    -1,
+      -1,    53,    54,    55,    56,    57,    58,    59,    60,    61,
+      62,    63,    -1,    -1,    -1,    -1,    -1,    69,    -1,    71,
+      -1,    -1,    -1,    -1,    -1,    -1,    78,    79,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   117,   118,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+     132,   133,   134,    -1,    -1,    -1,   138,   139,   140,   141,
+     142,    -1,     3,    -1,     5,     6,   148,     8,     9,    10,
+      -1,    -1,    -1,    -1,    -1,    -1,   158,    -1,    -1,   161,
+     162,    22,    23,    24,    -1,    -1,   168,   169,    -1,   171,
+     172,    32,    -1,    -1,    -1,    -1,    -1,   179,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    46,    -1,    -1,    -1,    -1,
+      -1,    -1,    53,    54,    55,    56,    57,    58,    59,    60,
+      61,    62,    63,    -1,    -1,    -1,    -1,    -1,    69,    -1,
+      71,    -1,    -1,    -1,    -1,    -1,    -1,    78,    79,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   117,   118,   119,   120,
+     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+     131,   132,   133,   134,    -1,    -1,    -1,   138,   139,   140,
+     141,   142,    -1,     3,    -1,     5,     6,   148,     8,     9,
+      10,    -1,    -1,    -1,    -1,    -1,    -1,   158,    -1,    -1,
+     161,   162,    22,    23,    24,    -1,    -1,   168,   169,    -1,
+     171,   172,    32,    -1,    -1,    -1,    -1,    -1,   179,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    46,    -1,    -1,    -1,
+      -1,    -1,    -1,    53,    54,    55,    56,    57,    58,    59,
+      60,    61,    62,    63,    -1,    -1,    -1,    -1,    -1,    69,
+      -1,    71,    -1,    -1,    -1,    -1,    -1,    -1,    78,    79,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   117,   118,   119,
+     120,   121,   122,   123,   124,   125,   126,   127,   128,   129,
+     130,   131,   132,   133,   134,    -1,    -1,    -1,   138,   139,
+     140,   141,   142,    -1,     3,    -1,     5,     6,   148,     8,
+       9,    10,    -1,    -1,    -1,    -1,    -1,    -1,   158,    -1,
+      -1,   161,   162,    22,    23,    24,    -1,    -1,   168,   169,
+      -1,   171,   172,    32,    -1,    -1,    -1,    -1,    -1,   179,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    46,    -1,    -1,
+      -1,    -1,    -1,    -1,    53,    54,    55,    56,    57,    58,
+      59,    60,    61,    62,    63,    -1,    -1,    -1,    -1,    -1,
+      69,    -1,    71,    -1,    -1,    -1,    -1,    -1,    -1,    78,
+      79,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   117,   118,
+     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
+     129,   130,   131,   132,   133,   134,    -1,    -1,    -1,   138,
+     139,   140,   141,   142,    -1,     3,    -1,     5,     6,   148,
+       8,     9,    10,    -1,    -1,    -1,    -1,    -1,    -1,   158,
+      -1,    -1,   161,   162,    22,    23,    24,    -1,    -1,   168,
+     169,    -1,   171,   172,    32,    -1,    -1,    -1,    -1,    -1,
+     179,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    46,    -1,
+      -1,    -1,    -1,    -1,    -1,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,    -1,    -1,    -1,    -1,
+      -1,    69,    -1,    71,    -1,    -1,    -1,    -1,    -1,    -1,
+      78,    79,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   117,
+     118,   119,   120,   121,   122,   123,   124,   125,   126,   127,
+     128,   129,   130,   131,   132,   133,   134,    -1,    -1,    -1,
+     138,   139,   140,   141,   142,    -1,     3,    -1,     5,     6,
+     148,     8,     9,    10,    -1,    -1,    -1,    -1,    -1,    -1,
+     158,    -1,    -1,   161,   162,    22,    23,    24,    -1,    -1,
+     168,   169,    -1,   171,   172,    32,    -1,    -1,    -1,    -1,
+      -1,   179,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    46,
+      -1,    -1,    -1,    -1,    -1,    -1,    53,    54,    55,    56,
+      57,    58,    59,    60,    61,    62,    63,    -1,    -1,    -1,
+      -1,    -1,    69,    -1,    71,    -1,    -1,    -1,    -1,    -1,
+      -1,    78,    79,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     117,   118,   119,   120,   121,   122,   123,   124,   125,   126,
+     127,   128,   129,   130,   131,   132,   133,   134,    -1,    -1,
+      -1,   138,   139,   140,   141,   142,    -1,     3,    -1,     5,
+       6,   148,     8,     9,    10,    -1,    -1,    -1,    -1,    -1,
+      -1,   158,    -1,    -1,   161,   162,    22,    23,    24,    -1,
+      -1,   168,   169,    -1,   171,   172,    32,    -1,    -1,    -1,
+      -1,    -1,   179,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      46,    -1,    -1,    -1,    -1,    -1,    -1,    53,    54,    55,
+      56,    57,    58,    59,    60,    61,    62,    63,    -1,    -1,
+      -1,    -1,    -1,    69,    -1,    71,    -1,    -1,    -1,    -1,
+      -1,    -1,    78,    79,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   117,   118,   119,   120,   121,   122,   123,   124,   125,
+     126,   127,   128,   129,   130,   131,   132,   133,   134,    -1,
+      -1,    -1,   138,   139,   140,   141,   142,    -1,     3,    -1,
+       5,     6,   148,     8,     9,    10,    -1,    -1,    -1,    -1,
+      -1,    -1,   158,    -1,    -1,   161,   162,    22,    23,    24,
+      -1,    -1,   168,   169,    -1,   171,   172,    32,    -1,    -1,
+      -1,    -1,    -1,   179,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    46,    -1,    -1,    -1,    -1,    -1,    -1,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    -1,
+      -1,    -1,    -1,    -1,    69,    -1,    71,    -1,    -1,    -1,
+      -1,    -1,    -1,    78,    79,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+      -1,    -1,    -1,   138,   139,   140,   141,   142,    -1,     3,
+      -1,     5,     6,   148,     8,     9,    10,    -1,    -1,    -1,
+      -1,    -1,    -1,   158,    -1,    -1,   161,   162,    22,    23,
+      24,    -1,    -1,   168,   169,    -1,    -1,   172,    32,    -1,
+      -1,   176,    -1,    -1,   179,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    46,    -1,    -1,    -1,    -1,    -1,    -1,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
+      -1,    -1,    -1,    -1,    -1,    69,    -1,    71,    -1,    -1,
+      -1,    -1,    -1,    -1,    78,    79,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   117,   118,   119,   120,   121,   122,   123,
+     124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
+     134,    -1,    -1,    -1,   138,   139,   140,   141,   142,    -1,
+       3,    -1,     5,     6,   148,     8,     9,    10,    -1,    -1,
+      -1,    -1,    -1,    -1,   158,    -1,    -1,   161,   162,    22,
+      23,    24,    -1,    -1,   168,   169,    -1,    -1,   172,    32,
+      -1,    -1,   176,    -1,    -1,   179,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    46,    -1,    -1,    -1,    -1,    -1,    -1,
+      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
+      63,    -1,    -1,    -1,    -1,    -1,    69,    -1,    71,    -1,
+      -1,    -1,    -1,    -1,    -1,    78,    79,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   117,   118,   119,   120,   121,   122,
+     123,   124,   125,   126,   127,   128,   129,   130,   131,   132,
+     133,   134,    -1,    -1,    -1,   138,   139,   140,   141,   142,
+      -1,     3,    -1,     5,     6,   148,     8,     9,    10,    -1,
+      -1,    -1,    -1,    -1,    -1,   158,    -1,    -1,   161,   162,
+      22,    23,    24,    -1,    -1,   168,   169,    -1,    -1,   172,
+      32,    -1,    -1,   176,    -1,    -1,   179,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    46,    -1,    -1,    -1,    -1,    -1,
+      -1,    53,    54,    55,    56,    57,    58,    59,    60,    61,
+      62,    63,    -1,    -1,    -1,    -1,    -1,    69,    -1,    71,
+      -1,    -1,    -1,    -1,    -1,    -1,    78,    79,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   117,   118,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+     132,   133,   134,    -1,    -1,    -1,   138,   139,   140,   141,
+     142,    -1,     3,    -1,     5,     6,   148,     8,     9,    10,
+      -1,    -1,    -1,    -1,    -1,    -1,   158,    -1,    -1,   161,
+     162,    22,    23,    24,    -1,    -1,   168,   169,    -1,    -1,
+     172,    32,    -1,    -1,    -1,    -1,   178,   179,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    46,    -1,    -1,    -1,    -1,
+      -1,    -1,    53,    54,    55,    56,    57,    58,    59,    60,
+      61,    62,    63,    -1,    -1,    -1,    -1,    -1,    69,    -1,
+      71,    -1,    -1,    -1,    75,    -1,    -1,    78,    79,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   117,   118,   119,   120,
+     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+     131,   132,   133,   134,    -1,    -1,    -1,   138,   139,   140,
+     141,   142,    -1,     3,    -1,     5,     6,   148,     8,     9,
+      10,    -1,    -1,    -1,    -1,    -1,    -1,   158,    -1,    -1,
+     161,   162,    22,    23,    24,    -1,    -1,   168,   169,    -1,
+      -1,   172,    32,    -1,    -1,    -1,    -1,    -1,   179,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    46,    -1,    -1,    -1,
+      -1,    -1,    -1,    53,    54,    55,    56,    57,    58,    59,
+      60,    61,    62,    63,    -1,    -1,    -1,    -1,    -1,    69,
+      -1,    71,    -1,    -1,    -1,    75,    -1,    -1,    78,    79,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   117,   118,   119,
+     120,   121,   122,   123,   124,   125,   126,   127,   128,   129,
+     130,   131,   132,   133,   134,    -1,    -1,    -1,   138,   139,
+     140,   141,   142,    -1,     3,    -1,     5,     6,   148,     8,
+       9,    10,    -1,    -1,    -1,    -1,    -1,    -1,   158,    -1,
+      -1,   161,   162,    22,    23,    24,    -1,    -1,   168,   169,
+      -1,    -1,   172,    32,    -1,    -1,    -1,    -1,    -1,   179,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    46,    -1,    -1,
+      -1,    -1,    -1,    -1,    53,    54,    55,    56,    57,    58,
+      59,    60,    61,    62,    63,    -1,    -1,    -1,    -1,    -1,
+      69,    -1,    71,    -1,    -1,    -1,    -1,    -1,    -1,    78,
+      79,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   117,   118,
+     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
+     129,   130,   131,   132,   133,   134,   135,    -1,    -1,   138,
+     139,   140,   141,   142,    -1,     3,    -1,     5,     6,   148,
+       8,     9,    10,    -1,    -1,    -1,    -1,    -1,    -1,   158,
+      -1,    -1,   161,   162,    22,    23,    24,    -1,    -1,   168,
+     169,    -1,    -1,   172,    32,    -1,    -1,    -1,    -1,    -1,
+     179,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    46,    -1,
+      -1,    -1,    -1,    -1,    -1,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,    -1,    -1,    -1,    -1,
+      -1,    69,    -1,    71,    -1,    -1,    -1,    -1,    -1,    -1,
+      78,    79,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   117,
+     118,   119,   120,   121,   122,   123,   124,   125,   126,   127,
+     128,   129,   130,   131,   132,   133,   134,    -1,    -1,    -1,
+     138,   139,   140,   141,   142,    -1,     3,    -1,     5,     6,
+     148,     8,     9,    10,    -1,    -1,    -1,    -1,    -1,    -1,
+     158,    -1,    -1,   161,   162,    22,    23,    24,    -1,    -1,
+     168,   169,    -1,   171,   172,    32,    -1,    -1,    -1,    -1,
+      -1,   179,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    46,
+      -1,    -1,    -1,    -1,    -1,    -1,    53,    54,    55,    56,
+      57,    58,    59,    60,    61,    62,    63,    -1,    -1,    -1,
+      -1,    -1,    69,    -1,    71,    -1,    -1,    -1,    -1,    -1,
+      -1,    78,    79,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     117,   118,   119,   120,   121,   122,   123,   124,   125,   126,
+     127,   128,   129,   130,   131,   132,   133,   134,    -1,    -1,
+      -1,   138,   139,   140,   141,   142,    -1,     3,    -1,     5,
+       6,   148,     8,     9,    10,    -1,    -1,    -1,    -1,    -1,
+      -1,   158,    -1,    -1,   161,   162,    22,    23,    24,    -1,
+      -1,   168,   169,    -1,   171,   172,    32,    -1,    -1,    -1,
+      -1,    -1,   179,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      46,    -1,    -1,    -1,    -1,    -1,    -1,    53,    54,    55,
+      56,    57,    58,    59,    60,    61,    62,    63,    -1,    -1,
+      -1,    -1,    -1,    69,    -1,    71,    -1,    -1,    -1,    -1,
+      -1,    -1,    78,    79,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   117,   118,   119,   120,   121,   122,   123,   124,   125,
+     126,   127,   128,   129,   130,   131,   132,   133,   134,    -1,
+      -1,    -1,   138,   139,   140,   141,   142,    -1,     3,    -1,
+       5,     6,   148,     8,     9,    10,    -1,    -1,    -1,    -1,
+      -1,    -1,   158,    -1,    -1,   161,   162,    22,    23,    24,
+      -1,    -1,   168,   169,    -1,   171,   172,    32,    -1,    -1,
+      -1,    -1,    -1,   179,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    46,    -1,    -1,    -1,    -1,    -1,    -1,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    -1,
+      -1,    -1,    -1,    -1,    69,    -1,    71,    -1,    -1,    -1,
+      -1,    -1,    -1,    78,    79,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+      -1,    -1,    -1,   138,   139,   140,   141,   142,    -1,     3,
+      -1,     5,     6,   148,     8,     9,    10,    -1,    -1,    -1,
+      -1,    -1,    -1,   158,    -1,    -1,   161,   162,    22,    23,
+      24,    -1,    -1,   168,   169,    -1,   171,   172,    32,    -1,
+      -1,    -1,    -1,    -1,   179,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    46,    -1,    -1,    -1,    -1,    -1,    -1,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
+      -1,    -1,    -1,    -1,    -1,    69,    -1,    71,    -1,    -1,
+      -1,    -1,    -1,    -1,    78,    79,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   117,   118,   119,   120,   121,   122,   123,
+     124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
+     134,    -1,    -1,    -1,   138,   139,   140,   141,   142,    -1,
+       3,    -1,     5,     6,   148,     8,     9,    10,    -1,    -1,
+      -1,    -1,    -1,    -1,   158,    -1,    -1,   161,   162,    22,
+      23,    24,    -1,    -1,   168,   169,    -1,   171,   172,    32,
+      -1,    -1,    -1,    -1,    -1,   179,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    46,    -1,    -1,    -1,    -1,    -1,    -1,
+      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
+      63,    -1,    -1,    -1,    -1,    -1,    69,    -1,    71,    -1,
+      -1,    -1,    -1,    -1,    -1,    78,    79,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   117,   118,   119,   120,   121,   122,
+     123,   124,   125,   126,   127,   128,   129,   130,   131,   132,
+     133,   134,    -1,    -1,    -1,   138,   139,   140,   141,   142,
+      -1,     3,    -1,     5,     6,   148,     8,     9,    10,    -1,
+      -1,    -1,    -1,    -1,    -1,   158,    -1,    -1,   161,   162,
+      22,    23,    24,    -1,    -1,   168,   169,    -1,   171,   172,
+      32,    -1,    -1,    -1,    -1,    -1,   179,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    46,    -1,    -1,    -1,    -1,    -1,
+      -1,    53,    54,    55,    56,    57,    58,    59,    60,    61,
+      62,    63,    -1,    -1,    -1,    -1,    -1,    69,    -1,    71,
+      -1,    -1,    -1,    -1,    -1,    -1,    78,    79,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   117,   118,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+     132,   133,   134,    -1,    -1,    -1,   138,   139,   140,   141,
+     142,    -1,     3,    -1,     5,     6,   148,     8,     9,    10,
+      -1,    -1,    -1,    -1,    -1,    -1,   158,    -1,    -1,   161,
+     162,    22,    23,    24,    -1,    -1,   168,   169,    -1,   171,
+     172,    32,    -1,    -1,    -1,    -1,    -1,   179,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    46,    -1,    -1,    -1,    -1,
+      -1,    -1,    53,    54,    55,    56,    57,    58,    59,    60,
+      61,    62,    63,    -1,    -1,    -1,    -1,    -1,    69,    -1,
+      71,    -1,    -1,    -1,    -1,    -1,    -1,    78,    79,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   117,   118,   119,   120,
+     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+     131,   132,   133,   134,    -1,    -1,    -1,   138,   139,   140,
+     141,   142,    -1,     3,    -1,     5,     6,   148,     8,     9,
+      10,    -1,    -1,    -1,    -1,    -1,    -1,   158,    -1,    -1,
+     161,   162,    22,    23,    24,    -1,    -1,   168,   169,    -1,
+     171,   172,    32,    -1,    -1,    -1,    -1,    -1,   179,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    46,    -1,    -1,    -1,
+      -1,    -1,    -1,    53,    54,    55,    56,    57,    58,    59,
+      60,    61,    62,    63,    -1,    -1,    -1,    -1,    -1,    69,
+      -1,    71,    -1,    -1,    -1,    -1,    -1,    -1,    78,    79,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   117,   118,   119,
+     120,   121,   122,   123,   124,   125,   126,   127,   128,   129,
+     130,   131,   132,   133,   134,    -1,    -1,    -1,   138,   139,
+     140,   141,   142,    -1,     3,    -1,     5,     6,   148,     8,
+       9,    10,    -1,    -1,    -1,    -1,    -1,    -1,   158,    -1,
+      -1,   161,   162,    22,    23,    24,    -1,    -1,   168,   169,
+      -1,   171,   172,    32,    -1,    -1,    -1,    -1,    -1,   179,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    46,    -1,    -1,
+      -1,    -1,    -1,    -1,    53,    54,    55,    56,    57,    58,
+      59,    60,    61,    62,    63,    -1,    -1,    -1,    -1,    -1,
+      69,    -1,    71,    -1,    -1,    -1,    -1,    -1,    -1,    78,
+      79,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   117,   118,
+     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
+     129,   130,   131,   132,   133,   134,    -1,    -1,    -1,   138,
+     139,   140,   141,   142,    -1,     3,    -1,     5,     6,   148,
+       8,     9,    10,    -1,    -1,    -1,    -1,    -1,    -1,   158,
+      -1,    -1,   161,   162,    22,    23,    24,    -1,    -1,   168,
+     169,    -1,   171,   172,    32,    -1,    -1,    -1,    -1,    -1,
+     179,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    46,    -1,
+      -1,    -1,    -1,    -1,    -1,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,    -1,    -1,    -1,    -1,
+      -1,    69,    -1,    71,    -1,    -1,    -1,    -1,    -1,    -1,
+      78,    79,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   117,
+     118,   119,   120,   121,   122,   123,   124,   125,   126,   127,
+     128,   129,   130,   131,   132,   133,   134,    -1,    -1,    -1,
+     138,   139,   140,   141,   142,    -1,     3,    -1,     5,     6,
+     148,     8,     9,    10,    -1,    -1,    -1,    -1,    -1,    -1,
+     158,    -1,    -1,   161,   162,    22,    23,    24,    -1,    -1,
+     168,   169,    -1,   171,   172,    32,    -1,    -1,    -1,    -1,
+      -1,   179,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    46,
+      -1,    -1,    -1,    -1,    -1,    -1,    53,    54,    55,    56,
+      57,    58,    59,    60,    61,    62,    63,    -1,    -1,    -1,
+      -1,    -1,    69,    -1,    71,    -1,    -1,    -1,    -1,    -1,
+      -1,    78,    79,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     117,   118,   119,   120,   121,   122,   123,   124,   125,   126,
+     127,   128,   129,   130,   131,   132,   133,   134,    -1,    -1,
+      -1,   138,   139,   140,   141,   142,    -1,     3,    -1,     5,
+       6,   148,     8,     9,    10,    -1,    -1,    -1,    -1,    -1,
+      -1,   158,    -1,    -1,   161,   162,    22,    23,    24,    -1,
+      -1,   168,   169,    -1,   171,   172,    32,    -1,    -1,    -1,
+      -1,    -1,   179,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      46,    -1,    -1,    -1,    -1,    -1,    -1,    53,    54,    55,
+      56,    57,    58,    59,    60,    61,    62,    63,    -1,    -1,
+      -1,    -1,    -1,    69,    -1,    71,    -1,    -1,    -1,    -1,
+      -1,    -1,    78,    79,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   117,   118,   119,   120,   121,   122,   123,   124,   125,
+     126,   127,   128,   129,   130,   131,   132,   133,   134,    -1,
+      -1,    -1,   138,   139,   140,   141,   142,    -1,     3,    -1,
+       5,     6,   148,     8,     9,    10,    -1,    -1,    -1,    -1,
+      -1,    -1,   158,    -1,    -1,   161,   162,    22,    23,    24,
+      -1,    -1,   168,   169,    -1,   171,   172,    32,    -1,    -1,
+      -1,    -1,    -1,   179,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    46,    -1,    -1,    -1,    -1,    -1,    -1,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    -1,
+      -1,    -1,    -1,    -1,    69,    -1,    71,    -1,    -1,    -1,
+      -1,    -1,    -1,    78,    79,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+      -1,    -1,    -1,   138,   139,   140,   141,   142,    -1,     3,
+      -1,     5,     6,   148,     8,     9,    10,    -1,    -1,    -1,
+      -1,    -1,    -1,   158,    -1,    -1,   161,   162,    22,    23,
+      24,    -1,    -1,   168,   169,    -1,   171,   172,    32,    -1,
+      -1,    -1,    -1,    -1,   179,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    46,    -1,    -1,    -1,    -1,    -1,    -1,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
+      -1,    -1,    -1,    -1,    -1,    69,    -1,    71,    -1,    -1,
+      -1,    -1,    -1,    -1,    78,    79,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   117,   118,   119,   120,   121,   122,   123,
+     124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
+     134,    -1,    -1,    -1,   138,   139,   140,   141,   142,    -1,
+       3,    -1,     5,     6,   148,     8,     9,    10,    -1,    -1,
+      -1,    -1,    -1,    -1,   158,    -1,    -1,   161,   162,    22,
+      23,    24,    -1,    -1,   168,   169,    -1,   171,   172,    32,
+      -1,    -1,    -1,    -1,    -1,   179,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    46,    -1,    -1,    -1,    -1,    -1,    -1,
+      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
+      63,    -1,    -1,    -1,    -1,    -1,    69,    -1,    71,    -1,
+      -1,    -1,    -1,    -1,    -1,    78,    79,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   117,   118,   119,   120,   121,   122,
+     123,   124,   125,   126,   127,   128,   129,   130,   131,   132,
+     133,   134,    -1,    -1,    -1,   138,   139,   140,   141,   142,
+      -1,     3,    -1,     5,     6,   148,     8,     9,    10,    -1,
+      -1,    -1,    -1,    -1,    -1,   158,    -1,    -1,   161,   162,
+      22,    23,    24,    -1,    -1,   168,   169,    -1,   171,   172,
+      32,    -1,    -1,    -1,    -1,    -1,   179,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    46,    -1,    -1,    -1,    -1,    -1,
+      -1,    53,    54,    55,    56,    57,    58,    59,    60,    61,
+      62,    63,    -1,    -1,    -1,    -1,    -1,    69,    -1,    71,
+      -1,    -1,    -1,    -1,    -1,    -1,    78,    79,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   117,   118,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+     132,   133,   134,    -1,    -1,    -1,   138,   139,   140,   141,
+     142,    -1,     3,    -1,     5,     6,   148,     8,     9,    10,
+      -1,    -1,    -1,    -1,    -1,    -1,   158,    -1,    -1,   161,
+     162,    22,    23,    24,    -1,    -1,   168,   169,    -1,   171,
+     172,    32,    -1,    -1,    -1,    -1,    -1,   179,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    46,    -1,    -1,    -1,    -1,
+      -1,    -1,    53,    54,    55,    56,    57,    58,    59,    60,
+      61,    62,    63,    -1,    -1,    -1,    -1,    -1,    69,    -1,
+      71,    -1,    -1,    -1,    -1,    -1,    -1,    78,    79,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   117,   118,   119,   120,
+     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+     131,   132,   133,   134,    -1,    -1,    -1,   138,   139,   140,
+     141,   142,    -1,     3,    -1,     5,     6,   148,     8,     9,
+      10,    -1,    -1,    -1,    -1,    -1,    -1,   158,    -1,    -1,
+     161,   162,    22,    23,    24,    -1,    -1,   168,   169,    -1,
+     171,   172,    32,    -1,    -1,    -1,    -1,    -1,   179,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    46,    -1,    -1,    -1,
+      -1,    -1,    -1,    53,    54,    55,    56,    57,    58,    59,
+      60,    61,    62,    63,    -1,    -1,    -1,    -1,    -1,    69,
+      -1,    71,    -1,    -1,    -1,    -1,    -1,    -1,    78,    79,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   117,   118,   119,
+     120,   121,   122,   123,   124,   125,   126,   127,   128,   129,
+     130,   131,   132,   133,   134,    -1,    -1,    -1,   138,   139,
+     140,   141,   142,    -1,     3,    -1,     5,     6,   148,     8,
+       9,    10,    -1,    -1,    -1,    -1,    -1,    -1,   158,    -1,
+      -1,   161,   162,    22,    23,    24,    -1,    -1,   168,   169,
+      -1,   171,   172,    32,    -1,    -1,    -1,    -1,    -1,   179,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    46,    -1,    -1,
+      -1,    -1,    -1,    -1,    53,    54,    55,    56,    57,    58,
+      59,    60,    61,    62,    63,    -1,    -1,    -1,    -1,    -1,
+      69,    -1,    71,    -1,    -1,    -1,    -1,    -1,    -1,    78,
+      79,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   117,   118,
+     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
+     129,   130,   131,   132,   133,   134,    -1,    -1,    -1,   138,
+     139,   140,   141,   142,    -1,     3,    -1,     5,     6,   148,
+       8,     9,    10,    -1,    -1,    -1,    -1,    -1,    -1,   158,
+      -1,    -1,   161,   162,    22,    23,    24,    -1,    -1,   168,
+     169,    -1,   171,   172,    32,    -1,    -1,    -1,    -1,    -1,
+     179,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    46,    -1,
+      -1,    -1,    -1,    -1,    -1,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,    -1,    -1,    -1,    -1,
+      -1,    69,    -1,    71,    -1,    -1,    -1,    -1,    -1,    -1,
+      78,    79,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   117,
+     118,   119,   120,   121,   122,   123,   124,   125,   126,   127,
+     128,   129,   130,   131,   132,   133,   134,    -1,    -1,    -1,
+     138,   139,   140,   141,   142,    -1,     3,    -1,     5,     6,
+     148,     8,     9,    10,    -1,    -1,    -1,    -1,    -1,    -1,
+     158,    -1,    -1,   161,   162,    22,    23,    24,    -1,    -1,
+     168,   169,    -1,   171,   172,    32,    -1,    -1,    -1,    -1,
+      -1,   179,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    46,
+      -1,    -1,    -1,    -1,    -1,    -1,    53,    54,    55,    56,
+      57,    58,    59,    60,    61,    62,    63,    -1,    -1,    -1,
+      -1,    -1,    69,    -1,    71,    -1,    -1,    -1,    -1,    -1,
+      -1,    78,    79,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     117,   118,   119,   120,   121,   122,   123,   124,   125,   126,
+     127,   128,   129,   130,   131,   132,   133,   134,    -1,    -1,
+      -1,   138,   139,   140,   141,   142,    -1,     3,    -1,     5,
+       6,   148,     8,     9,    10,    -1,    -1,    -1,    -1,    -1,
+      -1,   158,    -1,    -1,   161,   162,    22,    23,    24,    -1,
+      -1,   168,   169,    -1,   171,   172,    32,    -1,    -1,    -1,
+      -1,    -1,   179,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      46,    -1,    -1,    -1,    -1,    -1,    -1,    53,    54,    55,
+      56,    57,    58,    59,    60,    61,    62,    63,    -1,    -1,
+      -1,    -1,    -1,    69,    -1,    71,    -1,    -1,    -1,    -1,
+      -1,    -1,    78,    79,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   117,   118,   119,   120,   121,   122,   123,   124,   125,
+     126,   127,   128,   129,   130,   131,   132,   133,   134,    -1,
+      -1,    -1,   138,   139,   140,   141,   142,    -1,     3,    -1,
+       5,     6,   148,     8,     9,    10,    -1,    -1,    -1,    -1,
+      -1,    -1,   158,    -1,    -1,   161,   162,    22,    23,    24,
+      -1,    -1,   168,   169,    -1,   171,   172,    32,    -1,    -1,
+      -1,    -1,    -1,   179,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    46,    -1,    -1,    -1,    -1,    -1,    -1,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    -1,
+      -1,    -1,    -1,    -1,    69,    -1,    71,    -1,    -1,    -1,
+      -1,    -1,    -1,    78,    79,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+      -1,    -1,    -1,   138,   139,   140,   141,   142,    -1,     3,
+      -1,     5,     6,   148,     8,     9,    10,    -1,    -1,    -1,
+      -1,    -1,    -1,   158,    -1,    -1,   161,   162,    22,    23,
+      24,    -1,    -1,   168,   169,    -1,   171,   172,    32,    -1,
+      -1,    -1,    -1,    -1,   179,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    46,    -1,    -1,    -1,    -1,    -1,    -1,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
+      -1,    -1,    -1,    -1,    -1,    69,    -1,    71,    -1,    -1,
+      -1,    -1,    -1,    -1,    78,    79,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   117,   118,   119,   120,   121,   122,   123,
+     124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
+     134,    -1,    -1,    -1,   138,   139,   140,   141,   142,    -1,
+       3,    -1,     5,     6,   148,     8,     9,    10,    -1,    -1,
+      -1,    -1,    -1,    -1,   158,    -1,    -1,   161,   162,    22,
+      23,    24,    -1,    -1,   168,   169,    -1,   171,   172,    32,
+      -1,    -1,    -1,    -1,    -1,   179,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    46,    -1,    -1,    -1,    -1,    -1,    -1,
+      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
+      63,    -1,    -1,    -1,    -1,    -1,    69,    -1,    71,    -1,
+      -1,    -1,    -1,    -1,    -1,    78,    79,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   117,   118,   119,   120,   121,   122,
+     123,   124,   125,   126,   127,   128,   129,   130,   131,   132,
+     133,   134,    -1,    -1,    -1,   138,   139,   140,   141,   142,
+      -1,     3,    -1,     5,     6,   148,     8,     9,    10,    -1,
+      -1,    -1,    -1,    -1,    -1,   158,    -1,    -1,   161,   162,
+      22,    23,    24,    -1,    -1,   168,   169,    -1,   171,   172,
+      32,    -1,    -1,    -1,    -1,    -1,   179,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    46,    -1,    -1,    -1,    -1,    -1,
+      -1,    53,    54,    55,    56,    57,    58,    59,    60,    61,
+      62,    63,    -1,    -1,    -1,    -1,    -1,    69,    -1,    71,
+      -1,    -1,    -1,    -1,    -1,    -1,    78,    79,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   117,   118,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+     132,   133,   134,    -1,    -1,    -1,   138,   139,   140,   141,
+     142,    -1,     3,    -1,     5,     6,   148,     8,     9,    10,
+      -1,    -1,    -1,    -1,    -1,    -1,   158,    -1,    -1,   161,
+     162,    22,    23,    24,    -1,    -1,   168,   169,    -1,   171,
+     172,    32,    -1,    -1,    -1,    -1,    -1,   179,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    46,    -1,    -1,    -1,    -1,
+      -1,    -1,    53,    54,    55,    56,    57,    58,    59,    60,
+      61,    62,    63,    -1,    -1,    -1,    -1,    -1,    69,    -1,
+      71,    -1,    -1,    -1,    -1,    -1,    -1,    78,    79,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   117,   118,   119,   120,
+     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+     131,   132,   133,   134,    -1,    -1,    -1,   138,   139,   140,
+     141,   142,    -1,     3,    -1,     5,     6,   148,     8,     9,
+      10,    -1,    -1,    -1,    -1,    -1,    -1,   158,    -1,    -1,
+     161,   162,    22,    23,    24,    -1,    -1,   168,   169,    -1,
+     171,   172,    32,    -1,    -1,    -1,    -1,    -1,   179,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    46,    -1,    -1,    -1,
+      -1,    -1,    -1,    53,    54,    55,    56,    57,    58,    59,
+      60,    61,    62,    63,    -1,    -1,    -1,    -1,    -1,    69,
+      -1,    71,    -1,    -1,    -1,    -1,    -1,    -1,    78,    79,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   117,   118,   119,
+     120,   121,   122,   123,   124,   125,   126,   127,   128,   129,
+     130,   131,   132,   133,   134,    -1,    -1,    -1,   138,   139,
+     140,   141,   142,    -1,     3,    -1,     5,     6,   148,     8,
+       9,    10,    -1,    -1,    -1,    -1,    -1,    -1,   158,    -1,
+      -1,   161,   162,    22,    23,    24,    -1,    -1,   168,   169,
+      -1,   171,   172,    32,    -1,    -1,    -1,    -1,    -1,   179,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    46,    -1,    -1,
+      -1,    -1,    -1,    -1,    53,    54,    55,    56,    57,    58,
+      59,    60,    61,    62,    63,    -1,    -1,    -1,    -1,    -1,
+      69,    -1,    71,    -1,    -1,    -1,    -1,    -1,    -1,    78,
+      79,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   117,   118,
+     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
+     129,   130,   131,   132,   133,   134,    -1,    -1,    -1,   138,
+     139,   140,   141,   142,    -1,     3,    -1,     5,     6,   148,
+       8,     9,    10,    -1,    -1,    -1,    -1,    -1,    -1,   158,
+      -1,    -1,   161,   162,    22,    23,    24,    -1,    -1,   168,
+     169,    -1,   171,   172,    32,    -1,    -1,    -1,    -1,    -1,
+     179,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    46,    -1,
+      -1,    -1,    -1,    -1,    -1,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,    -1,    -1,    -1,    -1,
+      -1,    69,    -1,    71,    -1,    -1,    -1,    -1,    -1,    -1,
+      78,    79,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   117,
+     118,   119,   120,   121,   122,   123,   124,   125,   126,   127,
+     128,   129,   130,   131,   132,   133,   134,    -1,    -1,    -1,
+     138,   139,   140,   141,   142,    -1,     3,    -1,     5,     6,
+     148,     8,     9,    10,    -1,    -1,    -1,    -1,    -1,    -1,
+     158,    -1,    -1,   161,   162,    22,    23,    24,    -1,    -1,
+     168,   169,    -1,   171,   172,    32,    -1,    -1,    -1,    -1,
+      -1,   179,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    46,
+      -1,    -1,    -1,    -1,    -1,    -1,    53,    54,    55,    56,
+      57,    58,    59,    60,    61,    62,    63,    -1,    -1,    -1,
+      -1,    -1,    69,    -1,    71,    -1,    -1,    -1,    -1,    -1,
+      -1,    78,    79,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     117,   118,   119,   120,   121,   122,   123,   124,   125,   126,
+     127,   128,   129,   130,   131,   132,   133,   134,    -1,    -1,
+      -1,   138,   139,   140,   141,   142,    -1,     3,    -1,     5,
+       6,   148,     8,     9,    10,    -1,    -1,    -1,    -1,    -1,
+      -1,   158,    -1,    -1,   161,   162,    22,    23,    24,    -1,
+      -1,   168,   169,    -1,   171,   172,    32,    -1,    -1,    -1,
+      -1,    -1,   179,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      46,    -1,    -1,    -1,    -1,    -1,    -1,    53,    54,    55,
+      56,    57,    58,    59,    60,    61,    62,    63,    -1,    -1,
+      -1,    -1,    -1,    69,    -1,    71,    -1,    -1,    -1,    -1,
+      -1,    -1,    78,    79,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   117,   118,   119,   120,   121,   122,   123,   124,   125,
+     126,   127,   128,   129,   130,   131,   132,   133,   134,    -1,
+      -1,    -1,   138,   139,   140,   141,   142,    -1,     3,    -1,
+       5,     6,   148,     8,     9,    10,    -1,    -1,    -1,    -1,
+      -1,    -1,   158,    -1,    -1,   161,   162,    22,    23,    24,
+      -1,    -1,   168,   169,    -1,   171,   172,    32,    -1,    -1,
+      -1,    -1,    -1,   179,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    46,    -1,    -1,    -1,    -1,    -1,    -1,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    -1,
+      -1,    -1,    -1,    -1,    69,    -1,    71,    -1,    -1,    -1,
+      -1,    -1,    -1,    78,    79,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+      -1,    -1,    -1,   138,   139,   140,   141,   142,    -1,     3,
+      -1,     5,     6,   148,     8,     9,    10,    -1,    -1,    -1,
+      -1,    -1,    -1,   158,    -1,    -1,   161,   162,    22,    23,
+      24,    -1,    -1,   168,   169,    -1,   171,   172,    32,    -1,
+      -1,    -1,    -1,    -1,   179,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    46,    -1,    -1,    -1,    -1,    -1,    -1,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
+      -1,    -1,    -1,    -1,    -1,    69,    -1,    71,    -1,    -1,
+      -1,    -1,    -1,    -1,    78,    79,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   117,   118,   119,   120,   121,   122,   123,
+     124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
+     134,    -1,    -1,    -1,   138,   139,   140,   141,   142,    -1,
+      -1,    -1,    -1,    -1,   148,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   158,    -1,    -1,   161,   162,    -1,
+      -1,    -1,    -1,    -1,   168,   169,    -1,    -1,   172,   173,
+      -1,     3,    -1,     5,     6,   179,     8,     9,    10,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      22,    23,    24,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      32,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    46,    -1,    -1,    -1,    -1,    -1,
+      -1,    53,    54,    55,    56,    57,    58,    59,    60,    61,
+      62,    63,    -1,    -1,    -1,    -1,    -1,    69,    -1,    71,
+      -1,    -1,    -1,    -1,    -1,    -1,    78,    79,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   117,   118,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+     132,   133,   134,    -1,    -1,    -1,   138,   139,   140,   141,
+     142,    -1,     3,    -1,     5,     6,   148,     8,     9,    10,
+      -1,    -1,    -1,    -1,    -1,    -1,   158,    -1,    -1,   161,
+     162,    22,    23,    24,    -1,    -1,   168,   169,    -1,    -1,
+     172,    32,    -1,    -1,    -1,    -1,   178,   179,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    46,    -1,    -1,    -1,    -1,
+      -1,    -1,    53,    54,    55,    56,    57,    58,    59,    60,
+      61,    62,    63,    -1,    -1,    -1,    -1,    -1,    69,    -1,
+      71,    -1,    -1,    -1,    -1,    -1,    -1,    78,    79,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   117,   118,   119,   120,
+     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+     131,   132,   133,   134,    -1,    -1,    -1,   138,   139,   140,
+     141,   142,    -1,     3,    -1,     5,     6,   148,     8,     9,
+      10,    -1,    -1,    -1,    -1,    -1,    -1,   158,    -1,    -1,
+     161,   162,    22,    23,    24,    -1,    -1,   168,   169,    -1,
+      -1,   172,    32,    -1,    -1,    -1,    -1,   178,   179,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    46,    -1,    -1,    -1,
+      -1,    -1,    -1,    53,    54,    55,    56,    57,    58,    59,
+      60,    61,    62,    63,    -1,    -1,    -1,    -1,    -1,    69,
+      -1,    71,    -1,    -1,    -1,    -1,    -1,    -1,    78,    79,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   117,   118,   119,
+     120,   121,   122,   123,   124,   125,   126,   127,   128,   129,
+     130,   131,   132,   133,   134,    -1,    -1,    -1,   138,   139,
+     140,   141,   142,    -1,     3,    -1,     5,     6,   148,     8,
+       9,    10,    -1,    -1,    -1,    -1,    -1,    -1,   158,    -1,
+     160,   161,   162,    22,    23,    24,    -1,    -1,   168,   169,
+      -1,    -1,   172,    32,    -1,    -1,    -1,    -1,    -1,   179,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    46,    -1,    -1,
+      -1,    -1,    -1,    -1,    53,    54,    55,    56,    57,    58,
+      59,    60,    61,    62,    63,    -1,    -1,    -1,    -1,    -1,
+      69,    -1,    71,    -1,    -1,    -1,    -1,    -1,    -1,    78,
+      79,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   117,   118,
+     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
+     129,   130,   131,   132,   133,   134,    -1,    -1,    -1,   138,
+     139,   140,   141,   142,    -1,     3,    -1,     5,     6,   148,
+       8,     9,    10,    -1,    -1,    -1,    -1,    -1,    -1,   158,
+      -1,    -1,   161,   162,    22,    23,    24,    -1,    -1,   168,
+     169,    -1,   171,   172,    32,    -1,    -1,    -1,    -1,    -1,
+     179,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    46,    -1,
+      -1,    -1,    -1,    -1,    -1,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,    -1,    -1,    -1,    -1,
+      -1,    69,    -1,    71,    -1,    -1,    -1,    -1,    -1,    -1,
+      78,    79,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   117,
+     118,   119,   120,   121,   122,   123,   124,   125,   126,   127,
+     128,   129,   130,   131,   132,   133,   134,    -1,    -1,    -1,
+     138,   139,   140,   141,   142,    -1,    -1,    -1,    -1,    -1,
+     148,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     158,    -1,    -1,   161,   162,    -1,    -1,    -1,    -1,    -1,
+     168,   169,    -1,    -1,   172,   173,    -1,     3,    -1,     5,
+       6,   179,     8,     9,    10,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    22,    23,    24,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    32,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      46,    -1,    -1,    -1,    -1,    -1,    -1,    53,    54,    55,
+      56,    57,    58,    59,    60,    61,    62,    63,    -1,    -1,
+      66,    -1,    -1,    69,    -1,    71,    -1,    -1,    -1,     1,
+      -1,     3,    78,    79,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    20,    -1,
+      22,    23,    24,    25,    26,    -1,    -1,    29,    30,    31,
+      -1,    33,    34,    35,    36,    37,    38,    39,    -1,    -1,
+      -1,   117,   118,   119,   120,   121,   122,   123,   124,   125,
+     126,   127,   128,   129,   130,   131,   132,   133,   134,    -1,
+      -1,    -1,   138,   139,   140,   141,   142,    -1,    -1,    71,
+      -1,    -1,   148,    75,    -1,    -1,    -1,    -1,    80,    -1,
+      -1,    -1,   158,    -1,    -1,   161,   162,    -1,    -1,    -1,
+      -1,    -1,   168,   169,    -1,     3,   172,     5,     6,     7,
+       8,     9,    10,   179,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    22,    23,    24,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    32,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    46,    -1,
+      -1,   143,    -1,    -1,    -1,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,    -1,   159,    -1,    -1,
+      -1,    69,    -1,    71,    -1,    -1,    -1,    -1,    -1,    -1,
+      78,    79,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   117,
+     118,   119,   120,   121,   122,   123,   124,   125,   126,   127,
+     128,   129,   130,   131,   132,   133,   134,    -1,    -1,    -1,
+     138,   139,   140,   141,   142,    -1,     3,    -1,     5,     6,
+     148,     8,     9,    10,    -1,    -1,    -1,    -1,    -1,    -1,
+     158,    -1,    -1,   161,   162,    22,    23,    24,    -1,    -1,
+     168,   169,    -1,    -1,   172,    32,    -1,    -1,    -1,    -1,
+      -1,   179,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    46,
+      -1,    -1,    -1,    -1,    -1,    -1,    53,    54,    55,    56,
+      57,    58,    59,    60,    61,    62,    63,    -1,    -1,    -1,
+      -1,    -1,    69,    -1,    71,    -1,    -1,    -1,    -1,    -1,
+      -1,    78,    79,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     117,   118,   119,   120,   121,   122,   123,   124,   125,   126,
+     127,   128,   129,   130,   131,   132,   133,   134,    -1,    -1,
+      -1,   138,   139,   140,   141,   142,    -1,    -1,    -1,    -1,
+      -1,   148,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   158,    -1,    -1,   161,   162,    -1,    -1,    -1,    -1,
+      -1,   168,   169,    -1,    -1,   172,   173,    -1,     3,    -1,
+       5,     6,   179,     8,     9,    10,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    22,    23,    24,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    32,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    46,    -1,    -1,    -1,    -1,    -1,    -1,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    -1,
+      -1,    -1,    -1,    -1,    69,    -1,    71,    -1,    -1,    -1,
+      -1,    -1,    -1,    78,    79,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+      -1,    -1,    -1,   138,   139,   140,   141,   142,    -1,     3,
+      -1,     5,     6,   148,     8,     9,    10,    -1,    -1,    -1,
+      -1,    -1,    -1,   158,    -1,    -1,   161,   162,    22,    23,
+      24,    -1,    -1,   168,   169,    -1,    -1,   172,    32,    -1,
+      -1,    -1,    -1,    -1,   179,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    46,    -1,    -1,    -1,    -1,    -1,    -1,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
+      -1,    -1,    -1,    -1,    -1,    69,    -1,    71,    -1,    -1,
+      -1,    -1,    -1,    -1,    78,    79,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   117,   118,   119,   120,   121,   122,   123,
+     124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
+     134,    -1,    -1,    -1,   138,   139,   140,   141,   142,    -1,
+       3,    -1,     5,     6,   148,     8,     9,    10,    -1,    -1,
+      -1,    -1,    -1,    -1,   158,    -1,    -1,   161,   162,    22,
+      23,    24,    -1,    -1,   168,   169,    -1,    -1,   172,    32,
+      -1,    -1,    -1,    -1,    -1,   179,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    46,    -1,    -1,    -1,    -1,    -1,    -1,
+      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
+      63,    -1,    -1,    -1,    -1,    -1,    69,    -1,    71,    -1,
+      -1,    -1,    -1,    -1,    -1,    78,    79,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   117,   118,   119,   120,   121,   122,
+     123,   124,   125,   126,   127,   128,   129,   130,   131,   132,
+     133,   134,    -1,    -1,    -1,   138,   139,   140,   141,   142,
+      -1,     3,    -1,     5,     6,   148,     8,     9,    10,    -1,
+      -1,    -1,    -1,    -1,    -1,   158,    -1,    -1,   161,   162,
+      22,    23,    24,    -1,    -1,   168,   169,    -1,    -1,   172,
+      32,    -1,    -1,    -1,    -1,    -1,   179,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    46,    -1,    -1,    -1,    -1,    -1,
+      -1,    53,    54,    55,    56,    57,    58,    59,    60,    61,
+      62,    63,    -1,    -1,    -1,    -1,    -1,    69,    -1,    71,
+      -1,    -1,    -1,    -1,    -1,    -1,    78,    79,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   117,   118,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+     132,   133,   134,    -1,    -1,    -1,   138,   139,   140,   141,
+     142,    -1,     3,    -1,     5,     6,   148,     8,     9,    10,
+      -1,    -1,    -1,    -1,    -1,    -1,   158,    -1,    -1,   161,
+     162,    22,    23,    24,    -1,    -1,   168,   169,    -1,    -1,
+     172,    32,    -1,    -1,    -1,    -1,    -1,   179,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    46,    -1,    -1,    -1,    -1,
+      -1,    -1,    53,    54,    55,    56,    57,    58,    59,    60,
+      61,    62,    63,    -1,    -1,    -1,    -1,    -1,    69,    -1,
+      71,    -1,     1,    -1,     3,    -1,    -1,    78,    79,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    22,    23,    24,    25,    26,    -1,    -1,
+      29,    30,    31,    -1,    33,    34,    35,    36,    37,    38,
+      39,    -1,    -1,    -1,    -1,    -1,   117,   118,   119,   120,
+     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+     131,   132,   133,   134,    -1,    -1,    -1,   138,   139,   140,
+     141,   142,    71,    -1,    -1,    -1,    75,   148,    -1,    -1,
+      -1,    80,    -1,    -1,    -1,    -1,    -1,   158,    -1,    -1,
+     161,   162,    -1,    -1,    -1,    -1,    -1,   168,   169,    -1,
+      -1,   172,    -1,    -1,    -1,    -1,    -1,    -1,   179,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      42,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   143,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     159,    83,    84,    85,    86,    87,    88,    89,    90,    91,
+      92,    93,    94,    95,    96,    97,    98,    99,   100,   101,
+     102,   103,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   136,   137,    43,    -1,    -1,    -1,
+      -1,    -1,    -1,   145,    -1,   147,   148,   149,   150,   151,
+     152,   153,   154,   155,   156,    -1,    -1,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,    -1,    -1,    75,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    83,    84,    85,    86,
+      87,    88,    89,    90,    91,    92,    93,    94,    95,    96,
+      97,    98,    99,   100,   101,   102,   103,   104,   105,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    48,    -1,    -1,   136,
+     137,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   145,    -1,
+     147,   148,   149,   150,   151,   152,   153,   154,   155,   156,
+      -1,    -1,   159,   160,   161,   162,   163,   164,   165,   166,
+     167,    83,    84,    85,    86,    87,    88,    89,    90,    91,
+      92,    93,    94,    95,    96,    97,    98,    99,   100,   101,
+     102,   103,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   136,   137,    -1,    -1,    -1,    -1,
+      -1,    -1,    51,   145,    -1,   147,   148,   149,   150,   151,
+     152,   153,   154,   155,   156,    -1,    -1,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,    75,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    83,    84,    85,    86,    87,    88,
+      89,    90,    91,    92,    93,    94,    95,    96,    97,    98,
+      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
+     109,   110,   111,   112,   113,   114,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   136,   137,    51,
+      -1,    -1,    -1,    -1,    -1,    -1,   145,    -1,   147,   148,
+     149,   150,   151,   152,   153,   154,   155,   156,    -1,    -1,
+     159,   160,   161,   162,   163,   164,   165,   166,   167,    -1,
+      -1,    83,    84,    85,    86,    87,    88,    89,    90,    91,
+      92,    93,    94,    95,    96,    97,    98,    99,   100,   101,
+     102,   103,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   136,   137,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   145,    -1,   147,   148,   149,   150,   151,
+     152,   153,   154,   155,   156,    -1,    -1,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,    75,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    83,    84,    85,    86,    87,    88,
+      89,    90,    91,    92,    93,    94,    95,    96,    97,    98,
+      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
+     109,   110,   111,   112,   113,   114,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   136,   137,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   145,    -1,   147,   148,
+     149,   150,   151,   152,   153,   154,   155,   156,    -1,    -1,
+     159,   160,   161,   162,   163,   164,   165,   166,   167,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   175,    83,    84,    85,
+      86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
+      96,    97,    98,    99,   100,   101,   102,   103,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     136,   137,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   145,
+      -1,   147,   148,   149,   150,   151,   152,   153,   154,   155,
+     156,    -1,    -1,   159,   160,   161,   162,   163,   164,   165,
+     166,   167,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   177,    83,    84,    85,    86,    87,    88,    89,    90,
+      91,    92,    93,    94,    95,    96,    97,    98,    99,   100,
+     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   136,   137,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   145,    -1,   147,   148,   149,   150,
+     151,   152,   153,   154,   155,   156,    -1,    -1,   159,   160,
+     161,   162,   163,   164,   165,   166,   167,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   177,    83,    84,    85,
+      86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
+      96,    97,    98,    99,   100,   101,   102,   103,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     136,   137,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   145,
+      -1,   147,   148,   149,   150,   151,   152,   153,   154,   155,
+     156,    -1,    -1,   159,   160,   161,   162,   163,   164,   165,
+     166,   167,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   177,    83,    84,    85,    86,    87,    88,    89,    90,
+      91,    92,    93,    94,    95,    96,    97,    98,    99,   100,
+     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   136,   137,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   145,    -1,   147,   148,   149,   150,
+     151,   152,   153,   154,   155,   156,    -1,    -1,   159,   160,
+     161,   162,   163,   164,   165,   166,   167,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   177,    83,    84,    85,
+      86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
+      96,    97,    98,    99,   100,   101,   102,   103,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     136,   137,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   145,
+      -1,   147,   148,   149,   150,   151,   152,   153,   154,   155,
+     156,    -1,    -1,   159,   160,   161,   162,   163,   164,   165,
+     166,   167,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   177,    83,    84,    85,    86,    87,    88,    89,    90,
+      91,    92,    93,    94,    95,    96,    97,    98,    99,   100,
+     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   136,   137,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   145,    -1,   147,   148,   149,   150,
+     151,   152,   153,   154,   155,   156,    -1,    -1,   159,   160,
+     161,   162,   163,   164,   165,   166,   167,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   177,    83,    84,    85,
+      86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
+      96,    97,    98,    99,   100,   101,   102,   103,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     136,   137,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   145,
+      -1,   147,   148,   149,   150,   151,   152,   153,   154,   155,
+     156,    -1,    -1,   159,   160,   161,   162,   163,   164,   165,
+     166,   167,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   177,    83,    84,    85,    86,    87,    88,    89,    90,
+      91,    92,    93,    94,    95,    96,    97,    98,    99,   100,
+     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   136,   137,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   145,    -1,   147,   148,   149,   150,
+     151,   152,   153,   154,   155,   156,    -1,    -1,   159,   160,
+     161,   162,   163,   164,   165,   166,   167,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   177,    83,    84,    85,
+      86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
+      96,    97,    98,    99,   100,   101,   102,   103,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     136,   137,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   145,
+      -1,   147,   148,   149,   150,   151,   152,   153,   154,   155,
+     156,    -1,    -1,   159,   160,   161,   162,   163,   164,   165,
+     166,   167,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   177,    83,    84,    85,    86,    87,    88,    89,    90,
+      91,    92,    93,    94,    95,    96,    97,    98,    99,   100,
+     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   136,   137,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   145,    -1,   147,   148,   149,   150,
+     151,   152,   153,   154,   155,   156,    -1,    -1,   159,   160,
+     161,   162,   163,   164,   165,   166,   167,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   177,    83,    84,    85,
+      86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
+      96,    97,    98,    99,   100,   101,   102,   103,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     136,   137,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   145,
+      -1,   147,   148,   149,   150,   151,   152,   153,   154,   155,
+     156,    -1,    -1,   159,   160,   161,   162,   163,   164,   165,
+     166,   167,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   177,    83,    84,    85,    86,    87,    88,    89,    90,
+      91,    92,    93,    94,    95,    96,    97,    98,    99,   100,
+     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   136,   137,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   145,    -1,   147,   148,   149,   150,
+     151,   152,   153,   154,   155,   156,    -1,    -1,   159,   160,
+     161,   162,   163,   164,   165,   166,   167,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   177,    83,    84,    85,
+      86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
+      96,    97,    98,    99,   100,   101,   102,   103,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     136,   137,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   145,
+      -1,   147,   148,   149,   150,   151,   152,   153,   154,   155,
+     156,    -1,    -1,   159,   160,   161,   162,   163,   164,   165,
+     166,   167,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   177,    83,    84,    85,    86,    87,    88,    89,    90,
+      91,    92,    93,    94,    95,    96,    97,    98,    99,   100,
+     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   136,   137,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   145,    -1,   147,   148,   149,   150,
+     151,   152,   153,   154,   155,   156,    -1,    -1,   159,   160,
+     161,   162,   163,   164,   165,   166,   167,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   177,    83,    84,    85,
+      86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
+      96,    97,    98,    99,   100,   101,   102,   103,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     136,   137,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   145,
+      -1,   147,   148,   149,   150,   151,   152,   153,   154,   155,
+     156,    -1,    -1,   159,   160,   161,   162,   163,   164,   165,
+     166,   167,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   177,    83,    84,    85,    86,    87,    88,    89,    90,
+      91,    92,    93,    94,    95,    96,    97,    98,    99,   100,
+     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   136,   137,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   145,    -1,   147,   148,   149,   150,
+     151,   152,   153,   154,   155,   156,    -1,    -1,   159,   160,
+     161,   162,   163,   164,   165,   166,   167,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   177,    83,    84,    85,
+      86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
+      96,    97,    98,    99,   100,   101,   102,   103,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     136,   137,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   145,
+      -1,   147,   148,   149,   150,   151,   152,   153,   154,   155,
+     156,    -1,    -1,   159,   160,   161,   162,   163,   164,   165,
+     166,   167,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   177,    83,    84,    85,    86,    87,    88,    89,    90,
+      91,    92,    93,    94,    95,    96,    97,    98,    99,   100,
+     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   136,   137,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   145,    -1,   147,   148,   149,   150,
+     151,   152,   153,   154,   155,   156,    -1,    -1,   159,   160,
+     161,   162,   163,   164,   165,   166,   167,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   177,    83,    84,    85,
+      86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
+      96,    97,    98,    99,   100,   101,   102,   103,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     136,   137,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   145,
+      -1,   147,   148,   149,   150,   151,   152,   153,   154,   155,
+     156,    -1,    -1,   159,   160,   161,   162,   163,   164,   165,
+     166,   167,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   177,    83,    84,    85,    86,    87,    88,    89,    90,
+      91,    92,    93,    94,    95,    96,    97,    98,    99,   100,
+     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   136,   137,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   145,    -1,   147,   148,   149,   150,
+     151,   152,   153,   154,   155,   156,    -1,    -1,   159,   160,
+     161,   162,   163,   164,   165,   166,   167,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   177,    83,    84,    85,
+      86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
+      96,    97,    98,    99,   100,   101,   102,   103,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     136,   137,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   145,
+      -1,   147,   148,   149,   150,   151,   152,   153,   154,   155,
+     156,    -1,    -1,   159,   160,   161,   162,   163,   164,   165,
+     166,   167,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     176,    83,    84,    85,    86,    87,    88,    89,    90,    91,
+      92,    93,    94,    95,    96,    97,    98,    99,   100,   101,
+     102,   103,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   136,   137,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   145,    -1,   147,   148,   149,   150,   151,
+     152,   153,   154,   155,   156,    -1,    -1,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,    -1,    75,    -1,    -1,
+      -1,    -1,    -1,    -1,   176,    83,    84,    85,    86,    87,
+      88,    89,    90,    91,    92,    93,    94,    95,    96,    97,
+      98,    99,   100,   101,   102,   103,   104,   105,   106,   107,
+     108,   109,   110,   111,   112,   113,   114,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   136,   137,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   145,    -1,   147,
+     148,   149,   150,   151,   152,   153,   154,   155,   156,    -1,
+      -1,   159,   160,   161,   162,   163,   164,   165,   166,   167,
+      75,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   136,   137,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     145,    -1,   147,   148,   149,   150,   151,   152,   153,   154,
+     155,   156,    -1,    -1,   159,   160,   161,   162,   163,   164,
+     165,   166,   167,    75,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    83,    84,    85,    86,    87,    88,    89,    90,    91,
+      92,    93,    94,    95,    96,    97,    98,    99,   100,   101,
+     102,   103,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   136,   137,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   145,    -1,   147,   148,   149,   150,   151,
+     152,   153,   154,   155,   156,    -1,    -1,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,    75,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    83,    84,    85,    86,    87,    88,
+      89,    90,    91,    92,    93,    94,    95,    96,    97,    98,
+      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
+     109,   110,   111,   112,   113,   114,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   136,   137,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   145,    -1,   147,   148,
+     149,   150,   151,   152,   153,   154,   155,   156,    -1,    -1,
+     159,   160,   161,   162,   163,   164,   165,   166,   167,    75,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    83,    84,    85,
+      86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
+      96,    97,    98,    99,   100,   101,   102,   103,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     136,   137,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   145,
+      -1,   147,   148,   149,   150,   151,   152,   153,   154,   155,
+     156,    -1,    -1,   159,   160,   161,   162,   163,   164,   165,
+     166,   167,    75,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      83,    84,    85,    86,    87,    88,    89,    90,    91,    92,
+      93,    94,    95,    96,    97,    98,    99,   100,   101,   102,
+     103,   104,   105,   106,   107,   108,   109,   110,   111,   112,
+     113,   114,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   136,   137,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   145,    -1,   147,   148,   149,   150,   151,   152,
+     153,   154,   155,   156,    -1,    -1,   159,   160,   161,   162,
+     163,   164,   165,   166,   167,    75,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    83,    84,    85,    86,    87,    88,    89,
+      90,    91,    92,    93,    94,    95,    96,    97,    98,    99,
+     100,   101,   102,   103,   104,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   136,   137,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   145,    -1,   147,   148,   149,
+     150,   151,   152,   153,   154,   155,   156,    -1,    -1,   159,
+     160,   161,   162,   163,   164,   165,   166,   167,    75,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    83,    84,    85,    86,
+      87,    88,    89,    90,    91,    92,    93,    94,    95,    96,
+      97,    98,    99,   100,   101,   102,   103,   104,   105,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   136,
+     137,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   145,    -1,
+     147,   148,   149,   150,   151,   152,   153,   154,   155,   156,
+      -1,    -1,   159,   160,   161,   162,   163,   164,   165,   166,
+     167,    75,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    83,
+      84,    85,    86,    87,    88,    89,    90,    91,    92,    93,
+      94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
+     104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
+     114,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   136,   137,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   145,    -1,   147,   148,   149,   150,   151,   152,   153,
+     154,   155,   156,    -1,    -1,   159,   160,   161,   162,   163,
+     164,   165,   166,   167,    75,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    83,    84,    85,    86,    87,    88,    89,    90,
+      91,    92,    93,    94,    95,    96,    97,    98,    99,   100,
+     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   136,   137,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   145,    -1,   147,   148,   149,   150,
+     151,   152,   153,   154,   155,   156,    -1,    -1,   159,   160,
+     161,   162,   163,   164,   165,   166,   167,    75,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    83,    84,    85,    86,    87,
+      88,    89,    90,    91,    92,    93,    94,    95,    96,    97,
+      98,    99,   100,   101,   102,   103,   104,   105,   106,   107,
+     108,   109,   110,   111,   112,   113,   114,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   136,   137,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   145,    -1,   147,
+     148,   149,   150,   151,   152,   153,   154,   155,   156,    -1,
+      -1,   159,   160,   161,   162,   163,   164,   165,   166,   167,
+      75,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   136,   137,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     145,    -1,   147,   148,   149,   150,   151,   152,   153,   154,
+     155,   156,    -1,    -1,   159,   160,   161,   162,   163,   164,
+     165,   166,   167,    75,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    83,    84,    85,    86,    87,    88,    89,    90,    91,
+      92,    93,    94,    95,    96,    97,    98,    99,   100,   101,
+     102,   103,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   136,   137,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   145,    -1,   147,   148,   149,   150,   151,
+     152,   153,   154,   155,   156,    -1,    -1,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,    75,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    83,    84,    85,    86,    87,    88,
+      89,    90,    91,    92,    93,    94,    95,    96,    97,    98,
+      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
+     109,   110,   111,   112,   113,   114,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   136,   137,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   145,    -1,   147,   148,
+     149,   150,   151,   152,   153,   154,   155,   156,    -1,    -1,
+     159,   160,   161,   162,   163,   164,   165,   166,   167,    75,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    83,    84,    85,
+      86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
+      96,    97,    98,    99,   100,   101,   102,   103,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     136,   137,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   145,
+      -1,   147,   148,   149,   150,   151,   152,   153,   154,   155,
+     156,    -1,    -1,   159,   160,   161,   162,   163,   164,   165,
+     166,   167,    75,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      83,    84,    85,    86,    87,    88,    89,    90,    91,    92,
+      93,    94,    95,    96,    97,    98,    99,   100,   101,   102,
+     103,   104,   105,   106,   107,   108,   109,   110,   111,   112,
+     113,   114,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   136,   137,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   145,    -1,   147,   148,   149,   150,   151,   152,
+     153,   154,   155,   156,    -1,    -1,   159,   160,   161,   162,
+     163,   164,   165,   166,   167,    75,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    83,    84,    85,    86,    87,    88,    89,
+      90,    91,    92,    93,    94,    95,    96,    97,    98,    99,
+     100,   101,   102,   103,   104,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   136,   137,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   145,    -1,   147,   148,   149,
+     150,   151,   152,   153,   154,   155,   156,    -1,    -1,   159,
+     160,   161,   162,   163,   164,   165,   166,   167,    75,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    83,    84,    85,    86,
+      87,    88,    89,    90,    91,    92,    93,    94,    95,    96,
+      97,    98,    99,   100,   101,   102,   103,   104,   105,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   136,
+     137,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   145,    -1,
+     147,   148,   149,   150,   151,   152,   153,   154,   155,   156,
+      -1,    -1,   159,   160,   161,   162,   163,   164,   165,   166,
+     167,    83,    84,    85,    86,    87,    88,    89,    90,    91,
+      92,    93,    94,    95,    96,    97,    98,    99,   100,   101,
+     102,   103,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   136,   137,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   145,    -1,   147,   148,   149,   150,   151,
+     152,   153,   154,   155,   156,    -1,    -1,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,    -1,    -1,    -1,    -1,
+      -1,    -1,   174,    83,    84,    85,    86,    87,    88,    89,
+      90,    91,    92,    93,    94,    95,    96,    97,    98,    99,
+     100,   101,   102,   103,   104,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   136,   137,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   145,    -1,   147,   148,   149,
+     150,   151,   152,   153,   154,   155,   156,    -1,    -1,   159,
+     160,   161,   162,   163,   164,   165,   166,   167,    77,    -1,
+      -1,    -1,    -1,   173,    83,    84,    85,    86,    87,    88,
+      89,    90,    91,    92,    93,    94,    95,    96,    97,    98,
+      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
+     109,   110,   111,   112,   113,   114,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   136,   137,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   145,    -1,   147,   148,
+     149,   150,   151,   152,   153,   154,   155,   156,    -1,    -1,
+     159,   160,   161,   162,   163,   164,   165,   166,   167,    83,
+      84,    85,    86,    87,    88,    89,    90,    91,    92,    93,
+      94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
+     104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
+     114,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   136,   137,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   145,    -1,   147,   148,   149,   150,   151,   152,   153,
+     154,   155,   156,    -1,    -1,   159,   160,   161,   162,   163,
+     164,   165,   166,   167,    -1,    -1,    -1,    -1,    -1,   173,
+      83,    84,    85,    86,    87,    88,    89,    90,    91,    92,
+      93,    94,    95,    96,    97,    98,    99,   100,   101,   102,
+     103,   104,   105,   106,   107,   108,   109,   110,   111,   112,
+     113,   114,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   136,   137,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   145,    -1,   147,   148,   149,   150,   151,   152,
+     153,   154,   155,   156,    -1,    -1,   159,   160,   161,   162,
+     163,   164,   165,   166,   167,    -1,    -1,    -1,    -1,    -1,
+     173,    83,    84,    85,    86,    87,    88,    89,    90,    91,
+      92,    93,    94,    95,    96,    97,    98,    99,   100,   101,
+     102,   103,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   136,   137,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   145,    -1,   147,   148,   149,   150,   151,
+     152,   153,   154,   155,   156,    -1,    -1,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,    -1,    -1,    -1,    -1,
+      -1,   173,    83,    84,    85,    86,    87,    88,    89,    90,
+      91,    92,    93,    94,    95,    96,    97,    98,    99,   100,
+     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   136,   137,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   145,    -1,   147,   148,   149,   150,
+     151,   152,   153,   154,   155,   156,    -1,    -1,   159,   160,
+     161,   162,   163,   164,   165,   166,   167,    -1,    -1,    -1,
+      -1,    -1,   173,    83,    84,    85,    86,    87,    88,    89,
+      90,    91,    92,    93,    94,    95,    96,    97,    98,    99,
+     100,   101,   102,   103,   104,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   136,   137,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   145,    -1,   147,   148,   149,
+     150,   151,   152,   153,   154,   155,   156,    -1,    -1,   159,
+     160,   161,   162,   163,   164,   165,   166,   167,    -1,    -1,
+      -1,    -1,    -1,   173,    83,    84,    85,    86,    87,    88,
+      89,    90,    91,    92,    93,    94,    95,    96,    97,    98,
+      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
+     109,   110,   111,   112,   113,   114,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   136,   137,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   145,    -1,   147,   148,
+     149,   150,   151,   152,   153,   154,   155,   156,    -1,    -1,
+     159,   160,   161,   162,   163,   164,   165,   166,   167,    77,
+      -1,    -1,    -1,    -1,   173,    83,    84,    85,    86,    87,
+      88,    89,    90,    91,    92,    93,    94,    95,    96,    97,
+      98,    99,   100,   101,   102,   103,   104,   105,   106,   107,
+     108,   109,   110,   111,   112,   113,   114,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   136,   137,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   145,    -1,   147,
+     148,   149,   150,   151,   152,   153,   154,   155,   156,    -1,
+      -1,   159,   160,   161,   162,   163,   164,   165,   166,   167,
+      77,    -1,    -1,    -1,    -1,    -1,    83,    84,    85,    86,
+      87,    88,    89,    90,    91,    92,    93,    94,    95,    96,
+      97,    98,    99,   100,   101,   102,   103,   104,   105,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   136,
+     137,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   145,    -1,
+     147,   148,   149,   150,   151,   152,   153,   154,   155,   156,
+      -1,    -1,   159,   160,   161,   162,   163,   164,   165,   166,
+     167,    83,    84,    85,    86,    87,    88,    89,    90,    91,
+      92,    93,    94,    95,    96,    97,    98,    99,   100,   101,
+     102,   103,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   136,   137,    -1,    -1,    -1,    -1,
+      -1,    -1,   144,   145,    -1,   147,   148,   149,   150,   151,
+     152,   153,   154,   155,   156,    -1,    -1,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,    83,    84,    85,    86,
+      87,    88,    89,    90,    91,    92,    93,    94,    95,    96,
+      97,    98,    99,   100,   101,   102,   103,   104,   105,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   136,
+     137,    -1,    -1,    -1,    -1,    -1,    -1,   144,   145,    -1,
+     147,   148,   149,   150,   151,   152,   153,   154,   155,   156,
+      -1,    -1,   159,   160,   161,   162,   163,   164,   165,   166,
+     167,    83,    84,    85,    86,    87,    88,    89,    90,    91,
+      92,    93,    94,    95,    96,    97,    98,    99,   100,   101,
+     102,   103,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   136,   137,    -1,    -1,    -1,    -1,
+      -1,    -1,   144,   145,    -1,   147,   148,   149,   150,   151,
+     152,   153,   154,   155,   156,    -1,    -1,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,    83,    84,    85,    86,
+      87,    88,    89,    90,    91,    92,    93,    94,    95,    96,
+      97,    98,    99,   100,   101,   102,   103,   104,   105,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   136,
+     137,    -1,    -1,    -1,    -1,    -1,    -1,   144,   145,    -1,
+     147,   148,   149,   150,   151,   152,   153,   154,   155,   156,
+      -1,    -1,   159,   160,   161,   162,   163,   164,   165,   166,
+     167,    83,    84,    85,    86,    87,    88,    89,    90,    91,
+      92,    93,    94,    95,    96,    97,    98,    99,   100,   101,
+     102,   103,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   136,   137,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   145,   146,   147,   148,   149,   150,   151,
+     152,   153,   154,   155,   156,    -1,    -1,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,    83,    84,    85,    86,
+      87,    88,    89,    90,    91,    92,    93,    94,    95,    96,
+      97,    98,    99,   100,   101,   102,   103,   104,   105,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   136,
+     137,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   145,    -1,
+     147,   148,   149,   150,   151,   152,   153,   154,   155,   156,
+      -1,    -1,   159,   160,   161,   162,   163,   164,   165,   166,
+     167,    83,    84,    85,    86,    87,    88,    89,    90,    91,
+      92,    93,    94,    95,    96,    97,    98,    99,   100,   101,
+     102,   103,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   136,   137,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   147,   148,   149,   150,   151,
+     152,   153,   154,   155,   156,    -1,    -1,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,    83,    -1,    85,    -1,
+      87,    88,    89,    90,    91,    92,    93,    94,    95,    96,
+      97,    98,    99,   100,   101,   102,   103,   104,   105,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   136,
+     137,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     147,   148,   149,   150,   151,   152,   153,   154,   155,   156,
+      -1,    -1,   159,   160,   161,   162,   163,   164,   165,   166,
+     167,    88,    89,    90,    91,    92,    93,    94,    95,    96,
+      97,    98,    99,   100,   101,   102,   103,   104,   105,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,    -1,    -1,
+      -1,    97,    98,    99,   100,   101,   102,   103,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,   136,
+     137,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     147,   148,   149,   150,   151,   152,   153,   154,   155,   156,
+     136,   137,   159,   160,   161,   162,   163,   164,   165,   166,
+     167,   147,   148,   149,   150,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   161,   162,   163,   164,   165,
+     166,   167,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,    -1,    -1,
+      -1,    -1,    -1,    99,   100,   101,   102,   103,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,    -1,    -1,    -1,
+      -1,   136,   137,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   147,   148,   149,   150,    -1,    -1,    -1,    -1,
+     136,   137,    -1,    -1,    -1,    -1,   161,   162,   163,   164,
+     165,   166,   167,   149,   150,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   163,   164,   165,
+     166,   167
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int16 yystos[] =
+{
+       0,     1,     3,    11,    12,    13,    14,    15,    16,    71,
+      75,    81,   178,   182,   183,   186,   220,   221,   222,   223,
+     255,   256,    75,   220,     1,    22,    23,    24,    38,    39,
+      75,   229,   230,   232,   255,     1,    22,    23,    24,    25,
+      26,    29,    30,    31,    33,    34,    35,    36,    37,    38,
+      39,    75,    80,   143,   159,   224,   225,   226,   255,   256,
+     258,   259,    80,   187,   255,   256,    80,   187,   255,   256,
+       1,    75,   227,   228,   232,     5,     6,     8,     9,    10,
+      22,    23,    24,    32,    46,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,    69,    78,    79,   117,
+     118,   119,   120,   121,   122,   123,   124,   125,   126,   127,
+     128,   129,   130,   131,   132,   133,   134,   138,   139,   140,
+     141,   142,   148,   158,   161,   162,   168,   169,   172,   179,
+     218,   219,   237,   238,   242,   244,   252,   253,   254,   255,
+     257,     0,   183,   183,   221,    75,   175,   171,   176,   185,
+      75,   231,   232,   256,   231,   231,    75,    75,   230,    75,
+     176,    75,    22,    23,    24,    25,    26,    27,    28,    75,
+     161,   237,   245,   247,   248,   252,   253,   254,    75,   248,
+      75,   248,    75,   248,    75,   248,    75,   237,    75,   237,
+     237,   237,    75,   237,    75,    75,   254,   172,    30,   225,
+     226,   224,    75,   178,   237,   249,   250,   259,   260,   258,
+       6,     1,     4,    17,    18,    21,    33,    40,    46,    47,
+      64,    65,    67,    68,    70,    72,    73,    75,   135,   143,
+     172,   191,   192,   193,   194,   204,   205,   206,   207,   209,
+     217,   237,   238,   239,   241,   171,   172,   188,   235,   236,
+     255,   256,    80,   187,   255,     6,   191,   171,    80,   187,
+      75,   228,   171,   174,   176,   176,   176,   176,   176,   237,
+     172,   172,   172,   172,   172,   172,   172,   172,   172,   172,
+     172,   172,   172,   171,   237,   171,   237,   237,   237,   171,
+     237,   171,   237,   171,   237,   171,   237,   172,   238,   255,
+     238,   238,   237,   237,   172,   172,   172,   172,   238,   237,
+     171,   237,   171,   237,   237,   237,   237,   237,   171,   237,
+     237,   237,   238,   237,   171,   237,    83,    84,    85,    86,
+      87,    88,    89,    90,    91,    92,    93,    94,    95,    96,
+      97,    98,    99,   100,   101,   102,   103,   104,   105,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,   136,   137,
+     145,   147,   148,   149,   150,   151,   152,   153,   154,   155,
+     156,   159,   160,   161,   162,   163,   164,   165,   166,   167,
+     176,    82,   125,   126,   127,   134,   158,   169,   176,   180,
+     172,   176,   178,   180,   176,   180,   223,   237,   237,    75,
+     184,    75,   175,   232,    75,    75,   237,   245,   245,   245,
+     245,   245,   245,   245,   252,   253,    75,   175,   176,   176,
+     176,    75,    75,    75,    75,    75,   175,    75,    75,    75,
+      75,    75,     7,    46,    47,   173,   199,   200,   202,   203,
+     252,   254,   255,   178,   237,   176,    75,   175,   260,    75,
+     175,   259,   187,    75,   172,   224,   224,   224,    44,    45,
+      75,   237,   255,   237,   237,   237,   237,    75,    75,    75,
+     237,    75,   172,   245,   246,    74,   192,   172,   241,   193,
+      75,    82,   175,   255,   173,   236,   174,   189,   175,   171,
+     176,   235,     6,   191,   187,   255,     6,   191,   254,   254,
+     237,   237,   237,   237,   237,    51,   237,   237,   237,   237,
+     246,   246,   215,   237,   215,   215,   215,   215,   237,   246,
+     237,   237,   237,   237,   237,   237,   237,   176,   180,   237,
+     237,   237,   237,   237,   237,   237,   173,   237,   171,   237,
+     171,   237,   171,   237,   237,   237,   171,   237,   171,   237,
+     237,   237,   237,   237,   171,   237,   237,   237,   171,   237,
+     171,   237,   171,   237,   171,   237,   171,   237,   171,   237,
+     171,   237,   171,   237,   171,   237,   171,   237,   171,   237,
+     171,   237,   171,   237,   171,   237,   171,   237,   171,   237,
+     171,   237,   171,   237,   171,   237,   171,   237,   237,   237,
+     237,   237,   237,   237,   237,   237,   237,   237,   237,    88,
+     171,   237,   171,   237,   171,   237,   171,   237,   171,   237,
+     171,   237,   171,   237,   171,   237,   171,   237,   237,   237,
+     237,   237,   176,   173,   246,   237,   255,    22,    23,    24,
+     176,   255,   178,   237,   251,   176,   177,   232,   177,   176,
+     176,   247,   237,   237,   237,   237,   172,   172,    75,   173,
+     175,   172,   237,   237,   249,    75,   259,     6,    19,    19,
+      20,   237,   237,   206,    75,    41,    75,    75,    75,    75,
+      75,   237,   246,    75,   175,    74,     7,   173,   195,   197,
+     245,   175,   172,   246,   238,   240,   241,    75,   173,   236,
+     165,   190,   235,    24,    79,   130,   160,   161,   162,   168,
+     237,   237,   187,    75,   187,   177,   177,   177,   177,   177,
+     237,   144,   144,   144,   144,   173,   173,   173,    77,   173,
+     175,   173,   173,   173,   173,   173,   237,   255,   173,   173,
+     173,   173,   134,   176,   237,   237,   237,   237,   237,   237,
+     237,   237,   237,   237,   237,   237,   237,   237,   237,   237,
+     237,   237,   237,   237,   237,   237,   237,   237,   237,   237,
+     146,   237,   237,   237,   237,   237,   237,   237,   237,   237,
+     237,   177,   177,   251,   174,   243,   173,   177,   251,   172,
+     176,   178,    77,   177,   251,   237,   237,   177,   177,   177,
+      75,   250,   250,    75,     7,   201,   203,   250,   177,   173,
+      75,    75,    44,    45,   206,   237,   206,   208,   208,    73,
+      73,   173,   245,    75,   173,   175,   240,   246,   175,    22,
+      23,    24,   232,   233,   234,    75,    24,   162,    24,    24,
+      22,    23,    24,   177,    48,   215,   216,   216,   216,   216,
+     237,   245,   177,   237,   237,   237,   180,   177,     5,   243,
+     180,   177,   173,   246,   237,   251,   237,   177,   177,   177,
+     173,   173,   175,   173,    75,   206,   206,   237,   237,    42,
+      48,    49,    50,    66,   210,   211,   212,   213,   214,   237,
+     210,    75,    75,     7,   196,   198,   245,   173,   173,   241,
+     232,   232,   232,   175,    24,   237,   173,   175,   173,   173,
+     173,   173,   180,   174,   177,   176,   176,   255,   243,   173,
+     177,   177,   203,    75,    75,   237,    75,   237,   237,    74,
+     211,    75,   174,   175,    77,    74,   175,   233,   215,   237,
+     251,   251,   172,   243,    43,    75,   206,    75,    75,   206,
+     214,   237,   198,   177,   177,   173,   246,   237,   206,   208,
+     208,   243,   173,    75,   243,   206
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int16 yyr1[] =
+{
+       0,   181,   182,   182,   183,   183,   184,   185,   185,   186,
+     186,   186,   186,   186,   186,   186,   186,   186,   186,   186,
+     186,   186,   186,   186,   186,   187,   188,   188,   188,   188,
+     189,   189,   190,   190,   191,   191,   191,   192,   192,   193,
+     193,   193,   193,   194,   194,   194,   194,   194,   194,   194,
+     194,   194,   194,   194,   195,   195,   196,   196,   197,   197,
+     198,   198,   199,   199,   199,   200,   200,   201,   201,   202,
+     202,   203,   203,   203,   203,   204,   204,   205,   205,   205,
+     205,   206,   206,   207,   207,   208,   208,   208,   208,   209,
+     209,   210,   210,   211,   212,   213,   213,   214,   214,   214,
+     215,   215,   216,   216,   217,   217,   217,   217,   217,   217,
+     217,   217,   217,   217,   217,   217,   218,   218,   219,   219,
+     220,   220,   221,   221,   221,   222,   222,   223,   223,   223,
+     223,   223,   224,   224,   225,   225,   226,   226,   226,   226,
+     226,   226,   226,   226,   226,   226,   226,   226,   226,   226,
+     226,   226,   226,   226,   226,   226,   226,   226,   226,   226,
+     226,   226,   226,   226,   226,   226,   226,   227,   227,   228,
+     228,   228,   228,   229,   229,   230,   230,   230,   230,   230,
+     230,   230,   230,   231,   231,   231,   232,   232,   233,   233,
+     233,   233,   234,   234,   235,   235,   235,   235,   235,   235,
+     235,   235,   235,   235,   235,   235,   235,   236,   236,   236,
+     237,   237,   237,   237,   237,   237,   237,   237,   237,   237,
+     237,   237,   237,   237,   237,   237,   237,   237,   237,   237,
+     237,   237,   237,   237,   237,   237,   237,   237,   237,   237,
+     237,   237,   237,   237,   237,   237,   237,   237,   237,   237,
+     237,   237,   237,   237,   237,   237,   237,   237,   237,   237,
+     237,   237,   237,   237,   237,   237,   237,   237,   237,   237,
+     237,   237,   237,   237,   237,   237,   237,   237,   237,   237,
+     237,   237,   237,   237,   237,   237,   237,   237,   237,   237,
+     237,   237,   237,   237,   237,   237,   237,   237,   237,   237,
+     237,   237,   237,   237,   237,   237,   237,   237,   237,   237,
+     237,   237,   237,   237,   237,   237,   237,   237,   237,   237,
+     237,   237,   237,   237,   237,   237,   237,   237,   237,   237,
+     237,   237,   237,   237,   237,   237,   237,   237,   237,   237,
+     237,   237,   237,   237,   237,   237,   237,   237,   237,   237,
+     237,   237,   237,   237,   237,   237,   237,   237,   237,   237,
+     237,   238,   238,   238,   238,   238,   238,   238,   238,   238,
+     238,   238,   238,   238,   238,   238,   238,   239,   239,   240,
+     240,   241,   241,   242,   242,   242,   242,   242,   242,   243,
+     243,   244,   244,   244,   244,   244,   244,   244,   244,   244,
+     244,   244,   244,   244,   244,   244,   245,   245,   245,   245,
+     245,   245,   246,   246,   247,   247,   247,   247,   247,   247,
+     247,   247,   248,   248,   249,   249,   249,   249,   250,   250,
+     251,   251,   252,   253,   254,   255,   255,   256,   257,   258,
+     258,   258,   259,   260,   260,   260
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     2,     1,     2,     1,     0,     2,     2,
+       2,     3,     2,     2,     3,     3,     4,     4,     4,     4,
+       5,     5,     5,     5,     2,     5,     0,     2,     1,     3,
+       0,     2,     0,     2,     0,     5,     1,     1,     2,     1,
+       1,     1,     2,     2,     5,     3,     2,     3,     1,     2,
+       2,     2,     4,     5,     1,     3,     1,     3,     1,     1,
+       1,     1,     4,     4,     4,     1,     3,     1,     3,     1,
+       1,     1,     1,     1,     1,     5,     3,     1,     1,     1,
+       1,     3,     2,     4,     4,     1,     4,     5,     5,     6,
+       6,     1,     2,     3,     2,     1,     3,     1,     3,     1,
+       1,     3,     1,     3,     3,     6,     6,     5,     5,    10,
+       8,     4,     3,     3,     3,     1,     6,     6,     6,     6,
+       1,     2,     2,     1,     2,     1,     3,     3,     1,     4,
+       2,     5,     1,     2,     1,     2,     1,     2,     2,     3,
+       2,     3,     2,     3,     2,     3,     2,     3,     2,     3,
+       3,     4,     2,     2,     2,     3,     5,     2,     3,     3,
+       3,     3,     2,     3,     4,     5,     1,     1,     2,     1,
+       2,     3,     3,     1,     2,     3,     3,     3,     2,     2,
+       2,     1,     2,     1,     2,     3,     1,     4,     1,     2,
+       2,     2,     1,     3,     1,     4,     3,     3,     4,     4,
+       4,     5,     3,     4,     4,     4,     3,     1,     2,     3,
+       1,     1,     1,     4,     1,     2,     2,     2,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     4,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
+       7,     5,     3,     2,     1,     2,     2,     2,     2,     3,
+       3,     2,     3,     2,     2,     3,     2,     2,     3,     2,
+       3,     2,     2,     3,     3,     2,     2,     2,     2,     3,
+       2,     3,     1,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     4,     4,     4,     4,     4,     1,     1,
+       6,     1,     4,     6,     8,     1,     4,     6,     5,     4,
+       8,     5,     6,     1,     4,     4,     5,     5,     3,     1,
+       3,     1,     1,     4,     4,     4,     3,     3,     3,     0,
+       2,     5,     4,     6,     4,     4,     4,     4,     4,     4,
+       7,     6,     3,    10,     9,     6,     1,     4,     4,     5,
+       5,     4,     1,     3,     1,     2,     2,     2,     2,     2,
+       2,     2,     1,     3,     1,     2,     3,     4,     1,     3,
+       1,     3,     1,     1,     1,     1,     1,     1,     1,     1,
+       2,     2,     1,     1,     2,     3
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = SPINYYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == SPINYYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use SPINYYerror or SPINYYUNDEF. */
+#define YYERRCODE SPINYYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if SPINYYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !SPINYYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !SPINYYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+/* Context of a parse error.  */
+typedef struct
+{
+  yy_state_t *yyssp;
+  yysymbol_kind_t yytoken;
+} yypcontext_t;
+
+/* Put in YYARG at most YYARGN of the expected tokens given the
+   current YYCTX, and return the number of tokens stored in YYARG.  If
+   YYARG is null, return the number of expected tokens (guaranteed to
+   be less than YYNTOKENS).  Return YYENOMEM on memory exhaustion.
+   Return 0 if there are more than YYARGN expected tokens, yet fill
+   YYARG up to YYARGN. */
+static int
+yypcontext_expected_tokens (const yypcontext_t *yyctx,
+                            yysymbol_kind_t yyarg[], int yyargn)
+{
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  int yyn = yypact[+*yyctx->yyssp];
+  if (!yypact_value_is_default (yyn))
+    {
+      /* Start YYX at -YYN if negative to avoid negative indexes in
+         YYCHECK.  In other words, skip the first -YYN actions for
+         this state because they are default actions.  */
+      int yyxbegin = yyn < 0 ? -yyn : 0;
+      /* Stay within bounds of both yycheck and yytname.  */
+      int yychecklim = YYLAST - yyn + 1;
+      int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+      int yyx;
+      for (yyx = yyxbegin; yyx < yyxend; ++yyx)
+        if (yycheck[yyx + yyn] == yyx && yyx != YYSYMBOL_YYerror
+            && !yytable_value_is_error (yytable[yyx + yyn]))
+          {
+            if (!yyarg)
+              ++yycount;
+            else if (yycount == yyargn)
+              return 0;
+            else
+              yyarg[yycount++] = YY_CAST (yysymbol_kind_t, yyx);
+          }
+    }
+  if (yyarg && yycount == 0 && 0 < yyargn)
+    yyarg[0] = YYSYMBOL_YYEMPTY;
+  return yycount;
+}
+
+
+
+
+#ifndef yystrlen
+# if defined __GLIBC__ && defined _STRING_H
+#  define yystrlen(S) (YY_CAST (YYPTRDIFF_T, strlen (S)))
+# else
+/* Return the length of YYSTR.  */
+static YYPTRDIFF_T
+yystrlen (const char *yystr)
+{
+  YYPTRDIFF_T yylen;
+  for (yylen = 0; yystr[yylen]; yylen++)
+    continue;
+  return yylen;
+}
+# endif
+#endif
+
+#ifndef yystpcpy
+# if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
+#  define yystpcpy stpcpy
+# else
+/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
+   YYDEST.  */
+static char *
+yystpcpy (char *yydest, const char *yysrc)
+{
+  char *yyd = yydest;
+  const char *yys = yysrc;
+
+  while ((*yyd++ = *yys++) != '\0')
+    continue;
+
+  return yyd - 1;
+}
+# endif
+#endif
+
+#ifndef yytnamerr
+/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
+   quotes and backslashes, so that it's suitable for yyerror.  The
+   heuristic is that double-quoting is unnecessary unless the string
+   contains an apostrophe, a comma, or backslash (other than
+   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
+   null, do not copy; instead, return the length of what the result
+   would have been.  */
+static YYPTRDIFF_T
+yytnamerr (char *yyres, const char *yystr)
+{
+  if (*yystr == '"')
+    {
+      YYPTRDIFF_T yyn = 0;
+      char const *yyp = yystr;
+      for (;;)
+        switch (*++yyp)
+          {
+          case '\'':
+          case ',':
+            goto do_not_strip_quotes;
+
+          case '\\':
+            if (*++yyp != '\\')
+              goto do_not_strip_quotes;
+            else
+              goto append;
+
+          append:
+          default:
+            if (yyres)
+              yyres[yyn] = *yyp;
+            yyn++;
+            break;
+
+          case '"':
+            if (yyres)
+              yyres[yyn] = '\0';
+            return yyn;
+          }
+    do_not_strip_quotes: ;
+    }
+
+  if (yyres)
+    return yystpcpy (yyres, yystr) - yyres;
+  else
+    return yystrlen (yystr);
+}
+#endif
+
+
+static int
+yy_syntax_error_arguments (const yypcontext_t *yyctx,
+                           yysymbol_kind_t yyarg[], int yyargn)
+{
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  /* There are many possibilities here to consider:
+     - If this state is a consistent state with a default action, then
+       the only way this function was invoked is if the default action
+       is an error action.  In that case, don't check for expected
+       tokens because there are none.
+     - The only way there can be no lookahead present (in yychar) is if
+       this state is a consistent state with a default action.  Thus,
+       detecting the absence of a lookahead is sufficient to determine
+       that there is no unexpected or expected token to report.  In that
+       case, just report a simple "syntax error".
+     - Don't assume there isn't a lookahead just because this state is a
+       consistent state with a default action.  There might have been a
+       previous inconsistent state, consistent state with a non-default
+       action, or user semantic action that manipulated yychar.
+     - Of course, the expected token list depends on states to have
+       correct lookahead information, and it depends on the parser not
+       to perform extra reductions after fetching a lookahead from the
+       scanner and before detecting a syntax error.  Thus, state merging
+       (from LALR or IELR) and default reductions corrupt the expected
+       token list.  However, the list is correct for canonical LR with
+       one exception: it will still contain any token that will not be
+       accepted due to an error action in a later state.
+  */
+  if (yyctx->yytoken != YYSYMBOL_YYEMPTY)
+    {
+      int yyn;
+      if (yyarg)
+        yyarg[yycount] = yyctx->yytoken;
+      ++yycount;
+      yyn = yypcontext_expected_tokens (yyctx,
+                                        yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+      if (yyn == YYENOMEM)
+        return YYENOMEM;
+      else
+        yycount += yyn;
+    }
+  return yycount;
+}
+
+/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
+   about the unexpected token YYTOKEN for the state stack whose top is
+   YYSSP.
+
+   Return 0 if *YYMSG was successfully written.  Return -1 if *YYMSG is
+   not large enough to hold the message.  In that case, also set
+   *YYMSG_ALLOC to the required number of bytes.  Return YYENOMEM if the
+   required number of bytes is too large to store.  */
+static int
+yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
+                const yypcontext_t *yyctx)
+{
+  enum { YYARGS_MAX = 5 };
+  /* Internationalized format string. */
+  const char *yyformat = YY_NULLPTR;
+  /* Arguments of yyformat: reported tokens (one for the "unexpected",
+     one per "expected"). */
+  yysymbol_kind_t yyarg[YYARGS_MAX];
+  /* Cumulated lengths of YYARG.  */
+  YYPTRDIFF_T yysize = 0;
+
+  /* Actual size of YYARG. */
+  int yycount = yy_syntax_error_arguments (yyctx, yyarg, YYARGS_MAX);
+  if (yycount == YYENOMEM)
+    return YYENOMEM;
+
+  switch (yycount)
+    {
+#define YYCASE_(N, S)                       \
+      case N:                               \
+        yyformat = S;                       \
+        break
+    default: /* Avoid compiler warnings. */
+      YYCASE_(0, YY_("syntax error"));
+      YYCASE_(1, YY_("syntax error, unexpected %s"));
+      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
+      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
+      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
+      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
+#undef YYCASE_
+    }
+
+  /* Compute error message size.  Don't count the "%s"s, but reserve
+     room for the terminator.  */
+  yysize = yystrlen (yyformat) - 2 * yycount + 1;
+  {
+    int yyi;
+    for (yyi = 0; yyi < yycount; ++yyi)
+      {
+        YYPTRDIFF_T yysize1
+          = yysize + yytnamerr (YY_NULLPTR, yytname[yyarg[yyi]]);
+        if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
+          yysize = yysize1;
+        else
+          return YYENOMEM;
+      }
+  }
+
+  if (*yymsg_alloc < yysize)
+    {
+      *yymsg_alloc = 2 * yysize;
+      if (! (yysize <= *yymsg_alloc
+             && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
+        *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
+      return -1;
+    }
+
+  /* Avoid sprintf, as that infringes on the user's name space.
+     Don't have undefined behavior even if the translation
+     produced a string with the wrong number of "%s"s.  */
+  {
+    char *yyp = *yymsg;
+    int yyi = 0;
+    while ((*yyp = *yyformat) != '\0')
+      if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
+        {
+          yyp += yytnamerr (yyp, yytname[yyarg[yyi++]]);
+          yyformat += 2;
+        }
+      else
+        {
+          ++yyp;
+          ++yyformat;
+        }
+  }
+  return 0;
+}
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
+{
+  YY_USE (yyvaluep);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void)
+{
+/* Lookahead token kind.  */
+int yychar;
+
+
+/* The semantic value of the lookahead symbol.  */
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
+
+    /* Number of syntax errors so far.  */
+    int yynerrs = 0;
+
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+
+  /* Buffer for error messages, and its allocated size.  */
+  char yymsgbuf[128];
+  char *yymsg = yymsgbuf;
+  YYPTRDIFF_T yymsg_alloc = sizeof yymsgbuf;
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = SPINYYEMPTY; /* Cause a token to be read.  */
+
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == SPINYYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex (&yylval);
+    }
+
+  if (yychar <= SPINYYEOF)
+    {
+      yychar = SPINYYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == SPINYYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = SPINYYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = SPINYYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 3: /* input: conblock rest  */
+#line 506 "frontends/spin/spin.y"
+    {
+        if (current) {
+            current->conblock = AddToListEx(current->conblock, yyvsp[-1], &current->conblock_tail);
+        }
+    }
+#line 6427 "./build/spin.tab.c"
+    break;
+
+  case 9: /* topelement: "CON" conblock  */
+#line 528 "frontends/spin/spin.y"
+  { yyval = current->conblock = AddToListEx(current->conblock, yyvsp[0], &current->conblock_tail); }
+#line 6433 "./build/spin.tab.c"
+    break;
+
+  case 10: /* topelement: "DAT" datblock  */
+#line 530 "frontends/spin/spin.y"
+  { yyval = current->datblock = AddToListEx(current->datblock, yyvsp[0], &current->datblock_tail); }
+#line 6439 "./build/spin.tab.c"
+    break;
+
+  case 11: /* topelement: "DAT" annotation datblock  */
+#line 532 "frontends/spin/spin.y"
+  {
+      current->datannotations = AddToList(current->datannotations, yyvsp[-1]);
+      yyval = current->datblock = AddToListEx(current->datblock, yyvsp[0], &current->datblock_tail); 
+  }
+#line 6448 "./build/spin.tab.c"
+    break;
+
+  case 12: /* topelement: "VAR" varblock  */
+#line 537 "frontends/spin/spin.y"
+  { yyval = current->pendingvarblock = AddToList(current->pendingvarblock, yyvsp[0]); }
+#line 6454 "./build/spin.tab.c"
+    break;
+
+  case 13: /* topelement: "OBJ" objblock  */
+#line 539 "frontends/spin/spin.y"
+  {
+    yyval = current->objblock = AddToList(current->objblock, yyvsp[0]);
+  }
+#line 6462 "./build/spin.tab.c"
+    break;
+
+  case 14: /* topelement: "PUB" funcdef funcbody  */
+#line 543 "frontends/spin/spin.y"
+    { DeclareFunction(current, SpinRetType(yyvsp[-1]), 1, yyvsp[-1], yyvsp[0], NULL, yyvsp[-2]); }
+#line 6468 "./build/spin.tab.c"
+    break;
+
+  case 15: /* topelement: "PRI" funcdef funcbody  */
+#line 545 "frontends/spin/spin.y"
+    { DeclareFunction(current, SpinRetType(yyvsp[-1]), 0, yyvsp[-1], yyvsp[0], NULL, yyvsp[-2]); }
+#line 6474 "./build/spin.tab.c"
+    break;
+
+  case 16: /* topelement: "PUB" annotation funcdef funcbody  */
+#line 547 "frontends/spin/spin.y"
+    { DeclareFunction(current, SpinRetType(yyvsp[-1]), 1, yyvsp[-1], yyvsp[0], yyvsp[-2], yyvsp[-3]); }
+#line 6480 "./build/spin.tab.c"
+    break;
+
+  case 17: /* topelement: "PRI" annotation funcdef funcbody  */
+#line 549 "frontends/spin/spin.y"
+    { DeclareFunction(current, SpinRetType(yyvsp[-1]), 0, yyvsp[-1], yyvsp[0], yyvsp[-2], yyvsp[-3]); }
+#line 6486 "./build/spin.tab.c"
+    break;
+
+  case 18: /* topelement: "PUB" "FILE" "string" funcdef  */
+#line 551 "frontends/spin/spin.y"
+    { DeclareFunction(current, SpinRetType(yyvsp[0]), 1, yyvsp[0], yyvsp[-1], NULL, yyvsp[-3]); }
+#line 6492 "./build/spin.tab.c"
+    break;
+
+  case 19: /* topelement: "PRI" "FILE" "string" funcdef  */
+#line 553 "frontends/spin/spin.y"
+    { DeclareFunction(current, SpinRetType(yyvsp[0]), 0, yyvsp[0], yyvsp[-1], NULL, yyvsp[-3]); }
+#line 6498 "./build/spin.tab.c"
+    break;
+
+  case 20: /* topelement: "PUB" annotation "FILE" "string" funcdef  */
+#line 556 "frontends/spin/spin.y"
+    { DeclareFunction(current, SpinRetType(yyvsp[0]), 1, yyvsp[0], yyvsp[-1], yyvsp[-3], yyvsp[-4]); }
+#line 6504 "./build/spin.tab.c"
+    break;
+
+  case 21: /* topelement: "PRI" annotation "FILE" "string" funcdef  */
+#line 558 "frontends/spin/spin.y"
+    { DeclareFunction(current, SpinRetType(yyvsp[0]), 0, yyvsp[0], yyvsp[-1], yyvsp[-3], yyvsp[-4]); }
+#line 6510 "./build/spin.tab.c"
+    break;
+
+  case 22: /* topelement: "PRI" identifier '=' identifier "end of line"  */
+#line 561 "frontends/spin/spin.y"
+    {
+        const char *oldname = GetIdentifierName(yyvsp[-1]);
+        const char *newname = GetIdentifierName(yyvsp[-3]);
+        AddSymbol(&current->objsyms, newname, SYM_WEAK_ALIAS, (void *)oldname, NULL);
+    }
+#line 6520 "./build/spin.tab.c"
+    break;
+
+  case 23: /* topelement: "PUB" identifier '=' identifier "end of line"  */
+#line 567 "frontends/spin/spin.y"
+    {
+        const char *oldname = GetIdentifierName(yyvsp[-1]);
+        const char *newname = GetIdentifierName(yyvsp[-3]);
+        AddSymbol(&current->objsyms, newname, SYM_WEAK_ALIAS, (void *)oldname, NULL);
+    }
+#line 6530 "./build/spin.tab.c"
+    break;
+
+  case 24: /* topelement: annotation emptylines  */
+#line 573 "frontends/spin/spin.y"
+    { DeclareToplevelAnnotation(yyvsp[-1]); }
+#line 6536 "./build/spin.tab.c"
+    break;
+
+  case 25: /* funcdef: identifier optparamlist resultname localvars "end of line"  */
+#line 578 "frontends/spin/spin.y"
+  { AST *funcdecl = NewAST(AST_FUNCDECL, yyvsp[-4], yyvsp[-2]);
+    AST *funcvars = NewAST(AST_FUNCVARS, yyvsp[-3], yyvsp[-1]);
+    yyval = NewAST(AST_FUNCDEF, funcdecl, funcvars);
+  }
+#line 6545 "./build/spin.tab.c"
+    break;
+
+  case 26: /* optparamlist: %empty  */
+#line 586 "frontends/spin/spin.y"
+  {
+      yyval = NULL;
+      LANGUAGE_WARNING(LANG_SPIN_SPIN2, NULL, "omitting () for empty parameter lists is a flexspin extension");
+  }
+#line 6554 "./build/spin.tab.c"
+    break;
+
+  case 27: /* optparamlist: '(' ')'  */
+#line 591 "frontends/spin/spin.y"
+  {
+      yyval = NULL;
+      LANGUAGE_WARNING(LANG_SPIN_SPIN1, NULL, "() for empty parameter lists is a flexspin extension");
+  }
+#line 6563 "./build/spin.tab.c"
+    break;
+
+  case 28: /* optparamlist: paramidentlist  */
+#line 596 "frontends/spin/spin.y"
+  { yyval = yyvsp[0]; }
+#line 6569 "./build/spin.tab.c"
+    break;
+
+  case 29: /* optparamlist: '(' paramidentlist ')'  */
+#line 598 "frontends/spin/spin.y"
+  { yyval = yyvsp[-1]; }
+#line 6575 "./build/spin.tab.c"
+    break;
+
+  case 30: /* resultname: %empty  */
+#line 603 "frontends/spin/spin.y"
+  { yyval = NULL; }
+#line 6581 "./build/spin.tab.c"
+    break;
+
+  case 31: /* resultname: ':' paramidentlist  */
+#line 605 "frontends/spin/spin.y"
+  {
+      // handle the common case of just one identifier by
+      // unwrapping the list
+      AST *list = yyvsp[0];
+      if (list->kind == AST_LISTHOLDER && list->right == NULL) {
+          list = list->left;
+      }
+      yyval = list;
+  }
+#line 6595 "./build/spin.tab.c"
+    break;
+
+  case 32: /* localvars: %empty  */
+#line 618 "frontends/spin/spin.y"
+  { yyval = NULL; }
+#line 6601 "./build/spin.tab.c"
+    break;
+
+  case 33: /* localvars: '|' vardecllist  */
+#line 620 "frontends/spin/spin.y"
+  { yyval = yyvsp[0]; }
+#line 6607 "./build/spin.tab.c"
+    break;
+
+  case 34: /* funcbody: %empty  */
+#line 625 "frontends/spin/spin.y"
+  { yyval = NULL; }
+#line 6613 "./build/spin.tab.c"
+    break;
+
+  case 35: /* funcbody: "__bytecode__" '(' "string" ')' "end of line"  */
+#line 627 "frontends/spin/spin.y"
+  {
+      AST *str = yyvsp[-2];
+      str->kind = AST_BYTECODE;
+      yyval = str;
+  }
+#line 6623 "./build/spin.tab.c"
+    break;
+
+  case 36: /* funcbody: stmtlist  */
+#line 633 "frontends/spin/spin.y"
+  { yyval = yyvsp[0]; }
+#line 6629 "./build/spin.tab.c"
+    break;
+
+  case 37: /* stmtlist: stmt  */
+#line 638 "frontends/spin/spin.y"
+    {
+        yyval = yyvsp[0];
+    }
+#line 6637 "./build/spin.tab.c"
+    break;
+
+  case 38: /* stmtlist: stmtlist stmt  */
+#line 642 "frontends/spin/spin.y"
+  {
+      yyval = AddToList(yyvsp[-1], yyvsp[0]); 
+  }
+#line 6645 "./build/spin.tab.c"
+    break;
+
+  case 39: /* stmt: basicstmt  */
+#line 649 "frontends/spin/spin.y"
+    {  yyval = NewCommentedStatement(yyvsp[0]); }
+#line 6651 "./build/spin.tab.c"
+    break;
+
+  case 40: /* stmt: compoundstmt  */
+#line 651 "frontends/spin/spin.y"
+    { yyval = NewStatement(yyvsp[0]); }
+#line 6657 "./build/spin.tab.c"
+    break;
+
+  case 41: /* stmt: "end of line"  */
+#line 653 "frontends/spin/spin.y"
+    { yyval = NULL; }
+#line 6663 "./build/spin.tab.c"
+    break;
+
+  case 42: /* stmt: error "end of line"  */
+#line 655 "frontends/spin/spin.y"
+    { yyval = NULL; }
+#line 6669 "./build/spin.tab.c"
+    break;
+
+  case 43: /* basicstmt: "RETURN" "end of line"  */
+#line 660 "frontends/spin/spin.y"
+    { yyval = AstReturn(NULL, yyvsp[-1]); }
+#line 6675 "./build/spin.tab.c"
+    break;
+
+  case 44: /* basicstmt: "RETURN" '(' exprlist ')' "end of line"  */
+#line 662 "frontends/spin/spin.y"
+    {
+        yyval = AstReturn(yyvsp[-2], yyvsp[-4]);
+    }
+#line 6683 "./build/spin.tab.c"
+    break;
+
+  case 45: /* basicstmt: "RETURN" exprlist "end of line"  */
+#line 666 "frontends/spin/spin.y"
+    { yyval = AstReturn(yyvsp[-1], yyvsp[-2]); }
+#line 6689 "./build/spin.tab.c"
+    break;
+
+  case 46: /* basicstmt: "ABORT" "end of line"  */
+#line 668 "frontends/spin/spin.y"
+    {
+        if (current && current->curLanguage == LANG_SPIN_SPIN2) {
+            // in Spin2 plain "abort" is the same as "abort 0"
+            yyval = AstAbort(AstInteger(0), yyvsp[-1]);
+        } else {
+            // in Spin1 plain "abort" should return the result variable
+            yyval = AstAbort(NULL, yyvsp[-1]);
+        }
+    }
+#line 6703 "./build/spin.tab.c"
+    break;
+
+  case 47: /* basicstmt: "ABORT" expr "end of line"  */
+#line 678 "frontends/spin/spin.y"
+    { yyval = AstAbort(yyvsp[-1], yyvsp[-2]); }
+#line 6709 "./build/spin.tab.c"
+    break;
+
+  case 49: /* basicstmt: expr "end of line"  */
+#line 681 "frontends/spin/spin.y"
+    { yyval = yyvsp[-1]; }
+#line 6715 "./build/spin.tab.c"
+    break;
+
+  case 50: /* basicstmt: "QUIT" "end of line"  */
+#line 683 "frontends/spin/spin.y"
+    { yyval = NewCommentedAST(AST_QUITLOOP, NULL, NULL, yyvsp[-1]); }
+#line 6721 "./build/spin.tab.c"
+    break;
+
+  case 51: /* basicstmt: "NEXT" "end of line"  */
+#line 685 "frontends/spin/spin.y"
+    { yyval = NewCommentedAST(AST_CONTINUE, NULL, NULL, yyvsp[-1]); }
+#line 6727 "./build/spin.tab.c"
+    break;
+
+  case 52: /* basicstmt: "DEBUG" '(' ')' "end of line"  */
+#line 687 "frontends/spin/spin.y"
+    {
+        AST *ast = NULL;
+        AST *comment = yyvsp[-3];
+        if (comment) {
+            ast = NewAST(AST_COMMENTEDNODE, ast, comment);
+        }
+        yyval = ast;
+    }
+#line 6740 "./build/spin.tab.c"
+    break;
+
+  case 53: /* basicstmt: "DEBUG" '(' debug_exprlist ')' "end of line"  */
+#line 696 "frontends/spin/spin.y"
+    {
+        AST *ast = BuildDebugList(yyvsp[-2]);
+        AST *comment = yyvsp[-4];
+        if (comment) {
+            ast = NewAST(AST_COMMENTEDNODE, ast, comment);
+        }
+        yyval = ast;
+    }
+#line 6753 "./build/spin.tab.c"
+    break;
+
+  case 54: /* debug_exprlist: debug_expritem_first  */
+#line 708 "frontends/spin/spin.y"
+     { yyval = yyvsp[0]; }
+#line 6759 "./build/spin.tab.c"
+    break;
+
+  case 55: /* debug_exprlist: debug_expritem_first ',' debug_exprlist_continue  */
+#line 710 "frontends/spin/spin.y"
+     { yyval = AddToList(yyvsp[-2], yyvsp[0]); }
+#line 6765 "./build/spin.tab.c"
+    break;
+
+  case 56: /* debug_exprlist_continue: debug_expritem  */
+#line 715 "frontends/spin/spin.y"
+     { yyval = yyvsp[0]; }
+#line 6771 "./build/spin.tab.c"
+    break;
+
+  case 57: /* debug_exprlist_continue: debug_exprlist_continue ',' debug_expritem  */
+#line 717 "frontends/spin/spin.y"
+     { yyval = AddToList(yyvsp[-2], yyvsp[0]); }
+#line 6777 "./build/spin.tab.c"
+    break;
+
+  case 58: /* debug_expritem_first: "` string"  */
+#line 722 "frontends/spin/spin.y"
+    {
+        yyval = NewAST(AST_EXPRLIST, yyvsp[0], NULL);
+    }
+#line 6785 "./build/spin.tab.c"
+    break;
+
+  case 59: /* debug_expritem_first: expritem  */
+#line 726 "frontends/spin/spin.y"
+    {
+        AST *list = yyvsp[0];
+        AST *note = NewAST(AST_LABEL, NULL, NULL);
+
+        yyval = NewAST(AST_EXPRLIST, note, list);
+    }
+#line 6796 "./build/spin.tab.c"
+    break;
+
+  case 60: /* debug_expritem: "` string"  */
+#line 735 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_EXPRLIST, yyvsp[0], NULL); }
+#line 6802 "./build/spin.tab.c"
+    break;
+
+  case 61: /* debug_expritem: expritem  */
+#line 737 "frontends/spin/spin.y"
+    { yyval = yyvsp[0]; }
+#line 6808 "./build/spin.tab.c"
+    break;
+
+  case 62: /* asmdebug_func: identifier '(' operandlist ')'  */
+#line 742 "frontends/spin/spin.y"
+    { yyval = MakeFunccall(yyvsp[-3],yyvsp[-1],NULL);}
+#line 6814 "./build/spin.tab.c"
+    break;
+
+  case 63: /* asmdebug_func: "IF" '(' operandlist ')'  */
+#line 744 "frontends/spin/spin.y"
+    { yyval = MakeFunccall(AstIdentifier("if"),yyvsp[-1],NULL);}
+#line 6820 "./build/spin.tab.c"
+    break;
+
+  case 64: /* asmdebug_func: "IFNOT" '(' operandlist ')'  */
+#line 746 "frontends/spin/spin.y"
+    { yyval = MakeFunccall(AstIdentifier("ifnot"),yyvsp[-1],NULL);}
+#line 6826 "./build/spin.tab.c"
+    break;
+
+  case 66: /* asmdebug_exprlist: asmdebug_expritem_first ',' asmdebug_exprlist_continue  */
+#line 752 "frontends/spin/spin.y"
+     { yyval = AddToList(yyvsp[-2], yyvsp[0]); }
+#line 6832 "./build/spin.tab.c"
+    break;
+
+  case 68: /* asmdebug_exprlist_continue: asmdebug_exprlist_continue ',' asmdebug_expritem  */
+#line 758 "frontends/spin/spin.y"
+     { yyval = AddToList(yyvsp[-2], yyvsp[0]); }
+#line 6838 "./build/spin.tab.c"
+    break;
+
+  case 69: /* asmdebug_expritem_first: "` string"  */
+#line 763 "frontends/spin/spin.y"
+    {
+        yyval = NewAST(AST_EXPRLIST, yyvsp[0], NULL);
+    }
+#line 6846 "./build/spin.tab.c"
+    break;
+
+  case 70: /* asmdebug_expritem_first: asmdebug_expritem  */
+#line 767 "frontends/spin/spin.y"
+    {
+        AST *list = yyvsp[0];
+        AST *note = NewAST(AST_LABEL, NULL, NULL);
+
+        yyval = NewAST(AST_EXPRLIST, note, list);
+    }
+#line 6857 "./build/spin.tab.c"
+    break;
+
+  case 71: /* asmdebug_expritem: "` string"  */
+#line 777 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_EXPRLIST, yyvsp[0], NULL); }
+#line 6863 "./build/spin.tab.c"
+    break;
+
+  case 72: /* asmdebug_expritem: string  */
+#line 779 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_EXPRLIST, yyvsp[0], NULL); }
+#line 6869 "./build/spin.tab.c"
+    break;
+
+  case 73: /* asmdebug_expritem: integer  */
+#line 781 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_EXPRLIST, yyvsp[0], NULL); }
+#line 6875 "./build/spin.tab.c"
+    break;
+
+  case 74: /* asmdebug_expritem: asmdebug_func  */
+#line 783 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_EXPRLIST, yyvsp[0], NULL); }
+#line 6881 "./build/spin.tab.c"
+    break;
+
+  case 75: /* multiassign: lhsseq ":=" '(' exprlist ')'  */
+#line 788 "frontends/spin/spin.y"
+    { yyval = AstAssignList(yyvsp[-4], yyvsp[-1], yyvsp[-3]); }
+#line 6887 "./build/spin.tab.c"
+    break;
+
+  case 76: /* multiassign: lhsseq ":=" exprlist  */
+#line 790 "frontends/spin/spin.y"
+    { yyval = AstAssignList(yyvsp[-2], yyvsp[0], yyvsp[-1]); }
+#line 6893 "./build/spin.tab.c"
+    break;
+
+  case 77: /* compoundstmt: ifstmt  */
+#line 794 "frontends/spin/spin.y"
+    { yyval = yyvsp[0]; }
+#line 6899 "./build/spin.tab.c"
+    break;
+
+  case 78: /* compoundstmt: repeatstmt  */
+#line 796 "frontends/spin/spin.y"
+    { yyval = yyvsp[0]; }
+#line 6905 "./build/spin.tab.c"
+    break;
+
+  case 79: /* compoundstmt: stmtblock  */
+#line 798 "frontends/spin/spin.y"
+    { yyval = yyvsp[0]; }
+#line 6911 "./build/spin.tab.c"
+    break;
+
+  case 80: /* compoundstmt: casestmt  */
+#line 800 "frontends/spin/spin.y"
+    { yyval = yyvsp[0]; }
+#line 6917 "./build/spin.tab.c"
+    break;
+
+  case 81: /* stmtblock: "indentation" stmtlist "lack of indentation"  */
+#line 805 "frontends/spin/spin.y"
+  { yyval = yyvsp[-1]; }
+#line 6923 "./build/spin.tab.c"
+    break;
+
+  case 82: /* stmtblock: "indentation" "lack of indentation"  */
+#line 807 "frontends/spin/spin.y"
+  { yyval = NULL; }
+#line 6929 "./build/spin.tab.c"
+    break;
+
+  case 83: /* ifstmt: "IF" expr "end of line" elseblock  */
+#line 812 "frontends/spin/spin.y"
+    { yyval = NewCommentedAST(AST_IF, yyvsp[-2], yyvsp[0], yyvsp[-3]); }
+#line 6935 "./build/spin.tab.c"
+    break;
+
+  case 84: /* ifstmt: "IFNOT" expr "end of line" elseblock  */
+#line 814 "frontends/spin/spin.y"
+    { yyval = NewCommentedAST(AST_IF, AstOperator(K_BOOL_NOT, NULL, yyvsp[-2]), yyvsp[0], yyvsp[-3]); }
+#line 6941 "./build/spin.tab.c"
+    break;
+
+  case 85: /* elseblock: stmtblock  */
+#line 819 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_THENELSE, yyvsp[0], NULL); }
+#line 6947 "./build/spin.tab.c"
+    break;
+
+  case 86: /* elseblock: stmtblock "ELSE" "end of line" stmtblock  */
+#line 821 "frontends/spin/spin.y"
+  { yyval = NewCommentedAST(AST_THENELSE, yyvsp[-3], yyvsp[0], yyvsp[-2]); }
+#line 6953 "./build/spin.tab.c"
+    break;
+
+  case 87: /* elseblock: stmtblock "ELSEIF" expr "end of line" elseblock  */
+#line 823 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_THENELSE, yyvsp[-4], NewAST(AST_STMTLIST, NewCommentedAST(AST_IF, yyvsp[-2], yyvsp[0], yyvsp[-3]), NULL)); }
+#line 6959 "./build/spin.tab.c"
+    break;
+
+  case 88: /* elseblock: stmtblock "ELSEIFNOT" expr "end of line" elseblock  */
+#line 825 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_THENELSE, yyvsp[-4], NewAST(AST_STMTLIST, NewCommentedAST(AST_IF, AstOperator(K_BOOL_NOT, NULL, yyvsp[-2]), yyvsp[0], yyvsp[-3]), NULL)); }
+#line 6965 "./build/spin.tab.c"
+    break;
+
+  case 89: /* casestmt: "CASE" expr "end of line" "indentation" casematchlist "lack of indentation"  */
+#line 830 "frontends/spin/spin.y"
+    { yyval = NewCommentedAST(AST_CASE, yyvsp[-4], yyvsp[-1], yyvsp[-5]); }
+#line 6971 "./build/spin.tab.c"
+    break;
+
+  case 90: /* casestmt: "CASE_FAST" expr "end of line" "indentation" casematchlist "lack of indentation"  */
+#line 832 "frontends/spin/spin.y"
+    { yyval = NewCommentedAST(AST_CASETABLE, yyvsp[-4], yyvsp[-1], yyvsp[-5]); }
+#line 6977 "./build/spin.tab.c"
+    break;
+
+  case 91: /* casematchlist: casematchitem  */
+#line 837 "frontends/spin/spin.y"
+    { yyval = yyvsp[0]; }
+#line 6983 "./build/spin.tab.c"
+    break;
+
+  case 92: /* casematchlist: casematchlist casematchitem  */
+#line 839 "frontends/spin/spin.y"
+    { yyval = AddToList(yyvsp[-1], yyvsp[0]); }
+#line 6989 "./build/spin.tab.c"
+    break;
+
+  case 93: /* casematchitem: casematch "end of line" stmtblock  */
+#line 844 "frontends/spin/spin.y"
+    {
+        AST *expr = yyvsp[-2];
+        AST *stmts = yyvsp[0];
+        AST *firststmt;
+        AST *breakstmt = NewAST(AST_ENDCASE, NULL, NULL);
+        stmts = AddToList(stmts, NewAST(AST_STMTLIST, breakstmt, NULL));
+        firststmt = stmts->left;
+        if (expr->kind == AST_OTHER) {
+            stmts->left = NewAST(AST_OTHER, firststmt, NULL);
+        } else {
+            stmts->left = NewAST(AST_CASEITEM, expr, firststmt);
+        }
+        yyval = stmts;
+    }
+#line 7008 "./build/spin.tab.c"
+    break;
+
+  case 94: /* casematch: matchexprlist ':'  */
+#line 862 "frontends/spin/spin.y"
+  {
+      yyval = yyvsp[-1];
+      EstablishIndent(current->Lptr, -1);
+      resetLineState(current->Lptr);
+  }
+#line 7018 "./build/spin.tab.c"
+    break;
+
+  case 96: /* matchexprlist: matchexprlist ',' matchexpritem  */
+#line 871 "frontends/spin/spin.y"
+    { yyval = AddToList(yyvsp[-2], yyvsp[0]); }
+#line 7024 "./build/spin.tab.c"
+    break;
+
+  case 97: /* matchexpritem: "OTHER"  */
+#line 876 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_OTHER, NULL, NULL); }
+#line 7030 "./build/spin.tab.c"
+    break;
+
+  case 98: /* matchexpritem: expr ".." expr  */
+#line 878 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_EXPRLIST, NewAST(AST_RANGE, yyvsp[-2], yyvsp[0]), NULL); }
+#line 7036 "./build/spin.tab.c"
+    break;
+
+  case 99: /* matchexpritem: expr  */
+#line 880 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_EXPRLIST, yyvsp[0], NULL); }
+#line 7042 "./build/spin.tab.c"
+    break;
+
+  case 100: /* rangeexpritem: expr  */
+#line 886 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_EXPRLIST, yyvsp[0], NULL); }
+#line 7048 "./build/spin.tab.c"
+    break;
+
+  case 101: /* rangeexpritem: expr ".." expr  */
+#line 888 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_EXPRLIST, NewAST(AST_RANGE, yyvsp[-2], yyvsp[0]), NULL); }
+#line 7054 "./build/spin.tab.c"
+    break;
+
+  case 103: /* rangeexprlist: rangeexprlist ',' rangeexpritem  */
+#line 894 "frontends/spin/spin.y"
+    { yyval = AddToList(yyvsp[-2], yyvsp[0]); }
+#line 7060 "./build/spin.tab.c"
+    break;
+
+  case 104: /* repeatstmt: "REPEAT" "end of line" stmtblock  */
+#line 899 "frontends/spin/spin.y"
+    {   AST *body = yyvsp[0]; body = CheckYield(body);
+        AST *one = AstInteger(1);
+        one->lineidx = yyvsp[-2]->lineidx;
+        yyval = NewCommentedAST(AST_WHILE, one, body, yyvsp[-2]);
+        yyval->lineidx = yyvsp[-2]->lineidx;
+    }
+#line 7071 "./build/spin.tab.c"
+    break;
+
+  case 105: /* repeatstmt: "REPEAT" "end of line" stmtblock "WHILE" expr "end of line"  */
+#line 906 "frontends/spin/spin.y"
+    { yyval = NewCommentedAST(AST_DOWHILE, yyvsp[-1], CheckYield(yyvsp[-3]), yyvsp[-5]); }
+#line 7077 "./build/spin.tab.c"
+    break;
+
+  case 106: /* repeatstmt: "REPEAT" "end of line" stmtblock "UNTIL" expr "end of line"  */
+#line 908 "frontends/spin/spin.y"
+    { yyval = NewCommentedAST(AST_DOWHILE, AstOperator(K_BOOL_NOT, NULL, yyvsp[-1]), CheckYield(yyvsp[-3]), yyvsp[-5]); }
+#line 7083 "./build/spin.tab.c"
+    break;
+
+  case 107: /* repeatstmt: "REPEAT" "WHILE" expr "end of line" stmtblock  */
+#line 910 "frontends/spin/spin.y"
+    {   AST *body = yyvsp[0]; body = CheckYield(body); 
+        yyval = NewCommentedAST(AST_WHILE, yyvsp[-2], body, yyvsp[-4]);
+        yyval->lineidx = yyvsp[-4]->lineidx;
+    }
+#line 7092 "./build/spin.tab.c"
+    break;
+
+  case 108: /* repeatstmt: "REPEAT" "UNTIL" expr "end of line" stmtblock  */
+#line 915 "frontends/spin/spin.y"
+    {   AST *body = yyvsp[0];
+        AST *expr = AstOperator(K_BOOL_NOT, NULL, yyvsp[-2]);
+        expr->lineidx = yyvsp[-2]->lineidx;
+        body = CheckYield(body); 
+        yyval = NewCommentedAST(AST_WHILE, expr, body, yyvsp[-4]);
+        yyval->lineidx = yyvsp[-4]->lineidx;
+    }
+#line 7104 "./build/spin.tab.c"
+    break;
+
+  case 109: /* repeatstmt: "REPEAT" identifier "FROM" expr "TO" expr "STEP" expr "end of line" stmtblock  */
+#line 923 "frontends/spin/spin.y"
+    {
+      AST *from, *to, *step; 
+      step = NewAST(AST_STEP, yyvsp[-2], yyvsp[0]);
+      to = NewAST(AST_TO, yyvsp[-4], step);
+      from = NewAST(AST_FROM, yyvsp[-6], to);
+      yyval = NewCommentedAST(AST_COUNTREPEAT, yyvsp[-8], from, yyvsp[-9]);
+    }
+#line 7116 "./build/spin.tab.c"
+    break;
+
+  case 110: /* repeatstmt: "REPEAT" identifier "FROM" expr "TO" expr "end of line" stmtblock  */
+#line 931 "frontends/spin/spin.y"
+    {
+      AST *from, *to, *step; 
+      step = NewAST(AST_STEP, AstInteger(1), yyvsp[0]);
+      to = NewAST(AST_TO, yyvsp[-2], step);
+      from = NewAST(AST_FROM, yyvsp[-4], to);
+      yyval = NewCommentedAST(AST_COUNTREPEAT, yyvsp[-6], from, yyvsp[-7]);
+    }
+#line 7128 "./build/spin.tab.c"
+    break;
+
+  case 111: /* repeatstmt: "REPEAT" expr "end of line" stmtblock  */
+#line 939 "frontends/spin/spin.y"
+    {
+      AST *from, *to, *step;
+      AST *body = yyvsp[0];
+      body = CheckYield(body);
+      step = NewAST(AST_STEP, AstInteger(1), body);
+      to = NewAST(AST_TO, yyvsp[-2], step);
+      from = NewAST(AST_FROM, NULL, to);
+      yyval = NewCommentedAST(AST_COUNTREPEAT, NULL, from, yyvsp[-3]);
+    }
+#line 7142 "./build/spin.tab.c"
+    break;
+
+  case 112: /* repeatstmt: "ASM" datblock "ENDASM"  */
+#line 949 "frontends/spin/spin.y"
+    {
+        AST *ast = NewCommentedAST(AST_INLINEASM, yyvsp[-1], AstInteger(0), yyvsp[-2]);
+        yyval = ast;
+        LANGUAGE_WARNING(LANG_ANY, NULL, "asm/endasm is a flexspin extension");
+    }
+#line 7152 "./build/spin.tab.c"
+    break;
+
+  case 113: /* repeatstmt: "ASM_CONST" datblock "ENDASM"  */
+#line 955 "frontends/spin/spin.y"
+    {
+        AST *ast = NewCommentedAST(AST_INLINEASM, yyvsp[-1], AstInteger(1), yyvsp[-2]);
+        yyval = ast;
+        LANGUAGE_WARNING(LANG_ANY, NULL, "asm/endasm is a flexspin extension");
+    }
+#line 7162 "./build/spin.tab.c"
+    break;
+
+  case 114: /* repeatstmt: "ORG" datblock "END"  */
+#line 961 "frontends/spin/spin.y"
+    {
+        // flag 3 means const (do not optimize) & FCACHE
+        AST *ast = NewCommentedAST(AST_INLINEASM, yyvsp[-1], AstInteger(3), yyvsp[-2]);
+        yyval = ast;
+    }
+#line 7172 "./build/spin.tab.c"
+    break;
+
+  case 115: /* repeatstmt: "CCODE"  */
+#line 967 "frontends/spin/spin.y"
+    {  yyval = yyvsp[0]; }
+#line 7178 "./build/spin.tab.c"
+    break;
+
+  case 116: /* lookupexpr: "LOOKUPZ" '(' expr ": after lookup/down" rangeexprlist ')'  */
+#line 972 "frontends/spin/spin.y"
+    { yyval = AstLookup(AST_LOOKUP, 0, yyvsp[-3], yyvsp[-1]); }
+#line 7184 "./build/spin.tab.c"
+    break;
+
+  case 117: /* lookupexpr: "LOOKUP" '(' expr ": after lookup/down" rangeexprlist ')'  */
+#line 974 "frontends/spin/spin.y"
+    { yyval = AstLookup(AST_LOOKUP, 1, yyvsp[-3], yyvsp[-1]); }
+#line 7190 "./build/spin.tab.c"
+    break;
+
+  case 118: /* lookdownexpr: "LOOKDOWNZ" '(' expr ": after lookup/down" rangeexprlist ')'  */
+#line 978 "frontends/spin/spin.y"
+    { yyval = AstLookup(AST_LOOKDOWN, 0, yyvsp[-3], yyvsp[-1]); }
+#line 7196 "./build/spin.tab.c"
+    break;
+
+  case 119: /* lookdownexpr: "LOOKDOWN" '(' expr ": after lookup/down" rangeexprlist ')'  */
+#line 980 "frontends/spin/spin.y"
+    { yyval = AstLookup(AST_LOOKDOWN, 1, yyvsp[-3], yyvsp[-1]); }
+#line 7202 "./build/spin.tab.c"
+    break;
+
+  case 120: /* conblock: conline  */
+#line 985 "frontends/spin/spin.y"
+  { yyval = yyvsp[0]; }
+#line 7208 "./build/spin.tab.c"
+    break;
+
+  case 121: /* conblock: conblock conline  */
+#line 987 "frontends/spin/spin.y"
+  { yyval = AddToList(yyvsp[-1], yyvsp[0]); }
+#line 7214 "./build/spin.tab.c"
+    break;
+
+  case 122: /* conline: enumlist "end of line"  */
+#line 992 "frontends/spin/spin.y"
+    { yyval = yyvsp[-1]; }
+#line 7220 "./build/spin.tab.c"
+    break;
+
+  case 123: /* conline: "end of line"  */
+#line 994 "frontends/spin/spin.y"
+    { yyval = NULL; }
+#line 7226 "./build/spin.tab.c"
+    break;
+
+  case 124: /* conline: error "end of line"  */
+#line 996 "frontends/spin/spin.y"
+    { yyval = NULL; }
+#line 7232 "./build/spin.tab.c"
+    break;
+
+  case 125: /* enumlist: enumitem  */
+#line 1001 "frontends/spin/spin.y"
+    { yyval = CommentedListHolder(yyvsp[0]); }
+#line 7238 "./build/spin.tab.c"
+    break;
+
+  case 126: /* enumlist: enumlist ',' enumitem  */
+#line 1003 "frontends/spin/spin.y"
+    { yyval = AddToList(yyvsp[-2], CommentedListHolder(yyvsp[0])); }
+#line 7244 "./build/spin.tab.c"
+    break;
+
+  case 127: /* enumitem: identifier '=' expr  */
+#line 1008 "frontends/spin/spin.y"
+  { yyval = NewAST(AST_ASSIGN, yyvsp[-2], yyvsp[0]); }
+#line 7250 "./build/spin.tab.c"
+    break;
+
+  case 128: /* enumitem: identifier  */
+#line 1010 "frontends/spin/spin.y"
+  { yyval = yyvsp[0]; }
+#line 7256 "./build/spin.tab.c"
+    break;
+
+  case 129: /* enumitem: identifier '[' expr ']'  */
+#line 1012 "frontends/spin/spin.y"
+    {
+        yyval = NewAST(AST_ENUMSKIP, yyvsp[-3], yyvsp[-1]);
+    }
+#line 7264 "./build/spin.tab.c"
+    break;
+
+  case 130: /* enumitem: '#' expr  */
+#line 1016 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_ENUMSET, yyvsp[0], NULL); }
+#line 7270 "./build/spin.tab.c"
+    break;
+
+  case 131: /* enumitem: '#' expr '[' expr ']'  */
+#line 1018 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_ENUMSET, yyvsp[-3], yyvsp[-1]); }
+#line 7276 "./build/spin.tab.c"
+    break;
+
+  case 132: /* datblock: datline  */
+#line 1023 "frontends/spin/spin.y"
+    {
+        AST *dat = yyvsp[0];
+        yyval = dat; //NewAST(AST_LISTHOLDER, dat, NULL);
+        current->parse_tail = NULL;
+    }
+#line 7286 "./build/spin.tab.c"
+    break;
+
+  case 133: /* datblock: datblock datline  */
+#line 1029 "frontends/spin/spin.y"
+    { yyval = AddToListEx(yyvsp[-1], yyvsp[0], &current->parse_tail); }
+#line 7292 "./build/spin.tab.c"
+    break;
+
+  case 135: /* datline: identifier basedatline  */
+#line 1035 "frontends/spin/spin.y"
+    {   AST *linebreak;
+        AST *comment = GetComments();
+        AST *ast;
+        ast = yyvsp[-1];
+        if (comment && (comment->d.string || comment->kind == AST_SRCCOMMENT)) {
+            linebreak = NewCommentedAST(AST_LINEBREAK, NULL, NULL, comment);
+        } else {
+            linebreak = NewAST(AST_LINEBREAK, NULL, NULL);
+        }
+        ast = AddToList(ast, yyvsp[0]);
+        ast = AddToList(linebreak, ast);
+        yyval = ast;
+    }
+#line 7310 "./build/spin.tab.c"
+    break;
+
+  case 136: /* basedatline: "end of line"  */
+#line 1052 "frontends/spin/spin.y"
+    { yyval = NULL; }
+#line 7316 "./build/spin.tab.c"
+    break;
+
+  case 137: /* basedatline: error "end of line"  */
+#line 1054 "frontends/spin/spin.y"
+    { yyval = NULL; }
+#line 7322 "./build/spin.tab.c"
+    break;
+
+  case 138: /* basedatline: "BYTE" "end of line"  */
+#line 1056 "frontends/spin/spin.y"
+    { yyval = NewCommentedAST(AST_BYTELIST, NULL, NULL, yyvsp[-1]); }
+#line 7328 "./build/spin.tab.c"
+    break;
+
+  case 139: /* basedatline: "BYTE" datexprlist "end of line"  */
+#line 1058 "frontends/spin/spin.y"
+    { yyval = NewCommentedAST(AST_BYTELIST, FixupList(yyvsp[-1]), NULL, yyvsp[-2]); }
+#line 7334 "./build/spin.tab.c"
+    break;
+
+  case 140: /* basedatline: "WORD" "end of line"  */
+#line 1060 "frontends/spin/spin.y"
+    { yyval = NewCommentedAST(AST_WORDLIST, NULL, NULL, yyvsp[-1]); }
+#line 7340 "./build/spin.tab.c"
+    break;
+
+  case 141: /* basedatline: "WORD" datexprlist "end of line"  */
+#line 1062 "frontends/spin/spin.y"
+    { yyval = NewCommentedAST(AST_WORDLIST, FixupList(yyvsp[-1]), NULL, yyvsp[-2]); }
+#line 7346 "./build/spin.tab.c"
+    break;
+
+  case 142: /* basedatline: "BYTEFIT" "end of line"  */
+#line 1064 "frontends/spin/spin.y"
+    { yyval = NewCommentedAST(AST_BYTELIST, NULL, NULL, yyvsp[-1]); }
+#line 7352 "./build/spin.tab.c"
+    break;
+
+  case 143: /* basedatline: "BYTEFIT" datexprlist "end of line"  */
+#line 1066 "frontends/spin/spin.y"
+    {
+        yyval = NewCommentedAST(AST_BYTEFITLIST, FixupList(yyvsp[-1]), NULL, yyvsp[-2]);
+    }
+#line 7360 "./build/spin.tab.c"
+    break;
+
+  case 144: /* basedatline: "WORDFIT" "end of line"  */
+#line 1070 "frontends/spin/spin.y"
+    {
+        yyval = NewCommentedAST(AST_WORDLIST, NULL, NULL, yyvsp[-1]);
+    }
+#line 7368 "./build/spin.tab.c"
+    break;
+
+  case 145: /* basedatline: "WORDFIT" datexprlist "end of line"  */
+#line 1074 "frontends/spin/spin.y"
+    { yyval = NewCommentedAST(AST_WORDFITLIST, FixupList(yyvsp[-1]), NULL, yyvsp[-2]); }
+#line 7374 "./build/spin.tab.c"
+    break;
+
+  case 146: /* basedatline: "LONG" "end of line"  */
+#line 1076 "frontends/spin/spin.y"
+    { yyval = NewCommentedAST(AST_LONGLIST, NULL, NULL, yyvsp[-1]); }
+#line 7380 "./build/spin.tab.c"
+    break;
+
+  case 147: /* basedatline: "LONG" datexprlist "end of line"  */
+#line 1078 "frontends/spin/spin.y"
+    { yyval = NewCommentedAST(AST_LONGLIST, FixupList(yyvsp[-1]), NULL, yyvsp[-2]); }
+#line 7386 "./build/spin.tab.c"
+    break;
+
+  case 148: /* basedatline: instruction "end of line"  */
+#line 1080 "frontends/spin/spin.y"
+    { yyval = NewCommentedInstr(yyvsp[-1]); }
+#line 7392 "./build/spin.tab.c"
+    break;
+
+  case 149: /* basedatline: instruction operandlist "end of line"  */
+#line 1082 "frontends/spin/spin.y"
+    { yyval = NewCommentedInstr(AddToList(yyvsp[-2], yyvsp[-1])); }
+#line 7398 "./build/spin.tab.c"
+    break;
+
+  case 150: /* basedatline: instruction modifierlist "end of line"  */
+#line 1084 "frontends/spin/spin.y"
+    { yyval = NewCommentedInstr(AddToList(yyvsp[-2], yyvsp[-1])); }
+#line 7404 "./build/spin.tab.c"
+    break;
+
+  case 151: /* basedatline: instruction operandlist modifierlist "end of line"  */
+#line 1086 "frontends/spin/spin.y"
+    { yyval = NewCommentedInstr(AddToList(yyvsp[-3], AddToList(yyvsp[-2], yyvsp[-1]))); }
+#line 7410 "./build/spin.tab.c"
+    break;
+
+  case 152: /* basedatline: "ALIGNL" "end of line"  */
+#line 1088 "frontends/spin/spin.y"
+    { yyval = NewCommentedAST(AST_ALIGN, AstInteger(4), NULL, yyvsp[-1]); }
+#line 7416 "./build/spin.tab.c"
+    break;
+
+  case 153: /* basedatline: "ALIGNW" "end of line"  */
+#line 1090 "frontends/spin/spin.y"
+    { yyval = NewCommentedAST(AST_ALIGN, AstInteger(2), NULL, yyvsp[-1]); }
+#line 7422 "./build/spin.tab.c"
+    break;
+
+  case 154: /* basedatline: "ORG" "end of line"  */
+#line 1092 "frontends/spin/spin.y"
+    { yyval = NewCommentedAST(AST_ORG, NULL, NULL, yyvsp[-1]); }
+#line 7428 "./build/spin.tab.c"
+    break;
+
+  case 155: /* basedatline: "ORG" expr "end of line"  */
+#line 1094 "frontends/spin/spin.y"
+    { yyval = NewCommentedAST(AST_ORG, yyvsp[-1], NULL, yyvsp[-2]); }
+#line 7434 "./build/spin.tab.c"
+    break;
+
+  case 156: /* basedatline: "ORG" expr ',' expr "end of line"  */
+#line 1096 "frontends/spin/spin.y"
+    {
+        AST *src = yyvsp[-3];
+        WARNING(src, "second parameter of ORG is ignored");
+        yyval = NewCommentedAST(AST_ORG, src, NULL, yyvsp[-4]);
+    }
+#line 7444 "./build/spin.tab.c"
+    break;
+
+  case 157: /* basedatline: "ORGH" "end of line"  */
+#line 1102 "frontends/spin/spin.y"
+    { yyval = NewCommentedAST(AST_ORGH, NULL, NULL, yyvsp[-1]); }
+#line 7450 "./build/spin.tab.c"
+    break;
+
+  case 158: /* basedatline: "ORGH" expr "end of line"  */
+#line 1104 "frontends/spin/spin.y"
+    { yyval = NewCommentedAST(AST_ORGH, yyvsp[-1], NULL, yyvsp[-2]); }
+#line 7456 "./build/spin.tab.c"
+    break;
+
+  case 159: /* basedatline: "ORGF" expr "end of line"  */
+#line 1106 "frontends/spin/spin.y"
+    { yyval = NewCommentedAST(AST_ORGF, yyvsp[-1], NULL, yyvsp[-2]); }
+#line 7462 "./build/spin.tab.c"
+    break;
+
+  case 160: /* basedatline: "RES" expr "end of line"  */
+#line 1108 "frontends/spin/spin.y"
+    { yyval = NewCommentedAST(AST_RES, yyvsp[-1], NULL, yyvsp[-2]); }
+#line 7468 "./build/spin.tab.c"
+    break;
+
+  case 161: /* basedatline: "FIT" expr "end of line"  */
+#line 1110 "frontends/spin/spin.y"
+    { yyval = NewCommentedAST(AST_FIT, yyvsp[-1], NULL, yyvsp[-2]); }
+#line 7474 "./build/spin.tab.c"
+    break;
+
+  case 162: /* basedatline: "FIT" "end of line"  */
+#line 1112 "frontends/spin/spin.y"
+    { yyval = NewCommentedAST(AST_FIT, AstInteger(0x1f0), NULL, yyvsp[-1]); }
+#line 7480 "./build/spin.tab.c"
+    break;
+
+  case 163: /* basedatline: "FILE" string "end of line"  */
+#line 1114 "frontends/spin/spin.y"
+    { yyval = NewCommentedAST(AST_FILE, GetFullFileName(yyvsp[-1]), NULL, yyvsp[-2]); }
+#line 7486 "./build/spin.tab.c"
+    break;
+
+  case 164: /* basedatline: "DEBUG" '(' ')' "end of line"  */
+#line 1116 "frontends/spin/spin.y"
+    {
+        if (!gl_brkdebug) {
+          // for now just ignore DEBUG in PASM
+          yyval = NULL;
+        } else {
+          // TODO: What does empty debug do??
+          yyval = NULL;
+        }
+    }
+#line 7500 "./build/spin.tab.c"
+    break;
+
+  case 165: /* basedatline: "DEBUG" '(' asmdebug_exprlist ')' "end of line"  */
+#line 1126 "frontends/spin/spin.y"
+    {
+        AST *ast = NULL;
+        if (gl_brkdebug) {
+          ast = NewAST(AST_BRKDEBUG,yyvsp[-2],NULL);
+        }
+        if (yyvsp[-4]) {
+            ast = NewAST(AST_COMMENTEDNODE, ast, yyvsp[-4]);
+        }
+        yyval = ast;
+    }
+#line 7515 "./build/spin.tab.c"
+    break;
+
+  case 166: /* basedatline: "ASMCLK"  */
+#line 1137 "frontends/spin/spin.y"
+  {
+      SYNTAX_ERROR("ASMCLK instruction is not supported");
+  }
+#line 7523 "./build/spin.tab.c"
+    break;
+
+  case 167: /* objblock: objline  */
+#line 1144 "frontends/spin/spin.y"
+  { yyval = yyvsp[0]; }
+#line 7529 "./build/spin.tab.c"
+    break;
+
+  case 168: /* objblock: objblock objline  */
+#line 1146 "frontends/spin/spin.y"
+  { yyval = AddToList(yyvsp[-1], yyvsp[0]); }
+#line 7535 "./build/spin.tab.c"
+    break;
+
+  case 169: /* objline: "end of line"  */
+#line 1151 "frontends/spin/spin.y"
+    { yyval = NULL; }
+#line 7541 "./build/spin.tab.c"
+    break;
+
+  case 170: /* objline: error "end of line"  */
+#line 1153 "frontends/spin/spin.y"
+    { yyval = NULL; }
+#line 7547 "./build/spin.tab.c"
+    break;
+
+  case 171: /* objline: identdecl ':' string  */
+#line 1155 "frontends/spin/spin.y"
+    {
+        AST *typ = NewObject(yyvsp[-2], yyvsp[0]);
+        /* last parameter is 1 for a private member */
+        DeclareOneMemberVar(current, yyvsp[-2], typ, 0);
+        yyval = typ;
+    }
+#line 7558 "./build/spin.tab.c"
+    break;
+
+  case 172: /* objline: identdecl '=' string  */
+#line 1162 "frontends/spin/spin.y"
+    {
+        AST *typ = NewAbstractObject(yyvsp[-2], yyvsp[0]);
+        AST *ident = yyvsp[-2];
+        const char *name = GetIdentifierName(ident);
+        AddSymbol(&current->objsyms, name, SYM_TYPEDEF, typ, NULL);
+        yyval = typ;
+    }
+#line 7570 "./build/spin.tab.c"
+    break;
+
+  case 173: /* varblock: varline  */
+#line 1173 "frontends/spin/spin.y"
+    { yyval = CommentedListHolder(yyvsp[0]); }
+#line 7576 "./build/spin.tab.c"
+    break;
+
+  case 174: /* varblock: varblock varline  */
+#line 1175 "frontends/spin/spin.y"
+    { yyval = AddToList(yyvsp[-1], CommentedListHolder(yyvsp[0])); }
+#line 7582 "./build/spin.tab.c"
+    break;
+
+  case 175: /* varline: "BYTE" identlist "end of line"  */
+#line 1180 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_BYTELIST, yyvsp[-1], NULL); }
+#line 7588 "./build/spin.tab.c"
+    break;
+
+  case 176: /* varline: "WORD" identlist "end of line"  */
+#line 1182 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_WORDLIST, yyvsp[-1], NULL); }
+#line 7594 "./build/spin.tab.c"
+    break;
+
+  case 177: /* varline: "LONG" identlist "end of line"  */
+#line 1184 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_LONGLIST, yyvsp[-1], NULL); }
+#line 7600 "./build/spin.tab.c"
+    break;
+
+  case 178: /* varline: identdecl "end of line"  */
+#line 1186 "frontends/spin/spin.y"
+    {
+        AST *decl = NewAST(AST_LISTHOLDER, yyvsp[-1], NULL);
+        yyval = NewAST(AST_LONGLIST, decl, NULL);
+    }
+#line 7609 "./build/spin.tab.c"
+    break;
+
+  case 179: /* varline: "ALIGNL" "end of line"  */
+#line 1191 "frontends/spin/spin.y"
+    { yyval = NewCommentedAST(AST_ALIGN, AstInteger(4), NULL, yyvsp[-1]); }
+#line 7615 "./build/spin.tab.c"
+    break;
+
+  case 180: /* varline: "ALIGNW" "end of line"  */
+#line 1193 "frontends/spin/spin.y"
+    { yyval = NewCommentedAST(AST_ALIGN, AstInteger(2), NULL, yyvsp[-1]); }
+#line 7621 "./build/spin.tab.c"
+    break;
+
+  case 181: /* varline: "end of line"  */
+#line 1195 "frontends/spin/spin.y"
+    { yyval = NULL; }
+#line 7627 "./build/spin.tab.c"
+    break;
+
+  case 182: /* varline: error "end of line"  */
+#line 1197 "frontends/spin/spin.y"
+    { yyval = NULL; }
+#line 7633 "./build/spin.tab.c"
+    break;
+
+  case 183: /* identlist: identdecl  */
+#line 1202 "frontends/spin/spin.y"
+  { yyval = NewAST(AST_LISTHOLDER, yyvsp[0], NULL); }
+#line 7639 "./build/spin.tab.c"
+    break;
+
+  case 184: /* identlist: annotation identdecl  */
+#line 1204 "frontends/spin/spin.y"
+  { yyval = AddToList(NewAST(AST_LISTHOLDER, yyvsp[-1], NULL),
+                   NewAST(AST_LISTHOLDER, yyvsp[0], NULL)); }
+#line 7646 "./build/spin.tab.c"
+    break;
+
+  case 185: /* identlist: identlist ',' identdecl  */
+#line 1207 "frontends/spin/spin.y"
+  { yyval = AddToList(yyvsp[-2], NewAST(AST_LISTHOLDER, yyvsp[0], NULL)); }
+#line 7652 "./build/spin.tab.c"
+    break;
+
+  case 186: /* identdecl: identifier  */
+#line 1212 "frontends/spin/spin.y"
+  { yyval = yyvsp[0]; }
+#line 7658 "./build/spin.tab.c"
+    break;
+
+  case 187: /* identdecl: identifier '[' expr ']'  */
+#line 1214 "frontends/spin/spin.y"
+  { yyval = NewAST(AST_ARRAYDECL, yyvsp[-3], yyvsp[-1]); }
+#line 7664 "./build/spin.tab.c"
+    break;
+
+  case 188: /* vardecl: identdecl  */
+#line 1219 "frontends/spin/spin.y"
+    { yyval = yyvsp[0]; }
+#line 7670 "./build/spin.tab.c"
+    break;
+
+  case 189: /* vardecl: "BYTE" identdecl  */
+#line 1221 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_DECLARE_VAR, ast_type_byte, yyvsp[0]); }
+#line 7676 "./build/spin.tab.c"
+    break;
+
+  case 190: /* vardecl: "WORD" identdecl  */
+#line 1223 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_DECLARE_VAR, ast_type_word, yyvsp[0]); }
+#line 7682 "./build/spin.tab.c"
+    break;
+
+  case 191: /* vardecl: "LONG" identdecl  */
+#line 1225 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_DECLARE_VAR, NULL, yyvsp[0]); }
+#line 7688 "./build/spin.tab.c"
+    break;
+
+  case 192: /* vardecllist: vardecl  */
+#line 1230 "frontends/spin/spin.y"
+      { yyval = NewAST(AST_LISTHOLDER, yyvsp[0], NULL); }
+#line 7694 "./build/spin.tab.c"
+    break;
+
+  case 193: /* vardecllist: vardecllist ',' vardecl  */
+#line 1232 "frontends/spin/spin.y"
+      { yyval = AddToList(yyvsp[-2], NewAST(AST_LISTHOLDER, yyvsp[0], NULL)); }
+#line 7700 "./build/spin.tab.c"
+    break;
+
+  case 194: /* paramidentdecl: identifier  */
+#line 1237 "frontends/spin/spin.y"
+  { yyval = yyvsp[0]; }
+#line 7706 "./build/spin.tab.c"
+    break;
+
+  case 195: /* paramidentdecl: identifier '[' expr ']'  */
+#line 1239 "frontends/spin/spin.y"
+  { yyval = NewAST(AST_ARRAYDECL, yyvsp[-3], yyvsp[-1]); }
+#line 7712 "./build/spin.tab.c"
+    break;
+
+  case 196: /* paramidentdecl: identifier '=' expr  */
+#line 1241 "frontends/spin/spin.y"
+  {
+      LANGUAGE_WARNING(LANG_ANY, yyvsp[-2], "default parameter values are a flexspin extension");
+      yyval = AstAssign(yyvsp[-2], yyvsp[0]);
+  }
+#line 7721 "./build/spin.tab.c"
+    break;
+
+  case 197: /* paramidentdecl: identifier '=' "LONG"  */
+#line 1246 "frontends/spin/spin.y"
+  {
+      LANGUAGE_WARNING(LANG_ANY, yyvsp[-2], "parameter types are a flexspin extension");
+      yyval = NewAST(AST_DECLARE_VAR, ast_type_long, yyvsp[-2]);
+  }
+#line 7730 "./build/spin.tab.c"
+    break;
+
+  case 198: /* paramidentdecl: identifier '=' '-' "LONG"  */
+#line 1251 "frontends/spin/spin.y"
+  {
+      LANGUAGE_WARNING(LANG_ANY, yyvsp[-3], "parameter types are a flexspin extension");
+      yyval = NewAST(AST_DECLARE_VAR, ast_type_long, yyvsp[-3]);
+  }
+#line 7739 "./build/spin.tab.c"
+    break;
+
+  case 199: /* paramidentdecl: identifier '=' '+' "LONG"  */
+#line 1256 "frontends/spin/spin.y"
+  {
+      LANGUAGE_WARNING(LANG_ANY, yyvsp[-3], "parameter types are a flexspin extension");
+      yyval = NewAST(AST_DECLARE_VAR, ast_type_unsigned_long, yyvsp[-3]);
+  }
+#line 7748 "./build/spin.tab.c"
+    break;
+
+  case 200: /* paramidentdecl: identifier '=' '>' "LONG"  */
+#line 1261 "frontends/spin/spin.y"
+  {
+      LANGUAGE_WARNING(LANG_ANY, yyvsp[-3], "parameter types are a flexspin extension");
+      yyval = NewAST(AST_DECLARE_VAR, ast_type_long64, yyvsp[-3]);
+  }
+#line 7757 "./build/spin.tab.c"
+    break;
+
+  case 201: /* paramidentdecl: identifier '=' '>' '+' "LONG"  */
+#line 1266 "frontends/spin/spin.y"
+  {
+      LANGUAGE_WARNING(LANG_ANY, yyvsp[-4], "parameter types are a flexspin extension");
+      yyval = NewAST(AST_DECLARE_VAR, ast_type_unsigned_long64, yyvsp[-4]);
+  }
+#line 7766 "./build/spin.tab.c"
+    break;
+
+  case 202: /* paramidentdecl: identifier '=' "floating point number"  */
+#line 1271 "frontends/spin/spin.y"
+  {
+      LANGUAGE_WARNING(LANG_ANY, yyvsp[-2], "parameter types are a flexspin extension");
+      yyval = NewAST(AST_DECLARE_VAR, ast_type_float, yyvsp[-2]);
+  }
+#line 7775 "./build/spin.tab.c"
+    break;
+
+  case 203: /* paramidentdecl: identifier '=' '@' "LONG"  */
+#line 1276 "frontends/spin/spin.y"
+  {
+      LANGUAGE_WARNING(LANG_ANY, yyvsp[-3], "parameter types are a flexspin extension");
+      yyval = NewAST(AST_DECLARE_VAR, ast_type_ptr_long, yyvsp[-3]);
+  }
+#line 7784 "./build/spin.tab.c"
+    break;
+
+  case 204: /* paramidentdecl: identifier '=' '@' "WORD"  */
+#line 1281 "frontends/spin/spin.y"
+  {
+      LANGUAGE_WARNING(LANG_ANY, yyvsp[-3], "parameter types are a flexspin extension");
+      yyval = NewAST(AST_DECLARE_VAR, ast_type_ptr_word, yyvsp[-3]);
+  }
+#line 7793 "./build/spin.tab.c"
+    break;
+
+  case 205: /* paramidentdecl: identifier '=' '@' "BYTE"  */
+#line 1286 "frontends/spin/spin.y"
+  {
+      LANGUAGE_WARNING(LANG_ANY, yyvsp[-3], "parameter types are a flexspin extension");
+      yyval = NewAST(AST_DECLARE_VAR, ast_type_ptr_byte, yyvsp[-3]);
+  }
+#line 7802 "./build/spin.tab.c"
+    break;
+
+  case 206: /* paramidentdecl: identifier '=' "STRING"  */
+#line 1291 "frontends/spin/spin.y"
+  {
+      LANGUAGE_WARNING(LANG_ANY, yyvsp[-2], "parameter types are a flexspin extension");
+      yyval = NewAST(AST_DECLARE_VAR, ast_type_string, yyvsp[-2]);
+  }
+#line 7811 "./build/spin.tab.c"
+    break;
+
+  case 207: /* paramidentlist: paramidentdecl  */
+#line 1299 "frontends/spin/spin.y"
+  { yyval = NewAST(AST_LISTHOLDER, yyvsp[0], NULL); }
+#line 7817 "./build/spin.tab.c"
+    break;
+
+  case 208: /* paramidentlist: annotation paramidentdecl  */
+#line 1301 "frontends/spin/spin.y"
+  { yyval = AddToList(NewAST(AST_LISTHOLDER, yyvsp[-1], NULL),
+                   NewAST(AST_LISTHOLDER, yyvsp[0], NULL)); }
+#line 7824 "./build/spin.tab.c"
+    break;
+
+  case 209: /* paramidentlist: paramidentlist ',' paramidentdecl  */
+#line 1304 "frontends/spin/spin.y"
+  { yyval = AddToList(yyvsp[-2], NewAST(AST_LISTHOLDER, yyvsp[0], NULL)); }
+#line 7830 "./build/spin.tab.c"
+    break;
+
+  case 213: /* expr: "STRING" '(' exprlist ')'  */
+#line 1312 "frontends/spin/spin.y"
+    {
+        AST *elist = yyvsp[-1];
+        yyval = NewAST(AST_STRINGPTR, elist, NULL);
+    }
+#line 7839 "./build/spin.tab.c"
+    break;
+
+  case 215: /* expr: '@' expr  */
+#line 1318 "frontends/spin/spin.y"
+    {
+        AST *e = yyvsp[0];
+        if (e && e->kind == AST_STRING) {
+            yyval = NewAST(AST_STRINGPTR,
+                        NewAST(AST_EXPRLIST, e, NULL),
+                        NULL);
+        } else {
+            yyval = NewAST(AST_ADDROF, e, NULL);
+        }
+    }
+#line 7854 "./build/spin.tab.c"
+    break;
+
+  case 216: /* expr: "@@" expr  */
+#line 1329 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_DATADDROF, yyvsp[0], NULL); }
+#line 7860 "./build/spin.tab.c"
+    break;
+
+  case 217: /* expr: "@@@" expr  */
+#line 1331 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_ABSADDROF, yyvsp[0], NULL); }
+#line 7866 "./build/spin.tab.c"
+    break;
+
+  case 218: /* expr: lhs ":=" expr  */
+#line 1333 "frontends/spin/spin.y"
+    { yyval = AstAssign(yyvsp[-2], yyvsp[0]); }
+#line 7872 "./build/spin.tab.c"
+    break;
+
+  case 219: /* expr: identifier '#' identifier  */
+#line 1335 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_CONSTREF, yyvsp[-2], yyvsp[0]); }
+#line 7878 "./build/spin.tab.c"
+    break;
+
+  case 220: /* expr: lhs '\\' expr  */
+#line 1337 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_POSTSET, yyvsp[-2], yyvsp[0]); }
+#line 7884 "./build/spin.tab.c"
+    break;
+
+  case 221: /* expr: expr '+' expr  */
+#line 1339 "frontends/spin/spin.y"
+    { yyval = AstOperator('+', yyvsp[-2], yyvsp[0]); }
+#line 7890 "./build/spin.tab.c"
+    break;
+
+  case 222: /* expr: expr '-' expr  */
+#line 1341 "frontends/spin/spin.y"
+    { yyval = AstOperator('-', yyvsp[-2], yyvsp[0]); }
+#line 7896 "./build/spin.tab.c"
+    break;
+
+  case 223: /* expr: expr '*' expr  */
+#line 1343 "frontends/spin/spin.y"
+    { yyval = AstOperator('*', yyvsp[-2], yyvsp[0]); }
+#line 7902 "./build/spin.tab.c"
+    break;
+
+  case 224: /* expr: expr '/' expr  */
+#line 1345 "frontends/spin/spin.y"
+    { yyval = AstOperator('/', yyvsp[-2], yyvsp[0]); }
+#line 7908 "./build/spin.tab.c"
+    break;
+
+  case 225: /* expr: expr '&' expr  */
+#line 1347 "frontends/spin/spin.y"
+    { yyval = AstOperator('&', yyvsp[-2], yyvsp[0]); }
+#line 7914 "./build/spin.tab.c"
+    break;
+
+  case 226: /* expr: expr '|' expr  */
+#line 1349 "frontends/spin/spin.y"
+    { yyval = AstOperator('|', yyvsp[-2], yyvsp[0]); }
+#line 7920 "./build/spin.tab.c"
+    break;
+
+  case 227: /* expr: expr '^' expr  */
+#line 1351 "frontends/spin/spin.y"
+    { yyval = AstOperator('^', yyvsp[-2], yyvsp[0]); }
+#line 7926 "./build/spin.tab.c"
+    break;
+
+  case 228: /* expr: expr '>' expr  */
+#line 1353 "frontends/spin/spin.y"
+    { yyval = AstOperator('>', yyvsp[-2], yyvsp[0]); }
+#line 7932 "./build/spin.tab.c"
+    break;
+
+  case 229: /* expr: expr '<' expr  */
+#line 1355 "frontends/spin/spin.y"
+    { yyval = AstOperator('<', yyvsp[-2], yyvsp[0]); }
+#line 7938 "./build/spin.tab.c"
+    break;
+
+  case 230: /* expr: expr "=>" expr  */
+#line 1357 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_GE, yyvsp[-2], yyvsp[0]); }
+#line 7944 "./build/spin.tab.c"
+    break;
+
+  case 231: /* expr: expr "=<" expr  */
+#line 1359 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_LE, yyvsp[-2], yyvsp[0]); }
+#line 7950 "./build/spin.tab.c"
+    break;
+
+  case 232: /* expr: expr "+=>" expr  */
+#line 1361 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_GEU, yyvsp[-2], yyvsp[0]); }
+#line 7956 "./build/spin.tab.c"
+    break;
+
+  case 233: /* expr: expr "+=<" expr  */
+#line 1363 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_LEU, yyvsp[-2], yyvsp[0]); }
+#line 7962 "./build/spin.tab.c"
+    break;
+
+  case 234: /* expr: expr "+>" expr  */
+#line 1365 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_GTU, yyvsp[-2], yyvsp[0]); }
+#line 7968 "./build/spin.tab.c"
+    break;
+
+  case 235: /* expr: expr "+<" expr  */
+#line 1367 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_LTU, yyvsp[-2], yyvsp[0]); }
+#line 7974 "./build/spin.tab.c"
+    break;
+
+  case 236: /* expr: expr "<>" expr  */
+#line 1369 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_NE, yyvsp[-2], yyvsp[0]); }
+#line 7980 "./build/spin.tab.c"
+    break;
+
+  case 237: /* expr: expr "==" expr  */
+#line 1371 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_EQ, yyvsp[-2], yyvsp[0]); }
+#line 7986 "./build/spin.tab.c"
+    break;
+
+  case 238: /* expr: expr "<=>" expr  */
+#line 1373 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_SGNCOMP, yyvsp[-2], yyvsp[0]); }
+#line 7992 "./build/spin.tab.c"
+    break;
+
+  case 239: /* expr: expr "==." expr  */
+#line 1375 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_FEQ, yyvsp[-2], yyvsp[0]); }
+#line 7998 "./build/spin.tab.c"
+    break;
+
+  case 240: /* expr: expr "<>." expr  */
+#line 1377 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_FNE, yyvsp[-2], yyvsp[0]); }
+#line 8004 "./build/spin.tab.c"
+    break;
+
+  case 241: /* expr: expr ">." expr  */
+#line 1379 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_FGT, yyvsp[-2], yyvsp[0]); }
+#line 8010 "./build/spin.tab.c"
+    break;
+
+  case 242: /* expr: expr "<." expr  */
+#line 1381 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_FLT, yyvsp[-2], yyvsp[0]); }
+#line 8016 "./build/spin.tab.c"
+    break;
+
+  case 243: /* expr: expr ">=." expr  */
+#line 1383 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_FGE, yyvsp[-2], yyvsp[0]); }
+#line 8022 "./build/spin.tab.c"
+    break;
+
+  case 244: /* expr: expr "<=." expr  */
+#line 1385 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_FLE, yyvsp[-2], yyvsp[0]); }
+#line 8028 "./build/spin.tab.c"
+    break;
+
+  case 245: /* expr: expr '<' "=>" expr  */
+#line 1388 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_SGNCOMP, yyvsp[-3], yyvsp[0]); }
+#line 8034 "./build/spin.tab.c"
+    break;
+
+  case 246: /* expr: expr "//" expr  */
+#line 1390 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_MODULUS, yyvsp[-2], yyvsp[0]); }
+#line 8040 "./build/spin.tab.c"
+    break;
+
+  case 247: /* expr: expr "+/" expr  */
+#line 1392 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_UNS_DIV, yyvsp[-2], yyvsp[0]); }
+#line 8046 "./build/spin.tab.c"
+    break;
+
+  case 248: /* expr: expr "+//" expr  */
+#line 1394 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_UNS_MOD, yyvsp[-2], yyvsp[0]); }
+#line 8052 "./build/spin.tab.c"
+    break;
+
+  case 249: /* expr: expr "**" expr  */
+#line 1396 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_HIGHMULT, yyvsp[-2], yyvsp[0]); }
+#line 8058 "./build/spin.tab.c"
+    break;
+
+  case 250: /* expr: expr "SCAS" expr  */
+#line 1398 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_SCAS, yyvsp[-2], yyvsp[0]); }
+#line 8064 "./build/spin.tab.c"
+    break;
+
+  case 251: /* expr: expr "SCA (+**)" expr  */
+#line 1400 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_UNS_HIGHMULT, yyvsp[-2], yyvsp[0]); }
+#line 8070 "./build/spin.tab.c"
+    break;
+
+  case 252: /* expr: expr "FRAC" expr  */
+#line 1402 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_FRAC64, yyvsp[-2], yyvsp[0]); }
+#line 8076 "./build/spin.tab.c"
+    break;
+
+  case 253: /* expr: expr "#>" expr  */
+#line 1404 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_LIMITMIN, yyvsp[-2], yyvsp[0]); }
+#line 8082 "./build/spin.tab.c"
+    break;
+
+  case 254: /* expr: expr "<#" expr  */
+#line 1406 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_LIMITMAX, yyvsp[-2], yyvsp[0]); }
+#line 8088 "./build/spin.tab.c"
+    break;
+
+  case 255: /* expr: expr "ZEROX" expr  */
+#line 1408 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_ZEROEXTEND, yyvsp[-2], AstOperator('+', yyvsp[0], AstInteger(1))); }
+#line 8094 "./build/spin.tab.c"
+    break;
+
+  case 256: /* expr: expr "SIGNX" expr  */
+#line 1410 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_SIGNEXTEND, yyvsp[-2], AstOperator('+', yyvsp[0], AstInteger(1))); }
+#line 8100 "./build/spin.tab.c"
+    break;
+
+  case 257: /* expr: expr "><" expr  */
+#line 1412 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_REV, yyvsp[-2], yyvsp[0]); }
+#line 8106 "./build/spin.tab.c"
+    break;
+
+  case 258: /* expr: expr "REV" expr  */
+#line 1414 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_REV, yyvsp[-2], AstOperator('+', yyvsp[0], AstInteger(1))); }
+#line 8112 "./build/spin.tab.c"
+    break;
+
+  case 259: /* expr: expr "ADDBITS" expr  */
+#line 1416 "frontends/spin/spin.y"
+    { yyval = AstOperator('|', yyvsp[-2], AstOperator(K_SHL, yyvsp[0], AstInteger(5))); }
+#line 8118 "./build/spin.tab.c"
+    break;
+
+  case 260: /* expr: expr "ADDPINS" expr  */
+#line 1418 "frontends/spin/spin.y"
+    { yyval = AstOperator('|', yyvsp[-2], AstOperator(K_SHL, yyvsp[0], AstInteger(6))); }
+#line 8124 "./build/spin.tab.c"
+    break;
+
+  case 261: /* expr: expr "ROL (<-)" expr  */
+#line 1420 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_ROTL, yyvsp[-2], yyvsp[0]); }
+#line 8130 "./build/spin.tab.c"
+    break;
+
+  case 262: /* expr: expr "ROR (->)" expr  */
+#line 1422 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_ROTR, yyvsp[-2], yyvsp[0]); }
+#line 8136 "./build/spin.tab.c"
+    break;
+
+  case 263: /* expr: expr "<<" expr  */
+#line 1424 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_SHL, yyvsp[-2], yyvsp[0]); }
+#line 8142 "./build/spin.tab.c"
+    break;
+
+  case 264: /* expr: expr ">>" expr  */
+#line 1426 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_SHR, yyvsp[-2], yyvsp[0]); }
+#line 8148 "./build/spin.tab.c"
+    break;
+
+  case 265: /* expr: expr "SAR (~>)" expr  */
+#line 1428 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_SAR, yyvsp[-2], yyvsp[0]); }
+#line 8154 "./build/spin.tab.c"
+    break;
+
+  case 266: /* expr: expr "__ANDTHEN__" expr  */
+#line 1430 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_BOOL_AND, yyvsp[-2], yyvsp[0]); }
+#line 8160 "./build/spin.tab.c"
+    break;
+
+  case 267: /* expr: expr "__ORELSE__" expr  */
+#line 1432 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_BOOL_OR, yyvsp[-2], yyvsp[0]); }
+#line 8166 "./build/spin.tab.c"
+    break;
+
+  case 268: /* expr: expr "AND (&&)" expr  */
+#line 1434 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_LOGIC_AND, yyvsp[-2], yyvsp[0]); }
+#line 8172 "./build/spin.tab.c"
+    break;
+
+  case 269: /* expr: expr "OR (||)" expr  */
+#line 1436 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_LOGIC_OR, yyvsp[-2], yyvsp[0]); }
+#line 8178 "./build/spin.tab.c"
+    break;
+
+  case 270: /* expr: expr "XOR (^^)" expr  */
+#line 1438 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_LOGIC_XOR, yyvsp[-2], yyvsp[0]); }
+#line 8184 "./build/spin.tab.c"
+    break;
+
+  case 271: /* expr: expr "+." expr  */
+#line 1440 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_FADD, yyvsp[-2], yyvsp[0]); }
+#line 8190 "./build/spin.tab.c"
+    break;
+
+  case 272: /* expr: expr "-." expr  */
+#line 1442 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_FSUB, yyvsp[-2], yyvsp[0]); }
+#line 8196 "./build/spin.tab.c"
+    break;
+
+  case 273: /* expr: expr "*." expr  */
+#line 1444 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_FMUL, yyvsp[-2], yyvsp[0]); }
+#line 8202 "./build/spin.tab.c"
+    break;
+
+  case 274: /* expr: expr "%." expr  */
+#line 1446 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_FDIV, yyvsp[-2], yyvsp[0]); }
+#line 8208 "./build/spin.tab.c"
+    break;
+
+  case 275: /* expr: expr '+' '=' expr  */
+#line 1448 "frontends/spin/spin.y"
+    { yyval = AstOpAssign('+', yyvsp[-3], yyvsp[0]); }
+#line 8214 "./build/spin.tab.c"
+    break;
+
+  case 276: /* expr: expr '-' '=' expr  */
+#line 1450 "frontends/spin/spin.y"
+    { yyval = AstOpAssign('-', yyvsp[-3], yyvsp[0]); }
+#line 8220 "./build/spin.tab.c"
+    break;
+
+  case 277: /* expr: expr '/' '=' expr  */
+#line 1452 "frontends/spin/spin.y"
+    { yyval = AstOpAssign('/', yyvsp[-3], yyvsp[0]); }
+#line 8226 "./build/spin.tab.c"
+    break;
+
+  case 278: /* expr: expr '*' '=' expr  */
+#line 1454 "frontends/spin/spin.y"
+    { yyval = AstOpAssign('*', yyvsp[-3], yyvsp[0]); }
+#line 8232 "./build/spin.tab.c"
+    break;
+
+  case 279: /* expr: expr '&' '=' expr  */
+#line 1456 "frontends/spin/spin.y"
+    { yyval = AstOpAssign('&', yyvsp[-3], yyvsp[0]); }
+#line 8238 "./build/spin.tab.c"
+    break;
+
+  case 280: /* expr: expr '|' '=' expr  */
+#line 1458 "frontends/spin/spin.y"
+    { yyval = AstOpAssign('|', yyvsp[-3], yyvsp[0]); }
+#line 8244 "./build/spin.tab.c"
+    break;
+
+  case 281: /* expr: expr '^' '=' expr  */
+#line 1460 "frontends/spin/spin.y"
+    { yyval = AstOpAssign('^', yyvsp[-3], yyvsp[0]); }
+#line 8250 "./build/spin.tab.c"
+    break;
+
+  case 282: /* expr: expr "//" '=' expr  */
+#line 1462 "frontends/spin/spin.y"
+    { yyval = AstOpAssign(K_MODULUS, yyvsp[-3], yyvsp[0]); }
+#line 8256 "./build/spin.tab.c"
+    break;
+
+  case 283: /* expr: expr "+/" '=' expr  */
+#line 1464 "frontends/spin/spin.y"
+    { yyval = AstOpAssign(K_UNS_DIV, yyvsp[-3], yyvsp[0]); }
+#line 8262 "./build/spin.tab.c"
+    break;
+
+  case 284: /* expr: expr "+//" '=' expr  */
+#line 1466 "frontends/spin/spin.y"
+    { yyval = AstOpAssign(K_UNS_MOD, yyvsp[-3], yyvsp[0]); }
+#line 8268 "./build/spin.tab.c"
+    break;
+
+  case 285: /* expr: expr "**" '=' expr  */
+#line 1468 "frontends/spin/spin.y"
+    { yyval = AstOpAssign(K_HIGHMULT, yyvsp[-3], yyvsp[0]); }
+#line 8274 "./build/spin.tab.c"
+    break;
+
+  case 286: /* expr: expr "SCA (+**)" '=' expr  */
+#line 1470 "frontends/spin/spin.y"
+    { yyval = AstOpAssign(K_UNS_HIGHMULT, yyvsp[-3], yyvsp[0]); }
+#line 8280 "./build/spin.tab.c"
+    break;
+
+  case 287: /* expr: expr "SCAS" '=' expr  */
+#line 1472 "frontends/spin/spin.y"
+    { yyval = AstOpAssign(K_SCAS, yyvsp[-3], yyvsp[0]); }
+#line 8286 "./build/spin.tab.c"
+    break;
+
+  case 288: /* expr: expr "FRAC" '=' expr  */
+#line 1474 "frontends/spin/spin.y"
+    { yyval = AstOpAssign(K_FRAC64, yyvsp[-3], yyvsp[0]); }
+#line 8292 "./build/spin.tab.c"
+    break;
+
+  case 289: /* expr: expr "#>" '=' expr  */
+#line 1476 "frontends/spin/spin.y"
+    { yyval = AstOpAssign(K_LIMITMIN, yyvsp[-3], yyvsp[0]); }
+#line 8298 "./build/spin.tab.c"
+    break;
+
+  case 290: /* expr: expr "<#" '=' expr  */
+#line 1478 "frontends/spin/spin.y"
+    { yyval = AstOpAssign(K_LIMITMAX, yyvsp[-3], yyvsp[0]); }
+#line 8304 "./build/spin.tab.c"
+    break;
+
+  case 291: /* expr: expr "ZEROX" '=' expr  */
+#line 1480 "frontends/spin/spin.y"
+    { yyval = AstOpAssign(K_ZEROEXTEND, yyvsp[-3], AstOperator('+', yyvsp[0], AstInteger(1))); }
+#line 8310 "./build/spin.tab.c"
+    break;
+
+  case 292: /* expr: expr "SIGNX" '=' expr  */
+#line 1482 "frontends/spin/spin.y"
+    { yyval = AstOpAssign(K_SIGNEXTEND, yyvsp[-3], AstOperator('+', yyvsp[0], AstInteger(1))); }
+#line 8316 "./build/spin.tab.c"
+    break;
+
+  case 293: /* expr: expr "><" '=' expr  */
+#line 1484 "frontends/spin/spin.y"
+    { yyval = AstOpAssign(K_REV, yyvsp[-3], yyvsp[0]); }
+#line 8322 "./build/spin.tab.c"
+    break;
+
+  case 294: /* expr: expr "REV" '=' expr  */
+#line 1486 "frontends/spin/spin.y"
+    {
+        AST *lhs = yyvsp[-3];
+        AST *rhs = yyvsp[0];
+        yyval = AstOpAssign(K_REV, lhs,
+                         AstOperator('+', rhs, AstInteger(1)));
+    }
+#line 8333 "./build/spin.tab.c"
+    break;
+
+  case 295: /* expr: expr "ADDBITS" '=' expr  */
+#line 1493 "frontends/spin/spin.y"
+    {
+        AST *lhs = yyvsp[-3];
+        AST *rhs = yyvsp[0];
+        yyval = AstOpAssign('|', lhs,
+                       AstOperator(K_SHL, rhs, AstInteger(5)));
+    }
+#line 8344 "./build/spin.tab.c"
+    break;
+
+  case 296: /* expr: expr "ADDPINS" '=' expr  */
+#line 1500 "frontends/spin/spin.y"
+    {
+        AST *lhs = yyvsp[-3];
+        AST *rhs = yyvsp[0];
+        yyval = AstOpAssign('|', lhs,
+                       AstOperator(K_SHL, rhs, AstInteger(6)));
+    }
+#line 8355 "./build/spin.tab.c"
+    break;
+
+  case 297: /* expr: expr "ROL (<-)" '=' expr  */
+#line 1507 "frontends/spin/spin.y"
+    { yyval = AstOpAssign(K_ROTL, yyvsp[-3], yyvsp[0]); }
+#line 8361 "./build/spin.tab.c"
+    break;
+
+  case 298: /* expr: expr "ROR (->)" '=' expr  */
+#line 1509 "frontends/spin/spin.y"
+    { yyval = AstOpAssign(K_ROTR, yyvsp[-3], yyvsp[0]); }
+#line 8367 "./build/spin.tab.c"
+    break;
+
+  case 299: /* expr: expr "<<" '=' expr  */
+#line 1511 "frontends/spin/spin.y"
+    { yyval = AstOpAssign(K_SHL, yyvsp[-3], yyvsp[0]); }
+#line 8373 "./build/spin.tab.c"
+    break;
+
+  case 300: /* expr: expr ">>" '=' expr  */
+#line 1513 "frontends/spin/spin.y"
+    { yyval = AstOpAssign(K_SHR, yyvsp[-3], yyvsp[0]); }
+#line 8379 "./build/spin.tab.c"
+    break;
+
+  case 301: /* expr: expr "SAR (~>)" '=' expr  */
+#line 1515 "frontends/spin/spin.y"
+    { yyval = AstOpAssign(K_SAR, yyvsp[-3], yyvsp[0]); }
+#line 8385 "./build/spin.tab.c"
+    break;
+
+  case 302: /* expr: expr "AND (&&)" '=' expr  */
+#line 1517 "frontends/spin/spin.y"
+    { yyval = AstOpAssign(K_BOOL_AND, yyvsp[-3], yyvsp[0]); }
+#line 8391 "./build/spin.tab.c"
+    break;
+
+  case 303: /* expr: expr "OR (||)" '=' expr  */
+#line 1519 "frontends/spin/spin.y"
+    { yyval = AstOpAssign(K_BOOL_OR, yyvsp[-3], yyvsp[0]); }
+#line 8397 "./build/spin.tab.c"
+    break;
+
+  case 304: /* expr: expr "XOR (^^)" '=' expr  */
+#line 1521 "frontends/spin/spin.y"
+    { yyval = AstOpAssign(K_BOOL_XOR, yyvsp[-3], yyvsp[0]); }
+#line 8403 "./build/spin.tab.c"
+    break;
+
+  case 305: /* expr: expr '<' '=' expr  */
+#line 1523 "frontends/spin/spin.y"
+    { yyval = AstOpAssign('<', yyvsp[-3], yyvsp[0]); }
+#line 8409 "./build/spin.tab.c"
+    break;
+
+  case 306: /* expr: expr '>' '=' expr  */
+#line 1525 "frontends/spin/spin.y"
+    { yyval = AstOpAssign('>', yyvsp[-3], yyvsp[0]); }
+#line 8415 "./build/spin.tab.c"
+    break;
+
+  case 307: /* expr: expr "=<" '=' expr  */
+#line 1527 "frontends/spin/spin.y"
+    { yyval = AstOpAssign(K_LE, yyvsp[-3], yyvsp[0]); }
+#line 8421 "./build/spin.tab.c"
+    break;
+
+  case 308: /* expr: expr "=>" '=' expr  */
+#line 1529 "frontends/spin/spin.y"
+    { yyval = AstOpAssign(K_GE, yyvsp[-3], yyvsp[0]); }
+#line 8427 "./build/spin.tab.c"
+    break;
+
+  case 309: /* expr: expr "<>" '=' expr  */
+#line 1531 "frontends/spin/spin.y"
+    { yyval = AstOpAssign(K_NE, yyvsp[-3], yyvsp[0]); }
+#line 8433 "./build/spin.tab.c"
+    break;
+
+  case 310: /* expr: '(' expr ')' "??" expr ':' expr  */
+#line 1533 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_CONDRESULT, yyvsp[-5], NewAST(AST_THENELSE, yyvsp[-2], yyvsp[0])); }
+#line 8439 "./build/spin.tab.c"
+    break;
+
+  case 311: /* expr: expr "?" expr ": after ?" expr  */
+#line 1535 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_CONDRESULT, yyvsp[-4], NewAST(AST_THENELSE, yyvsp[-2], yyvsp[0])); }
+#line 8445 "./build/spin.tab.c"
+    break;
+
+  case 312: /* expr: '(' expr ')'  */
+#line 1537 "frontends/spin/spin.y"
+    { yyval = yyvsp[-1]; }
+#line 8451 "./build/spin.tab.c"
+    break;
+
+  case 313: /* expr: '\\' expr  */
+#line 1539 "frontends/spin/spin.y"
+    { yyval = AstCatch(yyvsp[0]); }
+#line 8457 "./build/spin.tab.c"
+    break;
+
+  case 314: /* expr: funccall  */
+#line 1541 "frontends/spin/spin.y"
+    { yyval = yyvsp[0]; }
+#line 8463 "./build/spin.tab.c"
+    break;
+
+  case 315: /* expr: '-' expr  */
+#line 1543 "frontends/spin/spin.y"
+    {
+        AST *op = yyvsp[0];
+        /* special case -x where x is a float constant */
+        if (op->kind == AST_FLOAT) {
+            op->d.ival ^= 0x80000000U;
+            yyval = op;
+        } else {
+            yyval = AstOperator(K_NEGATE, NULL, op);
+        }
+    }
+#line 8478 "./build/spin.tab.c"
+    break;
+
+  case 316: /* expr: "-." expr  */
+#line 1554 "frontends/spin/spin.y"
+    {
+        AST *op = yyvsp[0];
+        yyval = AstOperator(K_FNEGATE, NULL, op);
+    }
+#line 8487 "./build/spin.tab.c"
+    break;
+
+  case 317: /* expr: '+' expr  */
+#line 1559 "frontends/spin/spin.y"
+    {
+        AST *op = yyvsp[0];
+        yyval = op;
+    }
+#line 8496 "./build/spin.tab.c"
+    break;
+
+  case 318: /* expr: '!' expr  */
+#line 1564 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_BIT_NOT, NULL, yyvsp[0]); }
+#line 8502 "./build/spin.tab.c"
+    break;
+
+  case 319: /* expr: '!' '=' expr  */
+#line 1566 "frontends/spin/spin.y"
+    { yyval = AstOpAssign(K_BIT_NOT, yyvsp[0], NULL); }
+#line 8508 "./build/spin.tab.c"
+    break;
+
+  case 320: /* expr: '-' '=' expr  */
+#line 1568 "frontends/spin/spin.y"
+    { yyval = AstOpAssign(K_NEGATE, yyvsp[0], NULL); }
+#line 8514 "./build/spin.tab.c"
+    break;
+
+  case 321: /* expr: "NOT (!!)" expr  */
+#line 1570 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_BOOL_NOT, NULL, yyvsp[0]); }
+#line 8520 "./build/spin.tab.c"
+    break;
+
+  case 322: /* expr: "NOT (!!)" '=' expr  */
+#line 1572 "frontends/spin/spin.y"
+    { yyval = AstOpAssign(K_BOOL_NOT, yyvsp[0], NULL); }
+#line 8526 "./build/spin.tab.c"
+    break;
+
+  case 323: /* expr: "FABS" expr  */
+#line 1574 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_FABS, NULL, yyvsp[0]); }
+#line 8532 "./build/spin.tab.c"
+    break;
+
+  case 324: /* expr: "ABS (||)" expr  */
+#line 1576 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_ABS, NULL, yyvsp[0]); }
+#line 8538 "./build/spin.tab.c"
+    break;
+
+  case 325: /* expr: "ABS (||)" '=' expr  */
+#line 1578 "frontends/spin/spin.y"
+    { yyval = AstOpAssign(K_ABS, yyvsp[0], NULL); }
+#line 8544 "./build/spin.tab.c"
+    break;
+
+  case 326: /* expr: "FSQRT" expr  */
+#line 1580 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_FSQRT, NULL, yyvsp[0]); }
+#line 8550 "./build/spin.tab.c"
+    break;
+
+  case 327: /* expr: "SQRT (^^)" expr  */
+#line 1582 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_SQRT, NULL, yyvsp[0]); }
+#line 8556 "./build/spin.tab.c"
+    break;
+
+  case 328: /* expr: "SQRT (^^)" '=' expr  */
+#line 1584 "frontends/spin/spin.y"
+    { yyval = AstOpAssign(K_SQRT, yyvsp[0], NULL); }
+#line 8562 "./build/spin.tab.c"
+    break;
+
+  case 329: /* expr: "DECOD (|<)" expr  */
+#line 1586 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_DECODE, NULL, yyvsp[0]); }
+#line 8568 "./build/spin.tab.c"
+    break;
+
+  case 330: /* expr: "DECOD (|<)" '=' expr  */
+#line 1588 "frontends/spin/spin.y"
+    { yyval = AstOpAssign(K_DECODE, yyvsp[0], NULL); }
+#line 8574 "./build/spin.tab.c"
+    break;
+
+  case 331: /* expr: ">|" expr  */
+#line 1590 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_ENCODE, NULL, yyvsp[0]); }
+#line 8580 "./build/spin.tab.c"
+    break;
+
+  case 332: /* expr: "ENCOD" expr  */
+#line 1592 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_ENCODE2, NULL, yyvsp[0]); }
+#line 8586 "./build/spin.tab.c"
+    break;
+
+  case 333: /* expr: ">|" '=' expr  */
+#line 1594 "frontends/spin/spin.y"
+    { yyval = AstOpAssign(K_ENCODE, yyvsp[0], NULL); }
+#line 8592 "./build/spin.tab.c"
+    break;
+
+  case 334: /* expr: "ENCOD" '=' expr  */
+#line 1596 "frontends/spin/spin.y"
+    { yyval = AstOpAssign(K_ENCODE2, yyvsp[0], NULL); }
+#line 8598 "./build/spin.tab.c"
+    break;
+
+  case 335: /* expr: "QLOG" expr  */
+#line 1598 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_QLOG, NULL, yyvsp[0]); }
+#line 8604 "./build/spin.tab.c"
+    break;
+
+  case 336: /* expr: "QEXP" expr  */
+#line 1600 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_QEXP, NULL, yyvsp[0]); }
+#line 8610 "./build/spin.tab.c"
+    break;
+
+  case 337: /* expr: "NAN" expr  */
+#line 1602 "frontends/spin/spin.y"
+    {   AST *op = yyvsp[0];
+        AST *cmp;
+        cmp = AstOperator(K_FNE, op, op);
+        yyval = cmp;
+    }
+#line 8620 "./build/spin.tab.c"
+    break;
+
+  case 338: /* expr: "ONES" expr  */
+#line 1608 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_ONES_COUNT, NULL, yyvsp[0]); }
+#line 8626 "./build/spin.tab.c"
+    break;
+
+  case 339: /* expr: "ONES" '=' expr  */
+#line 1610 "frontends/spin/spin.y"
+    { yyval = AstOpAssign(K_ONES_COUNT, yyvsp[0], NULL); }
+#line 8632 "./build/spin.tab.c"
+    break;
+
+  case 340: /* expr: "BMASK" expr  */
+#line 1612 "frontends/spin/spin.y"
+    {
+        AST *ast;
+        AST *expr = yyvsp[0];
+        ast = AstOperator(K_SHL, AstInteger(2), expr);
+        ast = AstOperator('-', ast, AstInteger(1));
+        yyval = ast;
+    }
+#line 8644 "./build/spin.tab.c"
+    break;
+
+  case 341: /* expr: "BMASK" '=' expr  */
+#line 1620 "frontends/spin/spin.y"
+    {
+        AST *ast;
+        AST *expr = yyvsp[0];
+        ast = AstOperator(K_SHL, AstInteger(2), expr);
+        ast = AstOperator('-', ast, AstInteger(1));
+        if (ExprHasSideEffects(expr)) {
+            SYNTAX_ERROR("expression following BMASK= should not have side effects");
+        }
+        yyval = AstAssign(expr, ast);
+    }
+#line 8659 "./build/spin.tab.c"
+    break;
+
+  case 342: /* expr: "$"  */
+#line 1631 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_HERE, NULL, NULL); }
+#line 8665 "./build/spin.tab.c"
+    break;
+
+  case 343: /* expr: lhs "++"  */
+#line 1633 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_INCREMENT, yyvsp[-1], NULL); }
+#line 8671 "./build/spin.tab.c"
+    break;
+
+  case 344: /* expr: lhs "--"  */
+#line 1635 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_DECREMENT, yyvsp[-1], NULL); }
+#line 8677 "./build/spin.tab.c"
+    break;
+
+  case 345: /* expr: "++" lhs  */
+#line 1637 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_INCREMENT, NULL, yyvsp[0]); }
+#line 8683 "./build/spin.tab.c"
+    break;
+
+  case 346: /* expr: "--" lhs  */
+#line 1639 "frontends/spin/spin.y"
+    { yyval = AstOperator(K_DECREMENT, NULL, yyvsp[0]); }
+#line 8689 "./build/spin.tab.c"
+    break;
+
+  case 347: /* expr: lhs "??"  */
+#line 1641 "frontends/spin/spin.y"
+    { yyval = AstOperator('?', yyvsp[-1], NULL); }
+#line 8695 "./build/spin.tab.c"
+    break;
+
+  case 348: /* expr: "??" lhs  */
+#line 1643 "frontends/spin/spin.y"
+    { yyval = AstOperator('?', NULL, yyvsp[0]); }
+#line 8701 "./build/spin.tab.c"
+    break;
+
+  case 349: /* expr: lhs '~'  */
+#line 1645 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_POSTSET, yyvsp[-1], AstInteger(0)); }
+#line 8707 "./build/spin.tab.c"
+    break;
+
+  case 350: /* expr: lhs "~~"  */
+#line 1647 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_POSTSET, yyvsp[-1], AstInteger(-1)); }
+#line 8713 "./build/spin.tab.c"
+    break;
+
+  case 351: /* expr: '~' lhs  */
+#line 1649 "frontends/spin/spin.y"
+    { AST *shf;
+      AST *val = yyvsp[0];
+      shf = AstOpAssign(K_SIGNEXTEND, val, AstInteger(8));
+      yyval = shf;
+    }
+#line 8723 "./build/spin.tab.c"
+    break;
+
+  case 352: /* expr: "~~" lhs  */
+#line 1655 "frontends/spin/spin.y"
+    { AST *shf;
+      AST *val = yyvsp[0];
+      shf = AstOpAssign(K_SIGNEXTEND, val, AstInteger(16));
+      yyval = shf;
+    }
+#line 8733 "./build/spin.tab.c"
+    break;
+
+  case 353: /* expr: "constant" '(' expr ')'  */
+#line 1661 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_CONSTANT, yyvsp[-1], NULL); }
+#line 8739 "./build/spin.tab.c"
+    break;
+
+  case 354: /* expr: "__BUILTIN_ALLOCA" '(' expr ')'  */
+#line 1663 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_ALLOCA, NULL, yyvsp[-1]); }
+#line 8745 "./build/spin.tab.c"
+    break;
+
+  case 355: /* expr: "floating point number" '(' expr ')'  */
+#line 1665 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_TOFLOAT, yyvsp[-1], NULL); }
+#line 8751 "./build/spin.tab.c"
+    break;
+
+  case 356: /* expr: "ROUND" '(' expr ')'  */
+#line 1667 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_ROUND, yyvsp[-1], NULL); }
+#line 8757 "./build/spin.tab.c"
+    break;
+
+  case 357: /* expr: "TRUNC" '(' expr ')'  */
+#line 1669 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_TRUNC, yyvsp[-1], NULL); }
+#line 8763 "./build/spin.tab.c"
+    break;
+
+  case 358: /* expr: lookupexpr  */
+#line 1671 "frontends/spin/spin.y"
+    { yyval = yyvsp[0]; }
+#line 8769 "./build/spin.tab.c"
+    break;
+
+  case 359: /* expr: lookdownexpr  */
+#line 1673 "frontends/spin/spin.y"
+    { yyval = yyvsp[0]; }
+#line 8775 "./build/spin.tab.c"
+    break;
+
+  case 360: /* expr: "IF" expr "THEN" expr "ELSE" expr  */
+#line 1675 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_CONDRESULT, yyvsp[-4], NewAST(AST_THENELSE, yyvsp[-2], yyvsp[0])); }
+#line 8781 "./build/spin.tab.c"
+    break;
+
+  case 362: /* lhs: identifier '[' expr ']'  */
+#line 1680 "frontends/spin/spin.y"
+    {
+        yyval = NewAST(AST_ARRAYREF, yyvsp[-3], yyvsp[-1]);
+    }
+#line 8789 "./build/spin.tab.c"
+    break;
+
+  case 363: /* lhs: identifier '.' identifier '[' expr ']'  */
+#line 1684 "frontends/spin/spin.y"
+    {
+        AST *objroot = yyvsp[-5];
+        AST *method = yyvsp[-3];
+        AST *index = yyvsp[-1];
+        AST *expr;
+        expr = NewAST(AST_METHODREF, objroot, method);
+        expr = NewAST(AST_ARRAYREF, expr, index);
+        yyval = expr;
+    }
+#line 8803 "./build/spin.tab.c"
+    break;
+
+  case 364: /* lhs: identifier '[' expr ']' '.' '[' range ']'  */
+#line 1694 "frontends/spin/spin.y"
+    {
+        AST *arr = NewAST(AST_ARRAYREF, yyvsp[-7], yyvsp[-5]);
+        AST *range = yyvsp[-1];
+        yyval = NewAST(AST_RANGEREF, arr, range);
+    }
+#line 8813 "./build/spin.tab.c"
+    break;
+
+  case 365: /* lhs: hwreg  */
+#line 1700 "frontends/spin/spin.y"
+    { yyval = yyvsp[0]; }
+#line 8819 "./build/spin.tab.c"
+    break;
+
+  case 366: /* lhs: hwreg '[' range ']'  */
+#line 1702 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_RANGEREF, yyvsp[-3], yyvsp[-1]);
+    }
+#line 8826 "./build/spin.tab.c"
+    break;
+
+  case 367: /* lhs: hwreg '[' '#' '#' range ']'  */
+#line 1705 "frontends/spin/spin.y"
+    {
+        AST *reg = yyvsp[-5];
+        AST *index = yyvsp[-1];
+        AST *base = NewAST(AST_RANGEREF, reg, index);
+        AST *holder = NewAST(AST_BIGIMMHOLDER, base, NULL);
+        yyval = holder;
+    }
+#line 8838 "./build/spin.tab.c"
+    break;
+
+  case 368: /* lhs: hwreg '.' '[' range ']'  */
+#line 1713 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_RANGEREF, yyvsp[-4], yyvsp[-1]);
+    }
+#line 8845 "./build/spin.tab.c"
+    break;
+
+  case 369: /* lhs: memref '[' expr ']'  */
+#line 1716 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_ARRAYREF, yyvsp[-3], yyvsp[-1]); }
+#line 8851 "./build/spin.tab.c"
+    break;
+
+  case 370: /* lhs: memref '[' expr ']' '.' '[' range ']'  */
+#line 1718 "frontends/spin/spin.y"
+    {
+        AST *ast = NewAST(AST_ARRAYREF, yyvsp[-7], yyvsp[-5]);
+        AST *range = yyvsp[-1];
+        yyval = NewAST(AST_RANGEREF, ast, range);
+    }
+#line 8861 "./build/spin.tab.c"
+    break;
+
+  case 371: /* lhs: memref '.' '[' range ']'  */
+#line 1724 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_RANGEREF, yyvsp[-4], yyvsp[-1]); }
+#line 8867 "./build/spin.tab.c"
+    break;
+
+  case 372: /* lhs: '(' expr ')' '[' expr ']'  */
+#line 1726 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_ARRAYREF, yyvsp[-4], yyvsp[-1]); }
+#line 8873 "./build/spin.tab.c"
+    break;
+
+  case 373: /* lhs: memref  */
+#line 1728 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_ARRAYREF, yyvsp[0], AstInteger(0)); }
+#line 8879 "./build/spin.tab.c"
+    break;
+
+  case 374: /* lhs: "SPR" '[' expr ']'  */
+#line 1730 "frontends/spin/spin.y"
+    { yyval = AstSprRef(yyvsp[-1], 0x1f0); }
+#line 8885 "./build/spin.tab.c"
+    break;
+
+  case 375: /* lhs: "REG" '[' expr ']'  */
+#line 1732 "frontends/spin/spin.y"
+    { yyval = AstSprRef(yyvsp[-1], 0x0); }
+#line 8891 "./build/spin.tab.c"
+    break;
+
+  case 376: /* lhs: identifier '.' '[' range ']'  */
+#line 1734 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_RANGEREF, yyvsp[-4], yyvsp[-1]);
+    }
+#line 8898 "./build/spin.tab.c"
+    break;
+
+  case 377: /* lhsseq: '(' lhssingle ',' lhsseqcont ')'  */
+#line 1740 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_EXPRLIST, yyvsp[-3], yyvsp[-1]); }
+#line 8904 "./build/spin.tab.c"
+    break;
+
+  case 378: /* lhsseq: lhssingle ',' lhsseqcont  */
+#line 1742 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_EXPRLIST, yyvsp[-2], yyvsp[0]); }
+#line 8910 "./build/spin.tab.c"
+    break;
+
+  case 379: /* lhsseqcont: lhssingle  */
+#line 1747 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_EXPRLIST, yyvsp[0], NULL); }
+#line 8916 "./build/spin.tab.c"
+    break;
+
+  case 380: /* lhsseqcont: lhsseqcont ',' lhssingle  */
+#line 1749 "frontends/spin/spin.y"
+    { yyval = AddToList(yyvsp[-2], NewAST(AST_EXPRLIST, yyvsp[0], NULL)); }
+#line 8922 "./build/spin.tab.c"
+    break;
+
+  case 381: /* lhssingle: lhs  */
+#line 1754 "frontends/spin/spin.y"
+       { yyval = yyvsp[0]; }
+#line 8928 "./build/spin.tab.c"
+    break;
+
+  case 382: /* lhssingle: "empty assignment marker _"  */
+#line 1756 "frontends/spin/spin.y"
+       { yyval = NewAST(AST_EMPTY, NULL, NULL); }
+#line 8934 "./build/spin.tab.c"
+    break;
+
+  case 383: /* memref: "BYTE" '[' expr ']'  */
+#line 1761 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_MEMREF, ast_type_byte, yyvsp[-1]); }
+#line 8940 "./build/spin.tab.c"
+    break;
+
+  case 384: /* memref: "WORD" '[' expr ']'  */
+#line 1763 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_MEMREF, ast_type_word, yyvsp[-1]); }
+#line 8946 "./build/spin.tab.c"
+    break;
+
+  case 385: /* memref: "LONG" '[' expr ']'  */
+#line 1765 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_MEMREF, ast_type_long, yyvsp[-1]); }
+#line 8952 "./build/spin.tab.c"
+    break;
+
+  case 386: /* memref: identifier '.' "BYTE"  */
+#line 1767 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_MEMREF, ast_type_byte, NewAST(AST_ADDROF, yyvsp[-2], NULL)); }
+#line 8958 "./build/spin.tab.c"
+    break;
+
+  case 387: /* memref: identifier '.' "WORD"  */
+#line 1769 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_MEMREF, ast_type_word, NewAST(AST_ADDROF, yyvsp[-2], NULL)); }
+#line 8964 "./build/spin.tab.c"
+    break;
+
+  case 388: /* memref: identifier '.' "LONG"  */
+#line 1771 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_MEMREF, ast_type_long, NewAST(AST_ADDROF, yyvsp[-2], NULL)); }
+#line 8970 "./build/spin.tab.c"
+    break;
+
+  case 389: /* opt_numrets: %empty  */
+#line 1776 "frontends/spin/spin.y"
+    { yyval = NULL; }
+#line 8976 "./build/spin.tab.c"
+    break;
+
+  case 390: /* opt_numrets: ':' "number"  */
+#line 1778 "frontends/spin/spin.y"
+    { yyval = yyvsp[0]; }
+#line 8982 "./build/spin.tab.c"
+    break;
+
+  case 391: /* funccall: identifier '(' exprlist ')' opt_numrets  */
+#line 1783 "frontends/spin/spin.y"
+    { yyval = MakeFunccall(yyvsp[-4], FixupList(yyvsp[-2]), yyvsp[0]); }
+#line 8988 "./build/spin.tab.c"
+    break;
+
+  case 392: /* funccall: identifier '(' ')' opt_numrets  */
+#line 1785 "frontends/spin/spin.y"
+    {
+        yyval = MakeFunccall(yyvsp[-3], NULL, yyvsp[0]);
+        LANGUAGE_WARNING(LANG_SPIN_SPIN1, NULL, "Using () for functions with no parameters is a flexspin extension");
+    }
+#line 8997 "./build/spin.tab.c"
+    break;
+
+  case 393: /* funccall: "PINWRITE" '(' rangeexpritem ',' expritem ')'  */
+#line 1790 "frontends/spin/spin.y"
+    {
+        AST *arg1 = ConvertPinRange(yyvsp[-3]);
+        AST *arg2 = yyvsp[-1];
+        AST *ident = AstIdentifier("pinw");
+        arg1 = AddToList(arg1, arg2);
+        
+        yyval = MakeFunccall(ident, arg1, NULL);
+    }
+#line 9010 "./build/spin.tab.c"
+    break;
+
+  case 394: /* funccall: "PINREAD" '(' rangeexpritem ')'  */
+#line 1799 "frontends/spin/spin.y"
+    {
+        AST *arg1 = ConvertPinRange(yyvsp[-1]);
+        AST *ident = AstIdentifier("pinr");
+        
+        yyval = MakeFunccall(ident, arg1, NULL);
+    }
+#line 9021 "./build/spin.tab.c"
+    break;
+
+  case 395: /* funccall: "PINLOW" '(' rangeexpritem ')'  */
+#line 1806 "frontends/spin/spin.y"
+    {
+        AST *arg1 = ConvertPinRange(yyvsp[-1]);
+        AST *ident = AstIdentifier("pinl");
+        
+        yyval = MakeFunccall(ident, arg1, NULL);
+    }
+#line 9032 "./build/spin.tab.c"
+    break;
+
+  case 396: /* funccall: "PINHIGH" '(' rangeexpritem ')'  */
+#line 1813 "frontends/spin/spin.y"
+    {
+        AST *arg1 = ConvertPinRange(yyvsp[-1]);
+        AST *ident = AstIdentifier("pinh");
+        
+        yyval = MakeFunccall(ident, arg1, NULL);
+    }
+#line 9043 "./build/spin.tab.c"
+    break;
+
+  case 397: /* funccall: "PINTOGGLE" '(' rangeexpritem ')'  */
+#line 1820 "frontends/spin/spin.y"
+    {
+        AST *arg1 = ConvertPinRange(yyvsp[-1]);
+        AST *ident = AstIdentifier("pintoggle");
+        
+        yyval = MakeFunccall(ident, arg1, NULL);
+    }
+#line 9054 "./build/spin.tab.c"
+    break;
+
+  case 398: /* funccall: "COGINIT" '(' exprlist ')'  */
+#line 1827 "frontends/spin/spin.y"
+    {
+        yyval = NewAST(AST_COGINIT, FixupList(yyvsp[-1]), NULL);
+    }
+#line 9062 "./build/spin.tab.c"
+    break;
+
+  case 399: /* funccall: "COGNEW" '(' exprlist ')'  */
+#line 1831 "frontends/spin/spin.y"
+    {
+        AST *elist;
+        AST *immval = AstInteger(0x1e); // works to cognew both P1 and P2
+        elist = NewAST(AST_EXPRLIST, immval, NULL);
+        elist = AddToList(elist, yyvsp[-1]);
+        elist = FixupList(elist);
+        yyval = NewAST(AST_COGINIT, elist, NULL);
+        LANGUAGE_WARNING(LANG_SPIN_SPIN2, NULL, "cognew support in Spin2 is a flexspin extension");
+    }
+#line 9076 "./build/spin.tab.c"
+    break;
+
+  case 400: /* funccall: identifier '.' identifier '(' exprlist ')' opt_numrets  */
+#line 1841 "frontends/spin/spin.y"
+    { 
+        yyval = MakeFunccall(NewAST(AST_METHODREF, yyvsp[-6], yyvsp[-4]), FixupList(yyvsp[-2]), yyvsp[0]);
+    }
+#line 9084 "./build/spin.tab.c"
+    break;
+
+  case 401: /* funccall: identifier '.' identifier '(' ')' opt_numrets  */
+#line 1845 "frontends/spin/spin.y"
+    { 
+        yyval = MakeFunccall(NewAST(AST_METHODREF, yyvsp[-5], yyvsp[-3]), NULL, yyvsp[0]);
+        LANGUAGE_WARNING(LANG_SPIN_SPIN1, NULL, "Using () for functions with no parameters is a flexspin extension");
+    }
+#line 9093 "./build/spin.tab.c"
+    break;
+
+  case 402: /* funccall: identifier '.' identifier  */
+#line 1850 "frontends/spin/spin.y"
+    { 
+        yyval = NewAST(AST_METHODREF, yyvsp[-2], yyvsp[0]);
+    }
+#line 9101 "./build/spin.tab.c"
+    break;
+
+  case 403: /* funccall: identifier '[' expr ']' '.' identifier '(' exprlist ')' opt_numrets  */
+#line 1854 "frontends/spin/spin.y"
+    { 
+        AST *arr = NewAST(AST_ARRAYREF, yyvsp[-9], yyvsp[-7]);
+        yyval = MakeFunccall(NewAST(AST_METHODREF, arr, yyvsp[-4]), FixupList(yyvsp[-2]), yyvsp[0]);
+    }
+#line 9110 "./build/spin.tab.c"
+    break;
+
+  case 404: /* funccall: identifier '[' expr ']' '.' identifier '(' ')' opt_numrets  */
+#line 1859 "frontends/spin/spin.y"
+    { 
+        AST *arr = NewAST(AST_ARRAYREF, yyvsp[-8], yyvsp[-6]);
+        yyval = MakeFunccall(NewAST(AST_METHODREF, arr, yyvsp[-3]), NULL, yyvsp[0]);
+        LANGUAGE_WARNING(LANG_SPIN_SPIN1, NULL, "Using () for functions with no parameters is a flexspin extension");
+    }
+#line 9120 "./build/spin.tab.c"
+    break;
+
+  case 405: /* funccall: identifier '[' expr ']' '.' identifier  */
+#line 1865 "frontends/spin/spin.y"
+    { 
+        AST *arr = NewAST(AST_ARRAYREF, yyvsp[-5], yyvsp[-3]);
+        yyval = NewAST(AST_METHODREF, arr, yyvsp[0]);
+    }
+#line 9129 "./build/spin.tab.c"
+    break;
+
+  case 406: /* expritem: expr  */
+#line 1874 "frontends/spin/spin.y"
+   { yyval = NewAST(AST_EXPRLIST, yyvsp[0], NULL); }
+#line 9135 "./build/spin.tab.c"
+    break;
+
+  case 407: /* expritem: integer '[' expr ']'  */
+#line 1876 "frontends/spin/spin.y"
+   {
+       yyval = NewAST(AST_EXPRLIST, NewAST(AST_ARRAYDECL, yyvsp[-3], yyvsp[-1]), NULL);
+   }
+#line 9143 "./build/spin.tab.c"
+    break;
+
+  case 408: /* expritem: float '[' expr ']'  */
+#line 1880 "frontends/spin/spin.y"
+   {
+       yyval = NewAST(AST_EXPRLIST, NewAST(AST_ARRAYDECL, yyvsp[-3], yyvsp[-1]), NULL);
+   }
+#line 9151 "./build/spin.tab.c"
+    break;
+
+  case 409: /* expritem: '-' integer '[' expr ']'  */
+#line 1884 "frontends/spin/spin.y"
+   {
+       AST *op = yyvsp[-3];
+       op->d.ival = -op->d.ival;
+       yyval = NewAST(AST_EXPRLIST, NewAST(AST_ARRAYDECL, op, yyvsp[-1]), NULL);
+   }
+#line 9161 "./build/spin.tab.c"
+    break;
+
+  case 410: /* expritem: '-' float '[' expr ']'  */
+#line 1890 "frontends/spin/spin.y"
+   {
+       AST *op = yyvsp[-3];
+       op->d.ival ^= 0x80000000U;
+       yyval = NewAST(AST_EXPRLIST, NewAST(AST_ARRAYDECL, op, yyvsp[-1]), NULL);
+   }
+#line 9171 "./build/spin.tab.c"
+    break;
+
+  case 411: /* expritem: string '[' expr ']'  */
+#line 1896 "frontends/spin/spin.y"
+   {
+       yyval = NewAST(AST_EXPRLIST, NewAST(AST_ARRAYDECL, yyvsp[-3], yyvsp[-1]), NULL);
+   }
+#line 9179 "./build/spin.tab.c"
+    break;
+
+  case 413: /* exprlist: exprlist ',' expritem  */
+#line 1904 "frontends/spin/spin.y"
+   { yyval = AddToList(yyvsp[-2], yyvsp[0]); }
+#line 9185 "./build/spin.tab.c"
+    break;
+
+  case 414: /* datexpritem: expritem  */
+#line 1909 "frontends/spin/spin.y"
+       { yyval = yyvsp[0]; }
+#line 9191 "./build/spin.tab.c"
+    break;
+
+  case 415: /* datexpritem: "LONG" expritem  */
+#line 1911 "frontends/spin/spin.y"
+       { yyval = NewAST(AST_EXPRLIST, NewAST(AST_LONGLIST, yyvsp[0], NULL), NULL); }
+#line 9197 "./build/spin.tab.c"
+    break;
+
+  case 416: /* datexpritem: "WORD" expritem  */
+#line 1913 "frontends/spin/spin.y"
+       { yyval = NewAST(AST_EXPRLIST, NewAST(AST_WORDLIST, yyvsp[0], NULL), NULL); }
+#line 9203 "./build/spin.tab.c"
+    break;
+
+  case 417: /* datexpritem: "BYTE" expritem  */
+#line 1915 "frontends/spin/spin.y"
+       { yyval = NewAST(AST_EXPRLIST, NewAST(AST_BYTELIST, yyvsp[0], NULL), NULL); }
+#line 9209 "./build/spin.tab.c"
+    break;
+
+  case 418: /* datexpritem: "WORDFIT" expritem  */
+#line 1917 "frontends/spin/spin.y"
+       {
+           AST *dat = NewAST(AST_EXPRLIST, NewAST(AST_WORDFITLIST, yyvsp[0], NULL), NULL);
+           dat->d.ival = 1; // make it fit
+           yyval = dat;
+       }
+#line 9219 "./build/spin.tab.c"
+    break;
+
+  case 419: /* datexpritem: "BYTEFIT" expritem  */
+#line 1923 "frontends/spin/spin.y"
+       {
+           AST *dat = NewAST(AST_EXPRLIST, NewAST(AST_BYTEFITLIST, yyvsp[0], NULL), NULL);
+           yyval = dat;
+       }
+#line 9228 "./build/spin.tab.c"
+    break;
+
+  case 420: /* datexpritem: "FVAR" expritem  */
+#line 1928 "frontends/spin/spin.y"
+       { yyval = NewAST(AST_EXPRLIST, NewAST(AST_FVAR_LIST, yyvsp[0], NULL), NULL); }
+#line 9234 "./build/spin.tab.c"
+    break;
+
+  case 421: /* datexpritem: "FVARS" expritem  */
+#line 1930 "frontends/spin/spin.y"
+       { yyval = NewAST(AST_EXPRLIST, NewAST(AST_FVARS_LIST, yyvsp[0], NULL), NULL); }
+#line 9240 "./build/spin.tab.c"
+    break;
+
+  case 423: /* datexprlist: datexprlist ',' datexpritem  */
+#line 1936 "frontends/spin/spin.y"
+   { yyval = AddToList(yyvsp[-2], yyvsp[0]); }
+#line 9246 "./build/spin.tab.c"
+    break;
+
+  case 424: /* operand: expr  */
+#line 1941 "frontends/spin/spin.y"
+   { yyval = NewAST(AST_EXPRLIST, yyvsp[0], NULL); }
+#line 9252 "./build/spin.tab.c"
+    break;
+
+  case 425: /* operand: '#' expr  */
+#line 1943 "frontends/spin/spin.y"
+   { yyval = NewAST(AST_EXPRLIST, NewAST(AST_IMMHOLDER, yyvsp[0], NULL), NULL); }
+#line 9258 "./build/spin.tab.c"
+    break;
+
+  case 426: /* operand: '#' '#' expr  */
+#line 1945 "frontends/spin/spin.y"
+   { yyval = NewAST(AST_EXPRLIST, NewAST(AST_BIGIMMHOLDER, yyvsp[0], NULL), NULL); }
+#line 9264 "./build/spin.tab.c"
+    break;
+
+  case 427: /* operand: expr '[' expr ']'  */
+#line 1947 "frontends/spin/spin.y"
+   {
+       /* this is an extra rule for LONG, BYTE, etc. */
+       yyval = NewAST(AST_EXPRLIST, NewAST(AST_ARRAYREF, yyvsp[-3], yyvsp[-1]), NULL);
+   }
+#line 9273 "./build/spin.tab.c"
+    break;
+
+  case 428: /* operandlist: operand  */
+#line 1955 "frontends/spin/spin.y"
+   { yyval = yyvsp[0]; }
+#line 9279 "./build/spin.tab.c"
+    break;
+
+  case 429: /* operandlist: operandlist ',' operand  */
+#line 1957 "frontends/spin/spin.y"
+   { yyval = AddToList(yyvsp[-2], yyvsp[0]); }
+#line 9285 "./build/spin.tab.c"
+    break;
+
+  case 430: /* range: expr  */
+#line 1962 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_RANGE, yyvsp[0], NULL); }
+#line 9291 "./build/spin.tab.c"
+    break;
+
+  case 431: /* range: expr ".." expr  */
+#line 1964 "frontends/spin/spin.y"
+    { yyval = NewAST(AST_RANGE, yyvsp[-2], yyvsp[0]); }
+#line 9297 "./build/spin.tab.c"
+    break;
+
+  case 435: /* identifier: "identifier"  */
+#line 1981 "frontends/spin/spin.y"
+  { yyval = yyvsp[0]; }
+#line 9303 "./build/spin.tab.c"
+    break;
+
+  case 436: /* identifier: "RESULT"  */
+#line 1983 "frontends/spin/spin.y"
+  { yyval = NewAST(AST_RESULT, NULL, NULL); }
+#line 9309 "./build/spin.tab.c"
+    break;
+
+  case 437: /* annotation: SP_ANNOTATION  */
+#line 1988 "frontends/spin/spin.y"
+  { yyval = yyvsp[0]; }
+#line 9315 "./build/spin.tab.c"
+    break;
+
+  case 438: /* hwreg: "hardware register"  */
+#line 1994 "frontends/spin/spin.y"
+  { yyval = yyvsp[0]; }
+#line 9321 "./build/spin.tab.c"
+    break;
+
+  case 439: /* instruction: "instruction"  */
+#line 1999 "frontends/spin/spin.y"
+    { yyval = yyvsp[0]; }
+#line 9327 "./build/spin.tab.c"
+    break;
+
+  case 440: /* instruction: '<' "instruction"  */
+#line 2001 "frontends/spin/spin.y"
+    {
+        AST *ast = yyvsp[0];
+        AST *rootast = yyvsp[0];
+        AST *parent = NULL;
+        while (ast->kind == AST_SRCCOMMENT || ast->kind == AST_COMMENT)
+        {
+            parent = ast;
+            ast = ast->right;
+        }
+        ast = NewAST(AST_COMPRESS_INSTR, ast, NULL);
+        if (parent) {
+            parent->right = ast;
+            yyval = rootast;
+        } else {
+            yyval = ast;
+        }
+    }
+#line 9349 "./build/spin.tab.c"
+    break;
+
+  case 441: /* instruction: instrmodifier instruction  */
+#line 2019 "frontends/spin/spin.y"
+    { yyval = AddToList(yyvsp[0], yyvsp[-1]); }
+#line 9355 "./build/spin.tab.c"
+    break;
+
+  case 442: /* instrmodifier: "instruction modifier"  */
+#line 2024 "frontends/spin/spin.y"
+  { yyval = yyvsp[0]; }
+#line 9361 "./build/spin.tab.c"
+    break;
+
+  case 443: /* modifierlist: instrmodifier  */
+#line 2029 "frontends/spin/spin.y"
+    { yyval = yyvsp[0]; }
+#line 9367 "./build/spin.tab.c"
+    break;
+
+  case 444: /* modifierlist: modifierlist instrmodifier  */
+#line 2031 "frontends/spin/spin.y"
+    { yyval = AddToList(yyvsp[-1], yyvsp[0]); }
+#line 9373 "./build/spin.tab.c"
+    break;
+
+  case 445: /* modifierlist: modifierlist ',' instrmodifier  */
+#line 2033 "frontends/spin/spin.y"
+    { yyval = AddToList(yyvsp[-2], yyvsp[0]); }
+#line 9379 "./build/spin.tab.c"
+    break;
+
+
+#line 9383 "./build/spin.tab.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == SPINYYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      {
+        yypcontext_t yyctx
+          = {yyssp, yytoken};
+        char const *yymsgp = YY_("syntax error");
+        int yysyntax_error_status;
+        yysyntax_error_status = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
+        if (yysyntax_error_status == 0)
+          yymsgp = yymsg;
+        else if (yysyntax_error_status == -1)
+          {
+            if (yymsg != yymsgbuf)
+              YYSTACK_FREE (yymsg);
+            yymsg = YY_CAST (char *,
+                             YYSTACK_ALLOC (YY_CAST (YYSIZE_T, yymsg_alloc)));
+            if (yymsg)
+              {
+                yysyntax_error_status
+                  = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
+                yymsgp = yymsg;
+              }
+            else
+              {
+                yymsg = yymsgbuf;
+                yymsg_alloc = sizeof yymsgbuf;
+                yysyntax_error_status = YYENOMEM;
+              }
+          }
+        yyerror (yymsgp);
+        if (yysyntax_error_status == YYENOMEM)
+          YYNOMEM;
+      }
+    }
+
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= SPINYYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == SPINYYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = SPINYYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != SPINYYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+  if (yymsg != yymsgbuf)
+    YYSTACK_FREE (yymsg);
+  return yyresult;
+}
+
+#line 2036 "frontends/spin/spin.y"
+
+
+void
+spinyyerror(const char *msg)
+{
+    extern int saved_spinyychar;
+    int yychar = saved_spinyychar;
+    
+    SETCOLOR(PRINT_ERROR);
+    ERRORHEADER(current->Lptr->fileName, current->Lptr->lineCounter, "error");
+
+    if (!strcmp(msg, "syntax error, unexpected $end")) {
+        fprintf(stderr, "unexpected end of input");
+        msg = "";
+    }
+    // massage bison's error messages to make them easier to understand
+    while (*msg) {
+        // say which identifier was unexpected
+        if (!strncmp(msg, "unexpected identifier", strlen("unexpected identifier")) && last_ast && last_ast->kind == AST_IDENTIFIER) {
+            fprintf(stderr, "unexpected identifier `%s'", last_ast->d.string);
+            msg += strlen("unexpected identifier");
+        }
+        // if we get a stray character in source, sometimes bison tries to treat it as a token for
+        // error purposes, resulting in $undefined as the token
+        else if (!strncmp(msg, "$undefined", strlen("$undefined")) && yychar >= ' ' && yychar < 127) {
+            fprintf(stderr, "%c", yychar);
+            msg += strlen("$undefined");
+        }
+        else {
+            fprintf(stderr, "%c", *msg);
+            msg++;
+        }
+    }
+    fprintf(stderr, "\n");     
+    gl_errors++;
+    RESETCOLOR();
+}
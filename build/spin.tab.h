@@ -0,0 +1,237 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_SPINYY_BUILD_SPIN_TAB_H_INCLUDED
+# define YY_SPINYY_BUILD_SPIN_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef SPINYYDEBUG
+# if defined YYDEBUG
+#if YYDEBUG
+#   define SPINYYDEBUG 1
+#  else
+#   define SPINYYDEBUG 0
+#  endif
+# else /* ! defined YYDEBUG */
+#  define SPINYYDEBUG 1
+# endif /* ! defined YYDEBUG */
+#endif  /* ! defined SPINYYDEBUG */
+#if SPINYYDEBUG
+extern int spinyydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef SPINYYTOKENTYPE
+# define SPINYYTOKENTYPE
+  enum spinyytokentype
+  {
+    SPINYYEMPTY = -2,
+    SPINYYEOF = 0,                 /* "end of file"  */
+    SPINYYerror = 256,             /* error  */
+    SPINYYUNDEF = 257,             /* "invalid token"  */
+    SP_IDENTIFIER = 258,           /* "identifier"  */
+    SP_BYTECODE = 259,             /* "__bytecode__"  */
+    SP_NUM = 260,                  /* "number"  */
+    SP_STRING = 261,               /* "string"  */
+    SP_BACKTICK_STRING = 262,      /* "` string"  */
+    SP_FLOATNUM = 263,             /* "float point number"  */
+    SP_SPR = 264,                  /* "SPR"  */
+    SP_COGREG = 265,               /* "REG"  */
+    SP_CON = 266,                  /* "CON"  */
+    SP_VAR = 267,                  /* "VAR"  */
+    SP_DAT = 268,                  /* "DAT"  */
+    SP_PUB = 269,                  /* "PUB"  */
+    SP_PRI = 270,                  /* "PRI"  */
+    SP_OBJ = 271,                  /* "OBJ"  */
+    SP_ASM = 272,                  /* "ASM"  */
+    SP_ASM_CONST = 273,            /* "ASM_CONST"  */
+    SP_ENDASM = 274,               /* "ENDASM"  */
+    SP_END = 275,                  /* "END"  */
+    SP_INLINECCODE = 276,          /* "CCODE"  */
+    SP_BYTE = 277,                 /* "BYTE"  */
+    SP_WORD = 278,                 /* "WORD"  */
+    SP_LONG = 279,                 /* "LONG"  */
+    SP_BYTEFIT = 280,              /* "BYTEFIT"  */
+    SP_WORDFIT = 281,              /* "WORDFIT"  */
+    SP_FVAR = 282,                 /* "FVAR"  */
+    SP_FVARS = 283,                /* "FVARS"  */
+    SP_ASMCLK = 284,               /* "ASMCLK"  */
+    SP_INSTR = 285,                /* "instruction"  */
+    SP_INSTRMODIFIER = 286,        /* "instruction modifier"  */
+    SP_HWREG = 287,                /* "hardware register"  */
+    SP_ORG = 288,                  /* "ORG"  */
+    SP_ORGH = 289,                 /* "ORGH"  */
+    SP_ORGF = 290,                 /* "ORGF"  */
+    SP_RES = 291,                  /* "RES"  */
+    SP_FIT = 292,                  /* "FIT"  */
+    SP_ALIGNL = 293,               /* "ALIGNL"  */
+    SP_ALIGNW = 294,               /* "ALIGNW"  */
+    SP_REPEAT = 295,               /* "REPEAT"  */
+    SP_FROM = 296,                 /* "FROM"  */
+    SP_TO = 297,                   /* "TO"  */
+    SP_STEP = 298,                 /* "STEP"  */
+    SP_WHILE = 299,                /* "WHILE"  */
+    SP_UNTIL = 300,                /* "UNTIL"  */
+    SP_IF = 301,                   /* "IF"  */
+    SP_IFNOT = 302,                /* "IFNOT"  */
+    SP_ELSE = 303,                 /* "ELSE"  */
+    SP_ELSEIF = 304,               /* "ELSEIF"  */
+    SP_ELSEIFNOT = 305,            /* "ELSEIFNOT"  */
+    SP_THEN = 306,                 /* "THEN"  */
+    SP_ENDIF = 307,                /* "ENDIF"  */
+    SP_LOOKDOWN = 308,             /* "LOOKDOWN"  */
+    SP_LOOKDOWNZ = 309,            /* "LOOKDOWNZ"  */
+    SP_LOOKUP = 310,               /* "LOOKUP"  */
+    SP_LOOKUPZ = 311,              /* "LOOKUPZ"  */
+    SP_COGINIT = 312,              /* "COGINIT"  */
+    SP_COGNEW = 313,               /* "COGNEW"  */
+    SP_PINR = 314,                 /* "PINREAD"  */
+    SP_PINT = 315,                 /* "PINTOGGLE"  */
+    SP_PINW = 316,                 /* "PINWRITE"  */
+    SP_PINL = 317,                 /* "PINLOW"  */
+    SP_PINH = 318,                 /* "PINHIGH"  */
+    SP_CASE = 319,                 /* "CASE"  */
+    SP_CASE_FAST = 320,            /* "CASE_FAST"  */
+    SP_OTHER = 321,                /* "OTHER"  */
+    SP_QUIT = 322,                 /* "QUIT"  */
+    SP_NEXT = 323,                 /* "NEXT"  */
+    SP_ALLOCA = 324,               /* "__BUILTIN_ALLOCA"  */
+    SP_ABORT = 325,                /* "ABORT"  */
+    SP_RESULT = 326,               /* "RESULT"  */
+    SP_RETURN = 327,               /* "RETURN"  */
+    SP_INDENT = 328,               /* "indentation"  */
+    SP_OUTDENT = 329,              /* "lack of indentation"  */
+    SP_EOLN = 330,                 /* "end of line"  */
+    SP_EOF = 331,                  /* "end of file"  */
+    SP_DOTS = 332,                 /* ".."  */
+    SP_HERE = 333,                 /* "$"  */
+    SP_STRINGPTR = 334,            /* "STRING"  */
+    SP_FILE = 335,                 /* "FILE"  */
+    SP_ANNOTATION = 336,           /* SP_ANNOTATION  */
+    SP_ASSIGN = 337,               /* ":="  */
+    SP_XOR = 338,                  /* "XOR (^^)"  */
+    SP_OR = 339,                   /* "OR (||)"  */
+    SP_AND = 340,                  /* "AND (&&)"  */
+    SP_ORELSE = 341,               /* "__ORELSE__"  */
+    SP_ANDTHEN = 342,              /* "__ANDTHEN__"  */
+    SP_GE = 343,                   /* "=>"  */
+    SP_LE = 344,                   /* "=<"  */
+    SP_GEU = 345,                  /* "+=>"  */
+    SP_LEU = 346,                  /* "+=<"  */
+    SP_GTU = 347,                  /* "+>"  */
+    SP_LTU = 348,                  /* "+<"  */
+    SP_NE = 349,                   /* "<>"  */
+    SP_EQ = 350,                   /* "=="  */
+    SP_SGNCOMP = 351,              /* "<=>"  */
+    SP_LIMITMIN = 352,             /* "#>"  */
+    SP_LIMITMAX = 353,             /* "<#"  */
+    SP_REMAINDER = 354,            /* "//"  */
+    SP_UNSDIV = 355,               /* "+/"  */
+    SP_UNSMOD = 356,               /* "+//"  */
+    SP_FRAC = 357,                 /* "FRAC"  */
+    SP_HIGHMULT = 358,             /* "**"  */
+    SP_SCAS = 359,                 /* "SCAS"  */
+    SP_UNSHIGHMULT = 360,          /* "SCA (+**)"  */
+    SP_ROTR = 361,                 /* "ROR (->)"  */
+    SP_ROTL = 362,                 /* "ROL (<-)"  */
+    SP_SHL = 363,                  /* "<<"  */
+    SP_SHR = 364,                  /* ">>"  */
+    SP_SAR = 365,                  /* "SAR (~>)"  */
+    SP_REV = 366,                  /* "><"  */
+    SP_REV2 = 367,                 /* "REV"  */
+    SP_ADDBITS = 368,              /* "ADDBITS"  */
+    SP_ADDPINS = 369,              /* "ADDPINS"  */
+    SP_NEGATE = 370,               /* "-"  */
+    SP_BIT_NOT = 371,              /* "!"  */
+    SP_SQRT = 372,                 /* "SQRT (^^)"  */
+    SP_ABS = 373,                  /* "ABS (||)"  */
+    SP_FSQRT = 374,                /* "FSQRT"  */
+    SP_FABS = 375,                 /* "FABS"  */
+    SP_DECODE = 376,               /* "DECOD (|<)"  */
+    SP_ENCODE = 377,               /* ">|"  */
+    SP_ENCODE2 = 378,              /* "ENCOD"  */
+    SP_NOT = 379,                  /* "NOT (!!)"  */
+    SP_DOUBLETILDE = 380,          /* "~~"  */
+    SP_INCREMENT = 381,            /* "++"  */
+    SP_DECREMENT = 382,            /* "--"  */
+    SP_DOUBLEAT = 383,             /* "@@"  */
+    SP_TRIPLEAT = 384,             /* "@@@"  */
+    SP_FLOAT = 385,                /* "floating point number"  */
+    SP_TRUNC = 386,                /* "TRUNC"  */
+    SP_ROUND = 387,                /* "ROUND"  */
+    SP_CONSTANT = 388,             /* "constant"  */
+    SP_RANDOM = 389,               /* "??"  */
+    SP_EMPTY = 390,                /* "empty assignment marker _"  */
+    SP_SIGNX = 391,                /* "SIGNX"  */
+    SP_ZEROX = 392,                /* "ZEROX"  */
+    SP_NAN = 393,                  /* "NAN"  */
+    SP_ONES = 394,                 /* "ONES"  */
+    SP_BMASK = 395,                /* "BMASK"  */
+    SP_QLOG = 396,                 /* "QLOG"  */
+    SP_QEXP = 397,                 /* "QEXP"  */
+    SP_DEBUG = 398,                /* "DEBUG"  */
+    SP_LOOK_SEP = 399,             /* ": after lookup/down"  */
+    SP_CONDITIONAL = 400,          /* "?"  */
+    SP_CONDITIONAL_SEP = 401,      /* ": after ?"  */
+    SP_FADD = 402,                 /* "+."  */
+    SP_FSUB = 403,                 /* "-."  */
+    SP_FMUL = 404,                 /* "*."  */
+    SP_FDIV = 405,                 /* "%."  */
+    SP_FLT = 406,                  /* "<."  */
+    SP_FGT = 407,                  /* ">."  */
+    SP_FNE = 408,                  /* "<>."  */
+    SP_FEQ = 409,                  /* "==."  */
+    SP_FLE = 410,                  /* "<=."  */
+    SP_FGE = 411,                  /* ">=."  */
+    SP_FNEGATE = 412               /* "float negate"  */
+  };
+  typedef enum spinyytokentype spinyytoken_kind_t;
+#endif
+
+/* Value type.  */
+#if ! defined SPINYYSTYPE && ! defined SPINYYSTYPE_IS_DECLARED
+typedef int SPINYYSTYPE;
+# define SPINYYSTYPE_IS_TRIVIAL 1
+# define SPINYYSTYPE_IS_DECLARED 1
+#endif
+
+
+
+
+int spinyyparse (void);
+
+
+#endif /* !YY_SPINYY_BUILD_SPIN_TAB_H_INCLUDED  */
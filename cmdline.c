@@ -89,6 +89,8 @@ CompileAsmToBinary(const char *binname, const char *asmname)
     gl_dat_offset = (gl_p2 ? 0 : DEFAULT_P1_DAT_OFFSET);
     gl_interp_kind = 0;
     
+    struct timespan span;
+    timereport_begin(&span, "assemble", asmname);
     Module *Q = ParseTopFiles(&asmname, 1, 1);
     if (gl_errors == 0) {
         if (listFile) {
@@ -96,12 +98,83 @@ CompileAsmToBinary(const char *binname, const char *asmname)
         }
         OutputDatFile(binname, Q, 1);
     }
+    timereport_end(&span, 0);
+}
+
+// like CompileAsmToBinary, but assembles the code left by
+// OutputAsmCode(NULL, P, ...) without going through a text file;
+// if that fails, the code is written out to asmname and assembled
+// from there instead, so the errors point at lines of a real file
+static void
+CompileIRToBinary(const char *binname, const char *asmname, Module *P)
+{
+    Module *Q;
+    struct timespan span;
+    FILE *msgs;
+    int saveStderr;
+    int saveMaxErrors = gl_max_errors;
+    int saveWarnings = gl_warnings;
+    char buf[512];
+    size_t n;
+
+    if (gl_errors > 0) {
+        remove(binname);
+        exit(1);
+    }
+    // hold on to the messages until we know whether they are
+    // any use to the user
+    fflush(stderr);
+    msgs = tmpfile();
+    saveStderr = msgs ? dup(fileno(stderr)) : -1;
+    if (saveStderr < 0 || dup2(fileno(msgs), fileno(stderr)) < 0) {
+        if (msgs) fclose(msgs);
+        if (saveStderr >= 0) close(saveStderr);
+        WriteAsmCode(asmname, P);
+        CompileAsmToBinary(binname, asmname);
+        return;
+    }
+    gl_max_errors = gl_errors + 1000000;
+
+    timereport_begin(&span, "assemble", asmname);
+    Q = NewTopModule(asmname, gl_p2 ? LANG_SPIN_SPIN2 : LANG_SPIN_SPIN1);
+    AssembleAsmCode(Q, P);
+
+    gl_output = OUTPUT_DAT;
+    gl_dat_offset = (gl_p2 ? 0 : DEFAULT_P1_DAT_OFFSET);
+    gl_interp_kind = 0;
+    Q = FinishTopModule(Q, 1);
+    if (gl_errors == 0) {
+        OutputDatFile(binname, Q, 1);
+    }
+
+    fflush(stderr);
+    dup2(saveStderr, fileno(stderr));
+    close(saveStderr);
+    gl_max_errors = saveMaxErrors;
+    timereport_end(&span, 0);
+
+    if (gl_errors == 0) {
+        rewind(msgs);
+        while ((n = fread(buf, 1, sizeof(buf), msgs)) > 0) {
+            fwrite(buf, 1, n, stderr);
+        }
+        fclose(msgs);
+        return;
+    }
+    fclose(msgs);
+
+    // the errors are reported again by the text assembler
+    gl_errors = 0;
+    gl_warnings = saveWarnings;
+    WriteAsmCode(asmname, P);
+    CompileAsmToBinary(binname, asmname);
 }
 
 int ProcessCommandLine(CmdLineOptions *cmd)
 {
     Module *P;
     const char *listFile = NULL;
+    struct timespan span;
     
     if (gl_output == OUTPUT_COGSPIN) {
         gl_optimize_flags &= ~OPT_REMOVE_UNUSED_FUNCS;
@@ -222,7 +295,18 @@ int ProcessCommandLine(CmdLineOptions *cmd)
         gl_printprogress = 1;
     }
 
+    timereport_begin(&span, "ParseTopFiles", NULL);
     P = ParseTopFiles(cmd->file_argv, cmd->file_argc, cmd->outputBin);
+    timereport_end(&span, 0);
+    ReportASTMemory("parsing");
+
+    if (!cmd->quiet) {
+        unsigned hits, misses;
+        if (GetModuleCacheStats(&hits, &misses)) {
+            printf("Parse cache: %u hit%s, %u miss%s\n", hits, hits == 1 ? "" : "s",
+                   misses, misses == 1 ? "" : "es");
+        }
+    }
 
     if (cmd->outputFiles) {
         Module *Q;
@@ -282,6 +366,7 @@ int ProcessCommandLine(CmdLineOptions *cmd)
         } else if (cmd->outputAsm || (cmd->outputBytecode && gl_interp_kind == INTERP_KIND_NUCODE) ) {
             const char *binname = NULL;
             const char *asmname = NULL;
+            int direct = 0;
             if (cmd->compile) {
                 binname = gl_outname;
                 if (binname) {
@@ -311,14 +396,25 @@ int ProcessCommandLine(CmdLineOptions *cmd)
                 if (!gl_p2) {
                     ERROR(NULL, "Nucode only supported on P2");
                 }
+                timereport_begin(&span, "OutputNuCode", NULL);
                 OutputNuCode(asmname, P);
+                timereport_end(&span, 0);
             } else {
-                OutputAsmCode(asmname, P, cmd->outputMain);
+                // when compiling, the assembly text is only needed
+                // for listings and the cycle report; otherwise go straight to binary
+                direct = cmd->compile && !gl_listing && !gl_cycle_report && gl_output != OUTPUT_COGSPIN;
+                timereport_begin(&span, "OutputAsmCode", NULL);
+                OutputAsmCode(direct ? NULL : asmname, P, cmd->outputMain);
+                timereport_end(&span, 0);
             }
             if (cmd->compile)  {
                 gl_caseSensitive = !compile_original;
                 gl_warn_flags &= ~WARN_ASM_USAGE; // already issued warnings
-                CompileAsmToBinary(binname, asmname);
+                if (direct) {
+                    CompileIRToBinary(binname, asmname, P);
+                } else {
+                    CompileAsmToBinary(binname, asmname);
+                }
                 DoPropellerPostprocess(binname, cmd->useEeprom ? cmd->eepromSize : 0);
                 if (!cmd->quiet) {
                     printf("Done.\n");
@@ -339,7 +435,9 @@ int ProcessCommandLine(CmdLineOptions *cmd)
             if (gl_interp_kind == INTERP_KIND_NUCODE) {
                 ERROR(NULL, "How did we get here?");
             } else {
+                timereport_begin(&span, "OutputByteCode", NULL);
                 OutputByteCode(cmd->outname,P);
+                timereport_end(&span, 0);
                 DoPropellerPostprocess(cmd->outname,cmd->useEeprom ? cmd->eepromSize : 0);
             }
         } else {
@@ -349,6 +447,7 @@ int ProcessCommandLine(CmdLineOptions *cmd)
         fprintf(stderr, "parse error\n");
         return 1;
     }
+    ReportASTMemory("code generation");
 
     return 0;
 }
@@ -414,6 +513,8 @@ static struct optflag_table {
     { "bcmacros", OPT_MAKE_MACROS },
     { "special-functions", OPT_SPECIAL_FUNCS },
     { "cordic-reorder", OPT_CORDIC_REORDER},
+    { "case-tree", OPT_CASE_TREE },
+    { "auto-lut", OPT_AUTO_LUT },
     { "all", OPT_FLAGS_ALL },
 };
 #define ARRAY_SIZE(a) (sizeof(a) / sizeof(a[0]))
@@ -714,20 +714,25 @@ PerformCSE(Module *Q)
     Module *savecur = current;
     Function *func;
     Function *savefunc = curfunc;
+    struct timespan span;
     
     InitCSESet(&cse);
     current = Q;
     for (func = Q->functions; func; func = func->next) {
         if (func->optimize_flags & OPT_PERFORM_CSE) {
             curfunc = func;
+            timereport_begin(&span, "PerformCSE", func->name);
             doPerformCSE(NULL, &func->body, &cse, 0, NULL);
             ClearCSESet(&cse);
+            timereport_end(&span, 0);
         }
     }
     curfunc = savefunc;
     current = savecur;
 
+    timereport_begin(&span, "PerformLoopOptimization", Q->fullname);
     PerformLoopOptimization(Q);
+    timereport_end(&span, 0);
 }
 
 //
@@ -59,6 +59,7 @@ Usage(FILE *f)
     fprintf(f, "  [ -L or -I <path> ] add a directory to the include path\n");
     fprintf(f, "  [ -o <name> ]      set output filename to <name>\n");
     fprintf(f, "  [ -2 ]             compile for Prop2\n");
+    fprintf(f, "  [ -j N ]           use N threads to optimize functions\n");
     fprintf(f, "  [ -O# ]            set optimization level:\n");
     fprintf(f, "          -O0 = no optimization\n");
     fprintf(f, "          -O1 = basic optimization\n");
@@ -69,13 +70,18 @@ Usage(FILE *f)
     fprintf(f, "  [ -Wmax-errors=N ] allow at most N errors in a pass before stopping\n");
     fprintf(f, "  [ -x ]             capture program exit code (for testing)\n");
     //fprintf(f, "  [ -z ]             compress code\n");
+    fprintf(f, "  [ --cache-dir=dir ] keep cached parse trees in directory dir\n");
     fprintf(f, "  [ --code=cog ]     compile for COG mode instead of LMM\n");
     fprintf(f, "  [ --fcache=N ]     set FCACHE size to N (0 to disable)\n");
     fprintf(f, "  [ --fixedreal ]    use 16.16 fixed point in place of floats\n");
     fprintf(f, "  [ --lmm=xxx ]      use alternate LMM implementation for P1\n");
     fprintf(f, "           xxx = orig uses original flexspin LMM\n");
     fprintf(f, "           xxx = slow uses traditional (slow) LMM\n");
-    fprintf(f, "  [ --verbose ]      print additional diagnostic messages\n");
+    fprintf(f, "  [ --profile-gen ]  add code to count function calls and loop trips\n");
+    fprintf(f, "  [ --profile-use=file ] use counts from --profile-gen to guide optimization\n");
+    fprintf(f, "  [ --cycle-report ] write cycle count bounds for the generated code to a .cycles.json file\n");
+    fprintf(f, "  [ --time-report[=trace.json] ] print where the compiler spent its time\n");
+    fprintf(f, "  [ --verbose[=N] ]  print additional diagnostic messages (2 adds optimizer statistics)\n");
     fprintf(f, "  [ --version ]      just show compiler version\n");
     
     fflush(stderr);
@@ -190,6 +196,24 @@ main(int argc, const char **argv)
                 Usage(stderr);
             }
             argv++; --argc;
+        } else if (!strncmp(argv[0], "--cache-dir=", 12)) {
+            gl_cache_dir = argv[0]+12;
+            argv++; --argc;
+        } else if (!strcmp(argv[0], "--profile-gen")) {
+            gl_profile_gen = 1;
+            argv++; --argc;
+        } else if (!strncmp(argv[0], "--profile-use=", 14)) {
+            gl_profile_use = argv[0]+14;
+            argv++; --argc;
+        } else if (!strcmp(argv[0], "--cycle-report")) {
+            gl_cycle_report = 1;
+            argv++; --argc;
+        } else if (!strcmp(argv[0], "--time-report")) {
+            timereport_enable(NULL);
+            argv++; --argc;
+        } else if (!strncmp(argv[0], "--time-report=", 14)) {
+            timereport_enable(argv[0]+14);
+            argv++; --argc;
         } else if (!strncmp(argv[0], "--fcache=", 9)) {
             gl_fcache_size = atoi(argv[0]+9);
             if (gl_fcache_size < 8) {
@@ -253,6 +277,9 @@ main(int argc, const char **argv)
         } else if (!strcmp(argv[0], "--verbose")) {
             gl_verbosity = 1;
             argv++; --argc;
+        } else if (!strncmp(argv[0], "--verbose=", 10)) {
+            gl_verbosity = atoi(argv[0] + 10);
+            argv++; --argc;
         } else if (!strcmp(argv[0], "-v")) {
             cmd->quiet = 0;
             argv++; --argc;
@@ -358,6 +385,22 @@ main(int argc, const char **argv)
             opt = strdup(opt);
             incpath = opt;
             pp_add_to_path(&gl_pp, incpath);
+        } else if (!strncmp(argv[0], "-j", 2)) {
+            // run back end work on N threads
+            const char *num;
+            if (argv[0][2] != 0) {
+                num = &argv[0][2];
+            } else {
+                argv++;
+                --argc;
+                num = argv[0];
+            }
+            gl_jobs = num ? atoi(num) : 0;
+            if (gl_jobs < 1) {
+                fprintf(stderr, "-j requires a positive number of threads\n");
+                Usage(stderr);
+            }
+            argv++; --argc;
         } else if (!strncmp(argv[0], "-O", 2)) {
             // -O0 means no optimization
             // -O1 means default optimization
@@ -404,6 +447,7 @@ main(int argc, const char **argv)
 
     /* tweak flags */
     result = ProcessCommandLine(cmd);
+    timereport_finish(stdout);
     if (result) {
         return result;
     }
@@ -0,0 +1,151 @@
+/*
+ * Cycle counting simulator for flexspin generated binaries
+ * Copyright 2024 Total Spectrum Software Inc.
+ * See the file COPYING for terms of use
+ *
+ * Runs a P1 or P2 binary without hardware: serial output from the
+ * program goes to stdout, and the time spent in each function (found
+ * from the listing file produced by flexspin -l) can be reported.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "sim/sim.h"
+
+static const char *progname = "flexsim";
+
+static void
+Usage(FILE *f)
+{
+    fprintf(f, "usage: %s [options] file.binary\n", progname);
+    fprintf(f, "  [ -h ]                 display this help\n");
+    fprintf(f, "  [ -1 ]                 the binary is for the Propeller 1\n");
+    fprintf(f, "  [ -2 ]                 the binary is for the Propeller 2\n");
+    fprintf(f, "  [ -l <file.lst> ]      read function names from this listing\n");
+    fprintf(f, "                         (default: file.lst, if it exists)\n");
+    fprintf(f, "  [ -q ]                 do not print the cycle count at the end\n");
+    fprintf(f, "  [ --profile[=file] ]   print the time spent in each function, and\n");
+    fprintf(f, "                         optionally write it to a JSON file\n");
+    fprintf(f, "  [ --max-cycles=<n> ]   stop after n clock cycles\n");
+    fprintf(f, "  [ --baud=<n> ]         baud rate of bit banged serial output\n");
+    fprintf(f, "  [ --trace ]            print every instruction executed to stderr\n");
+}
+
+static int
+FileExists(const char *name)
+{
+    FILE *f = fopen(name, "r");
+
+    if (!f) return 0;
+    fclose(f);
+    return 1;
+}
+
+int
+main(int argc, const char **argv)
+{
+    static Sim sim;
+    Sim *S = &sim;
+    int p2 = -1;
+    int quiet = 0;
+    int profile = 0;
+    int trace = 0;
+    const char *profileFile = NULL;
+    const char *listFile = NULL;
+    const char *binFile = NULL;
+    unsigned long long maxCycles = 0;
+    unsigned long baud = 0;
+    char *defaultList = NULL;
+    char *dot;
+
+    argv++; --argc;
+    while (argc > 0) {
+        const char *arg = argv[0];
+        if (!strcmp(arg, "-h") || !strcmp(arg, "--help")) {
+            Usage(stdout);
+            return 0;
+        } else if (!strcmp(arg, "-1")) {
+            p2 = 0;
+        } else if (!strcmp(arg, "-2")) {
+            p2 = 1;
+        } else if (!strcmp(arg, "-q")) {
+            quiet = 1;
+        } else if (!strncmp(arg, "-l", 2)) {
+            if (arg[2]) {
+                listFile = arg + 2;
+            } else if (argc > 1) {
+                listFile = argv[1];
+                argv++; --argc;
+            } else {
+                Usage(stderr);
+                return 2;
+            }
+        } else if (!strcmp(arg, "--profile")) {
+            profile = 1;
+        } else if (!strncmp(arg, "--profile=", 10)) {
+            profile = 1;
+            profileFile = arg + 10;
+        } else if (!strncmp(arg, "--max-cycles=", 13)) {
+            maxCycles = strtoull(arg + 13, NULL, 0);
+        } else if (!strcmp(arg, "--trace")) {
+            trace = 1;
+        } else if (!strncmp(arg, "--baud=", 7)) {
+            baud = strtoul(arg + 7, NULL, 0);
+        } else if (arg[0] == '-') {
+            fprintf(stderr, "%s: unknown option %s\n", progname, arg);
+            Usage(stderr);
+            return 2;
+        } else if (binFile) {
+            fprintf(stderr, "%s: only one binary may be given\n", progname);
+            return 2;
+        } else {
+            binFile = arg;
+        }
+        argv++; --argc;
+    }
+    if (!binFile) {
+        Usage(stderr);
+        return 2;
+    }
+    if (p2 < 0) {
+        p2 = SimGuessP2(binFile);
+    }
+    SimInit(S, p2);
+    if (maxCycles) S->maxCycles = maxCycles;
+    if (baud) S->baud = baud;
+    if (trace) S->trace = stderr;
+    if (!SimLoadBinary(S, binFile)) {
+        return 2;
+    }
+    if (!listFile) {
+        defaultList = (char *)malloc(strlen(binFile) + 5);
+        strcpy(defaultList, binFile);
+        dot = strrchr(defaultList, '.');
+        if (dot && !strchr(dot, '/') && !strchr(dot, '\\')) {
+            *dot = 0;
+        }
+        strcat(defaultList, ".lst");
+        if (FileExists(defaultList)) {
+            listFile = defaultList;
+        }
+    }
+    if (listFile && !SimReadListing(S, listFile)) {
+        return 2;
+    }
+    if (profile && !listFile) {
+        fprintf(stderr, "%s: warning: no listing file, so no function names are known\n", progname);
+    }
+
+    SimRun(S);
+
+    if (!quiet || profile) {
+        SimReport(S, stderr, profile);
+    }
+    if (profileFile && !SimWriteProfile(S, profileFile)) {
+        return 2;
+    }
+    if (S->error) {
+        return 2;
+    }
+    return S->exitStatus;
+}
@@ -84,6 +84,7 @@ Usage(FILE *f, int bstcMode)
     fprintf(f, "          -O0 = no optimization\n");
     fprintf(f, "          -O1 = basic optimization\n");
     fprintf(f, "          -O2 = all optimization\n");
+    fprintf(f, "  [ -j N ]           use N threads to optimize functions\n");
     fprintf(f, "  [ -H nnnn ]        set starting hub address\n");
     fprintf(f, "  [ -E ]             skip initial coginit code (usually used with -H)\n");
     fprintf(f, "  [ -w ]             compile for COG with Spin wrappers\n");
@@ -96,6 +97,7 @@ Usage(FILE *f, int bstcMode)
     //fprintf(f, "  [ -z ]             compress code\n");
     fprintf(f, "  [ --charset=xxx ]  set character set for runtime\n");
     fprintf(f, "           xxx is one of utf8, latin1, or parallax\n");
+    fprintf(f, "  [ --cache-dir=dir ] keep cached parse trees in directory dir\n");
     fprintf(f, "  [ --code=cog ]     compile for COG mode instead of LMM\n");
     fprintf(f, "  [ --interp=rom ]   compile bytecodes for P1 ROM interpreter (alpha feature!)\n");
     fprintf(f, "  [ --interp=nu ]    compile bytecodes for NuCode interpreter (alpha feature!)\n");
@@ -104,8 +106,12 @@ Usage(FILE *f, int bstcMode)
     fprintf(f, "  [ --lmm=xxx ]      use alternate LMM implementation for P1\n");
     fprintf(f, "           xxx = orig uses original flexspin LMM\n");
     fprintf(f, "           xxx = slow uses traditional (slow) LMM\n");
+    fprintf(f, "  [ --profile-gen ]  add code to count function calls and loop trips\n");
+    fprintf(f, "  [ --profile-use=file ] use counts from --profile-gen to guide optimization\n");
+    fprintf(f, "  [ --cycle-report ] write cycle count bounds for the generated code to a .cycles.json file\n");
+    fprintf(f, "  [ --time-report[=trace.json] ] print where the compiler spent its time\n");
     fprintf(f, "  [ --tabs=N ]       assume tabs are set every N spaces for indentation purposes\n");
-    fprintf(f, "  [ --verbose ]      print additional diagnostic messages\n");
+    fprintf(f, "  [ --verbose[=N] ]  print additional diagnostic messages (2 adds optimizer statistics)\n");
     fprintf(f, "  [ --version ]      just show compiler version\n");
     
     fflush(stderr);
@@ -242,6 +248,24 @@ main(int argc, const char **argv)
                 Usage(stderr, cmd->bstcMode);
             }
             argv++; --argc;
+        } else if (!strncmp(argv[0], "--cache-dir=", 12)) {
+            gl_cache_dir = argv[0]+12;
+            argv++; --argc;
+        } else if (!strcmp(argv[0], "--profile-gen")) {
+            gl_profile_gen = 1;
+            argv++; --argc;
+        } else if (!strncmp(argv[0], "--profile-use=", 14)) {
+            gl_profile_use = argv[0]+14;
+            argv++; --argc;
+        } else if (!strcmp(argv[0], "--cycle-report")) {
+            gl_cycle_report = 1;
+            argv++; --argc;
+        } else if (!strcmp(argv[0], "--time-report")) {
+            timereport_enable(NULL);
+            argv++; --argc;
+        } else if (!strncmp(argv[0], "--time-report=", 14)) {
+            timereport_enable(argv[0]+14);
+            argv++; --argc;
         } else if (!strncmp(argv[0], "--fcache=", 9)) {
             gl_fcache_size = atoi(argv[0]+9);
             if (gl_fcache_size < 8) {
@@ -300,6 +324,9 @@ main(int argc, const char **argv)
         } else if (!strcmp(argv[0], "--verbose")) {
             gl_verbosity = 1;
             argv++; --argc;
+        } else if (!strncmp(argv[0], "--verbose=", 10)) {
+            gl_verbosity = atoi(argv[0] + 10);
+            argv++; --argc;
         } else if (!strcmp(argv[0], "-w")) {
             gl_outputflags |= OUTFLAG_COG_CODE;
             gl_output = OUTPUT_COGSPIN;
@@ -452,6 +479,22 @@ main(int argc, const char **argv)
             opt = strdup(opt);
             incpath = opt;
             pp_add_to_path(&gl_pp, incpath);
+        } else if (!strncmp(argv[0], "-j", 2)) {
+            // run back end work on N threads
+            const char *num;
+            if (argv[0][2] != 0) {
+                num = &argv[0][2];
+            } else {
+                argv++;
+                --argc;
+                num = argv[0];
+            }
+            gl_jobs = num ? atoi(num) : 0;
+            if (gl_jobs < 1) {
+                fprintf(stderr, "-j requires a positive number of threads\n");
+                Usage(stderr, cmd->bstcMode);
+            }
+            argv++; --argc;
         } else if (!strncmp(argv[0], "-O", 2)) {
             // -O0 means no optimization
             // -O1 means default optimization
@@ -531,6 +574,7 @@ main(int argc, const char **argv)
 
     /* tweak flags */
     result = ProcessCommandLine(cmd);
+    timereport_finish(stdout);
     if (result) {
         return result;
     }
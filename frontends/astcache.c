@@ -0,0 +1,923 @@
+/*
+ * Spin to C/C++ converter
+ * Copyright 2011-2021 Total Spectrum Software Inc.
+ * See the file COPYING for terms of use
+ *
+ * on-disk cache of parsed modules
+ *
+ * After a module has been parsed (but before ProcessModule runs) its
+ * state is nothing more than a few lists of parse trees, so we can
+ * write those out and read them back in on later runs instead of
+ * lexing and parsing the source again. Cache files live in the
+ * directory given by --cache-dir or FLEXSPIN_CACHE_DIR (caching is off
+ * if neither is set) and are keyed by the compiler executable plus
+ * whatever key string the caller gives; anything we do not know how
+ * to write, or any parse with side effects outside the module, just
+ * means the module does not get cached.
+ * Every change to a source file gives a new cache file, so once the
+ * directory gets bigger than FLEXSPIN_CACHE_SIZE kilobytes (64 MB by
+ * default) the files used least recently are removed.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/stat.h>
+#include <dirent.h>
+#include <utime.h>
+#include "spinc.h"
+#ifdef WIN32
+#include <direct.h>
+#include <process.h>
+#define MKDIR(d) _mkdir(d)
+#else
+#include <unistd.h>
+#define MKDIR(d) mkdir(d, 0777)
+#endif
+
+#define CACHE_SUFFIX ".flexcache"
+#define DEFAULT_CACHE_SIZE (64*1024)  /* in kilobytes */
+
+#define CACHE_MAGIC "FLEXCACHE2\n"
+
+extern const char *gl_progname;
+
+const char *gl_cache_dir;
+
+/* statistics for the cache */
+static unsigned cacheHits;
+static unsigned cacheMisses;
+
+/* encodings for AST references */
+enum {
+    TAG_NULL,
+    TAG_NEW,
+    TAG_REF,
+    TAG_GLOBAL,
+};
+
+/* what the "d" field of an AST holds */
+enum {
+    DATA_NONE,
+    DATA_INT,
+    DATA_STRING,
+    DATA_AST,
+    DATA_PASMWORD,
+};
+
+/* type nodes shared by everyone; these must keep their identity */
+static AST **globalTypes[] = {
+    &ast_type_long, &ast_type_word, &ast_type_byte, &ast_type_unsigned_long,
+    &ast_type_signed_word, &ast_type_signed_byte, &ast_type_float,
+    &ast_type_float64, &ast_type_string, &ast_type_generic,
+    &ast_type_const_generic, &ast_type_void, &ast_type_ptr_long,
+    &ast_type_ptr_word, &ast_type_ptr_byte, &ast_type_ptr_void,
+    &ast_type_bitfield, &ast_type_long64, &ast_type_unsigned_long64,
+    &ast_type_generic_funcptr, &ast_type_sendptr, &ast_type_recvptr,
+};
+
+static int
+DataKind(int kind)
+{
+    switch (kind) {
+    case AST_INTEGER:
+    case AST_FLOAT:
+    case AST_OPERATOR:
+    case AST_ASSIGN:
+    case AST_FUNCHOLDER:
+        return DATA_INT;
+    case AST_IDENTIFIER:
+    case AST_STRING:
+    case AST_COMMENT:
+    case AST_ANNOTATION:
+    case AST_BYTECODE:
+        return DATA_STRING;
+    case AST_PUBFUNC:
+    case AST_PRIFUNC:
+        return DATA_AST;
+    case AST_INSTR:
+    case AST_INSTRMODIFIER:
+    case AST_HWREG:
+        return DATA_PASMWORD;
+    default:
+        return DATA_NONE;
+    }
+}
+
+static int
+PasmWordKind(int kind)
+{
+    switch (kind) {
+    case AST_INSTR:
+        return SYM_INSTR;
+    case AST_INSTRMODIFIER:
+        return SYM_INSTRMODIFIER;
+    default:
+        return SYM_HWREG;
+    }
+}
+
+//
+// map from pointers to the index we wrote them at
+//
+typedef struct PtrMap {
+    const void **keys;
+    unsigned *vals;
+    unsigned size;   /* always a power of 2 */
+    unsigned count;
+} PtrMap;
+
+static unsigned
+PtrHash(const void *p)
+{
+    uintptr_t x = (uintptr_t)p;
+    x ^= x >> 17;
+    x *= 0x9e3779b1U;
+    return (unsigned)(x ^ (x >> 15));
+}
+
+static int
+PtrMapFind(PtrMap *M, const void *key, unsigned *val)
+{
+    unsigned i;
+
+    if (!M->size) {
+        return 0;
+    }
+    for (i = PtrHash(key) & (M->size-1); M->keys[i]; i = (i+1) & (M->size-1)) {
+        if (M->keys[i] == key) {
+            *val = M->vals[i];
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void
+PtrMapAdd(PtrMap *M, const void *key, unsigned val)
+{
+    unsigned i;
+
+    if (2*(M->count+1) > M->size) {
+        PtrMap old = *M;
+        M->size = old.size ? 2*old.size : 1024;
+        M->count = 0;
+        M->keys = (const void **)calloc(M->size, sizeof(*M->keys));
+        M->vals = (unsigned *)calloc(M->size, sizeof(*M->vals));
+        if (!M->keys || !M->vals) {
+            fprintf(stderr, "FATAL: out of memory\n");
+            exit(2);
+        }
+        for (i = 0; i < old.size; i++) {
+            if (old.keys[i]) {
+                PtrMapAdd(M, old.keys[i], old.vals[i]);
+            }
+        }
+        free(old.keys);
+        free(old.vals);
+    }
+    for (i = PtrHash(key) & (M->size-1); M->keys[i]; i = (i+1) & (M->size-1))
+        ;
+    M->keys[i] = key;
+    M->vals[i] = val;
+    M->count++;
+}
+
+static void
+PtrMapFree(PtrMap *M)
+{
+    free(M->keys);
+    free(M->vals);
+}
+
+/* 64 bit FNV-1a hash, used for naming cache files and building keys */
+uint64_t
+CacheHash(uint64_t hash, const void *data, size_t len)
+{
+    const unsigned char *s = (const unsigned char *)data;
+
+    if (!hash) {
+        hash = 0xcbf29ce484222325ULL;
+    }
+    while (len-- > 0) {
+        hash = (hash ^ *s++) * 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+/* checksum stored at the end of each cache file */
+static uint32_t
+Checksum(const unsigned char *data, size_t len)
+{
+    uint32_t hash = 0x811c9dc5;
+
+    while (len-- > 0) {
+        hash = (hash ^ *data++) * 0x01000193;
+    }
+    return hash;
+}
+
+//
+// writing
+//
+typedef struct CacheWriter {
+    Flexbuf fb;
+    PtrMap nodes;
+    PtrMap strings;
+    unsigned numnodes;
+    unsigned numstrings;
+    LexStream *lexdata;
+    int failed;
+} CacheWriter;
+
+static void
+PutNum(CacheWriter *W, uint32_t v)
+{
+    while (v >= 0x80) {
+        flexbuf_addchar(&W->fb, (v & 0x7f) | 0x80);
+        v = v >> 7;
+    }
+    flexbuf_addchar(&W->fb, v);
+}
+
+static void
+PutString(CacheWriter *W, const char *s)
+{
+    unsigned id;
+    size_t len;
+
+    if (!s) {
+        PutNum(W, TAG_NULL);
+    } else if (PtrMapFind(&W->strings, s, &id)) {
+        PutNum(W, TAG_REF);
+        PutNum(W, id);
+    } else {
+        PtrMapAdd(&W->strings, s, W->numstrings++);
+        len = strlen(s);
+        PutNum(W, TAG_NEW);
+        PutNum(W, len);
+        flexbuf_addmem(&W->fb, s, len+1);
+    }
+}
+
+static void
+PutAST(CacheWriter *W, AST *ast)
+{
+    unsigned id;
+    unsigned i;
+
+    if (!ast) {
+        PutNum(W, TAG_NULL);
+        return;
+    }
+    for (i = 0; i < N_ELEMENTS(globalTypes); i++) {
+        if (ast == *globalTypes[i]) {
+            PutNum(W, TAG_GLOBAL);
+            PutNum(W, i);
+            return;
+        }
+    }
+    if (PtrMapFind(&W->nodes, ast, &id)) {
+        PutNum(W, TAG_REF);
+        PutNum(W, id);
+        return;
+    }
+    PtrMapAdd(&W->nodes, ast, W->numnodes++);
+    PutNum(W, TAG_NEW);
+    PutNum(W, ast->kind);
+    if (!ast->lexdata) {
+        PutNum(W, 0);
+    } else if (ast->lexdata == W->lexdata) {
+        PutNum(W, ast->lineidx + 1);
+    } else {
+        W->failed = 1;
+    }
+    switch (DataKind(ast->kind)) {
+    case DATA_INT:
+        PutNum(W, ast->d.ival);
+        break;
+    case DATA_STRING:
+        PutString(W, ast->d.string);
+        break;
+    case DATA_AST:
+        PutAST(W, (AST *)ast->d.ptr);
+        break;
+    case DATA_PASMWORD:
+    {
+        // Instruction, InstrModifier and HwReg all start with the name
+        const char *name = ast->d.ptr ? *(const char **)ast->d.ptr : NULL;
+        // make sure the lexer will give us the same thing back
+        if (!name || LookupPasmWord(name, PasmWordKind(ast->kind)) != ast->d.ptr) {
+            W->failed = 1;
+        }
+        PutString(W, name);
+        break;
+    }
+    default:
+        if (ast->d.ptr) {
+            W->failed = 1;
+        }
+        break;
+    }
+    PutAST(W, ast->left);
+    PutAST(W, ast->right);
+}
+
+/* write a pointer into a list that has already been written */
+static void
+PutASTRef(CacheWriter *W, AST *ast)
+{
+    unsigned id;
+
+    if (ast && !PtrMapFind(&W->nodes, ast, &id)) {
+        W->failed = 1;
+        return;
+    }
+    PutAST(W, ast);
+}
+
+//
+// reading
+//
+typedef struct CacheReader {
+    unsigned char *ptr;
+    unsigned char *end;
+    AST **nodes;
+    unsigned numnodes;
+    unsigned maxnodes;
+    const char **strings;
+    unsigned numstrings;
+    unsigned maxstrings;
+    LexStream *lexdata;
+    int failed;
+} CacheReader;
+
+static uint32_t
+GetNum(CacheReader *R)
+{
+    uint32_t v = 0;
+    int shift = 0;
+    int c;
+
+    do {
+        if (R->ptr >= R->end || shift > 28) {
+            R->failed = 1;
+            return 0;
+        }
+        c = *R->ptr++;
+        v |= (uint32_t)(c & 0x7f) << shift;
+        shift += 7;
+    } while (c & 0x80);
+    return v;
+}
+
+static void *
+GrowArray(void *array, unsigned *max, size_t elemsize)
+{
+    *max = *max ? 2 * *max : 1024;
+    array = realloc(array, *max * elemsize);
+    if (!array) {
+        fprintf(stderr, "FATAL: out of memory\n");
+        exit(2);
+    }
+    return array;
+}
+
+static const char *
+GetString(CacheReader *R)
+{
+    uint32_t tag = GetNum(R);
+    uint32_t len;
+    const char *s;
+
+    switch (tag) {
+    case TAG_NULL:
+        return NULL;
+    case TAG_REF:
+        tag = GetNum(R);
+        if (tag >= R->numstrings) {
+            break;
+        }
+        return R->strings[tag];
+    case TAG_NEW:
+        len = GetNum(R);
+        if (len >= (size_t)(R->end - R->ptr) || R->ptr[len] != 0) {
+            break;
+        }
+        // the string stays in the file buffer, which is never freed
+        s = (const char *)R->ptr;
+        R->ptr += len+1;
+        if (R->numstrings == R->maxstrings) {
+            R->strings = (const char **)GrowArray(R->strings, &R->maxstrings, sizeof(*R->strings));
+        }
+        R->strings[R->numstrings++] = s;
+        return s;
+    default:
+        break;
+    }
+    R->failed = 1;
+    return NULL;
+}
+
+static AST *
+GetAST(CacheReader *R)
+{
+    uint32_t tag = GetNum(R);
+    uint32_t line;
+    AST *ast;
+
+    switch (tag) {
+    case TAG_NULL:
+        return NULL;
+    case TAG_GLOBAL:
+        tag = GetNum(R);
+        if (tag >= N_ELEMENTS(globalTypes)) {
+            break;
+        }
+        return *globalTypes[tag];
+    case TAG_REF:
+        tag = GetNum(R);
+        if (tag >= R->numnodes) {
+            break;
+        }
+        return R->nodes[tag];
+    case TAG_NEW:
+        ast = NewAST((enum astkind)GetNum(R), NULL, NULL);
+        line = GetNum(R);
+        ast->lexdata = line ? R->lexdata : NULL;
+        ast->lineidx = line ? line - 1 : 0;
+        if (R->numnodes == R->maxnodes) {
+            R->nodes = (AST **)GrowArray(R->nodes, &R->maxnodes, sizeof(*R->nodes));
+        }
+        R->nodes[R->numnodes++] = ast;
+        switch (DataKind(ast->kind)) {
+        case DATA_INT:
+            ast->d.ival = GetNum(R);
+            break;
+        case DATA_STRING:
+            ast->d.string = GetString(R);
+            if (ast->kind == AST_IDENTIFIER) {
+                ast->d.string = InternString(ast->d.string);
+            }
+            break;
+        case DATA_AST:
+            ast->d.ptr = (void *)GetAST(R);
+            break;
+        case DATA_PASMWORD:
+        {
+            const char *name = GetString(R);
+            ast->d.ptr = name ? LookupPasmWord(name, PasmWordKind(ast->kind)) : NULL;
+            if (!ast->d.ptr) {
+                R->failed = 1;
+            }
+            break;
+        }
+        default:
+            break;
+        }
+        if (R->failed) {
+            return NULL;
+        }
+        ast->left = GetAST(R);
+        ast->right = GetAST(R);
+        return ast;
+    default:
+        break;
+    }
+    R->failed = 1;
+    return NULL;
+}
+
+//
+// cache file naming
+//
+
+/* the directory to keep cache files in, or NULL if caching is off */
+static const char *
+CacheDirectory(void)
+{
+    if (!gl_cache_dir) {
+        gl_cache_dir = getenv("FLEXSPIN_CACHE_DIR");
+    }
+    if (gl_cache_dir && !gl_cache_dir[0]) {
+        return NULL;
+    }
+    return gl_cache_dir;
+}
+
+/* identifies the compiler build, so a rebuilt compiler never uses stale data */
+static const char *
+CompilerStamp(void)
+{
+    static char stamp[64];
+    static int inited = 0;
+    char path[1024];
+    const char *argv[2];
+    struct stat st;
+
+    if (!inited) {
+        inited = 1;
+        argv[0] = gl_progname;
+        argv[1] = NULL;
+        if (getProgramPath(argv, path, sizeof(path)) == 0 && stat(path, &st) == 0) {
+            snprintf(stamp, sizeof(stamp), "%lx.%llx.%u", (unsigned long)st.st_size,
+                     (unsigned long long)st.st_mtime, (unsigned)sizeof(void *));
+        }
+    }
+    return stamp[0] ? stamp : NULL;
+}
+
+/* returns the full key for the cache (in *fullkey) and the file name to use */
+static char *
+CacheFileName(const char *key, char **fullkey)
+{
+    const char *dir = CacheDirectory();
+    const char *stamp;
+    uint64_t hash;
+    char *name;
+    size_t len;
+
+    if (!dir || !(stamp = CompilerStamp())) {
+        return NULL;
+    }
+    len = strlen(stamp) + strlen(key) + 2;
+    *fullkey = (char *)malloc(len);
+    snprintf(*fullkey, len, "%s %s", stamp, key);
+    hash = CacheHash(0, *fullkey, strlen(*fullkey));
+    len = strlen(dir) + 32;
+    name = (char *)malloc(len);
+    snprintf(name, len, "%s/%016llx" CACHE_SUFFIX, dir, (unsigned long long)hash);
+    return name;
+}
+
+typedef struct CacheFileInfo {
+    char *name;
+    unsigned long size;
+    time_t used;
+} CacheFileInfo;
+
+static int
+CompareCacheUse(const void *a, const void *b)
+{
+    const CacheFileInfo *fa = (const CacheFileInfo *)a;
+    const CacheFileInfo *fb = (const CacheFileInfo *)b;
+    if (fa->used != fb->used) {
+        return fa->used < fb->used ? -1 : 1;
+    }
+    return strcmp(fa->name, fb->name);
+}
+
+/*
+ * keep the cache directory within its size limit by removing the
+ * files used least recently; LoadModuleFromCache touches the files it
+ * reads, so the modification time is when a file was last used
+ * this is done at most once per compile
+ */
+static void
+PruneCache(void)
+{
+    static int pruned = 0;
+    const char *dir = CacheDirectory();
+    const char *env = getenv("FLEXSPIN_CACHE_SIZE");
+    unsigned long limit = DEFAULT_CACHE_SIZE;
+    unsigned long total = 0;
+    CacheFileInfo *files = NULL;
+    unsigned numfiles = 0, maxfiles = 0, i;
+    size_t len, suffixlen = strlen(CACHE_SUFFIX);
+    struct dirent *ent;
+    struct stat st;
+    DIR *d;
+
+    if (pruned || !dir) {
+        return;
+    }
+    pruned = 1;
+    if (env && *env) {
+        limit = strtoul(env, NULL, 0);
+    }
+    limit *= 1024;
+    d = opendir(dir);
+    if (!d) {
+        return;
+    }
+    while ((ent = readdir(d)) != NULL) {
+        len = strlen(ent->d_name);
+        if (len <= suffixlen || strcmp(ent->d_name + len - suffixlen, CACHE_SUFFIX) != 0) {
+            continue;
+        }
+        if (numfiles == maxfiles) {
+            files = (CacheFileInfo *)GrowArray(files, &maxfiles, sizeof(*files));
+        }
+        len += strlen(dir) + 2;
+        files[numfiles].name = (char *)malloc(len);
+        snprintf(files[numfiles].name, len, "%s/%s", dir, ent->d_name);
+        if (stat(files[numfiles].name, &st) != 0) {
+            free(files[numfiles].name);
+            continue;
+        }
+        files[numfiles].size = st.st_size;
+        files[numfiles].used = st.st_mtime;
+        total += st.st_size;
+        numfiles++;
+    }
+    closedir(d);
+    if (total > limit) {
+        qsort(files, numfiles, sizeof(*files), CompareCacheUse);
+        for (i = 0; i < numfiles && total > limit; i++) {
+            if (remove(files[i].name) == 0) {
+                total -= files[i].size;
+                DEBUG(NULL, "removed old cache file %s", files[i].name);
+            }
+        }
+    }
+    for (i = 0; i < numfiles; i++) {
+        free(files[i].name);
+    }
+    free(files);
+}
+
+/*
+ * record the state that parsing P is allowed to change, for passing
+ * to SaveModuleToCache later
+ */
+void
+ModuleCacheMark(Module *P, CacheMark *mark)
+{
+    mark->numsyms = P->objsyms.count;
+    mark->numtypes = currentTypes ? currentTypes->count : 0;
+    mark->tmpbase = SetTempVariableBase(0, 0);
+    SetTempVariableBase(mark->tmpbase, 0);
+    mark->warnings = gl_warnings;
+    mark->output = gl_output;
+    mark->nospin = gl_nospin;
+}
+
+/* check whether parsing did anything besides filling in P's lists */
+static int
+ParseHadSideEffects(Module *P, CacheMark *mark)
+{
+    return P->objsyms.count != mark->numsyms
+        || (currentTypes ? currentTypes->count : 0) != mark->numtypes
+        || gl_warnings != mark->warnings
+        || gl_output != mark->output
+        || gl_nospin != mark->nospin;
+}
+
+/*
+ * save the freshly parsed module P to the cache under "key"
+ * "mark" is what ModuleCacheMark recorded before parsing; if parsing
+ * declared any symbols, printed warnings, or changed global settings
+ * we cannot save the module
+ */
+void
+SaveModuleToCache(Module *P, const char *key, CacheMark *mark)
+{
+    CacheWriter W;
+    LexStream *L = P->Lptr;
+    LineInfo *info;
+    unsigned numlines, i;
+    char *fullkey = NULL;
+    char *fname;
+    char *tmpname;
+    size_t len;
+    FILE *f;
+    int ok;
+
+    fname = CacheFileName(key, &fullkey);
+    if (!fname) {
+        return;
+    }
+    if (gl_errors || P->functions || P->subclasses || P->body || P->bas_data
+        || P->finalvarblock || !L || ParseHadSideEffects(P, mark))
+    {
+        goto done;
+    }
+    memset(&W, 0, sizeof(W));
+    W.lexdata = L;
+    flexbuf_init(&W.fb, 65536);
+    flexbuf_addstr(&W.fb, CACHE_MAGIC);
+    PutString(&W, fullkey);
+
+    // temporary names made by the parser are baked into the trees
+    i = SetTempVariableBase(0, 0);
+    SetTempVariableBase(i, 0);
+    PutNum(&W, mark->tmpbase);
+    PutNum(&W, i);
+    PutNum(&W, P->mainLanguage);
+    PutNum(&W, P->curLanguage);
+    PutNum(&W, P->pasmLabels);
+    PutNum(&W, P->volatileVariables);
+    PutNum(&W, P->sawToken);
+    PutNum(&W, P->codeCog);
+    PutNum(&W, P->datHasCode);
+    PutNum(&W, P->gasPasm);
+    PutNum(&W, P->isUnion);
+    PutNum(&W, P->defaultPrivate);
+    PutNum(&W, P->longOnly);
+
+    PutString(&W, L->fileName);
+    PutNum(&W, L->language);
+    info = (LineInfo *)flexbuf_peek(&L->lineInfo);
+    numlines = getLineInfoIndex(L);
+    PutNum(&W, numlines);
+    for (i = 0; i < numlines; i++) {
+        PutString(&W, info[i].fileName);
+        PutNum(&W, info[i].lineno);
+        PutString(&W, info[i].linedata);
+    }
+
+    PutAST(&W, P->conblock);
+    PutAST(&W, P->datblock);
+    PutAST(&W, P->pendingvarblock);
+    PutAST(&W, P->objblock);
+    PutAST(&W, P->funcblock);
+    PutAST(&W, P->topcomment);
+    PutAST(&W, P->datannotations);
+    PutASTRef(&W, P->conblock_tail);
+    PutASTRef(&W, P->datblock_tail);
+
+    if (!W.failed) {
+        uint32_t sum = Checksum((unsigned char *)flexbuf_peek(&W.fb), flexbuf_curlen(&W.fb));
+        for (i = 0; i < 4; i++) {
+            flexbuf_addchar(&W.fb, (sum >> (8*i)) & 0xff);
+        }
+
+        // write to a temporary file first so nobody sees a partial file
+        MKDIR(CacheDirectory());
+        len = strlen(fname) + 16;
+        tmpname = (char *)malloc(len);
+        snprintf(tmpname, len, "%s.%d", fname, (int)getpid());
+        f = fopen(tmpname, "wb");
+        if (f) {
+            len = flexbuf_curlen(&W.fb);
+            ok = fwrite(flexbuf_peek(&W.fb), 1, len, f) == len;
+            ok = (fclose(f) == 0) && ok;
+            if (ok && rename(tmpname, fname) == 0) {
+                DEBUG(NULL, "saved parse of %s to cache file %s", P->fullname, fname);
+                PruneCache();
+            } else {
+                remove(tmpname);
+            }
+        }
+        free(tmpname);
+    }
+    flexbuf_delete(&W.fb);
+    PtrMapFree(&W.nodes);
+    PtrMapFree(&W.strings);
+done:
+    free(fullkey);
+    free(fname);
+}
+
+/*
+ * fill in the parse trees of module P from the cache entry for "key",
+ * in place of parsing it; returns 1 on success, 0 if there is no usable
+ * cache entry (in which case P is untouched)
+ */
+int
+LoadModuleFromCache(Module *P, const char *key)
+{
+    CacheReader R;
+    char *fullkey = NULL;
+    char *fname;
+    unsigned char *buf = NULL;
+    long size;
+    FILE *f = NULL;
+    size_t magiclen = strlen(CACHE_MAGIC);
+    const char *s;
+    unsigned flags[13];
+    unsigned tmpbase;
+    const char *fileName;
+    int language;
+    Flexbuf lines;
+    LineInfo info;
+    unsigned numlines, i;
+    AST *lists[9];
+    int ok = 0;
+
+    fname = CacheFileName(key, &fullkey);
+    if (!fname || !P->Lptr) {
+        goto done;
+    }
+    cacheMisses++;
+    f = fopen(fname, "rb");
+    if (!f) {
+        goto done;
+    }
+    if (fseek(f, 0L, SEEK_END) != 0 || (size = ftell(f)) <= (long)magiclen + 4) {
+        goto done;
+    }
+    rewind(f);
+    buf = (unsigned char *)malloc(size);
+    if (!buf || fread(buf, 1, size, f) != (size_t)size || memcmp(buf, CACHE_MAGIC, magiclen) != 0) {
+        goto done;
+    }
+    size -= 4;
+    if (Checksum(buf, size) != (buf[size] | (buf[size+1]<<8) | (buf[size+2]<<16) | ((uint32_t)buf[size+3]<<24))) {
+        goto done;
+    }
+    memset(&R, 0, sizeof(R));
+    R.ptr = buf + magiclen;
+    R.end = buf + size;
+    R.lexdata = P->Lptr;
+    s = GetString(&R);
+    if (!s || strcmp(s, fullkey) != 0) {
+        goto done;
+    }
+    for (i = 0; i < N_ELEMENTS(flags); i++) {
+        flags[i] = GetNum(&R);
+    }
+    fileName = GetString(&R);
+    language = GetNum(&R);
+    numlines = GetNum(&R);
+    flexbuf_init(&lines, 1024);
+    for (i = 0; i < numlines && !R.failed; i++) {
+        info.fileName = GetString(&R);
+        info.lineno = GetNum(&R);
+        info.linedata = (char *)GetString(&R);
+        flexbuf_addmem(&lines, (char *)&info, sizeof(info));
+    }
+    for (i = 0; i < 7 && !R.failed; i++) {
+        lists[i] = GetAST(&R);
+    }
+    lists[7] = GetAST(&R);
+    lists[8] = GetAST(&R);
+    // the trees use temporary names starting at flags[0], which we can
+    // only re-use if nobody has taken them in the meantime
+    tmpbase = SetTempVariableBase(0, 0);
+    SetTempVariableBase(tmpbase, 0);
+    if (flags[0] != flags[1] && flags[0] != tmpbase) {
+        R.failed = 1;
+    }
+    if (R.failed || R.ptr != R.end) {
+        flexbuf_delete(&lines);
+        free(R.nodes);
+        free(R.strings);
+        goto done;
+    }
+
+    if (flags[0] != flags[1]) {
+        SetTempVariableBase(flags[1], 0);
+    }
+    P->mainLanguage = flags[2];
+    P->curLanguage = flags[3];
+    P->pasmLabels = flags[4];
+    P->volatileVariables = flags[5];
+    P->sawToken = flags[6];
+    P->codeCog = flags[7];
+    P->datHasCode = flags[8];
+    P->gasPasm = flags[9];
+    P->isUnion = flags[10];
+    P->defaultPrivate = flags[11];
+    P->longOnly = flags[12];
+
+    strToLex(P->Lptr, "", fileName, language);
+    flexbuf_addmem(&P->Lptr->lineInfo, flexbuf_peek(&lines), flexbuf_curlen(&lines));
+    flexbuf_delete(&lines);
+
+    P->conblock = lists[0];
+    P->datblock = lists[1];
+    P->pendingvarblock = lists[2];
+    P->objblock = lists[3];
+    P->funcblock = lists[4];
+    P->topcomment = lists[5];
+    P->datannotations = lists[6];
+    P->conblock_tail = lists[7];
+    P->datblock_tail = lists[8];
+    free(R.nodes);
+    free(R.strings);
+    buf = NULL; // strings still point into it
+    ok = 1;
+    cacheMisses--;
+    cacheHits++;
+    DEBUG(NULL, "using cached parse of %s from %s", P->fullname, fname);
+    // remember when it was last used, for PruneCache
+    utime(fname, NULL);
+done:
+    if (f) {
+        fclose(f);
+    }
+    free(buf);
+    free(fullkey);
+    free(fname);
+    return ok;
+}
+
+/* returns nonzero if the cache is in use */
+int
+ModuleCacheEnabled(void)
+{
+    return CacheDirectory() != NULL;
+}
+
+/*
+ * fetch the hit and miss counts for the cache; returns 0 if the
+ * cache is not in use
+ */
+int
+GetModuleCacheStats(unsigned *hits, unsigned *misses)
+{
+    *hits = cacheHits;
+    *misses = cacheMisses;
+    return ModuleCacheEnabled();
+}
@@ -528,6 +528,223 @@ AST *CreateJumpTable(AST *switchstmt, AST *defaultlabel, const char *force_reaso
     return ast;
 }
 
+//
+// binary search trees for sparse case statements
+// these work for any value range, and turn n tests into
+// roughly log2(n) compares plus a short chain of tests at the end
+//
+typedef struct {
+    int32_t lo;
+    int32_t hi;
+    AST *label;
+} CaseRange;
+
+// smallest number of tests we leave as an if/else chain
+#define CASE_TREE_LEAF 3
+
+static int rangeCmp(const void *av, const void *bv)
+{
+    const CaseRange *a = (const CaseRange *)av;
+    const CaseRange *b = (const CaseRange *)bv;
+    if (a->lo < b->lo) return -1;
+    if (a->lo > b->lo) return 1;
+    return 0;
+}
+
+static int AddCaseRanges(Flexbuf *fb, AST *ident, AST *expr, AST *label)
+{
+    CaseRange temp;
+
+    if (expr->kind != AST_OPERATOR) {
+        return 0;
+    }
+    if (expr->d.ival == K_EQ) {
+        if (!AstMatch(ident, expr->left) || !IsConstExpr(expr->right)) {
+            return 0;
+        }
+        temp.lo = temp.hi = EvalConstExpr(expr->right);
+    } else if (expr->d.ival == K_BOOL_OR) {
+        return AddCaseRanges(fb, ident, expr->left, label) && AddCaseRanges(fb, ident, expr->right, label);
+    } else if (expr->d.ival == K_BOOL_AND) {
+        AST *left = expr->left;
+        AST *right = expr->right;
+        if (left->kind != AST_OPERATOR || left->d.ival != K_GE) {
+            return 0;
+        }
+        if (right->kind != AST_OPERATOR || right->d.ival != K_LE) {
+            return 0;
+        }
+        if (!AstMatch(ident, left->left) || !AstMatch(ident, right->left)) {
+            return 0;
+        }
+        if (!IsConstExpr(left->right) || !IsConstExpr(right->right)) {
+            return 0;
+        }
+        temp.lo = EvalConstExpr(left->right);
+        temp.hi = EvalConstExpr(right->right);
+    } else {
+        return 0;
+    }
+    temp.label = label;
+    flexbuf_addmem(fb, (char *)&temp, sizeof(temp));
+    return 1;
+}
+
+// number of compares needed to test for one range
+static int CaseRangeCost(CaseRange *r)
+{
+    return (r->lo == r->hi) ? 1 : 2;
+}
+
+// worst case number of compares done by a tree over n ranges
+static int CaseTreeCost(CaseRange *r, int n)
+{
+    int i, cost, leftcost, rightcost;
+    if (n <= CASE_TREE_LEAF) {
+        cost = 0;
+        for (i = 0; i < n; i++) {
+            cost += CaseRangeCost(&r[i]);
+        }
+        return cost;
+    }
+    leftcost = CaseTreeCost(r, n/2);
+    rightcost = CaseTreeCost(r + n/2, n - n/2);
+    return 1 + (leftcost > rightcost ? leftcost : rightcost);
+}
+
+static AST *CaseRangeTest(AST *ident, CaseRange *r)
+{
+    if (r->lo == r->hi) {
+        return AstOperator(K_EQ, ident, AstInteger(r->lo));
+    }
+    return AstOperator(K_BOOL_AND,
+                       AstOperator(K_GE, ident, AstInteger(r->lo)),
+                       AstOperator(K_LE, ident, AstInteger(r->hi)));
+}
+
+static AST *IfThenElse(AST *cond, AST *thenpart, AST *elsepart)
+{
+    return NewAST(AST_STMTLIST,
+                  NewAST(AST_IF, cond, NewAST(AST_THENELSE, thenpart, elsepart)),
+                  NULL);
+}
+
+static AST *BuildCaseTree(AST *ident, CaseRange *r, int n, AST *defaultlabel)
+{
+    AST *list = NULL;
+    int i, half;
+
+    if (n <= CASE_TREE_LEAF) {
+        for (i = 0; i < n; i++) {
+            AST *go = NewAST(AST_STMTLIST, NewAST(AST_GOTO, r[i].label, NULL), NULL);
+            list = AddToList(list, IfThenElse(CaseRangeTest(ident, &r[i]), go, NULL));
+        }
+        return AddToList(list, NewAST(AST_STMTLIST, NewAST(AST_GOTO, defaultlabel, NULL), NULL));
+    }
+    half = n/2;
+    return IfThenElse(AstOperator('<', ident, AstInteger(r[half].lo)),
+                      BuildCaseTree(ident, r, half, defaultlabel),
+                      BuildCaseTree(ident, r + half, n - half, defaultlabel));
+}
+
+//
+// check a list of if x goto y statements to see if a binary search
+// would be faster than testing them one by one
+// returns the replacement list (including the initial assignment), or
+// NULL if the linear tests should be kept
+//
+static AST *CreateCaseTree(AST *switchstmt, AST *defaultlabel)
+{
+    AST *top, *ast, *label;
+    AST *assign, *ident, *exprtype;
+    Flexbuf fb;
+    CaseRange *ranges;
+    int i, j, n, linearcost;
+    bool is_unsigned;
+
+    if (gl_output == OUTPUT_C || gl_output == OUTPUT_CPP) {
+        return NULL;
+    }
+    if (!(curfunc->optimize_flags & OPT_CASE_TREE)) {
+        return NULL;
+    }
+    assign = switchstmt->left;
+    if (!assign || assign->kind != AST_ASSIGN) {
+        return NULL;
+    }
+    ident = assign->left;
+    exprtype = ExprType(ident);
+    if (exprtype && !IsIntOrGenericType(exprtype)) {
+        return NULL;
+    }
+    is_unsigned = exprtype && IsUnsignedType(exprtype);
+    flexbuf_init(&fb, 0);
+    for (top = switchstmt->right; top; top = top->right) {
+        ast = top->left;
+        if (ast->kind != AST_IF) {
+            goto fail;
+        }
+        label = ast->right;
+        if (label->kind != AST_THENELSE || label->right || label->left->kind != AST_STMTLIST) {
+            goto fail;
+        }
+        label = label->left->left;
+        if (label->kind != AST_GOTO) {
+            goto fail;
+        }
+        if (!AddCaseRanges(&fb, ident, ast->left, label->left)) {
+            goto fail;
+        }
+    }
+    n = flexbuf_curlen(&fb) / sizeof(CaseRange);
+    if (n <= CASE_TREE_LEAF) {
+        goto fail;
+    }
+    ranges = (CaseRange *)flexbuf_peek(&fb);
+    linearcost = 0;
+    for (i = 0; i < n; i++) {
+        if (ranges[i].lo > ranges[i].hi) {
+            int32_t tmp = ranges[i].lo;
+            ranges[i].lo = ranges[i].hi;
+            ranges[i].hi = tmp;
+        }
+        if (is_unsigned && ranges[i].lo < 0) {
+            // would need an unsigned sort
+            goto fail;
+        }
+        linearcost += CaseRangeCost(&ranges[i]);
+    }
+    qsort(ranges, n, sizeof(CaseRange), rangeCmp);
+    for (i = 0; i < n-1; i++) {
+        if (ranges[i].hi >= ranges[i+1].lo) {
+            // overlapping cases; the first one in the source has to win,
+            // so keep the tests in order
+            goto fail;
+        }
+    }
+    // merge neighbouring values that go to the same place (as in "a".."z")
+    j = 0;
+    for (i = 1; i < n; i++) {
+        if (ranges[i].label == ranges[j].label && ranges[j].hi + 1 == ranges[i].lo) {
+            ranges[j].hi = ranges[i].hi;
+        } else {
+            ranges[++j] = ranges[i];
+        }
+    }
+    n = j+1;
+    // the tree costs an extra compare and branch for each level, so
+    // only use it if it saves at least a third of the worst case
+    if (CaseTreeCost(ranges, n) * 3 >= linearcost * 2) {
+        goto fail;
+    }
+    ast = NewAST(AST_STMTLIST, assign, BuildCaseTree(ident, ranges, n, defaultlabel));
+    flexbuf_delete(&fb);
+    return ast;
+fail:
+    flexbuf_delete(&fb);
+    return NULL;
+}
+
 //
 // transform a case statement
 // we evaluate _tmpvar = expr
@@ -601,6 +818,9 @@ CreateSwitch(AST *origast, const char *force_reason)
         gostmt = NULL;
     } else {
         gostmt = CreateJumpTable(switchstmt, defaultlabel, force_reason);
+        if (!gostmt && !force_reason && use_expr->kind != AST_CASEEXPR) {
+            gostmt = CreateCaseTree(switchstmt, defaultlabel);
+        }
     }
     if (gostmt) {
         switchstmt = gostmt;
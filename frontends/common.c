@@ -55,8 +55,10 @@ int gl_src_charset = CHARSET_UTF8;
 int gl_run_charset = CHARSET_UTF8;
 int gl_have_lut;
 int gl_errors;
+int gl_warnings;
 int gl_warnings_are_errors;
 int gl_verbosity;
+int gl_jobs = 1;
 int gl_max_errors;
 int gl_colorize_output;
 int gl_output;
@@ -737,8 +739,10 @@ void
 ERROR(AST *instr, const char *msg, ...)
 {
     va_list args;
-    LineInfo *info = GetLineInfo(instr);
+    LineInfo *info;
 
+    jobs_lock();
+    info = GetLineInfo(instr);
     SETCOLOR(PRINT_ERROR);
 
     if (info)
@@ -752,6 +756,7 @@ ERROR(AST *instr, const char *msg, ...)
     fprintf(stderr, "\n");
     gl_errors++;
     RESETCOLOR();
+    jobs_unlock();
 }
 
 void
@@ -789,6 +794,7 @@ LANGUAGE_WARNING(int language, AST *ast, const char *msg, ...)
     if (language != LANG_ANY && language != current->curLanguage) {
         return;
     }
+    gl_warnings++;
     if (gl_warnings_are_errors) {
         banner = "ERROR";
         SETCOLOR(PRINT_ERROR);
@@ -820,9 +826,12 @@ void
 WARNING(AST *instr, const char *msg, ...)
 {
     va_list args;
-    LineInfo *info = GetLineInfo(instr);
+    LineInfo *info;
     const char *banner;
 
+    jobs_lock();
+    info = GetLineInfo(instr);
+    gl_warnings++;
     if (gl_warnings_are_errors) {
         gl_errors++;
         banner = "ERROR";
@@ -841,6 +850,7 @@ WARNING(AST *instr, const char *msg, ...)
     va_end(args);
     fprintf(stderr, "\n");
     RESETCOLOR();
+    jobs_unlock();
 }
 
 void
@@ -867,9 +877,11 @@ void
 DEBUG(AST *instr, const char *msg, ...)
 {
     va_list args;
-    if (gl_verbosity <= 0) return;
-    LineInfo *info = GetLineInfo(instr);
+    LineInfo *info;
 
+    if (gl_verbosity <= 0) return;
+    jobs_lock();
+    info = GetLineInfo(instr);
     SETCOLOR(PRINT_DEBUG);
     if (info)
         ERRORHEADER(info->fileName, info->lineno, "info");
@@ -881,6 +893,7 @@ DEBUG(AST *instr, const char *msg, ...)
     va_end(args);
     fprintf(stderr, "\n");
     RESETCOLOR();
+    jobs_unlock();
 }
 
 void
@@ -12,6 +12,9 @@ typedef struct modulestate Module;
 #include "expr.h"
 #include "util/util.h"
 #include "util/flexbuf.h"
+#include "util/arena.h"
+#include "util/jobs.h"
+#include "util/timereport.h"
 #include "instr.h"
 
 #include "optokens.h"
@@ -72,12 +75,9 @@ struct lexstream {
     /* current language being parsed */
     int language;
     
-    /* for handling Unicode CR+LF */
-    int sawCr;
-
     int pendingLine;  /* 1 if lineCounter needs incrementing */
 
-    Flexbuf curLine;  /* string of current line */
+    char *lineStart;  /* start of the current line in the source text */
     Flexbuf lineInfo; /* pointers to line info about the file */
 
     unsigned flags;
@@ -167,6 +167,8 @@ extern int gl_optimize_flags; /* flags for optimization */
 #define OPT_MAKE_MACROS         0x020000  /* combine multiple bytecodes */
 #define OPT_SPECIAL_FUNCS       0x040000  /* optimize some special functions like pinr and pinw */
 #define OPT_CORDIC_REORDER      0x080000  /* reorder instructions around CORDIC operations */
+#define OPT_CASE_TREE           0x100000  /* binary search for sparse CASE statements */
+#define OPT_AUTO_LUT            0x200000  /* move hot leaf functions into LUT (P2) */
 #define OPT_FLAGS_ALL           0xffffff
 
 #define OPT_ASM_BASIC  (OPT_BASIC_REGS|OPT_BRANCHES|OPT_PEEPHOLE|OPT_CONST_PROPAGATE|OPT_REMOVE_FEATURES|OPT_MAKE_MACROS)
@@ -174,7 +176,7 @@ extern int gl_optimize_flags; /* flags for optimization */
 // default optimization (-O1) for ASM output
 #define DEFAULT_ASM_OPTS        (OPT_ASM_BASIC|OPT_DEADCODE|OPT_REMOVE_UNUSED_FUNCS|OPT_INLINE_SMALLFUNCS|OPT_AUTO_FCACHE|OPT_LOOP_BASIC|OPT_TAIL_CALLS|OPT_SPECIAL_FUNCS|OPT_CORDIC_REORDER)
 // extras added with -O2
-#define EXTRA_ASM_OPTS          (OPT_INLINE_SINGLEUSE|OPT_PERFORM_CSE|OPT_PERFORM_LOOPREDUCE|OPT_REMOVE_HUB_BSS)
+#define EXTRA_ASM_OPTS          (OPT_INLINE_SINGLEUSE|OPT_PERFORM_CSE|OPT_PERFORM_LOOPREDUCE|OPT_REMOVE_HUB_BSS|OPT_CASE_TREE)
 
 // default optimization (-O1) for bytecode output; defaults to much less optimization than asm
 #define DEFAULT_BYTECODE_OPTS   (OPT_REMOVE_UNUSED_FUNCS|OPT_REMOVE_FEATURES|OPT_DEADCODE|OPT_MAKE_MACROS|OPT_SPECIAL_FUNCS)
@@ -194,6 +196,12 @@ extern int gl_fcache_size;   /* size of fcache for LMM mode */
 extern const char *gl_cc; /* C compiler to use; NULL means default (PropGCC) */
 extern const char *gl_intstring; /* int string to use */
 
+extern const char *gl_cache_dir; /* directory for cached parse trees, or NULL */
+extern int gl_jobs;           /* number of threads to use for back end work */
+extern int gl_profile_gen;    /* count function calls and loop trips at run time */
+extern const char *gl_profile_use; /* file of counts from a --profile-gen run, or NULL */
+extern int gl_cycle_report;   /* write static timing bounds for the generated code */
+
 extern int gl_dat_offset; /* offset for @@@ operator */
 #define DEFAULT_P1_DAT_OFFSET 24
 #define DEFAULT_P2_DAT_OFFSET 0
@@ -523,7 +531,7 @@ struct modulestate {
 
 /* the current parser state */
 extern Module *current;
-extern Function *curfunc;
+extern THREAD_LOCAL Function *curfunc;
 extern SymbolTable *currentTypes;
 
 /* defines given on the command line */
@@ -623,6 +631,7 @@ void CheckRecursive(Function *f);
 
 /* code for printing errors */
 extern int gl_errors;
+extern int gl_warnings;
 extern int gl_warnings_are_errors;
 extern int gl_verbosity;
 extern int gl_max_errors;
@@ -660,13 +669,36 @@ AST *NewObject(AST *identifier, AST *string);
 /* like NewObject, but does not instantiate data */
 AST *NewAbstractObject(AST *identifier, AST *string);
 
+/* on-disk cache of parsed modules (in astcache.c) */
+typedef struct CacheMark {
+    unsigned numsyms;   /* symbols in the module */
+    unsigned numtypes;  /* symbols in currentTypes */
+    int tmpbase;        /* next temporary variable number */
+    int warnings;       /* warnings printed so far */
+    int output;         /* gl_output */
+    int nospin;         /* gl_nospin */
+} CacheMark;
+
+int ModuleCacheEnabled(void);
+void ModuleCacheMark(Module *P, CacheMark *mark);
+int LoadModuleFromCache(Module *P, const char *key);
+void SaveModuleToCache(Module *P, const char *key, CacheMark *mark);
+uint64_t CacheHash(uint64_t hash, const void *data, size_t len);
+int GetModuleCacheStats(unsigned *hits, unsigned *misses);
+
 /* different kinds of output functions */
 void OutputCppCode(const char *name, Module *P, int printMain);
 void OutputDatFile(const char *name, Module *P, int prefixBin);
 void OutputGasFile(const char *name, Module *P);
 void OutputLstFile(const char *name, Module *P);
 void OutputAsmCode(const char *name, Module *P, int printMain);
+/* assemble the code from OutputAsmCode(NULL, P, ...) straight into module Q */
+void AssembleAsmCode(Module *Q, Module *P);
+/* write the code from OutputAsmCode(NULL, P, ...) to a file */
+void WriteAsmCode(const char *fname, Module *P);
 void OutputObjFile(const char *name, Module *P);
+char *ObjFilePayload(char *text);
+const char **LinkObjFiles(const char *argv[], int *argcp);
 void OutputByteCode(const char *name, Module *P);
 void OutputNuCode(const char *name, Module *P);
 
@@ -119,7 +119,48 @@ unsigned int findInTable(unsigned int *tab, unsigned wc) {
 
 static void InitPasm(int flags);
 
-/* functions for handling string streams */
+/*
+ * source text is copied once into the line store; every line (ended by
+ * a newline, or by a VT from a macro expansion) is followed there by a
+ * 0, so the line information can point straight into the text instead
+ * of keeping a copy of each line. CR+LF and plain CR become LF. The text
+ * ends at the first 0 or after len bytes, and the copy ends with an
+ * extra 0.
+ */
+static char *
+copySourceText(const char *s, size_t len)
+{
+    size_t i, lines = 0;
+    char *buf, *d;
+    int c;
+
+    for (i = 0; i < len && s[i]; i++) {
+        c = s[i];
+        if (c == '\n' || c == '\r' || c == VT) {
+            lines++;
+        }
+    }
+    len = i;
+    buf = d = NewLineData(len + lines + 2);
+    for (i = 0; i < len; i++) {
+        c = s[i];
+        if (c == '\r') {
+            if (i+1 < len && s[i+1] == '\n') {
+                i++;
+            }
+            c = '\n';
+        }
+        *d++ = c;
+        if (c == '\n' || c == VT) {
+            *d++ = 0;
+        }
+    }
+    *d++ = 0;
+    *d++ = 0;
+    return buf;
+}
+
+/* read characters from text prepared by copySourceText */
 static int 
 strgetc(LexStream *L)
 {
@@ -127,132 +168,71 @@ strgetc(LexStream *L)
     int c;
 
     s = (char *)L->ptr;
-    c = (*s++) & 0x00ff;
-    if (c == '\r') {
-        c = (*s++) & 0x00ff;
-        if (c != '\n') {
-            --s;
-            c = '\n';
-        }
+    c = (*s) & 0x00ff;
+    if (c == 0) {
+        return EOF;
     }
-    if (c != 0)
-        L->ptr = s;
-    return (c == 0) ? EOF : c;
+    s++;
+    if (c == '\n' || c == VT) {
+        s++; // skip the 0 at the end of the line
+    }
+    L->ptr = s;
+    return c;
 }
 
-/* open a stream from a string s */
-void strToLex(LexStream *L, const char *s, const char *name, int language)
+static void
+initLex(LexStream *L, char *text, const char *name, int language)
 {
-    if (!L) {
-        current->Lptr = L = (LexStream *)malloc(sizeof(*L));
-    }
     memset(L, 0, sizeof(*L));
-    L->arg = L->ptr = (void *)s;
+    L->arg = L->ptr = (void *)text;
     L->getcf = strgetc;
     L->pendingLine = 1;
     L->fileName = name ? name : "<string>";
     L->language = language;
-    flexbuf_init(&L->curLine, 1024);
     flexbuf_init(&L->lineInfo, 1024);
 }
 
-/* functions for handling FILE streams */
-/* filegetc is for ASCII streams;
-   filegetwc is for UCS-16LE streams
-*/
-
-static int 
-filegetc(LexStream *L)
-{
-    FILE *f;
-    int c;
-
-    f = (FILE *)L->ptr;
-    c = fgetc(f);
-    /* translate CR+LF ->LF, plain CR ->LF */
-    if (c == '\r') {
-        c = fgetc(f);
-        if (c != '\n') {
-            ungetc(c, f);
-            c = '\n';
-        }
-    }
-
-    return (c >= 0) ? c : EOF;
-}
-
-static int 
-filegetwc(LexStream *L)
+/* open a stream from a string s */
+void strToLex(LexStream *L, const char *s, const char *name, int language)
 {
-    FILE *f;
-    int c1, c2;
-    f = (FILE *)L->ptr;
-again:
-    c1 = fgetc(f);
-    if (c1 < 0) return EOF;
-    c2 = fgetc(f);
-    if (c2 != 0 || c1 >= 0x80) {
-        wchar_t w;
-        size_t n;
-        char buf[8];
-        if (c2 < 0) return EOF;
-        /* convert to UTF-8 */
-        w = (c2<<8) | c1;
-        n = to_utf8(buf, w);
-        while (n > 1) {
-            --n;
-            lexungetc(L, buf[n] & 0xff);
-        }
-        return buf[0] & 0xff;
-    }
-    /* eliminate carriage returns */
-    /* actually there's a problem: if we have a MAC file,
-       we may not have line feeds, so we need to
-       convert carriage returns to line feeds; but for
-       Windows we need to ignore a line feed right after a
-       carriage return!
-    */
-    if (c1 == '\r') {
-        c1 = '\n';
-        L->sawCr = 1;
-    } else {
-        if (c1 == '\n') {
-            if (L->sawCr) {
-                L->sawCr = 0;
-                goto again;
-            }
-        }
-        L->sawCr = 0;
+    if (!L) {
+        current->Lptr = L = (LexStream *)malloc(sizeof(*L));
     }
-    return c1;
+    initLex(L, copySourceText(s, (size_t)-1), name, language);
 }
 
-/* open a stream from a FILE f */
+/* open a stream from a FILE f; ASCII/UTF-8 or UCS-16LE */
 void fileToLex(LexStream *L, FILE *f, const char *name, int language)
 {
-    int c1, c2;
+    Flexbuf raw, wide;
+    char buf[8192];
+    char *text;
+    size_t n, i;
 
     if (!L) {
         current->Lptr = L = (LexStream *)malloc(sizeof(*L));
     }
-    memset(L, 0, sizeof(*L));
-    L->ptr = (void *)f;
-    L->arg = NULL;
-    L->getcf = filegetc;
-    L->pendingLine = 1;
-    L->language = language;
-    flexbuf_init(&L->curLine, 1024);
-    flexbuf_init(&L->lineInfo, 1024);
-    /* check for Unicode */
-    c1 = fgetc(f);
-    c2 = fgetc(f);
-    if (c1 == 0xff && c2 == 0xfe) {
-        L->getcf = filegetwc;
-    } else {
-        rewind(f);
+    flexbuf_init(&raw, 65536);
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) {
+        flexbuf_addmem(&raw, buf, n);
+    }
+    text = flexbuf_peek(&raw);
+    n = flexbuf_curlen(&raw);
+    if (n >= 2 && (text[0] & 0xff) == 0xff && (text[1] & 0xff) == 0xfe) {
+        /* convert Unicode to UTF-8 */
+        flexbuf_init(&wide, n);
+        for (i = 2; i + 1 < n; i += 2) {
+            wchar_t w = (text[i] & 0xff) | ((text[i+1] & 0xff) << 8);
+            char u[8];
+            flexbuf_addmem(&wide, u, to_utf8(u, w));
+        }
+        flexbuf_delete(&raw);
+        raw = wide;
+        text = flexbuf_peek(&raw);
+        n = flexbuf_curlen(&raw);
     }
-    L->fileName = name;
-
+    initLex(L, copySourceText(text, n), name, language);
+    flexbuf_delete(&raw);
 }
 
 //
@@ -294,8 +274,9 @@ static void startNewLine(LexStream *L)
 {
     LineInfo lineInfo;
 
-    flexbuf_addchar(&L->curLine, 0); // terminate the line
-    lineInfo.linedata = flexbuf_get(&L->curLine);
+    // the line just finished is already 0 terminated in the source text
+    lineInfo.linedata = L->lineStart ? L->lineStart : (char *)"";
+    L->lineStart = (char *)L->ptr;
     lineInfo.fileName = L->fileName;
     lineInfo.lineno = L->lineCounter;
     flexbuf_addmem(&L->lineInfo, (char *)&lineInfo, sizeof(lineInfo));
@@ -339,8 +320,6 @@ lexgetc(LexStream *L)
     }
     if (c == EOF) {
         startNewLine(L);
-    } else {
-        flexbuf_addchar(&L->curLine, c);
     }
     return c;
 }
@@ -898,11 +877,127 @@ is_identifier:
             lexungetc(L, c);
         }
     }
-    ast->d.string = idstr;
+    ast->d.string = InternString(idstr);
+    free(idstr);
     *ast_ptr = ast;
     return SP_IDENTIFIER;
 }
 
+/*
+ * find the AST the lexer would produce for the text "text" appearing
+ * as an operand (or, if startOfLine is set, a label) in a DAT block;
+ * this lets back ends build DAT blocks directly instead of printing
+ * and re-parsing them
+ * returns NULL if the text would lex as anything other than a single
+ * plain identifier or hardware register
+ */
+AST *
+DatIdentifierAST(const char *text, int language, int startOfLine)
+{
+    struct flexbuf fb;
+    Symbol *sym;
+    AST *ast;
+    char *idstr;
+    int c;
+
+    if (!isIdentifierStart(*text)) {
+        return NULL;
+    }
+    flexbuf_init(&fb, INCSTR);
+    while ( (c = *text++) != 0 ) {
+        if (c == '`') {
+            c = *text++;
+            if (!c) break;
+        } else if (!isIdentifierChar(c) && c != ':') {
+            break;
+        }
+        flexbuf_addchar(&fb, c);
+    }
+    flexbuf_addchar(&fb, '\0');
+    flexbuf_addchar(&fb, '\0');
+    idstr = flexbuf_get(&fb);
+    if (c != 0) {
+        free(idstr);
+        return NULL;
+    }
+    sym = NULL;
+    if (startOfLine) {
+        sym = FindSymbol(&pasmInstrWords, idstr);
+    }
+    if (!sym) {
+        sym = FindSymbol(&pasmWords, idstr);
+    }
+    if (!sym) {
+        if (language == LANG_SPIN_SPIN2) {
+            sym = FindSymbol(&spin2ReservedWords, idstr);
+        } else {
+            sym = FindSymbol(&spin1ReservedWords, idstr);
+        }
+        if (!sym) {
+            sym = FindSymbol(&spinCommonReservedWords, idstr);
+        }
+        if (sym && (sym->kind == SYM_CONSTANT || sym->kind == SYM_FLOAT_CONSTANT)) {
+            sym = NULL;
+        }
+    }
+    if (sym) {
+        free(idstr);
+        if (sym->kind != SYM_HWREG) {
+            return NULL;
+        }
+        ast = NewAST(AST_HWREG, NULL, NULL);
+        ast->d.ptr = sym->val;
+        return ast;
+    }
+    if (gl_normalizeIdents) {
+        NormalizeIdentifier(idstr);
+    }
+    ast = NewAST(AST_IDENTIFIER, NULL, NULL);
+    ast->d.string = InternString(idstr);
+    free(idstr);
+    return ast;
+}
+
+/*
+ * find the AST for a PASM instruction or instruction modifier name
+ * (as DatIdentifierAST above); returns NULL if "name" is neither
+ */
+AST *
+DatKeywordAST(const char *name)
+{
+    Symbol *sym;
+    AST *ast;
+
+    sym = FindSymbol(&pasmInstrWords, name);
+    if (sym && sym->kind == SYM_INSTR) {
+        ast = NewAST(AST_INSTR, NULL, NULL);
+    } else {
+        sym = FindSymbol(&pasmWords, name);
+        if (!sym || sym->kind != SYM_INSTRMODIFIER) {
+            return NULL;
+        }
+        ast = NewAST(AST_INSTRMODIFIER, NULL, NULL);
+    }
+    ast->d.ptr = sym->val;
+    return ast;
+}
+
+/*
+ * find the instruction, modifier, or hardware register the lexer
+ * would use for "name"; "kind" is SYM_INSTR, SYM_INSTRMODIFIER, or SYM_HWREG
+ */
+void *
+LookupPasmWord(const char *name, int kind)
+{
+    Symbol *sym;
+
+    sym = FindSymbol(kind == SYM_INSTR ? &pasmInstrWords : &pasmWords, name);
+    if (!sym || sym->kind != kind) {
+        return NULL;
+    }
+    return sym->val;
+}
+
 /* parse the rest of the line as a string */
 static void
 parseLineAsString(LexStream *L, AST **ast_ptr)
@@ -1023,7 +1118,6 @@ parseBacktickString(LexStream *L, AST **ast_ptr, int first)
     ast->d.string = getTranslatedString(&fb);
     if (ast->d.string[0] == 0) {
         c = lexgetc(L);
-        free(ast);
         ast = NULL;
     } else {
         c = SP_BACKTICK_STRING;
@@ -3902,6 +3996,7 @@ parseBasicIdentifier(LexStream *L, AST **ast_ptr)
     Symbol *sym;
     AST *ast = NULL;
     char *idstr;
+    const char *name;
     bool forceLower = 0; // !gl_caseSensitive;
     
     flexbuf_init(&fb, INCSTR);
@@ -4018,25 +4113,29 @@ parseBasicIdentifier(LexStream *L, AST **ast_ptr)
 	}
       }
     }
+    // from here on only the shared copy of the name is needed
+    name = InternString(idstr);
+    free(idstr);
+
     // check for a defined class or similar type
     if (current) {
-        sym = LookupSymbolInTable(currentTypes, idstr);
+        sym = LookupSymbolInTable(currentTypes, name);
         if (sym) {
             if (sym->kind == SYM_VARIABLE) {
                 ast = (AST *)sym->val;
                 // check for an abstract object declaration
-                if (ast->left && ast->left->kind == AST_OBJDECL && ast->left->left->kind == AST_IDENTIFIER && !strcmp(idstr, ast->left->left->d.string)) {
+                if (ast->left && ast->left->kind == AST_OBJDECL && ast->left->left->kind == AST_IDENTIFIER && !strcmp(name, ast->left->left->d.string)) {
                     *ast_ptr = ast;
-                    last_ast = AstIdentifier(idstr);
+                    last_ast = AstIdentifier(name);
                     return BAS_TYPENAME;
                 }
             } else if (sym->kind == SYM_TYPEDEF) {
                 ast = (AST *)sym->val;
                 *ast_ptr = ast;
-                last_ast = AstIdentifier(idstr);
+                last_ast = AstIdentifier(name);
                 return BAS_TYPENAME;
             } else if (sym->kind == SYM_REDEF) {
-                last_ast = AstIdentifier(idstr);
+                last_ast = AstIdentifier(name);
                 ast = NewAST(AST_LOCAL_IDENTIFIER, (AST *)sym->val, last_ast);
                 *ast_ptr = ast;
                 return BAS_IDENTIFIER;
@@ -4044,7 +4143,7 @@ parseBasicIdentifier(LexStream *L, AST **ast_ptr)
         }
     }
     // it's an identifier
-    ast = AstIdentifier(idstr);
+    ast = AstIdentifier(name);
     *ast_ptr = last_ast = ast;
 
     // if the next character is ':' then it may be a label
@@ -4259,6 +4358,7 @@ parseCIdentifier(LexStream *L, AST **ast_ptr, const char *prefix)
     Symbol *sym;
     AST *ast = NULL;
     char *idstr;
+    const char *name;
     
     flexbuf_init(&fb, INCSTR);
     if (prefix) {
@@ -4366,17 +4466,21 @@ parseCIdentifier(LexStream *L, AST **ast_ptr, const char *prefix)
           return C_IDENTIFIER;
       }
     }
+    // from here on only the shared copy of the name is needed
+    name = InternString(idstr);
+    free(idstr);
+
     // check for a defined class or similar type
     if (current) {
-        sym = LookupSymbolInTable(currentTypes, idstr);
+        sym = LookupSymbolInTable(currentTypes, name);
         if (sym) {
             if (sym->kind == SYM_TYPEDEF && allow_type_names) {
-                last_ast = ast = AstIdentifier(idstr);
+                last_ast = ast = AstIdentifier(name);
                 *ast_ptr = ast;
                 return C_TYPE_NAME;
             }
             if (sym->kind == SYM_REDEF) {
-                last_ast = AstIdentifier(idstr);
+                last_ast = AstIdentifier(name);
                 ast = NewAST(AST_LOCAL_IDENTIFIER, (AST *)sym->val, last_ast);
                 *ast_ptr = ast;
                 return C_IDENTIFIER;
@@ -4384,7 +4488,7 @@ parseCIdentifier(LexStream *L, AST **ast_ptr, const char *prefix)
         }
     }
     // it's an identifier
-    ast = AstIdentifier(idstr);
+    ast = AstIdentifier(name);
     *ast_ptr = last_ast = ast;
     return C_IDENTIFIER;
 }
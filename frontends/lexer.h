@@ -52,7 +52,23 @@ void NormalizeIdentifier(char *name);
  */
 AST *GetComments(void);
 
+/*
+ * functions to build the ASTs the lexer would produce for
+ * identifiers and PASM keywords in a DAT block
+ */
+AST *DatIdentifierAST(const char *text, int language, int startOfLine);
+AST *DatKeywordAST(const char *name);
+
+/*
+ * function to find the lexer's data for a PASM instruction,
+ * modifier, or hardware register
+ */
+void *LookupPasmWord(const char *name, int kind);
+
 // utility routine: Make a path name absolute
 const char *MakeAbsolutePath(const char *name);
 
+// utility routine: find the full path of the running executable
+int getProgramPath(const char **argv, char *path, int size);
+
 #endif
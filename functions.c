@@ -55,7 +55,7 @@ NumExprItemsOnStack(AST *expr)
     return ((siz+3) & ~3) / LONG_SIZE;
 }
 
-Function *curfunc;
+THREAD_LOCAL Function *curfunc;
 static int visitPass = 1;
 
 static void ReinitFunction(Function *f, int language)
@@ -1154,6 +1154,9 @@ DeclareFunctions(Module *P)
 {
     AST *ast;
     Module *savecurrent = current;
+    struct timespan span;
+
+    timereport_begin(&span, "DeclareFunctions", P->fullname);
     current = P;
     ast = P->funcblock;
     while (ast) {
@@ -1162,6 +1165,7 @@ DeclareFunctions(Module *P)
     }
     P->funcblock = NULL;
     current = savecurrent;
+    timereport_end(&span, 0);
 }
 
 /*
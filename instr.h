@@ -428,6 +428,7 @@ struct IR {
     enum OperandEffect srceffect; // special effect (e.g. postinc) for source
     enum OperandEffect dsteffect; // special effect for dest
     Operand *fcache;   // if non-NULL, fcache root
+    unsigned visit;    // scratch mark used by optimizer searches
 };
 
 void AppendOperand(OperandList **listptr, Operand *op);
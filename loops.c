@@ -15,6 +15,7 @@
 #define LVFLAG_LOOPDEPEND  0x04 /* assignment value is loop dependent */
 #define LVFLAG_LOOPUSED    0x08 /* variable in assignment is used */
 #define LVFLAG_VARYMASK    0xff /* any of these bits set means assignment depends on loop */
+#define LVFLAG_SEARCHING   0x100 /* FindLoopStep is following this assignment */
 
 //
 // loop value table
@@ -461,7 +462,12 @@ FindLoopStep(LoopValueSet *lvs, AST *val, AST **basename)
             }
             return NULL;
         }
-        return FindLoopStep(lvs, newval, basename);
+        // assignments like "t := x * 3" and "x := t + 1" refer to each other
+        if (entry->flags & LVFLAG_SEARCHING) return NULL;
+        entry->flags |= LVFLAG_SEARCHING;
+        loopstep = FindLoopStep(lvs, newval, basename);
+        entry->flags &= ~LVFLAG_SEARCHING;
+        return loopstep;
     case AST_ADDROF:
         val = val->left;
         if (val && val->kind == AST_ARRAYREF) {
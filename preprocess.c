@@ -61,85 +61,70 @@
 static void doerror(struct preprocess *pp, const char *msg, ...);
 
 /*
- * function to read a single LATIN-1 character
- * from a file
- * returns number of bytes placed in buffer, or -1 on EOF
+ * read all of file A, and convert it to UTF-8 with plain LF line
+ * endings; the encoding is worked out once, from the start of the file:
+ *   EF BB BF    UTF-8 with a byte order mark (which is discarded)
+ *   FF FE       UTF-16LE
+ *   80 to BF    LATIN-1 (not a valid first byte for UTF-8)
+ * and anything else is taken as UTF-8
  */
-static int
-read_latin1(FILE *f, char buf[4])
-{
-  int c = fgetc(f);
-  if (c == EOF)
-    return -1;
-  if (c <= 127) {
-    buf[0] = (char)c;
-    return 1;
-  }
-  buf[0] = 0xC0 + ((c>>6) & 0x1f);
-  buf[1] = 0x80 + ( c & 0x3f );
-  return 2;
-}
-
-/*
- * function to read a single UTF-8 character
- * from a file
- * returns number of bytes placed in buffer, or -1 on EOF
- */
-static int
-read_single(FILE *f, char buf[4])
-{
-    int c = fgetc(f);
-    if (c == EOF)
-        return -1;
-    buf[0] = (char)c;
-    return 1;
-}
-
-/*
- * function to read a single UTF-16 character
- * from a file
- * returns number of bytes placed in buffer, or -1 on EOF
- */
-static int
-read_utf16(FILE *f, char buf[4])
+static void
+load_file(struct filestate *A)
 {
-    int c, d;
-    int r;
-    c = fgetc(f);
-    if (c < 0)
-        return -1;
-    d = fgetc(f);
-    if (d < 0)
-        return -1;
-
-    c = c + (d<<8);
-    /* here we need to translate UTF-16 to UTF-8 */
-    /* FIXME: this code is not done properly; it does
-       not handle surrogate pairs (0xD800 - 0xDFFF)
-     */
-    if (c < 128) {
-        buf[0] = (char)c;
-        r = 1;
-    } else if (c < 0x800) {
-        buf[0] = 0xC0 + ((c>>6) &  0x1F);
-        buf[1] = 0x80 + ( c & 0x3F );
-        r = 2;
-    } else if (c < 0x10000) {
-        buf[0] = 0xE0 + ((c>>12) & 0x0F);
-        buf[1] = 0x80 + ((c>>6) & 0x3F);
-        buf[2] = 0x80 + (c & 0x3F);
-        r = 3;
-    } else {
-        buf[0] = 0xE0 + ((c>>18) & 0x07);
-        buf[1] = 0x80 + ((c>>12) & 0x3F);
-        buf[2] = 0x80 + ((c>>6) & 0x3F);
-        buf[3] = 0x80 + (c & 0x3F);
-        r = 4;
+    struct flexbuf raw, text;
+    char buf[8192];
+    unsigned char *p;
+    size_t n, len, i;
+    int mode = MODE_UTF8;
+    int latin1 = 0;
+    char u[8];
+    unsigned c;
+
+    flexbuf_init(&raw, 65536);
+    while ((n = fread(buf, 1, sizeof(buf), A->f)) > 0) {
+        flexbuf_addmem(&raw, buf, n);
     }
-    return r;
+    p = (unsigned char *)flexbuf_peek(&raw);
+    len = flexbuf_curlen(&raw);
+    i = 0;
+    if (len >= 3 && p[0] == 0xef && p[1] == 0xbb && p[2] == 0xbf) {
+        i = 3;
+    } else if (len >= 2 && p[0] == 0xff && p[1] == 0xfe) {
+        mode = MODE_UTF16;
+        i = 2;
+    } else if (len >= 1 && p[0] >= 0x80 && p[0] < 0xc0) {
+        latin1 = 1;
+    }
+    flexbuf_init(&text, len + 1);
+    while (i < len) {
+        if (mode == MODE_UTF16) {
+            if (i + 1 >= len) break;
+            c = p[i] | (p[i+1] << 8);
+            i += 2;
+        } else {
+            c = p[i++];
+        }
+        if (c == '\r') {
+            /* CR and CR+LF both become LF */
+            flexbuf_addchar(&text, '\n');
+            if (mode == MODE_UTF16) {
+                if (i + 1 < len && p[i] == '\n' && p[i+1] == 0) i += 2;
+            } else if (i < len && p[i] == '\n') {
+                i++;
+            }
+        } else if (c < 0x80 || (mode == MODE_UTF8 && !latin1)) {
+            flexbuf_addchar(&text, c);
+        } else {
+            flexbuf_addmem(&text, u, to_utf8(u, c));
+        }
+    }
+    flexbuf_delete(&raw);
+    A->textlen = flexbuf_curlen(&text);
+    flexbuf_addchar(&text, 0);
+    A->text = flexbuf_get(&text);
+    A->pos = 0;
 }
 
-
 /*
  * read a line
  * returns number of bytes read, or 0 on EOF
@@ -157,82 +142,29 @@ read_utf16(FILE *f, char buf[4])
 int
 pp_nextline(struct preprocess *pp)
 {
-    int r;
-    int count = 0;
-    FILE *f;
-    char buf[4];
+    int count;
     char *full_line;
+    char *start, *eol;
     struct filestate *A;
 
     A = pp->fil;
     if (!A)
         return 0;
-    f = A->f;
+    if (!A->text) {
+        load_file(A);
+    }
 
     flexbuf_clear(&pp->line);
-    if (A->readfunc == NULL) {
-        int c0, c1;
-        c0 = fgetc(f);
-        if (c0 < 0) return 0;
-	if (c0 == 0xef) {
-	    A->readfunc = read_single;
-	    c1 = fgetc(f);
-	    if (c1 == 0xbb) {
-	        c1 = fgetc(f);
-		if (c1 == 0xbf) {
-		  /* discard the byte order mark */
-		} else {
-		  ungetc(c1, f);
-		  ungetc(0xbb, f);
-		}
-	    } else {
-	        ungetc(c1, f);
-	    }
-	} else
-        if (c0 != 0xff) {
-            if (c0 >= 0x80 && c0 < 0xc0) {
-	        A->readfunc = read_latin1;
-	    } else {
-                A->readfunc = read_single;
-	    }
-            flexbuf_addchar(&pp->line, c0);
-        } else {
-            c1 = fgetc(f);
-            if (c1 == 0xfe) {
-                A->readfunc = read_utf16;
-            } else {
-                A->readfunc = read_single;
-                flexbuf_addchar(&pp->line, c0);
-                ungetc(c1, f);
-            }
-        }
-        A->skipnl = 0;
-        if (c0 == '\n') {
-            flexbuf_addchar(&pp->line, 0);
-            A->lineno++;
-            return 1;
-        }
-    }
-    for(;;) {
-        r = (*A->readfunc)(f, buf);
-        if (r <= 0) break;
-        if (buf[0] == '\n' && A->skipnl) {
-            A->skipnl = 0;
-            continue;
-        }
-        if (buf[0] == '\r') {
-            buf[0] = '\n';
-            A->skipnl = 1; // if CR NL is seen, skip the NL
-        }
-        count += r;
-        flexbuf_addmem(&pp->line, buf, r);
-        if (buf[0] == '\n') {
-            A->lineno++;
-            break;
-        } else {
-            A->skipnl = 0;
-        }
+    start = A->text + A->pos;
+    eol = (char *)memchr(start, '\n', A->textlen - A->pos);
+    if (eol) {
+        count = eol + 1 - start;
+        A->lineno++;
+    } else {
+        count = (int)(A->textlen - A->pos);
     }
+    A->pos += count;
+    flexbuf_addmem(&pp->line, start, count);
     flexbuf_addchar(&pp->line, '\0');
     if (pp->incomment == 0) {
         /* look for special sequences */
@@ -424,6 +356,7 @@ void pp_pop_file(struct preprocess *pp)
         pp->fil = A->next;
         if (A->flags & FILE_FLAGS_CLOSEFILE)
             fclose(A->f);
+        free(A->text);
         free(A);
         A = pp->fil;
         if (A && A->name) {
@@ -436,6 +369,53 @@ void pp_pop_file(struct preprocess *pp)
     pp->incomment = 0;
 }
 
+/*
+ * definitions are kept in a list, newest first, which makes it easy
+ * to go back to an earlier state (see pp_restore_define_state); they are
+ * also hashed so that looking up a name does not have to search the whole
+ * list. Within a bucket the newest definition is also first, so the
+ * first match is the current one, and the definition being removed
+ * by pp_restore_define_state is always at the head of its bucket.
+ * The hash ignores case, so it works whether or not ignore_case is set.
+ */
+static unsigned
+pp_hash(const char *name)
+{
+    unsigned h = 0;
+
+    while (*name) {
+        h = h * 31 + tolower((unsigned char)*name++);
+    }
+    return h;
+}
+
+static void
+pp_grow_deftab(struct preprocess *pp)
+{
+    struct predef **all;
+    struct predef *x;
+    unsigned i, n, newsize;
+
+    newsize = pp->deftabsize ? 2 * pp->deftabsize : 256;
+    free(pp->deftab);
+    pp->deftab = (struct predef **)calloc(newsize, sizeof(*pp->deftab));
+    pp->deftabsize = newsize;
+
+    // re-insert oldest first, to keep each bucket newest first
+    all = (struct predef **)malloc((pp->numdefs + 1) * sizeof(*all));
+    n = 0;
+    for (x = pp->defs; x; x = x->next) {
+        all[n++] = x;
+    }
+    while (n > 0) {
+        x = all[--n];
+        i = pp_hash(x->name) & (newsize - 1);
+        x->hnext = pp->deftab[i];
+        pp->deftab[i] = x;
+    }
+    free(all);
+}
+
 /*
  * add a definition
  * "flags" indicates things like whether we must free the memory
@@ -445,6 +425,7 @@ static void
 pp_define_internal(struct preprocess *pp, const char *name, const char *def, int flags)
 {
     struct predef *the;
+    unsigned i;
 
     the = (struct predef *)calloc(sizeof(*the), 1);
     the->name = name;
@@ -452,6 +433,14 @@ pp_define_internal(struct preprocess *pp, const char *name, const char *def, int
     the->flags = flags;
     the->next = pp->defs;
     pp->defs = the;
+    pp->numdefs++;
+    if (pp->numdefs > 2 * pp->deftabsize) {
+        pp_grow_deftab(pp);
+    } else {
+        i = pp_hash(name) & (pp->deftabsize - 1);
+        the->hnext = pp->deftab[i];
+        pp->deftab[i] = the;
+    }
 }
 
 /*
@@ -476,18 +465,18 @@ pp_getdef(struct preprocess *pp, const char *name)
     const char *def = NULL;
     int (*strcmp_func)(const char *a, const char *b);
     
-    X = pp->defs;
     if (pp->ignore_case) {
         strcmp_func = strcasecmp;
     } else {
         strcmp_func = strcmp;
     }
+    X = pp->deftab ? pp->deftab[pp_hash(name) & (pp->deftabsize - 1)] : NULL;
     while (X) {
         if (!strcmp_func(X->name, name)) {
             def = X->def;
             break;
         }
-        X = X->next;
+        X = X->hnext;
     }
     if (!def) {
         static char newdef[1024];
@@ -1236,6 +1225,9 @@ pp_restore_define_state(struct preprocess *pp, void *vp)
     while (x && x != where) {
         old = x;
         x = old->next;
+        // the newest definition is always first in its bucket
+        pp->deftab[pp_hash(old->name) & (pp->deftabsize - 1)] = old->hnext;
+        pp->numdefs--;
         if (old->flags & PREDEF_FLAG_FREEDEFS)
         {
             free((void *)old->name);
@@ -14,6 +14,7 @@
 
 struct predef {
     struct predef *next;
+    struct predef *hnext;  /* next (older) definition in the same hash bucket */
     const char *name;
     const char *def;
     const char *argcdef; /* -Dname=def version, for passing to mcpp */
@@ -31,9 +32,10 @@ struct filestate {
     FILE *f;
     const char *name;
     int lineno;
-    int (*readfunc)(FILE *f, char *buf);
+    char *text;      /* whole file, converted to UTF-8 */
+    size_t textlen;
+    size_t pos;      /* start of the next line in text */
     int flags;
-    int skipnl;
 };
 #define FILE_FLAGS_CLOSEFILE 0x01
 
@@ -50,7 +52,10 @@ struct preprocess {
     struct filestate *fil;
     struct flexbuf line;
     struct flexbuf whole;
-    struct predef *defs;
+    struct predef *defs;       /* all definitions, newest first */
+    struct predef **deftab;    /* hash table of the same definitions */
+    unsigned deftabsize;       /* number of buckets in deftab */
+    unsigned numdefs;
 
     struct ifstate *ifs;
 
@@ -0,0 +1,670 @@
+/*
+ * Cycle counting simulator for Propeller 1 and 2 binaries:
+ * loading, hub memory, pins, serial output, and profiling
+ *
+ * Copyright 2024 Total Spectrum Software Inc.
+ * See the file COPYING for terms of use
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "sim.h"
+
+#define NEVER ((uint64_t)-1)
+
+void
+SimInit(Sim *S, int p2)
+{
+    int i;
+
+    memset(S, 0, sizeof(*S));
+    S->p2 = p2;
+    if (p2) {
+        S->hub = (uint8_t *)calloc(1, P2_HUBSIZE);
+        S->hubmask = P2_HUBSIZE - 1;
+        S->txPin = 62;
+        S->rxPin = 63;
+        S->baud = 230400;
+    } else {
+        S->hub = (uint8_t *)calloc(1, P1_HUBSIZE);
+        S->hubmask = P1_HUBSIZE - 1;
+        S->txPin = 30;
+        S->rxPin = 31;
+        S->baud = 115200;
+    }
+    if (!S->hub) {
+        fprintf(stderr, "flexsim: out of memory\n");
+        exit(2);
+    }
+    for (i = 0; i < SIM_NUMCOGS; i++) {
+        S->cog[i].id = i;
+    }
+    for (i = 0; i < SIM_NUMPINS; i++) {
+        S->smart[i].inTime = NEVER;
+    }
+    S->txDecoder.level = 1;
+    S->maxCycles = 4000000000ULL;
+    S->rnd = 0x9E3779B97F4A7C15ULL;
+    S->lmmPcReg = -1;
+    S->other.name = "(other)";
+}
+
+int
+SimLoadBinary(Sim *S, const char *fname)
+{
+    FILE *f = fopen(fname, "rb");
+    size_t n;
+
+    if (!f) {
+        perror(fname);
+        return 0;
+    }
+    n = fread(S->hub, 1, S->hubmask + 1, f);
+    fclose(f);
+    if (n == 0) {
+        fprintf(stderr, "flexsim: %s is empty\n", fname);
+        return 0;
+    }
+    S->imageSize = n;
+    return 1;
+}
+
+/*
+ * a P1 binary starts with a header giving the clock, the start of the
+ * Spin objects (always $10) and the start of variables
+ */
+int
+SimGuessP2(const char *fname)
+{
+    FILE *f = fopen(fname, "rb");
+    uint8_t hdr[16];
+    unsigned pbase, vbase, dbase;
+    long size;
+
+    if (!f) {
+        return 1;
+    }
+    if (fread(hdr, 1, sizeof(hdr), f) != sizeof(hdr)) {
+        fclose(f);
+        return 1;
+    }
+    fseek(f, 0L, SEEK_END);
+    size = ftell(f);
+    fclose(f);
+    pbase = hdr[6] | (hdr[7] << 8);
+    vbase = hdr[8] | (hdr[9] << 8);
+    dbase = hdr[10] | (hdr[11] << 8);
+    if (pbase == 0x10 && vbase <= size && dbase > vbase) {
+        return 0;
+    }
+    return 1;
+}
+
+/*
+ * hub memory; the P1 ignores the low address bits, the P2 does not
+ * care about alignment
+ */
+uint32_t
+SimRdByte(Sim *S, uint32_t addr)
+{
+    return S->hub[addr & S->hubmask];
+}
+
+uint32_t
+SimRdWord(Sim *S, uint32_t addr)
+{
+    if (!S->p2) addr &= ~1;
+    return SimRdByte(S, addr) | (SimRdByte(S, addr+1) << 8);
+}
+
+uint32_t
+SimRdLong(Sim *S, uint32_t addr)
+{
+    if (!S->p2) {
+        addr &= S->hubmask & ~3;
+        return S->hub[addr] | (S->hub[addr+1] << 8) | (S->hub[addr+2] << 16) | ((uint32_t)S->hub[addr+3] << 24);
+    }
+    return SimRdWord(S, addr) | (SimRdWord(S, addr+2) << 16);
+}
+
+void
+SimWrByte(Sim *S, uint32_t addr, uint32_t val)
+{
+    addr &= S->hubmask;
+    if (!S->p2 && addr >= 0x8000) {
+        return; /* ROM */
+    }
+    S->hub[addr] = val;
+}
+
+void
+SimWrWord(Sim *S, uint32_t addr, uint32_t val)
+{
+    if (!S->p2) addr &= ~1;
+    SimWrByte(S, addr, val);
+    SimWrByte(S, addr+1, val >> 8);
+}
+
+void
+SimWrLong(Sim *S, uint32_t addr, uint32_t val)
+{
+    if (!S->p2) addr &= ~3;
+    SimWrWord(S, addr, val);
+    SimWrWord(S, addr+2, val >> 16);
+}
+
+uint32_t
+SimRandom(Sim *S)
+{
+    uint64_t x = S->rnd;
+
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    S->rnd = x;
+    return (uint32_t)((x * 0x2545F4914F6CDD1DULL) >> 32);
+}
+
+Cog *
+SimFreeCog(Sim *S)
+{
+    int i;
+
+    for (i = 0; i < SIM_NUMCOGS; i++) {
+        if (!S->cog[i].running) {
+            return &S->cog[i];
+        }
+    }
+    return NULL;
+}
+
+void
+SimUnimplemented(Sim *S, Cog *C, uint32_t instr)
+{
+    fprintf(stderr, "flexsim: cog %d: instruction $%08x at $%05x is not simulated\n",
+            C->id, (unsigned)instr, (unsigned)C->pc);
+    S->error = "unsupported instruction";
+    S->done = 1;
+}
+
+/*
+ * serial output
+ */
+
+/* bytes from the program; 0xff 0x00 <n> means "exit with status n" */
+void
+SimSerialOut(Sim *S, int c)
+{
+    c &= 0xff;
+    if (S->sawFF00) {
+        S->exitStatus = c;
+        S->done = 1;
+        return;
+    }
+    if (S->sawFF) {
+        S->sawFF = 0;
+        if (c == 0) {
+            S->sawFF00 = 1;
+            return;
+        }
+        putchar(0xff);
+    }
+    if (c == 0xff) {
+        S->sawFF = 1;
+        return;
+    }
+    putchar(c);
+}
+
+static uint32_t
+ClockFreq(Sim *S)
+{
+    uint32_t freq = SimRdLong(S, S->p2 ? 0x14 : 0);
+
+    return freq ? freq : 80000000;
+}
+
+/* sample the bits of a bit banged character up to time "when" */
+static void
+SerialAdvance(Sim *S, uint64_t when)
+{
+    SerialDecoder *D = &S->txDecoder;
+    uint64_t sample;
+
+    while (D->active) {
+        sample = D->start + D->bitTime * (D->bits + 1) + D->bitTime / 2;
+        if (sample > when) {
+            break;
+        }
+        if (D->bits == 8) {
+            /* the stop bit */
+            D->active = 0;
+            SimSerialOut(S, D->data);
+            break;
+        }
+        D->data |= D->level << D->bits;
+        D->bits++;
+    }
+}
+
+static void
+SerialLevel(Sim *S, uint64_t when, int level)
+{
+    SerialDecoder *D = &S->txDecoder;
+
+    SerialAdvance(S, when);
+    if (level == D->level) {
+        return;
+    }
+    D->level = level;
+    if (!D->active && level == 0) {
+        D->active = 1;
+        D->start = when;
+        D->bits = 0;
+        D->data = 0;
+        D->bitTime = ClockFreq(S) / S->baud;
+    }
+}
+
+/* the pin outputs of some cog changed at time "when" */
+void
+SimPinsChanged(Sim *S, uint64_t when)
+{
+    uint64_t out = 0, dir = 0;
+    uint64_t odir = S->pinDir;
+    uint64_t cogdir, changed;
+    Cog *C;
+    int i, level;
+
+    for (i = 0; i < SIM_NUMCOGS; i++) {
+        C = &S->cog[i];
+        if (!C->running) continue;
+        if (S->p2) {
+            cogdir = C->regs[0x1fa] | ((uint64_t)C->regs[0x1fb] << 32);
+            out |= cogdir & (C->regs[0x1fc] | ((uint64_t)C->regs[0x1fd] << 32));
+        } else {
+            cogdir = C->regs[0x1f6];
+            out |= cogdir & C->regs[0x1f4];
+        }
+        dir |= cogdir;
+    }
+    S->pinOut = out;
+    S->pinDir = dir;
+
+    if (S->p2) {
+        /* a smart pin is held in reset while DIR is low */
+        changed = (odir ^ dir) & ~dir;
+        for (i = 0; changed; i++, changed >>= 1) {
+            if (changed & 1) {
+                S->smart[i].inTime = NEVER;
+                S->smart[i].busyUntil = 0;
+            }
+        }
+        if (S->smart[S->txPin].mode) {
+            return;
+        }
+    }
+    level = ((dir >> S->txPin) & 1) ? (out >> S->txPin) & 1 : 1;
+    SerialLevel(S, when, level);
+}
+
+/*
+ * symbols from the listing file
+ */
+
+static int
+CmpSymAddr(const void *va, const void *vb)
+{
+    const SimSymbol *a = (const SimSymbol *)va;
+    const SimSymbol *b = (const SimSymbol *)vb;
+
+    if (a->addr != b->addr) return a->addr < b->addr ? -1 : 1;
+    /* prefer function labels at the same address */
+    if (a->func != b->func) return a->func ? 1 : -1;
+    return 0;
+}
+
+static int
+CmpSymName(const void *va, const void *vb)
+{
+    const SimSymbol *a = (const SimSymbol *)va;
+    const SimSymbol *b = (const SimSymbol *)vb;
+
+    return strcmp(a->name, b->name);
+}
+
+static int
+IsKeyword(const char *s)
+{
+    static const char *keywords[] = { "con", "dat", "pub", "pri", "var", "obj", NULL };
+    int i;
+
+    for (i = 0; keywords[i]; i++) {
+        if (!strcasecmp(s, keywords[i])) return 1;
+    }
+    return 0;
+}
+
+static void
+AddSym(SimSymbol **list, int *num, int *max, uint32_t addr, const char *name, uint32_t base)
+{
+    if (*num == *max) {
+        *max = *max ? 2 * *max : 256;
+        *list = (SimSymbol *)realloc(*list, *max * sizeof(SimSymbol));
+    }
+    (*list)[*num].addr = addr;
+    (*list)[*num].name = name;
+    (*list)[*num].base = base;
+    (*list)[*num].func = NULL;
+    (*num)++;
+}
+
+/*
+ * read labels from a flexspin listing; lines look like
+ *   HHHHH CCC bytes | source
+ * where the cog address CCC is blank for hub code. A label "foo" is taken
+ * to start a function if there is also a label "foo_ret".
+ */
+int
+SimReadListing(Sim *S, const char *fname)
+{
+    FILE *f = fopen(fname, "r");
+    char line[1024];
+    char name[256];
+    char *src, *p;
+    unsigned hubaddr, cogaddr;
+    int maxCog = 0, maxHub = 0;
+    int i, n, haveCog, haveLmm = 0;
+    SimSymbol key, *byName, *ret;
+    SimFunc *F;
+
+    if (!f) {
+        perror(fname);
+        return 0;
+    }
+    while (fgets(line, sizeof(line), f)) {
+        src = strstr(line, "| ");
+        if (!src || src - line < 6 || !isxdigit((unsigned char)line[0])) continue;
+        src += 2;
+        if (!isalpha((unsigned char)*src) && *src != '_') continue;
+        for (n = 0, p = src; (isalnum((unsigned char)*p) || *p == '_') && n < (int)sizeof(name) - 1; p++) {
+            name[n++] = *p;
+        }
+        name[n] = 0;
+        while (*p == ' ' || *p == '\t') p++;
+        if (*p == '=' || IsKeyword(name)) continue;
+        hubaddr = strtoul(line, NULL, 16);
+        haveCog = sscanf(line + 6, "%3x", &cogaddr) == 1 && line[6] != ' ';
+        p = strdup(name);
+        AddSym(&S->hubSyms, &S->numHubSyms, &maxHub, hubaddr, p, 0);
+        if (haveCog) {
+            AddSym(&S->cogSyms, &S->numCogSyms, &maxCog, cogaddr, p, hubaddr - 4*cogaddr);
+            if (!strcmp(name, "pc")) {
+                S->lmmPcReg = cogaddr;
+            } else if (!strcmp(name, "LMM_LOOP")) {
+                haveLmm = 1;
+            }
+        }
+    }
+    fclose(f);
+    if (!haveLmm || S->p2) {
+        S->lmmPcReg = -1;
+    }
+
+    /* find the functions */
+    n = S->numHubSyms;
+    byName = (SimSymbol *)malloc((n + 1) * sizeof(SimSymbol));
+    if (n) memcpy(byName, S->hubSyms, n * sizeof(SimSymbol));
+    qsort(byName, n, sizeof(SimSymbol), CmpSymName);
+    S->funcs = (SimFunc *)calloc(n + 1, sizeof(SimFunc));
+    for (i = 0; i < n; i++) {
+        if (i > 0 && !strcmp(byName[i].name, byName[i-1].name)) continue;
+        snprintf(name, sizeof(name), "%s_ret", byName[i].name);
+        key.name = name;
+        ret = (SimSymbol *)bsearch(&key, byName, n, sizeof(SimSymbol), CmpSymName);
+        if (!ret) continue;
+        F = &S->funcs[S->numFuncs++];
+        F->name = byName[i].name;
+        F->addr = byName[i].addr;
+        F->inCog = 0;
+    }
+    free(byName);
+    for (i = 0; i < S->numFuncs; i++) {
+        F = &S->funcs[i];
+        for (n = 0; n < S->numHubSyms; n++) {
+            if (S->hubSyms[n].name == F->name || !strcmp(S->hubSyms[n].name, F->name)) {
+                S->hubSyms[n].func = F;
+            }
+        }
+        for (n = 0; n < S->numCogSyms; n++) {
+            if (!strcmp(S->cogSyms[n].name, F->name)) {
+                S->cogSyms[n].func = F;
+                F->inCog = 1;
+                F->addr = S->cogSyms[n].addr;
+            }
+        }
+    }
+    qsort(S->hubSyms, S->numHubSyms, sizeof(SimSymbol), CmpSymAddr);
+    qsort(S->cogSyms, S->numCogSyms, sizeof(SimSymbol), CmpSymAddr);
+    return 1;
+}
+
+/*
+ * find the last label at or before "addr"; for cog labels the
+ * code must have been loaded from the same place as the label's
+ */
+static SimSymbol *
+FindSym(SimSymbol *syms, int n, uint32_t addr, int checkBase, uint32_t base, uint32_t *hi)
+{
+    int lo = 0, top = n - 1, mid, found = -1;
+
+    while (lo <= top) {
+        mid = (lo + top) / 2;
+        if (syms[mid].addr <= addr) {
+            found = mid;
+            lo = mid + 1;
+        } else {
+            top = mid - 1;
+        }
+    }
+    *hi = (found + 1 < n) ? syms[found+1].addr : 0xffffffff;
+    /* LUT code ($200-$3ff on P2) is copied there by the program itself */
+    if (found >= 0 && checkBase && syms[found].addr < 0x200 && syms[found].base != base) {
+        /* the range is not simple to describe, so do not cache it */
+        *hi = addr + 1;
+        while (found >= 0 && syms[found].addr < 0x200 && syms[found].base != base) {
+            found--;
+        }
+    }
+    return found >= 0 ? &syms[found] : NULL;
+}
+
+/*
+ * charge "cycles" spent executing the instruction at "addr" to the
+ * function it belongs to
+ */
+void
+SimProfile(Sim *S, Cog *C, uint32_t addr, int inCog, uint64_t cycles)
+{
+    SimSymbol *sym;
+    SimFunc *F;
+    uint32_t hubaddr, hi;
+
+    if (inCog == C->profInCog && addr >= C->profLo && addr < C->profHi) {
+        sym = C->profSym;
+    } else {
+        if (inCog) {
+            sym = FindSym(S->cogSyms, S->numCogSyms, addr, 1, C->loadBase, &hi);
+        } else {
+            sym = FindSym(S->hubSyms, S->numHubSyms, addr, 0, 0, &hi);
+        }
+        C->profSym = sym;
+        C->profInCog = inCog;
+        C->profLo = (hi == addr + 1) ? addr : sym ? sym->addr : 0;
+        C->profHi = hi;
+    }
+    if (inCog && S->lmmPcReg >= 0 && (!sym || !sym->func)) {
+        /* the P1 LMM kernel is running hub code */
+        hubaddr = C->regs[S->lmmPcReg] - 4;
+        sym = FindSym(S->hubSyms, S->numHubSyms, hubaddr, 0, 0, &hi);
+        if (sym && sym->func && sym->addr == hubaddr && C->lastProfAddr != hubaddr) {
+            C->lastProfAddr = hubaddr;
+            if (sym->func != C->curfunc) {
+                sym->func->calls++;
+            }
+        }
+        if (sym && sym->func) {
+            /* the listing gives LMM code cog addresses too */
+            sym->func->inCog = 0;
+            C->curfunc = sym->func;
+        }
+    } else if (sym && sym->func) {
+        if (sym->addr == addr && C->lastProfAddr != addr) {
+            sym->func->calls++;
+        }
+        C->curfunc = sym->func;
+        C->lastProfAddr = addr;
+    } else {
+        C->lastProfAddr = addr;
+    }
+    F = C->curfunc ? C->curfunc : &S->other;
+    F->cycles += cycles;
+    F->instrs++;
+    S->instrs++;
+}
+
+/*
+ * run until cog 0 stops, the program sends the exit sequence, or the
+ * cycle limit is reached
+ */
+void
+SimRun(Sim *S)
+{
+    Cog *C, *next;
+    int i;
+
+    if (!(S->p2 ? P2Boot(S) : P1Boot(S))) {
+        S->done = 1;
+        if (!S->error) S->error = "unable to start";
+    }
+    while (!S->done) {
+        next = NULL;
+        for (i = 0; i < SIM_NUMCOGS; i++) {
+            C = &S->cog[i];
+            if (C->running && (!next || C->time < next->time)) {
+                next = C;
+            }
+        }
+        if (!next || !S->cog[0].running) {
+            break;
+        }
+        if (next->time > S->maxCycles) {
+            fprintf(stderr, "flexsim: stopped after %llu cycles\n", (unsigned long long)S->maxCycles);
+            S->error = "cycle limit reached";
+            break;
+        }
+        S->now = next->time;
+        if (S->txDecoder.active) {
+            /* the stop bit of the last character has no edge to wake us */
+            SerialAdvance(S, S->now);
+        }
+        if (S->p2) {
+            P2Step(S, next);
+        } else {
+            P1Step(S, next);
+        }
+    }
+    /* finish off any character still being sent */
+    SerialAdvance(S, NEVER);
+    if (S->sawFF && !S->sawFF00) {
+        putchar(0xff);
+    }
+    fflush(stdout);
+}
+
+static int
+CmpFuncCycles(const void *va, const void *vb)
+{
+    const SimFunc *a = *(const SimFunc **)va;
+    const SimFunc *b = *(const SimFunc **)vb;
+
+    if (a->cycles != b->cycles) return a->cycles > b->cycles ? -1 : 1;
+    return strcmp(a->name, b->name);
+}
+
+/* the functions that ran, busiest first */
+static SimFunc **
+SortedFuncs(Sim *S, int *nump)
+{
+    SimFunc **list = (SimFunc **)calloc(S->numFuncs + 1, sizeof(SimFunc *));
+    int i, n = 0;
+
+    for (i = 0; i < S->numFuncs; i++) {
+        if (S->funcs[i].instrs) {
+            list[n++] = &S->funcs[i];
+        }
+    }
+    if (S->other.instrs) {
+        list[n++] = &S->other;
+    }
+    qsort(list, n, sizeof(SimFunc *), CmpFuncCycles);
+    *nump = n;
+    return list;
+}
+
+void
+SimReport(Sim *S, FILE *f, int verbose)
+{
+    uint32_t freq = ClockFreq(S);
+    SimFunc **list;
+    uint64_t total = 0;
+    int i, n;
+
+    fprintf(f, "flexsim: %llu cycles (%.3f ms at %.1f MHz), %llu instructions\n",
+            (unsigned long long)S->now, 1000.0 * S->now / freq, freq / 1e6,
+            (unsigned long long)S->instrs);
+    if (!verbose) return;
+    list = SortedFuncs(S, &n);
+    /* the cycles of all the cogs are added up */
+    for (i = 0; i < n; i++) {
+        total += list[i]->cycles;
+    }
+    fprintf(f, "  %-32s %4s %10s %12s %6s %12s\n", "function", "mem", "calls", "cycles", "%", "instrs");
+    for (i = 0; i < n; i++) {
+        SimFunc *F = list[i];
+        fprintf(f, "  %-32s %4s %10llu %12llu %5.1f%% %12llu\n", F->name,
+                F == &S->other ? "" : F->inCog ? "cog" : "hub",
+                (unsigned long long)F->calls, (unsigned long long)F->cycles,
+                total ? 100.0 * F->cycles / total : 0.0,
+                (unsigned long long)F->instrs);
+    }
+    free(list);
+}
+
+int
+SimWriteProfile(Sim *S, const char *fname)
+{
+    FILE *f = fopen(fname, "w");
+    SimFunc **list;
+    int i, n;
+
+    if (!f) {
+        perror(fname);
+        return 0;
+    }
+    list = SortedFuncs(S, &n);
+    fprintf(f, "{\n  \"cycles\": %llu,\n  \"instructions\": %llu,\n  \"clkfreq\": %u,\n  \"functions\": [",
+            (unsigned long long)S->now, (unsigned long long)S->instrs, (unsigned)ClockFreq(S));
+    for (i = 0; i < n; i++) {
+        SimFunc *F = list[i];
+        fprintf(f, "%s\n    {\"name\": \"%s\", \"memory\": \"%s\", \"calls\": %llu, \"cycles\": %llu, \"instructions\": %llu}",
+                i ? "," : "", F->name, F == &S->other ? "" : F->inCog ? "cog" : "hub",
+                (unsigned long long)F->calls, (unsigned long long)F->cycles,
+                (unsigned long long)F->instrs);
+    }
+    fprintf(f, "\n  ]\n}\n");
+    free(list);
+    fclose(f);
+    return 1;
+}
@@ -0,0 +1,196 @@
+/*
+ * Cycle counting simulator for Propeller 1 and 2 binaries
+ * Copyright 2024 Total Spectrum Software Inc.
+ * See the file COPYING for terms of use
+ */
+
+#ifndef SIM_H_
+#define SIM_H_
+
+#include <stdio.h>
+#include <stdint.h>
+
+#define SIM_NUMCOGS 8
+#define SIM_NUMLOCKS 16
+#define SIM_NUMPINS 64
+
+#define P1_HUBSIZE  0x10000     /* 32K RAM, and 32K of (empty) ROM */
+#define P2_HUBSIZE  0x80000
+
+/* a label from the listing file */
+typedef struct SimSymbol {
+    uint32_t addr;
+    const char *name;
+    uint32_t base;            /* cog labels: hub address of cog address 0 */
+    struct SimFunc *func;     /* non-NULL if this label starts a function */
+} SimSymbol;
+
+/* profile data for one function */
+typedef struct SimFunc {
+    const char *name;
+    uint32_t addr;
+    int inCog;
+    uint64_t calls;
+    uint64_t cycles;
+    uint64_t instrs;
+} SimFunc;
+
+/* one pending CORDIC result */
+typedef struct CordicResult {
+    uint64_t ready;
+    uint32_t x, y;
+} CordicResult;
+
+#define CORDIC_DEPTH 16
+
+typedef struct Cog {
+    int id;
+    int running;
+    uint64_t time;          /* clock at which the next instruction starts */
+    uint32_t pc;            /* P2: < 0x400 is cog/LUT, otherwise hub */
+    int c, z;
+    uint32_t regs[512];
+    uint32_t lut[512];
+
+    /* P1 */
+    uint32_t par;
+
+    /* P2 instruction prefixes */
+    uint32_t augsval, augdval;
+    int augs, augd;
+    uint32_t q;
+    int qset;               /* 1 after setq, 2 after setq2 */
+    int alt;                /* ALT_xxx bits for the next instruction */
+    uint32_t altd, alts, altr, altn, altnmask, altsval;
+
+    /* P2 hardware stack */
+    uint32_t stack[8];
+
+    /* P2 rep */
+    uint32_t repStart, repEnd, repCount;
+    int repActive, repForever;
+
+    /* P2 skip / skipf */
+    uint32_t skipMask;
+    int skipFast;
+    uint32_t skipStack[8];
+    int skipDepth;
+    uint32_t xbyteBase;
+
+    /* P2 FIFO, only the pointer is modelled */
+    uint32_t fifoPtr;
+
+    /* P2 CORDIC */
+    CordicResult cordic[CORDIC_DEPTH];
+    int cordicCount;
+    uint32_t qx, qy;
+    int qxUnread, qyUnread;
+
+    /* P2 events */
+    uint64_t ctEvent[3];
+    int ctFlag[3];
+    int atn;
+
+    /* where the cog's code was loaded from, to match up cog labels */
+    uint32_t loadBase;
+
+    /* profiling; the last symbol looked up covers [profLo, profHi) */
+    SimFunc *curfunc;
+    uint32_t lastProfAddr;
+    SimSymbol *profSym;
+    uint32_t profLo, profHi;
+    int profInCog;
+} Cog;
+
+/* state of one P2 smart pin */
+typedef struct SmartPin {
+    uint32_t mode, x, y, z;
+    uint64_t inTime;        /* IN goes high at this time */
+    uint64_t busyUntil;     /* transmitter busy until */
+} SmartPin;
+
+/* decoder for a bit banged serial line */
+typedef struct SerialDecoder {
+    int level;
+    int active;             /* receiving a character */
+    uint64_t start;         /* time of the start bit */
+    int bits;               /* data bits seen so far */
+    uint32_t data;
+    uint64_t bitTime;
+} SerialDecoder;
+
+typedef struct Sim {
+    int p2;
+    uint8_t *hub;
+    uint32_t hubmask;
+    uint32_t imageSize;
+    Cog cog[SIM_NUMCOGS];
+    uint64_t now;           /* time of the instruction being executed */
+    uint64_t maxCycles;
+    int done;
+    int exitStatus;
+    const char *error;
+
+    /* pins */
+    uint64_t pinOut;        /* combined outputs of all cogs */
+    uint64_t pinDir;
+    SmartPin smart[SIM_NUMPINS];
+    int txPin, rxPin;
+    uint32_t baud;
+    SerialDecoder txDecoder;
+    int sawFF, sawFF00;     /* for the 0xff 0x00 <status> exit sequence */
+
+    /* locks */
+    int lockUsed[SIM_NUMLOCKS];
+    int lockState[SIM_NUMLOCKS];
+
+    /* random numbers for getrnd and friends */
+    uint64_t rnd;
+
+    /* symbols: cog addresses (in longs) and hub addresses (in bytes) */
+    SimSymbol *cogSyms, *hubSyms;
+    int numCogSyms, numHubSyms;
+    SimFunc *funcs;
+    int numFuncs;
+    int lmmPcReg;           /* P1: cog address of the LMM pc, or -1 */
+    SimFunc other;          /* time outside any known function */
+
+    uint64_t instrs;
+    FILE *trace;            /* if non-NULL, log each instruction here */
+} Sim;
+
+/* sim.c */
+void SimInit(Sim *S, int p2);
+int SimLoadBinary(Sim *S, const char *fname);
+int SimGuessP2(const char *fname);
+int SimReadListing(Sim *S, const char *fname);
+void SimRun(Sim *S);
+void SimReport(Sim *S, FILE *f, int verbose);
+int SimWriteProfile(Sim *S, const char *fname);
+
+uint32_t SimRdLong(Sim *S, uint32_t addr);
+uint32_t SimRdWord(Sim *S, uint32_t addr);
+uint32_t SimRdByte(Sim *S, uint32_t addr);
+void SimWrLong(Sim *S, uint32_t addr, uint32_t val);
+void SimWrWord(Sim *S, uint32_t addr, uint32_t val);
+void SimWrByte(Sim *S, uint32_t addr, uint32_t val);
+
+void SimPinsChanged(Sim *S, uint64_t when);
+void SimSerialOut(Sim *S, int c);
+void SimUnimplemented(Sim *S, Cog *C, uint32_t instr);
+uint32_t SimRandom(Sim *S);
+Cog *SimFreeCog(Sim *S);
+void SimProfile(Sim *S, Cog *C, uint32_t addr, int inCog, uint64_t cycles);
+
+/* simp1.c */
+int P1Boot(Sim *S);
+void P1Step(Sim *S, Cog *C);
+uint32_t P1InA(Sim *S);
+
+/* simp2.c */
+int P2Boot(Sim *S);
+void P2Step(Sim *S, Cog *C);
+void P2StartCog(Sim *S, Cog *C, uint32_t addr, uint32_t ptra, int hubexec);
+int P2PinIn(Sim *S, int pin);
+
+#endif
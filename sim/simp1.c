@@ -0,0 +1,469 @@
+/*
+ * Cycle counting simulator: Propeller 1 cogs
+ *
+ * Instructions take 4 clocks, hub operations 8 plus the wait for the
+ * cog's hub slot, and a djnz/tjz/tjnz that does not branch takes 8.
+ * Counters, video, and the ROM Spin interpreter are not simulated.
+ *
+ * Copyright 2024 Total Spectrum Software Inc.
+ * See the file COPYING for terms of use
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "sim.h"
+
+#define REG_PAR  0x1f0
+#define REG_CNT  0x1f1
+#define REG_INA  0x1f2
+#define REG_OUTA 0x1f4
+#define REG_DIRA 0x1f6
+
+#define COG_LOAD_LONGS 496
+#define COG_START_TIME (COG_LOAD_LONGS * 16 + 16)
+
+static inline int
+Parity(uint32_t x)
+{
+    x ^= x >> 16;
+    x ^= x >> 8;
+    x ^= x >> 4;
+    x ^= x >> 2;
+    x ^= x >> 1;
+    return x & 1;
+}
+
+uint32_t
+P1InA(Sim *S)
+{
+    uint32_t dir = (uint32_t)S->pinDir;
+    uint32_t r = (uint32_t)S->pinOut & dir;
+
+    /* the serial receive line idles high */
+    if (!((dir >> S->rxPin) & 1)) {
+        r |= 1u << S->rxPin;
+    }
+    return r;
+}
+
+/* clocks to wait for the cog's hub slot, which comes around every 16 */
+static inline unsigned
+HubWait(Cog *C, uint64_t t)
+{
+    return (2 * C->id - (uint32_t)t) & 15;
+}
+
+static void
+StartCog(Sim *S, Cog *C, uint32_t code, uint32_t par)
+{
+    int i;
+    int id = C->id;
+
+    memset(C, 0, sizeof(*C));
+    C->id = id;
+    for (i = 0; i < COG_LOAD_LONGS; i++) {
+        C->regs[i] = SimRdLong(S, code + 4*i);
+    }
+    C->par = par;
+    C->loadBase = code;
+    C->running = 1;
+    C->time = S->now + COG_START_TIME;
+    C->lastProfAddr = 0xffffffff;
+    SimPinsChanged(S, S->now);
+}
+
+/*
+ * flexspin P1 binaries start with a one line Spin method that does
+ * coginit(0, @entry, 0); run what that would start
+ */
+int
+P1Boot(Sim *S)
+{
+    uint32_t pbase = SimRdWord(S, 6);
+    uint32_t code = pbase + SimRdWord(S, pbase + 4);
+    uint32_t off;
+    uint8_t *p = &S->hub[code & S->hubmask];
+    int n = 3;
+
+    if (p[0] != 0x35 || p[1] != 0xc7) {
+        goto notflex;
+    }
+    off = p[2];
+    if (off & 0x80) {
+        off = ((off & 0x7f) << 8) | p[3];
+        n++;
+    }
+    if (p[n] != 0x35 || p[n+1] != 0x2c || p[n+2] != 0x32) {
+        goto notflex;
+    }
+    StartCog(S, &S->cog[0], pbase + off, 0);
+    S->cog[0].time = 0;
+    return 1;
+notflex:
+    fprintf(stderr, "flexsim: this binary needs the Spin interpreter in ROM, which is not simulated\n");
+    return 0;
+}
+
+static inline uint32_t
+RdSrc(Sim *S, Cog *C, uint32_t r, uint64_t t)
+{
+    switch (r) {
+    case REG_PAR: return C->par;
+    case REG_CNT: return (uint32_t)t;
+    case REG_INA: return P1InA(S);
+    default: return C->regs[r];
+    }
+}
+
+static inline void
+WrReg(Sim *S, Cog *C, uint32_t r, uint32_t v)
+{
+    C->regs[r] = v;
+    if (r == REG_OUTA || r == REG_DIRA) {
+        SimPinsChanged(S, S->now);
+    }
+}
+
+static void
+HubOp(Sim *S, Cog *C, uint32_t d, uint32_t s, int wr, uint32_t *res, int *nc, int *nz)
+{
+    uint32_t v = C->regs[d];
+    Cog *N;
+    int i;
+
+    switch (s & 7) {
+    case 0: /* clkset */
+        break;
+    case 1: /* cogid */
+        *res = C->id;
+        break;
+    case 2: /* coginit */
+        if (v & 8) {
+            N = SimFreeCog(S);
+        } else {
+            N = &S->cog[v & 7];
+        }
+        if (!N) {
+            *nc = 1;
+            *res = 7;
+            break;
+        }
+        *nc = 0;
+        *res = N->id;
+        if (((v >> 2) & 0xfffc) >= 0x8000) {
+            fprintf(stderr, "flexsim: cog %d: starting the Spin interpreter in ROM is not supported\n", C->id);
+            S->error = "unsupported coginit";
+            S->done = 1;
+            break;
+        }
+        StartCog(S, N, (v >> 2) & 0xfffc, (v >> 16) & 0xfffc);
+        break;
+    case 3: /* cogstop */
+        S->cog[v & 7].running = 0;
+        SimPinsChanged(S, S->now);
+        break;
+    case 4: /* locknew */
+        *nc = 1;
+        for (i = 0; i < 8; i++) {
+            if (!S->lockUsed[i]) {
+                S->lockUsed[i] = 1;
+                *res = i;
+                *nc = 0;
+                break;
+            }
+        }
+        break;
+    case 5: /* lockret */
+        S->lockUsed[v & 7] = 0;
+        break;
+    case 6: /* lockset */
+        *nc = S->lockState[v & 7];
+        S->lockState[v & 7] = 1;
+        break;
+    default: /* lockclr */
+        *nc = S->lockState[v & 7];
+        S->lockState[v & 7] = 0;
+        break;
+    }
+    (void)wr;
+    *nz = *res == 0;
+}
+
+void
+P1Step(Sim *S, Cog *C)
+{
+    uint32_t pc = C->pc;
+    uint32_t instr = C->regs[pc];
+    uint32_t nextpc = (pc + 1) & 0x1ff;
+    uint32_t opc, cond, dfield, sfield;
+    uint32_t d, s, res, target;
+    uint64_t t0 = C->time;
+    uint64_t cost = 4;
+    uint64_t r64;
+    int wz, wc, wr, imm;
+    int nc, nz, n;
+
+    if (S->trace) {
+        fprintf(S->trace, "%llu: cog %d %03x %08x c=%d z=%d\n", (unsigned long long)t0, C->id,
+                (unsigned)pc, (unsigned)instr, C->c, C->z);
+    }
+    opc = instr >> 26;
+    wz = (instr >> 25) & 1;
+    wc = (instr >> 24) & 1;
+    wr = (instr >> 23) & 1;
+    imm = (instr >> 22) & 1;
+    cond = (instr >> 18) & 15;
+    dfield = (instr >> 9) & 0x1ff;
+    sfield = instr & 0x1ff;
+
+    if (!((cond >> (C->c * 2 + C->z)) & 1)) {
+        goto done;
+    }
+    s = imm ? sfield : RdSrc(S, C, sfield, t0);
+    d = C->regs[dfield];
+    res = d;
+    nc = C->c;
+    nz = C->z;
+    target = nextpc;
+
+    switch (opc) {
+    case 0x00: case 0x01: case 0x02: /* rd/wr byte, word, long */
+        cost = 8 + HubWait(C, t0);
+        if (wr) {
+            res = opc == 0 ? SimRdByte(S, s) : opc == 1 ? SimRdWord(S, s) : SimRdLong(S, s);
+        } else if (opc == 0) {
+            SimWrByte(S, s, d);
+        } else if (opc == 1) {
+            SimWrWord(S, s, d);
+        } else {
+            SimWrLong(S, s, d);
+        }
+        nz = res == 0;
+        break;
+    case 0x03:
+        cost = 8 + HubWait(C, t0);
+        HubOp(S, C, dfield, s, wr, &res, &nc, &nz);
+        if (!C->running) {
+            C->time = t0 + cost;
+            return;
+        }
+        break;
+    case 0x08: /* ror */
+        s &= 31;
+        res = s ? (d >> s) | (d << (32 - s)) : d;
+        nc = d & 1; nz = res == 0;
+        break;
+    case 0x09: /* rol */
+        s &= 31;
+        res = s ? (d << s) | (d >> (32 - s)) : d;
+        nc = d >> 31; nz = res == 0;
+        break;
+    case 0x0a: /* shr */
+        res = d >> (s & 31);
+        nc = d & 1; nz = res == 0;
+        break;
+    case 0x0b: /* shl */
+        res = d << (s & 31);
+        nc = d >> 31; nz = res == 0;
+        break;
+    case 0x0c: /* rcr */
+        s &= 31;
+        res = s ? (d >> s) | (C->c ? ~(0xffffffffu >> s) : 0) : d;
+        nc = d & 1; nz = res == 0;
+        break;
+    case 0x0d: /* rcl */
+        s &= 31;
+        res = s ? (d << s) | (C->c ? (1u << s) - 1 : 0) : d;
+        nc = d >> 31; nz = res == 0;
+        break;
+    case 0x0e: /* sar */
+        res = (uint32_t)((int32_t)d >> (s & 31));
+        nc = d & 1; nz = res == 0;
+        break;
+    case 0x0f: /* rev */
+        res = 0;
+        for (n = 0; n < 32; n++) res |= ((d >> n) & 1) << (31 - n);
+        res = (s & 31) ? res >> (s & 31) : res;
+        nc = d & 1; nz = res == 0;
+        break;
+    case 0x10: /* mins */
+        nc = (int32_t)d < (int32_t)s;
+        res = nc ? s : d;
+        nz = s == 0;
+        break;
+    case 0x11: /* maxs */
+        nc = (int32_t)d < (int32_t)s;
+        res = (int32_t)d > (int32_t)s ? s : d;
+        nz = s == 0;
+        break;
+    case 0x12: /* min */
+        nc = d < s;
+        res = nc ? s : d;
+        nz = s == 0;
+        break;
+    case 0x13: /* max */
+        nc = d < s;
+        res = d > s ? s : d;
+        nz = s == 0;
+        break;
+    case 0x14: /* movs */
+        res = (d & ~0x1ffu) | (s & 0x1ff);
+        nz = res == 0;
+        break;
+    case 0x15: /* movd */
+        res = (d & ~(0x1ffu << 9)) | ((s & 0x1ff) << 9);
+        nz = res == 0;
+        break;
+    case 0x16: /* movi */
+        res = (d & ~(0x1ffu << 23)) | ((s & 0x1ff) << 23);
+        nz = res == 0;
+        break;
+    case 0x17: /* jmpret */
+        res = (d & ~0x1ffu) | nextpc;
+        nz = res == 0;
+        target = s & 0x1ff;
+        break;
+    case 0x18: res = d & s; nc = Parity(res); nz = res == 0; break;
+    case 0x19: res = d & ~s; nc = Parity(res); nz = res == 0; break;
+    case 0x1a: res = d | s; nc = Parity(res); nz = res == 0; break;
+    case 0x1b: res = d ^ s; nc = Parity(res); nz = res == 0; break;
+    case 0x1c: case 0x1d: case 0x1e: case 0x1f: /* muxc, muxnc, muxz, muxnz */
+        n = (opc & 2) ? C->z : C->c;
+        if (opc & 1) n = !n;
+        res = (d & ~s) | (n ? s : 0);
+        nc = Parity(res); nz = res == 0;
+        break;
+    case 0x20: /* add */
+        r64 = (uint64_t)d + s;
+        res = r64; nc = (r64 >> 32) & 1; nz = res == 0;
+        break;
+    case 0x21: /* sub, cmp */
+        res = d - s; nc = d < s; nz = res == 0;
+        break;
+    case 0x22: /* addabs */
+    case 0x23: /* subabs */
+        n = (int32_t)s < 0;
+        if (n) s = -s;
+        if ((opc == 0x22) != n) {
+            r64 = (uint64_t)d + s;
+            res = r64; nc = (r64 >> 32) & 1;
+        } else {
+            res = d - s; nc = d < s;
+        }
+        nz = res == 0;
+        break;
+    case 0x24: case 0x25: case 0x26: case 0x27: /* sumc, sumnc, sumz, sumnz */
+        n = (opc & 2) ? C->z : C->c;
+        if (opc & 1) n = !n;
+        if (n) {
+            res = d - s;
+            nc = ((int64_t)(int32_t)d - (int32_t)s) != (int64_t)(int32_t)res;
+        } else {
+            res = d + s;
+            nc = ((int64_t)(int32_t)d + (int32_t)s) != (int64_t)(int32_t)res;
+        }
+        nz = res == 0;
+        break;
+    case 0x28: res = s; nc = s >> 31; nz = res == 0; break;                          /* mov */
+    case 0x29: res = -s; nc = s >> 31; nz = res == 0; break;                         /* neg */
+    case 0x2a: res = (int32_t)s < 0 ? -s : s; nc = s >> 31; nz = res == 0; break;    /* abs */
+    case 0x2b: res = (int32_t)s < 0 ? s : -s; nc = s >> 31; nz = res == 0; break;    /* absneg */
+    case 0x2c: case 0x2d: case 0x2e: case 0x2f: /* negc, negnc, negz, negnz */
+        n = (opc & 2) ? C->z : C->c;
+        if (opc & 1) n = !n;
+        res = n ? -s : s;
+        nc = s >> 31; nz = res == 0;
+        break;
+    case 0x30: /* cmps */
+        res = d - s;
+        nc = (int32_t)d < (int32_t)s; nz = d == s;
+        break;
+    case 0x31: /* cmpsx */
+        res = d - s - C->c;
+        nc = (int64_t)(int32_t)d < (int64_t)(int32_t)s + C->c;
+        nz = C->z && res == 0;
+        break;
+    case 0x32: /* addx */
+        r64 = (uint64_t)d + s + C->c;
+        res = r64; nc = (r64 >> 32) & 1; nz = C->z && res == 0;
+        break;
+    case 0x33: /* subx, cmpx */
+        res = d - s - C->c;
+        nc = (uint64_t)d < (uint64_t)s + C->c;
+        nz = C->z && res == 0;
+        break;
+    case 0x34: /* adds */
+        res = d + s;
+        nc = ((int64_t)(int32_t)d + (int32_t)s) != (int64_t)(int32_t)res;
+        nz = res == 0;
+        break;
+    case 0x35: /* subs */
+        res = d - s;
+        nc = ((int64_t)(int32_t)d - (int32_t)s) != (int64_t)(int32_t)res;
+        nz = res == 0;
+        break;
+    case 0x36: /* addsx */
+        res = d + s + C->c;
+        nc = ((int64_t)(int32_t)d + (int32_t)s + C->c) != (int64_t)(int32_t)res;
+        nz = C->z && res == 0;
+        break;
+    case 0x37: /* subsx */
+        res = d - s - C->c;
+        nc = ((int64_t)(int32_t)d - (int32_t)s - C->c) != (int64_t)(int32_t)res;
+        nz = C->z && res == 0;
+        break;
+    case 0x38: /* cmpsub */
+        nc = d >= s;
+        res = nc ? d - s : d;
+        nz = d == s;
+        break;
+    case 0x39: /* djnz */
+        res = d - 1;
+        nc = d == 0; nz = res == 0;
+        if (res != 0) target = s & 0x1ff; else cost = 8;
+        break;
+    case 0x3a: /* tjnz */
+        nc = 0; nz = d == 0;
+        if (d != 0) target = s & 0x1ff; else cost = 8;
+        break;
+    case 0x3b: /* tjz */
+        nc = 0; nz = d == 0;
+        if (d == 0) target = s & 0x1ff; else cost = 8;
+        break;
+    case 0x3c: /* waitpeq */
+    case 0x3d: /* waitpne */
+        if (((P1InA(S) & s) == d) != (opc == 0x3c)) {
+            /* not yet; look again later */
+            C->time = t0 + 4;
+            return;
+        }
+        cost = 6;
+        break;
+    case 0x3e: /* waitcnt */
+        res = d + s;
+        r64 = (uint32_t)(d - (uint32_t)(t0 + 6));
+        cost = 6 + r64;
+        nc = (uint64_t)d + s > 0xffffffff; nz = res == 0;
+        break;
+    case 0x3f: /* waitvid */
+        cost = 7;
+        break;
+    default:
+        SimUnimplemented(S, C, instr);
+        return;
+    }
+    if (wr) {
+        WrReg(S, C, dfield, res);
+    }
+    if (wc) C->c = nc;
+    if (wz) C->z = nz;
+    C->time = t0 + cost;
+    C->pc = target;
+    SimProfile(S, C, pc, 1, cost);
+    return;
+
+done:
+    C->time = t0 + cost;
+    C->pc = nextpc;
+    SimProfile(S, C, pc, 1, cost);
+}
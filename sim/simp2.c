@@ -0,0 +1,1649 @@
+/*
+ * Cycle counting simulator: Propeller 2 cogs
+ *
+ * Timing follows the Parallax P2 instruction timing table: 2 clocks per
+ * instruction, 4 for a branch in cog/LUT, 13 plus the hub slot for a
+ * branch into hub, and the egg beater slot wait on every hub access.
+ * Things that are not modelled: interrupts, the streamer, most smart
+ * pin modes (only async serial transmit is), and the FIFO refill delays.
+ *
+ * Copyright 2024 Total Spectrum Software Inc.
+ * See the file COPYING for terms of use
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "sim.h"
+
+#define NEVER ((uint64_t)-1)
+
+#define REG_PA   0x1f6
+#define REG_PB   0x1f7
+#define REG_PTRA 0x1f8
+#define REG_PTRB 0x1f9
+#define REG_DIRA 0x1fa
+#define REG_OUTA 0x1fc
+#define REG_INA  0x1fe
+#define REG_INB  0x1ff
+
+#define COG_LOAD_LONGS 496
+#define CORDIC_LATENCY 55
+
+/* what the last ALTxx instruction changes in the next one */
+#define ALT_D    0x01
+#define ALT_S    0x02
+#define ALT_R    0x04
+#define ALT_N    0x08
+#define ALT_SVAL 0x10
+
+/* smart pin modes we know about */
+#define SP_ASYNC_TX 0x1e
+
+static inline uint32_t
+SignExtend(uint32_t x, int bits)
+{
+    int shift = 32 - bits;
+    return (uint32_t)((int32_t)(x << shift) >> shift);
+}
+
+static inline int
+Parity(uint32_t x)
+{
+    x ^= x >> 16;
+    x ^= x >> 8;
+    x ^= x >> 4;
+    x ^= x >> 2;
+    x ^= x >> 1;
+    return x & 1;
+}
+
+static inline int
+Ones(uint32_t x)
+{
+    int n = 0;
+    while (x) {
+        n += x & 1;
+        x >>= 1;
+    }
+    return n;
+}
+
+static inline uint32_t
+Rotl(uint32_t x, unsigned n)
+{
+    n &= 31;
+    return n ? (x << n) | (x >> (32 - n)) : x;
+}
+
+/* clocks to wait for the hub slot of "addr" */
+static inline unsigned
+HubWait(Cog *C, uint64_t t, uint32_t addr)
+{
+    return ((addr >> 2) - (uint32_t)t - C->id) & 7;
+}
+
+/*
+ * pins
+ */
+int
+P2PinIn(Sim *S, int pin)
+{
+    SmartPin *P = &S->smart[pin & 63];
+
+    pin &= 63;
+    if (P->mode) {
+        return S->now >= P->inTime;
+    }
+    if ((S->pinDir >> pin) & 1) {
+        return (S->pinOut >> pin) & 1;
+    }
+    return pin == S->rxPin;
+}
+
+static uint32_t
+PinsIn(Sim *S, int base)
+{
+    uint32_t r = 0;
+    int i;
+
+    for (i = 0; i < 32; i++) {
+        r |= (uint32_t)P2PinIn(S, base + i) << i;
+    }
+    return r;
+}
+
+static void
+SmartWrite(Sim *S, int which, uint32_t val, uint32_t pins)
+{
+    int pin = pins & 63;
+    int count = (pins >> 6) & 31;
+    SmartPin *P;
+    uint64_t start, bit;
+    int nbits;
+
+    for (; count >= 0; count--, pin = (pin & 32) | ((pin + 1) & 31)) {
+        P = &S->smart[pin];
+        switch (which) {
+        case 0: /* wrpin */
+            P->mode = (val >> 1) & 0x1f;
+            break;
+        case 1: /* wxpin */
+            P->x = val;
+            break;
+        case 2: /* wypin */
+            P->y = val;
+            if (P->mode != SP_ASYNC_TX || !((S->pinDir >> pin) & 1)) {
+                break;
+            }
+            bit = P->x >> 16;
+            if (bit == 0) bit = 1;
+            nbits = (P->x & 31) + 1;
+            start = S->now > P->busyUntil ? S->now : P->busyUntil;
+            P->busyUntil = start + (nbits + 2) * bit;
+            /* the buffer is free again once the shifter takes the byte */
+            P->inTime = start + 1;
+            if (pin == S->txPin) {
+                SimSerialOut(S, val);
+            }
+            break;
+        default: /* akpin */
+            P->inTime = NEVER;
+            break;
+        }
+    }
+}
+
+/*
+ * registers
+ */
+static inline uint32_t
+RdReg(Sim *S, Cog *C, uint32_t r)
+{
+    r &= 0x1ff;
+    if (r >= REG_INA) {
+        return PinsIn(S, r == REG_INA ? 0 : 32);
+    }
+    return C->regs[r];
+}
+
+static inline void
+WrReg(Sim *S, Cog *C, uint32_t r, uint32_t v)
+{
+    r &= 0x1ff;
+    C->regs[r] = v;
+    if (r >= REG_DIRA && r < REG_INA) {
+        SimPinsChanged(S, S->now);
+    }
+}
+
+static void
+Push(Cog *C, uint32_t v)
+{
+    memmove(&C->stack[1], &C->stack[0], 7 * sizeof(uint32_t));
+    C->stack[0] = v;
+}
+
+static uint32_t
+Pop(Cog *C)
+{
+    uint32_t v = C->stack[0];
+    memmove(&C->stack[0], &C->stack[1], 7 * sizeof(uint32_t));
+    return v;
+}
+
+/*
+ * CORDIC: results come back in order, CORDIC_LATENCY clocks after the
+ * command went in; a new command makes the result we are holding stale,
+ * so a following GETQX/GETQY waits for the new one
+ */
+static void
+CordicPush(Cog *C, uint64_t when, uint32_t x, uint32_t y)
+{
+    C->qxUnread = C->qyUnread = 0;
+    if (C->cordicCount == CORDIC_DEPTH) {
+        memmove(&C->cordic[0], &C->cordic[1], (CORDIC_DEPTH-1) * sizeof(CordicResult));
+        C->cordicCount--;
+    }
+    C->cordic[C->cordicCount].ready = when + CORDIC_LATENCY;
+    C->cordic[C->cordicCount].x = x;
+    C->cordic[C->cordicCount].y = y;
+    C->cordicCount++;
+}
+
+/* clocks spent waiting for the next CORDIC result, which is then current */
+static uint64_t
+CordicWait(Cog *C, uint64_t t)
+{
+    uint64_t wait = 0;
+
+    if (C->cordicCount == 0) {
+        return 0;
+    }
+    if (C->cordic[0].ready > t) {
+        wait = C->cordic[0].ready - t;
+    }
+    C->qx = C->cordic[0].x;
+    C->qy = C->cordic[0].y;
+    C->qxUnread = C->qyUnread = 1;
+    C->cordicCount--;
+    memmove(&C->cordic[0], &C->cordic[1], C->cordicCount * sizeof(CordicResult));
+    return wait;
+}
+
+/*
+ * xoroshiro32++: two iterations of the 16 bit generator in *state, giving
+ * one 32 bit result
+ */
+static inline uint16_t
+Rotl16(uint16_t x, int k)
+{
+    return (uint16_t)((x << k) | (x >> (16 - k)));
+}
+
+static uint32_t
+Xoro32(uint32_t *newstate, uint32_t state)
+{
+    uint16_t s0 = state, s1 = state >> 16;
+    uint32_t r = 0;
+    int i;
+
+    for (i = 0; i < 2; i++) {
+        r |= (uint32_t)(uint16_t)(Rotl16(s0 + s1, 9) + s0) << (16 * i);
+        s1 ^= s0;
+        s0 = Rotl16(s0, 13) ^ s1 ^ (uint16_t)(s1 << 5);
+        s1 = Rotl16(s1, 10);
+    }
+    *newstate = s0 | ((uint32_t)s1 << 16);
+    return r;
+}
+
+static uint32_t
+IntSqrt(uint64_t x)
+{
+    uint64_t r = (uint64_t)sqrt((double)x);
+
+    while (r * r > x) r--;
+    while ((r + 1) * (r + 1) <= x) r++;
+    return (uint32_t)r;
+}
+
+static void
+CordicDiv(Cog *C, uint64_t when, uint64_t num, uint32_t den)
+{
+    if (den == 0) {
+        CordicPush(C, when, 0xffffffff, (uint32_t)num);
+    } else {
+        CordicPush(C, when, (uint32_t)(num / den), (uint32_t)(num % den));
+    }
+}
+
+/*
+ * start a cog, either loading it from "addr" or running from there in
+ * hub exec
+ */
+void
+P2StartCog(Sim *S, Cog *C, uint32_t addr, uint32_t ptra, int hubexec)
+{
+    int i;
+    int id = C->id;
+    uint32_t lut[512];
+
+    memcpy(lut, C->lut, sizeof(lut));
+    memset(C, 0, sizeof(*C));
+    C->id = id;
+    memcpy(C->lut, lut, sizeof(lut));
+    addr &= 0xfffff;
+    if (hubexec) {
+        C->pc = addr;
+        C->time = S->now + 16;
+    } else {
+        for (i = 0; i < COG_LOAD_LONGS; i++) {
+            C->regs[i] = SimRdLong(S, addr + 4*i);
+        }
+        C->pc = 0;
+        C->time = S->now + COG_LOAD_LONGS + 16;
+    }
+    C->loadBase = addr;
+    C->regs[REG_PTRA] = ptra;
+    C->regs[REG_PTRB] = addr;
+    C->running = 1;
+    C->lastProfAddr = 0xffffffff;
+    SimPinsChanged(S, S->now);
+}
+
+int
+P2Boot(Sim *S)
+{
+    P2StartCog(S, &S->cog[0], 0, 0, 0);
+    S->cog[0].time = 0;
+    return 1;
+}
+
+/*
+ * work out the hub address of a rd/wr instruction, updating PTRA/PTRB
+ * as required; "scale" is the access size, "count" the number of longs
+ * for a setq burst
+ */
+static uint32_t
+HubAddr(Cog *C, int imm, uint32_t sfield, uint32_t sreg, int scale, int count)
+{
+    uint32_t v, ptr, addr;
+    int32_t idx;
+    int reg, update, post;
+
+    if (!imm) {
+        return sreg;
+    }
+    if (C->augs) {
+        C->augs = 0;
+        v = C->augsval | sfield;
+        if (!(v & 0x800000)) {
+            return v;
+        }
+        reg = (v & 0x400000) ? REG_PTRB : REG_PTRA;
+        update = (v >> 21) & 1;
+        post = (v >> 20) & 1;
+        idx = (int32_t)SignExtend(v & 0xfffff, 20);
+    } else {
+        if (!(sfield & 0x100)) {
+            return sfield;
+        }
+        reg = (sfield & 0x80) ? REG_PTRB : REG_PTRA;
+        update = (sfield >> 6) & 1;
+        post = (sfield >> 5) & 1;
+        if (update) {
+            idx = (int32_t)SignExtend(sfield & 0x1f, 5);
+            if (idx == 0) idx = 16;
+        } else {
+            idx = (int32_t)SignExtend(sfield & 0x3f, 6);
+        }
+        idx *= scale;
+    }
+    ptr = C->regs[reg];
+    if (!update) {
+        return ptr + idx;
+    }
+    if (count > 1) {
+        idx *= count;
+    }
+    if (post) {
+        addr = ptr;
+    } else {
+        addr = ptr + idx;
+    }
+    C->regs[reg] = ptr + idx;
+    return addr;
+}
+
+/* read a variable length value from the FIFO */
+static uint32_t
+FifoVar(Sim *S, Cog *C, int sign)
+{
+    uint32_t v = 0, b;
+    int shift = 0, i;
+
+    for (i = 0; i < 4; i++) {
+        b = SimRdByte(S, C->fifoPtr++);
+        if (i == 3) {
+            v |= b << shift;
+            shift += 8;
+            break;
+        }
+        v |= (b & 0x7f) << shift;
+        shift += 7;
+        if (!(b & 0x80)) break;
+    }
+    if (sign && shift < 32) {
+        v = SignExtend(v, shift);
+    }
+    return v;
+}
+
+static int
+PinFlagValue(Sim *S, Cog *C, int k, int cur)
+{
+    switch (k) {
+    case 0: return 0;
+    case 1: return 1;
+    case 2: return C->c;
+    case 3: return !C->c;
+    case 4: return C->z;
+    case 5: return !C->z;
+    case 6: return SimRandom(S) & 1;
+    default: return !cur;
+    }
+}
+
+/* DIRxx/OUTxx/FLTxx/DRVxx */
+static void
+PinOp(Sim *S, Cog *C, int group, int k, uint32_t pins)
+{
+    int pin = pins & 63;
+    int count = (pins >> 6) & 31;
+    uint32_t *dir, *out, bit;
+    int v;
+
+    for (; count >= 0; count--, pin = (pin & 32) | ((pin + 1) & 31)) {
+        dir = &C->regs[REG_DIRA + (pin >> 5)];
+        out = &C->regs[REG_OUTA + (pin >> 5)];
+        bit = 1u << (pin & 31);
+        if (group == 0) {
+            v = PinFlagValue(S, C, k, (*dir & bit) != 0);
+            *dir = v ? (*dir | bit) : (*dir & ~bit);
+        } else {
+            v = PinFlagValue(S, C, k, (*out & bit) != 0);
+            *out = v ? (*out | bit) : (*out & ~bit);
+            if (group == 2) *dir &= ~bit;
+            if (group == 3) *dir |= bit;
+        }
+    }
+    SimPinsChanged(S, S->now);
+}
+
+static int
+EventFlag(Sim *S, Cog *C, int ev)
+{
+    int r = 0;
+    (void)S;
+
+    switch (ev) {
+    case 1: case 2: case 3:
+        if (!C->ctFlag[ev-1] && C->ctEvent[ev-1] && C->time >= C->ctEvent[ev-1]) {
+            C->ctFlag[ev-1] = 1;
+        }
+        r = C->ctFlag[ev-1];
+        C->ctFlag[ev-1] = 0;
+        break;
+    case 14:
+        r = C->atn;
+        C->atn = 0;
+        break;
+    case 15:
+        r = C->cordicCount == 0 && !C->qxUnread && !C->qyUnread;
+        break;
+    default:
+        break;
+    }
+    return r;
+}
+
+void
+P2Step(Sim *S, Cog *C)
+{
+    uint32_t pc = C->pc;
+    uint32_t instr, nextpc, target;
+    uint32_t opc, cond, dfield, sfield, rfield;
+    uint32_t d, s, res, addr, v;
+    uint64_t t0 = C->time;
+    uint64_t cost = 2;
+    uint64_t r64;
+    int hubexec = pc >= 0x400;
+    int wc, wz, imm, L;
+    int nc, nz;
+    int write = 0, branched = 0;
+    int alt, qset, n, i, count;
+    double a, x, y;
+
+    if (pc < 0x200) {
+        instr = C->regs[pc];
+    } else if (pc < 0x400) {
+        instr = C->lut[pc - 0x200];
+    } else {
+        instr = SimRdLong(S, pc);
+    }
+    nextpc = hubexec ? pc + 4 : pc + 1;
+    if (S->trace) {
+        fprintf(S->trace, "%llu: cog %d %05x %08x c=%d z=%d d=%08x\n", (unsigned long long)t0, C->id,
+                (unsigned)pc, (unsigned)instr, C->c, C->z, (unsigned)C->regs[(instr >> 9) & 0x1ff]);
+    }
+
+    /* skipped instructions */
+    if (C->skipMask) {
+        int skip = C->skipMask & 1;
+        C->skipMask >>= 1;
+        if (skip) {
+            cost = (C->skipFast && !hubexec) ? 0 : 2;
+            goto done;
+        }
+    }
+
+    if (instr == 0) {
+        /* nop, which would otherwise be "_ret_ ror 0, 0" */
+        goto done;
+    }
+    cond = instr >> 28;
+    opc = (instr >> 21) & 0x7f;
+    alt = C->alt;
+    qset = C->qset;
+    if (opc < 0x78) {
+        C->qset = 0;
+    }
+    if (!(cond == 0 || ((cond >> (C->c * 2 + C->z)) & 1))) {
+        /* condition false: the instruction still uses up any ALTxx */
+        C->alt = 0;
+        goto done;
+    }
+    C->alt = 0;
+    if (alt & ALT_D) instr = (instr & ~(0x1ff << 9)) | (C->altd << 9);
+    if (alt & ALT_S) instr = (instr & ~0x1ff) | C->alts;
+    if (alt & ALT_N) instr = (instr & ~(C->altnmask << 19)) | (C->altn << 19);
+
+    wc = (instr >> 20) & 1;
+    wz = (instr >> 19) & 1;
+    imm = (instr >> 18) & 1;
+    L = wz;
+    dfield = (instr >> 9) & 0x1ff;
+    sfield = instr & 0x1ff;
+    rfield = (alt & ALT_R) ? C->altr : dfield;
+
+    /* S operand for the two operand instructions */
+    if (opc >= 0x78) {
+        s = 0;
+    } else if (alt & ALT_SVAL) {
+        s = C->altsval;
+        if (imm && C->augs) C->augs = 0;
+    } else if (imm) {
+        /* hub reads and writes decode #S themselves */
+        int hubop = (opc >= 0x56 && opc <= 0x58) || opc == 0x62 || (opc == 0x63 && !wc) || (opc == 0x53 && wc && wz);
+        if (C->augs && !hubop && opc < 0x6b) {
+            s = C->augsval | sfield;
+            C->augs = 0;
+        } else {
+            s = sfield;
+        }
+    } else {
+        s = RdReg(S, C, sfield);
+    }
+    d = RdReg(S, C, dfield);
+    nc = C->c;
+    nz = C->z;
+    res = d;
+
+    if (opc < 0x40) {
+        unsigned sh = s & 31;
+        write = 1;
+        switch (opc) {
+        case 0x00: /* ror */
+            res = sh ? (d >> sh) | (d << (32 - sh)) : d;
+            nc = sh ? (d >> (sh - 1)) & 1 : d & 1;
+            nz = res == 0;
+            break;
+        case 0x01: /* rol */
+            res = sh ? (d << sh) | (d >> (32 - sh)) : d;
+            nc = sh ? (d >> (32 - sh)) & 1 : d >> 31;
+            nz = res == 0;
+            break;
+        case 0x02: /* shr */
+            res = d >> sh;
+            nc = sh ? (d >> (sh - 1)) & 1 : d & 1;
+            nz = res == 0;
+            break;
+        case 0x03: /* shl */
+            res = d << sh;
+            nc = sh ? (d >> (32 - sh)) & 1 : d >> 31;
+            nz = res == 0;
+            break;
+        case 0x04: /* rcr */
+            res = sh ? (d >> sh) | (C->c ? ~(0xffffffffu >> sh) : 0) : d;
+            nc = sh ? (d >> (sh - 1)) & 1 : d & 1;
+            nz = res == 0;
+            break;
+        case 0x05: /* rcl */
+            res = sh ? (d << sh) | (C->c ? (1u << sh) - 1 : 0) : d;
+            nc = sh ? (d >> (32 - sh)) & 1 : d >> 31;
+            nz = res == 0;
+            break;
+        case 0x06: /* sar */
+            res = (uint32_t)((int32_t)d >> sh);
+            nc = sh ? (d >> (sh - 1)) & 1 : d & 1;
+            nz = res == 0;
+            break;
+        case 0x07: /* sal */
+            res = sh ? (d << sh) | ((d & 1) ? (1u << sh) - 1 : 0) : d;
+            nc = sh ? (d >> (32 - sh)) & 1 : d >> 31;
+            nz = res == 0;
+            break;
+        case 0x08: /* add */
+            r64 = (uint64_t)d + s;
+            res = r64; nc = (r64 >> 32) & 1; nz = res == 0;
+            break;
+        case 0x09: /* addx */
+            r64 = (uint64_t)d + s + C->c;
+            res = r64; nc = (r64 >> 32) & 1; nz = C->z && res == 0;
+            break;
+        case 0x0a: /* adds */
+            res = d + s;
+            nc = ((int64_t)(int32_t)d + (int32_t)s) < 0;
+            nz = res == 0;
+            break;
+        case 0x0b: /* addsx */
+            res = d + s + C->c;
+            nc = ((int64_t)(int32_t)d + (int32_t)s + C->c) < 0;
+            nz = C->z && res == 0;
+            break;
+        case 0x0c: /* sub */
+        case 0x10: /* cmp */
+            res = d - s; nc = d < s; nz = res == 0;
+            write = opc == 0x0c;
+            break;
+        case 0x0d: /* subx */
+        case 0x11: /* cmpx */
+            res = d - s - C->c;
+            nc = (uint64_t)d < (uint64_t)s + C->c;
+            nz = C->z && res == 0;
+            write = opc == 0x0d;
+            break;
+        case 0x0e: /* subs */
+        case 0x12: /* cmps */
+            res = d - s;
+            nc = ((int64_t)(int32_t)d - (int32_t)s) < 0;
+            nz = res == 0;
+            write = opc == 0x0e;
+            break;
+        case 0x0f: /* subsx */
+        case 0x13: /* cmpsx */
+            res = d - s - C->c;
+            nc = ((int64_t)(int32_t)d - (int32_t)s - C->c) < 0;
+            nz = C->z && res == 0;
+            write = opc == 0x0f;
+            break;
+        case 0x14: /* cmpr */
+            res = s - d; nc = s < d; nz = res == 0; write = 0;
+            break;
+        case 0x15: /* cmpm */
+            res = d - s; nc = res >> 31; nz = res == 0; write = 0;
+            break;
+        case 0x16: /* subr */
+            res = s - d; nc = s < d; nz = res == 0;
+            break;
+        case 0x17: /* cmpsub */
+            if (d >= s) { res = d - s; nc = 1; } else { res = d; nc = 0; }
+            nz = res == 0;
+            break;
+        case 0x18: /* fge */
+            if (d < s) { res = s; nc = 1; } else { res = d; nc = 0; }
+            nz = res == 0;
+            break;
+        case 0x19: /* fle */
+            if (d > s) { res = s; nc = 1; } else { res = d; nc = 0; }
+            nz = res == 0;
+            break;
+        case 0x1a: /* fges */
+            if ((int32_t)d < (int32_t)s) { res = s; nc = 1; } else { res = d; nc = 0; }
+            nz = res == 0;
+            break;
+        case 0x1b: /* fles */
+            if ((int32_t)d > (int32_t)s) { res = s; nc = 1; } else { res = d; nc = 0; }
+            nz = res == 0;
+            break;
+        case 0x1c: /* sumc */
+        case 0x1d: /* sumnc */
+        case 0x1e: /* sumz */
+        case 0x1f: /* sumnz */
+            n = (opc & 2) ? C->z : C->c;
+            if (opc & 1) n = !n;
+            if (n) {
+                res = d - s;
+                nc = ((int64_t)(int32_t)d - (int32_t)s) < 0;
+            } else {
+                res = d + s;
+                nc = ((int64_t)(int32_t)d + (int32_t)s) < 0;
+            }
+            nz = res == 0;
+            break;
+        case 0x20: case 0x21: case 0x22: case 0x23:
+        case 0x24: case 0x25: case 0x26: case 0x27:
+            if (wc != wz) {
+                /* testb and friends */
+                int bit = (d >> (s & 31)) & 1;
+                int *flag = wc ? &C->c : &C->z;
+                n = opc & 7;
+                if (n & 1) bit = !bit;
+                switch (n >> 1) {
+                case 0: *flag = bit; break;
+                case 1: *flag &= bit; break;
+                case 2: *flag |= bit; break;
+                default: *flag ^= bit; break;
+                }
+                write = 0;
+                wc = wz = 0;
+            } else {
+                unsigned cnt = (s >> 5) & 31;
+                uint32_t mask = Rotl(cnt == 31 ? 0xffffffff : (2u << cnt) - 1, sh);
+                nc = nz = (d >> sh) & 1;
+                switch (opc) {
+                case 0x20: res = d & ~mask; break;
+                case 0x21: res = d | mask; break;
+                case 0x22: res = C->c ? d | mask : d & ~mask; break;
+                case 0x23: res = !C->c ? d | mask : d & ~mask; break;
+                case 0x24: res = C->z ? d | mask : d & ~mask; break;
+                case 0x25: res = !C->z ? d | mask : d & ~mask; break;
+                case 0x26: res = (d & ~mask) | (SimRandom(S) & mask); break;
+                default: res = d ^ mask; break;
+                }
+            }
+            break;
+        case 0x28: res = d & s; nc = Parity(res); nz = res == 0; break;
+        case 0x29: res = d & ~s; nc = Parity(res); nz = res == 0; break;
+        case 0x2a: res = d | s; nc = Parity(res); nz = res == 0; break;
+        case 0x2b: res = d ^ s; nc = Parity(res); nz = res == 0; break;
+        case 0x2c: case 0x2d: case 0x2e: case 0x2f: /* muxc, muxnc, muxz, muxnz */
+            n = (opc & 2) ? C->z : C->c;
+            if (opc & 1) n = !n;
+            res = (d & ~s) | (n ? s : 0);
+            nc = Parity(res); nz = res == 0;
+            break;
+        case 0x30: res = s; nc = s >> 31; nz = res == 0; break;
+        case 0x31: res = ~s; nc = res >> 31; nz = res == 0; break;
+        case 0x32: res = ((int32_t)s < 0) ? -s : s; nc = s >> 31; nz = res == 0; break;
+        case 0x33: res = -s; nc = res >> 31; nz = res == 0; break;
+        case 0x34: case 0x35: case 0x36: case 0x37: /* negc, negnc, negz, negnz */
+            n = (opc & 2) ? C->z : C->c;
+            if (opc & 1) n = !n;
+            res = n ? -s : s;
+            nc = res >> 31; nz = res == 0;
+            break;
+        case 0x38: /* incmod */
+            if (d == s) { res = 0; nc = 1; } else { res = d + 1; nc = 0; }
+            nz = res == 0;
+            break;
+        case 0x39: /* decmod */
+            if (d == 0) { res = s; nc = 1; } else { res = d - 1; nc = 0; }
+            nz = res == 0;
+            break;
+        case 0x3a: /* zerox */
+            res = sh == 31 ? d : d & ((2u << sh) - 1);
+            nc = (res >> sh) & 1; nz = res == 0;
+            break;
+        case 0x3b: /* signx */
+            res = SignExtend(d, sh + 1);
+            nc = res >> 31; nz = res == 0;
+            break;
+        case 0x3c: /* encod */
+            res = 0;
+            for (n = 31; n >= 0; n--) {
+                if ((s >> n) & 1) { res = n; break; }
+            }
+            nc = s != 0; nz = res == 0;
+            break;
+        case 0x3d: /* ones */
+            res = Ones(s); nc = res & 1; nz = res == 0;
+            break;
+        case 0x3e: /* test */
+            res = d & s; nc = Parity(res); nz = res == 0; write = 0;
+            break;
+        default: /* testn */
+            res = d & ~s; nc = Parity(res); nz = res == 0; write = 0;
+            break;
+        }
+        goto setflags;
+    }
+
+    switch (opc) {
+    case 0x40: case 0x41: /* setnib */
+        n = ((instr >> 19) & 7) * 4;
+        res = (d & ~(0xfu << n)) | ((s & 0xf) << n);
+        write = 1; wc = wz = 0;
+        break;
+    case 0x42: case 0x43: /* getnib */
+        n = ((instr >> 19) & 7) * 4;
+        res = (s >> n) & 0xf;
+        write = 1; wc = wz = 0;
+        break;
+    case 0x44: case 0x45: /* rolnib */
+        n = ((instr >> 19) & 7) * 4;
+        res = (d << 4) | ((s >> n) & 0xf);
+        write = 1; wc = wz = 0;
+        break;
+    case 0x46: /* setbyte */
+        n = ((instr >> 19) & 3) * 8;
+        res = (d & ~(0xffu << n)) | ((s & 0xff) << n);
+        write = 1; wc = wz = 0;
+        break;
+    case 0x47: /* getbyte */
+        n = ((instr >> 19) & 3) * 8;
+        res = (s >> n) & 0xff;
+        write = 1; wc = wz = 0;
+        break;
+    case 0x48: /* rolbyte */
+        n = ((instr >> 19) & 3) * 8;
+        res = (d << 8) | ((s >> n) & 0xff);
+        write = 1; wc = wz = 0;
+        break;
+    case 0x49: /* setword, getword */
+        n = wz * 16;
+        if (wc) {
+            res = (s >> n) & 0xffff;
+        } else {
+            res = (d & ~(0xffffu << n)) | ((s & 0xffff) << n);
+        }
+        write = 1; wc = wz = 0;
+        break;
+    case 0x4a:
+        if (!wc) {
+            /* rolword */
+            res = (d << 16) | ((s >> (wz * 16)) & 0xffff);
+            write = 1; wc = wz = 0;
+            break;
+        }
+        /* altsn, altgn */
+        C->altn = d & 7;
+        C->altnmask = 7;
+        v = ((d >> 3) + s) & 0x1ff;
+        if (wz) { C->alts = v; C->alt = ALT_S | ALT_N; }
+        else { C->altd = v; C->alt = ALT_D | ALT_N; }
+        goto altdone;
+    case 0x4b: /* altsb, altgb, altsw, altgw */
+        if (wc) {
+            C->altn = d & 1;
+            C->altnmask = 1;
+            v = ((d >> 1) + s) & 0x1ff;
+        } else {
+            C->altn = d & 3;
+            C->altnmask = 3;
+            v = ((d >> 2) + s) & 0x1ff;
+        }
+        if (wz) { C->alts = v; C->alt = ALT_S | ALT_N; }
+        else { C->altd = v; C->alt = ALT_D | ALT_N; }
+        goto altdone;
+    case 0x4c: /* altr, altd, alts, altb */
+        switch (wc * 2 + wz) {
+        case 0: C->altr = (d + s) & 0x1ff; C->alt = ALT_R; break;
+        case 1: C->altd = (d + s) & 0x1ff; C->alt = ALT_D; break;
+        case 2: C->alts = (d + s) & 0x1ff; C->alt = ALT_S; break;
+        default: C->altd = ((d >> 5) + s) & 0x1ff; C->alt = ALT_D; break;
+        }
+    altdone:
+        /* keep the SCA result if there was one */
+        C->alt |= alt & ALT_SVAL;
+        if (!imm) {
+            WrReg(S, C, dfield, d + SignExtend((s >> 9) & 0x1ff, 9));
+        }
+        wc = wz = 0;
+        break;
+    case 0x4d: /* alti, setr, setd, sets */
+        switch (wc * 2 + wz) {
+        case 0: SimUnimplemented(S, C, instr); return;
+        case 1: res = (d & ~(0x1ffu << 19)) | ((s & 0x1ff) << 19); break;
+        case 2: res = (d & ~(0x1ffu << 9)) | ((s & 0x1ff) << 9); break;
+        default: res = (d & ~0x1ffu) | (s & 0x1ff); break;
+        }
+        write = 1; wc = wz = 0;
+        break;
+    case 0x4e: /* decod, bmask, crcbit, crcnib */
+        switch (wc * 2 + wz) {
+        case 0: res = 1u << (s & 31); break;
+        case 1: res = (s & 31) == 31 ? 0xffffffff : (2u << (s & 31)) - 1; break;
+        default: SimUnimplemented(S, C, instr); return;
+        }
+        write = 1; wc = wz = 0;
+        break;
+    case 0x4f: /* muxnits, muxnibs, muxq, movbyts */
+        switch (wc * 2 + wz) {
+        case 2:
+            res = (d & ~C->q) | (s & C->q);
+            break;
+        case 3:
+            res = 0;
+            for (n = 0; n < 4; n++) {
+                res |= ((d >> (8 * ((s >> (2*n)) & 3))) & 0xff) << (8*n);
+            }
+            break;
+        default:
+            res = d;
+            for (n = 0; n < 32; n += (wz ? 4 : 2)) {
+                uint32_t m = (wz ? 0xfu : 0x3u) << n;
+                if (s & m) res = (res & ~m) | (s & m);
+            }
+            break;
+        }
+        write = 1; wc = wz = 0;
+        break;
+    case 0x50: /* mul, muls */
+        if (wc) {
+            res = (uint32_t)((int32_t)(int16_t)d * (int32_t)(int16_t)s);
+        } else {
+            res = (d & 0xffff) * (s & 0xffff);
+        }
+        nz = res == 0;
+        write = 1; wc = 0;
+        break;
+    case 0x51: /* sca, scas */
+        if (wc) {
+            v = (uint32_t)(((int32_t)(int16_t)d * (int32_t)(int16_t)s) >> 14);
+        } else {
+            v = ((d & 0xffff) * (s & 0xffff)) >> 16;
+        }
+        C->altsval = v;
+        C->alt = (alt & ~ALT_SVAL) | ALT_SVAL;
+        nz = v == 0;
+        wc = 0;
+        break;
+    case 0x53:
+        if (wc && wz) {
+            /* wmlong */
+            addr = HubAddr(C, imm, sfield, s, 4, 1) & 0xfffff;
+            for (n = 0; n < 4; n++) {
+                if ((d >> (8*n)) & 0xff) SimWrByte(S, addr + n, d >> (8*n));
+            }
+            cost = 3 + HubWait(C, t0, addr);
+            wc = wz = 0;
+            break;
+        }
+        /* addct1..3 */
+        n = wc * 2 + wz;
+        res = d + s;
+        C->ctEvent[n] = t0 + (uint32_t)(res - (uint32_t)t0);
+        if (C->ctEvent[n] <= t0) C->ctEvent[n] = t0 + 1;
+        C->ctFlag[n] = 0;
+        write = 1; wc = wz = 0;
+        break;
+    case 0x54: /* rqpin, rdpin */
+        {
+            SmartPin *P = &S->smart[s & 63];
+            if (P->mode == SP_ASYNC_TX) {
+                res = S->now < P->busyUntil ? 0x80000000 : 0;
+            } else {
+                res = P->z;
+            }
+            nc = res >> 31;
+            if (wz) {
+                P->inTime = NEVER;
+            }
+        }
+        write = 1; wz = 0;
+        break;
+    case 0x55: /* rdlut */
+        if (imm && sfield == 0x100) {
+            SimUnimplemented(S, C, instr);
+            return;
+        }
+        res = C->lut[s & 0x1ff];
+        nc = res >> 31; nz = res == 0;
+        write = 1;
+        cost = 3;
+        break;
+    case 0x56: case 0x57: case 0x58: /* rdbyte, rdword, rdlong */
+        count = (opc == 0x58 && qset) ? (C->q & 0x1ff) + 1 : 1;
+        n = opc == 0x56 ? 1 : opc == 0x57 ? 2 : 4;
+        addr = HubAddr(C, imm, sfield, s, n, count) & 0xfffff;
+        cost = 9 + HubWait(C, t0, addr) + (hubexec ? 5 : 0);
+        if (count > 1) {
+            for (i = 0; i < count; i++) {
+                v = SimRdLong(S, addr + 4*i);
+                if (qset == 2) C->lut[(rfield + i) & 0x1ff] = v;
+                else WrReg(S, C, rfield + i, v);
+            }
+            cost += count - 1;
+            wc = wz = 0;
+            break;
+        }
+        if (n == 1) { res = SimRdByte(S, addr); nc = (res >> 7) & 1; }
+        else if (n == 2) { res = SimRdWord(S, addr); nc = (res >> 15) & 1; }
+        else { res = SimRdLong(S, addr); nc = res >> 31; }
+        nz = res == 0;
+        write = 1;
+        break;
+    case 0x59: /* calld */
+        WrReg(S, C, rfield, ((uint32_t)C->c << 31) | ((uint32_t)C->z << 30) | nextpc);
+        if (imm) {
+            target = nextpc + (hubexec ? 4 * SignExtend(sfield, 9) : SignExtend(sfield, 9));
+        } else {
+            target = s;
+            nc = s >> 31;
+            nz = (s >> 30) & 1;
+        }
+        if (imm) wc = wz = 0;
+        branched = 1;
+        goto setflags;
+    case 0x5a: /* callpa, callpb */
+        WrReg(S, C, wc ? REG_PB : REG_PA, L ? (C->augd ? C->augdval | dfield : dfield) : d);
+        C->augd = 0;
+        Push(C, ((uint32_t)C->c << 31) | ((uint32_t)C->z << 30) | nextpc);
+        target = imm ? nextpc + (hubexec ? 4 * SignExtend(sfield, 9) : SignExtend(sfield, 9)) : s;
+        if (C->skipMask && C->skipDepth < 8) {
+            C->skipStack[C->skipDepth++] = C->skipMask;
+            C->skipMask = 0;
+        }
+        branched = 1;
+        wc = wz = 0;
+        break;
+    case 0x5b: case 0x5c: case 0x5d: case 0x5e:
+        n = ((opc - 0x5b) << 2) | (wc << 1) | wz;
+        i = 0;
+        switch (n) {
+        case 0x0: res = d - 1; write = 1; i = res == 0; break;           /* djz */
+        case 0x1: res = d - 1; write = 1; i = res != 0; break;           /* djnz */
+        case 0x2: res = d - 1; write = 1; i = res == 0xffffffff; break;  /* djf */
+        case 0x3: res = d - 1; write = 1; i = res != 0xffffffff; break;  /* djnf */
+        case 0x4: res = d + 1; write = 1; i = res == 0; break;           /* ijz */
+        case 0x5: res = d + 1; write = 1; i = res != 0; break;           /* ijnz */
+        case 0x6: i = d == 0; break;                                     /* tjz */
+        case 0x7: i = d != 0; break;                                     /* tjnz */
+        case 0x8: i = d == 0xffffffff; break;                            /* tjf */
+        case 0x9: i = d != 0xffffffff; break;                            /* tjnf */
+        case 0xa: i = (d >> 31) != 0; break;                             /* tjs */
+        case 0xb: i = (d >> 31) == 0; break;                             /* tjns */
+        case 0xc: i = (int)(d >> 31) != C->c; break;                     /* tjv */
+        case 0xd:                                                        /* jint etc. */
+            i = EventFlag(S, C, dfield & 15);
+            if (dfield & 16) i = !i;
+            break;
+        default:
+            SimUnimplemented(S, C, instr);
+            return;
+        }
+        wc = wz = 0;
+        if (i) {
+            target = imm ? nextpc + (hubexec ? 4 * SignExtend(sfield, 9) : SignExtend(sfield, 9)) : s;
+            branched = 1;
+        } else if (hubexec) {
+            cost = 2;
+        }
+        break;
+    case 0x5f: /* setpat */
+        wc = wz = 0;
+        break;
+    case 0x60: case 0x61: /* wrpin, wxpin, wypin, wrlut */
+        v = L ? (C->augd ? C->augdval | dfield : dfield) : d;
+        C->augd = 0;
+        if (opc == 0x61 && wc) {
+            addr = imm ? s : s;
+            if (imm && sfield == 0x100) {
+                SimUnimplemented(S, C, instr);
+                return;
+            }
+            C->lut[addr & 0x1ff] = v;
+        } else if (opc == 0x60 && !wc && L && dfield == 1) {
+            SmartWrite(S, 3, 0, s);
+        } else {
+            SmartWrite(S, opc == 0x61 ? 2 : wc ? 1 : 0, v, s);
+        }
+        wc = wz = 0;
+        break;
+    case 0x62: case 0x63:
+        if (opc == 0x63 && wc) {
+            /* rdfast */
+            C->fifoPtr = s & 0xfffff;
+            v = L ? (C->augd ? C->augdval | dfield : dfield) : d;
+            C->augd = 0;
+            if (!((v >> 31) & 1)) {
+                cost = 13 + HubWait(C, t0, s);
+            }
+            wc = wz = 0;
+            break;
+        }
+        /* wrbyte, wrword, wrlong */
+        v = L ? (C->augd ? C->augdval | dfield : dfield) : d;
+        C->augd = 0;
+        n = opc == 0x63 ? 4 : wc ? 2 : 1;
+        count = (n == 4 && qset) ? (C->q & 0x1ff) + 1 : 1;
+        addr = HubAddr(C, imm, sfield, s, n, count) & 0xfffff;
+        cost = 3 + HubWait(C, t0, addr) + (hubexec ? 5 : 0);
+        if (count > 1) {
+            /* with #D the block is filled with that value */
+            for (i = 0; i < count; i++) {
+                if (!L) {
+                    v = (qset == 2) ? C->lut[(dfield + i) & 0x1ff] : C->regs[(dfield + i) & 0x1ff];
+                }
+                SimWrLong(S, addr + 4*i, v);
+            }
+            cost += count - 1;
+        } else if (n == 1) {
+            SimWrByte(S, addr, v);
+        } else if (n == 2) {
+            SimWrWord(S, addr, v);
+        } else {
+            SimWrLong(S, addr, v);
+        }
+        wc = wz = 0;
+        break;
+    case 0x64: /* wrfast, fblock */
+        if (!wc) {
+            C->fifoPtr = s & 0xfffff;
+        }
+        wc = wz = 0;
+        break;
+    case 0x65: /* xinit, xzero */
+    case 0x66: /* xcont, rep */
+        if (opc == 0x66 && wc) {
+            v = L ? (C->augd ? C->augdval | dfield : dfield) : d;
+            C->augd = 0;
+            if (v) {
+                C->repStart = nextpc;
+                C->repEnd = nextpc + (hubexec ? 4 * v : v);
+                C->repCount = s;
+                C->repForever = s == 0;
+                C->repActive = 1;
+            }
+        } else if (opc == 0x65 && !wc && L && dfield == 0 && imm && sfield == 0) {
+            /* xstop */
+        } else {
+            SimUnimplemented(S, C, instr);
+            return;
+        }
+        wc = wz = 0;
+        break;
+    case 0x67: /* coginit */
+        {
+            Cog *N;
+            v = L ? (C->augd ? C->augdval | dfield : dfield) : d;
+            C->augd = 0;
+            cost = 2 + HubWait(C, t0, 0);
+            if (v & 0x10) {
+                N = SimFreeCog(S);
+            } else {
+                N = &S->cog[v & 7];
+            }
+            if (!N) {
+                nc = 1;
+                res = 15;
+            } else {
+                nc = 0;
+                res = N->id;
+                P2StartCog(S, N, s, qset ? C->q : 0, (v >> 5) & 1);
+                if (N == C) {
+                    return;
+                }
+            }
+            if (!L && wc) write = 1;
+            wz = 0;
+        }
+        break;
+    case 0x68: case 0x69: case 0x6a:
+        {
+            uint64_t issue = t0 + HubWait(C, t0, 0);
+            v = L ? (C->augd ? C->augdval | dfield : dfield) : d;
+            C->augd = 0;
+            cost = 2 + (issue - t0);
+            n = (opc - 0x68) * 2 + wc;
+            switch (n) {
+            case 0: /* qmul */
+                r64 = (uint64_t)v * s;
+                CordicPush(C, issue, (uint32_t)r64, (uint32_t)(r64 >> 32));
+                break;
+            case 1: /* qdiv */
+                CordicDiv(C, issue, ((uint64_t)(qset ? C->q : 0) << 32) | v, s);
+                break;
+            case 2: /* qfrac */
+                CordicDiv(C, issue, ((uint64_t)v << 32) | (qset ? C->q : 0), s);
+                break;
+            case 3: /* qsqrt */
+                CordicPush(C, issue, IntSqrt(((uint64_t)s << 32) | v), 0);
+                break;
+            case 4: /* qrotate */
+                a = (double)s * (2.0 * M_PI / 4294967296.0);
+                x = (double)(int32_t)v;
+                y = qset ? (double)(int32_t)C->q : 0.0;
+                CordicPush(C, issue, (uint32_t)(int32_t)lround(x * cos(a) - y * sin(a)),
+                           (uint32_t)(int32_t)lround(x * sin(a) + y * cos(a)));
+                break;
+            default: /* qvector */
+                x = (double)(int32_t)v;
+                y = (double)(int32_t)s;
+                a = atan2(y, x) * (4294967296.0 / (2.0 * M_PI));
+                CordicPush(C, issue, (uint32_t)llround(sqrt(x*x + y*y)), (uint32_t)(int64_t)llround(a));
+                break;
+            }
+            wc = wz = 0;
+        }
+        break;
+    case 0x6b:
+        /* the D only instructions use the I bit for #D */
+        L = imm;
+        v = L ? (C->augd ? C->augdval | dfield : dfield) : d;
+        if (L) C->augd = 0;
+        switch (sfield) {
+        case 0x00: /* hubset */
+            if ((v >> 28) & 1) {
+                /* chip reset */
+                S->done = 1;
+            }
+            cost = 2 + HubWait(C, t0, 0);
+            break;
+        case 0x01: /* cogid */
+            if (L) {
+                nc = S->cog[v & 7].running;
+            } else {
+                res = C->id;
+                write = 1;
+            }
+            cost = 2 + HubWait(C, t0, 0);
+            break;
+        case 0x03: /* cogstop */
+            S->cog[v & 7].running = 0;
+            SimPinsChanged(S, S->now);
+            cost = 2 + HubWait(C, t0, 0);
+            if ((v & 7) == (uint32_t)C->id) {
+                C->time = t0 + cost;
+                return;
+            }
+            break;
+        case 0x04: /* locknew */
+            cost = 2 + HubWait(C, t0, 0);
+            nc = 1;
+            for (i = 0; i < SIM_NUMLOCKS; i++) {
+                if (!S->lockUsed[i]) {
+                    S->lockUsed[i] = 1;
+                    S->lockState[i] = 0;
+                    res = i;
+                    nc = 0;
+                    write = 1;
+                    break;
+                }
+            }
+            break;
+        case 0x05: /* lockret */
+            S->lockUsed[v & 15] = 0;
+            cost = 2 + HubWait(C, t0, 0);
+            break;
+        case 0x06: /* locktry */
+            n = v & 15;
+            if (S->lockState[n] == 0 || S->lockState[n] == C->id + 1) {
+                S->lockState[n] = C->id + 1;
+                nc = 1;
+            } else {
+                nc = 0;
+            }
+            cost = 2 + HubWait(C, t0, 0);
+            break;
+        case 0x07: /* lockrel */
+            n = v & 15;
+            nc = S->lockState[n] != 0;
+            if (S->lockState[n] == C->id + 1) S->lockState[n] = 0;
+            cost = 2 + HubWait(C, t0, 0);
+            break;
+        case 0x0e: /* qlog */
+        case 0x0f: /* qexp */
+            {
+                uint64_t issue = t0 + HubWait(C, t0, 0);
+                cost = 2 + (issue - t0);
+                if (sfield == 0x0e) {
+                    r64 = v ? (uint64_t)llround(log2((double)v) * 134217728.0) : 0;
+                } else {
+                    a = exp2((double)v / 134217728.0);
+                    r64 = a >= 4294967295.0 ? 0xffffffff : (uint64_t)llround(a);
+                }
+                CordicPush(C, issue, (uint32_t)r64, 0);
+            }
+            break;
+        case 0x10: /* rfbyte */
+            res = SimRdByte(S, C->fifoPtr); C->fifoPtr += 1;
+            nc = (res >> 7) & 1; nz = res == 0; write = 1;
+            break;
+        case 0x11: /* rfword */
+            res = SimRdWord(S, C->fifoPtr); C->fifoPtr += 2;
+            nc = (res >> 15) & 1; nz = res == 0; write = 1;
+            break;
+        case 0x12: /* rflong */
+            res = SimRdLong(S, C->fifoPtr); C->fifoPtr += 4;
+            nc = res >> 31; nz = res == 0; write = 1;
+            break;
+        case 0x13: /* rfvar */
+        case 0x14: /* rfvars */
+            res = FifoVar(S, C, sfield == 0x14);
+            nc = res >> 31; nz = res == 0; write = 1;
+            break;
+        case 0x15: SimWrByte(S, C->fifoPtr, v); C->fifoPtr += 1; break;  /* wfbyte */
+        case 0x16: SimWrWord(S, C->fifoPtr, v); C->fifoPtr += 2; break;  /* wfword */
+        case 0x17: SimWrLong(S, C->fifoPtr, v); C->fifoPtr += 4; break;  /* wflong */
+        case 0x18: /* getqx */
+        case 0x19: /* getqy */
+            if (C->cordicCount && (sfield == 0x18 ? !C->qxUnread : !C->qyUnread)) {
+                cost += CordicWait(C, t0);
+            }
+            if (sfield == 0x18) {
+                res = C->qx; C->qxUnread = 0;
+            } else {
+                res = C->qy; C->qyUnread = 0;
+            }
+            nc = res >> 31; nz = res == 0; write = 1;
+            break;
+        case 0x1a: /* getct */
+            res = wc ? (uint32_t)(t0 >> 32) : (uint32_t)t0;
+            write = 1; wc = wz = 0;
+            break;
+        case 0x1b: /* getrnd */
+            v = SimRandom(S);
+            nc = v >> 31; nz = (v >> 30) & 1;
+            if (!L) { res = v; write = 1; }
+            break;
+        case 0x1c: case 0x1d: /* setdacs, setxfrq */
+            break;
+        case 0x1e: /* getxacc */
+            res = 0; write = 1;
+            break;
+        case 0x1f: /* waitx */
+            cost = 2 + v;
+            nc = nz = 0;
+            break;
+        case 0x20: case 0x21: case 0x22: case 0x23: /* setse1..4 */
+            break;
+        case 0x24: /* pollxxx, waitxxx, allowi etc. */
+            n = dfield;
+            if (n >= 0x20) {
+                /* allowi, stalli, trgint, nixint */
+                break;
+            }
+            if (n >= 0x11 && n <= 0x13) {
+                /* waitct1..3 */
+                if (C->ctEvent[n - 0x11] > t0 + 2) {
+                    cost = C->ctEvent[n - 0x11] - t0;
+                }
+                C->ctFlag[n - 0x11] = 0;
+                break;
+            }
+            if (n == 0x1e) {
+                /* waitatn */
+                if (!C->atn) {
+                    /* try again later */
+                    C->time = t0 + 16;
+                    return;
+                }
+                C->atn = 0;
+                break;
+            }
+            if (n < 0x10) {
+                nc = nz = EventFlag(S, C, n);
+                break;
+            }
+            SimUnimplemented(S, C, instr);
+            return;
+        case 0x25: case 0x26: case 0x27: /* setint1..3 */
+            if (v != 0) {
+                SimUnimplemented(S, C, instr);
+                return;
+            }
+            break;
+        case 0x28: /* setq */
+        case 0x29: /* setq2 */
+            C->q = v;
+            C->qset = sfield == 0x28 ? 1 : 2;
+            qset = C->qset;
+            break;
+        case 0x2a: /* push */
+            Push(C, v);
+            break;
+        case 0x2b: /* pop */
+            res = Pop(C);
+            nc = res >> 31; nz = (res >> 30) & 1;
+            write = 1;
+            break;
+        case 0x2c: /* jmp D */
+        case 0x2d: /* call D, ret */
+        case 0x2e: /* calla D, reta */
+        case 0x2f: /* callb D, retb */
+            if (L && sfield != 0x2c) {
+                /* returns */
+                if (sfield == 0x2d) {
+                    if ((C->stack[0] & 0xfffff) == 0x1ff) {
+                        goto xbyte;
+                    }
+                    v = Pop(C);
+                } else {
+                    n = sfield == 0x2e ? REG_PTRA : REG_PTRB;
+                    C->regs[n] -= 4;
+                    addr = C->regs[n];
+                    v = SimRdLong(S, addr);
+                    cost = 9 + HubWait(C, t0, addr);
+                }
+                if (C->skipDepth) {
+                    C->skipMask = C->skipStack[--C->skipDepth];
+                }
+                target = v & 0xfffff;
+                nc = v >> 31; nz = (v >> 30) & 1;
+                branched = 1;
+                break;
+            }
+            v = d;
+            target = v & 0xfffff;
+            nc = v >> 31; nz = (v >> 30) & 1;
+            if (sfield != 0x2c) {
+                uint32_t ret = ((uint32_t)C->c << 31) | ((uint32_t)C->z << 30) | nextpc;
+                if (sfield == 0x2d) {
+                    Push(C, ret);
+                } else {
+                    n = sfield == 0x2e ? REG_PTRA : REG_PTRB;
+                    SimWrLong(S, C->regs[n], ret);
+                    cost = 3 + HubWait(C, t0, C->regs[n]);
+                    C->regs[n] += 4;
+                }
+                if (C->skipMask && C->skipDepth < 8) {
+                    C->skipStack[C->skipDepth++] = C->skipMask;
+                    C->skipMask = 0;
+                }
+            }
+            branched = 1;
+            break;
+        case 0x30: /* jmprel */
+            target = nextpc + (hubexec ? 4 * v : v);
+            branched = 1;
+            break;
+        case 0x31: /* skip */
+        case 0x32: /* skipf */
+            C->skipMask = v;
+            C->skipFast = sfield == 0x32;
+            break;
+        case 0x33: /* execf */
+            target = v & 0x3ff;
+            C->skipMask = v >> 10;
+            C->skipFast = 1;
+            branched = 1;
+            break;
+        case 0x34: /* getptr */
+            res = C->fifoPtr; write = 1;
+            break;
+        case 0x35: /* getbrk */
+            res = 0; nc = nz = 0; write = 1;
+            break;
+        case 0x36: /* brk */
+        case 0x37: /* setluts */
+        case 0x38: case 0x39: case 0x3a: case 0x3b: /* setcy, setci, setcq, setcfrq */
+        case 0x3c: case 0x3d: case 0x3e: /* setcmod, setpiv, setpix */
+            break;
+        case 0x3f: /* cogatn */
+            for (i = 0; i < SIM_NUMCOGS; i++) {
+                if ((v >> i) & 1) S->cog[i].atn = 1;
+            }
+            break;
+        default:
+            if (sfield >= 0x40 && sfield < 0x60) {
+                if (sfield < 0x48 && wc != wz) {
+                    /* testp, testpn */
+                    int bit = P2PinIn(S, v & 63);
+                    int *flag = wc ? &C->c : &C->z;
+                    n = sfield & 7;
+                    if (n & 1) bit = !bit;
+                    switch (n >> 1) {
+                    case 0: *flag = bit; break;
+                    case 1: *flag &= bit; break;
+                    case 2: *flag |= bit; break;
+                    default: *flag ^= bit; break;
+                    }
+                    wc = wz = 0;
+                    break;
+                }
+                PinOp(S, C, (sfield - 0x40) >> 3, sfield & 7, v);
+                nc = nz = P2PinIn(S, v & 63);
+                break;
+            }
+            switch (sfield) {
+            case 0x60: case 0x61: case 0x62: case 0x63: /* splitb, mergeb, splitw, mergew */
+                res = 0;
+                for (i = 0; i < 32; i++) {
+                    /* bit j of part k in the merged form is bit k of group j */
+                    int split = (sfield & 2) ? (i % 2) * 16 + i / 2 : (i % 4) * 8 + i / 4;
+                    if (sfield & 1) {
+                        res |= ((d >> split) & 1) << i;
+                    } else {
+                        res |= ((d >> i) & 1) << split;
+                    }
+                }
+                write = 1;
+                break;
+            case 0x68: /* xoro32 */
+                C->altsval = Xoro32(&res, d);
+                C->alt = (alt & ~ALT_SVAL) | ALT_SVAL;
+                write = 1;
+                break;
+            case 0x69: /* rev */
+                res = 0;
+                for (i = 0; i < 32; i++) res |= ((d >> i) & 1) << (31 - i);
+                write = 1;
+                break;
+            case 0x6a: /* rczr */
+                res = ((uint32_t)C->c << 31) | ((uint32_t)C->z << 30) | (d >> 2);
+                nc = (d >> 1) & 1; nz = d & 1;
+                write = 1;
+                break;
+            case 0x6b: /* rczl */
+                res = (d << 2) | ((uint32_t)C->c << 1) | C->z;
+                nc = d >> 31; nz = (d >> 30) & 1;
+                write = 1;
+                break;
+            case 0x6c: res = C->c; write = 1; break;     /* wrc */
+            case 0x6d: res = !C->c; write = 1; break;    /* wrnc */
+            case 0x6e: res = C->z; write = 1; break;     /* wrz */
+            case 0x6f:
+                if (L) {
+                    /* modcz */
+                    n = C->c * 2 + C->z;
+                    nc = ((dfield >> 4) >> n) & 1;
+                    nz = ((dfield & 15) >> n) & 1;
+                } else {
+                    res = !C->z; write = 1;              /* wrnz */
+                }
+                break;
+            case 0x70: /* setscp */
+                break;
+            case 0x71: /* getscp */
+                res = 0; write = 1;
+                break;
+            default:
+                SimUnimplemented(S, C, instr);
+                return;
+            }
+            break;
+        }
+        break;
+    case 0x6c: case 0x6d: case 0x6e: case 0x6f: /* jmp, call, calla, callb #A */
+    case 0x70: case 0x71: case 0x72: case 0x73: /* calld PA/PB/PTRA/PTRB, #A */
+        v = instr & 0xfffff;
+        if (wc) {
+            v = SignExtend(v, 20);
+            target = hubexec ? nextpc + v : nextpc + ((int32_t)v >> 2);
+        } else {
+            target = v;
+        }
+        v = ((uint32_t)C->c << 31) | ((uint32_t)C->z << 30) | nextpc;
+        switch (opc) {
+        case 0x6c:
+            break;
+        case 0x6d:
+            Push(C, v);
+            break;
+        case 0x6e:
+        case 0x6f:
+            n = opc == 0x6e ? REG_PTRA : REG_PTRB;
+            SimWrLong(S, C->regs[n], v);
+            cost = 3 + HubWait(C, t0, C->regs[n]);
+            C->regs[n] += 4;
+            break;
+        default:
+            WrReg(S, C, REG_PA + (opc - 0x70), v);
+            break;
+        }
+        if (opc >= 0x6d && C->skipMask && C->skipDepth < 8) {
+            C->skipStack[C->skipDepth++] = C->skipMask;
+            C->skipMask = 0;
+        }
+        wc = wz = 0;
+        branched = 1;
+        break;
+    case 0x74: case 0x75: case 0x76: case 0x77: /* loc */
+        v = instr & 0xfffff;
+        if (wc) {
+            v = nextpc + SignExtend(v, 20);
+        }
+        WrReg(S, C, REG_PA + (opc - 0x74), v);
+        wc = wz = 0;
+        break;
+    case 0x78: case 0x79: case 0x7a: case 0x7b: /* augs */
+        C->augs = 1;
+        C->augsval = (instr & 0x7fffff) << 9;
+        C->alt = alt;
+        wc = wz = 0;
+        break;
+    default: /* augd */
+        C->augd = 1;
+        C->augdval = (instr & 0x7fffff) << 9;
+        C->alt = alt;
+        wc = wz = 0;
+        break;
+    }
+    goto setflags;
+
+setflags:
+    if (write) {
+        WrReg(S, C, rfield, res);
+    }
+    if (wc) C->c = nc;
+    if (wz) C->z = nz;
+
+    if (cond == 0 && !branched) {
+        /* _ret_ */
+        if ((C->stack[0] & 0xfffff) == 0x1ff) {
+            goto xbyte;
+        }
+        v = Pop(C);
+        if (C->skipDepth) {
+            C->skipMask = C->skipStack[--C->skipDepth];
+        }
+        target = v & 0xfffff;
+        branched = 1;
+    }
+    if (branched) {
+        C->repActive = 0;
+        C->pc = target & 0xfffff;
+        if (C->pc >= 0x400) {
+            cost += 11 + HubWait(C, t0 + cost, C->pc);
+        } else {
+            cost += 2;
+        }
+        goto profile;
+    }
+    goto done;
+
+xbyte:
+    /* return to $1FF with $1FF on the stack: fetch and run a bytecode */
+    if (qset) {
+        C->xbyteBase = C->q & 0x1ff;
+        C->qset = 0;
+    }
+    v = SimRdByte(S, C->fifoPtr);
+    C->fifoPtr++;
+    /* the interpreter finds the bytecode in PA and the next one at PB */
+    WrReg(S, C, REG_PA, v);
+    WrReg(S, C, REG_PB, C->fifoPtr);
+    v = C->lut[(C->xbyteBase + v) & 0x1ff];
+    C->skipMask = v >> 10;
+    C->skipFast = 1;
+    C->repActive = 0;
+    C->pc = v & 0x3ff;
+    cost += 4;
+    goto profile;
+
+done:
+    C->pc = nextpc;
+    if (C->repActive && C->pc == C->repEnd) {
+        if (C->repForever || --C->repCount > 0) {
+            C->pc = C->repStart;
+        } else {
+            C->repActive = 0;
+        }
+    }
+profile:
+    C->time = t0 + cost;
+    SimProfile(S, C, pc, pc < 0x400, cost);
+}
@@ -71,6 +71,9 @@ Usage(void)
     fprintf(stderr, "  --nofcache: disable FCACHE (same as --fcache=0)\n");
     fprintf(stderr, "  --normalize: normalize case of all identifiers\n"); 
     fprintf(stderr, "  --p2:       use Propeller 2 instructions (experimental)\n");
+    fprintf(stderr, "  --profile-gen: PASM output only: count calls and loop trips at run time\n");
+    fprintf(stderr, "  --profile-use=file: PASM output only: use counts from --profile-gen\n");
+    fprintf(stderr, "  --cycle-report: PASM output only: write cycle count bounds to a .cycles.json file\n");
     fprintf(stderr, "  --require:  require a specific version (or later) of spin2cpp\n");
     fprintf(stderr, "  --side:     create a SimpleIDE file for the C/C++ outputs\n");
     fprintf(stderr, "  -Dname=val: define a preprocessor symbol\n");
@@ -80,7 +83,7 @@ Usage(void)
     fprintf(stderr, "  -o file:    place final output in file\n");
     fprintf(stderr, "  -Wall:      enable all warnings\n");
     fprintf(stderr, "  -y:         debug parser\n");
-    fprintf(stderr, "  --verbose:  print additional diagnostic messages\n");
+    fprintf(stderr, "  --verbose[=N]:  print additional diagnostic messages (2 adds optimizer statistics)\n");
     fprintf(stderr, "  --version:  print version and exit\n");
     exit(2);
 }
@@ -262,6 +265,9 @@ main(int argc, const char **argv)
         } else if (!strcmp(argv[0], "--verbose")) {
             gl_verbosity = 1;
             argv++; --argc;
+        } else if (!strncmp(argv[0], "--verbose=", 10)) {
+            gl_verbosity = atoi(argv[0] + 10);
+            argv++; --argc;
         } else if (!strcmp(argv[0], "--dat") || (!compile && !strcmp(argv[0], "-c"))) {
             gl_output = OUTPUT_DAT;
             outputDat = 1;
@@ -397,6 +403,15 @@ main(int argc, const char **argv)
         } else if (!strncmp(argv[0], "--fixed", 7)) {
             gl_fixedreal = 1;
             argv++; --argc;
+        } else if (!strcmp(argv[0], "--profile-gen")) {
+            gl_profile_gen = 1;
+            argv++; --argc;
+        } else if (!strncmp(argv[0], "--profile-use=", 14)) {
+            gl_profile_use = argv[0]+14;
+            argv++; --argc;
+        } else if (!strcmp(argv[0], "--cycle-report")) {
+            gl_cycle_report = 1;
+            argv++; --argc;
 	} else if (!strncmp(argv[0], "-o", 2)) {
 	    const char *opt;
 	    opt = argv[0];
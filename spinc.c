@@ -98,6 +98,19 @@ makeClassNameSafe(Module *P)
 #include "sys/gc_pasm.spin.h"
 #include "sys/gc_bytecode.spin.h"
 
+/*
+ * write out the settings that can change how a module parses, for
+ * use in keys for the parse cache
+ */
+static void
+CacheOptionsKey(char *buf, size_t size)
+{
+    snprintf(buf, size, "p2=%d out=%d interp=%d fixed=%d debug=%d brk=%d charset=%d srccharset=%d case=%d norm=%d tabs=%d srccomments=%d gas=%d warn=%x opt=%x",
+             gl_p2, gl_output, gl_interp_kind, gl_fixedreal, gl_debug, gl_brkdebug,
+             gl_run_charset, gl_src_charset, gl_caseSensitive, gl_normalizeIdents,
+             gl_tab_stops, gl_srccomments, gl_gas_dat, gl_warn_flags, gl_optimize_flags);
+}
+
 void
 InitGlobalModule(void)
 {
@@ -106,6 +119,14 @@ InitGlobalModule(void)
     int oldtmpnum;
     int saveyydebug;
     const char *syscode = "";
+    char cachekey[256];
+    char options[200];
+    struct timespan span;
+    struct {
+        const char *code;
+        const char *name;
+    } parts[6];
+    int nparts, i;
     
     current = systemModule = NewModule("_system_", LANG_SPIN_SPIN1);
     table = &systemModule->objsyms;
@@ -191,27 +212,50 @@ InitGlobalModule(void)
         gl_normalizeIdents = 0;
         systemModule->Lptr = (LexStream *)calloc(sizeof(*systemModule->Lptr), 1);
         systemModule->Lptr->flags |= LEXSTREAM_FLAG_NOSRC;
-        strToLex(systemModule->Lptr, syscode, "_system_", LANG_SPIN_SPIN1);
-        spinyyparse();
 
-        // add common PASM code
+        // the system module is made up of these pieces
+        nparts = 0;
+        parts[nparts].code = syscode; parts[nparts++].name = "_system_";
         if (gl_output != OUTPUT_BYTECODE) {
-            strToLex(systemModule->Lptr, (const char *)sys_common_pasm_spin, "_common_pasm_", LANG_SPIN_SPIN1);
-            spinyyparse();
+            // add common PASM code
+            parts[nparts].code = (const char *)sys_common_pasm_spin; parts[nparts++].name = "_common_pasm_";
         }
-        strToLex(systemModule->Lptr, (const char *)sys_common_spin, "_common_", LANG_SPIN_SPIN1);
-        spinyyparse();
-        strToLex(systemModule->Lptr, (const char *)sys_float_spin, "_float_", LANG_SPIN_SPIN1);
-        spinyyparse();
-        strToLex(systemModule->Lptr, (const char *)sys_gcalloc_spin, "_gc_", LANG_SPIN_SPIN1);
-        spinyyparse();
+        parts[nparts].code = (const char *)sys_common_spin; parts[nparts++].name = "_common_";
+        parts[nparts].code = (const char *)sys_float_spin; parts[nparts++].name = "_float_";
+        parts[nparts].code = (const char *)sys_gcalloc_spin; parts[nparts++].name = "_gc_";
         if (gl_output == OUTPUT_BYTECODE) {
-            strToLex(systemModule->Lptr, (const char *)sys_gc_bytecode_spin, "_platform_", LANG_SPIN_SPIN1);
-            spinyyparse();
+            parts[nparts].code = (const char *)sys_gc_bytecode_spin; parts[nparts++].name = "_platform_";
         } else {
-            strToLex(systemModule->Lptr, (const char *)sys_gc_pasm_spin, "_platform_", LANG_SPIN_SPIN1);
-            spinyyparse();
+            parts[nparts].code = (const char *)sys_gc_pasm_spin; parts[nparts++].name = "_platform_";
         }
+
+        // the parse only depends on the code selected above and on
+        // flags the lexer and parser look at; the compiler stamp in
+        // the cache key normally covers the code, but hash it too so
+        // that a rebuilt compiler with the same stamp is safe
+        cachekey[0] = 0;
+        if (ModuleCacheEnabled()) {
+            uint64_t srchash = 0;
+            for (i = 0; i < nparts; i++) {
+                srchash = CacheHash(srchash, parts[i].code, strlen(parts[i].code) + 1);
+            }
+            CacheOptionsKey(options, sizeof(options));
+            snprintf(cachekey, sizeof(cachekey), "system src=%016llx %s", (unsigned long long)srchash, options);
+        }
+        timereport_begin(&span, "parse", "_system_");
+        if (!cachekey[0] || !LoadModuleFromCache(systemModule, cachekey)) {
+            CacheMark mark;
+
+            ModuleCacheMark(systemModule, &mark);
+            for (i = 0; i < nparts; i++) {
+                strToLex(systemModule->Lptr, parts[i].code, parts[i].name, LANG_SPIN_SPIN1);
+                spinyyparse();
+            }
+            if (cachekey[0]) {
+                SaveModuleToCache(systemModule, cachekey, &mark);
+            }
+        }
+        timereport_end(&span, 0);
         ProcessModule(systemModule);
 
         curfunc = NULL;
@@ -439,7 +483,17 @@ getObjFileExtension(const char *fname)
     }
     buf[0] = 0;
     ptr = fgets(buf, sizeof(buf), f);
-    if (ptr) {
+    if (ptr && !strncmp(ptr, "// flexobj ", 11)) {
+        // object file header: "// flexobj <format> <extension> ..."
+        ptr = strchr(ptr + 11, ' ');
+        if (ptr) {
+            ext = ++ptr;
+            ptr = strchr(ptr, ' ');
+            if (ptr) *ptr = 0;
+            ptr = strchr(ext, '\n');
+            if (ptr) *ptr = 0;
+        }
+    } else if (ptr) {
         if (!strncmp(ptr, "#line", 5)) {
             ptr = strrchr(ptr, '.');
             if (ptr) {
@@ -459,6 +513,74 @@ getObjFileExtension(const char *fname)
     return ext;
 }
 
+/*
+ * read an object file written by OutputObjFile, and return just the
+ * preprocessed source in it (or NULL if it is not such a file)
+ */
+static char *
+readObjFile(FILE *f)
+{
+    Flexbuf fb;
+    char buf[4096];
+    size_t n;
+    char *text, *payload;
+
+    flexbuf_init(&fb, 4096);
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) {
+        flexbuf_addmem(&fb, buf, n);
+    }
+    flexbuf_addchar(&fb, 0);
+    text = flexbuf_get(&fb);
+    payload = ObjFilePayload(text);
+    if (!payload) {
+        free(text);
+        return NULL;
+    }
+    memmove(text, payload, strlen(payload)+1);
+    return text;
+}
+
+/*
+ * build the parse cache key for file "fname" whose preprocessed text
+ * is "text"
+ */
+#define MAX_MCPP_ARGC 255
+
+static char *
+ModuleCacheKey(const char *fname, int language, const char *text)
+{
+    char *argv[MAX_MCPP_ARGC+1];
+    char options[200];
+    uint64_t defhash = 0;
+    size_t len, textlen;
+    char *key;
+    int argc, i;
+
+    // hashing the text is wasted work if there is no cache
+    if (!ModuleCacheEnabled()) {
+        return NULL;
+    }
+    // the defines were already applied to the text, but include them
+    // (and the include path) anyway in case the parser looks at them
+    // __DATE__ and __TIME__ change all the time; files which use them
+    // have them in the text anyway
+    argc = pp_get_defines_as_args(&gl_pp, 0, argv, MAX_MCPP_ARGC);
+    for (i = 0; i < argc; i++) {
+        if (!strncmp(argv[i], "-D__DATE__=", 11) || !strncmp(argv[i], "-D__TIME__=", 11)) {
+            continue;
+        }
+        defhash = CacheHash(defhash, argv[i], strlen(argv[i]) + 1);
+    }
+    CacheOptionsKey(options, sizeof(options));
+    textlen = strlen(text);
+    len = strlen(fname) + strlen(options) + 100;
+    key = (char *)malloc(len);
+    snprintf(key, len, "module lang=%d src=%016llx.%lx defs=%016llx %s file=%s",
+             language, (unsigned long long)CacheHash(0, text, textlen),
+             (unsigned long)textlen, (unsigned long long)defhash, options, fname);
+    return key;
+}
+
 static Module *
 doParseFile(const char *name, Module *P, int *is_dup)
 {
@@ -466,10 +588,13 @@ doParseFile(const char *name, Module *P, int *is_dup)
     Module *save, *Q, *LastQ;
     char *fname = NULL;
     char *parseString = NULL;
+    char *cachekey = NULL;
     char *langptr;
     int language = LANG_SPIN_SPIN1;
     SymbolTable *saveCurrentTypes = NULL;
     int new_module = 0;
+    int is_obj = 0;
+    struct timespan span;
 
     // check language to process
     langptr = strrchr(name, '.');
@@ -477,6 +602,7 @@ doParseFile(const char *name, Module *P, int *is_dup)
         if (!strcmp(langptr, ".o")) {
             // try to figure out language based on contents of file
             fname = find_file_on_path(&gl_pp, name, langptr, NULL);
+            is_obj = 1;
             if (fname) {
                 langptr = getObjFileExtension(fname);
             } else {
@@ -650,12 +776,26 @@ doParseFile(const char *name, Module *P, int *is_dup)
         currentTypes->flags = SYMTAB_FLAG_NOCASE;
     }
     AddSymbol(&P->objsyms, fname, SYM_FILE, (void *)0, NULL);
-    
-    if (gl_preprocess) {
+
+    // object files were already preprocessed when they were compiled
+    if (is_obj) {
+        timereport_begin(&span, "read object", fname);
+        parseString = readObjFile(f);
+        timereport_end(&span, 0);
+        if (!parseString) {
+            rewind(f);
+        }
+    }
+    if (gl_preprocess || parseString) {
         void *defineState;
+        int run_pp = !parseString;
 
-#define MAX_MCPP_ARGC 255
-        if (IsCLang(language)) {
+        if (run_pp) {
+            timereport_begin(&span, IsCLang(language) ? "mcpp" : "preprocess", fname);
+        }
+        if (!run_pp) {
+            /* nothing to do */
+        } else if (IsCLang(language)) {
             /* use mcpp */
             char *argv[MAX_MCPP_ARGC+1];
             int argc = 0;
@@ -699,12 +839,35 @@ doParseFile(const char *name, Module *P, int *is_dup)
             parseString = pp_finish(&gl_pp);
             pp_restore_define_state(&gl_pp, defineState);
         }
-        strToLex(NULL, parseString, fname, language);
-	doparse(language);
+        if (run_pp) {
+            timereport_end(&span, 0);
+        }
+        timereport_begin(&span, "parse", fname);
+        // a module nobody else has added to can come from the parse cache
+        if (new_module) {
+            cachekey = ModuleCacheKey(fname, language, parseString);
+        }
+        if (cachekey) {
+            P->Lptr = (LexStream *)calloc(sizeof(*P->Lptr), 1);
+        }
+        if (!cachekey || !LoadModuleFromCache(P, cachekey)) {
+            CacheMark mark;
+
+            ModuleCacheMark(P, &mark);
+            strToLex(cachekey ? P->Lptr : NULL, parseString, fname, language);
+            doparse(language);
+            if (cachekey) {
+                SaveModuleToCache(P, cachekey, &mark);
+            }
+        }
+        free(cachekey);
         free(parseString);
+        timereport_end(&span, 0);
     } else {
+        timereport_begin(&span, "parse", fname);
         fileToLex(NULL, f, fname, language);
         doparse(language);
+        timereport_end(&span, 0);
     }
     fclose(f);
 
@@ -903,6 +1066,10 @@ RemoveUnusedMethods(int isBinary)
             }
         }
     }
+    // the startup code prints the profile counters when main returns
+    if (gl_profile_gen) {
+        MarkSystemFuncUsed("_profile_dump");
+    }
     // and check for function pointers in data
     for (P = allparse; P; P = P->next) {
         saveCur = current;
@@ -985,6 +1152,9 @@ doTypeInference(void)
     int changes;
     Module *Q;
     Function *pf;
+    struct timespan span;
+
+    timereport_begin(&span, "InferTypes", NULL);
     // do type inference; we do that even for BASIC
     // because there are some things (like static-ness
     // of functions) that C wants to know about
@@ -1000,6 +1170,7 @@ doTypeInference(void)
             FixupParameterTypes(pf);
         }
     }
+    timereport_end(&span, tries + 1);
 }
 
 static void
@@ -1123,6 +1294,8 @@ FixupCode(Module *P, int isBinary)
 {
     Module *Q, *LastQ, *subQ;
     int changes;
+    unsigned long passes = 0;
+    struct timespan span;
     Function *firstfunc;
     Function *pf;
     
@@ -1149,14 +1322,19 @@ FixupCode(Module *P, int isBinary)
     }
     
     for (Q = allparse; Q; Q = Q->next) {
+        timereport_begin(&span, "DoHighLevelOptimize", Q->fullname);
         DoHighLevelOptimize(Q);
+        timereport_end(&span, 0);
         if (gl_errors) return;
     }
     
+    timereport_begin(&span, "ResolveSymbols", NULL);
     do {
         CheckUnusedMethods(isBinary);
         changes = ResolveSymbols();
+        passes++;
     } while (changes && gl_errors == 0);
+    timereport_end(&span, passes);
 
     if (gl_errors >= gl_max_errors) {
         return;
@@ -1251,6 +1429,10 @@ ParseTopFiles(const char *argv[], int argc, int outputBin)
     
     current = allparse = NULL;
 
+    // leave out object files that nothing uses
+    if (outputBin && gl_output != OUTPUT_OBJ && (gl_optimize_flags & OPT_REMOVE_UNUSED_FUNCS)) {
+        argv = LinkObjFiles(argv, &argc);
+    }
     while (argc > 0) {
         name = *argv++;
         currentTypes = NULL;
@@ -1264,6 +1446,72 @@ ParseTopFiles(const char *argv[], int argc, int outputBin)
     return P;
 }
 
+Module *
+NewTopModule(const char *name, int language)
+{
+    Module *P;
+    Module *saveparse = allparse;
+
+    name = strdup(name);
+    if (gl_useFullPaths) {
+        name = MakeAbsolutePath(name);
+    }
+    // name it as ParseTopFiles would, but leave the old modules
+    // in place until FinishTopModule (the back end may still be
+    // using them to fill in this one)
+    allparse = NULL;
+    P = NewModule(name, language);
+    allparse = saveparse;
+    P->curLanguage = language;
+    AddSymbol(&P->objsyms, name, SYM_FILE, (void *)0, NULL);
+    P->datname = "dat";
+    return P;
+}
+
+/*
+ * parse "text" as more source for module P; "lastLabel" is the
+ * most recent global label, which any local labels in the text
+ * are attached to
+ * returns the most recent global label after the text
+ */
+const char *
+ParseModuleString(Module *P, const char *text, const char *lastLabel)
+{
+    Module *save = current;
+    SymbolTable *saveCurrentTypes = currentTypes;
+
+    current = P;
+    currentTypes = (SymbolTable *)calloc(1, sizeof(*currentTypes));
+    currentTypes->next = &P->objsyms;
+    if (LangCaseInSensitive(P->curLanguage)) {
+        currentTypes->flags = SYMTAB_FLAG_NOCASE;
+    }
+    strToLex(NULL, text, P->fullname, P->curLanguage);
+    P->Lptr->lastGlobal = lastLabel;
+    doparse(P->curLanguage);
+    lastLabel = P->Lptr->lastGlobal;
+    if (gl_errors >= gl_max_errors) {
+        exit(1);
+    }
+    current = save;
+    currentTypes = saveCurrentTypes;
+    return lastLabel;
+}
+
+Module *
+FinishTopModule(Module *P, int outputBin)
+{
+    makeClassNameSafe(P);
+    current = NULL;
+    currentTypes = NULL;
+    allparse = P;
+    ProcessModule(P);
+    if (gl_errors < gl_max_errors) {
+        FixupCode(P, outputBin);
+    }
+    return P;
+}
+
 Function *
 GetMainFunction(Module *P)
 {
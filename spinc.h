@@ -56,6 +56,14 @@ Module *ParseFile(const char *name);
 // outputBin is nonzero if we are outputting binary code
 Module *ParseTopFiles(const char *argv[], int argc, int outputBin);
 
+// build a top level module from memory rather than from files;
+// the module's contents come from ParseModuleString and/or from
+// adding to its blocks directly, and FinishTopModule does the
+// processing ParseTopFiles would (including resetting global state)
+Module *NewTopModule(const char *name, int language);
+const char *ParseModuleString(Module *P, const char *text, const char *lastLabel);
+Module *FinishTopModule(Module *P, int outputBin);
+
 // calculate number of expression items that may be placed on the stack
 int NumExprItemsOnStack(AST *param);
 
@@ -4,6 +4,8 @@
 #include <stdio.h>
 #include "symbol.h"
 #include "util/util.h"
+#include "util/arena.h"
+#include "util/jobs.h"
 
 extern int gl_caseSensitive;
 
@@ -31,37 +33,76 @@ SymbolHash(const char *str)
     return hash % SYMTABLE_HASH_SIZE;
 }
 
+/*
+ * RawSymbolHash keeps its low bits poorly mixed (they are what the
+ * CSE code uses), so scramble it before picking a slot
+ */
+static inline unsigned
+SlotIndex(unsigned hash, unsigned mask)
+{
+    hash ^= hash >> 16;
+    hash *= 0x45d9f3b;
+    hash ^= hash >> 16;
+    return hash & mask;
+}
+
 /* find a symbol in the table */
 extern inline Symbol *FindSymbol(SymbolTable *table, const char *name);
 
-Symbol *
-FindSymbolEx(SymbolTable *table, const char *name,int forceCaseSens)
+/*
+ * find the slot for "name" (whose RawSymbolHash is "hash") in table
+ * returns NULL if the table is empty
+ * if the symbol is not present *slot is NULL on return
+ * nocase tables may have several names differing only in case (if
+ * they were entered while case sensitive); an exact match wins,
+ * otherwise we find the one added most recently
+ */
+static Symbol **
+FindSlot(SymbolTable *table, const char *name, unsigned hash, int nocase)
 {
-    unsigned hash;
+    unsigned mask, i;
     Symbol *sym;
-    int nocase = ((table->flags & SYMTAB_FLAG_NOCASE) != 0) && !gl_caseSensitive;
-    if (forceCaseSens) nocase = forceCaseSens < 0; // 1 forces case sensitive, -1 forces case insensitive
-    hash = SymbolHash(name);
-    sym = table->hash[hash];
+    Symbol **found = NULL;
 
-    if (nocase) {
-        while (sym) {
-            if (!strcasecmp(sym->our_name, name)) {
-                return sym;
-            }
-            sym = sym->next;
+    if (!table->size) {
+        return NULL;
+    }
+    mask = table->size - 1;
+    for (i = SlotIndex(hash, mask); (sym = table->slots[i]) != NULL; i = (i+1) & mask) {
+        if (sym->hash != hash) {
+            continue;
         }
-    } else {
-        while (sym) {
-            if (!strcmp(sym->our_name, name)) {
-                return sym;
+        if (sym->our_name == name || !strcmp(sym->our_name, name)) {
+            return &table->slots[i];
+        }
+        if (nocase && !strcasecmp(sym->our_name, name)) {
+            if (!found || (*found)->seq < sym->seq) {
+                found = &table->slots[i];
             }
-            sym = sym->next;
         }
     }
-    /* symbol was not found, give up */
-    /* it's up to our caller to look through a containing context */
-    return NULL;
+    return found ? found : &table->slots[i];
+}
+
+static Symbol *
+FindSymbolHashed(SymbolTable *table, const char *name, unsigned hash, int forceCaseSens)
+{
+    Symbol **slot;
+    Symbol *sym;
+    int nocase = ((table->flags & SYMTAB_FLAG_NOCASE) != 0) && !gl_caseSensitive;
+    if (forceCaseSens) nocase = forceCaseSens < 0; // 1 forces case sensitive, -1 forces case insensitive
+
+    slot = FindSlot(table, name, hash, nocase);
+    sym = slot ? *slot : NULL;
+    /* if the symbol was not found, it's up to our caller to look
+       through a containing context */
+    return sym;
+}
+
+Symbol *
+FindSymbolEx(SymbolTable *table, const char *name,int forceCaseSens)
+{
+    return FindSymbolHashed(table, name, RawSymbolHash(name), forceCaseSens);
 }
 
 /* find a symbol in a table or in any of its links */
@@ -70,12 +111,11 @@ static Symbol *
 doLookupSymbolInTable(SymbolTable *table, const char *name, int level)
 {
     Symbol *sym = NULL;
-    if (!table) return NULL;
-    sym = FindSymbol(table, name);
-    if (!sym) {
-        if (table->next) {
-           sym = doLookupSymbolInTable(table->next, name, level);
-	}
+    SymbolTable *first = table;
+    unsigned hash = RawSymbolHash(name);
+
+    for (; table && !sym; table = table->next) {
+        sym = FindSymbolHashed(table, name, hash, 0);
     }
     if (sym && IsAlias(sym)) {
         // have to look it up again
@@ -85,7 +125,7 @@ doLookupSymbolInTable(SymbolTable *table, const char *name, int level)
             //ERROR(NULL, "recursive definition for symbol %s", name);
             return NULL;
         }
-        alias = doLookupSymbolInTable(table, (const char *)sym->val, level);
+        alias = doLookupSymbolInTable(first, (const char *)sym->val, level);
         if (alias) {
             return alias;
         } else {
@@ -115,17 +155,18 @@ Symbol *
 FindSymbolByOffsetAndKind(SymbolTable *table, int offset, int kind)
 {
     Symbol *sym = NULL;
-    int hash;
-    for (hash = 0; hash < SYMTABLE_HASH_SIZE; hash++) {
-        sym = table->hash[hash];
-        while (sym) {
-            if (sym->offset == offset && sym->kind == kind)
-            {
-                return sym;
-            }
-            sym = sym->next;
+    unsigned i;
+
+    /* if there are several, pick the one IterateOverSymbols would see first */
+    for (i = 0; i < table->count; i++) {
+        if (table->list[i]->offset == offset && table->list[i]->kind == kind) {
+            sym = table->list[i];
+            break;
         }
     }
+    if (sym) {
+        return sym;
+    }
     /* could not find it */
     if (kind == SYM_RESULT) {
         /* look for first parameter */
@@ -140,20 +181,17 @@ FindSymbolByOffsetAndKind(SymbolTable *table, int offset, int kind)
 
 /*
  * iterate over all symbols in a table
+ * symbols added by "func" are not visited
  */
 void
 IterateOverSymbols(SymbolTable *table, SymbolFunc func, void *arg)
 {
-    Symbol *sym;
-    int hash;
-    int more;
-    
-    for (hash = 0; hash < SYMTABLE_HASH_SIZE; hash++) {
-        sym = table->hash[hash];
-        while (sym) {
-            more = func(sym, arg);
-            if (!more) return;
-            sym = sym->next;
+    unsigned i, n = table->count;
+
+    // "func" may add symbols, which can move the list
+    for (i = 0; i < n; i++) {
+        if (!func(table->list[i], arg)) {
+            return;
         }
     }
 }
@@ -168,6 +206,39 @@ NewSymbol(void)
     return sym;
 }
 
+/*
+ * make room in a table for another symbol; we keep the table at
+ * most half full so probe sequences stay short, and the list of
+ * symbols in order has room for half as many as the table
+ */
+static void
+GrowTable(SymbolTable *table)
+{
+    Symbol **oldslots = table->slots;
+    unsigned oldsize = table->size;
+    unsigned i, j, mask;
+
+    if (2*(table->count+1) <= table->size) {
+        return;
+    }
+    table->size = oldsize ? 2*oldsize : 16;
+    table->slots = (Symbol **)calloc(table->size, sizeof(*table->slots));
+    table->list = (Symbol **)realloc(table->list, (table->size/2) * sizeof(*table->list));
+    if (!table->slots || !table->list) {
+        fprintf(stderr, "FATAL ERROR: out of memory\n");
+        abort();
+    }
+    mask = table->size - 1;
+    for (i = 0; i < oldsize; i++) {
+        if (oldslots[i]) {
+            for (j = SlotIndex(oldslots[i]->hash, mask); table->slots[j]; j = (j+1) & mask)
+                ;
+            table->slots[j] = oldslots[i];
+        }
+    }
+    free(oldslots);
+}
+
 /*
  * add a symbol to the table
  * returns NULL if there was a conflict
@@ -175,40 +246,26 @@ NewSymbol(void)
 Symbol *
 AddSymbol(SymbolTable *table, const char *name, int type, void *val, const char *user_name)
 {
-    unsigned hash;
+    unsigned hash = RawSymbolHash(name);
+    Symbol **slot;
     Symbol *sym;
     int nocase = ((table->flags & SYMTAB_FLAG_NOCASE) != 0) && !gl_caseSensitive;
-    
-    hash = SymbolHash(name);
-    sym = table->hash[hash];
-    if (nocase) {
-        while (sym) {
-            if (!strcasecmp(sym->our_name, name)) {
-                if (sym->kind == SYM_WEAK_ALIAS) {
-                    // it's OK to override aliases
-                    break;
-                }
-                return NULL;
-            }
-            sym = sym->next;
+
+    GrowTable(table);
+    slot = FindSlot(table, name, hash, nocase);
+    sym = *slot;
+    if (sym) {
+        if (sym->kind != SYM_WEAK_ALIAS) {
+            return NULL;
         }
+        // it's OK to override aliases
     } else {
-        while (sym) {
-            if (!strcmp(sym->our_name, name)) {
-                if (sym->kind == SYM_WEAK_ALIAS) {
-                    // it's OK to override aliases
-                    break;
-                }
-                return NULL;
-            }
-            sym = sym->next;
-        }
-    }
-    if (!sym) {
         sym = NewSymbol();
-        sym->next = table->hash[hash];
-        table->hash[hash] = sym;
-    } 
+        sym->hash = hash;
+        sym->seq = table->count++;
+        table->list[sym->seq] = sym;
+        *slot = sym;
+    }
     sym->our_name = name;
     sym->user_name = user_name ? user_name : name;
     sym->kind = (Symtype)type;
@@ -228,6 +285,80 @@ AddInternalSymbol(SymbolTable *table, const char *name, int type, void *val, con
     return sym;
 }
 
+/*
+ * string interning: every identifier name the front ends produce goes
+ * through here, so that two equal names share one pointer and most
+ * name comparisons can stop after comparing the pointers
+ * the strings live until the compiler exits, and must never be modified
+ */
+typedef struct InternEntry {
+    const char *str;
+    unsigned hash;
+} InternEntry;
+
+static InternEntry *internSlots;
+static unsigned internSize;
+static unsigned internCount;
+static Arena internArena;
+
+static void
+GrowInternTable(void)
+{
+    InternEntry *oldslots = internSlots;
+    unsigned oldsize = internSize;
+    unsigned i, j, mask;
+
+    internSize = oldsize ? 2*oldsize : 4096;
+    internSlots = (InternEntry *)calloc(internSize, sizeof(*internSlots));
+    if (!internSlots) {
+        fprintf(stderr, "Out of memory\n");
+        abort();
+    }
+    mask = internSize - 1;
+    for (i = 0; i < oldsize; i++) {
+        if (oldslots[i].str) {
+            for (j = SlotIndex(oldslots[i].hash, mask); internSlots[j].str; j = (j+1) & mask)
+                ;
+            internSlots[j] = oldslots[i];
+        }
+    }
+    free(oldslots);
+}
+
+const char *
+InternString(const char *name)
+{
+    unsigned hash, mask, i;
+    size_t len;
+    char *str;
+
+    if (!name) {
+        return NULL;
+    }
+    jobs_lock();
+    if (2*(internCount+1) > internSize) {
+        GrowInternTable();
+    }
+    hash = RawSymbolHash(name);
+    mask = internSize - 1;
+    for (i = SlotIndex(hash, mask); internSlots[i].str; i = (i+1) & mask) {
+        if (internSlots[i].str == name
+            || (internSlots[i].hash == hash && !strcmp(internSlots[i].str, name)))
+        {
+            str = (char *)internSlots[i].str;
+            jobs_unlock();
+            return str;
+        }
+    }
+    len = strlen(name) + 1;
+    str = (char *)arena_memdup(&internArena, name, len);
+    internSlots[i].str = str;
+    internSlots[i].hash = hash;
+    internCount++;
+    jobs_unlock();
+    return str;
+}
+
 static int tmpvarnum = 1;
 static int tmpvarmax = 99999;
 
@@ -254,6 +385,7 @@ char *
 NewTemporaryVariable(const char *prefix, int *counter)
 {
     char *str;
+    const char *name;
     char buf[32];
     int countval;
     
@@ -266,13 +398,15 @@ NewTemporaryVariable(const char *prefix, int *counter)
     countval = *counter;
     sprintf(buf, "_%04d", countval);
     str = strdupcat(prefix, buf);
+    name = InternString(str);
+    free(str);
     countval++;
     if (countval > tmpvarmax) {
         fprintf(stderr, "Temporary variable limit of %d exceeded", tmpvarmax);
         abort();
     }
     *counter = countval;
-    return str;
+    return (char *)name;
 }
 
 /*
@@ -40,7 +40,8 @@ typedef enum symtype {
 // our_name is an internal name that we use for generating code
 //
 typedef struct symbol {
-    struct symbol *next;  /* next in hash table */
+    unsigned      hash;   /* RawSymbolHash(our_name) */
+    unsigned      seq;    /* order in which symbols were added to the table */
     const char   *user_name;   /* name given by the user */
     const char   *our_name;    /* internal compiler name */
     Symtype       kind;   /* kind of symbol */
@@ -68,13 +69,21 @@ typedef struct symbol {
  * next symbol table to search for if the symbol is not
  * found here. typically the search would go:
  *  function symbols -> module symbols -> global symbols
+ *
+ * the hash table uses open addressing and grows as needed; an
+ * all zero SymbolTable is a valid empty table
+ * symbols are iterated over in the order they were added, which is
+ * kept in a separate array indexed by their seq field
  */
 
 /* make this a power of two, please */
 #define SYMTABLE_HASH_SIZE 128
 
 typedef struct symtab {
-    Symbol *hash[SYMTABLE_HASH_SIZE];
+    Symbol **slots;       /* hash table, NULL where empty */
+    unsigned size;        /* number of slots (0 or a power of two) */
+    unsigned count;       /* number of symbols in the table */
+    Symbol **list;        /* symbols in the order they were added */
     struct symtab *next;
     unsigned flags;
 } SymbolTable;
@@ -98,6 +107,9 @@ Symbol *AddInternalSymbol(SymbolTable *table, const char *name, int type, void *
 /* counter is an optional pointer to the counter to increment */
 char *NewTemporaryVariable(const char *prefix, int *counter);
 
+/* return the unique shared copy of name */
+const char *InternString(const char *name);
+
 /* set the number to use in temporary variables, and the max allowed */
 /* if max <= 0 then the max is left alone */
 /* returns the old base */
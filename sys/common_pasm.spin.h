@@ -183,6 +183,61 @@ unsigned char sys_common_pasm_spin[] = {
   0x75, 0x6e, 0x6c, 0x6f, 0x63, 0x6b, 0x6d, 0x65, 0x6d, 0x28, 0x61, 0x64,
   0x64, 0x72, 0x29, 0x20, 0x7c, 0x20, 0x6f, 0x6c, 0x64, 0x6c, 0x6f, 0x63,
   0x6b, 0x0a, 0x20, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x5b, 0x61, 0x64, 0x64,
-  0x72, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x30, 0x0a, 0x20, 0x0a, 0x00
+  0x72, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x30, 0x0a, 0x20, 0x0a, 0x0a, 0x27,
+  0x27, 0x0a, 0x27, 0x27, 0x20, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x20,
+  0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69,
+  0x74, 0x68, 0x20, 0x2d, 0x2d, 0x70, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65,
+  0x2d, 0x67, 0x65, 0x6e, 0x2c, 0x20, 0x61, 0x73, 0x20, 0x6c, 0x69, 0x6e,
+  0x65, 0x73, 0x20, 0x6f, 0x66, 0x0a, 0x27, 0x27, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x22, 0x50, 0x52, 0x4f, 0x46, 0x49,
+  0x4c, 0x45, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x63, 0x6f, 0x75, 0x6e,
+  0x74, 0x22, 0x3b, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x65, 0x64, 0x20, 0x77,
+  0x68, 0x65, 0x6e, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x20, 0x72, 0x65, 0x74,
+  0x75, 0x72, 0x6e, 0x73, 0x0a, 0x27, 0x27, 0x0a, 0x70, 0x72, 0x69, 0x20,
+  0x5f, 0x70, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65, 0x5f, 0x64, 0x75, 0x6d,
+  0x70, 0x28, 0x29, 0x20, 0x7c, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x73,
+  0x2c, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x61, 0x73,
+  0x6d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x20, 0x63, 0x6f,
+  0x75, 0x6e, 0x74, 0x73, 0x2c, 0x20, 0x5f, 0x5f, 0x70, 0x72, 0x6f, 0x66,
+  0x69, 0x6c, 0x65, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x73, 0x5f, 0x70,
+  0x74, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x73, 0x2c, 0x20, 0x5f, 0x5f, 0x70, 0x72, 0x6f, 0x66,
+  0x69, 0x6c, 0x65, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x5f, 0x70, 0x74,
+  0x72, 0x0a, 0x20, 0x20, 0x65, 0x6e, 0x64, 0x61, 0x73, 0x6d, 0x0a, 0x20,
+  0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x20, 0x77, 0x68, 0x69, 0x6c,
+  0x65, 0x20, 0x62, 0x79, 0x74, 0x65, 0x5b, 0x6e, 0x61, 0x6d, 0x65, 0x73,
+  0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x70, 0x72, 0x6f, 0x66, 0x69,
+  0x6c, 0x65, 0x5f, 0x73, 0x74, 0x72, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6e,
+  0x67, 0x28, 0x22, 0x50, 0x52, 0x4f, 0x46, 0x49, 0x4c, 0x45, 0x20, 0x22,
+  0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x73,
+  0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x70, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65,
+  0x5f, 0x73, 0x74, 0x72, 0x28, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x29, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x5f, 0x74, 0x78, 0x28, 0x22, 0x20, 0x22, 0x29,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x70, 0x72, 0x6f, 0x66, 0x69, 0x6c,
+  0x65, 0x5f, 0x64, 0x65, 0x63, 0x28, 0x6c, 0x6f, 0x6e, 0x67, 0x5b, 0x63,
+  0x6f, 0x75, 0x6e, 0x74, 0x73, 0x5d, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x5f, 0x74, 0x78, 0x28, 0x31, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x73, 0x20, 0x2b, 0x3d, 0x20, 0x34, 0x0a,
+  0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x70, 0x72, 0x6f, 0x66, 0x69, 0x6c,
+  0x65, 0x5f, 0x73, 0x74, 0x72, 0x28, 0x73, 0x29, 0x20, 0x7c, 0x20, 0x63,
+  0x0a, 0x20, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x20, 0x77, 0x68,
+  0x69, 0x6c, 0x65, 0x20, 0x28, 0x63, 0x20, 0x3a, 0x3d, 0x20, 0x62, 0x79,
+  0x74, 0x65, 0x5b, 0x73, 0x2b, 0x2b, 0x5d, 0x29, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x5f, 0x74, 0x78, 0x28, 0x63, 0x29, 0x0a, 0x20, 0x20, 0x72, 0x65,
+  0x74, 0x75, 0x72, 0x6e, 0x20, 0x73, 0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20,
+  0x5f, 0x70, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65, 0x5f, 0x64, 0x65, 0x63,
+  0x28, 0x6e, 0x29, 0x20, 0x7c, 0x20, 0x64, 0x0a, 0x20, 0x20, 0x64, 0x20,
+  0x3a, 0x3d, 0x20, 0x31, 0x5f, 0x30, 0x30, 0x30, 0x5f, 0x30, 0x30, 0x30,
+  0x5f, 0x30, 0x30, 0x30, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61,
+  0x74, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x64, 0x20, 0x3e, 0x20,
+  0x31, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6e, 0x20, 0x3c, 0x20, 0x64, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x64, 0x20, 0x2f, 0x3d, 0x20, 0x31, 0x30, 0x0a,
+  0x20, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x20, 0x77, 0x68, 0x69,
+  0x6c, 0x65, 0x20, 0x64, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x74, 0x78,
+  0x28, 0x22, 0x30, 0x22, 0x20, 0x2b, 0x20, 0x6e, 0x20, 0x2f, 0x20, 0x64,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x20, 0x2f, 0x2f, 0x3d, 0x20,
+  0x64, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x64, 0x20, 0x2f, 0x3d, 0x20, 0x31,
+  0x30, 0x0a, 0x00
 };
-unsigned int sys_common_pasm_spin_len = 2218;
+unsigned int sys_common_pasm_spin_len = 2870;
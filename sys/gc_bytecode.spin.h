@@ -21,31 +21,42 @@ unsigned char sys_gc_bytecode_spin[] = {
   0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x5b, 0x73, 0x74, 0x61, 0x72, 0x74, 0x61,
   0x64, 0x64, 0x72, 0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x61,
   0x72, 0x74, 0x61, 0x64, 0x64, 0x72, 0x20, 0x2b, 0x3d, 0x20, 0x34, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x70, 0x74, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x5f,
-  0x67, 0x63, 0x5f, 0x69, 0x73, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x70, 0x74,
-  0x72, 0x28, 0x68, 0x65, 0x61, 0x70, 0x5f, 0x62, 0x61, 0x73, 0x65, 0x2c,
-  0x20, 0x68, 0x65, 0x61, 0x70, 0x5f, 0x65, 0x6e, 0x64, 0x2c, 0x20, 0x70,
-  0x74, 0x72, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x70,
-  0x74, 0x72, 0x20, 0x5f, 0x5f, 0x61, 0x6e, 0x64, 0x74, 0x68, 0x65, 0x6e,
-  0x5f, 0x5f, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x69,
-  0x73, 0x46, 0x72, 0x65, 0x65, 0x28, 0x70, 0x74, 0x72, 0x29, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x3a,
-  0x3d, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x70, 0x74, 0x72, 0x20, 0x2b,
-  0x20, 0x4f, 0x46, 0x46, 0x5f, 0x46, 0x4c, 0x41, 0x47, 0x53, 0x5d, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20,
-  0x26, 0x3d, 0x20, 0x21, 0x47, 0x43, 0x5f, 0x4f, 0x57, 0x4e, 0x45, 0x52,
-  0x5f, 0x4d, 0x41, 0x53, 0x4b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x7c, 0x3d, 0x20, 0x47, 0x43, 0x5f,
-  0x46, 0x4c, 0x41, 0x47, 0x5f, 0x49, 0x4e, 0x55, 0x53, 0x45, 0x20, 0x7c,
-  0x20, 0x47, 0x43, 0x5f, 0x4f, 0x57, 0x4e, 0x45, 0x52, 0x5f, 0x48, 0x55,
-  0x42, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x6f, 0x72, 0x64,
-  0x5b, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x46,
-  0x4c, 0x41, 0x47, 0x53, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x66, 0x6c, 0x61,
-  0x67, 0x73, 0x0a, 0x0a, 0x27, 0x20, 0x69, 0x6e, 0x20, 0x62, 0x79, 0x74,
-  0x65, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x20,
-  0x69, 0x73, 0x20, 0x6e, 0x6f, 0x20, 0x43, 0x4f, 0x47, 0x20, 0x6d, 0x65,
-  0x6d, 0x6f, 0x72, 0x79, 0x20, 0x75, 0x73, 0x65, 0x64, 0x0a, 0x70, 0x72,
-  0x69, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x6d, 0x61, 0x72, 0x6b, 0x63, 0x6f,
-  0x67, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x0a, 0x00
+  0x20, 0x20, 0x20, 0x20, 0x27, 0x20, 0x6d, 0x6f, 0x73, 0x74, 0x20, 0x6c,
+  0x6f, 0x6e, 0x67, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6e, 0x6f, 0x74,
+  0x20, 0x68, 0x65, 0x61, 0x70, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65,
+  0x72, 0x73, 0x2c, 0x20, 0x73, 0x6f, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b,
+  0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x74, 0x72, 0x20,
+  0x26, 0x20, 0x50, 0x4f, 0x49, 0x4e, 0x54, 0x45, 0x52, 0x5f, 0x4d, 0x41,
+  0x47, 0x49, 0x43, 0x5f, 0x4d, 0x41, 0x53, 0x4b, 0x29, 0x20, 0x3d, 0x3d,
+  0x20, 0x50, 0x4f, 0x49, 0x4e, 0x54, 0x45, 0x52, 0x5f, 0x4d, 0x41, 0x47,
+  0x49, 0x43, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x74, 0x72,
+  0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x69, 0x73, 0x76, 0x61,
+  0x6c, 0x69, 0x64, 0x70, 0x74, 0x72, 0x28, 0x68, 0x65, 0x61, 0x70, 0x5f,
+  0x62, 0x61, 0x73, 0x65, 0x2c, 0x20, 0x68, 0x65, 0x61, 0x70, 0x5f, 0x65,
+  0x6e, 0x64, 0x2c, 0x20, 0x70, 0x74, 0x72, 0x29, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x70, 0x74, 0x72, 0x20, 0x5f, 0x5f,
+  0x61, 0x6e, 0x64, 0x74, 0x68, 0x65, 0x6e, 0x5f, 0x5f, 0x20, 0x6e, 0x6f,
+  0x74, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x69, 0x73, 0x46, 0x72, 0x65, 0x65,
+  0x28, 0x70, 0x74, 0x72, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x3a, 0x3d, 0x20, 0x77,
+  0x6f, 0x72, 0x64, 0x5b, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x20, 0x4f, 0x46,
+  0x46, 0x5f, 0x46, 0x4c, 0x41, 0x47, 0x53, 0x5d, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x26,
+  0x3d, 0x20, 0x21, 0x47, 0x43, 0x5f, 0x4f, 0x57, 0x4e, 0x45, 0x52, 0x5f,
+  0x4d, 0x41, 0x53, 0x4b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x7c, 0x3d, 0x20, 0x47, 0x43,
+  0x5f, 0x46, 0x4c, 0x41, 0x47, 0x5f, 0x49, 0x4e, 0x55, 0x53, 0x45, 0x20,
+  0x7c, 0x20, 0x47, 0x43, 0x5f, 0x4f, 0x57, 0x4e, 0x45, 0x52, 0x5f, 0x48,
+  0x55, 0x42, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77,
+  0x6f, 0x72, 0x64, 0x5b, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x20, 0x4f, 0x46,
+  0x46, 0x5f, 0x46, 0x4c, 0x41, 0x47, 0x53, 0x5d, 0x20, 0x3a, 0x3d, 0x20,
+  0x66, 0x6c, 0x61, 0x67, 0x73, 0x0a, 0x0a, 0x27, 0x20, 0x69, 0x6e, 0x20,
+  0x62, 0x79, 0x74, 0x65, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x74, 0x68, 0x65,
+  0x72, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6e, 0x6f, 0x20, 0x43, 0x4f, 0x47,
+  0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x20, 0x75, 0x73, 0x65, 0x64,
+  0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x6d, 0x61, 0x72,
+  0x6b, 0x63, 0x6f, 0x67, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+  0x6e, 0x0a, 0x00
 };
-unsigned int sys_gc_bytecode_spin_len = 575;
+unsigned int sys_gc_bytecode_spin_len = 698;
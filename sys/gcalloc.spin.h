@@ -132,65 +132,90 @@ unsigned char sys_gcalloc_spin[] = {
   0x63, 0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x20, 0x66, 0x6f, 0x6c, 0x6c,
   0x6f, 0x77, 0x65, 0x64, 0x20, 0x69, 0x6d, 0x6d, 0x65, 0x64, 0x69, 0x61,
   0x74, 0x65, 0x6c, 0x79, 0x20, 0x62, 0x79, 0x20, 0x5f, 0x67, 0x63, 0x5f,
-  0x6d, 0x61, 0x6e, 0x61, 0x67, 0x65, 0x2e, 0x0a, 0x20, 0x20, 0x0a, 0x49,
-  0x4e, 0x54, 0x45, 0x52, 0x4e, 0x41, 0x4c, 0x53, 0x0a, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x4d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x20, 0x69, 0x73, 0x20,
-  0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x64, 0x20, 0x69, 0x6e,
-  0x20, 0x31, 0x36, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x70, 0x61, 0x67,
-  0x65, 0x73, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x77, 0x65, 0x20, 0x75,
-  0x73, 0x65, 0x20, 0x61, 0x20, 0x31, 0x36, 0x20, 0x62, 0x69, 0x74, 0x20,
-  0x73, 0x69, 0x7a, 0x65, 0x20, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x28, 0x66, 0x6f, 0x72, 0x20, 0x73, 0x69, 0x7a, 0x65,
-  0x20, 0x69, 0x6e, 0x20, 0x70, 0x61, 0x67, 0x65, 0x73, 0x29, 0x20, 0x69,
-  0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x2e,
-  0x20, 0x54, 0x68, 0x61, 0x74, 0x20, 0x6d, 0x65, 0x61, 0x6e, 0x73, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d, 0x20,
-  0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x69, 0x73, 0x20, 0x36,
-  0x35, 0x35, 0x33, 0x36, 0x20, 0x2a, 0x20, 0x31, 0x36, 0x2c, 0x20, 0x6f,
-  0x72, 0x20, 0x31, 0x20, 0x4d, 0x42, 0x2e, 0x20, 0x54, 0x68, 0x69, 0x73,
-  0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x48, 0x55, 0x42, 0x20,
-  0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20,
-  0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x50, 0x32, 0x2c, 0x20, 0x73,
-  0x6f, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x74, 0x20, 0x77, 0x6f, 0x72,
-  0x6b, 0x73, 0x20, 0x6f, 0x75, 0x74, 0x20, 0x67, 0x72, 0x65, 0x61, 0x74,
-  0x2e, 0x20, 0x46, 0x6f, 0x72, 0x20, 0x6c, 0x61, 0x72, 0x67, 0x65, 0x72,
-  0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73,
-  0x2c, 0x20, 0x75, 0x73, 0x65, 0x20, 0x61, 0x20, 0x62, 0x69, 0x67, 0x67,
-  0x65, 0x72, 0x20, 0x70, 0x61, 0x67, 0x65, 0x20, 0x73, 0x69, 0x7a, 0x65,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x6f, 0x72, 0x20, 0x63, 0x68, 0x61, 0x6e,
-  0x67, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65,
-  0x72, 0x20, 0x74, 0x6f, 0x20, 0x75, 0x73, 0x65, 0x20, 0x33, 0x32, 0x20,
-  0x62, 0x69, 0x74, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x65, 0x73, 0x20,
-  0x69, 0x6e, 0x73, 0x74, 0x65, 0x61, 0x64, 0x20, 0x6f, 0x66, 0x20, 0x31,
-  0x36, 0x20, 0x62, 0x69, 0x74, 0x20, 0x6f, 0x6e, 0x65, 0x73, 0x2e, 0x0a,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x73, 0x20,
-  0x68, 0x61, 0x76, 0x65, 0x20, 0x61, 0x6e, 0x20, 0x38, 0x20, 0x62, 0x79,
-  0x74, 0x65, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x2c, 0x20, 0x63,
-  0x6f, 0x6e, 0x73, 0x69, 0x73, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x6f, 0x66,
-  0x20, 0x34, 0x20, 0x57, 0x4f, 0x52, 0x44, 0x53, 0x3a, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x3d, 0x20, 0x73, 0x69, 0x7a,
-  0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x62, 0x6c,
-  0x6f, 0x63, 0x6b, 0x20, 0x69, 0x6e, 0x20, 0x70, 0x61, 0x67, 0x65, 0x73,
-  0x20, 0x28, 0x6d, 0x61, 0x79, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65,
-  0x64, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6e, 0x66, 0x65, 0x72, 0x20, 0x6e,
-  0x65, 0x78, 0x74, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x29, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x3d, 0x20, 0x66,
-  0x6c, 0x61, 0x67, 0x73, 0x20, 0x28, 0x73, 0x65, 0x65, 0x20, 0x62, 0x65,
-  0x6c, 0x6f, 0x77, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x65,
-  0x76, 0x20, 0x3d, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x20,
-  0x74, 0x6f, 0x20, 0x70, 0x72, 0x65, 0x76, 0x20, 0x62, 0x6c, 0x6f, 0x63,
-  0x6b, 0x20, 0x69, 0x6e, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x3d, 0x20, 0x6c,
-  0x69, 0x6e, 0x6b, 0x20, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x20, 0x66, 0x6f,
-  0x72, 0x20, 0x66, 0x72, 0x65, 0x65, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x0a,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x20, 0x6d, 0x65,
-  0x61, 0x6e, 0x69, 0x6e, 0x67, 0x3a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6c,
-  0x6f, 0x77, 0x20, 0x34, 0x20, 0x62, 0x69, 0x74, 0x73, 0x3a, 0x20, 0x43,
-  0x4f, 0x47, 0x20, 0x6f, 0x77, 0x6e, 0x65, 0x72, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x30, 0x2d, 0x37, 0x20, 0x3d, 0x3d, 0x20, 0x63, 0x6f,
-  0x67, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x63,
-  0x61, 0x74, 0x65, 0x64, 0x20, 0x74, 0x68, 0x69, 0x73, 0x0a, 0x20, 0x20,
+  0x6d, 0x61, 0x6e, 0x61, 0x67, 0x65, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x5f,
+  0x67, 0x63, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x73, 0x28, 0x6e, 0x29, 0x20,
+  0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x6f, 0x6e, 0x65, 0x20,
+  0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x63,
+  0x61, 0x74, 0x6f, 0x72, 0x27, 0x73, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74,
+  0x65, 0x72, 0x73, 0x3a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x30, 0x20, 0x3d,
+  0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x61,
+  0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x31, 0x20, 0x3d, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65,
+  0x72, 0x20, 0x6f, 0x66, 0x20, 0x67, 0x61, 0x72, 0x62, 0x61, 0x67, 0x65,
+  0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x32, 0x20, 0x3d, 0x20, 0x63, 0x79, 0x63,
+  0x6c, 0x65, 0x73, 0x20, 0x73, 0x70, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x6c,
+  0x6c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x28, 0x69, 0x6e,
+  0x63, 0x6c, 0x75, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x6e, 0x79, 0x20,
+  0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20,
+  0x74, 0x68, 0x65, 0x79, 0x20, 0x63, 0x61, 0x75, 0x73, 0x65, 0x64, 0x29,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x33, 0x20, 0x3d, 0x20, 0x63, 0x79, 0x63,
+  0x6c, 0x65, 0x73, 0x20, 0x73, 0x70, 0x65, 0x6e, 0x74, 0x20, 0x63, 0x6f,
+  0x6c, 0x6c, 0x65, 0x63, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x67, 0x61, 0x72,
+  0x62, 0x61, 0x67, 0x65, 0x0a, 0x20, 0x20, 0x0a, 0x49, 0x4e, 0x54, 0x45,
+  0x52, 0x4e, 0x41, 0x4c, 0x53, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x4d,
+  0x65, 0x6d, 0x6f, 0x72, 0x79, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6c, 0x6c,
+  0x6f, 0x63, 0x61, 0x74, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x31, 0x36,
+  0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x70, 0x61, 0x67, 0x65, 0x73, 0x2c,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x77, 0x65, 0x20, 0x75, 0x73, 0x65, 0x20,
+  0x61, 0x20, 0x31, 0x36, 0x20, 0x62, 0x69, 0x74, 0x20, 0x73, 0x69, 0x7a,
+  0x65, 0x20, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x28, 0x66, 0x6f, 0x72, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x69, 0x6e,
+  0x20, 0x70, 0x61, 0x67, 0x65, 0x73, 0x29, 0x20, 0x69, 0x6e, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x2e, 0x20, 0x54, 0x68,
+  0x61, 0x74, 0x20, 0x6d, 0x65, 0x61, 0x6e, 0x73, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d, 0x20, 0x61, 0x6c, 0x6c,
+  0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x73, 0x69, 0x7a, 0x65, 0x20, 0x69, 0x73, 0x20, 0x36, 0x35, 0x35, 0x33,
+  0x36, 0x20, 0x2a, 0x20, 0x31, 0x36, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0x31,
+  0x20, 0x4d, 0x42, 0x2e, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x48, 0x55, 0x42, 0x20, 0x6d, 0x65, 0x6d,
+  0x6f, 0x72, 0x79, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x6f, 0x66, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x50, 0x32, 0x2c, 0x20, 0x73, 0x6f, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x69, 0x74, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x73, 0x20,
+  0x6f, 0x75, 0x74, 0x20, 0x67, 0x72, 0x65, 0x61, 0x74, 0x2e, 0x20, 0x46,
+  0x6f, 0x72, 0x20, 0x6c, 0x61, 0x72, 0x67, 0x65, 0x72, 0x20, 0x61, 0x6c,
+  0x6c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2c, 0x20, 0x75,
+  0x73, 0x65, 0x20, 0x61, 0x20, 0x62, 0x69, 0x67, 0x67, 0x65, 0x72, 0x20,
+  0x70, 0x61, 0x67, 0x65, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x6f, 0x72, 0x20, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x74,
+  0x6f, 0x20, 0x75, 0x73, 0x65, 0x20, 0x33, 0x32, 0x20, 0x62, 0x69, 0x74,
+  0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x65, 0x73, 0x20, 0x69, 0x6e, 0x73,
+  0x74, 0x65, 0x61, 0x64, 0x20, 0x6f, 0x66, 0x20, 0x31, 0x36, 0x20, 0x62,
+  0x69, 0x74, 0x20, 0x6f, 0x6e, 0x65, 0x73, 0x2e, 0x0a, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x73, 0x20, 0x68, 0x61, 0x76,
+  0x65, 0x20, 0x61, 0x6e, 0x20, 0x38, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20,
+  0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73,
+  0x69, 0x73, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x6f, 0x66, 0x20, 0x34, 0x20,
+  0x57, 0x4f, 0x52, 0x44, 0x53, 0x3a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73,
+  0x69, 0x7a, 0x65, 0x20, 0x3d, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x6f,
+  0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b,
+  0x20, 0x69, 0x6e, 0x20, 0x70, 0x61, 0x67, 0x65, 0x73, 0x20, 0x28, 0x6d,
+  0x61, 0x79, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x74,
+  0x6f, 0x20, 0x69, 0x6e, 0x66, 0x65, 0x72, 0x20, 0x6e, 0x65, 0x78, 0x74,
+  0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x3d, 0x20, 0x66, 0x6c, 0x61, 0x67,
+  0x73, 0x20, 0x28, 0x73, 0x65, 0x65, 0x20, 0x62, 0x65, 0x6c, 0x6f, 0x77,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 0x76, 0x20, 0x3d,
+  0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x74, 0x6f, 0x20,
+  0x70, 0x72, 0x65, 0x76, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x69,
+  0x6e, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x3d, 0x20, 0x6c, 0x69, 0x6e, 0x6b,
+  0x20, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x66,
+  0x72, 0x65, 0x65, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x0a, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x20, 0x6d, 0x65, 0x61, 0x6e, 0x69,
+  0x6e, 0x67, 0x3a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x77, 0x20,
+  0x34, 0x20, 0x62, 0x69, 0x74, 0x73, 0x3a, 0x20, 0x43, 0x4f, 0x47, 0x20,
+  0x6f, 0x77, 0x6e, 0x65, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x30, 0x2d, 0x37, 0x20, 0x3d, 0x3d, 0x20, 0x63, 0x6f, 0x67, 0x20, 0x74,
+  0x68, 0x61, 0x74, 0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65,
+  0x64, 0x20, 0x74, 0x68, 0x69, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x24, 0x64, 0x20, 0x3d, 0x3d, 0x20, 0x65, 0x78, 0x70, 0x6c, 0x69,
+  0x63, 0x69, 0x74, 0x6c, 0x79, 0x20, 0x66, 0x72, 0x65, 0x65, 0x64, 0x2c,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x77, 0x61, 0x69, 0x74, 0x69, 0x6e, 0x67,
+  0x20, 0x6f, 0x6e, 0x20, 0x61, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x63,
+  0x6c, 0x61, 0x73, 0x73, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x0a, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x24, 0x65, 0x20, 0x3d, 0x3d, 0x20, 0x6b, 0x6e,
   0x6f, 0x77, 0x6e, 0x20, 0x74, 0x6f, 0x20, 0x62, 0x65, 0x20, 0x69, 0x6e,
   0x20, 0x48, 0x55, 0x42, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x20,
@@ -220,93 +245,155 @@ unsigned char sys_gcalloc_spin[] = {
   0x61, 0x6e, 0x64, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x73, 0x20, 0x61,
   0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x6e, 0x63, 0x68, 0x6f, 0x72,
   0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x72, 0x65,
-  0x65, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x0a, 0x7d, 0x7d, 0x0a, 0x0a, 0x63,
-  0x6f, 0x6e, 0x0a, 0x20, 0x20, 0x5f, 0x5f, 0x72, 0x65, 0x61, 0x6c, 0x5f,
-  0x68, 0x65, 0x61, 0x70, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x5f, 0x20, 0x3d,
-  0x20, 0x32, 0x35, 0x36, 0x20, 0x27, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20,
-  0x6f, 0x66, 0x20, 0x68, 0x65, 0x61, 0x70, 0x20, 0x69, 0x6e, 0x20, 0x6c,
-  0x6f, 0x6e, 0x67, 0x73, 0x2c, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x62, 0x65,
-  0x20, 0x6f, 0x76, 0x65, 0x72, 0x72, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x20,
-  0x62, 0x79, 0x20, 0x75, 0x73, 0x65, 0x72, 0x0a, 0x20, 0x20, 0x70, 0x61,
-  0x67, 0x65, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x3d, 0x20, 0x31, 0x36, 0x09,
-  0x09, 0x27, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x70,
-  0x61, 0x67, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73,
-  0x0a, 0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 0x73, 0x69, 0x7a, 0x65, 0x73,
-  0x68, 0x69, 0x66, 0x74, 0x20, 0x3d, 0x20, 0x34, 0x09, 0x27, 0x20, 0x6c,
-  0x6f, 0x67, 0x32, 0x28, 0x70, 0x61, 0x67, 0x65, 0x73, 0x69, 0x7a, 0x65,
-  0x29, 0x0a, 0x20, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x69,
-  0x7a, 0x65, 0x20, 0x3d, 0x20, 0x38, 0x20, 0x09, 0x27, 0x20, 0x6c, 0x65,
-  0x6e, 0x67, 0x74, 0x68, 0x20, 0x6f, 0x66, 0x20, 0x62, 0x6c, 0x6f, 0x63,
-  0x6b, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x0a, 0x20, 0x20, 0x70,
-  0x61, 0x67, 0x65, 0x6d, 0x61, 0x73, 0x6b, 0x20, 0x3d, 0x20, 0x70, 0x61,
-  0x67, 0x65, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x2d, 0x20, 0x31, 0x0a, 0x20,
-  0x20, 0x47, 0x43, 0x5f, 0x4d, 0x41, 0x47, 0x49, 0x43, 0x20, 0x3d, 0x20,
-  0x24, 0x36, 0x63, 0x38, 0x30, 0x0a, 0x20, 0x20, 0x47, 0x43, 0x5f, 0x4d,
-  0x41, 0x47, 0x49, 0x43, 0x5f, 0x4d, 0x41, 0x53, 0x4b, 0x20, 0x3d, 0x20,
-  0x24, 0x66, 0x66, 0x63, 0x30, 0x0a, 0x20, 0x20, 0x47, 0x43, 0x5f, 0x46,
-  0x4c, 0x41, 0x47, 0x5f, 0x46, 0x52, 0x45, 0x45, 0x20, 0x3d, 0x20, 0x24,
-  0x30, 0x30, 0x30, 0x66, 0x0a, 0x20, 0x20, 0x47, 0x43, 0x5f, 0x4f, 0x57,
-  0x4e, 0x45, 0x52, 0x5f, 0x48, 0x55, 0x42, 0x20, 0x3d, 0x20, 0x24, 0x30,
-  0x30, 0x30, 0x65, 0x0a, 0x20, 0x20, 0x47, 0x43, 0x5f, 0x4f, 0x57, 0x4e,
-  0x45, 0x52, 0x5f, 0x4d, 0x41, 0x53, 0x4b, 0x20, 0x3d, 0x20, 0x24, 0x30,
-  0x30, 0x30, 0x66, 0x0a, 0x20, 0x20, 0x47, 0x43, 0x5f, 0x46, 0x4c, 0x41,
-  0x47, 0x5f, 0x52, 0x45, 0x53, 0x45, 0x52, 0x56, 0x45, 0x44, 0x20, 0x3d,
-  0x20, 0x24, 0x30, 0x30, 0x31, 0x30, 0x0a, 0x20, 0x20, 0x47, 0x43, 0x5f,
-  0x46, 0x4c, 0x41, 0x47, 0x5f, 0x49, 0x4e, 0x55, 0x53, 0x45, 0x20, 0x3d,
-  0x20, 0x24, 0x30, 0x30, 0x32, 0x30, 0x0a, 0x20, 0x20, 0x0a, 0x20, 0x20,
-  0x27, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x6f, 0x66, 0x66, 0x73, 0x65,
-  0x74, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72,
-  0x0a, 0x20, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x53, 0x49, 0x5a, 0x45, 0x20,
-  0x3d, 0x20, 0x30, 0x0a, 0x20, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x46, 0x4c,
-  0x41, 0x47, 0x53, 0x20, 0x3d, 0x20, 0x32, 0x0a, 0x20, 0x20, 0x4f, 0x46,
-  0x46, 0x5f, 0x50, 0x52, 0x45, 0x56, 0x20, 0x3d, 0x20, 0x34, 0x0a, 0x20,
-  0x20, 0x4f, 0x46, 0x46, 0x5f, 0x4c, 0x49, 0x4e, 0x4b, 0x20, 0x3d, 0x20,
-  0x36, 0x0a, 0x0a, 0x20, 0x20, 0x27, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69,
-  0x61, 0x6c, 0x20, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x73, 0x20, 0x66,
-  0x6f, 0x72, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x30, 0x0a, 0x20,
-  0x20, 0x4f, 0x46, 0x46, 0x5f, 0x55, 0x53, 0x45, 0x44, 0x5f, 0x4c, 0x49,
-  0x4e, 0x4b, 0x20, 0x3d, 0x20, 0x38, 0x0a, 0x0a, 0x20, 0x20, 0x27, 0x20,
-  0x6d, 0x61, 0x67, 0x69, 0x63, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61,
-  0x6e, 0x74, 0x20, 0x61, 0x64, 0x64, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20,
-  0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x20, 0x73, 0x6f, 0x20,
-  0x77, 0x65, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x73, 0x70, 0x6f, 0x74, 0x20,
-  0x74, 0x68, 0x65, 0x6d, 0x0a, 0x20, 0x20, 0x27, 0x20, 0x6d, 0x6f, 0x72,
-  0x65, 0x20, 0x65, 0x61, 0x73, 0x69, 0x6c, 0x79, 0x0a, 0x20, 0x20, 0x50,
+  0x65, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x0a, 0x20, 0x20, 0x69, 0x74, 0x20,
+  0x69, 0x73, 0x20, 0x33, 0x20, 0x70, 0x61, 0x67, 0x65, 0x73, 0x20, 0x6c,
+  0x6f, 0x6e, 0x67, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x61, 0x66, 0x74,
+  0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20,
+  0x6c, 0x69, 0x73, 0x74, 0x20, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x68, 0x6f,
+  0x6c, 0x64, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x65, 0x61, 0x64,
+  0x73, 0x20, 0x6f, 0x66, 0x0a, 0x20, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73,
+  0x69, 0x7a, 0x65, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x20, 0x6c, 0x69,
+  0x73, 0x74, 0x73, 0x2c, 0x20, 0x66, 0x6f, 0x6c, 0x6c, 0x6f, 0x77, 0x65,
+  0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x75,
+  0x6e, 0x74, 0x65, 0x72, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x5f, 0x67,
+  0x63, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x73, 0x2e, 0x0a, 0x20, 0x20, 0x42,
+  0x6c, 0x6f, 0x63, 0x6b, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x31, 0x20, 0x74,
+  0x6f, 0x20, 0x47, 0x43, 0x5f, 0x4e, 0x55, 0x4d, 0x5f, 0x43, 0x4c, 0x41,
+  0x53, 0x53, 0x45, 0x53, 0x20, 0x70, 0x61, 0x67, 0x65, 0x73, 0x20, 0x77,
+  0x68, 0x69, 0x63, 0x68, 0x20, 0x77, 0x65, 0x72, 0x65, 0x20, 0x66, 0x72,
+  0x65, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x5f, 0x67, 0x63,
+  0x5f, 0x66, 0x72, 0x65, 0x65, 0x0a, 0x20, 0x20, 0x61, 0x72, 0x65, 0x20,
+  0x6b, 0x65, 0x70, 0x74, 0x20, 0x6f, 0x6e, 0x20, 0x61, 0x20, 0x6c, 0x69,
+  0x73, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72,
+  0x20, 0x73, 0x69, 0x7a, 0x65, 0x2c, 0x20, 0x73, 0x6f, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x63,
+  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x61,
+  0x74, 0x0a, 0x20, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x6e, 0x65, 0x65,
+  0x64, 0x73, 0x20, 0x6e, 0x6f, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68,
+  0x2e, 0x20, 0x54, 0x68, 0x65, 0x79, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6e,
+  0x6f, 0x74, 0x20, 0x6d, 0x65, 0x72, 0x67, 0x65, 0x64, 0x20, 0x77, 0x69,
+  0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x6e, 0x65, 0x69,
+  0x67, 0x68, 0x62, 0x6f, 0x75, 0x72, 0x73, 0x0a, 0x20, 0x20, 0x75, 0x6e,
+  0x74, 0x69, 0x6c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x65, 0x78, 0x74,
+  0x20, 0x67, 0x61, 0x72, 0x62, 0x61, 0x67, 0x65, 0x20, 0x63, 0x6f, 0x6c,
+  0x6c, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x0a, 0x7d, 0x7d, 0x0a,
+  0x0a, 0x63, 0x6f, 0x6e, 0x0a, 0x20, 0x20, 0x5f, 0x5f, 0x72, 0x65, 0x61,
+  0x6c, 0x5f, 0x68, 0x65, 0x61, 0x70, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x5f,
+  0x20, 0x3d, 0x20, 0x32, 0x35, 0x36, 0x20, 0x27, 0x20, 0x73, 0x69, 0x7a,
+  0x65, 0x20, 0x6f, 0x66, 0x20, 0x68, 0x65, 0x61, 0x70, 0x20, 0x69, 0x6e,
+  0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x73, 0x2c, 0x20, 0x6d, 0x61, 0x79, 0x20,
+  0x62, 0x65, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x72, 0x69, 0x64, 0x64, 0x65,
+  0x6e, 0x20, 0x62, 0x79, 0x20, 0x75, 0x73, 0x65, 0x72, 0x0a, 0x20, 0x20,
+  0x70, 0x61, 0x67, 0x65, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x3d, 0x20, 0x31,
+  0x36, 0x09, 0x09, 0x27, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x6f, 0x66,
+  0x20, 0x70, 0x61, 0x67, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x62, 0x79, 0x74,
+  0x65, 0x73, 0x0a, 0x20, 0x20, 0x70, 0x61, 0x67, 0x65, 0x73, 0x69, 0x7a,
+  0x65, 0x73, 0x68, 0x69, 0x66, 0x74, 0x20, 0x3d, 0x20, 0x34, 0x09, 0x27,
+  0x20, 0x6c, 0x6f, 0x67, 0x32, 0x28, 0x70, 0x61, 0x67, 0x65, 0x73, 0x69,
+  0x7a, 0x65, 0x29, 0x0a, 0x20, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72,
+  0x73, 0x69, 0x7a, 0x65, 0x20, 0x3d, 0x20, 0x38, 0x20, 0x09, 0x27, 0x20,
+  0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x6f, 0x66, 0x20, 0x62, 0x6c,
+  0x6f, 0x63, 0x6b, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x0a, 0x20,
+  0x20, 0x70, 0x61, 0x67, 0x65, 0x6d, 0x61, 0x73, 0x6b, 0x20, 0x3d, 0x20,
+  0x70, 0x61, 0x67, 0x65, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x2d, 0x20, 0x31,
+  0x0a, 0x20, 0x20, 0x47, 0x43, 0x5f, 0x4d, 0x41, 0x47, 0x49, 0x43, 0x20,
+  0x3d, 0x20, 0x24, 0x36, 0x63, 0x38, 0x30, 0x0a, 0x20, 0x20, 0x47, 0x43,
+  0x5f, 0x4d, 0x41, 0x47, 0x49, 0x43, 0x5f, 0x4d, 0x41, 0x53, 0x4b, 0x20,
+  0x3d, 0x20, 0x24, 0x66, 0x66, 0x63, 0x30, 0x0a, 0x20, 0x20, 0x47, 0x43,
+  0x5f, 0x46, 0x4c, 0x41, 0x47, 0x5f, 0x46, 0x52, 0x45, 0x45, 0x20, 0x3d,
+  0x20, 0x24, 0x30, 0x30, 0x30, 0x66, 0x0a, 0x20, 0x20, 0x47, 0x43, 0x5f,
+  0x4f, 0x57, 0x4e, 0x45, 0x52, 0x5f, 0x48, 0x55, 0x42, 0x20, 0x3d, 0x20,
+  0x24, 0x30, 0x30, 0x30, 0x65, 0x0a, 0x20, 0x20, 0x47, 0x43, 0x5f, 0x4f,
+  0x57, 0x4e, 0x45, 0x52, 0x5f, 0x43, 0x41, 0x43, 0x48, 0x45, 0x44, 0x20,
+  0x3d, 0x20, 0x24, 0x30, 0x30, 0x30, 0x64, 0x0a, 0x20, 0x20, 0x47, 0x43,
+  0x5f, 0x4f, 0x57, 0x4e, 0x45, 0x52, 0x5f, 0x4d, 0x41, 0x53, 0x4b, 0x20,
+  0x3d, 0x20, 0x24, 0x30, 0x30, 0x30, 0x66, 0x0a, 0x20, 0x20, 0x47, 0x43,
+  0x5f, 0x46, 0x4c, 0x41, 0x47, 0x5f, 0x52, 0x45, 0x53, 0x45, 0x52, 0x56,
+  0x45, 0x44, 0x20, 0x3d, 0x20, 0x24, 0x30, 0x30, 0x31, 0x30, 0x0a, 0x20,
+  0x20, 0x47, 0x43, 0x5f, 0x46, 0x4c, 0x41, 0x47, 0x5f, 0x49, 0x4e, 0x55,
+  0x53, 0x45, 0x20, 0x3d, 0x20, 0x24, 0x30, 0x30, 0x32, 0x30, 0x0a, 0x20,
+  0x20, 0x0a, 0x20, 0x20, 0x27, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x6f,
+  0x66, 0x66, 0x73, 0x65, 0x74, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x68, 0x65,
+  0x61, 0x64, 0x65, 0x72, 0x0a, 0x20, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x53,
+  0x49, 0x5a, 0x45, 0x20, 0x3d, 0x20, 0x30, 0x0a, 0x20, 0x20, 0x4f, 0x46,
+  0x46, 0x5f, 0x46, 0x4c, 0x41, 0x47, 0x53, 0x20, 0x3d, 0x20, 0x32, 0x0a,
+  0x20, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x50, 0x52, 0x45, 0x56, 0x20, 0x3d,
+  0x20, 0x34, 0x0a, 0x20, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x4c, 0x49, 0x4e,
+  0x4b, 0x20, 0x3d, 0x20, 0x36, 0x0a, 0x0a, 0x20, 0x20, 0x27, 0x20, 0x73,
+  0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x20, 0x6f, 0x66, 0x66, 0x73, 0x65,
+  0x74, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b,
+  0x20, 0x30, 0x0a, 0x20, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x55, 0x53, 0x45,
+  0x44, 0x5f, 0x4c, 0x49, 0x4e, 0x4b, 0x20, 0x3d, 0x20, 0x38, 0x0a, 0x20,
+  0x20, 0x4f, 0x46, 0x46, 0x5f, 0x43, 0x4c, 0x41, 0x53, 0x53, 0x20, 0x3d,
+  0x20, 0x31, 0x32, 0x09, 0x27, 0x20, 0x68, 0x65, 0x61, 0x64, 0x73, 0x20,
+  0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20,
+  0x63, 0x6c, 0x61, 0x73, 0x73, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x73, 0x0a,
+  0x20, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x53, 0x54, 0x41, 0x54, 0x53, 0x20,
+  0x3d, 0x20, 0x33, 0x32, 0x09, 0x27, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74,
+  0x65, 0x72, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x5f, 0x67, 0x63, 0x5f,
+  0x73, 0x74, 0x61, 0x74, 0x73, 0x0a, 0x20, 0x20, 0x61, 0x6e, 0x63, 0x68,
+  0x6f, 0x72, 0x70, 0x61, 0x67, 0x65, 0x73, 0x20, 0x3d, 0x20, 0x33, 0x09,
+  0x27, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x62, 0x6c,
+  0x6f, 0x63, 0x6b, 0x20, 0x30, 0x0a, 0x20, 0x20, 0x47, 0x43, 0x5f, 0x4e,
+  0x55, 0x4d, 0x5f, 0x43, 0x4c, 0x41, 0x53, 0x53, 0x45, 0x53, 0x20, 0x3d,
+  0x20, 0x38, 0x09, 0x27, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x63, 0x6c,
+  0x61, 0x73, 0x73, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x31, 0x20,
+  0x74, 0x6f, 0x20, 0x38, 0x20, 0x70, 0x61, 0x67, 0x65, 0x73, 0x0a, 0x0a,
+  0x20, 0x20, 0x27, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73,
+  0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x65, 0x64, 0x20, 0x62, 0x79,
+  0x20, 0x5f, 0x67, 0x63, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x73, 0x0a, 0x20,
+  0x20, 0x47, 0x43, 0x5f, 0x53, 0x54, 0x41, 0x54, 0x5f, 0x41, 0x4c, 0x4c,
+  0x4f, 0x43, 0x53, 0x20, 0x3d, 0x20, 0x30, 0x0a, 0x20, 0x20, 0x47, 0x43,
+  0x5f, 0x53, 0x54, 0x41, 0x54, 0x5f, 0x43, 0x4f, 0x4c, 0x4c, 0x45, 0x43,
+  0x54, 0x53, 0x20, 0x3d, 0x20, 0x31, 0x0a, 0x20, 0x20, 0x47, 0x43, 0x5f,
+  0x53, 0x54, 0x41, 0x54, 0x5f, 0x41, 0x4c, 0x4c, 0x4f, 0x43, 0x5f, 0x43,
+  0x59, 0x43, 0x4c, 0x45, 0x53, 0x20, 0x3d, 0x20, 0x32, 0x0a, 0x20, 0x20,
+  0x47, 0x43, 0x5f, 0x53, 0x54, 0x41, 0x54, 0x5f, 0x43, 0x4f, 0x4c, 0x4c,
+  0x45, 0x43, 0x54, 0x5f, 0x43, 0x59, 0x43, 0x4c, 0x45, 0x53, 0x20, 0x3d,
+  0x20, 0x33, 0x0a, 0x20, 0x20, 0x47, 0x43, 0x5f, 0x4e, 0x55, 0x4d, 0x5f,
+  0x53, 0x54, 0x41, 0x54, 0x53, 0x20, 0x3d, 0x20, 0x34, 0x0a, 0x0a, 0x20,
+  0x20, 0x27, 0x20, 0x6d, 0x61, 0x67, 0x69, 0x63, 0x20, 0x63, 0x6f, 0x6e,
+  0x73, 0x74, 0x61, 0x6e, 0x74, 0x20, 0x61, 0x64, 0x64, 0x65, 0x64, 0x20,
+  0x74, 0x6f, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x20,
+  0x73, 0x6f, 0x20, 0x77, 0x65, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x73, 0x70,
+  0x6f, 0x74, 0x20, 0x74, 0x68, 0x65, 0x6d, 0x0a, 0x20, 0x20, 0x27, 0x20,
+  0x6d, 0x6f, 0x72, 0x65, 0x20, 0x65, 0x61, 0x73, 0x69, 0x6c, 0x79, 0x0a,
+  0x20, 0x20, 0x50, 0x4f, 0x49, 0x4e, 0x54, 0x45, 0x52, 0x5f, 0x4d, 0x41,
+  0x47, 0x49, 0x43, 0x20, 0x3d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24,
+  0x36, 0x33, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0a, 0x20, 0x20, 0x50,
   0x4f, 0x49, 0x4e, 0x54, 0x45, 0x52, 0x5f, 0x4d, 0x41, 0x47, 0x49, 0x43,
-  0x20, 0x3d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x36, 0x33, 0x38,
-  0x30, 0x30, 0x30, 0x30, 0x30, 0x0a, 0x20, 0x20, 0x50, 0x4f, 0x49, 0x4e,
-  0x54, 0x45, 0x52, 0x5f, 0x4d, 0x41, 0x47, 0x49, 0x43, 0x5f, 0x4d, 0x41,
-  0x53, 0x4b, 0x20, 0x3d, 0x20, 0x24, 0x66, 0x66, 0x66, 0x30, 0x30, 0x30,
-  0x30, 0x30, 0x0a, 0x0a, 0x64, 0x61, 0x74, 0x0a, 0x5f, 0x6d, 0x65, 0x6d,
-  0x6f, 0x72, 0x79, 0x5f, 0x6d, 0x75, 0x74, 0x65, 0x78, 0x0a, 0x20, 0x20,
-  0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x30, 0x0a, 0x0a, 0x20, 0x20, 0x0a, 0x27,
-  0x27, 0x0a, 0x27, 0x27, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20,
-  0x67, 0x63, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x0a,
-  0x27, 0x27, 0x20, 0x69, 0x66, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x65, 0x64,
-  0x20, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x20, 0x67, 0x63, 0x20, 0x70,
-  0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20,
-  0x73, 0x65, 0x74, 0x20, 0x75, 0x70, 0x2c, 0x20, 0x69, 0x6e, 0x69, 0x74,
-  0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x0a, 0x27, 0x27, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x68, 0x65, 0x61, 0x70, 0x0a, 0x27, 0x27, 0x0a, 0x70, 0x72,
-  0x69, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x70, 0x74, 0x72, 0x73, 0x20, 0x3a,
-  0x20, 0x62, 0x61, 0x73, 0x65, 0x2c, 0x20, 0x65, 0x6e, 0x64, 0x20, 0x7c,
-  0x20, 0x73, 0x69, 0x7a, 0x65, 0x0a, 0x20, 0x20, 0x62, 0x61, 0x73, 0x65,
-  0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x68, 0x65,
-  0x61, 0x70, 0x5f, 0x62, 0x61, 0x73, 0x65, 0x20, 0x20, 0x27, 0x20, 0x5f,
-  0x5f, 0x68, 0x65, 0x61, 0x70, 0x5f, 0x70, 0x74, 0x72, 0x20, 0x69, 0x73,
-  0x20, 0x61, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x20, 0x76,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x0a, 0x20, 0x20, 0x65, 0x6e,
-  0x64, 0x20, 0x3a, 0x3d, 0x20, 0x62, 0x61, 0x73, 0x65, 0x20, 0x2b, 0x20,
-  0x28, 0x5f, 0x5f, 0x72, 0x65, 0x61, 0x6c, 0x5f, 0x68, 0x65, 0x61, 0x70,
-  0x73, 0x69, 0x7a, 0x65, 0x5f, 0x5f, 0x2a, 0x34, 0x29, 0x20, 0x2d, 0x20,
-  0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x69, 0x7a, 0x65, 0x0a, 0x20,
-  0x20, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x6f, 0x6e, 0x67, 0x5b, 0x62, 0x61,
-  0x73, 0x65, 0x5d, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x3a, 0x3d, 0x20, 0x65, 0x6e,
-  0x64, 0x20, 0x2d, 0x20, 0x62, 0x61, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x62, 0x61, 0x73, 0x65, 0x20, 0x2b,
-  0x20, 0x4f, 0x46, 0x46, 0x5f, 0x53, 0x49, 0x5a, 0x45, 0x5d, 0x20, 0x3a,
-  0x3d, 0x20, 0x31, 0x20, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x77, 0x6f, 0x72,
+  0x5f, 0x4d, 0x41, 0x53, 0x4b, 0x20, 0x3d, 0x20, 0x24, 0x66, 0x66, 0x66,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x0a, 0x0a, 0x64, 0x61, 0x74, 0x0a, 0x5f,
+  0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x5f, 0x6d, 0x75, 0x74, 0x65, 0x78,
+  0x0a, 0x20, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x30, 0x0a, 0x0a, 0x20,
+  0x20, 0x0a, 0x27, 0x27, 0x0a, 0x27, 0x27, 0x20, 0x72, 0x65, 0x74, 0x75,
+  0x72, 0x6e, 0x20, 0x67, 0x63, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65,
+  0x72, 0x73, 0x0a, 0x27, 0x27, 0x20, 0x69, 0x66, 0x20, 0x63, 0x61, 0x6c,
+  0x6c, 0x65, 0x64, 0x20, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x20, 0x67,
+  0x63, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x20, 0x61,
+  0x72, 0x65, 0x20, 0x73, 0x65, 0x74, 0x20, 0x75, 0x70, 0x2c, 0x20, 0x69,
+  0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x0a, 0x27, 0x27,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x65, 0x61, 0x70, 0x0a, 0x27, 0x27,
+  0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x70, 0x74, 0x72,
+  0x73, 0x20, 0x3a, 0x20, 0x62, 0x61, 0x73, 0x65, 0x2c, 0x20, 0x65, 0x6e,
+  0x64, 0x20, 0x7c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x0a, 0x20, 0x20, 0x62,
+  0x61, 0x73, 0x65, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x5f, 0x67, 0x65, 0x74,
+  0x5f, 0x68, 0x65, 0x61, 0x70, 0x5f, 0x62, 0x61, 0x73, 0x65, 0x20, 0x20,
+  0x27, 0x20, 0x5f, 0x5f, 0x68, 0x65, 0x61, 0x70, 0x5f, 0x70, 0x74, 0x72,
+  0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61,
+  0x6c, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x0a, 0x20,
+  0x20, 0x65, 0x6e, 0x64, 0x20, 0x3a, 0x3d, 0x20, 0x62, 0x61, 0x73, 0x65,
+  0x20, 0x2b, 0x20, 0x28, 0x5f, 0x5f, 0x72, 0x65, 0x61, 0x6c, 0x5f, 0x68,
+  0x65, 0x61, 0x70, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x5f, 0x2a, 0x34, 0x29,
+  0x20, 0x2d, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x69, 0x7a,
+  0x65, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x6f, 0x6e, 0x67,
+  0x5b, 0x62, 0x61, 0x73, 0x65, 0x5d, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x3a, 0x3d,
+  0x20, 0x65, 0x6e, 0x64, 0x20, 0x2d, 0x20, 0x62, 0x61, 0x73, 0x65, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x62, 0x61, 0x73,
+  0x65, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x53, 0x49, 0x5a, 0x45,
+  0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x61, 0x6e, 0x63, 0x68, 0x6f, 0x72, 0x70,
+  0x61, 0x67, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x77, 0x6f, 0x72,
   0x64, 0x5b, 0x62, 0x61, 0x73, 0x65, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46,
   0x5f, 0x46, 0x4c, 0x41, 0x47, 0x53, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x47,
   0x43, 0x5f, 0x4d, 0x41, 0x47, 0x49, 0x43, 0x20, 0x7c, 0x20, 0x47, 0x43,
@@ -316,384 +403,426 @@ unsigned char sys_gcalloc_spin[] = {
   0x52, 0x45, 0x56, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x30, 0x0a, 0x20, 0x20,
   0x20, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x62, 0x61, 0x73, 0x65, 0x20,
   0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x4c, 0x49, 0x4e, 0x4b, 0x5d, 0x20,
-  0x3a, 0x3d, 0x20, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x73,
-  0x65, 0x20, 0x2b, 0x3d, 0x20, 0x70, 0x61, 0x67, 0x65, 0x73, 0x69, 0x7a,
+  0x3a, 0x3d, 0x20, 0x61, 0x6e, 0x63, 0x68, 0x6f, 0x72, 0x70, 0x61, 0x67,
+  0x65, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x66,
+  0x69, 0x6c, 0x6c, 0x28, 0x62, 0x61, 0x73, 0x65, 0x20, 0x2b, 0x20, 0x4f,
+  0x46, 0x46, 0x5f, 0x53, 0x54, 0x41, 0x54, 0x53, 0x2c, 0x20, 0x30, 0x2c,
+  0x20, 0x47, 0x43, 0x5f, 0x4e, 0x55, 0x4d, 0x5f, 0x53, 0x54, 0x41, 0x54,
+  0x53, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x73, 0x65, 0x20,
+  0x2b, 0x3d, 0x20, 0x61, 0x6e, 0x63, 0x68, 0x6f, 0x72, 0x70, 0x61, 0x67,
+  0x65, 0x73, 0x20, 0x2a, 0x20, 0x70, 0x61, 0x67, 0x65, 0x73, 0x69, 0x7a,
   0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x62,
   0x61, 0x73, 0x65, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x53, 0x49,
   0x5a, 0x45, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65,
   0x20, 0x2f, 0x20, 0x70, 0x61, 0x67, 0x65, 0x73, 0x69, 0x7a, 0x65, 0x29,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x62, 0x61,
-  0x73, 0x65, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x46, 0x4c, 0x41,
-  0x47, 0x53, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x47, 0x43, 0x5f, 0x4d, 0x41,
-  0x47, 0x49, 0x43, 0x20, 0x7c, 0x20, 0x47, 0x43, 0x5f, 0x46, 0x4c, 0x41,
-  0x47, 0x5f, 0x46, 0x52, 0x45, 0x45, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x77,
-  0x6f, 0x72, 0x64, 0x5b, 0x62, 0x61, 0x73, 0x65, 0x20, 0x2b, 0x20, 0x4f,
-  0x46, 0x46, 0x5f, 0x50, 0x52, 0x45, 0x56, 0x5d, 0x20, 0x3a, 0x3d, 0x20,
-  0x30, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x62,
-  0x61, 0x73, 0x65, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x4c, 0x49,
-  0x4e, 0x4b, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x30, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x62, 0x61, 0x73, 0x65, 0x20, 0x2d, 0x3d, 0x20, 0x70, 0x61, 0x67,
-  0x65, 0x73, 0x69, 0x7a, 0x65, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75,
-  0x72, 0x6e, 0x20, 0x28, 0x62, 0x61, 0x73, 0x65, 0x2c, 0x20, 0x65, 0x6e,
-  0x64, 0x29, 0x0a, 0x0a, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
-  0x20, 0x61, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x74,
-  0x6f, 0x20, 0x70, 0x61, 0x67, 0x65, 0x20, 0x69, 0x20, 0x69, 0x6e, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x68, 0x65, 0x61, 0x70, 0x20, 0x7d, 0x0a, 0x70,
-  0x72, 0x69, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x70, 0x61, 0x67, 0x65, 0x70,
-  0x74, 0x72, 0x28, 0x68, 0x65, 0x61, 0x70, 0x62, 0x61, 0x73, 0x65, 0x2c,
-  0x20, 0x69, 0x29, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x69, 0x20,
-  0x3d, 0x3d, 0x20, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65,
-  0x74, 0x75, 0x72, 0x6e, 0x20, 0x30, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x74,
-  0x75, 0x72, 0x6e, 0x20, 0x68, 0x65, 0x61, 0x70, 0x62, 0x61, 0x73, 0x65,
-  0x20, 0x2b, 0x20, 0x28, 0x69, 0x20, 0x3c, 0x3c, 0x20, 0x70, 0x61, 0x67,
-  0x65, 0x73, 0x69, 0x7a, 0x65, 0x73, 0x68, 0x69, 0x66, 0x74, 0x29, 0x0a,
-  0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x70, 0x61, 0x67,
-  0x65, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x28, 0x68, 0x65, 0x61, 0x70, 0x62,
-  0x61, 0x73, 0x65, 0x2c, 0x20, 0x70, 0x74, 0x72, 0x29, 0x0a, 0x20, 0x20,
-  0x69, 0x66, 0x20, 0x28, 0x70, 0x74, 0x72, 0x20, 0x3d, 0x3d, 0x20, 0x30,
-  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
-  0x20, 0x30, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20,
-  0x28, 0x70, 0x74, 0x72, 0x20, 0x2d, 0x20, 0x68, 0x65, 0x61, 0x70, 0x62,
-  0x61, 0x73, 0x65, 0x29, 0x20, 0x3e, 0x3e, 0x20, 0x70, 0x61, 0x67, 0x65,
-  0x73, 0x69, 0x7a, 0x65, 0x73, 0x68, 0x69, 0x66, 0x74, 0x0a, 0x20, 0x20,
-  0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x69, 0x73, 0x46,
-  0x72, 0x65, 0x65, 0x28, 0x70, 0x74, 0x72, 0x29, 0x0a, 0x20, 0x20, 0x72,
-  0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x70,
-  0x74, 0x72, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x46, 0x4c, 0x41,
-  0x47, 0x53, 0x5d, 0x20, 0x3d, 0x3d, 0x20, 0x47, 0x43, 0x5f, 0x4d, 0x41,
-  0x47, 0x49, 0x43, 0x20, 0x2b, 0x20, 0x47, 0x43, 0x5f, 0x46, 0x4c, 0x41,
-  0x47, 0x5f, 0x46, 0x52, 0x45, 0x45, 0x0a, 0x0a, 0x27, 0x20, 0x67, 0x6f,
-  0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x65, 0x78, 0x74,
-  0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x6c, 0x69, 0x73,
-  0x74, 0x20, 0x6f, 0x66, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x73, 0x0a,
-  0x70, 0x72, 0x69, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x6e, 0x65, 0x78, 0x74,
-  0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x50, 0x74, 0x72, 0x28, 0x70, 0x74, 0x72,
-  0x29, 0x20, 0x7c, 0x20, 0x74, 0x0a, 0x20, 0x20, 0x74, 0x20, 0x3a, 0x3d,
+  0x20, 0x2d, 0x20, 0x28, 0x61, 0x6e, 0x63, 0x68, 0x6f, 0x72, 0x70, 0x61,
+  0x67, 0x65, 0x73, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x62, 0x61, 0x73, 0x65, 0x20, 0x2b,
+  0x20, 0x4f, 0x46, 0x46, 0x5f, 0x46, 0x4c, 0x41, 0x47, 0x53, 0x5d, 0x20,
+  0x3a, 0x3d, 0x20, 0x47, 0x43, 0x5f, 0x4d, 0x41, 0x47, 0x49, 0x43, 0x20,
+  0x7c, 0x20, 0x47, 0x43, 0x5f, 0x46, 0x4c, 0x41, 0x47, 0x5f, 0x46, 0x52,
+  0x45, 0x45, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b,
+  0x62, 0x61, 0x73, 0x65, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x50,
+  0x52, 0x45, 0x56, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x30, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x62, 0x61, 0x73, 0x65, 0x20,
+  0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x4c, 0x49, 0x4e, 0x4b, 0x5d, 0x20,
+  0x3a, 0x3d, 0x20, 0x30, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x73,
+  0x65, 0x20, 0x2d, 0x3d, 0x20, 0x61, 0x6e, 0x63, 0x68, 0x6f, 0x72, 0x70,
+  0x61, 0x67, 0x65, 0x73, 0x20, 0x2a, 0x20, 0x70, 0x61, 0x67, 0x65, 0x73,
+  0x69, 0x7a, 0x65, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
+  0x20, 0x28, 0x62, 0x61, 0x73, 0x65, 0x2c, 0x20, 0x65, 0x6e, 0x64, 0x29,
+  0x0a, 0x0a, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x61,
+  0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x74, 0x6f, 0x20,
+  0x70, 0x61, 0x67, 0x65, 0x20, 0x69, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x68, 0x65, 0x61, 0x70, 0x20, 0x7d, 0x0a, 0x70, 0x72, 0x69,
+  0x20, 0x5f, 0x67, 0x63, 0x5f, 0x70, 0x61, 0x67, 0x65, 0x70, 0x74, 0x72,
+  0x28, 0x68, 0x65, 0x61, 0x70, 0x62, 0x61, 0x73, 0x65, 0x2c, 0x20, 0x69,
+  0x29, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x69, 0x20, 0x3d, 0x3d,
+  0x20, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75,
+  0x72, 0x6e, 0x20, 0x30, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+  0x6e, 0x20, 0x68, 0x65, 0x61, 0x70, 0x62, 0x61, 0x73, 0x65, 0x20, 0x2b,
+  0x20, 0x28, 0x69, 0x20, 0x3c, 0x3c, 0x20, 0x70, 0x61, 0x67, 0x65, 0x73,
+  0x69, 0x7a, 0x65, 0x73, 0x68, 0x69, 0x66, 0x74, 0x29, 0x0a, 0x0a, 0x70,
+  0x72, 0x69, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x70, 0x61, 0x67, 0x65, 0x69,
+  0x6e, 0x64, 0x65, 0x78, 0x28, 0x68, 0x65, 0x61, 0x70, 0x62, 0x61, 0x73,
+  0x65, 0x2c, 0x20, 0x70, 0x74, 0x72, 0x29, 0x0a, 0x20, 0x20, 0x69, 0x66,
+  0x20, 0x28, 0x70, 0x74, 0x72, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x30,
+  0x0a, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x28, 0x70,
+  0x74, 0x72, 0x20, 0x2d, 0x20, 0x68, 0x65, 0x61, 0x70, 0x62, 0x61, 0x73,
+  0x65, 0x29, 0x20, 0x3e, 0x3e, 0x20, 0x70, 0x61, 0x67, 0x65, 0x73, 0x69,
+  0x7a, 0x65, 0x73, 0x68, 0x69, 0x66, 0x74, 0x0a, 0x20, 0x20, 0x0a, 0x70,
+  0x72, 0x69, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x69, 0x73, 0x46, 0x72, 0x65,
+  0x65, 0x28, 0x70, 0x74, 0x72, 0x29, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x74,
+  0x75, 0x72, 0x6e, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x70, 0x74, 0x72,
+  0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x46, 0x4c, 0x41, 0x47, 0x53,
+  0x5d, 0x20, 0x3d, 0x3d, 0x20, 0x47, 0x43, 0x5f, 0x4d, 0x41, 0x47, 0x49,
+  0x43, 0x20, 0x2b, 0x20, 0x47, 0x43, 0x5f, 0x46, 0x4c, 0x41, 0x47, 0x5f,
+  0x46, 0x52, 0x45, 0x45, 0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x67,
+  0x63, 0x5f, 0x69, 0x73, 0x43, 0x61, 0x63, 0x68, 0x65, 0x64, 0x28, 0x70,
+  0x74, 0x72, 0x29, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
   0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x20,
-  0x4f, 0x46, 0x46, 0x5f, 0x53, 0x49, 0x5a, 0x45, 0x5d, 0x0a, 0x20, 0x20,
-  0x69, 0x66, 0x20, 0x74, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f, 0x67, 0x63,
-  0x5f, 0x65, 0x72, 0x72, 0x6d, 0x73, 0x67, 0x28, 0x73, 0x74, 0x72, 0x69,
-  0x6e, 0x67, 0x28, 0x22, 0x20, 0x21, 0x21, 0x21, 0x20, 0x63, 0x6f, 0x72,
-  0x72, 0x75, 0x70, 0x74, 0x65, 0x64, 0x20, 0x68, 0x65, 0x61, 0x70, 0x3f,
-  0x3f, 0x3f, 0x20, 0x21, 0x21, 0x21, 0x20, 0x22, 0x29, 0x29, 0x0a, 0x20,
-  0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x70, 0x74, 0x72, 0x20,
-  0x2b, 0x20, 0x28, 0x74, 0x20, 0x3c, 0x3c, 0x20, 0x70, 0x61, 0x67, 0x65,
-  0x73, 0x69, 0x7a, 0x65, 0x73, 0x68, 0x69, 0x66, 0x74, 0x29, 0x0a, 0x20,
-  0x20, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x74, 0x72,
-  0x79, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x2c,
-  0x20, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x66, 0x6c, 0x61, 0x67,
-  0x29, 0x20, 0x3a, 0x20, 0x70, 0x74, 0x72, 0x20, 0x7c, 0x20, 0x61, 0x76,
-  0x61, 0x69, 0x6c, 0x73, 0x69, 0x7a, 0x65, 0x2c, 0x20, 0x6c, 0x61, 0x73,
-  0x74, 0x70, 0x74, 0x72, 0x2c, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x70, 0x74,
-  0x72, 0x2c, 0x20, 0x68, 0x65, 0x61, 0x70, 0x5f, 0x62, 0x61, 0x73, 0x65,
-  0x2c, 0x20, 0x68, 0x65, 0x61, 0x70, 0x5f, 0x65, 0x6e, 0x64, 0x2c, 0x20,
-  0x73, 0x61, 0x76, 0x65, 0x70, 0x74, 0x72, 0x2c, 0x20, 0x6c, 0x69, 0x6e,
-  0x6b, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x0a, 0x20, 0x20, 0x28, 0x68, 0x65,
-  0x61, 0x70, 0x5f, 0x62, 0x61, 0x73, 0x65, 0x2c, 0x20, 0x68, 0x65, 0x61,
-  0x70, 0x5f, 0x65, 0x6e, 0x64, 0x29, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x67,
-  0x63, 0x5f, 0x70, 0x74, 0x72, 0x73, 0x28, 0x29, 0x0a, 0x20, 0x20, 0x70,
-  0x74, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x68, 0x65, 0x61, 0x70, 0x5f, 0x62,
-  0x61, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x73,
-  0x69, 0x7a, 0x65, 0x20, 0x3a, 0x3d, 0x20, 0x30, 0x0a, 0x20, 0x20, 0x0a,
-  0x20, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x6c, 0x61, 0x73, 0x74, 0x70, 0x74, 0x72, 0x20, 0x3a, 0x3d, 0x20,
-  0x70, 0x74, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x70, 0x74, 0x72, 0x20,
-  0x3a, 0x3d, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x70, 0x61, 0x67, 0x65, 0x70,
-  0x74, 0x72, 0x28, 0x68, 0x65, 0x61, 0x70, 0x5f, 0x62, 0x61, 0x73, 0x65,
-  0x2c, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x70, 0x74, 0x72, 0x2b, 0x4f,
-  0x46, 0x46, 0x5f, 0x4c, 0x49, 0x4e, 0x4b, 0x5d, 0x29, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x69, 0x66, 0x20, 0x70, 0x74, 0x72, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x73, 0x69, 0x7a, 0x65,
-  0x20, 0x3a, 0x3d, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x70, 0x74, 0x72,
-  0x2b, 0x4f, 0x46, 0x46, 0x5f, 0x53, 0x49, 0x5a, 0x45, 0x5d, 0x0a, 0x20,
-  0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x70, 0x74, 0x72, 0x20, 0x61,
-  0x6e, 0x64, 0x20, 0x70, 0x74, 0x72, 0x20, 0x3c, 0x20, 0x68, 0x65, 0x61,
-  0x70, 0x5f, 0x65, 0x6e, 0x64, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x73, 0x69,
-  0x7a, 0x65, 0x20, 0x3e, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x73, 0x69,
-  0x7a, 0x65, 0x0a, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x74,
-  0x72, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x70, 0x74, 0x72, 0x0a, 0x0a,
-  0x20, 0x20, 0x6c, 0x69, 0x6e, 0x6b, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20,
-  0x3a, 0x3d, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x70, 0x74, 0x72, 0x20,
-  0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x4c, 0x49, 0x4e, 0x4b, 0x5d, 0x0a,
-  0x20, 0x20, 0x0a, 0x20, 0x20, 0x27, 0x27, 0x20, 0x63, 0x61, 0x72, 0x76,
-  0x65, 0x20, 0x6f, 0x66, 0x66, 0x20, 0x66, 0x72, 0x65, 0x65, 0x20, 0x73,
-  0x70, 0x61, 0x63, 0x65, 0x20, 0x69, 0x66, 0x20, 0x6e, 0x65, 0x63, 0x65,
-  0x73, 0x73, 0x61, 0x72, 0x79, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
-  0x73, 0x69, 0x7a, 0x65, 0x20, 0x3c, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c,
-  0x73, 0x69, 0x7a, 0x65, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x27, 0x27,
-  0x20, 0x73, 0x68, 0x72, 0x69, 0x6e, 0x6b, 0x20, 0x74, 0x68, 0x69, 0x73,
-  0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x2c, 0x20, 0x6c, 0x69, 0x6e, 0x6b,
-  0x20, 0x74, 0x6f, 0x20, 0x6e, 0x65, 0x77, 0x6c, 0x79, 0x20, 0x63, 0x72,
-  0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x70, 0x74, 0x72,
+  0x4f, 0x46, 0x46, 0x5f, 0x46, 0x4c, 0x41, 0x47, 0x53, 0x5d, 0x20, 0x3d,
+  0x3d, 0x20, 0x47, 0x43, 0x5f, 0x4d, 0x41, 0x47, 0x49, 0x43, 0x20, 0x2b,
+  0x20, 0x47, 0x43, 0x5f, 0x4f, 0x57, 0x4e, 0x45, 0x52, 0x5f, 0x43, 0x41,
+  0x43, 0x48, 0x45, 0x44, 0x0a, 0x0a, 0x27, 0x20, 0x67, 0x6f, 0x20, 0x74,
+  0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x20, 0x62,
+  0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20,
+  0x6f, 0x66, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x73, 0x0a, 0x70, 0x72,
+  0x69, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x6e, 0x65, 0x78, 0x74, 0x42, 0x6c,
+  0x6f, 0x63, 0x6b, 0x50, 0x74, 0x72, 0x28, 0x70, 0x74, 0x72, 0x29, 0x20,
+  0x7c, 0x20, 0x74, 0x0a, 0x20, 0x20, 0x74, 0x20, 0x3a, 0x3d, 0x20, 0x77,
+  0x6f, 0x72, 0x64, 0x5b, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x20, 0x4f, 0x46,
+  0x46, 0x5f, 0x53, 0x49, 0x5a, 0x45, 0x5d, 0x0a, 0x20, 0x20, 0x69, 0x66,
+  0x20, 0x74, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x65,
+  0x72, 0x72, 0x6d, 0x73, 0x67, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67,
+  0x28, 0x22, 0x20, 0x21, 0x21, 0x21, 0x20, 0x63, 0x6f, 0x72, 0x72, 0x75,
+  0x70, 0x74, 0x65, 0x64, 0x20, 0x68, 0x65, 0x61, 0x70, 0x3f, 0x3f, 0x3f,
+  0x20, 0x21, 0x21, 0x21, 0x20, 0x22, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x72,
+  0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x20,
+  0x28, 0x74, 0x20, 0x3c, 0x3c, 0x20, 0x70, 0x61, 0x67, 0x65, 0x73, 0x69,
+  0x7a, 0x65, 0x73, 0x68, 0x69, 0x66, 0x74, 0x29, 0x0a, 0x20, 0x20, 0x0a,
+  0x70, 0x72, 0x69, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x74, 0x72, 0x79, 0x61,
+  0x6c, 0x6c, 0x6f, 0x63, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x2c, 0x20, 0x72,
+  0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x66, 0x6c, 0x61, 0x67, 0x29, 0x20,
+  0x3a, 0x20, 0x70, 0x74, 0x72, 0x20, 0x7c, 0x20, 0x61, 0x76, 0x61, 0x69,
+  0x6c, 0x73, 0x69, 0x7a, 0x65, 0x2c, 0x20, 0x6c, 0x61, 0x73, 0x74, 0x70,
+  0x74, 0x72, 0x2c, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x70, 0x74, 0x72, 0x2c,
+  0x20, 0x68, 0x65, 0x61, 0x70, 0x5f, 0x62, 0x61, 0x73, 0x65, 0x2c, 0x20,
+  0x68, 0x65, 0x61, 0x70, 0x5f, 0x65, 0x6e, 0x64, 0x2c, 0x20, 0x73, 0x61,
+  0x76, 0x65, 0x70, 0x74, 0x72, 0x2c, 0x20, 0x6c, 0x69, 0x6e, 0x6b, 0x69,
+  0x6e, 0x64, 0x65, 0x78, 0x2c, 0x20, 0x68, 0x65, 0x61, 0x64, 0x0a, 0x20,
+  0x20, 0x28, 0x68, 0x65, 0x61, 0x70, 0x5f, 0x62, 0x61, 0x73, 0x65, 0x2c,
+  0x20, 0x68, 0x65, 0x61, 0x70, 0x5f, 0x65, 0x6e, 0x64, 0x29, 0x20, 0x3a,
+  0x3d, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x70, 0x74, 0x72, 0x73, 0x28, 0x29,
+  0x0a, 0x0a, 0x20, 0x20, 0x27, 0x27, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c,
+  0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x73, 0x20, 0x6d, 0x61, 0x79, 0x20,
+  0x62, 0x65, 0x20, 0x77, 0x61, 0x69, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x6f,
+  0x6e, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x73, 0x69, 0x7a, 0x65,
+  0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x0a,
+  0x20, 0x20, 0x69, 0x66, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x3d, 0x3c,
+  0x20, 0x47, 0x43, 0x5f, 0x4e, 0x55, 0x4d, 0x5f, 0x43, 0x4c, 0x41, 0x53,
+  0x53, 0x45, 0x53, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x61, 0x64,
+  0x20, 0x3a, 0x3d, 0x20, 0x68, 0x65, 0x61, 0x70, 0x5f, 0x62, 0x61, 0x73,
+  0x65, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x43, 0x4c, 0x41, 0x53,
+  0x53, 0x20, 0x2b, 0x20, 0x32, 0x2a, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x2d,
+  0x31, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x70, 0x74, 0x72, 0x20, 0x3a,
+  0x3d, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x70, 0x61, 0x67, 0x65, 0x70, 0x74,
+  0x72, 0x28, 0x68, 0x65, 0x61, 0x70, 0x5f, 0x62, 0x61, 0x73, 0x65, 0x2c,
+  0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x68, 0x65, 0x61, 0x64, 0x5d, 0x29,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x70, 0x74, 0x72, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x68,
+  0x65, 0x61, 0x64, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x77, 0x6f, 0x72, 0x64,
+  0x5b, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x4c,
+  0x49, 0x4e, 0x4b, 0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72,
+  0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x6d, 0x61,
+  0x72, 0x6b, 0x75, 0x73, 0x65, 0x64, 0x28, 0x68, 0x65, 0x61, 0x70, 0x5f,
+  0x62, 0x61, 0x73, 0x65, 0x2c, 0x20, 0x70, 0x74, 0x72, 0x2c, 0x20, 0x72,
+  0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x66, 0x6c, 0x61, 0x67, 0x29, 0x0a,
+  0x0a, 0x20, 0x20, 0x70, 0x74, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x68, 0x65,
+  0x61, 0x70, 0x5f, 0x62, 0x61, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x61, 0x76,
+  0x61, 0x69, 0x6c, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x3a, 0x3d, 0x20, 0x30,
+  0x0a, 0x20, 0x20, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x61, 0x73, 0x74, 0x70, 0x74, 0x72,
+  0x20, 0x3a, 0x3d, 0x20, 0x70, 0x74, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x70, 0x74, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x70,
+  0x61, 0x67, 0x65, 0x70, 0x74, 0x72, 0x28, 0x68, 0x65, 0x61, 0x70, 0x5f,
+  0x62, 0x61, 0x73, 0x65, 0x2c, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x70,
+  0x74, 0x72, 0x2b, 0x4f, 0x46, 0x46, 0x5f, 0x4c, 0x49, 0x4e, 0x4b, 0x5d,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x70, 0x74, 0x72,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c,
+  0x73, 0x69, 0x7a, 0x65, 0x20, 0x3a, 0x3d, 0x20, 0x77, 0x6f, 0x72, 0x64,
+  0x5b, 0x70, 0x74, 0x72, 0x2b, 0x4f, 0x46, 0x46, 0x5f, 0x53, 0x49, 0x5a,
+  0x45, 0x5d, 0x0a, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x70,
+  0x74, 0x72, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x70, 0x74, 0x72, 0x20, 0x3c,
+  0x20, 0x68, 0x65, 0x61, 0x70, 0x5f, 0x65, 0x6e, 0x64, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x3e, 0x20, 0x61, 0x76, 0x61,
+  0x69, 0x6c, 0x73, 0x69, 0x7a, 0x65, 0x0a, 0x0a, 0x20, 0x20, 0x69, 0x66,
+  0x20, 0x28, 0x70, 0x74, 0x72, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x70,
+  0x74, 0x72, 0x0a, 0x0a, 0x20, 0x20, 0x6c, 0x69, 0x6e, 0x6b, 0x69, 0x6e,
+  0x64, 0x65, 0x78, 0x20, 0x3a, 0x3d, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b,
+  0x70, 0x74, 0x72, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x4c, 0x49,
+  0x4e, 0x4b, 0x5d, 0x0a, 0x20, 0x20, 0x0a, 0x20, 0x20, 0x27, 0x27, 0x20,
+  0x63, 0x61, 0x72, 0x76, 0x65, 0x20, 0x6f, 0x66, 0x66, 0x20, 0x66, 0x72,
+  0x65, 0x65, 0x20, 0x73, 0x70, 0x61, 0x63, 0x65, 0x20, 0x69, 0x66, 0x20,
+  0x6e, 0x65, 0x63, 0x65, 0x73, 0x73, 0x61, 0x72, 0x79, 0x0a, 0x20, 0x20,
+  0x69, 0x66, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x3c, 0x20, 0x61,
+  0x76, 0x61, 0x69, 0x6c, 0x73, 0x69, 0x7a, 0x65, 0x29, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x27, 0x27, 0x20, 0x73, 0x68, 0x72, 0x69, 0x6e, 0x6b, 0x20,
+  0x74, 0x68, 0x69, 0x73, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x2c, 0x20,
+  0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x74, 0x6f, 0x20, 0x6e, 0x65, 0x77, 0x6c,
+  0x79, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 0x62, 0x6c,
+  0x6f, 0x63, 0x6b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x77, 0x6f, 0x72, 0x64,
+  0x5b, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x53,
+  0x49, 0x5a, 0x45, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x73, 0x69, 0x7a, 0x65,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x70, 0x74, 0x72,
+  0x20, 0x3a, 0x3d, 0x20, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x20, 0x28, 0x73,
+  0x69, 0x7a, 0x65, 0x3c, 0x3c, 0x70, 0x61, 0x67, 0x65, 0x73, 0x69, 0x7a,
+  0x65, 0x73, 0x68, 0x69, 0x66, 0x74, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x77, 0x6f, 0x72, 0x64, 0x5b, 0x6e, 0x65, 0x78, 0x74, 0x70, 0x74, 0x72,
   0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x53, 0x49, 0x5a, 0x45, 0x5d,
-  0x20, 0x3a, 0x3d, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x6e, 0x65, 0x78, 0x74, 0x70, 0x74, 0x72, 0x20, 0x3a, 0x3d, 0x20,
-  0x70, 0x74, 0x72, 0x20, 0x2b, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x3c,
-  0x3c, 0x70, 0x61, 0x67, 0x65, 0x73, 0x69, 0x7a, 0x65, 0x73, 0x68, 0x69,
-  0x66, 0x74, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x77, 0x6f, 0x72, 0x64,
-  0x5b, 0x6e, 0x65, 0x78, 0x74, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x20, 0x4f,
-  0x46, 0x46, 0x5f, 0x53, 0x49, 0x5a, 0x45, 0x5d, 0x20, 0x3a, 0x3d, 0x20,
-  0x61, 0x76, 0x61, 0x69, 0x6c, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x2d, 0x20,
-  0x73, 0x69, 0x7a, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x77, 0x6f, 0x72,
-  0x64, 0x5b, 0x6e, 0x65, 0x78, 0x74, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x20,
-  0x4f, 0x46, 0x46, 0x5f, 0x46, 0x4c, 0x41, 0x47, 0x53, 0x5d, 0x20, 0x3a,
-  0x3d, 0x20, 0x47, 0x43, 0x5f, 0x4d, 0x41, 0x47, 0x49, 0x43, 0x20, 0x7c,
-  0x20, 0x47, 0x43, 0x5f, 0x46, 0x4c, 0x41, 0x47, 0x5f, 0x46, 0x52, 0x45,
-  0x45, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x6e,
-  0x65, 0x78, 0x74, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46,
-  0x5f, 0x50, 0x52, 0x45, 0x56, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x67,
-  0x63, 0x5f, 0x70, 0x61, 0x67, 0x65, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x28,
-  0x68, 0x65, 0x61, 0x70, 0x5f, 0x62, 0x61, 0x73, 0x65, 0x2c, 0x20, 0x70,
-  0x74, 0x72, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x77, 0x6f, 0x72, 0x64,
-  0x5b, 0x6e, 0x65, 0x78, 0x74, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x20, 0x4f,
-  0x46, 0x46, 0x5f, 0x4c, 0x49, 0x4e, 0x4b, 0x5d, 0x20, 0x3a, 0x3d, 0x20,
-  0x77, 0x6f, 0x72, 0x64, 0x5b, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x20, 0x4f,
-  0x46, 0x46, 0x5f, 0x4c, 0x49, 0x4e, 0x4b, 0x5d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x27, 0x27, 0x20, 0x61, 0x64, 0x76, 0x61, 0x6e, 0x63, 0x65, 0x20,
-  0x74, 0x6f, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x63,
-  0x68, 0x61, 0x69, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x61, 0x76,
-  0x65, 0x70, 0x74, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x6e, 0x65, 0x78, 0x74,
-  0x70, 0x74, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x69, 0x6e, 0x6b,
-  0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x67, 0x63,
-  0x5f, 0x70, 0x61, 0x67, 0x65, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x28, 0x68,
-  0x65, 0x61, 0x70, 0x5f, 0x62, 0x61, 0x73, 0x65, 0x2c, 0x20, 0x73, 0x61,
-  0x76, 0x65, 0x70, 0x74, 0x72, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6e,
-  0x65, 0x78, 0x74, 0x70, 0x74, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x67,
-  0x63, 0x5f, 0x6e, 0x65, 0x78, 0x74, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x50,
-  0x74, 0x72, 0x28, 0x6e, 0x65, 0x78, 0x74, 0x70, 0x74, 0x72, 0x29, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6e, 0x65, 0x78, 0x74,
-  0x70, 0x74, 0x72, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6e, 0x65, 0x78, 0x74,
-  0x70, 0x74, 0x72, 0x20, 0x3c, 0x20, 0x20, 0x68, 0x65, 0x61, 0x70, 0x5f,
-  0x65, 0x6e, 0x64, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77,
-  0x6f, 0x72, 0x64, 0x5b, 0x6e, 0x65, 0x78, 0x74, 0x70, 0x74, 0x72, 0x20,
-  0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x50, 0x52, 0x45, 0x56, 0x5d, 0x20,
-  0x3a, 0x3d, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x70, 0x61, 0x67, 0x65, 0x69,
-  0x6e, 0x64, 0x65, 0x78, 0x28, 0x68, 0x65, 0x61, 0x70, 0x5f, 0x62, 0x61,
-  0x73, 0x65, 0x2c, 0x20, 0x73, 0x61, 0x76, 0x65, 0x70, 0x74, 0x72, 0x29,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0a, 0x20, 0x20, 0x27, 0x27, 0x20,
-  0x6e, 0x6f, 0x77, 0x20, 0x75, 0x6e, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x75,
-  0x73, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
-  0x72, 0x65, 0x65, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x0a, 0x20, 0x20, 0x77,
-  0x6f, 0x72, 0x64, 0x5b, 0x6c, 0x61, 0x73, 0x74, 0x70, 0x74, 0x72, 0x20,
+  0x20, 0x3a, 0x3d, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x73, 0x69, 0x7a,
+  0x65, 0x20, 0x2d, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x6e, 0x65, 0x78, 0x74, 0x70, 0x74,
+  0x72, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x46, 0x4c, 0x41, 0x47,
+  0x53, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x47, 0x43, 0x5f, 0x4d, 0x41, 0x47,
+  0x49, 0x43, 0x20, 0x7c, 0x20, 0x47, 0x43, 0x5f, 0x46, 0x4c, 0x41, 0x47,
+  0x5f, 0x46, 0x52, 0x45, 0x45, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x77, 0x6f,
+  0x72, 0x64, 0x5b, 0x6e, 0x65, 0x78, 0x74, 0x70, 0x74, 0x72, 0x20, 0x2b,
+  0x20, 0x4f, 0x46, 0x46, 0x5f, 0x50, 0x52, 0x45, 0x56, 0x5d, 0x20, 0x3a,
+  0x3d, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x70, 0x61, 0x67, 0x65, 0x69, 0x6e,
+  0x64, 0x65, 0x78, 0x28, 0x68, 0x65, 0x61, 0x70, 0x5f, 0x62, 0x61, 0x73,
+  0x65, 0x2c, 0x20, 0x70, 0x74, 0x72, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x77, 0x6f, 0x72, 0x64, 0x5b, 0x6e, 0x65, 0x78, 0x74, 0x70, 0x74, 0x72,
+  0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x4c, 0x49, 0x4e, 0x4b, 0x5d,
+  0x20, 0x3a, 0x3d, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x70, 0x74, 0x72,
+  0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x4c, 0x49, 0x4e, 0x4b, 0x5d,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x27, 0x27, 0x20, 0x61, 0x64, 0x76, 0x61,
+  0x6e, 0x63, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x20,
+  0x69, 0x6e, 0x20, 0x63, 0x68, 0x61, 0x69, 0x6e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x73, 0x61, 0x76, 0x65, 0x70, 0x74, 0x72, 0x20, 0x3a, 0x3d, 0x20,
+  0x6e, 0x65, 0x78, 0x74, 0x70, 0x74, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x6c, 0x69, 0x6e, 0x6b, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x3a, 0x3d,
+  0x20, 0x5f, 0x67, 0x63, 0x5f, 0x70, 0x61, 0x67, 0x65, 0x69, 0x6e, 0x64,
+  0x65, 0x78, 0x28, 0x68, 0x65, 0x61, 0x70, 0x5f, 0x62, 0x61, 0x73, 0x65,
+  0x2c, 0x20, 0x73, 0x61, 0x76, 0x65, 0x70, 0x74, 0x72, 0x29, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x70, 0x74, 0x72, 0x20, 0x3a,
+  0x3d, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x6e, 0x65, 0x78, 0x74, 0x42, 0x6c,
+  0x6f, 0x63, 0x6b, 0x50, 0x74, 0x72, 0x28, 0x6e, 0x65, 0x78, 0x74, 0x70,
+  0x74, 0x72, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
+  0x6e, 0x65, 0x78, 0x74, 0x70, 0x74, 0x72, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x6e, 0x65, 0x78, 0x74, 0x70, 0x74, 0x72, 0x20, 0x3c, 0x20, 0x20, 0x68,
+  0x65, 0x61, 0x70, 0x5f, 0x65, 0x6e, 0x64, 0x29, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x6e, 0x65, 0x78, 0x74,
+  0x70, 0x74, 0x72, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x50, 0x52,
+  0x45, 0x56, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x70,
+  0x61, 0x67, 0x65, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x28, 0x68, 0x65, 0x61,
+  0x70, 0x5f, 0x62, 0x61, 0x73, 0x65, 0x2c, 0x20, 0x73, 0x61, 0x76, 0x65,
+  0x70, 0x74, 0x72, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0a, 0x20,
+  0x20, 0x27, 0x27, 0x20, 0x6e, 0x6f, 0x77, 0x20, 0x75, 0x6e, 0x6c, 0x69,
+  0x6e, 0x6b, 0x20, 0x75, 0x73, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x66, 0x72, 0x65, 0x65, 0x20, 0x6c, 0x69, 0x73, 0x74,
+  0x0a, 0x20, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x6c, 0x61, 0x73, 0x74,
+  0x70, 0x74, 0x72, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x4c, 0x49,
+  0x4e, 0x4b, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x6c, 0x69, 0x6e, 0x6b, 0x69,
+  0x6e, 0x64, 0x65, 0x78, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+  0x6e, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x6d, 0x61, 0x72, 0x6b, 0x75, 0x73,
+  0x65, 0x64, 0x28, 0x68, 0x65, 0x61, 0x70, 0x5f, 0x62, 0x61, 0x73, 0x65,
+  0x2c, 0x20, 0x70, 0x74, 0x72, 0x2c, 0x20, 0x72, 0x65, 0x73, 0x65, 0x72,
+  0x76, 0x65, 0x66, 0x6c, 0x61, 0x67, 0x29, 0x0a, 0x0a, 0x70, 0x72, 0x69,
+  0x20, 0x5f, 0x67, 0x63, 0x5f, 0x6d, 0x61, 0x72, 0x6b, 0x75, 0x73, 0x65,
+  0x64, 0x28, 0x68, 0x65, 0x61, 0x70, 0x5f, 0x62, 0x61, 0x73, 0x65, 0x2c,
+  0x20, 0x70, 0x74, 0x72, 0x2c, 0x20, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76,
+  0x65, 0x66, 0x6c, 0x61, 0x67, 0x29, 0x0a, 0x20, 0x20, 0x27, 0x27, 0x20,
+  0x6d, 0x61, 0x72, 0x6b, 0x20, 0x61, 0x73, 0x20, 0x75, 0x73, 0x65, 0x64,
+  0x2c, 0x20, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x2c, 0x20,
+  0x6f, 0x77, 0x6e, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x61, 0x20, 0x63,
+  0x6f, 0x67, 0x0a, 0x20, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x70, 0x74,
+  0x72, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x46, 0x4c, 0x41, 0x47,
+  0x53, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x47, 0x43, 0x5f, 0x4d, 0x41, 0x47,
+  0x49, 0x43, 0x20, 0x7c, 0x20, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65,
+  0x66, 0x6c, 0x61, 0x67, 0x20, 0x7c, 0x20, 0x5f, 0x63, 0x6f, 0x67, 0x69,
+  0x64, 0x28, 0x29, 0x0a, 0x20, 0x20, 0x0a, 0x20, 0x20, 0x27, 0x27, 0x20,
+  0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x75, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x6c, 0x69, 0x73, 0x74,
+  0x0a, 0x20, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x70, 0x74, 0x72, 0x20,
   0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x4c, 0x49, 0x4e, 0x4b, 0x5d, 0x20,
-  0x3a, 0x3d, 0x20, 0x6c, 0x69, 0x6e, 0x6b, 0x69, 0x6e, 0x64, 0x65, 0x78,
-  0x0a, 0x20, 0x20, 0x0a, 0x20, 0x20, 0x27, 0x27, 0x20, 0x6d, 0x61, 0x72,
-  0x6b, 0x20, 0x61, 0x73, 0x20, 0x75, 0x73, 0x65, 0x64, 0x2c, 0x20, 0x72,
-  0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x2c, 0x20, 0x6f, 0x77, 0x6e,
-  0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x61, 0x20, 0x63, 0x6f, 0x67, 0x0a,
-  0x20, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x70, 0x74, 0x72, 0x20, 0x2b,
-  0x20, 0x4f, 0x46, 0x46, 0x5f, 0x46, 0x4c, 0x41, 0x47, 0x53, 0x5d, 0x20,
-  0x3a, 0x3d, 0x20, 0x47, 0x43, 0x5f, 0x4d, 0x41, 0x47, 0x49, 0x43, 0x20,
-  0x7c, 0x20, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x66, 0x6c, 0x61,
-  0x67, 0x20, 0x7c, 0x20, 0x5f, 0x63, 0x6f, 0x67, 0x69, 0x64, 0x28, 0x29,
-  0x0a, 0x20, 0x20, 0x0a, 0x20, 0x20, 0x27, 0x27, 0x20, 0x6c, 0x69, 0x6e,
-  0x6b, 0x20, 0x75, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x75, 0x73, 0x65, 0x64, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x0a, 0x20, 0x20,
-  0x77, 0x6f, 0x72, 0x64, 0x5b, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x20, 0x4f,
-  0x46, 0x46, 0x5f, 0x4c, 0x49, 0x4e, 0x4b, 0x5d, 0x20, 0x3a, 0x3d, 0x20,
-  0x77, 0x6f, 0x72, 0x64, 0x5b, 0x68, 0x65, 0x61, 0x70, 0x5f, 0x62, 0x61,
-  0x73, 0x65, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x55, 0x53, 0x45,
-  0x44, 0x5f, 0x4c, 0x49, 0x4e, 0x4b, 0x5d, 0x0a, 0x20, 0x20, 0x77, 0x6f,
-  0x72, 0x64, 0x5b, 0x68, 0x65, 0x61, 0x70, 0x5f, 0x62, 0x61, 0x73, 0x65,
-  0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x55, 0x53, 0x45, 0x44, 0x5f,
-  0x4c, 0x49, 0x4e, 0x4b, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x67, 0x63,
-  0x5f, 0x70, 0x61, 0x67, 0x65, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x28, 0x68,
-  0x65, 0x61, 0x70, 0x5f, 0x62, 0x61, 0x73, 0x65, 0x2c, 0x20, 0x70, 0x74,
-  0x72, 0x29, 0x0a, 0x20, 0x20, 0x0a, 0x20, 0x20, 0x27, 0x27, 0x20, 0x61,
-  0x6e, 0x64, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x0a, 0x20, 0x20,
-  0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x28, 0x70, 0x74, 0x72, 0x20,
-  0x2b, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x69, 0x7a, 0x65,
-  0x29, 0x20, 0x7c, 0x20, 0x50, 0x4f, 0x49, 0x4e, 0x54, 0x45, 0x52, 0x5f,
-  0x4d, 0x41, 0x47, 0x49, 0x43, 0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f,
-  0x67, 0x63, 0x5f, 0x65, 0x72, 0x72, 0x6d, 0x73, 0x67, 0x28, 0x73, 0x29,
-  0x20, 0x7c, 0x20, 0x63, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61,
-  0x74, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x28, 0x28, 0x63, 0x3a,
-  0x3d, 0x62, 0x79, 0x74, 0x65, 0x5b, 0x73, 0x2b, 0x2b, 0x5d, 0x29, 0x20,
-  0x3c, 0x3e, 0x20, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x74,
-  0x78, 0x28, 0x63, 0x29, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
-  0x6e, 0x20, 0x30, 0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x67, 0x63,
-  0x5f, 0x65, 0x72, 0x72, 0x68, 0x65, 0x78, 0x28, 0x68, 0x29, 0x20, 0x7c,
-  0x20, 0x63, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x20,
-  0x38, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x68, 0x20, 0x3a, 0x3d, 0x20, 0x28,
-  0x68, 0x3c, 0x2d, 0x34, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x20,
-  0x3a, 0x3d, 0x20, 0x68, 0x20, 0x26, 0x20, 0x24, 0x66, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x63, 0x20, 0x3a, 0x3d, 0x20, 0x28, 0x63, 0x20, 0x3c, 0x20,
-  0x31, 0x30, 0x29, 0x20, 0x3f, 0x20, 0x63, 0x20, 0x2b, 0x20, 0x22, 0x30,
-  0x22, 0x20, 0x3a, 0x20, 0x28, 0x63, 0x2d, 0x31, 0x30, 0x29, 0x20, 0x2b,
-  0x20, 0x22, 0x41, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x74, 0x78,
-  0x28, 0x63, 0x29, 0x0a, 0x20, 0x20, 0x5f, 0x74, 0x78, 0x28, 0x22, 0x20,
-  0x22, 0x29, 0x0a, 0x20, 0x20, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x67,
-  0x63, 0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x28, 0x73, 0x69, 0x7a, 0x65,
-  0x29, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f,
-  0x67, 0x63, 0x5f, 0x64, 0x6f, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x28, 0x73,
-  0x69, 0x7a, 0x65, 0x2c, 0x20, 0x47, 0x43, 0x5f, 0x46, 0x4c, 0x41, 0x47,
-  0x5f, 0x52, 0x45, 0x53, 0x45, 0x52, 0x56, 0x45, 0x44, 0x29, 0x0a, 0x0a,
-  0x70, 0x72, 0x69, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x61, 0x6c, 0x6c, 0x6f,
-  0x63, 0x5f, 0x6d, 0x61, 0x6e, 0x61, 0x67, 0x65, 0x64, 0x28, 0x73, 0x69,
-  0x7a, 0x65, 0x29, 0x20, 0x3a, 0x20, 0x72, 0x0a, 0x20, 0x20, 0x72, 0x20,
-  0x3a, 0x3d, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x64, 0x6f, 0x61, 0x6c, 0x6c,
-  0x6f, 0x63, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x2c, 0x20, 0x30, 0x29, 0x0a,
-  0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x72, 0x20, 0x3d, 0x3d, 0x20, 0x30,
-  0x20, 0x61, 0x6e, 0x64, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x3e, 0x20,
-  0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
-  0x6e, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x65, 0x72, 0x72, 0x6d, 0x73, 0x67,
-  0x28, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x22, 0x20, 0x21, 0x21,
-  0x21, 0x20, 0x6f, 0x75, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x68, 0x65, 0x61,
-  0x70, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x20, 0x21, 0x21, 0x21,
-  0x20, 0x22, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
-  0x6e, 0x20, 0x72, 0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x67, 0x63,
-  0x5f, 0x64, 0x6f, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x28, 0x73, 0x69, 0x7a,
-  0x65, 0x2c, 0x20, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x66, 0x6c,
-  0x61, 0x67, 0x29, 0x20, 0x3a, 0x20, 0x70, 0x74, 0x72, 0x20, 0x7c, 0x20,
-  0x7a, 0x70, 0x74, 0x72, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73,
-  0x69, 0x7a, 0x65, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x70, 0x74, 0x72,
-  0x20, 0x20, 0x27, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x73,
-  0x20, 0x74, 0x6f, 0x20, 0x30, 0x0a, 0x0a, 0x20, 0x20, 0x27, 0x20, 0x69,
-  0x6e, 0x63, 0x72, 0x65, 0x61, 0x73, 0x65, 0x20, 0x73, 0x69, 0x7a, 0x65,
-  0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x20, 0x74, 0x6f, 0x20,
-  0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x0a, 0x20, 0x20, 0x73, 0x69, 0x7a,
-  0x65, 0x20, 0x2b, 0x3d, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73,
-  0x69, 0x7a, 0x65, 0x0a, 0x20, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x3a,
-  0x3d, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x2b, 0x20, 0x70, 0x61,
-  0x67, 0x65, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x20, 0x26, 0x20, 0x21, 0x70,
-  0x61, 0x67, 0x65, 0x6d, 0x61, 0x73, 0x6b, 0x0a, 0x20, 0x20, 0x27, 0x20,
-  0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x70,
-  0x61, 0x67, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20,
-  0x3a, 0x3d, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x3e, 0x3e, 0x20, 0x70,
-  0x61, 0x67, 0x65, 0x73, 0x69, 0x7a, 0x65, 0x73, 0x68, 0x69, 0x66, 0x74,
-  0x0a, 0x0a, 0x20, 0x20, 0x5f, 0x6c, 0x6f, 0x63, 0x6b, 0x6d, 0x65, 0x6d,
-  0x28, 0x40, 0x5f, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x5f, 0x6d, 0x75,
-  0x74, 0x65, 0x78, 0x29, 0x0a, 0x0a, 0x20, 0x20, 0x27, 0x20, 0x74, 0x72,
-  0x79, 0x20, 0x74, 0x6f, 0x20, 0x66, 0x69, 0x6e, 0x64, 0x20, 0x61, 0x20,
-  0x66, 0x72, 0x65, 0x65, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x62,
-  0x69, 0x67, 0x20, 0x65, 0x6e, 0x6f, 0x75, 0x67, 0x68, 0x0a, 0x20, 0x20,
-  0x70, 0x74, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x74,
-  0x72, 0x79, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x28, 0x73, 0x69, 0x7a, 0x65,
-  0x2c, 0x20, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x66, 0x6c, 0x61,
-  0x67, 0x29, 0x0a, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x74,
-  0x72, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x27, 0x27, 0x20, 0x72, 0x75, 0x6e, 0x20, 0x67, 0x61, 0x72, 0x62, 0x61,
-  0x67, 0x65, 0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x69, 0x6f,
-  0x6e, 0x20, 0x68, 0x65, 0x72, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x5f,
-  0x67, 0x63, 0x5f, 0x64, 0x6f, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x27, 0x20, 0x73, 0x65, 0x65, 0x20, 0x69,
-  0x66, 0x20, 0x67, 0x63, 0x20, 0x66, 0x72, 0x65, 0x65, 0x64, 0x20, 0x75,
-  0x70, 0x20, 0x65, 0x6e, 0x6f, 0x75, 0x67, 0x68, 0x20, 0x73, 0x70, 0x61,
-  0x63, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x70, 0x74, 0x72, 0x20, 0x3a,
-  0x3d, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x74, 0x72, 0x79, 0x61, 0x6c, 0x6c,
-  0x6f, 0x63, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x2c, 0x20, 0x72, 0x65, 0x73,
-  0x65, 0x72, 0x76, 0x65, 0x66, 0x6c, 0x61, 0x67, 0x29, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x0a, 0x20, 0x20, 0x5f, 0x75, 0x6e, 0x6c, 0x6f, 0x63, 0x6b,
-  0x6d, 0x65, 0x6d, 0x28, 0x40, 0x5f, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79,
-  0x5f, 0x6d, 0x75, 0x74, 0x65, 0x78, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x70, 0x74, 0x72, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x27, 0x20, 0x7a, 0x65, 0x72, 0x6f, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x65, 0x64, 0x20, 0x6d, 0x65,
-  0x6d, 0x6f, 0x72, 0x79, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x69, 0x7a,
-  0x65, 0x20, 0x3a, 0x3d, 0x20, 0x28, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x20,
-  0x3c, 0x3c, 0x20, 0x70, 0x61, 0x67, 0x65, 0x73, 0x69, 0x7a, 0x65, 0x73,
-  0x68, 0x69, 0x66, 0x74, 0x29, 0x20, 0x2d, 0x20, 0x68, 0x65, 0x61, 0x64,
-  0x65, 0x72, 0x73, 0x69, 0x7a, 0x65, 0x29, 0x2f, 0x34, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x7a, 0x70, 0x74, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x70, 0x74,
-  0x72, 0x20, 0x27, 0x20, 0x73, 0x6b, 0x69, 0x70, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x5b, 0x7a,
-  0x70, 0x74, 0x72, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x30, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x7a, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x3d, 0x20,
-  0x34, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x70,
-  0x74, 0x72, 0x0a, 0x0a, 0x27, 0x0a, 0x27, 0x20, 0x72, 0x65, 0x74, 0x75,
-  0x72, 0x6e, 0x73, 0x20, 0x30, 0x20, 0x69, 0x66, 0x20, 0x70, 0x74, 0x72,
-  0x20, 0x69, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x20, 0x76, 0x61,
-  0x6c, 0x69, 0x64, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x0a,
-  0x27, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x20,
-  0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x69, 0x74, 0x0a, 0x27, 0x20,
-  0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x20, 0x74, 0x6f, 0x0a, 0x27, 0x0a,
-  0x70, 0x72, 0x69, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x69, 0x73, 0x76, 0x61,
-  0x6c, 0x69, 0x64, 0x70, 0x74, 0x72, 0x28, 0x62, 0x61, 0x73, 0x65, 0x2c,
-  0x20, 0x68, 0x65, 0x61, 0x70, 0x5f, 0x65, 0x6e, 0x64, 0x2c, 0x20, 0x70,
-  0x74, 0x72, 0x29, 0x20, 0x7c, 0x20, 0x74, 0x0a, 0x20, 0x20, 0x27, 0x20,
-  0x6d, 0x61, 0x6b, 0x65, 0x20, 0x73, 0x75, 0x72, 0x65, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x70, 0x6f, 0x69, 0x74, 0x65, 0x72, 0x20, 0x63, 0x61, 0x6d,
-  0x65, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x63,
-  0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x74, 0x72, 0x20, 0x26,
-  0x20, 0x50, 0x4f, 0x49, 0x4e, 0x54, 0x45, 0x52, 0x5f, 0x4d, 0x41, 0x47,
-  0x49, 0x43, 0x5f, 0x4d, 0x41, 0x53, 0x4b, 0x29, 0x20, 0x3c, 0x3e, 0x20,
-  0x50, 0x4f, 0x49, 0x4e, 0x54, 0x45, 0x52, 0x5f, 0x4d, 0x41, 0x47, 0x49,
-  0x43, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
-  0x20, 0x30, 0x0a, 0x20, 0x20, 0x27, 0x20, 0x73, 0x74, 0x65, 0x70, 0x20,
-  0x62, 0x61, 0x63, 0x6b, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x0a, 0x20, 0x20, 0x70, 0x74, 0x72,
-  0x20, 0x3a, 0x3d, 0x20, 0x28, 0x70, 0x74, 0x72, 0x20, 0x2d, 0x20, 0x68,
-  0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x69, 0x7a, 0x65, 0x29, 0x20, 0x26,
-  0x20, 0x28, 0x21, 0x50, 0x4f, 0x49, 0x4e, 0x54, 0x45, 0x52, 0x5f, 0x4d,
-  0x41, 0x47, 0x49, 0x43, 0x5f, 0x4d, 0x41, 0x53, 0x4b, 0x29, 0x0a, 0x20,
-  0x20, 0x27, 0x20, 0x6d, 0x61, 0x6b, 0x65, 0x20, 0x73, 0x75, 0x72, 0x65,
-  0x20, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x68, 0x65, 0x61, 0x70, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20,
-  0x28, 0x70, 0x74, 0x72, 0x20, 0x3c, 0x20, 0x62, 0x61, 0x73, 0x65, 0x29,
-  0x20, 0x6f, 0x72, 0x20, 0x28, 0x70, 0x74, 0x72, 0x20, 0x3d, 0x3e, 0x20,
-  0x68, 0x65, 0x61, 0x70, 0x5f, 0x65, 0x6e, 0x64, 0x29, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x30, 0x0a, 0x0a,
-  0x20, 0x20, 0x27, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x61, 0x70, 0x70, 0x72,
-  0x6f, 0x70, 0x72, 0x69, 0x61, 0x74, 0x65, 0x6c, 0x79, 0x20, 0x61, 0x6c,
-  0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x28, 0x73, 0x61, 0x6d, 0x65, 0x20,
-  0x61, 0x73, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x68, 0x65, 0x61, 0x70, 0x5f,
-  0x62, 0x61, 0x73, 0x65, 0x29, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
-  0x20, 0x28, 0x70, 0x74, 0x72, 0x20, 0x5e, 0x20, 0x62, 0x61, 0x73, 0x65,
-  0x29, 0x20, 0x26, 0x20, 0x70, 0x61, 0x67, 0x65, 0x6d, 0x61, 0x73, 0x6b,
-  0x29, 0x20, 0x3c, 0x3e, 0x20, 0x30, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72,
-  0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x30, 0x0a, 0x0a, 0x20, 0x20, 0x27,
-  0x20, 0x61, 0x6e, 0x64, 0x20, 0x6d, 0x61, 0x6b, 0x65, 0x20, 0x73, 0x75,
-  0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x47, 0x43, 0x5f, 0x4d, 0x41,
-  0x47, 0x49, 0x43, 0x20, 0x62, 0x69, 0x74, 0x73, 0x20, 0x61, 0x72, 0x65,
-  0x20, 0x73, 0x65, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x66, 0x6c, 0x61, 0x67,
-  0x73, 0x0a, 0x20, 0x20, 0x74, 0x20, 0x3a, 0x3d, 0x20, 0x77, 0x6f, 0x72,
-  0x64, 0x5b, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f,
-  0x46, 0x4c, 0x41, 0x47, 0x53, 0x5d, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20,
-  0x28, 0x74, 0x20, 0x26, 0x20, 0x47, 0x43, 0x5f, 0x4d, 0x41, 0x47, 0x49,
-  0x43, 0x5f, 0x4d, 0x41, 0x53, 0x4b, 0x29, 0x20, 0x3c, 0x3e, 0x20, 0x47,
-  0x43, 0x5f, 0x4d, 0x41, 0x47, 0x49, 0x43, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x30, 0x0a, 0x20, 0x20, 0x72,
-  0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x70, 0x74, 0x72, 0x0a, 0x0a, 0x27,
-  0x0a, 0x27, 0x20, 0x66, 0x72, 0x65, 0x65, 0x20, 0x61, 0x20, 0x70, 0x6f,
-  0x69, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x70, 0x72, 0x65, 0x76, 0x69, 0x6f,
-  0x75, 0x73, 0x6c, 0x79, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x65,
-  0x64, 0x20, 0x62, 0x79, 0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x0a, 0x27,
-  0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x66, 0x72, 0x65,
-  0x65, 0x28, 0x70, 0x74, 0x72, 0x29, 0x20, 0x7c, 0x20, 0x68, 0x65, 0x61,
-  0x70, 0x62, 0x61, 0x73, 0x65, 0x2c, 0x20, 0x68, 0x65, 0x61, 0x70, 0x65,
-  0x6e, 0x64, 0x0a, 0x20, 0x20, 0x28, 0x68, 0x65, 0x61, 0x70, 0x62, 0x61,
-  0x73, 0x65, 0x2c, 0x20, 0x68, 0x65, 0x61, 0x70, 0x65, 0x6e, 0x64, 0x29,
+  0x3a, 0x3d, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x68, 0x65, 0x61, 0x70,
+  0x5f, 0x62, 0x61, 0x73, 0x65, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f,
+  0x55, 0x53, 0x45, 0x44, 0x5f, 0x4c, 0x49, 0x4e, 0x4b, 0x5d, 0x0a, 0x20,
+  0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x68, 0x65, 0x61, 0x70, 0x5f, 0x62,
+  0x61, 0x73, 0x65, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x55, 0x53,
+  0x45, 0x44, 0x5f, 0x4c, 0x49, 0x4e, 0x4b, 0x5d, 0x20, 0x3a, 0x3d, 0x20,
+  0x5f, 0x67, 0x63, 0x5f, 0x70, 0x61, 0x67, 0x65, 0x69, 0x6e, 0x64, 0x65,
+  0x78, 0x28, 0x68, 0x65, 0x61, 0x70, 0x5f, 0x62, 0x61, 0x73, 0x65, 0x2c,
+  0x20, 0x70, 0x74, 0x72, 0x29, 0x0a, 0x20, 0x20, 0x0a, 0x20, 0x20, 0x27,
+  0x27, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
+  0x0a, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x28, 0x70,
+  0x74, 0x72, 0x20, 0x2b, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73,
+  0x69, 0x7a, 0x65, 0x29, 0x20, 0x7c, 0x20, 0x50, 0x4f, 0x49, 0x4e, 0x54,
+  0x45, 0x52, 0x5f, 0x4d, 0x41, 0x47, 0x49, 0x43, 0x0a, 0x0a, 0x70, 0x72,
+  0x69, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x65, 0x72, 0x72, 0x6d, 0x73, 0x67,
+  0x28, 0x73, 0x29, 0x20, 0x7c, 0x20, 0x63, 0x0a, 0x20, 0x20, 0x72, 0x65,
+  0x70, 0x65, 0x61, 0x74, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x28,
+  0x28, 0x63, 0x3a, 0x3d, 0x62, 0x79, 0x74, 0x65, 0x5b, 0x73, 0x2b, 0x2b,
+  0x5d, 0x29, 0x20, 0x3c, 0x3e, 0x20, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x5f, 0x74, 0x78, 0x28, 0x63, 0x29, 0x0a, 0x20, 0x20, 0x72, 0x65,
+  0x74, 0x75, 0x72, 0x6e, 0x20, 0x30, 0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20,
+  0x5f, 0x67, 0x63, 0x5f, 0x65, 0x72, 0x72, 0x68, 0x65, 0x78, 0x28, 0x68,
+  0x29, 0x20, 0x7c, 0x20, 0x63, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x70, 0x65,
+  0x61, 0x74, 0x20, 0x38, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x68, 0x20, 0x3a,
+  0x3d, 0x20, 0x28, 0x68, 0x3c, 0x2d, 0x34, 0x29, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x63, 0x20, 0x3a, 0x3d, 0x20, 0x68, 0x20, 0x26, 0x20, 0x24, 0x66,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x20, 0x3a, 0x3d, 0x20, 0x28, 0x63,
+  0x20, 0x3c, 0x20, 0x31, 0x30, 0x29, 0x20, 0x3f, 0x20, 0x63, 0x20, 0x2b,
+  0x20, 0x22, 0x30, 0x22, 0x20, 0x3a, 0x20, 0x28, 0x63, 0x2d, 0x31, 0x30,
+  0x29, 0x20, 0x2b, 0x20, 0x22, 0x41, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x5f, 0x74, 0x78, 0x28, 0x63, 0x29, 0x0a, 0x20, 0x20, 0x5f, 0x74, 0x78,
+  0x28, 0x22, 0x20, 0x22, 0x29, 0x0a, 0x20, 0x20, 0x0a, 0x70, 0x72, 0x69,
+  0x20, 0x5f, 0x67, 0x63, 0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x28, 0x73,
+  0x69, 0x7a, 0x65, 0x29, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+  0x6e, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x64, 0x6f, 0x61, 0x6c, 0x6c, 0x6f,
+  0x63, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x2c, 0x20, 0x47, 0x43, 0x5f, 0x46,
+  0x4c, 0x41, 0x47, 0x5f, 0x52, 0x45, 0x53, 0x45, 0x52, 0x56, 0x45, 0x44,
+  0x29, 0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x61,
+  0x6c, 0x6c, 0x6f, 0x63, 0x5f, 0x6d, 0x61, 0x6e, 0x61, 0x67, 0x65, 0x64,
+  0x28, 0x73, 0x69, 0x7a, 0x65, 0x29, 0x20, 0x3a, 0x20, 0x72, 0x0a, 0x20,
+  0x20, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x64, 0x6f,
+  0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x2c, 0x20,
+  0x30, 0x29, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x72, 0x20, 0x3d,
+  0x3d, 0x20, 0x30, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x73, 0x69, 0x7a, 0x65,
+  0x20, 0x3e, 0x20, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65,
+  0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x65, 0x72, 0x72,
+  0x6d, 0x73, 0x67, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x22,
+  0x20, 0x21, 0x21, 0x21, 0x20, 0x6f, 0x75, 0x74, 0x20, 0x6f, 0x66, 0x20,
+  0x68, 0x65, 0x61, 0x70, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x20,
+  0x21, 0x21, 0x21, 0x20, 0x22, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x72, 0x65,
+  0x74, 0x75, 0x72, 0x6e, 0x20, 0x72, 0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20,
+  0x5f, 0x67, 0x63, 0x5f, 0x64, 0x6f, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x28,
+  0x73, 0x69, 0x7a, 0x65, 0x2c, 0x20, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76,
+  0x65, 0x66, 0x6c, 0x61, 0x67, 0x29, 0x20, 0x3a, 0x20, 0x70, 0x74, 0x72,
+  0x20, 0x7c, 0x20, 0x7a, 0x70, 0x74, 0x72, 0x2c, 0x20, 0x73, 0x74, 0x61,
+  0x72, 0x74, 0x74, 0x69, 0x6d, 0x65, 0x2c, 0x20, 0x73, 0x74, 0x61, 0x74,
+  0x73, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65,
+  0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72,
+  0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x70, 0x74, 0x72, 0x20, 0x20, 0x27,
+  0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x73, 0x20, 0x74, 0x6f,
+  0x20, 0x30, 0x0a, 0x20, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x74, 0x69,
+  0x6d, 0x65, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x67, 0x65, 0x74, 0x63, 0x6e,
+  0x74, 0x28, 0x29, 0x0a, 0x0a, 0x20, 0x20, 0x27, 0x20, 0x69, 0x6e, 0x63,
+  0x72, 0x65, 0x61, 0x73, 0x65, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x72,
+  0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6e,
+  0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x65,
+  0x61, 0x64, 0x65, 0x72, 0x0a, 0x20, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20,
+  0x2b, 0x3d, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x69, 0x7a,
+  0x65, 0x0a, 0x20, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x3a, 0x3d, 0x20,
+  0x28, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x2b, 0x20, 0x70, 0x61, 0x67, 0x65,
+  0x6d, 0x61, 0x73, 0x6b, 0x29, 0x20, 0x26, 0x20, 0x21, 0x70, 0x61, 0x67,
+  0x65, 0x6d, 0x61, 0x73, 0x6b, 0x0a, 0x20, 0x20, 0x27, 0x20, 0x63, 0x6f,
+  0x6e, 0x76, 0x65, 0x72, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x70, 0x61, 0x67,
+  0x65, 0x73, 0x0a, 0x20, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x3a, 0x3d,
+  0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x3e, 0x3e, 0x20, 0x70, 0x61, 0x67,
+  0x65, 0x73, 0x69, 0x7a, 0x65, 0x73, 0x68, 0x69, 0x66, 0x74, 0x0a, 0x0a,
+  0x20, 0x20, 0x5f, 0x6c, 0x6f, 0x63, 0x6b, 0x6d, 0x65, 0x6d, 0x28, 0x40,
+  0x5f, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x5f, 0x6d, 0x75, 0x74, 0x65,
+  0x78, 0x29, 0x0a, 0x0a, 0x20, 0x20, 0x27, 0x20, 0x74, 0x72, 0x79, 0x20,
+  0x74, 0x6f, 0x20, 0x66, 0x69, 0x6e, 0x64, 0x20, 0x61, 0x20, 0x66, 0x72,
+  0x65, 0x65, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x62, 0x69, 0x67,
+  0x20, 0x65, 0x6e, 0x6f, 0x75, 0x67, 0x68, 0x0a, 0x20, 0x20, 0x70, 0x74,
+  0x72, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x74, 0x72, 0x79,
+  0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x2c, 0x20,
+  0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x66, 0x6c, 0x61, 0x67, 0x29,
+  0x0a, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x74, 0x72, 0x20,
+  0x3d, 0x3d, 0x20, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x27, 0x27,
+  0x20, 0x72, 0x75, 0x6e, 0x20, 0x67, 0x61, 0x72, 0x62, 0x61, 0x67, 0x65,
+  0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x68, 0x65, 0x72, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x67, 0x63,
+  0x5f, 0x64, 0x6f, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x27, 0x20, 0x73, 0x65, 0x65, 0x20, 0x69, 0x66, 0x20,
+  0x67, 0x63, 0x20, 0x66, 0x72, 0x65, 0x65, 0x64, 0x20, 0x75, 0x70, 0x20,
+  0x65, 0x6e, 0x6f, 0x75, 0x67, 0x68, 0x20, 0x73, 0x70, 0x61, 0x63, 0x65,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x70, 0x74, 0x72, 0x20, 0x3a, 0x3d, 0x20,
+  0x5f, 0x67, 0x63, 0x5f, 0x74, 0x72, 0x79, 0x61, 0x6c, 0x6c, 0x6f, 0x63,
+  0x28, 0x73, 0x69, 0x7a, 0x65, 0x2c, 0x20, 0x72, 0x65, 0x73, 0x65, 0x72,
+  0x76, 0x65, 0x66, 0x6c, 0x61, 0x67, 0x29, 0x0a, 0x0a, 0x20, 0x20, 0x28,
+  0x73, 0x74, 0x61, 0x74, 0x73, 0x2c, 0x20, 0x7a, 0x70, 0x74, 0x72, 0x29,
   0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x70, 0x74, 0x72, 0x73,
-  0x0a, 0x20, 0x20, 0x70, 0x74, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x67,
+  0x28, 0x29, 0x0a, 0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x73, 0x20, 0x2b,
+  0x3d, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x53, 0x54, 0x41, 0x54, 0x53, 0x0a,
+  0x20, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x5b, 0x73, 0x74, 0x61, 0x74, 0x73,
+  0x5d, 0x5b, 0x47, 0x43, 0x5f, 0x53, 0x54, 0x41, 0x54, 0x5f, 0x41, 0x4c,
+  0x4c, 0x4f, 0x43, 0x53, 0x5d, 0x2b, 0x2b, 0x0a, 0x20, 0x20, 0x6c, 0x6f,
+  0x6e, 0x67, 0x5b, 0x73, 0x74, 0x61, 0x74, 0x73, 0x5d, 0x5b, 0x47, 0x43,
+  0x5f, 0x53, 0x54, 0x41, 0x54, 0x5f, 0x41, 0x4c, 0x4c, 0x4f, 0x43, 0x5f,
+  0x43, 0x59, 0x43, 0x4c, 0x45, 0x53, 0x5d, 0x20, 0x2b, 0x3d, 0x20, 0x5f,
+  0x67, 0x65, 0x74, 0x63, 0x6e, 0x74, 0x28, 0x29, 0x20, 0x2d, 0x20, 0x73,
+  0x74, 0x61, 0x72, 0x74, 0x74, 0x69, 0x6d, 0x65, 0x0a, 0x20, 0x20, 0x5f,
+  0x75, 0x6e, 0x6c, 0x6f, 0x63, 0x6b, 0x6d, 0x65, 0x6d, 0x28, 0x40, 0x5f,
+  0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x5f, 0x6d, 0x75, 0x74, 0x65, 0x78,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20,
+  0x70, 0x74, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x27, 0x20, 0x7a, 0x65,
+  0x72, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+  0x6e, 0x65, 0x64, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x3a, 0x3d, 0x20, 0x28,
+  0x28, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x3c, 0x3c, 0x20, 0x70, 0x61, 0x67,
+  0x65, 0x73, 0x69, 0x7a, 0x65, 0x73, 0x68, 0x69, 0x66, 0x74, 0x29, 0x20,
+  0x2d, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x69, 0x7a, 0x65,
+  0x29, 0x2f, 0x34, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7a, 0x70, 0x74, 0x72,
+  0x20, 0x3a, 0x3d, 0x20, 0x70, 0x74, 0x72, 0x20, 0x27, 0x20, 0x73, 0x6b,
+  0x69, 0x70, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65,
+  0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74,
+  0x20, 0x73, 0x69, 0x7a, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x6c, 0x6f, 0x6e, 0x67, 0x5b, 0x7a, 0x70, 0x74, 0x72, 0x5d, 0x20, 0x3a,
+  0x3d, 0x20, 0x30, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7a, 0x70,
+  0x74, 0x72, 0x20, 0x2b, 0x3d, 0x20, 0x34, 0x0a, 0x20, 0x20, 0x72, 0x65,
+  0x74, 0x75, 0x72, 0x6e, 0x20, 0x70, 0x74, 0x72, 0x0a, 0x0a, 0x27, 0x0a,
+  0x27, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x30, 0x20,
+  0x69, 0x66, 0x20, 0x70, 0x74, 0x72, 0x20, 0x69, 0x73, 0x20, 0x6e, 0x6f,
+  0x74, 0x20, 0x61, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x70, 0x6f,
+  0x69, 0x6e, 0x74, 0x65, 0x72, 0x0a, 0x27, 0x20, 0x6f, 0x74, 0x68, 0x65,
+  0x72, 0x77, 0x69, 0x73, 0x65, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
+  0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20,
+  0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b,
+  0x20, 0x69, 0x74, 0x0a, 0x27, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73,
+  0x20, 0x74, 0x6f, 0x0a, 0x27, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x67,
   0x63, 0x5f, 0x69, 0x73, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x70, 0x74, 0x72,
-  0x28, 0x68, 0x65, 0x61, 0x70, 0x62, 0x61, 0x73, 0x65, 0x2c, 0x20, 0x68,
-  0x65, 0x61, 0x70, 0x65, 0x6e, 0x64, 0x2c, 0x20, 0x70, 0x74, 0x72, 0x29,
-  0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x74, 0x72, 0x29, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x5f, 0x6c, 0x6f, 0x63, 0x6b, 0x6d, 0x65, 0x6d,
-  0x28, 0x40, 0x5f, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x5f, 0x6d, 0x75,
-  0x74, 0x65, 0x78, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x67, 0x63,
-  0x5f, 0x64, 0x6f, 0x66, 0x72, 0x65, 0x65, 0x28, 0x70, 0x74, 0x72, 0x29,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x75, 0x6e, 0x6c, 0x6f, 0x63, 0x6b,
-  0x6d, 0x65, 0x6d, 0x28, 0x40, 0x5f, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79,
-  0x5f, 0x6d, 0x75, 0x74, 0x65, 0x78, 0x29, 0x0a, 0x0a, 0x27, 0x0a, 0x27,
-  0x20, 0x75, 0x6e, 0x2d, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x20,
-  0x61, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x70, 0x72,
-  0x65, 0x76, 0x69, 0x6f, 0x75, 0x73, 0x6c, 0x79, 0x20, 0x72, 0x65, 0x74,
-  0x75, 0x72, 0x6e, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x61, 0x6c, 0x6c,
-  0x6f, 0x63, 0x0a, 0x27, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x67, 0x63,
-  0x5f, 0x6d, 0x61, 0x6e, 0x61, 0x67, 0x65, 0x28, 0x70, 0x74, 0x72, 0x29,
+  0x28, 0x62, 0x61, 0x73, 0x65, 0x2c, 0x20, 0x68, 0x65, 0x61, 0x70, 0x5f,
+  0x65, 0x6e, 0x64, 0x2c, 0x20, 0x70, 0x74, 0x72, 0x29, 0x20, 0x7c, 0x20,
+  0x74, 0x0a, 0x20, 0x20, 0x27, 0x20, 0x6d, 0x61, 0x6b, 0x65, 0x20, 0x73,
+  0x75, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x6f, 0x69, 0x74,
+  0x65, 0x72, 0x20, 0x63, 0x61, 0x6d, 0x65, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20,
+  0x28, 0x70, 0x74, 0x72, 0x20, 0x26, 0x20, 0x50, 0x4f, 0x49, 0x4e, 0x54,
+  0x45, 0x52, 0x5f, 0x4d, 0x41, 0x47, 0x49, 0x43, 0x5f, 0x4d, 0x41, 0x53,
+  0x4b, 0x29, 0x20, 0x3c, 0x3e, 0x20, 0x50, 0x4f, 0x49, 0x4e, 0x54, 0x45,
+  0x52, 0x5f, 0x4d, 0x41, 0x47, 0x49, 0x43, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x30, 0x0a, 0x20, 0x20, 0x27,
+  0x20, 0x73, 0x74, 0x65, 0x70, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x20, 0x74,
+  0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72,
+  0x0a, 0x20, 0x20, 0x70, 0x74, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x28, 0x70,
+  0x74, 0x72, 0x20, 0x2d, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73,
+  0x69, 0x7a, 0x65, 0x29, 0x20, 0x26, 0x20, 0x28, 0x21, 0x50, 0x4f, 0x49,
+  0x4e, 0x54, 0x45, 0x52, 0x5f, 0x4d, 0x41, 0x47, 0x49, 0x43, 0x5f, 0x4d,
+  0x41, 0x53, 0x4b, 0x29, 0x0a, 0x20, 0x20, 0x27, 0x20, 0x6d, 0x61, 0x6b,
+  0x65, 0x20, 0x73, 0x75, 0x72, 0x65, 0x20, 0x69, 0x74, 0x20, 0x69, 0x73,
+  0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x65, 0x61, 0x70,
+  0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x74, 0x72, 0x20, 0x3c,
+  0x20, 0x62, 0x61, 0x73, 0x65, 0x29, 0x20, 0x6f, 0x72, 0x20, 0x28, 0x70,
+  0x74, 0x72, 0x20, 0x3d, 0x3e, 0x20, 0x68, 0x65, 0x61, 0x70, 0x5f, 0x65,
+  0x6e, 0x64, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75,
+  0x72, 0x6e, 0x20, 0x30, 0x0a, 0x0a, 0x20, 0x20, 0x27, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x61, 0x70, 0x70, 0x72, 0x6f, 0x70, 0x72, 0x69, 0x61, 0x74,
+  0x65, 0x6c, 0x79, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+  0x28, 0x73, 0x61, 0x6d, 0x65, 0x20, 0x61, 0x73, 0x20, 0x5f, 0x67, 0x63,
+  0x5f, 0x68, 0x65, 0x61, 0x70, 0x5f, 0x62, 0x61, 0x73, 0x65, 0x29, 0x0a,
+  0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x20, 0x28, 0x70, 0x74, 0x72, 0x20,
+  0x5e, 0x20, 0x62, 0x61, 0x73, 0x65, 0x29, 0x20, 0x26, 0x20, 0x70, 0x61,
+  0x67, 0x65, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x20, 0x3c, 0x3e, 0x20, 0x30,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20,
+  0x30, 0x0a, 0x0a, 0x20, 0x20, 0x27, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6d,
+  0x61, 0x6b, 0x65, 0x20, 0x73, 0x75, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x47, 0x43, 0x5f, 0x4d, 0x41, 0x47, 0x49, 0x43, 0x20, 0x62, 0x69,
+  0x74, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x65, 0x74, 0x20, 0x69,
+  0x6e, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x0a, 0x20, 0x20, 0x74, 0x20,
+  0x3a, 0x3d, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x70, 0x74, 0x72, 0x20,
+  0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x46, 0x4c, 0x41, 0x47, 0x53, 0x5d,
+  0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x74, 0x20, 0x26, 0x20, 0x47,
+  0x43, 0x5f, 0x4d, 0x41, 0x47, 0x49, 0x43, 0x5f, 0x4d, 0x41, 0x53, 0x4b,
+  0x29, 0x20, 0x3c, 0x3e, 0x20, 0x47, 0x43, 0x5f, 0x4d, 0x41, 0x47, 0x49,
+  0x43, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
+  0x20, 0x30, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20,
+  0x70, 0x74, 0x72, 0x0a, 0x0a, 0x27, 0x0a, 0x27, 0x20, 0x66, 0x72, 0x65,
+  0x65, 0x20, 0x61, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x20,
+  0x70, 0x72, 0x65, 0x76, 0x69, 0x6f, 0x75, 0x73, 0x6c, 0x79, 0x20, 0x72,
+  0x65, 0x74, 0x75, 0x72, 0x6e, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x61,
+  0x6c, 0x6c, 0x6f, 0x63, 0x0a, 0x27, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f,
+  0x67, 0x63, 0x5f, 0x66, 0x72, 0x65, 0x65, 0x28, 0x70, 0x74, 0x72, 0x29,
   0x20, 0x7c, 0x20, 0x68, 0x65, 0x61, 0x70, 0x62, 0x61, 0x73, 0x65, 0x2c,
-  0x20, 0x68, 0x65, 0x61, 0x70, 0x65, 0x6e, 0x64, 0x0a, 0x20, 0x20, 0x28,
+  0x20, 0x68, 0x65, 0x61, 0x70, 0x65, 0x6e, 0x64, 0x2c, 0x20, 0x73, 0x69,
+  0x7a, 0x65, 0x2c, 0x20, 0x68, 0x65, 0x61, 0x64, 0x0a, 0x20, 0x20, 0x28,
   0x68, 0x65, 0x61, 0x70, 0x62, 0x61, 0x73, 0x65, 0x2c, 0x20, 0x68, 0x65,
   0x61, 0x70, 0x65, 0x6e, 0x64, 0x29, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x67,
   0x63, 0x5f, 0x70, 0x74, 0x72, 0x73, 0x0a, 0x20, 0x20, 0x70, 0x74, 0x72,
@@ -701,291 +830,460 @@ unsigned char sys_gcalloc_spin[] = {
   0x6c, 0x69, 0x64, 0x70, 0x74, 0x72, 0x28, 0x68, 0x65, 0x61, 0x70, 0x62,
   0x61, 0x73, 0x65, 0x2c, 0x20, 0x68, 0x65, 0x61, 0x70, 0x65, 0x6e, 0x64,
   0x2c, 0x20, 0x70, 0x74, 0x72, 0x29, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20,
-  0x28, 0x70, 0x74, 0x72, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x77, 0x6f,
-  0x72, 0x64, 0x5b, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46,
-  0x5f, 0x46, 0x4c, 0x41, 0x47, 0x53, 0x5d, 0x20, 0x26, 0x3d, 0x20, 0x21,
-  0x47, 0x43, 0x5f, 0x46, 0x4c, 0x41, 0x47, 0x5f, 0x52, 0x45, 0x53, 0x45,
-  0x52, 0x56, 0x45, 0x44, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x0a, 0x27, 0x0a,
-  0x27, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x6e, 0x61, 0x6c, 0x20, 0x72,
-  0x6f, 0x75, 0x74, 0x69, 0x6e, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x66,
-  0x72, 0x65, 0x65, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x20, 0x62, 0x6c, 0x6f,
-  0x63, 0x6b, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79,
-  0x0a, 0x27, 0x20, 0x70, 0x74, 0x72, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74,
-  0x73, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61,
-  0x72, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x6c,
-  0x6f, 0x63, 0x6b, 0x0a, 0x27, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
-  0x73, 0x20, 0x61, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x20,
-  0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x20,
-  0x6e, 0x6f, 0x6e, 0x2d, 0x66, 0x72, 0x65, 0x65, 0x20, 0x62, 0x6c, 0x6f,
-  0x63, 0x6b, 0x28, 0x75, 0x73, 0x65, 0x66, 0x75, 0x6c, 0x20, 0x66, 0x6f,
-  0x72, 0x0a, 0x27, 0x20, 0x67, 0x61, 0x72, 0x62, 0x61, 0x67, 0x65, 0x20,
-  0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20,
-  0x74, 0x6f, 0x20, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x20, 0x63, 0x61,
-  0x73, 0x65, 0x73, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x6d, 0x65,
-  0x6d, 0x6f, 0x72, 0x79, 0x20, 0x69, 0x73, 0x20, 0x63, 0x6f, 0x61, 0x6c,
-  0x65, 0x73, 0x63, 0x65, 0x64, 0x29, 0x0a, 0x27, 0x0a, 0x70, 0x72, 0x69,
-  0x20, 0x5f, 0x67, 0x63, 0x5f, 0x64, 0x6f, 0x66, 0x72, 0x65, 0x65, 0x28,
-  0x70, 0x74, 0x72, 0x29, 0x20, 0x7c, 0x20, 0x70, 0x72, 0x65, 0x76, 0x70,
-  0x74, 0x72, 0x2c, 0x20, 0x74, 0x6d, 0x70, 0x70, 0x74, 0x72, 0x2c, 0x20,
-  0x6e, 0x65, 0x78, 0x74, 0x70, 0x74, 0x72, 0x2c, 0x20, 0x68, 0x65, 0x61,
-  0x70, 0x62, 0x61, 0x73, 0x65, 0x2c, 0x20, 0x68, 0x65, 0x61, 0x70, 0x65,
-  0x6e, 0x64, 0x2c, 0x20, 0x6e, 0x0a, 0x20, 0x20, 0x28, 0x68, 0x65, 0x61,
-  0x70, 0x62, 0x61, 0x73, 0x65, 0x2c, 0x20, 0x68, 0x65, 0x61, 0x70, 0x65,
-  0x6e, 0x64, 0x29, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x70,
-  0x74, 0x72, 0x73, 0x0a, 0x20, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x70,
-  0x74, 0x72, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x46, 0x4c, 0x41,
-  0x47, 0x53, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x47, 0x43, 0x5f, 0x4d, 0x41,
-  0x47, 0x49, 0x43, 0x20, 0x2b, 0x20, 0x47, 0x43, 0x5f, 0x46, 0x4c, 0x41,
-  0x47, 0x5f, 0x46, 0x52, 0x45, 0x45, 0x0a, 0x20, 0x20, 0x70, 0x72, 0x65,
-  0x76, 0x70, 0x74, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x70, 0x74, 0x72, 0x0a,
-  0x20, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x70, 0x74, 0x72, 0x20, 0x3a, 0x3d,
-  0x20, 0x5f, 0x67, 0x63, 0x5f, 0x6e, 0x65, 0x78, 0x74, 0x42, 0x6c, 0x6f,
-  0x63, 0x6b, 0x50, 0x74, 0x72, 0x28, 0x70, 0x74, 0x72, 0x29, 0x0a, 0x20,
-  0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x27, 0x27, 0x20, 0x77, 0x61, 0x6c, 0x6b, 0x20, 0x62, 0x61, 0x63, 0x6b,
-  0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x68, 0x61, 0x69, 0x6e, 0x20, 0x74,
-  0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x61, 0x73, 0x74, 0x20, 0x70,
-  0x72, 0x65, 0x76, 0x69, 0x6f, 0x75, 0x73, 0x20, 0x66, 0x72, 0x65, 0x65,
-  0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x70,
-  0x72, 0x65, 0x76, 0x70, 0x74, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x67,
-  0x63, 0x5f, 0x70, 0x61, 0x67, 0x65, 0x70, 0x74, 0x72, 0x28, 0x68, 0x65,
-  0x61, 0x70, 0x62, 0x61, 0x73, 0x65, 0x2c, 0x20, 0x77, 0x6f, 0x72, 0x64,
-  0x5b, 0x70, 0x72, 0x65, 0x76, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x20, 0x4f,
-  0x46, 0x46, 0x5f, 0x50, 0x52, 0x45, 0x56, 0x5d, 0x29, 0x0a, 0x20, 0x20,
-  0x75, 0x6e, 0x74, 0x69, 0x6c, 0x20, 0x70, 0x72, 0x65, 0x76, 0x70, 0x74,
-  0x72, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x20, 0x5f, 0x5f, 0x6f, 0x72, 0x65,
-  0x6c, 0x73, 0x65, 0x5f, 0x5f, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x69, 0x73,
-  0x46, 0x72, 0x65, 0x65, 0x28, 0x70, 0x72, 0x65, 0x76, 0x70, 0x74, 0x72,
-  0x29, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x72, 0x65, 0x76,
-  0x70, 0x74, 0x72, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x70, 0x72, 0x65, 0x76, 0x70, 0x74, 0x72, 0x20, 0x3a, 0x3d,
-  0x20, 0x68, 0x65, 0x61, 0x70, 0x62, 0x61, 0x73, 0x65, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x0a, 0x20, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x70, 0x74,
-  0x72, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x4c, 0x49, 0x4e, 0x4b,
-  0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x70, 0x72,
-  0x65, 0x76, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f,
-  0x4c, 0x49, 0x4e, 0x4b, 0x5d, 0x0a, 0x20, 0x20, 0x77, 0x6f, 0x72, 0x64,
-  0x5b, 0x70, 0x72, 0x65, 0x76, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x20, 0x4f,
-  0x46, 0x46, 0x5f, 0x4c, 0x49, 0x4e, 0x4b, 0x5d, 0x20, 0x3a, 0x3d, 0x20,
-  0x5f, 0x67, 0x63, 0x5f, 0x70, 0x61, 0x67, 0x65, 0x69, 0x6e, 0x64, 0x65,
-  0x78, 0x28, 0x68, 0x65, 0x61, 0x70, 0x62, 0x61, 0x73, 0x65, 0x2c, 0x20,
-  0x70, 0x74, 0x72, 0x29, 0x0a, 0x0a, 0x20, 0x20, 0x27, 0x20, 0x73, 0x65,
-  0x65, 0x20, 0x69, 0x66, 0x20, 0x77, 0x65, 0x20, 0x73, 0x68, 0x6f, 0x75,
-  0x6c, 0x64, 0x20, 0x6d, 0x65, 0x72, 0x67, 0x65, 0x20, 0x77, 0x69, 0x74,
-  0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x65, 0x76, 0x69, 0x6f,
-  0x75, 0x73, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x0a, 0x20, 0x20, 0x69,
-  0x66, 0x20, 0x28, 0x70, 0x72, 0x65, 0x76, 0x70, 0x74, 0x72, 0x20, 0x3c,
-  0x3e, 0x20, 0x68, 0x65, 0x61, 0x70, 0x62, 0x61, 0x73, 0x65, 0x29, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x70, 0x74, 0x72, 0x20, 0x3a,
+  0x28, 0x70, 0x74, 0x72, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x6c,
+  0x6f, 0x63, 0x6b, 0x6d, 0x65, 0x6d, 0x28, 0x40, 0x5f, 0x6d, 0x65, 0x6d,
+  0x6f, 0x72, 0x79, 0x5f, 0x6d, 0x75, 0x74, 0x65, 0x78, 0x29, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x3a, 0x3d, 0x20, 0x77,
+  0x6f, 0x72, 0x64, 0x5b, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x20, 0x4f, 0x46,
+  0x46, 0x5f, 0x53, 0x49, 0x5a, 0x45, 0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x69, 0x66, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x69, 0x73, 0x46, 0x72, 0x65,
+  0x65, 0x28, 0x70, 0x74, 0x72, 0x29, 0x20, 0x6f, 0x72, 0x20, 0x5f, 0x67,
+  0x63, 0x5f, 0x69, 0x73, 0x43, 0x61, 0x63, 0x68, 0x65, 0x64, 0x28, 0x70,
+  0x74, 0x72, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x20,
+  0x61, 0x6c, 0x72, 0x65, 0x61, 0x64, 0x79, 0x20, 0x66, 0x72, 0x65, 0x65,
+  0x64, 0x2c, 0x20, 0x73, 0x6f, 0x20, 0x6e, 0x6f, 0x74, 0x68, 0x69, 0x6e,
+  0x67, 0x20, 0x74, 0x6f, 0x20, 0x64, 0x6f, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x65, 0x6c, 0x73, 0x65, 0x69, 0x66, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20,
+  0x3d, 0x3c, 0x20, 0x47, 0x43, 0x5f, 0x4e, 0x55, 0x4d, 0x5f, 0x43, 0x4c,
+  0x41, 0x53, 0x53, 0x45, 0x53, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x27, 0x20, 0x6b, 0x65, 0x65, 0x70, 0x20, 0x69, 0x74, 0x20, 0x66, 0x6f,
+  0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x20, 0x61,
+  0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6d, 0x65, 0x20, 0x73, 0x69,
+  0x7a, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x61,
+  0x64, 0x20, 0x3a, 0x3d, 0x20, 0x68, 0x65, 0x61, 0x70, 0x62, 0x61, 0x73,
+  0x65, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x43, 0x4c, 0x41, 0x53,
+  0x53, 0x20, 0x2b, 0x20, 0x32, 0x2a, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x2d,
+  0x31, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x6f, 0x72,
+  0x64, 0x5b, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f,
+  0x46, 0x4c, 0x41, 0x47, 0x53, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x47, 0x43,
+  0x5f, 0x4d, 0x41, 0x47, 0x49, 0x43, 0x20, 0x2b, 0x20, 0x47, 0x43, 0x5f,
+  0x4f, 0x57, 0x4e, 0x45, 0x52, 0x5f, 0x43, 0x41, 0x43, 0x48, 0x45, 0x44,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b,
+  0x70, 0x74, 0x72, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x4c, 0x49,
+  0x4e, 0x4b, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b,
+  0x68, 0x65, 0x61, 0x64, 0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x77, 0x6f, 0x72, 0x64, 0x5b, 0x68, 0x65, 0x61, 0x64, 0x5d, 0x20, 0x3a,
+  0x3d, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x70, 0x61, 0x67, 0x65, 0x69, 0x6e,
+  0x64, 0x65, 0x78, 0x28, 0x68, 0x65, 0x61, 0x70, 0x62, 0x61, 0x73, 0x65,
+  0x2c, 0x20, 0x70, 0x74, 0x72, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x65,
+  0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x67,
+  0x63, 0x5f, 0x64, 0x6f, 0x66, 0x72, 0x65, 0x65, 0x28, 0x70, 0x74, 0x72,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x75, 0x6e, 0x6c, 0x6f, 0x63,
+  0x6b, 0x6d, 0x65, 0x6d, 0x28, 0x40, 0x5f, 0x6d, 0x65, 0x6d, 0x6f, 0x72,
+  0x79, 0x5f, 0x6d, 0x75, 0x74, 0x65, 0x78, 0x29, 0x0a, 0x0a, 0x27, 0x0a,
+  0x27, 0x20, 0x75, 0x6e, 0x2d, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65,
+  0x20, 0x61, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x70,
+  0x72, 0x65, 0x76, 0x69, 0x6f, 0x75, 0x73, 0x6c, 0x79, 0x20, 0x72, 0x65,
+  0x74, 0x75, 0x72, 0x6e, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x61, 0x6c,
+  0x6c, 0x6f, 0x63, 0x0a, 0x27, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x67,
+  0x63, 0x5f, 0x6d, 0x61, 0x6e, 0x61, 0x67, 0x65, 0x28, 0x70, 0x74, 0x72,
+  0x29, 0x20, 0x7c, 0x20, 0x68, 0x65, 0x61, 0x70, 0x62, 0x61, 0x73, 0x65,
+  0x2c, 0x20, 0x68, 0x65, 0x61, 0x70, 0x65, 0x6e, 0x64, 0x0a, 0x20, 0x20,
+  0x28, 0x68, 0x65, 0x61, 0x70, 0x62, 0x61, 0x73, 0x65, 0x2c, 0x20, 0x68,
+  0x65, 0x61, 0x70, 0x65, 0x6e, 0x64, 0x29, 0x20, 0x3a, 0x3d, 0x20, 0x5f,
+  0x67, 0x63, 0x5f, 0x70, 0x74, 0x72, 0x73, 0x0a, 0x20, 0x20, 0x70, 0x74,
+  0x72, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x69, 0x73, 0x76,
+  0x61, 0x6c, 0x69, 0x64, 0x70, 0x74, 0x72, 0x28, 0x68, 0x65, 0x61, 0x70,
+  0x62, 0x61, 0x73, 0x65, 0x2c, 0x20, 0x68, 0x65, 0x61, 0x70, 0x65, 0x6e,
+  0x64, 0x2c, 0x20, 0x70, 0x74, 0x72, 0x29, 0x0a, 0x20, 0x20, 0x69, 0x66,
+  0x20, 0x28, 0x70, 0x74, 0x72, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x77,
+  0x6f, 0x72, 0x64, 0x5b, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x20, 0x4f, 0x46,
+  0x46, 0x5f, 0x46, 0x4c, 0x41, 0x47, 0x53, 0x5d, 0x20, 0x26, 0x3d, 0x20,
+  0x21, 0x47, 0x43, 0x5f, 0x46, 0x4c, 0x41, 0x47, 0x5f, 0x52, 0x45, 0x53,
+  0x45, 0x52, 0x56, 0x45, 0x44, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x0a, 0x27,
+  0x0a, 0x27, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x6e, 0x61, 0x6c, 0x20,
+  0x72, 0x6f, 0x75, 0x74, 0x69, 0x6e, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20,
+  0x66, 0x72, 0x65, 0x65, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x20, 0x62, 0x6c,
+  0x6f, 0x63, 0x6b, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72,
+  0x79, 0x0a, 0x27, 0x20, 0x70, 0x74, 0x72, 0x20, 0x70, 0x6f, 0x69, 0x6e,
+  0x74, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74,
+  0x61, 0x72, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62,
+  0x6c, 0x6f, 0x63, 0x6b, 0x0a, 0x27, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+  0x6e, 0x73, 0x20, 0x61, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72,
+  0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x65, 0x78, 0x74,
+  0x20, 0x6e, 0x6f, 0x6e, 0x2d, 0x66, 0x72, 0x65, 0x65, 0x20, 0x62, 0x6c,
+  0x6f, 0x63, 0x6b, 0x28, 0x75, 0x73, 0x65, 0x66, 0x75, 0x6c, 0x20, 0x66,
+  0x6f, 0x72, 0x0a, 0x27, 0x20, 0x67, 0x61, 0x72, 0x62, 0x61, 0x67, 0x65,
+  0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2c,
+  0x20, 0x74, 0x6f, 0x20, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x20, 0x63,
+  0x61, 0x73, 0x65, 0x73, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x6d,
+  0x65, 0x6d, 0x6f, 0x72, 0x79, 0x20, 0x69, 0x73, 0x20, 0x63, 0x6f, 0x61,
+  0x6c, 0x65, 0x73, 0x63, 0x65, 0x64, 0x29, 0x0a, 0x27, 0x0a, 0x70, 0x72,
+  0x69, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x64, 0x6f, 0x66, 0x72, 0x65, 0x65,
+  0x28, 0x70, 0x74, 0x72, 0x29, 0x20, 0x7c, 0x20, 0x70, 0x72, 0x65, 0x76,
+  0x70, 0x74, 0x72, 0x2c, 0x20, 0x74, 0x6d, 0x70, 0x70, 0x74, 0x72, 0x2c,
+  0x20, 0x6e, 0x65, 0x78, 0x74, 0x70, 0x74, 0x72, 0x2c, 0x20, 0x68, 0x65,
+  0x61, 0x70, 0x62, 0x61, 0x73, 0x65, 0x2c, 0x20, 0x68, 0x65, 0x61, 0x70,
+  0x65, 0x6e, 0x64, 0x2c, 0x20, 0x6e, 0x0a, 0x20, 0x20, 0x28, 0x68, 0x65,
+  0x61, 0x70, 0x62, 0x61, 0x73, 0x65, 0x2c, 0x20, 0x68, 0x65, 0x61, 0x70,
+  0x65, 0x6e, 0x64, 0x29, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x67, 0x63, 0x5f,
+  0x70, 0x74, 0x72, 0x73, 0x0a, 0x20, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b,
+  0x70, 0x74, 0x72, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x46, 0x4c,
+  0x41, 0x47, 0x53, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x47, 0x43, 0x5f, 0x4d,
+  0x41, 0x47, 0x49, 0x43, 0x20, 0x2b, 0x20, 0x47, 0x43, 0x5f, 0x46, 0x4c,
+  0x41, 0x47, 0x5f, 0x46, 0x52, 0x45, 0x45, 0x0a, 0x20, 0x20, 0x70, 0x72,
+  0x65, 0x76, 0x70, 0x74, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x70, 0x74, 0x72,
+  0x0a, 0x20, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x70, 0x74, 0x72, 0x20, 0x3a,
   0x3d, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x6e, 0x65, 0x78, 0x74, 0x42, 0x6c,
-  0x6f, 0x63, 0x6b, 0x50, 0x74, 0x72, 0x28, 0x70, 0x72, 0x65, 0x76, 0x70,
-  0x74, 0x72, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
-  0x74, 0x6d, 0x70, 0x70, 0x74, 0x72, 0x20, 0x3d, 0x3d, 0x20, 0x70, 0x74,
-  0x72, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x6f, 0x72,
-  0x64, 0x5b, 0x70, 0x72, 0x65, 0x76, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x20,
-  0x4f, 0x46, 0x46, 0x5f, 0x53, 0x49, 0x5a, 0x45, 0x5d, 0x20, 0x2b, 0x3d,
-  0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x20,
-  0x4f, 0x46, 0x46, 0x5f, 0x53, 0x49, 0x5a, 0x45, 0x5d, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x70, 0x74, 0x72,
-  0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x46, 0x4c, 0x41, 0x47, 0x53,
-  0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x30, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x27, 0x20, 0x61, 0x64, 0x6a, 0x75, 0x73, 0x74, 0x20, 0x70, 0x72,
-  0x65, 0x76, 0x20, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x69, 0x6e, 0x20, 0x6e,
-  0x65, 0x78, 0x74, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x70, 0x74, 0x72, 0x20,
-  0x3a, 0x3d, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x6e, 0x65, 0x78, 0x74, 0x42,
-  0x6c, 0x6f, 0x63, 0x6b, 0x50, 0x74, 0x72, 0x28, 0x70, 0x74, 0x72, 0x29,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6e,
-  0x65, 0x78, 0x74, 0x70, 0x74, 0x72, 0x20, 0x3c, 0x20, 0x68, 0x65, 0x61,
-  0x70, 0x65, 0x6e, 0x64, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x6e, 0x65, 0x78, 0x74, 0x70,
-  0x74, 0x72, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x50, 0x52, 0x45,
-  0x56, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x70, 0x61,
-  0x67, 0x65, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x28, 0x68, 0x65, 0x61, 0x70,
-  0x62, 0x61, 0x73, 0x65, 0x2c, 0x20, 0x70, 0x72, 0x65, 0x76, 0x70, 0x74,
-  0x72, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x6f, 0x72,
+  0x6f, 0x63, 0x6b, 0x50, 0x74, 0x72, 0x28, 0x70, 0x74, 0x72, 0x29, 0x0a,
+  0x20, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x27, 0x27, 0x20, 0x77, 0x61, 0x6c, 0x6b, 0x20, 0x62, 0x61, 0x63,
+  0x6b, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x68, 0x61, 0x69, 0x6e, 0x20,
+  0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x61, 0x73, 0x74, 0x20,
+  0x70, 0x72, 0x65, 0x76, 0x69, 0x6f, 0x75, 0x73, 0x20, 0x66, 0x72, 0x65,
+  0x65, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x70, 0x72, 0x65, 0x76, 0x70, 0x74, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x5f,
+  0x67, 0x63, 0x5f, 0x70, 0x61, 0x67, 0x65, 0x70, 0x74, 0x72, 0x28, 0x68,
+  0x65, 0x61, 0x70, 0x62, 0x61, 0x73, 0x65, 0x2c, 0x20, 0x77, 0x6f, 0x72,
   0x64, 0x5b, 0x70, 0x72, 0x65, 0x76, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x20,
-  0x4f, 0x46, 0x46, 0x5f, 0x4c, 0x49, 0x4e, 0x4b, 0x5d, 0x20, 0x3a, 0x3d,
-  0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x20,
-  0x4f, 0x46, 0x46, 0x5f, 0x4c, 0x49, 0x4e, 0x4b, 0x5d, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x70, 0x74, 0x72,
-  0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x4c, 0x49, 0x4e, 0x4b, 0x5d,
-  0x20, 0x3a, 0x3d, 0x20, 0x30, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x70, 0x74, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x70, 0x72, 0x65, 0x76, 0x70,
-  0x74, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0a, 0x20, 0x20,
-  0x27, 0x27, 0x20, 0x73, 0x65, 0x65, 0x20, 0x69, 0x66, 0x20, 0x77, 0x65,
-  0x20, 0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x6d, 0x65, 0x72, 0x67,
-  0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x66, 0x6f, 0x6c, 0x6c, 0x6f,
-  0x77, 0x69, 0x6e, 0x67, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x0a, 0x20,
-  0x20, 0x74, 0x6d, 0x70, 0x70, 0x74, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x5f,
-  0x67, 0x63, 0x5f, 0x6e, 0x65, 0x78, 0x74, 0x42, 0x6c, 0x6f, 0x63, 0x6b,
-  0x50, 0x74, 0x72, 0x28, 0x70, 0x74, 0x72, 0x29, 0x0a, 0x20, 0x20, 0x69,
-  0x66, 0x20, 0x74, 0x6d, 0x70, 0x70, 0x74, 0x72, 0x20, 0x5f, 0x5f, 0x61,
-  0x6e, 0x64, 0x74, 0x68, 0x65, 0x6e, 0x5f, 0x5f, 0x20, 0x28, 0x74, 0x6d,
-  0x70, 0x70, 0x74, 0x72, 0x20, 0x3c, 0x20, 0x68, 0x65, 0x61, 0x70, 0x65,
-  0x6e, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x61, 0x6e, 0x64, 0x74, 0x68, 0x65,
-  0x6e, 0x5f, 0x5f, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x69, 0x73, 0x46, 0x72,
-  0x65, 0x65, 0x28, 0x74, 0x6d, 0x70, 0x70, 0x74, 0x72, 0x29, 0x0a, 0x20,
+  0x4f, 0x46, 0x46, 0x5f, 0x50, 0x52, 0x45, 0x56, 0x5d, 0x29, 0x0a, 0x20,
+  0x20, 0x75, 0x6e, 0x74, 0x69, 0x6c, 0x20, 0x70, 0x72, 0x65, 0x76, 0x70,
+  0x74, 0x72, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x20, 0x5f, 0x5f, 0x6f, 0x72,
+  0x65, 0x6c, 0x73, 0x65, 0x5f, 0x5f, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x69,
+  0x73, 0x46, 0x72, 0x65, 0x65, 0x28, 0x70, 0x72, 0x65, 0x76, 0x70, 0x74,
+  0x72, 0x29, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x72, 0x65,
+  0x76, 0x70, 0x74, 0x72, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x0a, 0x20,
   0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 0x76, 0x70, 0x74, 0x72, 0x20, 0x3a,
-  0x3d, 0x20, 0x70, 0x74, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x70, 0x74,
-  0x72, 0x20, 0x3a, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x70, 0x74, 0x72, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x70, 0x72, 0x65,
-  0x76, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x53,
-  0x49, 0x5a, 0x45, 0x5d, 0x20, 0x2b, 0x3d, 0x20, 0x77, 0x6f, 0x72, 0x64,
-  0x5b, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x53,
-  0x49, 0x5a, 0x45, 0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x77, 0x6f, 0x72,
+  0x3d, 0x20, 0x68, 0x65, 0x61, 0x70, 0x62, 0x61, 0x73, 0x65, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x0a, 0x20, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x70,
+  0x74, 0x72, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x4c, 0x49, 0x4e,
+  0x4b, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x70,
+  0x72, 0x65, 0x76, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46,
+  0x5f, 0x4c, 0x49, 0x4e, 0x4b, 0x5d, 0x0a, 0x20, 0x20, 0x77, 0x6f, 0x72,
   0x64, 0x5b, 0x70, 0x72, 0x65, 0x76, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x20,
   0x4f, 0x46, 0x46, 0x5f, 0x4c, 0x49, 0x4e, 0x4b, 0x5d, 0x20, 0x3a, 0x3d,
-  0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x20,
-  0x4f, 0x46, 0x46, 0x5f, 0x4c, 0x49, 0x4e, 0x4b, 0x5d, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x70, 0x74, 0x72, 0x20, 0x2b,
-  0x20, 0x4f, 0x46, 0x46, 0x5f, 0x46, 0x4c, 0x41, 0x47, 0x53, 0x5d, 0x20,
-  0x3a, 0x3d, 0x20, 0x24, 0x41, 0x41, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x77,
-  0x6f, 0x72, 0x64, 0x5b, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x20, 0x4f, 0x46,
-  0x46, 0x5f, 0x4c, 0x49, 0x4e, 0x4b, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x30,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x70, 0x74, 0x72,
+  0x20, 0x5f, 0x67, 0x63, 0x5f, 0x70, 0x61, 0x67, 0x65, 0x69, 0x6e, 0x64,
+  0x65, 0x78, 0x28, 0x68, 0x65, 0x61, 0x70, 0x62, 0x61, 0x73, 0x65, 0x2c,
+  0x20, 0x70, 0x74, 0x72, 0x29, 0x0a, 0x0a, 0x20, 0x20, 0x27, 0x20, 0x73,
+  0x65, 0x65, 0x20, 0x69, 0x66, 0x20, 0x77, 0x65, 0x20, 0x73, 0x68, 0x6f,
+  0x75, 0x6c, 0x64, 0x20, 0x6d, 0x65, 0x72, 0x67, 0x65, 0x20, 0x77, 0x69,
+  0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x65, 0x76, 0x69,
+  0x6f, 0x75, 0x73, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x0a, 0x20, 0x20,
+  0x69, 0x66, 0x20, 0x28, 0x70, 0x72, 0x65, 0x76, 0x70, 0x74, 0x72, 0x20,
+  0x3c, 0x3e, 0x20, 0x68, 0x65, 0x61, 0x70, 0x62, 0x61, 0x73, 0x65, 0x29,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x70, 0x74, 0x72, 0x20,
+  0x3a, 0x3d, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x6e, 0x65, 0x78, 0x74, 0x42,
+  0x6c, 0x6f, 0x63, 0x6b, 0x50, 0x74, 0x72, 0x28, 0x70, 0x72, 0x65, 0x76,
+  0x70, 0x74, 0x72, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
+  0x28, 0x74, 0x6d, 0x70, 0x70, 0x74, 0x72, 0x20, 0x3d, 0x3d, 0x20, 0x70,
+  0x74, 0x72, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x6f,
+  0x72, 0x64, 0x5b, 0x70, 0x72, 0x65, 0x76, 0x70, 0x74, 0x72, 0x20, 0x2b,
+  0x20, 0x4f, 0x46, 0x46, 0x5f, 0x53, 0x49, 0x5a, 0x45, 0x5d, 0x20, 0x2b,
+  0x3d, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x70, 0x74, 0x72, 0x20, 0x2b,
+  0x20, 0x4f, 0x46, 0x46, 0x5f, 0x53, 0x49, 0x5a, 0x45, 0x5d, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x70, 0x74,
+  0x72, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x46, 0x4c, 0x41, 0x47,
+  0x53, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x30, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x27, 0x20, 0x61, 0x64, 0x6a, 0x75, 0x73, 0x74, 0x20, 0x70,
+  0x72, 0x65, 0x76, 0x20, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x69, 0x6e, 0x20,
+  0x6e, 0x65, 0x78, 0x74, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x70, 0x74, 0x72,
   0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x6e, 0x65, 0x78, 0x74,
   0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x50, 0x74, 0x72, 0x28, 0x70, 0x74, 0x72,
-  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6e, 0x65,
-  0x78, 0x74, 0x70, 0x74, 0x72, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6e, 0x65,
-  0x78, 0x74, 0x70, 0x74, 0x72, 0x20, 0x3c, 0x20, 0x68, 0x65, 0x61, 0x70,
-  0x65, 0x6e, 0x64, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77,
-  0x6f, 0x72, 0x64, 0x5b, 0x6e, 0x65, 0x78, 0x74, 0x70, 0x74, 0x72, 0x20,
-  0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x50, 0x52, 0x45, 0x56, 0x5d, 0x20,
-  0x3a, 0x3d, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x70, 0x61, 0x67, 0x65, 0x69,
-  0x6e, 0x64, 0x65, 0x78, 0x28, 0x68, 0x65, 0x61, 0x70, 0x62, 0x61, 0x73,
-  0x65, 0x2c, 0x20, 0x70, 0x72, 0x65, 0x76, 0x70, 0x74, 0x72, 0x29, 0x0a,
-  0x0a, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x6e, 0x65,
-  0x78, 0x74, 0x70, 0x74, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x0a, 0x27, 0x27,
-  0x0a, 0x27, 0x27, 0x20, 0x75, 0x73, 0x65, 0x72, 0x20, 0x61, 0x63, 0x63,
-  0x65, 0x73, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x20, 0x67, 0x61, 0x72, 0x62,
-  0x61, 0x67, 0x65, 0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x69,
-  0x6f, 0x6e, 0x0a, 0x27, 0x27, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x67,
-  0x63, 0x5f, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x0a, 0x20, 0x20,
-  0x5f, 0x6c, 0x6f, 0x63, 0x6b, 0x6d, 0x65, 0x6d, 0x28, 0x40, 0x5f, 0x6d,
-  0x65, 0x6d, 0x6f, 0x72, 0x79, 0x5f, 0x6d, 0x75, 0x74, 0x65, 0x78, 0x29,
-  0x0a, 0x20, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x64, 0x6f, 0x63, 0x6f, 0x6c,
-  0x6c, 0x65, 0x63, 0x74, 0x0a, 0x20, 0x20, 0x5f, 0x75, 0x6e, 0x6c, 0x6f,
-  0x63, 0x6b, 0x6d, 0x65, 0x6d, 0x28, 0x40, 0x5f, 0x6d, 0x65, 0x6d, 0x6f,
-  0x72, 0x79, 0x5f, 0x6d, 0x75, 0x74, 0x65, 0x78, 0x29, 0x0a, 0x20, 0x20,
-  0x0a, 0x27, 0x27, 0x0a, 0x27, 0x27, 0x20, 0x61, 0x63, 0x74, 0x75, 0x61,
-  0x6c, 0x20, 0x67, 0x61, 0x72, 0x62, 0x61, 0x67, 0x65, 0x20, 0x63, 0x6f,
-  0x6c, 0x6c, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x6f, 0x75,
-  0x74, 0x69, 0x6e, 0x65, 0x0a, 0x27, 0x27, 0x0a, 0x70, 0x72, 0x69, 0x20,
-  0x5f, 0x67, 0x63, 0x5f, 0x64, 0x6f, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63,
-  0x74, 0x20, 0x7c, 0x20, 0x70, 0x74, 0x72, 0x2c, 0x20, 0x6e, 0x65, 0x78,
-  0x74, 0x70, 0x74, 0x72, 0x2c, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x68,
-  0x65, 0x61, 0x70, 0x2c, 0x20, 0x65, 0x6e, 0x64, 0x68, 0x65, 0x61, 0x70,
-  0x2c, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x2c, 0x20, 0x6f, 0x75, 0x72,
-  0x69, 0x64, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x0a, 0x0a, 0x20, 0x20,
-  0x28, 0x73, 0x74, 0x61, 0x72, 0x74, 0x68, 0x65, 0x61, 0x70, 0x2c, 0x20,
-  0x65, 0x6e, 0x64, 0x68, 0x65, 0x61, 0x70, 0x29, 0x20, 0x3a, 0x3d, 0x20,
-  0x5f, 0x67, 0x63, 0x5f, 0x70, 0x74, 0x72, 0x73, 0x0a, 0x0a, 0x20, 0x20,
-  0x27, 0x20, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x22, 0x49, 0x4e, 0x20, 0x55, 0x53, 0x45, 0x22, 0x20, 0x66, 0x6c, 0x61,
-  0x67, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x62,
-  0x6c, 0x6f, 0x63, 0x6b, 0x73, 0x0a, 0x20, 0x20, 0x70, 0x74, 0x72, 0x20,
-  0x3a, 0x3d, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x6e, 0x65, 0x78, 0x74, 0x42,
-  0x6c, 0x6f, 0x63, 0x6b, 0x50, 0x74, 0x72, 0x28, 0x73, 0x74, 0x61, 0x72,
-  0x74, 0x68, 0x65, 0x61, 0x70, 0x29, 0x0a, 0x20, 0x20, 0x6f, 0x75, 0x72,
-  0x69, 0x64, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x63, 0x6f, 0x67, 0x69, 0x64,
-  0x28, 0x29, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x20,
-  0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x70, 0x74, 0x72, 0x20, 0x61, 0x6e,
-  0x64, 0x20, 0x70, 0x74, 0x72, 0x20, 0x3c, 0x20, 0x65, 0x6e, 0x64, 0x68,
-  0x65, 0x61, 0x70, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x77, 0x6f, 0x72, 0x64,
-  0x5b, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x46,
-  0x4c, 0x41, 0x47, 0x53, 0x5d, 0x20, 0x26, 0x3d, 0x20, 0x21, 0x47, 0x43,
-  0x5f, 0x46, 0x4c, 0x41, 0x47, 0x5f, 0x49, 0x4e, 0x55, 0x53, 0x45, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x70, 0x74, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x5f,
-  0x67, 0x63, 0x5f, 0x6e, 0x65, 0x78, 0x74, 0x42, 0x6c, 0x6f, 0x63, 0x6b,
-  0x50, 0x74, 0x72, 0x28, 0x70, 0x74, 0x72, 0x29, 0x0a, 0x0a, 0x20, 0x20,
-  0x27, 0x20, 0x6e, 0x6f, 0x77, 0x20, 0x6d, 0x61, 0x72, 0x6b, 0x20, 0x70,
-  0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x20, 0x66, 0x6f, 0x75, 0x6e,
-  0x64, 0x20, 0x69, 0x6e, 0x20, 0x48, 0x55, 0x42, 0x20, 0x6d, 0x65, 0x6d,
-  0x6f, 0x72, 0x79, 0x0a, 0x20, 0x20, 0x27, 0x20, 0x74, 0x68, 0x69, 0x73,
-  0x20, 0x65, 0x6e, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x73, 0x73, 0x65, 0x73,
-  0x20, 0x6d, 0x6f, 0x72, 0x65, 0x20, 0x74, 0x68, 0x61, 0x6e, 0x20, 0x77,
-  0x65, 0x20, 0x6e, 0x65, 0x65, 0x64, 0x3b, 0x0a, 0x20, 0x20, 0x27, 0x20,
-  0x66, 0x69, 0x6e, 0x64, 0x20, 0x61, 0x20, 0x77, 0x61, 0x79, 0x20, 0x74,
-  0x6f, 0x20, 0x67, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6e,
-  0x64, 0x20, 0x6f, 0x66, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x61, 0x6e,
-  0x64, 0x0a, 0x20, 0x20, 0x27, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20,
-  0x6f, 0x66, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x3f, 0x3f, 0x0a, 0x20,
-  0x20, 0x5f, 0x67, 0x63, 0x5f, 0x6d, 0x61, 0x72, 0x6b, 0x68, 0x75, 0x62,
-  0x28, 0x30, 0x2c, 0x20, 0x5f, 0x5f, 0x74, 0x6f, 0x70, 0x6f, 0x66, 0x73,
-  0x74, 0x61, 0x63, 0x6b, 0x28, 0x30, 0x29, 0x29, 0x0a, 0x0a, 0x20, 0x20,
-  0x27, 0x20, 0x46, 0x49, 0x58, 0x4d, 0x45, 0x3a, 0x20, 0x69, 0x64, 0x65,
-  0x61, 0x6c, 0x6c, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x62, 0x6f,
-  0x76, 0x65, 0x20, 0x77, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x67, 0x65, 0x74,
-  0x20, 0x6a, 0x75, 0x73, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x61,
-  0x74, 0x61, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x61,
-  0x6e, 0x64, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x0a, 0x20, 0x20, 0x27,
-  0x20, 0x61, 0x6e, 0x64, 0x20, 0x77, 0x65, 0x20, 0x77, 0x6f, 0x75, 0x6c,
-  0x64, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x6d, 0x61, 0x72, 0x6b, 0x68, 0x75,
-  0x62, 0x28, 0x29, 0x20, 0x68, 0x65, 0x72, 0x65, 0x20, 0x66, 0x6f, 0x72,
-  0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x65, 0x61, 0x70, 0x0a, 0x0a, 0x20,
-  0x20, 0x27, 0x6e, 0x6f, 0x77, 0x20, 0x6d, 0x61, 0x72, 0x6b, 0x20, 0x65,
-  0x76, 0x65, 0x72, 0x79, 0x74, 0x68, 0x69, 0x6e, 0x67, 0x20, 0x66, 0x6f,
-  0x75, 0x6e, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x43, 0x4f, 0x47, 0x20, 0x6d,
-  0x65, 0x6d, 0x6f, 0x72, 0x79, 0x0a, 0x20, 0x20, 0x5f, 0x67, 0x63, 0x5f,
-  0x6d, 0x61, 0x72, 0x6b, 0x63, 0x6f, 0x67, 0x0a, 0x0a, 0x20, 0x20, 0x27,
-  0x20, 0x6e, 0x6f, 0x77, 0x20, 0x66, 0x72, 0x65, 0x65, 0x20, 0x61, 0x6c,
-  0x6c, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x20, 0x74,
-  0x68, 0x61, 0x74, 0x20, 0x61, 0x72, 0x65, 0x6e, 0x27, 0x74, 0x20, 0x69,
-  0x6e, 0x20, 0x75, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x27, 0x20, 0x6f, 0x72,
-  0x20, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x20, 0x28, 0x6f,
-  0x72, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x61, 0x6e, 0x6f, 0x74,
-  0x68, 0x65, 0x72, 0x20, 0x43, 0x4f, 0x47, 0x27, 0x73, 0x20, 0x63, 0x6f,
-  0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x29, 0x0a, 0x0a, 0x20, 0x20, 0x27, 0x20,
-  0x74, 0x68, 0x65, 0x72, 0x65, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x61,
-  0x6c, 0x77, 0x61, 0x79, 0x73, 0x20, 0x62, 0x65, 0x20, 0x61, 0x74, 0x20,
-  0x6c, 0x65, 0x61, 0x73, 0x74, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x62, 0x6c,
-  0x6f, 0x63, 0x6b, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x73, 0x74,
-  0x61, 0x72, 0x74, 0x68, 0x65, 0x61, 0x70, 0x2c, 0x0a, 0x20, 0x20, 0x27,
-  0x20, 0x73, 0x6f, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x70, 0x74, 0x72, 0x20,
-  0x77, 0x69, 0x6c, 0x6c, 0x20, 0x62, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x69,
-  0x64, 0x20, 0x61, 0x74, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x0a, 0x20,
-  0x20, 0x6e, 0x65, 0x78, 0x74, 0x70, 0x74, 0x72, 0x20, 0x3a, 0x3d, 0x20,
-  0x5f, 0x67, 0x63, 0x5f, 0x6e, 0x65, 0x78, 0x74, 0x42, 0x6c, 0x6f, 0x63,
-  0x6b, 0x50, 0x74, 0x72, 0x28, 0x73, 0x74, 0x61, 0x72, 0x74, 0x68, 0x65,
-  0x61, 0x70, 0x29, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6e, 0x65, 0x78,
-  0x74, 0x70, 0x74, 0x72, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x65, 0x72, 0x72, 0x6d, 0x73, 0x67,
-  0x28, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x22, 0x20, 0x21, 0x21,
-  0x21, 0x20, 0x63, 0x6f, 0x72, 0x72, 0x75, 0x70, 0x74, 0x65, 0x64, 0x20,
-  0x68, 0x65, 0x61, 0x70, 0x20, 0x21, 0x21, 0x21, 0x20, 0x22, 0x29, 0x29,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61,
-  0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x70, 0x74, 0x72, 0x20, 0x3a, 0x3d,
-  0x20, 0x6e, 0x65, 0x78, 0x74, 0x70, 0x74, 0x72, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x6e, 0x65, 0x78, 0x74, 0x70, 0x74, 0x72, 0x20, 0x3a, 0x3d, 0x20,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
+  0x6e, 0x65, 0x78, 0x74, 0x70, 0x74, 0x72, 0x20, 0x3c, 0x20, 0x68, 0x65,
+  0x61, 0x70, 0x65, 0x6e, 0x64, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x6e, 0x65, 0x78, 0x74,
+  0x70, 0x74, 0x72, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x50, 0x52,
+  0x45, 0x56, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x70,
+  0x61, 0x67, 0x65, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x28, 0x68, 0x65, 0x61,
+  0x70, 0x62, 0x61, 0x73, 0x65, 0x2c, 0x20, 0x70, 0x72, 0x65, 0x76, 0x70,
+  0x74, 0x72, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x6f,
+  0x72, 0x64, 0x5b, 0x70, 0x72, 0x65, 0x76, 0x70, 0x74, 0x72, 0x20, 0x2b,
+  0x20, 0x4f, 0x46, 0x46, 0x5f, 0x4c, 0x49, 0x4e, 0x4b, 0x5d, 0x20, 0x3a,
+  0x3d, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x70, 0x74, 0x72, 0x20, 0x2b,
+  0x20, 0x4f, 0x46, 0x46, 0x5f, 0x4c, 0x49, 0x4e, 0x4b, 0x5d, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x70, 0x74,
+  0x72, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x4c, 0x49, 0x4e, 0x4b,
+  0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x30, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x70, 0x74, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x70, 0x72, 0x65, 0x76,
+  0x70, 0x74, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0a, 0x20,
+  0x20, 0x27, 0x27, 0x20, 0x73, 0x65, 0x65, 0x20, 0x69, 0x66, 0x20, 0x77,
+  0x65, 0x20, 0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x6d, 0x65, 0x72,
+  0x67, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x66, 0x6f, 0x6c, 0x6c,
+  0x6f, 0x77, 0x69, 0x6e, 0x67, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x0a,
+  0x20, 0x20, 0x74, 0x6d, 0x70, 0x70, 0x74, 0x72, 0x20, 0x3a, 0x3d, 0x20,
   0x5f, 0x67, 0x63, 0x5f, 0x6e, 0x65, 0x78, 0x74, 0x42, 0x6c, 0x6f, 0x63,
   0x6b, 0x50, 0x74, 0x72, 0x28, 0x70, 0x74, 0x72, 0x29, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x3a, 0x3d, 0x20, 0x77,
+  0x69, 0x66, 0x20, 0x74, 0x6d, 0x70, 0x70, 0x74, 0x72, 0x20, 0x5f, 0x5f,
+  0x61, 0x6e, 0x64, 0x74, 0x68, 0x65, 0x6e, 0x5f, 0x5f, 0x20, 0x28, 0x74,
+  0x6d, 0x70, 0x70, 0x74, 0x72, 0x20, 0x3c, 0x20, 0x68, 0x65, 0x61, 0x70,
+  0x65, 0x6e, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x61, 0x6e, 0x64, 0x74, 0x68,
+  0x65, 0x6e, 0x5f, 0x5f, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x69, 0x73, 0x46,
+  0x72, 0x65, 0x65, 0x28, 0x74, 0x6d, 0x70, 0x70, 0x74, 0x72, 0x29, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 0x76, 0x70, 0x74, 0x72, 0x20,
+  0x3a, 0x3d, 0x20, 0x70, 0x74, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x70,
+  0x74, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x70, 0x74, 0x72,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x70, 0x72,
+  0x65, 0x76, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f,
+  0x53, 0x49, 0x5a, 0x45, 0x5d, 0x20, 0x2b, 0x3d, 0x20, 0x77, 0x6f, 0x72,
+  0x64, 0x5b, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f,
+  0x53, 0x49, 0x5a, 0x45, 0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x77, 0x6f,
+  0x72, 0x64, 0x5b, 0x70, 0x72, 0x65, 0x76, 0x70, 0x74, 0x72, 0x20, 0x2b,
+  0x20, 0x4f, 0x46, 0x46, 0x5f, 0x4c, 0x49, 0x4e, 0x4b, 0x5d, 0x20, 0x3a,
+  0x3d, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x70, 0x74, 0x72, 0x20, 0x2b,
+  0x20, 0x4f, 0x46, 0x46, 0x5f, 0x4c, 0x49, 0x4e, 0x4b, 0x5d, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x70, 0x74, 0x72, 0x20,
+  0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x46, 0x4c, 0x41, 0x47, 0x53, 0x5d,
+  0x20, 0x3a, 0x3d, 0x20, 0x24, 0x41, 0x41, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x77, 0x6f, 0x72, 0x64, 0x5b, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x20, 0x4f,
+  0x46, 0x46, 0x5f, 0x4c, 0x49, 0x4e, 0x4b, 0x5d, 0x20, 0x3a, 0x3d, 0x20,
+  0x30, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x70, 0x74,
+  0x72, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x6e, 0x65, 0x78,
+  0x74, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x50, 0x74, 0x72, 0x28, 0x70, 0x74,
+  0x72, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6e,
+  0x65, 0x78, 0x74, 0x70, 0x74, 0x72, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6e,
+  0x65, 0x78, 0x74, 0x70, 0x74, 0x72, 0x20, 0x3c, 0x20, 0x68, 0x65, 0x61,
+  0x70, 0x65, 0x6e, 0x64, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x77, 0x6f, 0x72, 0x64, 0x5b, 0x6e, 0x65, 0x78, 0x74, 0x70, 0x74, 0x72,
+  0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x50, 0x52, 0x45, 0x56, 0x5d,
+  0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x70, 0x61, 0x67, 0x65,
+  0x69, 0x6e, 0x64, 0x65, 0x78, 0x28, 0x68, 0x65, 0x61, 0x70, 0x62, 0x61,
+  0x73, 0x65, 0x2c, 0x20, 0x70, 0x72, 0x65, 0x76, 0x70, 0x74, 0x72, 0x29,
+  0x0a, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x6e,
+  0x65, 0x78, 0x74, 0x70, 0x74, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x0a, 0x27,
+  0x27, 0x0a, 0x27, 0x27, 0x20, 0x70, 0x75, 0x74, 0x20, 0x61, 0x6c, 0x6c,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x73, 0x20,
+  0x77, 0x61, 0x69, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x6f, 0x6e, 0x20, 0x73,
+  0x69, 0x7a, 0x65, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x20, 0x6c, 0x69,
+  0x73, 0x74, 0x73, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x20, 0x6f, 0x6e, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x66, 0x72, 0x65, 0x65, 0x20, 0x6c, 0x69, 0x73,
+  0x74, 0x2c, 0x0a, 0x27, 0x27, 0x20, 0x6d, 0x65, 0x72, 0x67, 0x69, 0x6e,
+  0x67, 0x20, 0x74, 0x68, 0x65, 0x6d, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+  0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x6e, 0x65, 0x69, 0x67, 0x68, 0x62,
+  0x6f, 0x75, 0x72, 0x73, 0x0a, 0x27, 0x27, 0x0a, 0x70, 0x72, 0x69, 0x20,
+  0x5f, 0x67, 0x63, 0x5f, 0x66, 0x6c, 0x75, 0x73, 0x68, 0x63, 0x6c, 0x61,
+  0x73, 0x73, 0x65, 0x73, 0x28, 0x68, 0x65, 0x61, 0x70, 0x62, 0x61, 0x73,
+  0x65, 0x29, 0x20, 0x7c, 0x20, 0x68, 0x65, 0x61, 0x64, 0x2c, 0x20, 0x70,
+  0x74, 0x72, 0x0a, 0x20, 0x20, 0x68, 0x65, 0x61, 0x64, 0x20, 0x3a, 0x3d,
+  0x20, 0x68, 0x65, 0x61, 0x70, 0x62, 0x61, 0x73, 0x65, 0x20, 0x2b, 0x20,
+  0x4f, 0x46, 0x46, 0x5f, 0x43, 0x4c, 0x41, 0x53, 0x53, 0x0a, 0x20, 0x20,
+  0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x20, 0x47, 0x43, 0x5f, 0x4e, 0x55,
+  0x4d, 0x5f, 0x43, 0x4c, 0x41, 0x53, 0x53, 0x45, 0x53, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x20, 0x77, 0x68, 0x69,
+  0x6c, 0x65, 0x20, 0x28, 0x70, 0x74, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x5f,
+  0x67, 0x63, 0x5f, 0x70, 0x61, 0x67, 0x65, 0x70, 0x74, 0x72, 0x28, 0x68,
+  0x65, 0x61, 0x70, 0x62, 0x61, 0x73, 0x65, 0x2c, 0x20, 0x77, 0x6f, 0x72,
+  0x64, 0x5b, 0x68, 0x65, 0x61, 0x64, 0x5d, 0x29, 0x29, 0x20, 0x3c, 0x3e,
+  0x20, 0x30, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x6f, 0x72,
+  0x64, 0x5b, 0x68, 0x65, 0x61, 0x64, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x77,
   0x6f, 0x72, 0x64, 0x5b, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x20, 0x4f, 0x46,
-  0x46, 0x5f, 0x46, 0x4c, 0x41, 0x47, 0x53, 0x5d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x69, 0x66, 0x20, 0x28, 0x20, 0x28, 0x6e, 0x6f, 0x74, 0x20, 0x28,
-  0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x26, 0x20, 0x47, 0x43, 0x5f, 0x46,
-  0x4c, 0x41, 0x47, 0x5f, 0x49, 0x4e, 0x55, 0x53, 0x45, 0x29, 0x29, 0x20,
-  0x61, 0x6e, 0x64, 0x20, 0x28, 0x6e, 0x6f, 0x74, 0x20, 0x28, 0x66, 0x6c,
-  0x61, 0x67, 0x73, 0x20, 0x26, 0x20, 0x47, 0x43, 0x5f, 0x46, 0x4c, 0x41,
-  0x47, 0x5f, 0x52, 0x45, 0x53, 0x45, 0x52, 0x56, 0x45, 0x44, 0x29, 0x29,
-  0x20, 0x29, 0x0a, 0x09, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x26,
-  0x3d, 0x20, 0x47, 0x43, 0x5f, 0x4f, 0x57, 0x4e, 0x45, 0x52, 0x5f, 0x4d,
-  0x41, 0x53, 0x4b, 0x0a, 0x09, 0x20, 0x69, 0x66, 0x20, 0x28, 0x66, 0x6c,
-  0x61, 0x67, 0x73, 0x20, 0x3d, 0x3d, 0x20, 0x6f, 0x75, 0x72, 0x69, 0x64,
-  0x29, 0x20, 0x6f, 0x72, 0x20, 0x28, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20,
-  0x3d, 0x3d, 0x20, 0x47, 0x43, 0x5f, 0x4f, 0x57, 0x4e, 0x45, 0x52, 0x5f,
-  0x48, 0x55, 0x42, 0x29, 0x0a, 0x09, 0x20, 0x20, 0x20, 0x6e, 0x65, 0x78,
+  0x46, 0x5f, 0x4c, 0x49, 0x4e, 0x4b, 0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x64, 0x6f, 0x66, 0x72, 0x65, 0x65,
+  0x28, 0x70, 0x74, 0x72, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65,
+  0x61, 0x64, 0x20, 0x2b, 0x3d, 0x20, 0x32, 0x0a, 0x0a, 0x27, 0x27, 0x0a,
+  0x27, 0x27, 0x20, 0x6d, 0x61, 0x72, 0x6b, 0x20, 0x70, 0x6f, 0x69, 0x6e,
+  0x74, 0x65, 0x72, 0x73, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x69,
+  0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61,
+  0x74, 0x65, 0x64, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x73, 0x20, 0x6f,
+  0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x65, 0x61, 0x70, 0x0a, 0x27,
+  0x27, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x6d, 0x61,
+  0x72, 0x6b, 0x68, 0x65, 0x61, 0x70, 0x28, 0x73, 0x74, 0x61, 0x72, 0x74,
+  0x68, 0x65, 0x61, 0x70, 0x2c, 0x20, 0x65, 0x6e, 0x64, 0x68, 0x65, 0x61,
+  0x70, 0x29, 0x20, 0x7c, 0x20, 0x70, 0x74, 0x72, 0x2c, 0x20, 0x6e, 0x65,
+  0x78, 0x74, 0x70, 0x74, 0x72, 0x0a, 0x20, 0x20, 0x70, 0x74, 0x72, 0x20,
+  0x3a, 0x3d, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x6e, 0x65, 0x78, 0x74, 0x42,
+  0x6c, 0x6f, 0x63, 0x6b, 0x50, 0x74, 0x72, 0x28, 0x73, 0x74, 0x61, 0x72,
+  0x74, 0x68, 0x65, 0x61, 0x70, 0x29, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x70,
+  0x65, 0x61, 0x74, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x70, 0x74,
+  0x72, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x70, 0x74, 0x72, 0x20, 0x3c, 0x20,
+  0x65, 0x6e, 0x64, 0x68, 0x65, 0x61, 0x70, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x6e, 0x65, 0x78, 0x74, 0x70, 0x74, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x5f,
+  0x67, 0x63, 0x5f, 0x6e, 0x65, 0x78, 0x74, 0x42, 0x6c, 0x6f, 0x63, 0x6b,
+  0x50, 0x74, 0x72, 0x28, 0x70, 0x74, 0x72, 0x29, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x69, 0x66, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x5f, 0x67, 0x63, 0x5f,
+  0x69, 0x73, 0x46, 0x72, 0x65, 0x65, 0x28, 0x70, 0x74, 0x72, 0x29, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x6d, 0x61,
+  0x72, 0x6b, 0x68, 0x75, 0x62, 0x28, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x20,
+  0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x69, 0x7a, 0x65, 0x2c, 0x20,
+  0x6e, 0x65, 0x78, 0x74, 0x70, 0x74, 0x72, 0x29, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x70, 0x74, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x6e, 0x65, 0x78, 0x74,
+  0x70, 0x74, 0x72, 0x0a, 0x0a, 0x27, 0x27, 0x0a, 0x27, 0x27, 0x20, 0x75,
+  0x73, 0x65, 0x72, 0x20, 0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x69, 0x62,
+  0x6c, 0x65, 0x20, 0x67, 0x61, 0x72, 0x62, 0x61, 0x67, 0x65, 0x20, 0x63,
+  0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x27, 0x27,
+  0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x63, 0x6f, 0x6c,
+  0x6c, 0x65, 0x63, 0x74, 0x0a, 0x20, 0x20, 0x5f, 0x6c, 0x6f, 0x63, 0x6b,
+  0x6d, 0x65, 0x6d, 0x28, 0x40, 0x5f, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79,
+  0x5f, 0x6d, 0x75, 0x74, 0x65, 0x78, 0x29, 0x0a, 0x20, 0x20, 0x5f, 0x67,
+  0x63, 0x5f, 0x64, 0x6f, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x0a,
+  0x20, 0x20, 0x5f, 0x75, 0x6e, 0x6c, 0x6f, 0x63, 0x6b, 0x6d, 0x65, 0x6d,
+  0x28, 0x40, 0x5f, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x5f, 0x6d, 0x75,
+  0x74, 0x65, 0x78, 0x29, 0x0a, 0x0a, 0x27, 0x27, 0x0a, 0x27, 0x27, 0x20,
+  0x75, 0x73, 0x65, 0x72, 0x20, 0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x69,
+  0x62, 0x6c, 0x65, 0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x6f,
+  0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x73, 0x74, 0x69, 0x63, 0x73,
+  0x0a, 0x27, 0x27, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x67, 0x63, 0x5f,
+  0x73, 0x74, 0x61, 0x74, 0x73, 0x28, 0x6e, 0x29, 0x20, 0x7c, 0x20, 0x68,
+  0x65, 0x61, 0x70, 0x62, 0x61, 0x73, 0x65, 0x2c, 0x20, 0x68, 0x65, 0x61,
+  0x70, 0x65, 0x6e, 0x64, 0x0a, 0x20, 0x20, 0x28, 0x68, 0x65, 0x61, 0x70,
+  0x62, 0x61, 0x73, 0x65, 0x2c, 0x20, 0x68, 0x65, 0x61, 0x70, 0x65, 0x6e,
+  0x64, 0x29, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x70, 0x74,
+  0x72, 0x73, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6e, 0x20, 0x3d, 0x3e,
+  0x20, 0x30, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6e, 0x20, 0x3c, 0x20, 0x47,
+  0x43, 0x5f, 0x4e, 0x55, 0x4d, 0x5f, 0x53, 0x54, 0x41, 0x54, 0x53, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x6c,
+  0x6f, 0x6e, 0x67, 0x5b, 0x68, 0x65, 0x61, 0x70, 0x62, 0x61, 0x73, 0x65,
+  0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x53, 0x54, 0x41, 0x54, 0x53,
+  0x5d, 0x5b, 0x6e, 0x5d, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+  0x6e, 0x20, 0x30, 0x0a, 0x20, 0x20, 0x0a, 0x27, 0x27, 0x0a, 0x27, 0x27,
+  0x20, 0x61, 0x63, 0x74, 0x75, 0x61, 0x6c, 0x20, 0x67, 0x61, 0x72, 0x62,
+  0x61, 0x67, 0x65, 0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x69,
+  0x6f, 0x6e, 0x20, 0x72, 0x6f, 0x75, 0x74, 0x69, 0x6e, 0x65, 0x0a, 0x27,
+  0x27, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x64, 0x6f,
+  0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x7c, 0x20, 0x70, 0x74,
+  0x72, 0x2c, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x70, 0x74, 0x72, 0x2c, 0x20,
+  0x73, 0x74, 0x61, 0x72, 0x74, 0x68, 0x65, 0x61, 0x70, 0x2c, 0x20, 0x65,
+  0x6e, 0x64, 0x68, 0x65, 0x61, 0x70, 0x2c, 0x20, 0x66, 0x6c, 0x61, 0x67,
+  0x73, 0x2c, 0x20, 0x6f, 0x75, 0x72, 0x69, 0x64, 0x2c, 0x20, 0x73, 0x69,
+  0x7a, 0x65, 0x2c, 0x20, 0x74, 0x6f, 0x70, 0x73, 0x74, 0x61, 0x63, 0x6b,
+  0x2c, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x74, 0x69, 0x6d, 0x65, 0x0a,
+  0x0a, 0x20, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x74, 0x69, 0x6d, 0x65,
+  0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x67, 0x65, 0x74, 0x63, 0x6e, 0x74, 0x28,
+  0x29, 0x0a, 0x20, 0x20, 0x28, 0x73, 0x74, 0x61, 0x72, 0x74, 0x68, 0x65,
+  0x61, 0x70, 0x2c, 0x20, 0x65, 0x6e, 0x64, 0x68, 0x65, 0x61, 0x70, 0x29,
+  0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x70, 0x74, 0x72, 0x73,
+  0x0a, 0x0a, 0x20, 0x20, 0x27, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x73,
+  0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x69, 0x7a, 0x65,
+  0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x73,
+  0x20, 0x61, 0x72, 0x65, 0x20, 0x66, 0x72, 0x65, 0x65, 0x20, 0x74, 0x6f,
+  0x6f, 0x0a, 0x20, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x66, 0x6c, 0x75, 0x73,
+  0x68, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x65, 0x73, 0x28, 0x73, 0x74, 0x61,
+  0x72, 0x74, 0x68, 0x65, 0x61, 0x70, 0x29, 0x0a, 0x0a, 0x20, 0x20, 0x27,
+  0x20, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x22,
+  0x49, 0x4e, 0x20, 0x55, 0x53, 0x45, 0x22, 0x20, 0x66, 0x6c, 0x61, 0x67,
+  0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x62, 0x6c,
+  0x6f, 0x63, 0x6b, 0x73, 0x0a, 0x20, 0x20, 0x70, 0x74, 0x72, 0x20, 0x3a,
+  0x3d, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x6e, 0x65, 0x78, 0x74, 0x42, 0x6c,
+  0x6f, 0x63, 0x6b, 0x50, 0x74, 0x72, 0x28, 0x73, 0x74, 0x61, 0x72, 0x74,
+  0x68, 0x65, 0x61, 0x70, 0x29, 0x0a, 0x20, 0x20, 0x6f, 0x75, 0x72, 0x69,
+  0x64, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x63, 0x6f, 0x67, 0x69, 0x64, 0x28,
+  0x29, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x20, 0x77,
+  0x68, 0x69, 0x6c, 0x65, 0x20, 0x70, 0x74, 0x72, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x70, 0x74, 0x72, 0x20, 0x3c, 0x20, 0x65, 0x6e, 0x64, 0x68, 0x65,
+  0x61, 0x70, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b,
+  0x70, 0x74, 0x72, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x46, 0x4c,
+  0x41, 0x47, 0x53, 0x5d, 0x20, 0x26, 0x3d, 0x20, 0x21, 0x47, 0x43, 0x5f,
+  0x46, 0x4c, 0x41, 0x47, 0x5f, 0x49, 0x4e, 0x55, 0x53, 0x45, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x70, 0x74, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x67,
+  0x63, 0x5f, 0x6e, 0x65, 0x78, 0x74, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x50,
+  0x74, 0x72, 0x28, 0x70, 0x74, 0x72, 0x29, 0x0a, 0x0a, 0x20, 0x20, 0x27,
+  0x20, 0x6e, 0x6f, 0x77, 0x20, 0x6d, 0x61, 0x72, 0x6b, 0x20, 0x70, 0x6f,
+  0x69, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64,
+  0x20, 0x69, 0x6e, 0x20, 0x48, 0x55, 0x42, 0x20, 0x6d, 0x65, 0x6d, 0x6f,
+  0x72, 0x79, 0x0a, 0x20, 0x20, 0x27, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20,
+  0x65, 0x6e, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x73, 0x73, 0x65, 0x73, 0x20,
+  0x6d, 0x6f, 0x72, 0x65, 0x20, 0x74, 0x68, 0x61, 0x6e, 0x20, 0x77, 0x65,
+  0x20, 0x6e, 0x65, 0x65, 0x64, 0x3b, 0x0a, 0x20, 0x20, 0x27, 0x20, 0x66,
+  0x69, 0x6e, 0x64, 0x20, 0x61, 0x20, 0x77, 0x61, 0x79, 0x20, 0x74, 0x6f,
+  0x20, 0x67, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6e, 0x64,
+  0x20, 0x6f, 0x66, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x61, 0x6e, 0x64,
+  0x0a, 0x20, 0x20, 0x27, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x6f,
+  0x66, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x3f, 0x3f, 0x0a, 0x20, 0x20,
+  0x27, 0x20, 0x66, 0x72, 0x65, 0x65, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b,
+  0x73, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x65, 0x61,
+  0x70, 0x20, 0x63, 0x61, 0x6e, 0x6e, 0x6f, 0x74, 0x20, 0x68, 0x6f, 0x6c,
+  0x64, 0x20, 0x6c, 0x69, 0x76, 0x65, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74,
+  0x65, 0x72, 0x73, 0x2c, 0x20, 0x73, 0x6f, 0x20, 0x77, 0x68, 0x65, 0x6e,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x65, 0x61, 0x70, 0x0a, 0x20, 0x20,
+  0x27, 0x20, 0x6c, 0x69, 0x65, 0x73, 0x20, 0x69, 0x6e, 0x73, 0x69, 0x64,
+  0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x63, 0x61, 0x6e, 0x6e, 0x65,
+  0x64, 0x20, 0x61, 0x72, 0x65, 0x61, 0x20, 0x77, 0x65, 0x20, 0x6f, 0x6e,
+  0x6c, 0x79, 0x20, 0x73, 0x63, 0x61, 0x6e, 0x20, 0x69, 0x74, 0x73, 0x20,
+  0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x64, 0x20, 0x62, 0x6c,
+  0x6f, 0x63, 0x6b, 0x73, 0x0a, 0x20, 0x20, 0x74, 0x6f, 0x70, 0x73, 0x74,
+  0x61, 0x63, 0x6b, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x5f, 0x74, 0x6f, 0x70,
+  0x6f, 0x66, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x28, 0x30, 0x29, 0x0a, 0x20,
+  0x20, 0x69, 0x66, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x68, 0x65, 0x61,
+  0x70, 0x20, 0x3c, 0x20, 0x65, 0x6e, 0x64, 0x68, 0x65, 0x61, 0x70, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x65, 0x6e, 0x64, 0x68, 0x65, 0x61, 0x70, 0x20,
+  0x3d, 0x3c, 0x20, 0x74, 0x6f, 0x70, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x6d, 0x61, 0x72, 0x6b,
+  0x68, 0x75, 0x62, 0x28, 0x30, 0x2c, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74,
+  0x68, 0x65, 0x61, 0x70, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x67,
+  0x63, 0x5f, 0x6d, 0x61, 0x72, 0x6b, 0x68, 0x65, 0x61, 0x70, 0x28, 0x73,
+  0x74, 0x61, 0x72, 0x74, 0x68, 0x65, 0x61, 0x70, 0x2c, 0x20, 0x65, 0x6e,
+  0x64, 0x68, 0x65, 0x61, 0x70, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x5f,
+  0x67, 0x63, 0x5f, 0x6d, 0x61, 0x72, 0x6b, 0x68, 0x75, 0x62, 0x28, 0x65,
+  0x6e, 0x64, 0x68, 0x65, 0x61, 0x70, 0x2c, 0x20, 0x74, 0x6f, 0x70, 0x73,
+  0x74, 0x61, 0x63, 0x6b, 0x29, 0x0a, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x6d, 0x61, 0x72,
+  0x6b, 0x68, 0x75, 0x62, 0x28, 0x30, 0x2c, 0x20, 0x74, 0x6f, 0x70, 0x73,
+  0x74, 0x61, 0x63, 0x6b, 0x29, 0x0a, 0x0a, 0x20, 0x20, 0x27, 0x6e, 0x6f,
+  0x77, 0x20, 0x6d, 0x61, 0x72, 0x6b, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79,
+  0x74, 0x68, 0x69, 0x6e, 0x67, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x20,
+  0x69, 0x6e, 0x20, 0x43, 0x4f, 0x47, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72,
+  0x79, 0x0a, 0x20, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x6d, 0x61, 0x72, 0x6b,
+  0x63, 0x6f, 0x67, 0x0a, 0x0a, 0x20, 0x20, 0x27, 0x20, 0x6e, 0x6f, 0x77,
+  0x20, 0x66, 0x72, 0x65, 0x65, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x70, 0x6f,
+  0x69, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+  0x61, 0x72, 0x65, 0x6e, 0x27, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x75, 0x73,
+  0x65, 0x0a, 0x20, 0x20, 0x27, 0x20, 0x6f, 0x72, 0x20, 0x72, 0x65, 0x73,
+  0x65, 0x72, 0x76, 0x65, 0x64, 0x20, 0x28, 0x6f, 0x72, 0x20, 0x75, 0x6e,
+  0x64, 0x65, 0x72, 0x20, 0x61, 0x6e, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20,
+  0x43, 0x4f, 0x47, 0x27, 0x73, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f,
+  0x6c, 0x29, 0x0a, 0x0a, 0x20, 0x20, 0x27, 0x20, 0x74, 0x68, 0x65, 0x72,
+  0x65, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x61, 0x6c, 0x77, 0x61, 0x79,
+  0x73, 0x20, 0x62, 0x65, 0x20, 0x61, 0x74, 0x20, 0x6c, 0x65, 0x61, 0x73,
+  0x74, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x20,
+  0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x68,
+  0x65, 0x61, 0x70, 0x2c, 0x0a, 0x20, 0x20, 0x27, 0x20, 0x73, 0x6f, 0x20,
+  0x6e, 0x65, 0x78, 0x74, 0x70, 0x74, 0x72, 0x20, 0x77, 0x69, 0x6c, 0x6c,
+  0x20, 0x62, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x61, 0x74,
+  0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x0a, 0x20, 0x20, 0x6e, 0x65, 0x78,
+  0x74, 0x70, 0x74, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x67, 0x63, 0x5f,
+  0x6e, 0x65, 0x78, 0x74, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x50, 0x74, 0x72,
+  0x28, 0x73, 0x74, 0x61, 0x72, 0x74, 0x68, 0x65, 0x61, 0x70, 0x29, 0x0a,
+  0x20, 0x20, 0x69, 0x66, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x70, 0x74, 0x72,
+  0x20, 0x3d, 0x3d, 0x20, 0x30, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x67,
+  0x63, 0x5f, 0x65, 0x72, 0x72, 0x6d, 0x73, 0x67, 0x28, 0x73, 0x74, 0x72,
+  0x69, 0x6e, 0x67, 0x28, 0x22, 0x20, 0x21, 0x21, 0x21, 0x20, 0x63, 0x6f,
+  0x72, 0x72, 0x75, 0x70, 0x74, 0x65, 0x64, 0x20, 0x68, 0x65, 0x61, 0x70,
+  0x20, 0x21, 0x21, 0x21, 0x20, 0x22, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x0a, 0x20, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x70, 0x74, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x6e, 0x65, 0x78,
+  0x74, 0x70, 0x74, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x65, 0x78,
   0x74, 0x70, 0x74, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x67, 0x63, 0x5f,
-  0x64, 0x6f, 0x66, 0x72, 0x65, 0x65, 0x28, 0x70, 0x74, 0x72, 0x29, 0x20,
-  0x20, 0x27, 0x20, 0x64, 0x6f, 0x66, 0x72, 0x65, 0x65, 0x20, 0x72, 0x65,
-  0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73,
-  0x73, 0x20, 0x6f, 0x66, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x20, 0x62, 0x6c,
-  0x6f, 0x63, 0x6b, 0x0a, 0x09, 0x20, 0x20, 0x20, 0x0a, 0x20, 0x20, 0x77,
-  0x68, 0x69, 0x6c, 0x65, 0x20, 0x28, 0x6e, 0x65, 0x78, 0x74, 0x70, 0x74,
-  0x72, 0x20, 0x3c, 0x3e, 0x20, 0x30, 0x29, 0x20, 0x61, 0x6e, 0x64, 0x20,
-  0x28, 0x6e, 0x65, 0x78, 0x74, 0x70, 0x74, 0x72, 0x20, 0x3c, 0x20, 0x65,
-  0x6e, 0x64, 0x68, 0x65, 0x61, 0x70, 0x29, 0x0a, 0x20, 0x20, 0x0a, 0x00
+  0x6e, 0x65, 0x78, 0x74, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x50, 0x74, 0x72,
+  0x28, 0x70, 0x74, 0x72, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c,
+  0x61, 0x67, 0x73, 0x20, 0x3a, 0x3d, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b,
+  0x70, 0x74, 0x72, 0x20, 0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x46, 0x4c,
+  0x41, 0x47, 0x53, 0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
+  0x28, 0x20, 0x28, 0x6e, 0x6f, 0x74, 0x20, 0x28, 0x66, 0x6c, 0x61, 0x67,
+  0x73, 0x20, 0x26, 0x20, 0x47, 0x43, 0x5f, 0x46, 0x4c, 0x41, 0x47, 0x5f,
+  0x49, 0x4e, 0x55, 0x53, 0x45, 0x29, 0x29, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x28, 0x6e, 0x6f, 0x74, 0x20, 0x28, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20,
+  0x26, 0x20, 0x47, 0x43, 0x5f, 0x46, 0x4c, 0x41, 0x47, 0x5f, 0x52, 0x45,
+  0x53, 0x45, 0x52, 0x56, 0x45, 0x44, 0x29, 0x29, 0x20, 0x29, 0x0a, 0x09,
+  0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x26, 0x3d, 0x20, 0x47, 0x43,
+  0x5f, 0x4f, 0x57, 0x4e, 0x45, 0x52, 0x5f, 0x4d, 0x41, 0x53, 0x4b, 0x0a,
+  0x09, 0x20, 0x69, 0x66, 0x20, 0x28, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20,
+  0x3d, 0x3d, 0x20, 0x6f, 0x75, 0x72, 0x69, 0x64, 0x29, 0x20, 0x6f, 0x72,
+  0x20, 0x28, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x3d, 0x3d, 0x20, 0x47,
+  0x43, 0x5f, 0x4f, 0x57, 0x4e, 0x45, 0x52, 0x5f, 0x48, 0x55, 0x42, 0x29,
+  0x0a, 0x09, 0x20, 0x20, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x70, 0x74, 0x72,
+  0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x64, 0x6f, 0x66, 0x72,
+  0x65, 0x65, 0x28, 0x70, 0x74, 0x72, 0x29, 0x20, 0x20, 0x27, 0x20, 0x64,
+  0x6f, 0x66, 0x72, 0x65, 0x65, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
+  0x73, 0x20, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x20, 0x6f, 0x66,
+  0x20, 0x6e, 0x65, 0x78, 0x74, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x0a,
+  0x09, 0x20, 0x20, 0x20, 0x0a, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65,
+  0x20, 0x28, 0x6e, 0x65, 0x78, 0x74, 0x70, 0x74, 0x72, 0x20, 0x3c, 0x3e,
+  0x20, 0x30, 0x29, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x28, 0x6e, 0x65, 0x78,
+  0x74, 0x70, 0x74, 0x72, 0x20, 0x3c, 0x20, 0x65, 0x6e, 0x64, 0x68, 0x65,
+  0x61, 0x70, 0x29, 0x0a, 0x0a, 0x20, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x5b,
+  0x73, 0x74, 0x61, 0x72, 0x74, 0x68, 0x65, 0x61, 0x70, 0x20, 0x2b, 0x20,
+  0x4f, 0x46, 0x46, 0x5f, 0x53, 0x54, 0x41, 0x54, 0x53, 0x5d, 0x5b, 0x47,
+  0x43, 0x5f, 0x53, 0x54, 0x41, 0x54, 0x5f, 0x43, 0x4f, 0x4c, 0x4c, 0x45,
+  0x43, 0x54, 0x53, 0x5d, 0x2b, 0x2b, 0x0a, 0x20, 0x20, 0x6c, 0x6f, 0x6e,
+  0x67, 0x5b, 0x73, 0x74, 0x61, 0x72, 0x74, 0x68, 0x65, 0x61, 0x70, 0x20,
+  0x2b, 0x20, 0x4f, 0x46, 0x46, 0x5f, 0x53, 0x54, 0x41, 0x54, 0x53, 0x5d,
+  0x5b, 0x47, 0x43, 0x5f, 0x53, 0x54, 0x41, 0x54, 0x5f, 0x43, 0x4f, 0x4c,
+  0x4c, 0x45, 0x43, 0x54, 0x5f, 0x43, 0x59, 0x43, 0x4c, 0x45, 0x53, 0x5d,
+  0x20, 0x2b, 0x3d, 0x20, 0x5f, 0x67, 0x65, 0x74, 0x63, 0x6e, 0x74, 0x28,
+  0x29, 0x20, 0x2d, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x74, 0x69, 0x6d,
+  0x65, 0x0a, 0x20, 0x20, 0x0a, 0x00
 };
-unsigned int sys_gcalloc_spin_len = 11855;
+unsigned int sys_gcalloc_spin_len = 15425;
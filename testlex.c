@@ -10,6 +10,7 @@
 #include <stdarg.h>
 #include "spinc.h"
 #include "frontends/lexer.h"
+#include "preprocess.h"
 #include "spin.tab.h"
 
 #ifndef LANG_DEFAULT
@@ -22,7 +23,7 @@ typedef int Token;
 Module *current;
 Module *allparse;
 Module *systemModule;
-Function *curfunc;
+THREAD_LOCAL Function *curfunc;
 SymbolTable *currentTypes;
 
 AST *ast_type_long, *ast_type_word, *ast_type_byte, *ast_type_float;
@@ -220,6 +221,11 @@ WARNING(AST *instr, const char *msg, ...)
     fprintf(stderr, "\n");
 }
 
+void
+DEBUG(AST *instr, const char *msg, ...)
+{
+}
+
 void
 ERROR_UNKNOWN_SYMBOL(AST *ast)
 {
@@ -318,6 +324,74 @@ static int tokens11[] =
   SP_EOF
 };
 
+//
+// run len bytes of src through the preprocessor pp
+//
+static char *
+runPreprocessor(struct preprocess *pp, const char *src, size_t len)
+{
+    FILE *f = tmpfile();
+    char *result;
+
+    fwrite(src, 1, len, f);
+    rewind(f);
+    pp_push_file_struct(pp, f, NULL);
+    pp_run(pp);
+    result = pp_finish(pp);
+    fclose(f);
+    return result;
+}
+
+static void
+checkPreprocessor(struct preprocess *pp, const char *src, size_t len, const char *expect)
+{
+    char *result = runPreprocessor(pp, src, len);
+
+    if (strcmp(result, expect) != 0) {
+        fprintf(stderr, "preprocessor test failed: expected [%s] got [%s]\n", expect, result);
+        abort();
+    }
+    free(result);
+}
+
+static void
+testPreprocess(const char *src, size_t len, const char *expect)
+{
+    struct preprocess pp;
+
+    pp_init(&pp);
+    pp_setcomments(&pp, "//", "/*", "*/");
+    checkPreprocessor(&pp, src, len, expect);
+}
+
+// definitions made after pp_get_define_state must be gone after
+// pp_restore_define_state, and the older ones they shadowed visible again
+static void
+testDefineState(void)
+{
+    struct preprocess pp;
+    void *state;
+    char name[16];
+    int i;
+
+    pp_init(&pp);
+    pp_setcomments(&pp, "//", "/*", "*/");
+    pp_define(&pp, "X", "1");
+    state = pp_get_define_state(&pp);
+    pp_define(&pp, "X", "2");
+    pp_define(&pp, "Y", "3");
+    // enough to make the hash table grow
+    for (i = 0; i < 1000; i++) {
+        sprintf(name, "N%d", i);
+        pp_define(&pp, strdup(name), "4");
+    }
+    checkPreprocessor(&pp, "X Y N0 N999\n", 12, "2 3 4 4\n");
+    pp_restore_define_state(&pp, state);
+    checkPreprocessor(&pp, "X Y N0 N999\n", 12, "1 Y N0 N999\n");
+    pp_define(&pp, "N0", "5");
+    checkPreprocessor(&pp, "X Y N0 N999\n", 12, "1 Y 5 N999\n");
+}
+
 int
 main()
 {
@@ -365,6 +439,15 @@ main()
 
     testIdentifier("x99+8", "X99");
     testIdentifier("_a_b", "_A_b");
+
+    // only EF BB BF is a byte order mark
+    testPreprocess("\xef\xbb\xbfx\n", 5, "x\n");
+    testPreprocess("\xef\xbcx\n", 4, "\xef\xbcx\n");
+    // Latin-1 is converted from the first byte on
+    testPreprocess("\xa9 caf\xe9\n", 7, "\xc2\xa9 caf\xc3\xa9\n");
+    // UTF-16LE, with CR LF and lone CR line endings
+    testPreprocess("\xff\xfe" "a\0\r\0\n\0\xe9\0\r\0b\0", 14, "a\n\xc3\xa9\nb");
+    testDefineState();
     printf("all tests passed\n");
     return 0;
 }
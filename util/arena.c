@@ -0,0 +1,103 @@
+/*
+ * Bump pointer allocation of many small objects which are all
+ * released together.
+ *
+ * Copyright 2022 Total Spectrum Software Inc.
+ * See the file COPYING for terms of use
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "arena.h"
+#include "timereport.h"
+
+#define ARENA_BLOCKSIZE (256*1024)
+#define ARENA_ALIGN sizeof(void *)
+
+struct arena_block {
+    struct arena_block *next;
+    size_t size;
+};
+
+#define ARENA_HDRSIZE ((sizeof(struct arena_block) + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1))
+
+/* get a block of "size" bytes (including the header) from malloc */
+static struct arena_block *
+arena_newblock(struct arena *A, size_t size)
+{
+    struct arena_block *blk;
+
+    blk = (struct arena_block *)malloc(size);
+    if (!blk) {
+        fprintf(stderr, "FATAL ERROR: out of memory\n");
+        abort();
+    }
+    blk->size = size;
+    A->reserved += size;
+    return blk;
+}
+
+/* start a new block with room for at least N bytes */
+static void
+arena_grow(struct arena *A, size_t N)
+{
+    struct arena_block *blk;
+    size_t size = ARENA_HDRSIZE + N;
+
+    if (size < ARENA_BLOCKSIZE) {
+        size = ARENA_BLOCKSIZE;
+    }
+    blk = arena_newblock(A, size);
+    blk->next = A->blocks;
+    A->blocks = blk;
+    A->ptr = (char *)blk + ARENA_HDRSIZE;
+    A->end = (char *)blk + size;
+}
+
+void *
+arena_alloc(struct arena *A, size_t N)
+{
+    struct arena_block *blk;
+    void *r;
+
+    N = (N + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1);
+    if (N >= ARENA_BLOCKSIZE/4 && A->blocks) {
+        // big requests (like whole source files) get a block of just
+        // the right size behind the current one, so the rest of the
+        // current block is not wasted
+        blk = arena_newblock(A, ARENA_HDRSIZE + N);
+        blk->next = A->blocks->next;
+        A->blocks->next = blk;
+        r = (char *)blk + ARENA_HDRSIZE;
+    } else {
+        if (N > (size_t)(A->end - A->ptr)) {
+            arena_grow(A, N);
+        }
+        r = A->ptr;
+        A->ptr += N;
+    }
+    A->used += N;
+    timereport_alloc(N);
+    return r;
+}
+
+void *
+arena_memdup(struct arena *A, const void *buf, size_t N)
+{
+    void *r = arena_alloc(A, N);
+    memcpy(r, buf, N);
+    return r;
+}
+
+void
+arena_free(struct arena *A)
+{
+    struct arena_block *blk, *next;
+
+    for (blk = A->blocks; blk; blk = next) {
+        next = blk->next;
+        free(blk);
+    }
+    memset(A, 0, sizeof(*A));
+}
@@ -0,0 +1,34 @@
+/*
+ * Bump pointer allocation of many small objects which are all
+ * released together.
+ *
+ * Copyright 2022 Total Spectrum Software Inc.
+ * See the file COPYING for terms of use
+ */
+
+#ifndef ARENA_H_
+#define ARENA_H_
+#include <stddef.h>
+
+struct arena_block;
+
+struct arena {
+    struct arena_block *blocks; /* blocks allocated so far, newest first */
+    char *ptr;        /* next free byte in the newest block */
+    char *end;        /* end of the newest block */
+    size_t used;      /* total bytes handed out */
+    size_t reserved;  /* total bytes obtained from malloc */
+};
+
+typedef struct arena Arena;
+
+/* allocate N bytes (suitably aligned for any type); never fails */
+void *arena_alloc(struct arena *A, size_t N);
+
+/* allocate a copy of N bytes from buf */
+void *arena_memdup(struct arena *A, const void *buf, size_t N);
+
+/* release all memory in the arena at once */
+void arena_free(struct arena *A);
+
+#endif
@@ -0,0 +1,119 @@
+/*
+ * Simple support for running independent pieces of work on several
+ * threads at once.
+ *
+ * Copyright 2022 Total Spectrum Software Inc.
+ * See the file COPYING for terms of use
+ */
+
+#include <stdlib.h>
+#include <pthread.h>
+#include "jobs.h"
+
+typedef struct jobqueue {
+    void (*func)(void *arg, int i);
+    void *arg;
+    int njobs;
+    int next;
+    pthread_mutex_t lock;
+} JobQueue;
+
+static int active;
+static pthread_mutex_t sharedLock;
+static pthread_once_t sharedOnce = PTHREAD_ONCE_INIT;
+
+static void
+init_shared_lock(void)
+{
+    pthread_mutexattr_t attr;
+
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&sharedLock, &attr);
+    pthread_mutexattr_destroy(&attr);
+}
+
+static void *
+worker(void *ptr)
+{
+    JobQueue *Q = (JobQueue *)ptr;
+    int i;
+
+    for(;;) {
+        pthread_mutex_lock(&Q->lock);
+        i = Q->next;
+        if (i < Q->njobs) {
+            Q->next++;
+        }
+        pthread_mutex_unlock(&Q->lock);
+        if (i >= Q->njobs) {
+            break;
+        }
+        (*Q->func)(Q->arg, i);
+    }
+    return NULL;
+}
+
+void
+jobs_run(int nthreads, int njobs, void (*func)(void *arg, int i), void *arg)
+{
+    JobQueue Q;
+    pthread_t *threads;
+    int started = 0;
+    int i;
+
+    if (nthreads > njobs) {
+        nthreads = njobs;
+    }
+    if (nthreads <= 1) {
+        for (i = 0; i < njobs; i++) {
+            (*func)(arg, i);
+        }
+        return;
+    }
+    pthread_once(&sharedOnce, init_shared_lock);
+    Q.func = func;
+    Q.arg = arg;
+    Q.njobs = njobs;
+    Q.next = 0;
+    pthread_mutex_init(&Q.lock, NULL);
+    threads = (pthread_t *)calloc(nthreads - 1, sizeof(pthread_t));
+    active = 1;
+    for (i = 0; threads && i < nthreads - 1; i++) {
+        if (pthread_create(&threads[started], NULL, worker, &Q) != 0) {
+            break;
+        }
+        started++;
+    }
+    // the calling thread works too, so we make progress even if no
+    // threads could be started
+    worker(&Q);
+    for (i = 0; i < started; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    active = 0;
+    free(threads);
+    pthread_mutex_destroy(&Q.lock);
+}
+
+int
+jobs_active(void)
+{
+    return active;
+}
+
+void
+jobs_lock(void)
+{
+    if (active) {
+        pthread_mutex_lock(&sharedLock);
+    }
+}
+
+void
+jobs_unlock(void)
+{
+    if (active) {
+        pthread_mutex_unlock(&sharedLock);
+    }
+}
@@ -0,0 +1,35 @@
+/*
+ * Simple support for running independent pieces of work on several
+ * threads at once.
+ *
+ * Copyright 2022 Total Spectrum Software Inc.
+ * See the file COPYING for terms of use
+ */
+
+#ifndef JOBS_H_
+#define JOBS_H_
+
+#if defined(_MSC_VER)
+#define THREAD_LOCAL __declspec(thread)
+#else
+#define THREAD_LOCAL __thread
+#endif
+
+/*
+ * call func(arg, i) for every i from 0 to njobs-1, using up to
+ * nthreads threads (the calling thread is one of them); jobs are
+ * handed out in order, and all of them have finished on return
+ */
+void jobs_run(int nthreads, int njobs, void (*func)(void *arg, int i), void *arg);
+
+/* nonzero while jobs_run has more than one thread going */
+int jobs_active(void);
+
+/*
+ * lock protecting state shared between jobs; it may be taken
+ * recursively, and does nothing while only one thread is running
+ */
+void jobs_lock(void);
+void jobs_unlock(void);
+
+#endif
@@ -0,0 +1,355 @@
+/*
+ * Simple profiler for the phases of a compile
+ *
+ * Every timed span becomes an event; at the end the events are
+ * added up by phase and by function, and optionally written out in
+ * the Chrome trace event format (load it in chrome://tracing or
+ * https://ui.perfetto.dev).
+ *
+ * Copyright 2024 Total Spectrum Software Inc.
+ * See the file COPYING for terms of use
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+#if defined(_WIN32)
+#include <windows.h>
+#endif
+#include "jobs.h"
+#include "timereport.h"
+
+#define SHOW_FUNCS 20
+
+typedef struct tr_event {
+    const char *name;
+    const char *detail;
+    double start;
+    double dur;
+    double self;         /* dur minus time in nested spans */
+    size_t alloc;
+    unsigned long iterations;
+    int tid;
+    int span;            /* 0 for timereport_add */
+} TrEvent;
+
+typedef struct tr_total {
+    const char *name;
+    const char *detail;
+    const char *worst;   /* phase with the most time, for functions */
+    double worstTime;
+    double dur;
+    double self;
+    size_t alloc;
+    unsigned long calls;
+    unsigned long iterations;
+} TrTotal;
+
+int timereport_enabled;
+
+static const char *traceFile;
+static double startTime;
+static TrEvent *events;
+static size_t numEvents;
+static size_t maxEvents;
+static int nextThreadId;
+static pthread_mutex_t eventLock = PTHREAD_MUTEX_INITIALIZER;
+
+static THREAD_LOCAL struct timespan *curSpan;
+static THREAD_LOCAL size_t allocated;
+static THREAD_LOCAL int threadId;
+
+static double
+wallclock(void)
+{
+#if defined(_WIN32)
+    LARGE_INTEGER freq, now;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&now);
+    return (double)now.QuadPart / (double)freq.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+#endif
+}
+
+double
+timereport_now(void)
+{
+    return wallclock() - startTime;
+}
+
+void
+timereport_enable(const char *trace)
+{
+    traceFile = trace;
+    startTime = wallclock();
+    timereport_enabled = 1;
+}
+
+void
+timereport_alloc(size_t N)
+{
+    allocated += N;
+}
+
+static void
+add_event(TrEvent *ev)
+{
+    pthread_mutex_lock(&eventLock);
+    if (!threadId) {
+        threadId = ++nextThreadId;
+    }
+    ev->tid = threadId;
+    if (numEvents == maxEvents) {
+        maxEvents = maxEvents ? 2 * maxEvents : 1024;
+        events = (TrEvent *)realloc(events, maxEvents * sizeof(TrEvent));
+        if (!events) {
+            fprintf(stderr, "FATAL ERROR: out of memory\n");
+            abort();
+        }
+    }
+    events[numEvents++] = *ev;
+    pthread_mutex_unlock(&eventLock);
+}
+
+void
+timereport_begin(struct timespan *S, const char *name, const char *detail)
+{
+    if (!timereport_enabled) return;
+    S->name = name;
+    S->detail = detail;
+    S->children = 0.0;
+    S->alloc = allocated;
+    S->parent = curSpan;
+    curSpan = S;
+    S->start = timereport_now();
+}
+
+void
+timereport_end(struct timespan *S, unsigned long iterations)
+{
+    TrEvent ev;
+
+    if (!timereport_enabled) return;
+    ev.name = S->name;
+    ev.detail = S->detail;
+    ev.start = S->start;
+    ev.dur = timereport_now() - S->start;
+    ev.self = ev.dur - S->children;
+    ev.alloc = allocated - S->alloc;
+    ev.iterations = iterations;
+    ev.span = 1;
+    curSpan = S->parent;
+    if (curSpan) {
+        curSpan->children += ev.dur;
+    }
+    add_event(&ev);
+}
+
+void
+timereport_add(const char *name, const char *detail, double seconds, unsigned long iterations)
+{
+    TrEvent ev;
+
+    if (!timereport_enabled) return;
+    ev.name = name;
+    ev.detail = detail;
+    ev.start = 0.0;
+    ev.dur = ev.self = seconds;
+    ev.alloc = 0;
+    ev.iterations = iterations;
+    ev.span = 0;
+    if (curSpan) {
+        curSpan->children += seconds;
+    }
+    add_event(&ev);
+}
+
+static int
+cmp_str(const char *a, const char *b)
+{
+    if (a == b) return 0;
+    if (!a) return -1;
+    if (!b) return 1;
+    return strcmp(a, b);
+}
+
+static int
+cmp_event(const void *va, const void *vb)
+{
+    const TrEvent *a = (const TrEvent *)va;
+    const TrEvent *b = (const TrEvent *)vb;
+    int r = cmp_str(a->detail, b->detail);
+
+    return r ? r : cmp_str(a->name, b->name);
+}
+
+static int
+cmp_start(const void *va, const void *vb)
+{
+    const TrEvent *a = (const TrEvent *)va;
+    const TrEvent *b = (const TrEvent *)vb;
+
+    if (a->start < b->start) return -1;
+    if (a->start > b->start) return 1;
+    return a->tid - b->tid;
+}
+
+static int
+cmp_total(const void *va, const void *vb)
+{
+    const TrTotal *a = (const TrTotal *)va;
+    const TrTotal *b = (const TrTotal *)vb;
+
+    if (a->self > b->self) return -1;
+    if (a->self < b->self) return 1;
+    return cmp_str(a->name, b->name);
+}
+
+static void
+add_to_total(TrTotal *T, TrEvent *ev)
+{
+    T->dur += ev->dur;
+    T->self += ev->self;
+    T->alloc += ev->alloc;
+    T->iterations += ev->iterations;
+    T->calls++;
+}
+
+static void
+print_json_string(FILE *f, const char *s)
+{
+    fputc('"', f);
+    while (s && *s) {
+        if (*s == '"' || *s == '\\') {
+            fputc('\\', f);
+            fputc(*s, f);
+        } else if ((unsigned char)*s < ' ') {
+            fprintf(f, "\\u%04x", (unsigned char)*s);
+        } else {
+            fputc(*s, f);
+        }
+        s++;
+    }
+    fputc('"', f);
+}
+
+static void
+write_trace(const char *fname)
+{
+    FILE *f = fopen(fname, "w");
+    size_t i;
+    int first = 1;
+
+    if (!f) {
+        fprintf(stderr, "Unable to open trace file %s\n", fname);
+        return;
+    }
+    fprintf(f, "{\"traceEvents\": [");
+    for (i = 0; i < numEvents; i++) {
+        TrEvent *ev = &events[i];
+        if (!ev->span) continue;
+        fprintf(f, "%s\n {\"name\": ", first ? "" : ",");
+        print_json_string(f, ev->name);
+        fprintf(f, ", \"cat\": \"compile\", \"ph\": \"X\", \"pid\": 1, \"tid\": %d, \"ts\": %.1f, \"dur\": %.1f, \"args\": {",
+                ev->tid, ev->start * 1e6, ev->dur * 1e6);
+        if (ev->detail) {
+            fprintf(f, "\"detail\": ");
+            print_json_string(f, ev->detail);
+            fprintf(f, ", ");
+        }
+        fprintf(f, "\"iterations\": %lu, \"alloc\": %lu}}", ev->iterations, (unsigned long)ev->alloc);
+        first = 0;
+    }
+    fprintf(f, "\n],\n\"displayTimeUnit\": \"ms\"}\n");
+    fclose(f);
+}
+
+void
+timereport_finish(FILE *f)
+{
+    TrTotal *phases, *funcs;
+    size_t nphases = 0, nfuncs = 0;
+    size_t i, j;
+    double total, untracked;
+    TrTotal pair;
+
+    if (!timereport_enabled) return;
+    total = timereport_now();
+    timereport_enabled = 0;
+
+    // totals by phase
+    phases = (TrTotal *)calloc(numEvents + 1, sizeof(TrTotal));
+    for (i = 0; i < numEvents; i++) {
+        for (j = 0; j < nphases; j++) {
+            if (!strcmp(phases[j].name, events[i].name)) break;
+        }
+        if (j == nphases) {
+            phases[nphases++].name = events[i].name;
+        }
+        add_to_total(&phases[j], &events[i]);
+    }
+    qsort(phases, nphases, sizeof(TrTotal), cmp_total);
+
+    fprintf(f, "Time report: %.3f seconds wall time\n", total);
+    fprintf(f, "  %-28s %8s %8s %10s %10s %6s %10s\n", "phase", "calls", "iters", "total ms", "self ms", "self%", "alloc KB");
+    untracked = total;
+    for (i = 0; i < nphases; i++) {
+        TrTotal *T = &phases[i];
+        fprintf(f, "  %-28s %8lu %8lu %10.2f %10.2f %5.1f%% %10lu\n",
+                T->name, T->calls, T->iterations, T->dur * 1e3, T->self * 1e3,
+                total > 0 ? 100.0 * T->self / total : 0.0, (unsigned long)(T->alloc / 1024));
+        untracked -= T->self;
+    }
+    // with several threads the phases can add up to more than the total
+    if (untracked > 0) {
+        fprintf(f, "  %-28s %8s %8s %10s %10.2f %5.1f%%\n", "(not in any phase)", "", "", "",
+                untracked * 1e3, total > 0 ? 100.0 * untracked / total : 0.0);
+    }
+
+    // totals by function; sort so the events for each function (and
+    // within that each phase) are together
+    qsort(events, numEvents, sizeof(TrEvent), cmp_event);
+    funcs = (TrTotal *)calloc(numEvents + 1, sizeof(TrTotal));
+    for (i = 0; i < numEvents; i = j) {
+        if (!events[i].detail) {
+            j = i + 1;
+            continue;
+        }
+        if (nfuncs == 0 || cmp_str(funcs[nfuncs-1].detail, events[i].detail)) {
+            funcs[nfuncs++].detail = events[i].detail;
+        }
+        memset(&pair, 0, sizeof(pair));
+        for (j = i; j < numEvents && !cmp_event(&events[i], &events[j]); j++) {
+            add_to_total(&pair, &events[j]);
+            add_to_total(&funcs[nfuncs-1], &events[j]);
+        }
+        if (pair.self > funcs[nfuncs-1].worstTime) {
+            funcs[nfuncs-1].worstTime = pair.self;
+            funcs[nfuncs-1].worst = events[i].name;
+        }
+    }
+    qsort(funcs, nfuncs, sizeof(TrTotal), cmp_total);
+    if (nfuncs > 0) {
+        fprintf(f, "  %-28s %10s %10s  %s\n", "slowest functions/files", "self ms", "alloc KB", "mostly in");
+        for (i = 0; i < nfuncs && i < SHOW_FUNCS; i++) {
+            TrTotal *T = &funcs[i];
+            fprintf(f, "  %-28s %10.2f %10lu  %s (%.2f ms)\n", T->detail, T->self * 1e3,
+                    (unsigned long)(T->alloc / 1024), T->worst, T->worstTime * 1e3);
+        }
+    }
+    free(funcs);
+    free(phases);
+
+    if (traceFile) {
+        // the trace reads best in time order
+        qsort(events, numEvents, sizeof(TrEvent), cmp_start);
+        write_trace(traceFile);
+    }
+    free(events);
+    events = NULL;
+    numEvents = maxEvents = 0;
+}
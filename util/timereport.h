@@ -0,0 +1,49 @@
+/*
+ * Simple profiler for the phases of a compile
+ *
+ * Copyright 2024 Total Spectrum Software Inc.
+ * See the file COPYING for terms of use
+ */
+
+#ifndef TIMEREPORT_H_
+#define TIMEREPORT_H_
+
+#include <stdio.h>
+#include <stddef.h>
+
+/* one timed phase; these nest, and live on the stack of the caller */
+struct timespan {
+    const char *name;        /* phase name */
+    const char *detail;      /* e.g. function name, or NULL */
+    double start;            /* seconds since the report was enabled */
+    double children;         /* time spent in nested spans */
+    size_t alloc;            /* allocation count at the start */
+    struct timespan *parent;
+};
+
+/* nonzero once timereport_enable has been called */
+extern int timereport_enabled;
+
+/* start collecting data; "trace" (may be NULL) names a Chrome trace file */
+void timereport_enable(const char *trace);
+
+/* time from begin to end is charged to the phase "name" */
+void timereport_begin(struct timespan *S, const char *name, const char *detail);
+void timereport_end(struct timespan *S, unsigned long iterations);
+
+/*
+ * charge "seconds" to a phase without recording an event in the trace;
+ * for many short pieces of work that are added up by the caller
+ */
+void timereport_add(const char *name, const char *detail, double seconds, unsigned long iterations);
+
+/* seconds since the report was enabled */
+double timereport_now(void);
+
+/* count N bytes allocated by the current thread */
+void timereport_alloc(size_t N);
+
+/* print the summary, and write the trace file if one was asked for */
+void timereport_finish(FILE *f);
+
+#endif